@@ -1,5 +1,6 @@
 #include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "riscv_private.h"
 #include "decode.h"
@@ -13,28 +14,1174 @@
 // this struct is only used for offset calculations
 static struct riscv_t rv;
 
-static void get_reg(struct cg_state_t *cg, cg_r32_t dst, uint32_t src) {
+// host calling convention argument registers
+#ifdef _WIN32
+enum { cg_arg0 = cg_rcx, cg_arg1 = cg_rdx, cg_arg2 = cg_r8 };
+#else
+enum { cg_arg0 = cg_rdi, cg_arg1 = cg_rsi, cg_arg2 = cg_rdx };
+#endif
+
+// register holding the riscv_t structure (callee save on all hosts)
+enum { cg_rv = cg_rbx };
+
+// register counting down the cycle budget, cycles_target - csr_cycle, while in
+// translated code (callee save on all hosts)
+enum { cg_budget = cg_rbp };
+
+// host registers which can hold guest registers (all callee save)
+static const cg_r32_t alloc_regs[] = {
+  cg_r12d, cg_r13d, cg_r14d, cg_r15d,
+#ifdef _WIN32
+  cg_esi, cg_edi,
+#endif
+};
+#define NUM_ALLOC_REGS (sizeof(alloc_regs) / sizeof(alloc_regs[0]))
+
+// stack frame offset where the callee save registers are saved
+#define FRAME_SAVE_OFFSET 32
+#define FRAME_SIZE        96
+
+static bool is_cached(const struct block_regs_t *regs, uint32_t reg) {
+  return regs->host[reg] >= 0;
+}
+
+static void get_reg(struct cg_state_t *cg, const struct block_regs_t *regs, cg_r32_t dst, uint32_t src) {
   if (src == rv_reg_zero) {
-    cg_xor_r32_r32(cg, dst, dst);
+    if (dst >= cg_r8d) {
+      cg_mov_r32_i32(cg, dst, 0);
+    }
+    else {
+      cg_xor_r32_r32(cg, dst, dst);
+    }
+  }
+  else if (is_cached(regs, src)) {
+    cg_mov_r32_r32(cg, dst, regs->host[src]);
+  }
+  else {
+    cg_mov_r32_r64disp(cg, dst, cg_rv, rv_offset(rv, X[src]));
+  }
+}
+
+static void set_reg(struct cg_state_t *cg, struct block_regs_t *regs, uint32_t dst, cg_r32_t src) {
+  if (dst == rv_reg_zero) {
+    return;
+  }
+  if (is_cached(regs, dst)) {
+    cg_mov_r32_r32(cg, regs->host[dst], src);
+    regs->dirty |= 1u << dst;
+  }
+  else {
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, X[dst]), src);
+  }
+}
+
+static void set_regi(struct cg_state_t *cg, struct block_regs_t *regs, uint32_t dst, int32_t imm) {
+  if (dst == rv_reg_zero) {
+    return;
+  }
+  if (is_cached(regs, dst)) {
+    cg_mov_r32_i32(cg, regs->host[dst], imm);
+    regs->dirty |= 1u << dst;
+  }
+  else {
+    cg_mov_r64disp_i32(cg, cg_rv, rv_offset(rv, X[dst]), imm);
+  }
+}
+
+// write back a cached register so it can be used as a memory operand
+static void sync_reg(struct cg_state_t *cg, struct block_regs_t *regs, uint32_t reg) {
+  if (regs->dirty & (1u << reg)) {
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, X[reg]), regs->host[reg]);
+    regs->dirty &= ~(1u << reg);
+  }
+}
+
+// load the cached registers in mask from the register file
+static void load_regs(struct cg_state_t *cg, const struct block_regs_t *regs, uint32_t mask) {
+  for (uint32_t r = 1; r < RV_NUM_REGS; ++r) {
+    if (is_cached(regs, r) && (mask & (1u << r))) {
+      cg_mov_r32_r64disp(cg, regs->host[r], cg_rv, rv_offset(rv, X[r]));
+    }
+  }
+}
+
+// call a host function which may access the register file
+static void gen_call(struct cg_state_t *cg, struct block_regs_t *regs, int32_t func) {
+  codegen_spill(cg, regs);
+  cg_call_r64disp(cg, cg_rv, func);
+  // the callee may have written to any register
+  load_regs(cg, regs, regs->live);
+}
+
+// bring csr_cycle up to date for a host function which may read or write it
+static void gen_sync_cycles(struct cg_state_t *cg, const struct block_regs_t *regs) {
+  // csr_cycle = cycles_target - budget + retired
+  cg_mov_r64_r64disp(cg, cg_rax, cg_rv, rv_offset(rv, jit.cycles_target));
+  cg_sub_r64_r64(cg, cg_rax, cg_budget);
+  cg_add_r64_i32(cg, cg_rax, regs->retired);
+  cg_mov_r64disp_r64(cg, cg_rv, rv_offset(rv, csr_cycle), cg_rax);
+}
+
+// recompute the budget after a host function which may have written csr_cycle
+static void gen_reload_cycles(struct cg_state_t *cg, const struct block_regs_t *regs) {
+  // budget = cycles_target - csr_cycle + retired
+  cg_mov_r64_r64disp(cg, cg_budget, cg_rv, rv_offset(rv, jit.cycles_target));
+  cg_sub_r64_r64disp(cg, cg_budget, cg_rv, rv_offset(rv, csr_cycle));
+  cg_add_r64_i32(cg, cg_budget, regs->retired);
+}
+
+// compare eax with a guest register
+static void gen_cmp_reg(struct cg_state_t *cg, const struct block_regs_t *regs, uint32_t reg) {
+  if (is_cached(regs, reg)) {
+    cg_cmp_r32_r32(cg, cg_eax, regs->host[reg]);
+  }
+  else {
+    cg_cmp_r32_r64disp(cg, cg_eax, cg_rv, rv_offset(rv, X[reg]));
+  }
+}
+
+// condition code under which a branch is taken
+static cg_cc_t branch_cc(uint8_t opcode) {
+  switch (opcode) {
+  case rv_inst_beq:  return cg_cc_eq;
+  case rv_inst_bne:  return cg_cc_ne;
+  case rv_inst_blt:  return cg_cc_lt;
+  case rv_inst_bge:  return cg_cc_ge;
+  case rv_inst_bltu: return cg_cc_c;
+  case rv_inst_bgeu: return cg_cc_ae;
+  default:
+    assert(!"unreachable");
+    return cg_cc_eq;
+  }
+}
+
+// note that the host flags were set from guest register reg, being non zero
+// under condition cc
+static void set_flags(struct block_regs_t *regs, uint32_t reg, cg_cc_t cc) {
+  regs->flags_reg = (uint8_t)reg;
+  regs->flags_cc = (uint8_t)cc;
+}
+
+// if the code for an alu instruction leaves the flags set from its result,
+// which is not so when it reduces to a move
+static bool alu_sets_flags(const struct rv_inst_t *i) {
+  switch (i->opcode) {
+  case rv_inst_addi:
+  case rv_inst_xori:
+  case rv_inst_ori:
+    return i->rs1 != rv_reg_zero && i->imm != 0;
+  case rv_inst_andi:
+    return i->imm != -1;
+  case rv_inst_slli:
+  case rv_inst_srli:
+  case rv_inst_srai:
+    return (i->imm & 0x1f) != 0;
+  case rv_inst_add:
+    return i->rs1 != rv_reg_zero && i->rs2 != rv_reg_zero;
+  case rv_inst_sub:
+  case rv_inst_xor:
+  case rv_inst_or:
+  case rv_inst_and:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// compare the operands of a branch, returning the condition under which it is
+// taken.  a branch on a register against zero needs no compare if the previous
+// instruction set the flags from that register.
+static cg_cc_t gen_branch_cmp(struct cg_state_t *cg, struct block_regs_t *regs, const struct rv_inst_t *i,
+                              uint32_t flags_reg, cg_cc_t flags_cc) {
+  if (flags_reg != rv_reg_zero) {
+    const bool rs1_flags = i->rs1 == flags_reg && i->rs2 == rv_reg_zero;
+    const bool rs2_flags = i->rs2 == flags_reg && i->rs1 == rv_reg_zero;
+    switch (i->opcode) {
+    case rv_inst_beq:
+    case rv_inst_bne:
+      if (rs1_flags || rs2_flags) {
+        ++regs->fused;
+        return (i->opcode == rv_inst_bne) ? flags_cc : (flags_cc ^ 1);
+      }
+      break;
+    case rv_inst_blt:
+    case rv_inst_bge:
+      if (rs1_flags && flags_cc == cg_cc_ne) {
+        ++regs->fused;
+        return (i->opcode == rv_inst_blt) ? cg_cc_s : cg_cc_ns;
+      }
+      break;
+    }
+  }
+  get_reg(cg, regs, cg_eax, i->rs1);
+  if (i->rs2 == rv_reg_zero) {
+    cg_test_r32_r32(cg, cg_eax, cg_eax);
+  }
+  else {
+    gen_cmp_reg(cg, regs, i->rs2);
+  }
+  return branch_cc(i->opcode);
+}
+
+// compute the effective address of a load or store into edx
+static void gen_addr(struct cg_state_t *cg, const struct block_regs_t *regs, const struct rv_inst_t *i) {
+  if (i->rs1 == rv_reg_zero) {
+    cg_mov_r32_i32(cg, cg_edx, i->imm);
+  }
+  else {
+    get_reg(cg, regs, cg_edx, i->rs1);
+    if (i->imm) {
+      cg_add_r32_i32(cg, cg_edx, i->imm);
+    }
+  }
+}
+
+// lookup the host page for the address in edx, leaving the page in rcx and
+// the page offset in eax.  misaligned accesses and unmapped pages jump to the
+// slow path, the locations to patch are returned in slow.
+static int gen_page_lookup(struct cg_state_t *cg, uint8_t align_mask, uint8_t *slow[2]) {
+  int num = 0;
+  if (align_mask) {
+    cg_test_r8_i8(cg, cg_dl, align_mask);
+    slow[num++] = cg_jcc_rel32(cg, cg_cc_ne, NULL);
+  }
+  cg_mov_r32_r32(cg, cg_eax, cg_edx);
+  cg_shr_r32_i8(cg, cg_eax, RV_PAGE_BITS);
+  cg_mov_r64_r64disp(cg, cg_rcx, cg_rv, rv_offset(rv, jit.page_table));
+  cg_mov_r64_r64sib(cg, cg_rcx, cg_rcx, cg_rax, 8);
+  cg_test_r64_r64(cg, cg_rcx, cg_rcx);
+  slow[num++] = cg_jcc_rel32(cg, cg_cc_eq, NULL);
+  cg_movzx_r32_r16(cg, cg_eax, cg_dx);
+  return num;
+}
+
+// pass the address in edx as the second argument of a callback
+static void gen_arg_addr(struct cg_state_t *cg) {
+  // note: the argument aliases are not of the register enum
+  if ((int)cg_arg1 != (int)cg_rdx) {
+    cg_mov_r32_r32(cg, cg_arg1, cg_edx);
+  }
+}
+
+// load from the address in edx into eax
+static void gen_load(struct cg_state_t *cg, const struct riscv_jit_t *jit, uint32_t opcode) {
+  uint8_t *slow[2];
+  uint8_t *done = NULL;
+  int num_slow = 0;
+  // inline access of host mapped memory
+  if (jit->page_table) {
+    const uint8_t align_mask =
+      (opcode == rv_inst_lw || opcode == rv_inst_flw) ? 3 :
+      (opcode == rv_inst_lh || opcode == rv_inst_lhu) ? 1 : 0;
+    num_slow = gen_page_lookup(cg, align_mask, slow);
+    switch (opcode) {
+    case rv_inst_lb:
+      cg_movsx_r32_r64sib8(cg, cg_eax, cg_rcx, cg_rax, 1);
+      break;
+    case rv_inst_lh:
+      cg_movsx_r32_r64sib16(cg, cg_eax, cg_rcx, cg_rax, 1);
+      break;
+    case rv_inst_lw:
+    case rv_inst_flw:
+      cg_mov_r32_r64sib(cg, cg_eax, cg_rcx, cg_rax, 1);
+      break;
+    case rv_inst_lbu:
+      cg_movzx_r32_r64sib8(cg, cg_eax, cg_rcx, cg_rax, 1);
+      break;
+    case rv_inst_lhu:
+      cg_movzx_r32_r64sib16(cg, cg_eax, cg_rcx, cg_rax, 1);
+      break;
+    }
+    done = cg_jmp_rel32(cg, NULL);
+    for (int n = 0; n < num_slow; ++n) {
+      cg_patch_rel32(slow[n], cg->head);
+    }
+  }
+  // fallback to the io callbacks
+  gen_arg_addr(cg);                                                     // addr
+  cg_mov_r64_r64(cg, cg_arg0, cg_rv);                                   // rv
+  switch (opcode) {
+  case rv_inst_lb:
+    cg_call_r64disp(cg, cg_rv, rv_offset(rv, io.mem_read_b));
+    cg_movsx_r32_r8(cg, cg_eax, cg_al);
+    break;
+  case rv_inst_lh:
+    cg_call_r64disp(cg, cg_rv, rv_offset(rv, io.mem_read_s));
+    cg_movsx_r32_r16(cg, cg_eax, cg_ax);
+    break;
+  case rv_inst_lw:
+  case rv_inst_flw:
+    cg_call_r64disp(cg, cg_rv, rv_offset(rv, io.mem_read_w));
+    break;
+  case rv_inst_lbu:
+    cg_call_r64disp(cg, cg_rv, rv_offset(rv, io.mem_read_b));
+    cg_movzx_r32_r8(cg, cg_eax, cg_al);
+    break;
+  case rv_inst_lhu:
+    cg_call_r64disp(cg, cg_rv, rv_offset(rv, io.mem_read_s));
+    cg_movzx_r32_r16(cg, cg_eax, cg_ax);
+    break;
+  }
+  if (done) {
+    cg_patch_rel32(done, cg->head);
+  }
+}
+
+// load the value to be stored by a store instruction
+static void gen_store_value(struct cg_state_t *cg, const struct block_regs_t *regs, cg_r32_t dst,
+                            const struct rv_inst_t *i) {
+  if (i->opcode == rv_inst_fsw) {
+    cg_mov_r32_r64disp(cg, dst, cg_rv, rv_offset(rv, F[i->rs2]));
+  }
+  else {
+    get_reg(cg, regs, dst, i->rs2);
+  }
+}
+
+// store the value of a store instruction to the address in edx
+static void gen_store(struct cg_state_t *cg, const struct block_regs_t *regs, const struct riscv_jit_t *jit,
+                      const struct rv_inst_t *i) {
+  const uint32_t opcode = i->opcode;
+  uint8_t *slow[2];
+  uint8_t *done = NULL;
+  int num_slow = 0;
+  // inline access of host mapped memory
+  if (jit->page_table) {
+    const uint8_t align_mask =
+      (opcode == rv_inst_sw || opcode == rv_inst_fsw) ? 3 :
+      (opcode == rv_inst_sh) ? 1 : 0;
+    num_slow = gen_page_lookup(cg, align_mask, slow);
+    gen_store_value(cg, regs, cg_edx, i);
+    switch (opcode) {
+    case rv_inst_sb:
+      cg_mov_r64sib_r8(cg, cg_rcx, cg_rax, 1, cg_dl);
+      break;
+    case rv_inst_sh:
+      cg_mov_r64sib_r16(cg, cg_rcx, cg_rax, 1, cg_dx);
+      break;
+    case rv_inst_sw:
+    case rv_inst_fsw:
+      cg_mov_r64sib_r32(cg, cg_rcx, cg_rax, 1, cg_edx);
+      break;
+    }
+    done = cg_jmp_rel32(cg, NULL);
+    for (int n = 0; n < num_slow; ++n) {
+      cg_patch_rel32(slow[n], cg->head);
+    }
+  }
+  // fallback to the io callbacks
+  gen_arg_addr(cg);                                                     // addr
+  gen_store_value(cg, regs, cg_arg2, i);                                // value
+  cg_mov_r64_r64(cg, cg_arg0, cg_rv);                                   // rv
+  switch (opcode) {
+  case rv_inst_sb:
+    cg_call_r64disp(cg, cg_rv, rv_offset(rv, io.mem_write_b));
+    break;
+  case rv_inst_sh:
+    cg_call_r64disp(cg, cg_rv, rv_offset(rv, io.mem_write_s));
+    break;
+  case rv_inst_sw:
+  case rv_inst_fsw:
+    cg_call_r64disp(cg, cg_rv, rv_offset(rv, io.mem_write_w));
+    break;
+  }
+  if (done) {
+    cg_patch_rel32(done, cg->head);
+  }
+}
+
+// count leading zeros, trailing zeros or set bits of rs1, using the dedicated
+// instructions when the host has them
+static void gen_bitcount(struct cg_state_t *cg, struct block_regs_t *regs, const struct riscv_jit_t *jit,
+                         const struct rv_inst_t *i) {
+  get_reg(cg, regs, cg_eax, i->rs1);
+  switch (i->opcode) {
+  case rv_inst_clz:
+    if (jit->host_features & HOST_LZCNT) {
+      cg_lzcnt_r32_r32(cg, cg_eax, cg_eax);
+      break;
+    }
+    // 31 - bsr, where a zero input takes 63 to give 32
+    cg_bsr_r32_r32(cg, cg_ecx, cg_eax);
+    cg_mov_r32_i32(cg, cg_edx, 63);
+    cg_cmov_r32_r32(cg, cg_cc_eq, cg_ecx, cg_edx);
+    cg_xor_r32_i32(cg, cg_ecx, 31);
+    cg_mov_r32_r32(cg, cg_eax, cg_ecx);
+    break;
+  case rv_inst_ctz:
+    if (jit->host_features & HOST_BMI1) {
+      cg_tzcnt_r32_r32(cg, cg_eax, cg_eax);
+      break;
+    }
+    cg_bsf_r32_r32(cg, cg_ecx, cg_eax);
+    cg_mov_r32_i32(cg, cg_edx, 32);
+    cg_cmov_r32_r32(cg, cg_cc_eq, cg_ecx, cg_edx);
+    cg_mov_r32_r32(cg, cg_eax, cg_ecx);
+    break;
+  case rv_inst_cpop:
+    if (jit->host_features & HOST_POPCNT) {
+      cg_popcnt_r32_r32(cg, cg_eax, cg_eax);
+      break;
+    }
+    // sum bit pairs, nibbles then bytes
+    cg_mov_r32_r32(cg, cg_ecx, cg_eax);
+    cg_shr_r32_i8(cg, cg_ecx, 1);
+    cg_and_r32_i32(cg, cg_ecx, 0x55555555);
+    cg_sub_r32_r32(cg, cg_eax, cg_ecx);
+    cg_mov_r32_r32(cg, cg_ecx, cg_eax);
+    cg_shr_r32_i8(cg, cg_ecx, 2);
+    cg_and_r32_i32(cg, cg_eax, 0x33333333);
+    cg_and_r32_i32(cg, cg_ecx, 0x33333333);
+    cg_add_r32_r32(cg, cg_eax, cg_ecx);
+    cg_mov_r32_r32(cg, cg_ecx, cg_eax);
+    cg_shr_r32_i8(cg, cg_ecx, 4);
+    cg_add_r32_r32(cg, cg_eax, cg_ecx);
+    cg_and_r32_i32(cg, cg_eax, 0x0f0f0f0f);
+    cg_imul_r32_r32_i32(cg, cg_eax, cg_eax, 0x01010101);
+    cg_shr_r32_i8(cg, cg_eax, 24);
+    break;
+  }
+  set_reg(cg, regs, i->rd, cg_eax);
+}
+
+#if RISCV_VM_SUPPORT_RV32M
+// divide or take the remainder of rs1 by a nonzero constant
+static void gen_div_const(struct cg_state_t *cg, struct block_regs_t *regs, const struct rv_inst_t *i) {
+  const bool is_signed = i->opcode == rv_inst_div || i->opcode == rv_inst_rem;
+  const bool is_rem = i->opcode == rv_inst_rem || i->opcode == rv_inst_remu;
+  const int32_t d = i->imm;
+  const uint32_t abs_d = (is_signed && d < 0) ? -(uint32_t)d : (uint32_t)d;
+  const bool pow2 = (abs_d & (abs_d - 1)) == 0;
+  uint32_t shift = 0;
+  while (pow2 && (1u << shift) != abs_d) {
+    ++shift;
+  }
+  get_reg(cg, regs, cg_eax, i->rs1);
+  if (!is_signed && pow2) {
+    if (is_rem) {
+      cg_and_r32_i32(cg, cg_eax, abs_d - 1);
+    }
+    else {
+      cg_shr_r32_i8(cg, cg_eax, shift);
+    }
+    set_reg(cg, regs, i->rd, cg_eax);
+    return;
+  }
+  if (!is_signed) {
+    // q = (x * m) >> 64 with m = 2^64 / d rounded up, exact for 32 bit x
+    cg_mov_r32_r32(cg, cg_ecx, cg_eax);
+    cg_mov_r64_i64(cg, cg_rax, UINT64_MAX / abs_d + 1);
+    cg_mul_r64(cg, cg_rcx);
+  }
+  else if (abs_d == 1) {
+    cg_mov_r32_r32(cg, cg_edx, cg_eax);
+  }
+  else if (pow2) {
+    // q = (x + (x < 0 ? |d| - 1 : 0)) >> shift
+    cg_mov_r32_r32(cg, cg_edx, cg_eax);
+    cg_sar_r32_i8(cg, cg_edx, 31);
+    cg_shr_r32_i8(cg, cg_edx, 32 - shift);
+    cg_add_r32_r32(cg, cg_edx, cg_eax);
+    cg_sar_r32_i8(cg, cg_edx, shift);
+  }
+  else {
+    // divide the magnitude of x as above and restore its sign
+    cg_cdq(cg);
+    cg_mov_r32_r32(cg, cg_ecx, cg_edx);
+    cg_xor_r32_r32(cg, cg_eax, cg_ecx);
+    cg_sub_r32_r32(cg, cg_eax, cg_ecx);
+    cg_mov_r64_i64(cg, cg_rdx, UINT64_MAX / abs_d + 1);
+    cg_mul_r64(cg, cg_rdx);
+    cg_xor_r32_r32(cg, cg_edx, cg_ecx);
+    cg_sub_r32_r32(cg, cg_edx, cg_ecx);
+  }
+  if (is_signed && d < 0) {
+    cg_neg_r32(cg, cg_edx);
+  }
+  // the quotient is in edx
+  if (is_rem) {
+    // r = x - q * d
+    cg_imul_r32_r32_i32(cg, cg_edx, cg_edx, d);
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_sub_r32_r32(cg, cg_eax, cg_edx);
+    set_reg(cg, regs, i->rd, cg_eax);
+  }
+  else {
+    set_reg(cg, regs, i->rd, cg_edx);
+  }
+}
+
+// divide or take the remainder of rs1 by rs2, where dividing by zero gives all
+// ones (or the dividend) and dividing by -1 is a negation so that the overflow
+// case INT_MIN / -1 never reaches idiv
+static void gen_div(struct cg_state_t *cg, struct block_regs_t *regs, const struct rv_inst_t *i) {
+  if (i->imm) {
+    gen_div_const(cg, regs, i);
+    return;
+  }
+  const bool is_signed = i->opcode == rv_inst_div || i->opcode == rv_inst_rem;
+  const bool is_rem = i->opcode == rv_inst_rem || i->opcode == rv_inst_remu;
+  get_reg(cg, regs, cg_ecx, i->rs2);
+  get_reg(cg, regs, cg_eax, i->rs1);
+  cg_cmp_r32_i32(cg, cg_ecx, 0);
+  uint8_t *zero = cg_jcc_rel32(cg, cg_cc_eq, NULL);
+  uint8_t *minus_one = NULL;
+  if (is_signed) {
+    cg_cmp_r32_i32(cg, cg_ecx, -1);
+    minus_one = cg_jcc_rel32(cg, cg_cc_eq, NULL);
+    cg_cdq(cg);
+    cg_idiv_r32(cg, cg_ecx);
+  }
+  else {
+    cg_xor_r32_r32(cg, cg_edx, cg_edx);
+    cg_div_r32(cg, cg_ecx);
+  }
+  // the quotient is in eax and the remainder in edx
+  const cg_r32_t result = is_rem ? cg_edx : cg_eax;
+  uint8_t *done = cg_jmp_rel32(cg, NULL);
+  uint8_t *done_minus_one = NULL;
+  if (minus_one) {
+    cg_patch_rel32(minus_one, cg->head);
+    if (is_rem) {
+      cg_xor_r32_r32(cg, cg_edx, cg_edx);
+    }
+    else {
+      cg_neg_r32(cg, cg_eax);
+    }
+    done_minus_one = cg_jmp_rel32(cg, NULL);
+  }
+  cg_patch_rel32(zero, cg->head);
+  if (is_rem) {
+    cg_mov_r32_r32(cg, cg_edx, cg_eax);
+  }
+  else {
+    cg_mov_r32_i32(cg, cg_eax, ~0u);
+  }
+  cg_patch_rel32(done, cg->head);
+  if (done_minus_one) {
+    cg_patch_rel32(done_minus_one, cg->head);
+  }
+  set_reg(cg, regs, i->rd, result);
+}
+#endif
+
+#if RISCV_VM_SUPPORT_RV32F
+// mxcsr rounding control bits
+#define MXCSR_RC 0x6000
+
+// the rounding mode an instruction needs the host set to, or -1 if it runs
+// the same under any mode
+static int inst_rounding(const struct rv_inst_t *i) {
+  switch (i->opcode) {
+  case rv_inst_fmadds:
+  case rv_inst_fmsubs:
+  case rv_inst_fnmsubs:
+  case rv_inst_fnmadds:
+  case rv_inst_fadds:
+  case rv_inst_fsubs:
+  case rv_inst_fmuls:
+  case rv_inst_fdivs:
+  case rv_inst_fsqrts:
+  case rv_inst_fcvtsw:
+  case rv_inst_fcvtswu:
+  case rv_inst_fmaddd:
+  case rv_inst_fmsubd:
+  case rv_inst_fnmsubd:
+  case rv_inst_fnmaddd:
+  case rv_inst_faddd:
+  case rv_inst_fsubd:
+  case rv_inst_fmuld:
+  case rv_inst_fdivd:
+  case rv_inst_fsqrtd:
+  case rv_inst_fcvtsd:
+    // note: the host has no ties to max magnitude mode, so gen_rmm rounds
+    //       to nearest even and fixes up ties
+    return (i->rm == RM_RMM) ? RM_RNE : i->rm;
+  case rv_inst_fsgnjs:
+  case rv_inst_fsgnjns:
+  case rv_inst_fsgnjxs:
+  case rv_inst_fmins:
+  case rv_inst_fmaxs:
+  case rv_inst_feqs:
+  case rv_inst_flts:
+  case rv_inst_fles:
+  case rv_inst_fclasss:
+  case rv_inst_fmvxw:
+  case rv_inst_fmvwx:
+  case rv_inst_fcvtws:
+  case rv_inst_fcvtwus:
+  case rv_inst_fsgnjd:
+  case rv_inst_fsgnjnd:
+  case rv_inst_fsgnjxd:
+  case rv_inst_fmind:
+  case rv_inst_fmaxd:
+  case rv_inst_feqd:
+  case rv_inst_fltd:
+  case rv_inst_fled:
+  case rv_inst_fclassd:
+  case rv_inst_fcvtwd:
+  case rv_inst_fcvtwud:
+  case rv_inst_fcvtds:
+  case rv_inst_fcvtdw:
+  case rv_inst_fcvtdwu:
+    return -1;
+  default:
+    // anything else may leave the block or call out to the runtime
+    return RM_DYN;
+  }
+}
+
+// switch the host rounding mode, leaving the exception flags as they are.
+// the mode set from frm is saved on leaving it so it can be put back.
+static void gen_rounding(struct cg_state_t *cg, struct block_regs_t *regs, int rm) {
+  static const uint32_t mxcsr_rc[] = { 0x0000, 0x6000, 0x2000, 0x4000 };
+  if (rm < 0 || (uint32_t)rm == regs->rm) {
+    return;
+  }
+  const int32_t mxcsr = rv_offset(rv, jit.mxcsr);
+  const int32_t mxcsr_dyn = rv_offset(rv, jit.mxcsr_dyn);
+  cg_stmxcsr_r64disp(cg, cg_rv, mxcsr);
+  cg_mov_r32_r64disp(cg, cg_eax, cg_rv, mxcsr);
+  if (regs->rm == RM_DYN) {
+    cg_mov_r64disp_r32(cg, cg_rv, mxcsr_dyn, cg_eax);
+  }
+  cg_and_r32_i32(cg, cg_eax, ~MXCSR_RC);
+  if (rm == RM_DYN) {
+    cg_mov_r32_r64disp(cg, cg_ecx, cg_rv, mxcsr_dyn);
+    cg_and_r32_i32(cg, cg_ecx, MXCSR_RC);
+    cg_or_r32_r32(cg, cg_eax, cg_ecx);
+  }
+  else if (rm < 4 && mxcsr_rc[rm]) {
+    cg_or_r32_i32(cg, cg_eax, mxcsr_rc[rm]);
+  }
+  cg_mov_r64disp_r32(cg, cg_rv, mxcsr, cg_eax);
+  cg_ldmxcsr_r64disp(cg, cg_rv, mxcsr);
+  regs->rm = rm;
+  regs->flags_reg = rv_reg_zero;
+}
+
+// if an instruction rounds to nearest with ties to max magnitude, which the
+// host has no mode for, when its rounding mode is rmm
+static bool inst_rounds_rmm(const struct riscv_jit_t *jit, const struct rv_inst_t *i) {
+  if (i->rm != RM_RMM && i->rm != RM_DYN) {
+    return false;
+  }
+  switch (i->opcode) {
+  case rv_inst_fmadds:
+  case rv_inst_fmsubs:
+  case rv_inst_fnmsubs:
+  case rv_inst_fnmadds:
+  case rv_inst_fmaddd:
+  case rv_inst_fmsubd:
+  case rv_inst_fnmsubd:
+  case rv_inst_fnmaddd:
+    // without fma3 these always go to handle_op_fma, which rounds them
+    return (jit->host_features & HOST_FMA) != 0;
+  case rv_inst_fadds:
+  case rv_inst_fsubs:
+  case rv_inst_fmuls:
+  case rv_inst_fdivs:
+  case rv_inst_fcvtsw:
+  case rv_inst_fcvtswu:
+  case rv_inst_faddd:
+  case rv_inst_fsubd:
+  case rv_inst_fmuld:
+  case rv_inst_fdivd:
+  case rv_inst_fcvtsd:
+    return true;
+  default:
+    // sqrt is never a tie
+    return false;
+  }
+}
+
+// leave rmm arithmetic to the runtime, returning the jump from it over the
+// inline code when frm picks between them, else NULL as there is no need for
+// the inline code
+// note: the callbacks only touch the float registers so the cached guest
+//       registers, being callee save, need not be spilled
+static uint8_t *gen_rmm(struct cg_state_t *cg, const struct riscv_jit_t *jit,
+                        struct block_regs_t *regs, const struct rv_inst_t *i, uint32_t inst) {
+  if (i->opcode == rv_inst_fcvtsw || i->opcode == rv_inst_fcvtswu) {
+    sync_reg(cg, regs, i->rs1);
+  }
+  uint8_t *other = NULL;
+  if (i->rm == RM_DYN) {
+    cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rv_offset(rv, csr_fcsr));
+    cg_and_r32_i32(cg, cg_eax, 0b111 << 5);
+    cg_cmp_r32_i32(cg, cg_eax, RM_RMM << 5);
+    other = cg_jcc_rel32(cg, cg_cc_ne, NULL);
+  }
+  // the fused multiply adds are the only ones outside the OP-FP opcode
+  const bool fma = (inst & 0x7f) != 0b1010011;
+  cg_mov_r64_r64(cg, cg_arg0, cg_rv);   // arg1 - rv
+  cg_mov_r32_i32(cg, cg_arg1, inst);    // arg2 - inst
+  cg_call_r64disp(cg, cg_rv, fma ? rv_offset(rv, jit.handle_op_fma) : rv_offset(rv, jit.handle_op_rmm));
+  if (!other) {
+    return NULL;
+  }
+  uint8_t *done = cg_jmp_rel32(cg, NULL);
+  cg_patch_rel32(other, cg->head);
+  return done;
+}
+
+// nan box the single just written to the low half of rd
+static void gen_fbox(struct cg_state_t *cg, uint32_t rd) {
+  cg_mov_r64disp_i32(cg, cg_rv, rv_offset(rv, F[rd].box), (int32_t)FP_NAN_BOX);
+}
+
+// store the float result in xmm0 to rd, as the canonical nan if it is a nan
+static void gen_fresult(struct cg_state_t *cg, uint32_t rd) {
+  cg_ucomiss_xmm_xmm(cg, cg_xmm0, cg_xmm0);
+  uint8_t *ordered = cg_jcc_rel32(cg, cg_cc_np, NULL);
+  cg_mov_r32_i32(cg, cg_eax, FP_CANONICAL_NAN);
+  cg_mov_xmm_r32(cg, cg_xmm0, cg_eax);
+  cg_patch_rel32(ordered, cg->head);
+  cg_movss_r64disp_xmm(cg, cg_rv, rv_offset(rv, F[rd]), cg_xmm0);
+  gen_fbox(cg, rd);
+}
+
+// fused multiply add of rs1 * rs2 and rs3, which without fma3 is left to the
+// runtime as a multiply then add would round twice
+static void gen_fma(struct cg_state_t *cg, const struct riscv_jit_t *jit, struct block_regs_t *regs,
+                    const struct rv_inst_t *i, uint32_t inst) {
+  if (!(jit->host_features & HOST_FMA)) {
+    cg_mov_r64_r64(cg, cg_arg0, cg_rv);   // arg1 - rv
+    cg_mov_r32_i32(cg, cg_arg1, inst);    // arg2 - inst
+    gen_call(cg, regs, rv_offset(rv, jit.handle_op_fma));
+    return;
+  }
+  // a nan addend is also left to the runtime, as fma3 does not flag infinity
+  // times zero as invalid when the addend is a quiet nan
+  const int32_t rs3 = rv_offset(rv, F[i->rs3]);
+  cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rv, rs3);
+  cg_ucomiss_xmm_xmm(cg, cg_xmm0, cg_xmm0);
+  uint8_t *nan = cg_jcc_rel32(cg, cg_cc_p, NULL);
+  cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+  cg_movss_xmm_r64disp(cg, cg_xmm1, cg_rv, rv_offset(rv, F[i->rs2]));
+  switch (i->opcode) {
+  case rv_inst_fmadds:   // rs1 * rs2 + rs3
+    cg_vfmadd213ss_xmm_xmm_r64disp(cg, cg_xmm0, cg_xmm1, cg_rv, rs3);
+    break;
+  case rv_inst_fmsubs:   // rs1 * rs2 - rs3
+    cg_vfmsub213ss_xmm_xmm_r64disp(cg, cg_xmm0, cg_xmm1, cg_rv, rs3);
+    break;
+  case rv_inst_fnmsubs:  // -(rs1 * rs2) + rs3
+    cg_vfnmadd213ss_xmm_xmm_r64disp(cg, cg_xmm0, cg_xmm1, cg_rv, rs3);
+    break;
+  case rv_inst_fnmadds:  // -(rs1 * rs2) - rs3
+    cg_vfnmsub213ss_xmm_xmm_r64disp(cg, cg_xmm0, cg_xmm1, cg_rv, rs3);
+    break;
+  }
+  gen_fresult(cg, i->rd);
+  uint8_t *done = cg_jmp_rel32(cg, NULL);
+  cg_patch_rel32(nan, cg->head);
+  // note: the callback only touches the float registers so the cached guest
+  //       registers, being callee save, need not be spilled
+  cg_mov_r64_r64(cg, cg_arg0, cg_rv);   // arg1 - rv
+  cg_mov_r32_i32(cg, cg_arg1, inst);    // arg2 - inst
+  cg_call_r64disp(cg, cg_rv, rv_offset(rv, jit.handle_op_fma));
+  cg_patch_rel32(done, cg->head);
+}
+
+// jump if the float bits in reg are a nan, clobbering ecx
+static uint8_t *gen_jnan(struct cg_state_t *cg, cg_r32_t reg) {
+  cg_mov_r32_r32(cg, cg_ecx, reg);
+  cg_and_r32_i32(cg, cg_ecx, ~FMASK_SIGN);
+  cg_cmp_r32_i32(cg, cg_ecx, FMASK_EXPN);
+  return cg_jcc_rel32(cg, cg_cc_ab, NULL);
+}
+
+// fmin/fmax where a nan operand yields the other operand, two nans yield the
+// canonical nan and -0 is less than +0
+static void gen_fminmax(struct cg_state_t *cg, const struct rv_inst_t *i) {
+  const bool is_min = i->opcode == rv_inst_fmins;
+  const int32_t rs1 = rv_offset(rv, F[i->rs1]);
+  const int32_t rs2 = rv_offset(rv, F[i->rs2]);
+  cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rv, rs1);
+  cg_ucomiss_xmm_r64disp(cg, cg_xmm0, cg_rv, rs2);
+  uint8_t *unordered = cg_jcc_rel32(cg, cg_cc_p, NULL);
+  uint8_t *not_equal = cg_jcc_rel32(cg, cg_cc_ne, NULL);
+  // equal values only differ when they are zeros of opposite sign
+  cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rs1);
+  cg_mov_r32_r64disp(cg, cg_edx, cg_rv, rs2);
+  if (is_min) {
+    cg_or_r32_r32(cg, cg_eax, cg_edx);
+  }
+  else {
+    cg_and_r32_r32(cg, cg_eax, cg_edx);
+  }
+  uint8_t *done_equal = cg_jmp_rel32(cg, NULL);
+  cg_patch_rel32(not_equal, cg->head);
+  if (is_min) {
+    cg_minss_xmm_r64disp(cg, cg_xmm0, cg_rv, rs2);
+  }
+  else {
+    cg_maxss_xmm_r64disp(cg, cg_xmm0, cg_rv, rs2);
+  }
+  cg_mov_r32_xmm(cg, cg_eax, cg_xmm0);
+  uint8_t *done_ordered = cg_jmp_rel32(cg, NULL);
+  // take whichever operand is not a nan
+  cg_patch_rel32(unordered, cg->head);
+  cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rs1);
+  uint8_t *rs1_nan = gen_jnan(cg, cg_eax);
+  uint8_t *done_rs1 = cg_jmp_rel32(cg, NULL);
+  cg_patch_rel32(rs1_nan, cg->head);
+  cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rs2);
+  uint8_t *rs2_nan = gen_jnan(cg, cg_eax);
+  uint8_t *done_rs2 = cg_jmp_rel32(cg, NULL);
+  cg_patch_rel32(rs2_nan, cg->head);
+  cg_mov_r32_i32(cg, cg_eax, 0x7fc00000);
+  cg_patch_rel32(done_equal, cg->head);
+  cg_patch_rel32(done_ordered, cg->head);
+  cg_patch_rel32(done_rs1, cg->head);
+  cg_patch_rel32(done_rs2, cg->head);
+  cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, F[i->rd]), cg_eax);
+  gen_fbox(cg, i->rd);
+}
+
+// feq/flt/fle which write 0 when either operand is a nan
+static void gen_fcmp(struct cg_state_t *cg, struct block_regs_t *regs, const struct rv_inst_t *i) {
+  const bool is_double = i->opcode == rv_inst_feqd || i->opcode == rv_inst_fltd || i->opcode == rv_inst_fled;
+  if (i->opcode == rv_inst_feqs || i->opcode == rv_inst_feqd) {
+    // equal and ordered
+    if (is_double) {
+      cg_movsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+      cg_ucomisd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+    }
+    else {
+      cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+      cg_ucomiss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+    }
+    cg_setcc_r8(cg, cg_cc_eq, cg_al);
+    cg_setcc_r8(cg, cg_cc_np, cg_cl);
+    cg_and_r8_r8(cg, cg_al, cg_cl);
+    cg_movzx_r32_r8(cg, cg_eax, cg_al);
+    set_reg(cg, regs, i->rd, cg_eax);
+    set_flags(regs, i->rd, cg_cc_ne);
+  }
+  else {
+    // compare swapped so unordered clears the carry test
+    const cg_cc_t cc = (i->opcode == rv_inst_flts || i->opcode == rv_inst_fltd) ? cg_cc_ab : cg_cc_ae;
+    if (is_double) {
+      cg_movsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+      cg_comisd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    }
+    else {
+      cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+      cg_comiss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    }
+    cg_setcc_r8(cg, cc, cg_al);
+    cg_movzx_r32_r8(cg, cg_eax, cg_al);
+    set_reg(cg, regs, i->rd, cg_eax);
+    set_flags(regs, i->rd, cc);
+  }
+}
+
+// fclass sets bit k of the negative classes -inf, normal, subnormal, -0 or
+// bit 7 - k of the positive classes in reverse order, or bit 8/9 for nans
+static void gen_fclass(struct cg_state_t *cg, struct block_regs_t *regs, const struct rv_inst_t *i) {
+  static const uint32_t bounds[] = { 1, 0x00800000, FMASK_EXPN };
+  cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rv_offset(rv, F[i->rs1]));
+  uint8_t *nan = gen_jnan(cg, cg_eax);
+  // k = 3 for zero, 2 for subnormal, 1 for normal and 0 for inf
+  uint8_t *have_k[3];
+  for (uint32_t n = 0; n < 3; ++n) {
+    cg_mov_r32_i32(cg, cg_edx, 3 - n);
+    cg_cmp_r32_i32(cg, cg_ecx, bounds[n]);
+    have_k[n] = cg_jcc_rel32(cg, cg_cc_c, NULL);
+  }
+  cg_xor_r32_r32(cg, cg_edx, cg_edx);
+  for (uint32_t n = 0; n < 3; ++n) {
+    cg_patch_rel32(have_k[n], cg->head);
+  }
+  // k ^ 7 when positive
+  cg_sar_r32_i8(cg, cg_eax, 31);
+  cg_xor_r32_i32(cg, cg_eax, ~0u);
+  cg_and_r32_i32(cg, cg_eax, 7);
+  cg_xor_r32_r32(cg, cg_eax, cg_edx);
+  cg_mov_r32_r32(cg, cg_ecx, cg_eax);
+  cg_mov_r32_i32(cg, cg_eax, 0x001);
+  uint8_t *done = cg_jmp_rel32(cg, NULL);
+  // signaling when the quiet bit is clear
+  cg_patch_rel32(nan, cg->head);
+  cg_shr_r32_i8(cg, cg_ecx, 22);
+  cg_and_r32_i32(cg, cg_ecx, 1);
+  cg_mov_r32_i32(cg, cg_eax, 0x100);
+  cg_patch_rel32(done, cg->head);
+  cg_shl_r32_cl(cg, cg_eax);
+  set_reg(cg, regs, i->rd, cg_eax);
+}
+
+// fcvt.w.s and fcvt.wu.s saturating out of range values
+static void gen_fcvt_w(struct cg_state_t *cg, const struct riscv_jit_t *jit, struct block_regs_t *regs,
+                       const struct rv_inst_t *i, uint32_t inst) {
+  const bool is_signed = i->opcode == rv_inst_fcvtws;
+  const int32_t rs1 = rv_offset(rv, F[i->rs1]);
+  // roundss immediate for rne, rtz, rdn and rup, which like cvttss2si raises
+  // inexact when the value was not an integer
+  static const uint8_t round_mode[] = { 0x0, 0x3, 0x1, 0x2 };
+  // smallest float bits of the negative values which round below zero
+  static const uint32_t below_zero[] = { 0xbf000001, 0xbf800000, 0x80000001, 0xbf800000 };
+  const uint32_t rm = i->rm;
+  if (rm >= RM_RMM || (rm != RM_RTZ && !(jit->host_features & HOST_SSE41))) {
+    // rmm, dyn or no sse4.1
+    cg_mov_r64_r64(cg, cg_arg0, cg_rv);   // arg1 - rv
+    cg_mov_r32_i32(cg, cg_arg1, inst);    // arg2 - inst
+    gen_call(cg, regs, rv_offset(rv, jit.handle_op_fp));
+    return;
+  }
+  uint8_t *negative = NULL;
+  if (!is_signed) {
+    // negative values which round below zero are found before converting,
+    // as the invalid result must not also raise inexact
+    cg_mov_r32_r64disp(cg, cg_edx, cg_rv, rs1);
+    cg_cmp_r32_i32(cg, cg_edx, below_zero[rm]);
+    uint8_t *not_below = cg_jcc_rel32(cg, cg_cc_c, NULL);
+    cg_cmp_r32_i32(cg, cg_edx, FMASK_SIGN | FMASK_EXPN);
+    negative = cg_jcc_rel32(cg, cg_cc_be, NULL);
+    cg_patch_rel32(not_below, cg->head);
+  }
+  if (rm == RM_RTZ) {
+    cg_cvttss2si_r64_r64disp(cg, cg_rax, cg_rv, rs1);
+  }
+  else {
+    cg_roundss_xmm_r64disp(cg, cg_xmm0, cg_rv, rs1, round_mode[rm]);
+    cg_cvttss2si_r64_xmm(cg, cg_rax, cg_xmm0);
+  }
+  // the 64 bit result is in range if it survives truncation to 32 bits
+  if (is_signed) {
+    cg_movsx_r64_r32(cg, cg_rcx, cg_eax);
+  }
+  else {
+    cg_mov_r32_r32(cg, cg_ecx, cg_eax);
+  }
+  cg_cmp_r64_r64(cg, cg_rcx, cg_rax);
+  uint8_t *in_range = cg_jcc_rel32(cg, cg_cc_eq, NULL);
+  // positive values and nans saturate to the maximum
+  cg_mov_r32_r64disp(cg, cg_edx, cg_rv, rs1);
+  cg_mov_r32_i32(cg, cg_eax, is_signed ? INT32_MAX : UINT32_MAX);
+  cg_cmp_r32_i32(cg, cg_edx, FMASK_SIGN);
+  uint8_t *positive = cg_jcc_rel32(cg, cg_cc_c, NULL);
+  cg_cmp_r32_i32(cg, cg_edx, FMASK_SIGN | FMASK_EXPN);
+  uint8_t *negative_nan = cg_jcc_rel32(cg, cg_cc_ab, NULL);
+  if (negative) {
+    cg_patch_rel32(negative, cg->head);
+  }
+  cg_mov_r32_i32(cg, cg_eax, is_signed ? (uint32_t)INT32_MIN : 0);
+  cg_patch_rel32(positive, cg->head);
+  cg_patch_rel32(negative_nan, cg->head);
+  // saturating is invalid
+  cg_or_r64disp_i32(cg, cg_rv, rv_offset(rv, csr_fcsr), FFLAG_NV);
+  cg_patch_rel32(in_range, cg->head);
+  set_reg(cg, regs, i->rd, cg_eax);
+}
+
+#if RISCV_VM_SUPPORT_RV32D
+// store the double result in xmm0 to rd, as the canonical nan if it is a nan
+static void gen_fresult_d(struct cg_state_t *cg, uint32_t rd) {
+  cg_ucomisd_xmm_xmm(cg, cg_xmm0, cg_xmm0);
+  uint8_t *ordered = cg_jcc_rel32(cg, cg_cc_np, NULL);
+  cg_mov_r64_i64(cg, cg_rax, FP_CANONICAL_NAN_D);
+  cg_mov_xmm_r64(cg, cg_xmm0, cg_rax);
+  cg_patch_rel32(ordered, cg->head);
+  cg_movsd_r64disp_xmm(cg, cg_rv, rv_offset(rv, F[rd]), cg_xmm0);
+}
+
+// fused multiply add of doubles, as gen_fma
+static void gen_fma_d(struct cg_state_t *cg, const struct riscv_jit_t *jit, struct block_regs_t *regs,
+                      const struct rv_inst_t *i, uint32_t inst) {
+  if (!(jit->host_features & HOST_FMA)) {
+    cg_mov_r64_r64(cg, cg_arg0, cg_rv);   // arg1 - rv
+    cg_mov_r32_i32(cg, cg_arg1, inst);    // arg2 - inst
+    gen_call(cg, regs, rv_offset(rv, jit.handle_op_fma));
+    return;
+  }
+  const int32_t rs3 = rv_offset(rv, F[i->rs3]);
+  cg_movsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rs3);
+  cg_ucomisd_xmm_xmm(cg, cg_xmm0, cg_xmm0);
+  uint8_t *nan = cg_jcc_rel32(cg, cg_cc_p, NULL);
+  cg_movsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+  cg_movsd_xmm_r64disp(cg, cg_xmm1, cg_rv, rv_offset(rv, F[i->rs2]));
+  switch (i->opcode) {
+  case rv_inst_fmaddd:   // rs1 * rs2 + rs3
+    cg_vfmadd213sd_xmm_xmm_r64disp(cg, cg_xmm0, cg_xmm1, cg_rv, rs3);
+    break;
+  case rv_inst_fmsubd:   // rs1 * rs2 - rs3
+    cg_vfmsub213sd_xmm_xmm_r64disp(cg, cg_xmm0, cg_xmm1, cg_rv, rs3);
+    break;
+  case rv_inst_fnmsubd:  // -(rs1 * rs2) + rs3
+    cg_vfnmadd213sd_xmm_xmm_r64disp(cg, cg_xmm0, cg_xmm1, cg_rv, rs3);
+    break;
+  case rv_inst_fnmaddd:  // -(rs1 * rs2) - rs3
+    cg_vfnmsub213sd_xmm_xmm_r64disp(cg, cg_xmm0, cg_xmm1, cg_rv, rs3);
+    break;
+  }
+  gen_fresult_d(cg, i->rd);
+  uint8_t *done = cg_jmp_rel32(cg, NULL);
+  cg_patch_rel32(nan, cg->head);
+  cg_mov_r64_r64(cg, cg_arg0, cg_rv);   // arg1 - rv
+  cg_mov_r32_i32(cg, cg_arg1, inst);    // arg2 - inst
+  cg_call_r64disp(cg, cg_rv, rv_offset(rv, jit.handle_op_fma));
+  cg_patch_rel32(done, cg->head);
+}
+
+// fld and fsd of the address in edx, inline when it is 8 byte aligned and
+// host mapped and otherwise as two word accesses by the runtime
+static void gen_fld_fsd(struct cg_state_t *cg, const struct riscv_jit_t *jit, const struct rv_inst_t *i) {
+  const bool is_load = i->opcode == rv_inst_fld;
+  uint8_t *slow[2];
+  uint8_t *done = NULL;
+  int num_slow = 0;
+  if (jit->page_table) {
+    num_slow = gen_page_lookup(cg, 7, slow);
+    if (is_load) {
+      cg_mov_r64_r64sib(cg, cg_rdx, cg_rcx, cg_rax, 1);
+      cg_mov_r64disp_r64(cg, cg_rv, rv_offset(rv, F[i->rd]), cg_rdx);
+    }
+    else {
+      cg_mov_r64_r64disp(cg, cg_rdx, cg_rv, rv_offset(rv, F[i->rs2]));
+      cg_mov_r64sib_r64(cg, cg_rcx, cg_rax, 1, cg_rdx);
+    }
+    done = cg_jmp_rel32(cg, NULL);
+    for (int n = 0; n < num_slow; ++n) {
+      cg_patch_rel32(slow[n], cg->head);
+    }
+  }
+  gen_arg_addr(cg);                                                     // addr
+  cg_mov_r32_i32(cg, cg_arg2, is_load ? i->rd : i->rs2);                // reg
+  cg_mov_r64_r64(cg, cg_arg0, cg_rv);                                   // rv
+  if (is_load) {
+    cg_call_r64disp(cg, cg_rv, rv_offset(rv, jit.handle_fld));
   }
   else {
-    cg_mov_r32_r64disp(cg, dst, cg_rsi, rv_offset(rv, X[src]));
+    cg_call_r64disp(cg, cg_rv, rv_offset(rv, jit.handle_fsd));
+  }
+  if (done) {
+    cg_patch_rel32(done, cg->head);
   }
 }
+#endif  // RISCV_VM_SUPPORT_RV32D
+#endif
 
-static void set_reg(struct cg_state_t *cg, uint32_t dst, cg_r32_t src) {
-  if (dst != rv_reg_zero) {
-    cg_mov_r64disp_r32(cg, cg_rsi, rv_offset(rv, X[dst]), src);
+#if RISCV_VM_SUPPORT_RV32A
+// compute the new memory value of an amo into edx from the old value in eax
+// and the rs2 value in r8d
+static void gen_amo_op(struct cg_state_t *cg, uint32_t opcode) {
+  cg_mov_r32_r32(cg, cg_edx, cg_eax);
+  switch (opcode) {
+  case rv_inst_amoxorw:
+    cg_xor_r32_r32(cg, cg_edx, cg_r8d);
+    break;
+  case rv_inst_amoandw:
+    cg_and_r32_r32(cg, cg_edx, cg_r8d);
+    break;
+  case rv_inst_amoorw:
+    cg_or_r32_r32(cg, cg_edx, cg_r8d);
+    break;
+  case rv_inst_amominw:
+    cg_cmp_r32_r32(cg, cg_edx, cg_r8d);
+    cg_cmov_r32_r32(cg, cg_cc_gt, cg_edx, cg_r8d);
+    break;
+  case rv_inst_amomaxw:
+    cg_cmp_r32_r32(cg, cg_edx, cg_r8d);
+    cg_cmov_r32_r32(cg, cg_cc_lt, cg_edx, cg_r8d);
+    break;
+  case rv_inst_amominuw:
+    cg_cmp_r32_r32(cg, cg_edx, cg_r8d);
+    cg_cmov_r32_r32(cg, cg_cc_ab, cg_edx, cg_r8d);
+    break;
+  case rv_inst_amomaxuw:
+    cg_cmp_r32_r32(cg, cg_edx, cg_r8d);
+    cg_cmov_r32_r32(cg, cg_cc_c, cg_edx, cg_r8d);
+    break;
+  default:
+    assert(!"unreachable");
   }
 }
 
-static void set_regi(struct cg_state_t *cg, uint32_t dst, int32_t imm) {
-  if (dst != rv_reg_zero) {
-    cg_mov_r64disp_i32(cg, cg_rsi, rv_offset(rv, X[dst]), imm);
+// rv32a instructions use host atomics on host mapped memory, falling back to
+// the amo handler for misaligned or io addresses
+static void gen_amo(struct cg_state_t *cg, struct block_regs_t *regs, const struct riscv_jit_t *jit,
+                    const struct rv_inst_t *i, uint32_t inst) {
+  if (!jit->page_table) {
+    cg_mov_r64_r64(cg, cg_arg0, cg_rv);   // arg1 - rv
+    cg_mov_r32_i32(cg, cg_arg1, inst);    // arg2 - inst
+    gen_call(cg, regs, rv_offset(rv, jit.handle_op_amo));
+    return;
+  }
+  // the handler reads its operands from the register file
+  sync_reg(cg, regs, i->rs1);
+  sync_reg(cg, regs, i->rs2);
+  // host address of the word into rcx
+  uint8_t *slow[2];
+  get_reg(cg, regs, cg_edx, i->rs1);
+  const int num_slow = gen_page_lookup(cg, 3, slow);
+  cg_add_r64_r64(cg, cg_rcx, cg_rax);
+  uint8_t *fail = NULL, *store = NULL;
+  switch (i->opcode) {
+  case rv_inst_lrw:
+    cg_mov_r32_r64disp(cg, cg_eax, cg_rcx, 0);
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, lr_addr), cg_edx);
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, lr_value), cg_eax);
+    break;
+  case rv_inst_scw:
+    // the reservation is used up whether or not the store succeeds
+    cg_cmp_r64disp_r32(cg, cg_rv, rv_offset(rv, lr_addr), cg_edx);
+    cg_mov_r64disp_i32(cg, cg_rv, rv_offset(rv, lr_addr), LR_NO_RESERVATION);
+    fail = cg_jcc_rel32(cg, cg_cc_ne, NULL);
+    // store only if memory still holds the value lr.w read
+    get_reg(cg, regs, cg_edx, i->rs2);
+    cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rv_offset(rv, lr_value));
+    cg_lock_cmpxchg_r64disp_r32(cg, cg_rcx, 0, cg_edx);
+    cg_setcc_r8(cg, cg_cc_ne, cg_al);
+    cg_movzx_r32_r8(cg, cg_eax, cg_al);
+    store = cg_jmp_rel32(cg, NULL);
+    cg_patch_rel32(fail, cg->head);
+    cg_mov_r32_i32(cg, cg_eax, 1);
+    cg_patch_rel32(store, cg->head);
+    break;
+  case rv_inst_amoswapw:
+    get_reg(cg, regs, cg_eax, i->rs2);
+    cg_xchg_r64disp_r32(cg, cg_rcx, 0, cg_eax);
+    break;
+  case rv_inst_amoaddw:
+    get_reg(cg, regs, cg_eax, i->rs2);
+    cg_lock_xadd_r64disp_r32(cg, cg_rcx, 0, cg_eax);
+    break;
+  default:
+    {
+      // compare and swap loop, cmpxchg reloads eax when it fails
+      get_reg(cg, regs, cg_r8d, i->rs2);
+      cg_mov_r32_r64disp(cg, cg_eax, cg_rcx, 0);
+      const uint8_t *retry = cg->head;
+      gen_amo_op(cg, i->opcode);
+      cg_lock_cmpxchg_r64disp_r32(cg, cg_rcx, 0, cg_edx);
+      cg_jcc_rel32(cg, cg_cc_ne, retry);
+    }
+    break;
+  }
+  if (i->rd != rv_reg_zero) {
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, X[i->rd]), cg_eax);
+  }
+  uint8_t *done = cg_jmp_rel32(cg, NULL);
+  for (int n = 0; n < num_slow; ++n) {
+    cg_patch_rel32(slow[n], cg->head);
+  }
+  cg_mov_r64_r64(cg, cg_arg0, cg_rv);     // arg1 - rv
+  cg_mov_r32_i32(cg, cg_arg1, inst);      // arg2 - inst
+  cg_call_r64disp(cg, cg_rv, rv_offset(rv, jit.handle_op_amo));
+  cg_patch_rel32(done, cg->head);
+  // both paths leave the result in the register file
+  if (i->rd != rv_reg_zero && is_cached(regs, i->rd)) {
+    cg_mov_r32_r64disp(cg, regs->host[i->rd], cg_rv, rv_offset(rv, X[i->rd]));
+    regs->dirty &= ~(1u << i->rd);
   }
 }
+#endif  // RISCV_VM_SUPPORT_RV32A
 
-bool codegen(const struct rv_inst_t *i, struct cg_state_t *cg, uint32_t pc, uint32_t inst) {
+bool codegen(const struct rv_inst_t *i, struct cg_state_t *cg, uint32_t pc, uint32_t inst,
+             const struct riscv_jit_t *jit, struct block_regs_t *regs) {
 
   // skip instructions that would purely store to X0
   if (i->rd == rv_reg_zero) {
@@ -44,33 +1191,52 @@ bool codegen(const struct rv_inst_t *i, struct cg_state_t *cg, uint32_t pc, uint
     }
   }
 
+#if RISCV_VM_SUPPORT_RV32F
+  gen_rounding(cg, regs, inst_rounding(i));
+#endif
+
+  // the flags set by the previous instruction, which a branch may use
+  const uint32_t flags_reg = regs->flags_reg;
+  const cg_cc_t flags_cc = regs->flags_cc;
+  regs->flags_reg = rv_reg_zero;
+
+#if RISCV_VM_SUPPORT_RV32F
+  uint8_t *rmm_done = NULL;
+  if (inst_rounds_rmm(jit, i)) {
+    rmm_done = gen_rmm(cg, jit, regs, i, inst);
+    if (!rmm_done) {
+      return true;
+    }
+  }
+#endif
+
   switch (i->opcode) {
 
   // ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
   // RV32I
   case rv_inst_lui:
-    set_regi(cg, i->rd, i->imm);
+    set_regi(cg, regs, i->rd, i->imm);
     break;
   case rv_inst_auipc:
-    set_regi(cg, i->rd, pc + i->imm);
+    set_regi(cg, regs, i->rd, pc + i->imm);
     break;
   case rv_inst_jal:
-    cg_mov_r64disp_i32(cg, cg_rsi, rv_offset(rv, PC), pc + i->imm);
-    set_regi(cg, i->rd, pc + 4);
+    cg_mov_r64disp_i32(cg, cg_rv, rv_offset(rv, PC), pc + i->imm);
+    set_regi(cg, regs, i->rd, pc + inst_length(inst));
     break;
   case rv_inst_jalr:
     if (i->rs1 == rv_reg_zero) {
       cg_mov_r32_i32(cg, cg_eax, i->imm & 0xfffffffe);
     }
     else {
-      get_reg(cg, cg_eax, i->rs1);
+      get_reg(cg, regs, cg_eax, i->rs1);
       if (i->imm) {
         cg_add_r32_i32(cg, cg_eax, i->imm);
       }
       cg_and_r32_i32(cg, cg_eax, 0xfffffffe);
     }
-    cg_mov_r64disp_r32(cg, cg_rsi, rv_offset(rv, PC), cg_eax);        // branch
-    set_regi(cg, i->rd, pc + 4);                                      // link
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, PC), cg_eax);        // branch
+    set_regi(cg, regs, i->rd, pc + inst_length(inst));               // link
     break;
   case rv_inst_beq:
   case rv_inst_bne:
@@ -78,447 +1244,518 @@ bool codegen(const struct rv_inst_t *i, struct cg_state_t *cg, uint32_t pc, uint
   case rv_inst_bge:
   case rv_inst_bltu:
   case rv_inst_bgeu:
-    get_reg(cg, cg_eax, i->rs1);
-    cg_cmp_r32_r64disp(cg, cg_eax, cg_rsi, rv_offset(rv, X[i->rs2]));
-    cg_mov_r32_i32(cg, cg_eax, pc + 4);
+    regs->branch_cc = (uint8_t)gen_branch_cmp(cg, regs, i, flags_reg, flags_cc);
+#if RISCV_JIT_BRANCH_JCC
+    // the flags are consumed by the jcc in codegen_exits
+#else
+    cg_mov_r32_i32(cg, cg_eax, pc + inst_length(inst));
     cg_mov_r32_i32(cg, cg_edx, pc + i->imm);
-    switch (i->opcode) {
-    case rv_inst_beq:
-      cg_cmov_r32_r32(cg, cg_cc_eq, cg_eax, cg_edx);
-      break;
-    case rv_inst_bne:
-      cg_cmov_r32_r32(cg, cg_cc_ne, cg_eax, cg_edx);
-      break;
-    case rv_inst_blt:
-      cg_cmov_r32_r32(cg, cg_cc_lt, cg_eax, cg_edx);
-      break;
-    case rv_inst_bge:
-      cg_cmov_r32_r32(cg, cg_cc_ge, cg_eax, cg_edx);
-      break;
-    case rv_inst_bltu:
-      cg_cmov_r32_r32(cg, cg_cc_c, cg_eax, cg_edx);
-      break;
-    case rv_inst_bgeu:
-      cg_cmov_r32_r32(cg, cg_cc_ae, cg_eax, cg_edx);
-      break;
-    }
-    cg_mov_r64disp_r32(cg, cg_rsi, rv_offset(rv, PC), cg_eax);
+    cg_cmov_r32_r32(cg, regs->branch_cc, cg_eax, cg_edx);
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, PC), cg_eax);
+#endif
     break;
   case rv_inst_lb:
   case rv_inst_lh:
   case rv_inst_lw:
   case rv_inst_lbu:
   case rv_inst_lhu:
-    cg_mov_r64_r64(cg, cg_rcx, cg_rsi);                                 // rv
-    if (i->rs1 == rv_reg_zero) {
-      cg_mov_r32_i32(cg, cg_edx, i->imm);                               // addr
-    }
-    else {
-      get_reg(cg, cg_edx, i->rs1);
-      if (i->imm) {
-        cg_add_r32_i32(cg, cg_edx, i->imm);                             // addr
-      }
-    }
-    switch (i->opcode) {
-    case rv_inst_lb:
-      cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.mem_read_b));
-      cg_movsx_r32_r8(cg, cg_eax, cg_al);
-      break;
-    case rv_inst_lh:
-      cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.mem_read_s));
-      cg_movsx_r32_r16(cg, cg_eax, cg_ax);
-      break;
-    case rv_inst_lw:
-      cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.mem_read_w));
-      break;
-    case rv_inst_lbu:
-      cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.mem_read_b));
-      break;
-    case rv_inst_lhu:
-      cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.mem_read_s));
-      break;
-    }
-    set_reg(cg, i->rd, cg_eax);
+    gen_addr(cg, regs, i);
+    gen_load(cg, jit, i->opcode);
+    set_reg(cg, regs, i->rd, cg_eax);
     break;
   case rv_inst_sb:
   case rv_inst_sh:
   case rv_inst_sw:
-    cg_mov_r64_r64(cg, cg_rcx, cg_rsi);                                 // rv
-    if (i->rs1 == rv_reg_zero) {
-      cg_mov_r32_i32(cg, cg_edx, i->imm);                               // addr
-    }
-    else {
-      get_reg(cg, cg_edx, i->rs1);
-      if (i->imm) {
-        cg_add_r32_i32(cg, cg_edx, i->imm);                             // addr
-      }
-    }
-    cg_movsx_r64_r64disp(cg, cg_r8, cg_rsi, rv_offset(rv, X[i->rs2]));  // value
-    switch (i->opcode) {
-    case rv_inst_sb:
-      cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.mem_write_b));       // store
-      break;
-    case rv_inst_sh:
-      cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.mem_write_s));       // store
-      break;
-    case rv_inst_sw:
-      cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.mem_write_w));       // store
-      break;
-    }
+    gen_addr(cg, regs, i);
+    gen_store(cg, regs, jit, i);
     break;
 
   case rv_inst_addi:
-    if (i->rd == i->rs1) {
-      cg_add_r64disp_i32(cg, cg_rsi, rv_offset(rv, X[i->rd]), i->imm);
+    if (i->rd == i->rs1 && !is_cached(regs, i->rd)) {
+      cg_add_r64disp_i32(cg, cg_rv, rv_offset(rv, X[i->rd]), i->imm);
     }
     else {
       if (i->rs1 == rv_reg_zero) {
-        set_regi(cg, i->rd, i->imm);
+        set_regi(cg, regs, i->rd, i->imm);
       }
       else {
-        get_reg(cg, cg_eax, i->rs1);
+        get_reg(cg, regs, cg_eax, i->rs1);
         if (i->imm) {
           cg_add_r32_i32(cg, cg_eax, i->imm);
         }
-        set_reg(cg, i->rd, cg_eax);
+        set_reg(cg, regs, i->rd, cg_eax);
       }
     }
     break;
   case rv_inst_slti:
-    cg_cmp_r64disp_i32(cg, cg_rsi, rv_offset(rv, X[i->rs1]), i->imm);
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_cmp_r32_i32(cg, cg_eax, i->imm);
     cg_setcc_r8(cg, cg_cc_lt, cg_dl);
     cg_movzx_r32_r8(cg, cg_eax, cg_dl);
-    set_reg(cg, i->rd, cg_eax);
+    set_reg(cg, regs, i->rd, cg_eax);
+    set_flags(regs, i->rd, cg_cc_lt);
     break;
   case rv_inst_sltiu:
-    cg_cmp_r64disp_i32(cg, cg_rsi, rv_offset(rv, X[i->rs1]), i->imm);
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_cmp_r32_i32(cg, cg_eax, i->imm);
     cg_setcc_r8(cg, cg_cc_c, cg_dl);
     cg_movzx_r32_r8(cg, cg_eax, cg_dl);
-    set_reg(cg, i->rd, cg_eax);
+    set_reg(cg, regs, i->rd, cg_eax);
+    set_flags(regs, i->rd, cg_cc_c);
     break;
   case rv_inst_xori:
-    if (i->rd == i->rs1) {
-      cg_xor_r64disp_i32(cg, cg_rsi, rv_offset(rv, X[i->rd]), i->imm);
+    if (i->rd == i->rs1 && !is_cached(regs, i->rd)) {
+      cg_xor_r64disp_i32(cg, cg_rv, rv_offset(rv, X[i->rd]), i->imm);
     }
     else {
-      get_reg(cg, cg_eax, i->rs1);
+      get_reg(cg, regs, cg_eax, i->rs1);
       cg_xor_r32_i32(cg, cg_eax, i->imm);
-      set_reg(cg, i->rd, cg_eax);
+      set_reg(cg, regs, i->rd, cg_eax);
     }
     break;
   case rv_inst_ori:
-    if (i->rd == i->rs1) {
-      cg_or_r64disp_i32(cg, cg_rsi, rv_offset(rv, X[i->rd]), i->imm);
+    if (i->rd == i->rs1 && !is_cached(regs, i->rd)) {
+      cg_or_r64disp_i32(cg, cg_rv, rv_offset(rv, X[i->rd]), i->imm);
     }
     else {
-      get_reg(cg, cg_eax, i->rs1);
+      get_reg(cg, regs, cg_eax, i->rs1);
       cg_or_r32_i32(cg, cg_eax, i->imm);
-      set_reg(cg, i->rd, cg_eax);
+      set_reg(cg, regs, i->rd, cg_eax);
     }
     break;
   case rv_inst_andi:
-    if (i->rd == i->rs1) {
-      cg_and_r64disp_i32(cg, cg_rsi, rv_offset(rv, X[i->rd]), i->imm);
+    if (i->rd == i->rs1 && !is_cached(regs, i->rd)) {
+      cg_and_r64disp_i32(cg, cg_rv, rv_offset(rv, X[i->rd]), i->imm);
     }
     else {
-      get_reg(cg, cg_eax, i->rs1);
+      get_reg(cg, regs, cg_eax, i->rs1);
       cg_and_r32_i32(cg, cg_eax, i->imm);
-      set_reg(cg, i->rd, cg_eax);
+      set_reg(cg, regs, i->rd, cg_eax);
     }
     break;
   case rv_inst_slli:
-    if (i->rd == i->rs1) {
-      cg_shl_r64disp_i8(cg, cg_rsi, rv_offset(rv, X[i->rd]), i->imm & 0x1f);
+    if (i->rd == i->rs1 && !is_cached(regs, i->rd)) {
+      cg_shl_r64disp_i8(cg, cg_rv, rv_offset(rv, X[i->rd]), i->imm & 0x1f);
     }
     else {
-      get_reg(cg, cg_eax, i->rs1);
+      get_reg(cg, regs, cg_eax, i->rs1);
       cg_shl_r32_i8(cg, cg_eax, i->imm & 0x1f);
-      set_reg(cg, i->rd, cg_eax);
+      set_reg(cg, regs, i->rd, cg_eax);
     }
     break;
   case rv_inst_srli:
-    if (i->rd == i->rs1) {
-      cg_shr_r64disp_i8(cg, cg_rsi, rv_offset(rv, X[i->rd]), i->imm & 0x1f);
+    if (i->rd == i->rs1 && !is_cached(regs, i->rd)) {
+      cg_shr_r64disp_i8(cg, cg_rv, rv_offset(rv, X[i->rd]), i->imm & 0x1f);
     }
     else {
-      get_reg(cg, cg_eax, i->rs1);
+      get_reg(cg, regs, cg_eax, i->rs1);
       cg_shr_r32_i8(cg, cg_eax, i->imm & 0x1f);
-      set_reg(cg, i->rd, cg_eax);
+      set_reg(cg, regs, i->rd, cg_eax);
     }
     break;
   case rv_inst_srai:
-    if (i->rd == i->rs1) {
-      cg_sar_r64disp_i8(cg, cg_rsi, rv_offset(rv, X[i->rd]), i->imm & 0x1f);
+    if (i->rd == i->rs1 && !is_cached(regs, i->rd)) {
+      cg_sar_r64disp_i8(cg, cg_rv, rv_offset(rv, X[i->rd]), i->imm & 0x1f);
     }
     else {
-      get_reg(cg, cg_eax, i->rs1);
+      get_reg(cg, regs, cg_eax, i->rs1);
       cg_sar_r32_i8(cg, cg_eax, i->imm & 0x1f);
-      set_reg(cg, i->rd, cg_eax);
+      set_reg(cg, regs, i->rd, cg_eax);
     }
     break;
 
   case rv_inst_add:
     if (i->rs2 == rv_reg_zero) {
-      get_reg(cg, cg_eax, i->rs1);
-      set_reg(cg, i->rd, cg_eax);
+      get_reg(cg, regs, cg_eax, i->rs1);
+      set_reg(cg, regs, i->rd, cg_eax);
     }
     else {
-      get_reg(cg, cg_ecx, i->rs2);
-      if (i->rs1 == i->rd) {
-        cg_add_r64disp_r32(cg, cg_rsi, rv_offset(rv, X[i->rd]), cg_ecx);
+      get_reg(cg, regs, cg_ecx, i->rs2);
+      if (i->rs1 == i->rd && !is_cached(regs, i->rd)) {
+        cg_add_r64disp_r32(cg, cg_rv, rv_offset(rv, X[i->rd]), cg_ecx);
       }
       else {
         if (i->rs1 == rv_reg_zero) {
-          set_reg(cg, i->rd, cg_ecx);
+          set_reg(cg, regs, i->rd, cg_ecx);
         }
         else {
-          get_reg(cg, cg_eax, i->rs1);
+          get_reg(cg, regs, cg_eax, i->rs1);
           cg_add_r32_r32(cg, cg_eax, cg_ecx);
-          set_reg(cg, i->rd, cg_eax);
+          set_reg(cg, regs, i->rd, cg_eax);
         }
       }
     }
     break;
   case rv_inst_sub:
-    get_reg(cg, cg_ecx, i->rs2);
-    if (i->rs1 == i->rd) {
-      cg_sub_r64disp_r32(cg, cg_rsi, rv_offset(rv, X[i->rd]), cg_ecx);
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    if (i->rs1 == i->rd && !is_cached(regs, i->rd)) {
+      cg_sub_r64disp_r32(cg, cg_rv, rv_offset(rv, X[i->rd]), cg_ecx);
     }
     else {
-      get_reg(cg, cg_eax, i->rs1);
+      get_reg(cg, regs, cg_eax, i->rs1);
       cg_sub_r32_r32(cg, cg_eax, cg_ecx);
-      set_reg(cg, i->rd, cg_eax);
+      set_reg(cg, regs, i->rd, cg_eax);
     }
     break;
   case rv_inst_sll:
-    get_reg(cg, cg_eax, i->rs1);
-    get_reg(cg, cg_ecx, i->rs2);
+    get_reg(cg, regs, cg_eax, i->rs1);
+    get_reg(cg, regs, cg_ecx, i->rs2);
     cg_and_r8_i8(cg, cg_cl, 0x1f);
     cg_shl_r32_cl(cg, cg_eax);
-    set_reg(cg, i->rd, cg_eax);
+    set_reg(cg, regs, i->rd, cg_eax);
     break;
   case rv_inst_slt:
-    get_reg(cg, cg_eax, i->rs1);
-    cg_cmp_r32_r64disp(cg, cg_eax, cg_rsi, rv_offset(rv, X[i->rs2]));
+    get_reg(cg, regs, cg_eax, i->rs1);
+    gen_cmp_reg(cg, regs, i->rs2);
     cg_setcc_r8(cg, cg_cc_lt, cg_dl);
     cg_movzx_r32_r8(cg, cg_eax, cg_dl);
-    set_reg(cg, i->rd, cg_eax);
+    set_reg(cg, regs, i->rd, cg_eax);
+    set_flags(regs, i->rd, cg_cc_lt);
     break;
   case rv_inst_sltu:
-    get_reg(cg, cg_eax, i->rs1);
-    cg_cmp_r32_r64disp(cg, cg_eax, cg_rsi, rv_offset(rv, X[i->rs2]));
+    get_reg(cg, regs, cg_eax, i->rs1);
+    gen_cmp_reg(cg, regs, i->rs2);
     cg_setcc_r8(cg, cg_cc_c, cg_dl);
     cg_movzx_r32_r8(cg, cg_eax, cg_dl);
-    set_reg(cg, i->rd, cg_eax);
+    set_reg(cg, regs, i->rd, cg_eax);
+    set_flags(regs, i->rd, cg_cc_c);
     break;
   case rv_inst_xor:
-    get_reg(cg, cg_ecx, i->rs2);
-    if (i->rs1 == i->rd) {
-      cg_xor_r64disp_r32(cg, cg_rsi, rv_offset(rv, X[i->rd]), cg_ecx);
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    if (i->rs1 == i->rd && !is_cached(regs, i->rd)) {
+      cg_xor_r64disp_r32(cg, cg_rv, rv_offset(rv, X[i->rd]), cg_ecx);
     }
     else {
-      get_reg(cg, cg_eax, i->rs1);
+      get_reg(cg, regs, cg_eax, i->rs1);
       cg_xor_r32_r32(cg, cg_eax, cg_ecx);
-      set_reg(cg, i->rd, cg_eax);
+      set_reg(cg, regs, i->rd, cg_eax);
     }
     break;
   case rv_inst_srl:
-    get_reg(cg, cg_eax, i->rs1);
-    get_reg(cg, cg_ecx, i->rs2);
+    get_reg(cg, regs, cg_eax, i->rs1);
+    get_reg(cg, regs, cg_ecx, i->rs2);
     cg_and_r8_i8(cg, cg_cl, 0x1f);
     cg_shr_r32_cl(cg, cg_eax);
-    set_reg(cg, i->rd, cg_eax);
+    set_reg(cg, regs, i->rd, cg_eax);
     break;
   case rv_inst_sra:
-    get_reg(cg, cg_eax, i->rs1);
-    get_reg(cg, cg_ecx, i->rs2);
+    get_reg(cg, regs, cg_eax, i->rs1);
+    get_reg(cg, regs, cg_ecx, i->rs2);
     cg_and_r8_i8(cg, cg_cl, 0x1f);
     cg_sar_r32_cl(cg, cg_eax);
-    set_reg(cg, i->rd, cg_eax);
+    set_reg(cg, regs, i->rd, cg_eax);
     break;
   case rv_inst_or:
-    get_reg(cg, cg_ecx, i->rs2);
-    if (i->rs1 == i->rd) {
-      cg_or_r64disp_r32(cg, cg_rsi, rv_offset(rv, X[i->rd]), cg_ecx);
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    if (i->rs1 == i->rd && !is_cached(regs, i->rd)) {
+      cg_or_r64disp_r32(cg, cg_rv, rv_offset(rv, X[i->rd]), cg_ecx);
     }
     else {
-      get_reg(cg, cg_eax, i->rs1);
+      get_reg(cg, regs, cg_eax, i->rs1);
       cg_or_r32_r32(cg, cg_eax, cg_ecx);
-      set_reg(cg, i->rd, cg_eax);
+      set_reg(cg, regs, i->rd, cg_eax);
     }
     break;
   case rv_inst_and:
-    get_reg(cg, cg_ecx, i->rs2);
-    if (i->rs1 == i->rd) {
-      cg_and_r64disp_r32(cg, cg_rsi, rv_offset(rv, X[i->rd]), cg_ecx);
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    if (i->rs1 == i->rd && !is_cached(regs, i->rd)) {
+      cg_and_r64disp_r32(cg, cg_rv, rv_offset(rv, X[i->rd]), cg_ecx);
     }
     else {
-      get_reg(cg, cg_eax, i->rs1);
+      get_reg(cg, regs, cg_eax, i->rs1);
       cg_and_r32_r32(cg, cg_eax, cg_ecx);
-      set_reg(cg, i->rd, cg_eax);
+      set_reg(cg, regs, i->rd, cg_eax);
     }
     break;
 
   case rv_inst_fence:
+    // x64 only reorders stores with later loads
+    if ((i->imm & 0x10) && (i->imm & 0x02)) {
+      cg_mfence(cg);
+    }
     break;
 
   case rv_inst_ecall:
-    cg_mov_r64disp_i32(cg, cg_rsi, rv_offset(rv, PC), pc + 4);
-    cg_mov_r64_r64(cg, cg_rcx, cg_rsi);
-    cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.on_ecall));
+    cg_mov_r64disp_i32(cg, cg_rv, rv_offset(rv, PC), pc + inst_length(inst));
+    cg_mov_r64_r64(cg, cg_arg0, cg_rv);
+    gen_sync_cycles(cg, regs);
+    gen_call(cg, regs, rv_offset(rv, io.on_ecall));
+    gen_reload_cycles(cg, regs);
     break;
   case rv_inst_ebreak:
-    cg_mov_r64disp_i32(cg, cg_rsi, rv_offset(rv, PC), pc + 4);
-    cg_mov_r64_r64(cg, cg_rcx, cg_rsi);
-    cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.on_ebreak));
+    cg_mov_r64disp_i32(cg, cg_rv, rv_offset(rv, PC), pc + inst_length(inst));
+    cg_mov_r64_r64(cg, cg_arg0, cg_rv);
+    gen_sync_cycles(cg, regs);
+    gen_call(cg, regs, rv_offset(rv, io.on_ebreak));
+    gen_reload_cycles(cg, regs);
     break;
 
   // ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
   // RV32M
   case rv_inst_mul:
-    get_reg(cg, cg_eax, i->rs1);
-    cg_imul_r64disp(cg, cg_rsi, rv_offset(rv, X[i->rs2]));
-    set_reg(cg, i->rd, cg_eax);
+    get_reg(cg, regs, cg_eax, i->rs1);
+    if (is_cached(regs, i->rs2)) {
+      cg_imul_r32(cg, regs->host[i->rs2]);
+    }
+    else {
+      cg_imul_r64disp(cg, cg_rv, rv_offset(rv, X[i->rs2]));
+    }
+    set_reg(cg, regs, i->rd, cg_eax);
     break;
   case rv_inst_mulh:
-    get_reg(cg, cg_eax, i->rs1);
-    cg_imul_r64disp(cg, cg_rsi, rv_offset(rv, X[i->rs2]));
-    set_reg(cg, i->rd, cg_edx);
+    get_reg(cg, regs, cg_eax, i->rs1);
+    if (is_cached(regs, i->rs2)) {
+      cg_imul_r32(cg, regs->host[i->rs2]);
+    }
+    else {
+      cg_imul_r64disp(cg, cg_rv, rv_offset(rv, X[i->rs2]));
+    }
+    set_reg(cg, regs, i->rd, cg_edx);
     break;
   case rv_inst_mulhu:
-    get_reg(cg, cg_eax, i->rs1);
-    cg_mul_r64disp(cg, cg_rsi, rv_offset(rv, X[i->rs2]));
-    set_reg(cg, i->rd, cg_edx);
+    get_reg(cg, regs, cg_eax, i->rs1);
+    if (is_cached(regs, i->rs2)) {
+      cg_mul_r32(cg, regs->host[i->rs2]);
+    }
+    else {
+      cg_mul_r64disp(cg, cg_rv, rv_offset(rv, X[i->rs2]));
+    }
+    set_reg(cg, regs, i->rd, cg_edx);
     break;
   case rv_inst_mulhsu:
+    // signed by unsigned as a 64 bit multiply
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_movsx_r64_r32(cg, cg_rax, cg_eax);
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    cg_imul_r64_r64(cg, cg_rax, cg_rcx);
+    cg_shr_r64_i8(cg, cg_rax, 32);
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
   case rv_inst_div:
   case rv_inst_divu:
   case rv_inst_rem:
   case rv_inst_remu:
-    // offload to a specific instruction handler
-    cg_mov_r64_r64(cg, cg_rcx, cg_rsi);   // arg1 - rv
-    cg_mov_r32_i32(cg, cg_edx, inst);     // arg2 - inst
-    cg_call_r64disp(cg, cg_rsi, rv_offset(rv, jit.handle_op_op));
+#if RISCV_VM_SUPPORT_RV32M
+    gen_div(cg, regs, i);
+#endif
     break;
 
   // ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
   // RV32F
   case rv_inst_flw:
-    cg_mov_r64_r64(cg, cg_rcx, cg_rsi);                                 // rv
-    get_reg(cg, cg_edx, i->rs1);
-    if (i->imm) {
-      cg_add_r32_i32(cg, cg_edx, i->imm);                               // addr
-    }
-    cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.mem_read_w));          // read
-    cg_mov_r64disp_r32(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_eax);
+    gen_addr(cg, regs, i);
+    gen_load(cg, jit, i->opcode);
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, F[i->rd]), cg_eax);
+    gen_fbox(cg, i->rd);
     break;
   case rv_inst_fsw:
-    cg_mov_r64_r64(cg, cg_rcx, cg_rsi);                                 // rv
-    if (i->rs1 == rv_reg_zero) {
-      cg_mov_r32_i32(cg, cg_edx, i->imm);                               // addr
-    }
-    else {
-      get_reg(cg, cg_edx, i->rs1);
-      if (i->imm) {
-        cg_add_r32_i32(cg, cg_edx, i->imm);                             // addr
-      }
-    }
-    cg_movsx_r64_r64disp(cg, cg_r8, cg_rsi, rv_offset(rv, F[i->rs2]));  // value
-    cg_call_r64disp(cg, cg_rsi, rv_offset(rv, io.mem_write_w));         // write
+    gen_addr(cg, regs, i);
+    gen_store(cg, regs, jit, i);
     break;
   case rv_inst_fmadds:
-    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs1]));
-    cg_mulss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs2]));
-    cg_addss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs3]));
-    cg_movss_r64disp_xmm(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_xmm0);
-    break;
   case rv_inst_fmsubs:
-    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs1]));
-    cg_mulss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs2]));
-    cg_subss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs3]));
-    cg_movss_r64disp_xmm(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_xmm0);
-    break;
   case rv_inst_fnmsubs:
-    // multiply
-    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs1]));
-    cg_mulss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs2]));
-    // negate
-    cg_mov_r32_xmm(cg, cg_eax, cg_xmm0);
-    cg_xor_r32_i32(cg, cg_eax, 0x80000000);
-    cg_mov_xmm_r32(cg, cg_xmm0, cg_eax);
-    // add
-    cg_addss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs3]));
-    // store
-    cg_movss_r64disp_xmm(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_xmm0);
-    break;
   case rv_inst_fnmadds:
-    // multiply
-    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs1]));
-    cg_mulss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs2]));
-    // negate
-    cg_mov_r32_xmm(cg, cg_eax, cg_xmm0);
-    cg_xor_r32_i32(cg, cg_eax, 0x80000000);
-    cg_mov_xmm_r32(cg, cg_xmm0, cg_eax);
-    // subtract
-    cg_subss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs3]));
-    // store
-    cg_movss_r64disp_xmm(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_xmm0);
+#if RISCV_VM_SUPPORT_RV32F
+    gen_fma(cg, jit, regs, i, inst);
+#endif
     break;
   case rv_inst_fadds:
-    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs1]));
-    cg_addss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs2]));
-    cg_movss_r64disp_xmm(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_xmm0);
+    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    cg_addss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+    gen_fresult(cg, i->rd);
     break;
   case rv_inst_fsubs:
-    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs1]));
-    cg_subss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs2]));
-    cg_movss_r64disp_xmm(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_xmm0);
+    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    cg_subss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+    gen_fresult(cg, i->rd);
     break;
   case rv_inst_fmuls:
-    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs1]));
-    cg_mulss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs2]));
-    cg_movss_r64disp_xmm(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_xmm0);
+    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    cg_mulss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+    gen_fresult(cg, i->rd);
     break;
   case rv_inst_fdivs:
-    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs1]));
-    cg_divss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs2]));
-    cg_movss_r64disp_xmm(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_xmm0);
+    cg_movss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    cg_divss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+    gen_fresult(cg, i->rd);
     break;
   case rv_inst_fsqrts:
-    cg_sqrtss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, F[i->rs1]));
-    cg_movss_r64disp_xmm(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_xmm0);
+    cg_sqrtss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    gen_fresult(cg, i->rd);
     break;
   case rv_inst_fsgnjs:
   case rv_inst_fsgnjns:
   case rv_inst_fsgnjxs:
+    // rs1 with the sign of rs2, its inverse or the xor of both signs
+    cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rv_offset(rv, F[i->rs1]));
+    cg_mov_r32_r64disp(cg, cg_edx, cg_rv, rv_offset(rv, F[i->rs2]));
+    if (i->opcode == rv_inst_fsgnjns) {
+      cg_xor_r32_i32(cg, cg_edx, FMASK_SIGN);
+    }
+    cg_and_r32_i32(cg, cg_edx, FMASK_SIGN);
+    if (i->opcode != rv_inst_fsgnjxs) {
+      cg_and_r32_i32(cg, cg_eax, ~FMASK_SIGN);
+    }
+    cg_xor_r32_r32(cg, cg_eax, cg_edx);
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, F[i->rd]), cg_eax);
+    gen_fbox(cg, i->rd);
+    break;
   case rv_inst_fmins:
   case rv_inst_fmaxs:
+#if RISCV_VM_SUPPORT_RV32F
+    gen_fminmax(cg, i);
+#endif
+    break;
   case rv_inst_feqs:
   case rv_inst_flts:
   case rv_inst_fles:
+#if RISCV_VM_SUPPORT_RV32F
+    gen_fcmp(cg, regs, i);
+#endif
+    break;
   case rv_inst_fclasss:
-    // defer to a handler function for these ones
-    cg_mov_r64_r64(cg, cg_rcx, cg_rsi);   // arg1 - rv
-    cg_mov_r32_i32(cg, cg_edx, inst);     // arg2 - inst
-    cg_call_r64disp(cg, cg_rsi, rv_offset(rv, jit.handle_op_fp));
+#if RISCV_VM_SUPPORT_RV32F
+    gen_fclass(cg, regs, i);
+#endif
     break;
   case rv_inst_fmvxw:
-    cg_mov_r32_r64disp(cg, cg_eax, cg_rsi, rv_offset(rv, F[i->rs1]));
-    cg_mov_r64disp_r32(cg, cg_rsi, rv_offset(rv, X[i->rd]), cg_eax);
+    cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rv_offset(rv, F[i->rs1]));
+    set_reg(cg, regs, i->rd, cg_eax);
     break;
   case rv_inst_fcvtws:
   case rv_inst_fcvtwus:
-    cg_cvttss2si_r32_r64disp(cg, cg_eax, cg_rsi, rv_offset(rv, F[i->rs1]));
-    cg_mov_r64disp_r32(cg, cg_rsi, rv_offset(rv, X[i->rd]), cg_eax);
+#if RISCV_VM_SUPPORT_RV32F
+    gen_fcvt_w(cg, jit, regs, i, inst);
+#endif
     break;
   case rv_inst_fcvtsw:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_cvtsi2ss_xmm_r32(cg, cg_xmm0, cg_eax);
+    cg_movss_r64disp_xmm(cg, cg_rv, rv_offset(rv, F[i->rd]), cg_xmm0);
+    gen_fbox(cg, i->rd);
+    break;
   case rv_inst_fcvtswu:
-    cg_cvtsi2ss_xmm_r64disp(cg, cg_xmm0, cg_rsi, rv_offset(rv, X[i->rs1]));
-    cg_movss_r64disp_xmm(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_xmm0);
+    // convert the zero extended value as a 64 bit integer
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_cvtsi2ss_xmm_r64(cg, cg_xmm0, cg_rax);
+    cg_movss_r64disp_xmm(cg, cg_rv, rv_offset(rv, F[i->rd]), cg_xmm0);
+    gen_fbox(cg, i->rd);
     break;
   case rv_inst_fmvwx:
-    get_reg(cg, cg_eax, i->rs1);
-    cg_mov_r64disp_r32(cg, cg_rsi, rv_offset(rv, F[i->rd]), cg_eax);
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, F[i->rd]), cg_eax);
+    gen_fbox(cg, i->rd);
+    break;
+
+  // ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
+  // RV32D
+  case rv_inst_fld:
+  case rv_inst_fsd:
+#if RISCV_VM_SUPPORT_RV32D
+    gen_addr(cg, regs, i);
+    gen_fld_fsd(cg, jit, i);
+#endif
+    break;
+  case rv_inst_fmaddd:
+  case rv_inst_fmsubd:
+  case rv_inst_fnmsubd:
+  case rv_inst_fnmaddd:
+#if RISCV_VM_SUPPORT_RV32D
+    gen_fma_d(cg, jit, regs, i, inst);
+#endif
+    break;
+  case rv_inst_faddd:
+#if RISCV_VM_SUPPORT_RV32D
+    cg_movsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    cg_addsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+    gen_fresult_d(cg, i->rd);
+#endif
+    break;
+  case rv_inst_fsubd:
+#if RISCV_VM_SUPPORT_RV32D
+    cg_movsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    cg_subsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+    gen_fresult_d(cg, i->rd);
+#endif
+    break;
+  case rv_inst_fmuld:
+#if RISCV_VM_SUPPORT_RV32D
+    cg_movsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    cg_mulsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+    gen_fresult_d(cg, i->rd);
+#endif
+    break;
+  case rv_inst_fdivd:
+#if RISCV_VM_SUPPORT_RV32D
+    cg_movsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    cg_divsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs2]));
+    gen_fresult_d(cg, i->rd);
+#endif
+    break;
+  case rv_inst_fsqrtd:
+#if RISCV_VM_SUPPORT_RV32D
+    cg_sqrtsd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    gen_fresult_d(cg, i->rd);
+#endif
+    break;
+  case rv_inst_fsgnjd:
+  case rv_inst_fsgnjnd:
+  case rv_inst_fsgnjxd:
+    // as the single forms on the high half, copying the low half of rs1
+    cg_mov_r32_r64disp(cg, cg_ecx, cg_rv, rv_offset(rv, F[i->rs1]));
+    cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rv_offset(rv, F[i->rs1]) + 4);
+    cg_mov_r32_r64disp(cg, cg_edx, cg_rv, rv_offset(rv, F[i->rs2]) + 4);
+    if (i->opcode == rv_inst_fsgnjnd) {
+      cg_xor_r32_i32(cg, cg_edx, FMASK_SIGN);
+    }
+    cg_and_r32_i32(cg, cg_edx, FMASK_SIGN);
+    if (i->opcode != rv_inst_fsgnjxd) {
+      cg_and_r32_i32(cg, cg_eax, ~FMASK_SIGN);
+    }
+    cg_xor_r32_r32(cg, cg_eax, cg_edx);
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, F[i->rd]), cg_ecx);
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, F[i->rd]) + 4, cg_eax);
+    break;
+  case rv_inst_feqd:
+  case rv_inst_fltd:
+  case rv_inst_fled:
+#if RISCV_VM_SUPPORT_RV32D
+    gen_fcmp(cg, regs, i);
+#endif
+    break;
+  case rv_inst_fcvtsd:
+#if RISCV_VM_SUPPORT_RV32D
+    cg_cvtsd2ss_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    gen_fresult(cg, i->rd);
+#endif
+    break;
+  case rv_inst_fcvtds:
+#if RISCV_VM_SUPPORT_RV32D
+    cg_cvtss2sd_xmm_r64disp(cg, cg_xmm0, cg_rv, rv_offset(rv, F[i->rs1]));
+    gen_fresult_d(cg, i->rd);
+#endif
+    break;
+  case rv_inst_fcvtdw:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_cvtsi2sd_xmm_r32(cg, cg_xmm0, cg_eax);
+    cg_movsd_r64disp_xmm(cg, cg_rv, rv_offset(rv, F[i->rd]), cg_xmm0);
+    break;
+  case rv_inst_fcvtdwu:
+    // convert the zero extended value as a 64 bit integer
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_cvtsi2sd_xmm_r64(cg, cg_xmm0, cg_rax);
+    cg_movsd_r64disp_xmm(cg, cg_rv, rv_offset(rv, F[i->rd]), cg_xmm0);
+    break;
+  case rv_inst_fmind:
+  case rv_inst_fmaxd:
+  case rv_inst_fclassd:
+  case rv_inst_fcvtwd:
+  case rv_inst_fcvtwud:
+    // offload to the float instruction handler
+    cg_mov_r64_r64(cg, cg_arg0, cg_rv);   // arg1 - rv
+    cg_mov_r32_i32(cg, cg_arg1, inst);    // arg2 - inst
+    gen_call(cg, regs, rv_offset(rv, jit.handle_op_fp));
     break;
 
   // ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
@@ -530,9 +1767,11 @@ bool codegen(const struct rv_inst_t *i, struct cg_state_t *cg, uint32_t pc, uint
   case rv_inst_csrrsi:
   case rv_inst_csrrci:
     // offload to a specific instruction handler
-    cg_mov_r64_r64(cg, cg_rcx, cg_rsi);   // arg1 - rv
-    cg_mov_r32_i32(cg, cg_edx, inst);     // arg2 - inst
-    cg_call_r64disp(cg, cg_rsi, rv_offset(rv, jit.handle_op_system));
+    cg_mov_r64_r64(cg, cg_arg0, cg_rv);   // arg1 - rv
+    cg_mov_r32_i32(cg, cg_arg1, inst);    // arg2 - inst
+    gen_sync_cycles(cg, regs);
+    gen_call(cg, regs, rv_offset(rv, jit.handle_op_system));
+    gen_reload_cycles(cg, regs);
     break;
 
   // ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
@@ -553,6 +1792,180 @@ bool codegen(const struct rv_inst_t *i, struct cg_state_t *cg, uint32_t pc, uint
   case rv_inst_amomaxw:
   case rv_inst_amominuw:
   case rv_inst_amomaxuw:
+#if RISCV_VM_SUPPORT_RV32A
+    gen_amo(cg, regs, jit, i, inst);
+#endif
+    break;
+
+  // ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
+  // RV32 Zba, Zbb and Zbs
+  case rv_inst_sh1add:
+  case rv_inst_sh2add:
+  case rv_inst_sh3add:
+    // rd = rs2 + rs1 * scale
+    get_reg(cg, regs, cg_eax, i->rs1);
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    cg_lea_r32_r64sib(cg, cg_eax, cg_rcx, cg_rax, 1u << (i->opcode - rv_inst_sh1add + 1));
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_andn:
+  case rv_inst_orn:
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    cg_not_r32(cg, cg_ecx);
+    get_reg(cg, regs, cg_eax, i->rs1);
+    if (i->opcode == rv_inst_andn) {
+      cg_and_r32_r32(cg, cg_eax, cg_ecx);
+    }
+    else {
+      cg_or_r32_r32(cg, cg_eax, cg_ecx);
+    }
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_xnor:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    cg_xor_r32_r32(cg, cg_eax, cg_ecx);
+    cg_not_r32(cg, cg_eax);
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_clz:
+  case rv_inst_ctz:
+  case rv_inst_cpop:
+    gen_bitcount(cg, regs, jit, i);
+    break;
+  case rv_inst_max:
+  case rv_inst_maxu:
+  case rv_inst_min:
+  case rv_inst_minu:
+  {
+    // take rs2 if rs1 compares the wrong way
+    static const cg_cc_t take_rs2[] = { cg_cc_lt, cg_cc_c, cg_cc_gt, cg_cc_ab };
+    get_reg(cg, regs, cg_eax, i->rs1);
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    cg_cmp_r32_r32(cg, cg_eax, cg_ecx);
+    cg_cmov_r32_r32(cg, take_rs2[i->opcode - rv_inst_max], cg_eax, cg_ecx);
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  }
+  case rv_inst_sextb:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_movsx_r32_r8(cg, cg_eax, cg_al);
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_sexth:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_movsx_r32_r16(cg, cg_eax, cg_ax);
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_zexth:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_movzx_r32_r16(cg, cg_eax, cg_ax);
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_rol:
+  case rv_inst_ror:
+    // the count is masked to 5 bits by the host as well
+    get_reg(cg, regs, cg_eax, i->rs1);
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    if (i->opcode == rv_inst_rol) {
+      cg_rol_r32_cl(cg, cg_eax);
+    }
+    else {
+      cg_ror_r32_cl(cg, cg_eax);
+    }
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_rori:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_ror_r32_i8(cg, cg_eax, i->imm & 0x1f);
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_orcb:
+    // the top bit of each non zero byte, spread over the byte by a multiply
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_mov_r32_r32(cg, cg_ecx, cg_eax);
+    cg_and_r32_i32(cg, cg_ecx, 0x7f7f7f7f);
+    cg_add_r32_i32(cg, cg_ecx, 0x7f7f7f7f);
+    cg_or_r32_r32(cg, cg_ecx, cg_eax);
+    cg_and_r32_i32(cg, cg_ecx, 0x80808080);
+    cg_shr_r32_i8(cg, cg_ecx, 7);
+    cg_imul_r32_r32_i32(cg, cg_eax, cg_ecx, 0xff);
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_rev8:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_bswap_r32(cg, cg_eax);
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_bclr:
+  case rv_inst_binv:
+  case rv_inst_bset:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    if (i->opcode == rv_inst_bclr) {
+      cg_btr_r32_r32(cg, cg_eax, cg_ecx);
+    }
+    else if (i->opcode == rv_inst_binv) {
+      cg_btc_r32_r32(cg, cg_eax, cg_ecx);
+    }
+    else {
+      cg_bts_r32_r32(cg, cg_eax, cg_ecx);
+    }
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_bext:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    get_reg(cg, regs, cg_ecx, i->rs2);
+    cg_shr_r32_cl(cg, cg_eax);
+    cg_and_r32_i32(cg, cg_eax, 1);
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_bclri:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_and_r32_i32(cg, cg_eax, ~(1u << (i->imm & 0x1f)));
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_binvi:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_xor_r32_i32(cg, cg_eax, 1u << (i->imm & 0x1f));
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_bseti:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_or_r32_i32(cg, cg_eax, 1u << (i->imm & 0x1f));
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+  case rv_inst_bexti:
+    get_reg(cg, regs, cg_eax, i->rs1);
+    cg_shr_r32_i8(cg, cg_eax, i->imm & 0x1f);
+    cg_and_r32_i32(cg, cg_eax, 1);
+    set_reg(cg, regs, i->rd, cg_eax);
+    break;
+
+  // ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
+  // RVV
+  case rv_inst_vsetvli:
+  case rv_inst_vsetivli:
+  case rv_inst_vsetvl:
+  case rv_inst_vle:
+  case rv_inst_vlse:
+  case rv_inst_vlxei:
+  case rv_inst_vse:
+  case rv_inst_vsse:
+  case rv_inst_vsxei:
+  case rv_inst_vopivv:
+  case rv_inst_vopfvv:
+  case rv_inst_vopmvv:
+  case rv_inst_vopivi:
+  case rv_inst_vopivx:
+  case rv_inst_vopfvf:
+  case rv_inst_vopmvx:
+#if RISCV_VM_SUPPORT_RVV
+    // offload to the vector unit, which runs its simd kernels for the host
+    cg_mov_r64_r64(cg, cg_arg0, cg_rv);   // arg1 - rv
+    cg_mov_r32_i32(cg, cg_arg1, inst);    // arg2 - inst
+    gen_call(cg, regs, rv_offset(rv, jit.handle_op_v));
+#endif
     break;
 
   default:
@@ -560,27 +1973,395 @@ bool codegen(const struct rv_inst_t *i, struct cg_state_t *cg, uint32_t pc, uint
     return false;
   }
 
+#if RISCV_VM_SUPPORT_RV32F
+  if (rmm_done) {
+    cg_patch_rel32(rmm_done, cg->head);
+  }
+#endif
+  if (alu_sets_flags(i)) {
+    set_flags(regs, i->rd, cg_cc_ne);
+  }
   // success
   return true;
 }
 
 void codegen_prologue(struct cg_state_t *cg) {
   // new stack frame
+  // note: rbp holds the cycle budget rather than a frame pointer
   cg_push_r64(cg, cg_rbp);
-  cg_mov_r64_r64(cg, cg_rbp, cg_rsp);
-  cg_sub_r64_i32(cg, cg_rsp, 64);
-  // save rsi
-  cg_mov_r64disp_r64(cg, cg_rsp, 32, cg_rsi);
-  // move rv struct pointer into rsi
-  cg_mov_r64_r64(cg, cg_rsi, cg_rcx);
+  cg_sub_r64_i32(cg, cg_rsp, FRAME_SIZE);
+  // save rbx and the allocatable registers
+  // note: chained blocks share this frame so all are saved up front
+  cg_mov_r64disp_r64(cg, cg_rsp, FRAME_SAVE_OFFSET, cg_rv);
+  for (uint32_t n = 0; n < NUM_ALLOC_REGS; ++n) {
+    cg_mov_r64disp_r64(cg, cg_rsp, FRAME_SAVE_OFFSET + 8 * (n + 1), alloc_regs[n]);
+  }
+  // move rv struct pointer into rbx
+  cg_mov_r64_r64(cg, cg_rv, cg_arg0);
+  // budget = cycles_target - csr_cycle
+  cg_mov_r64_r64disp(cg, cg_budget, cg_rv, rv_offset(rv, jit.cycles_target));
+  cg_sub_r64_r64disp(cg, cg_budget, cg_rv, rv_offset(rv, csr_cycle));
 }
 
 void codegen_epilogue(struct cg_state_t *cg) {
-  // restore rsi
-  cg_mov_r64_r64disp(cg, cg_rsi, cg_rsp, 32);
+  // csr_cycle = cycles_target - budget
+  cg_mov_r64_r64disp(cg, cg_rax, cg_rv, rv_offset(rv, jit.cycles_target));
+  cg_sub_r64_r64(cg, cg_rax, cg_budget);
+  cg_mov_r64disp_r64(cg, cg_rv, rv_offset(rv, csr_cycle), cg_rax);
+  // restore rbx and the allocatable registers
+  cg_mov_r64_r64disp(cg, cg_rv, cg_rsp, FRAME_SAVE_OFFSET);
+  for (uint32_t n = 0; n < NUM_ALLOC_REGS; ++n) {
+    cg_mov_r64_r64disp(cg, alloc_regs[n], cg_rsp, FRAME_SAVE_OFFSET + 8 * (n + 1));
+  }
   // leave stack frame
-  cg_mov_r64_r64(cg, cg_rsp, cg_rbp);
+  cg_add_r64_i32(cg, cg_rsp, FRAME_SIZE);
   cg_pop_r64(cg, cg_rbp);
   // return
   cg_ret(cg);
 }
+
+void codegen_cycles(struct cg_state_t *cg, uint32_t instructions) {
+  // budget -= instructions, leaving the flags of a branch compare intact
+  cg_lea_r64_r64disp(cg, cg_budget, cg_budget, -(int32_t)instructions);
+}
+
+// reset an exit before its code is emitted
+static void exit_init(struct block_exit_t *exit, uint32_t pc) {
+  memset(exit, 0, sizeof(*exit));
+  exit->pc = pc;
+}
+
+// emit a chainable exit for the branch at site_pc, returning to the dispatcher
+// if the cycle budget has been used up.  initially the patchable jump also
+// returns to the dispatcher.
+static void codegen_exit(struct cg_state_t *cg, struct block_exit_t *exit, uint32_t pc, uint32_t site_pc,
+                         uint8_t **ret) {
+  exit_init(exit, pc);
+  uint8_t *hot = NULL;
+#if RISCV_JIT_TRACE
+  if (pc <= site_pc) {
+    // backward exits lead to loops, count down to recording a trace of one
+    exit->counted = true;
+    exit->hot = (site_pc >> 2) & (TRACE_COUNTERS - 1);
+    cg_sub_r64disp_i32(cg, cg_rv, rv_offset(rv, jit.trace_hot[exit->hot]), 1);
+    hot = cg_jcc_rel32(cg, cg_cc_eq, NULL);
+  }
+#endif
+  cg_test_r64_r64(cg, cg_budget, cg_budget);
+  uint8_t *budget = cg_jcc_rel32(cg, cg_cc_le, NULL);
+  // align the displacement so it can be patched while other cores run it
+  const uint32_t pad = (3 - (uint32_t)(uintptr_t)cg->head) & 3;
+  for (uint32_t i = 0; i < pad; ++i) {
+    cg_nop(cg);
+  }
+  exit->jmp = cg_jmp_rel32(cg, NULL);
+  // let the dispatcher know which exit to link
+  cg_patch_rel32(budget, cg->head);
+  cg_patch_rel32(exit->jmp, cg->head);
+  if (hot) {
+    cg_patch_rel32(hot, cg->head);
+  }
+  cg_mov_r64_i64(cg, cg_rax, (uint64_t)exit);
+  cg_mov_r64disp_r64(cg, cg_rv, rv_offset(rv, jit.exit), cg_rax);
+  *ret = cg_jmp_rel32(cg, NULL);
+}
+
+// emit an exit whose successor is only known at runtime
+static void codegen_dynamic_exit(struct cg_state_t *cg, struct block_exit_t *exit) {
+  exit_init(exit, 0);
+  cg_mov_r64_i64(cg, cg_rax, (uint64_t)exit);
+  cg_mov_r64disp_r64(cg, cg_rv, rv_offset(rv, jit.exit), cg_rax);
+}
+
+#if RISCV_JIT_IBTC
+// registers which link a call to its return
+static bool is_link_reg(uint32_t reg) {
+  return reg == rv_reg_ra || reg == rv_reg_t0;
+}
+
+// push the return address of a call onto the return stack
+static void codegen_ras_push(struct cg_state_t *cg, uint32_t ret_pc) {
+  assert(sizeof(struct ras_entry_t) == 16);
+  // ras_top = (ras_top + 1) % RAS_ENTRIES
+  cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rv_offset(rv, jit.ras_top));
+  cg_add_r32_i32(cg, cg_eax, 1);
+  cg_and_r32_i32(cg, cg_eax, RAS_ENTRIES - 1);
+  cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, jit.ras_top), cg_eax);
+  // rcx = &ras[ras_top]
+  cg_shl_r32_i8(cg, cg_eax, 4);
+  cg_mov_r64_r64(cg, cg_rcx, cg_rv);
+  cg_add_r64_i32(cg, cg_rcx, rv_offset(rv, jit.ras));
+  cg_add_r64_r64(cg, cg_rcx, cg_rax);
+  cg_mov_r64disp_i32(cg, cg_rcx, offsetof(struct ras_entry_t, pc), ret_pc);
+  cg_lea_r64_r64disp(cg, cg_rax, cg_rv, rv_offset(rv, jit.ras_cont[ras_cont(ret_pc)]));
+  cg_mov_r64disp_r64(cg, cg_rcx, offsetof(struct ras_entry_t, code), cg_rax);
+}
+
+// emit an indirect branch exit.  returns are predicted by popping the return
+// stack, then the targets cached for this branch are tried before falling
+// back to the dispatcher which fills in the caches.
+static void codegen_indirect_exit(struct cg_state_t *cg, struct block_exit_t *exit, uint32_t pc, bool is_ret) {
+  exit_init(exit, 0);
+  exit->indirect = true;
+  exit->site_pc = pc;
+  if (is_ret) {
+    // pop ras[ras_top] into r8d (return address) and rdx (continuation)
+    cg_mov_r32_r64disp(cg, cg_ecx, cg_rv, rv_offset(rv, jit.ras_top));
+    cg_mov_r32_r32(cg, cg_edx, cg_ecx);
+    cg_sub_r32_i32(cg, cg_edx, 1);
+    cg_and_r32_i32(cg, cg_edx, RAS_ENTRIES - 1);
+    cg_mov_r64disp_r32(cg, cg_rv, rv_offset(rv, jit.ras_top), cg_edx);
+    cg_shl_r32_i8(cg, cg_ecx, 4);
+    cg_mov_r64_r64(cg, cg_rdx, cg_rv);
+    cg_add_r64_i32(cg, cg_rdx, rv_offset(rv, jit.ras));
+    cg_add_r64_r64(cg, cg_rdx, cg_rcx);
+    cg_mov_r32_r64disp(cg, cg_r8d, cg_rdx, offsetof(struct ras_entry_t, pc));
+    cg_mov_r64_r64disp(cg, cg_rdx, cg_rdx, offsetof(struct ras_entry_t, code));
+  }
+  cg_lea_r64_r64disp(cg, cg_rcx, cg_rv, rv_offset(rv, jit.ibtc[ibtc_site(pc)]));
+  // return to the dispatcher if the cycle budget has been used up
+  cg_test_r64_r64(cg, cg_budget, cg_budget);
+  uint8_t *budget = cg_jcc_rel32(cg, cg_cc_le, NULL);
+  cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rv_offset(rv, PC));
+  uint8_t *fill = NULL;
+  if (is_ret) {
+    cg_cmp_r32_r32(cg, cg_eax, cg_r8d);
+    uint8_t *not_ret = cg_jcc_rel32(cg, cg_cc_ne, NULL);
+    // jump to the continuation if it was filled in for this return address
+    cg_cmp_r32_r64disp(cg, cg_eax, cg_rdx, offsetof(struct ibtc_entry_t, pc));
+    uint8_t *empty = cg_jcc_rel32(cg, cg_cc_ne, NULL);
+    cg_add_r64disp_i32(cg, cg_rcx, offsetof(struct ibtc_site_t, hits), 1);
+    cg_jmp_r64disp(cg, cg_rdx, offsetof(struct ibtc_entry_t, code));
+    // ask the dispatcher to fill in the continuation
+    cg_patch_rel32(empty, cg->head);
+    cg_mov_r64disp_r64(cg, cg_rv, rv_offset(rv, jit.ras_fill), cg_rdx);
+    fill = cg_jmp_rel32(cg, NULL);
+    cg_patch_rel32(not_ret, cg->head);
+  }
+  for (uint32_t i = 0; i < IBTC_ENTRIES; ++i) {
+    const int32_t entry = offsetof(struct ibtc_site_t, ibtc) + i * sizeof(struct ibtc_entry_t);
+    cg_cmp_r32_r64disp(cg, cg_eax, cg_rcx, entry + offsetof(struct ibtc_entry_t, pc));
+    uint8_t *miss = cg_jcc_rel32(cg, cg_cc_ne, NULL);
+    cg_add_r64disp_i32(cg, cg_rcx, offsetof(struct ibtc_site_t, hits), 1);
+    cg_jmp_r64disp(cg, cg_rcx, entry + offsetof(struct ibtc_entry_t, code));
+    cg_patch_rel32(miss, cg->head);
+  }
+  cg_patch_rel32(budget, cg->head);
+  if (fill) {
+    cg_patch_rel32(fill, cg->head);
+  }
+  cg_mov_r64_i64(cg, cg_rax, (uint64_t)exit);
+  cg_mov_r64disp_r64(cg, cg_rv, rv_offset(rv, jit.exit), cg_rax);
+}
+#endif
+
+void codegen_exits(struct cg_state_t *cg, struct block_t *block, const struct block_regs_t *regs,
+                   const struct rv_inst_t *ir, uint32_t pc) {
+  uint8_t *ret[BLOCK_MAX_EXITS];
+  uint32_t num_ret = 0;
+  block->num_exits = 0;
+  switch (ir->opcode) {
+  case rv_inst_jal:
+  {
+    struct block_exit_t *exit = block->exits + block->num_exits++;
+#if RISCV_JIT_IBTC
+    if (is_link_reg(ir->rd)) {
+      codegen_ras_push(cg, block->pc_end);
+    }
+#endif
+    codegen_exit(cg, exit, pc + ir->imm, pc, ret + num_ret++);
+    break;
+  }
+  case rv_inst_beq:
+  case rv_inst_bne:
+  case rv_inst_blt:
+  case rv_inst_bge:
+  case rv_inst_bltu:
+  case rv_inst_bgeu:
+  {
+#if RISCV_JIT_BRANCH_JCC
+    // the flags are still live from the branch compare
+    uint8_t *taken = cg_jcc_rel32(cg, regs->branch_cc, NULL);
+    // fall out of the block if the branch is not taken
+    cg_mov_r64disp_i32(cg, cg_rv, rv_offset(rv, PC), block->pc_end);
+    codegen_exit(cg, block->exits + block->num_exits++, block->pc_end, pc, ret + num_ret++);
+    cg_patch_rel32(taken, cg->head);
+    cg_mov_r64disp_i32(cg, cg_rv, rv_offset(rv, PC), pc + ir->imm);
+    codegen_exit(cg, block->exits + block->num_exits++, pc + ir->imm, pc, ret + num_ret++);
+#else
+    // dispatch on the target selected by the branch
+    cg_mov_r32_r64disp(cg, cg_eax, cg_rv, rv_offset(rv, PC));
+    cg_cmp_r32_i32(cg, cg_eax, pc + ir->imm);
+    uint8_t *not_taken = cg_jcc_rel32(cg, cg_cc_ne, NULL);
+    codegen_exit(cg, block->exits + block->num_exits++, pc + ir->imm, pc, ret + num_ret++);
+    cg_patch_rel32(not_taken, cg->head);
+    codegen_exit(cg, block->exits + block->num_exits++, block->pc_end, pc, ret + num_ret++);
+#endif
+    break;
+  }
+  case rv_inst_jalr:
+  {
+    struct block_exit_t *exit = block->exits + block->num_exits++;
+#if RISCV_JIT_IBTC
+    if (is_link_reg(ir->rd)) {
+      codegen_ras_push(cg, block->pc_end);
+    }
+    const bool is_ret = ir->rd == rv_reg_zero && is_link_reg(ir->rs1);
+    codegen_indirect_exit(cg, exit, pc, is_ret);
+#else
+    codegen_dynamic_exit(cg, exit);
+#endif
+    break;
+  }
+  case rv_inst_ecall:
+  case rv_inst_ebreak:
+    // the successor is not known statically
+    codegen_dynamic_exit(cg, block->exits + block->num_exits++);
+    break;
+  default:
+    // the block was cut short so continue with the next instruction
+    cg_mov_r64disp_i32(cg, cg_rv, rv_offset(rv, PC), block->pc_end);
+    codegen_exit(cg, block->exits + block->num_exits++, block->pc_end, pc, ret + num_ret++);
+    break;
+  }
+  // exits return to the dispatcher via the epilogue
+  for (uint32_t i = 0; i < num_ret; ++i) {
+    cg_patch_rel32(ret[i], cg->head);
+  }
+  codegen_epilogue(cg);
+}
+
+#if RISCV_JIT_TRACE
+uint8_t *codegen_trace_guard(struct cg_state_t *cg, const struct block_regs_t *regs, const struct rv_inst_t *ir,
+                             uint32_t pc, uint32_t pc_end, uint32_t next_pc, uint32_t *exit_pc) {
+  switch (ir->opcode) {
+  case rv_inst_beq:
+  case rv_inst_bne:
+  case rv_inst_blt:
+  case rv_inst_bge:
+  case rv_inst_bltu:
+  case rv_inst_bgeu:
+  {
+    const uint32_t target = pc + ir->imm;
+    if (target == pc_end) {
+      return NULL;
+    }
+    *exit_pc = (next_pc == target) ? pc_end : target;
+#if RISCV_JIT_BRANCH_JCC
+    // the flags are still live from the branch compare
+    const cg_cc_t cc = regs->branch_cc;
+    return cg_jcc_rel32(cg, (next_pc == target) ? (cc ^ 1) : cc, NULL);
+#else
+    cg_cmp_r64disp_i32(cg, cg_rv, rv_offset(rv, PC), next_pc);
+    return cg_jcc_rel32(cg, cg_cc_ne, NULL);
+#endif
+  }
+  case rv_inst_jalr:
+    // leave if the target differs from the one recorded
+    *exit_pc = 1;
+    cg_cmp_r64disp_i32(cg, cg_rv, rv_offset(rv, PC), next_pc);
+    return cg_jcc_rel32(cg, cg_cc_ne, NULL);
+  default:
+    // jal and blocks which were cut short only have the one successor
+    return NULL;
+  }
+}
+
+void codegen_trace_loop(struct cg_state_t *cg, struct block_t *block, struct block_regs_t *regs,
+                        const uint8_t *loop_top, uint32_t site_pc, uint8_t **ret) {
+  // loop while there is cycle budget left, with the registers still cached
+  codegen_cycles(cg, block->instructions);
+  cg_test_r64_r64(cg, cg_budget, cg_budget);
+  cg_jcc_rel32(cg, cg_cc_gt, loop_top);
+  // otherwise leave through a chainable exit to the head
+  codegen_spill(cg, regs);
+  cg_mov_r64disp_i32(cg, cg_rv, rv_offset(rv, PC), block->pc_start);
+  block->num_exits = 1;
+  codegen_exit(cg, block->exits, block->pc_start, site_pc, ret);
+}
+
+void codegen_side_exit(struct cg_state_t *cg, struct block_exit_t *exit, const struct block_regs_t *regs,
+                       uint32_t site_pc, uint32_t pc, uint32_t instructions, uint8_t **ret) {
+  // write back the registers modified before the guard
+  struct block_regs_t snap = *regs;
+  codegen_spill(cg, &snap);
+  codegen_cycles(cg, instructions);
+  if (pc & 1) {
+    // the PC was set by the indirect branch
+#if RISCV_JIT_IBTC
+    codegen_indirect_exit(cg, exit, site_pc, false);
+#else
+    codegen_dynamic_exit(cg, exit);
+#endif
+    *ret = cg_jmp_rel32(cg, NULL);
+  }
+  else {
+    cg_mov_r64disp_i32(cg, cg_rv, rv_offset(rv, PC), pc);
+    codegen_exit(cg, exit, pc, site_pc, ret);
+  }
+}
+#endif
+
+void codegen_regalloc(struct block_regs_t *regs, const struct block_inst_t *insts, uint32_t count,
+                      uint32_t *live, uint32_t live_out) {
+  // count the register accesses in this block
+  uint32_t uses[RV_NUM_REGS] = { 0 };
+  for (uint32_t n = 0; n < count; ++n) {
+    uint32_t use, def;
+    inst_regs(&insts[n].ir, &use, &def);
+    for (uint32_t r = 1; r < RV_NUM_REGS; ++r) {
+      uses[r] += ((use >> r) & 1) + ((def >> r) & 1);
+    }
+  }
+  // assign host registers to the most accessed guest registers
+  for (uint32_t r = 0; r < RV_NUM_REGS; ++r) {
+    regs->host[r] = -1;
+  }
+  for (uint32_t n = 0; n < NUM_ALLOC_REGS; ++n) {
+    uint32_t best = 0;
+    for (uint32_t r = 1; r < RV_NUM_REGS; ++r) {
+      if (regs->host[r] < 0 && uses[r] > uses[best]) {
+        best = r;
+      }
+    }
+    // a single access gains nothing from caching
+    if (uses[best] < 2) {
+      break;
+    }
+    regs->host[best] = (int8_t)alloc_regs[n];
+  }
+  // registers read before being written after each instruction
+  uint32_t mask = live_out;
+  for (uint32_t n = count; n-- > 0;) {
+    live[n] = mask;
+    uint32_t use, def;
+    inst_regs(&insts[n].ir, &use, &def);
+    mask = (mask & ~def) | use;
+  }
+  regs->live_in = mask;
+  regs->live = mask;
+  regs->dirty = 0;
+  regs->rm = RM_DYN;
+  regs->flags_reg = rv_reg_zero;
+  regs->branch_cc = 0;
+  regs->fused = 0;
+}
+
+void codegen_fill(struct cg_state_t *cg, const struct block_regs_t *regs) {
+  load_regs(cg, regs, regs->live_in);
+}
+
+void codegen_spill(struct cg_state_t *cg, struct block_regs_t *regs) {
+  for (uint32_t r = 1; r < RV_NUM_REGS; ++r) {
+    sync_reg(cg, regs, r);
+  }
+}
+
+void codegen_dyn_round(struct cg_state_t *cg, struct block_regs_t *regs) {
+#if RISCV_VM_SUPPORT_RV32F
+  gen_rounding(cg, regs, RM_DYN);
+#else
+  (void)cg;
+  (void)regs;
+#endif
+}
@@ -42,6 +42,33 @@ static bool op_load( uint32_t inst, struct rv_inst_t *ir) {
   return true;
 }
 
+#if RISCV_VM_SUPPORT_Zifencei
+static bool op_misc_mem(uint32_t inst, struct rv_inst_t *ir) {
+
+  const uint32_t funct3 = dec_funct3(inst);
+  const int32_t  imm    = dec_itype_imm(inst);
+
+  ir->rd  = rv_reg_zero;
+  ir->rs1 = rv_reg_zero;
+  ir->imm = imm;
+
+  switch (funct3) {
+  case 0b000: // FENCE
+    ir->opcode = rv_inst_fence;
+    break;
+  case 0b001: // FENCE.I
+    ir->opcode = rv_inst_fencei;
+    break;
+  default:
+    return false;
+  }
+
+  return true;
+}
+#else
+#define op_misc_mem NULL
+#endif  // RISCV_VM_SUPPORT_Zifencei
+
 static bool op_op_imm( uint32_t inst, struct rv_inst_t *ir) {
 
   // i-type decode
@@ -59,8 +86,50 @@ static bool op_op_imm( uint32_t inst, struct rv_inst_t *ir) {
   case 0: // ADDI
     ir->opcode = rv_inst_addi;
     break;
-  case 1: // SLLI
-    ir->opcode = rv_inst_slli;
+  case 1:
+    // dispatch from the funct7 field of the immediate
+    switch ((uint32_t)imm >> 5) {
+    case 0b0000000: // SLLI
+      ir->opcode = rv_inst_slli;
+      break;
+#if RISCV_VM_SUPPORT_Zbb
+    case 0b0110000:
+      // dispatch from the rs2 field
+      switch (imm & 0x1f) {
+      case 0b00000: // CLZ
+        ir->opcode = rv_inst_clz;
+        break;
+      case 0b00001: // CTZ
+        ir->opcode = rv_inst_ctz;
+        break;
+      case 0b00010: // CPOP
+        ir->opcode = rv_inst_cpop;
+        break;
+      case 0b00100: // SEXT.B
+        ir->opcode = rv_inst_sextb;
+        break;
+      case 0b00101: // SEXT.H
+        ir->opcode = rv_inst_sexth;
+        break;
+      default:
+        return false;
+      }
+      break;
+#endif  // RISCV_VM_SUPPORT_Zbb
+#if RISCV_VM_SUPPORT_Zbs
+    case 0b0100100: // BCLRI
+      ir->opcode = rv_inst_bclri;
+      break;
+    case 0b0110100: // BINVI
+      ir->opcode = rv_inst_binvi;
+      break;
+    case 0b0010100: // BSETI
+      ir->opcode = rv_inst_bseti;
+      break;
+#endif  // RISCV_VM_SUPPORT_Zbs
+    default:
+      return false;
+    }
     break;
   case 2: // SLTI
     ir->opcode = rv_inst_slti;
@@ -72,13 +141,38 @@ static bool op_op_imm( uint32_t inst, struct rv_inst_t *ir) {
     ir->opcode = rv_inst_xori;
     break;
   case 5:
-    if (imm & ~0x1f) {
-      // SRAI
-      ir->opcode = rv_inst_srai;
-    }
-    else {
-      // SRLI
+    // dispatch from the funct7 field of the immediate
+    switch ((uint32_t)imm >> 5) {
+    case 0b0000000: // SRLI
       ir->opcode = rv_inst_srli;
+      break;
+    case 0b0100000: // SRAI
+      ir->opcode = rv_inst_srai;
+      break;
+#if RISCV_VM_SUPPORT_Zbb
+    case 0b0110000: // RORI
+      ir->opcode = rv_inst_rori;
+      break;
+    case 0b0010100: // ORC.B
+      if ((imm & 0x1f) != 0b00111) {
+        return false;
+      }
+      ir->opcode = rv_inst_orcb;
+      break;
+    case 0b0110100: // REV8
+      if ((imm & 0x1f) != 0b11000) {
+        return false;
+      }
+      ir->opcode = rv_inst_rev8;
+      break;
+#endif  // RISCV_VM_SUPPORT_Zbb
+#if RISCV_VM_SUPPORT_Zbs
+    case 0b0100100: // BEXTI
+      ir->opcode = rv_inst_bexti;
+      break;
+#endif  // RISCV_VM_SUPPORT_Zbs
+    default:
+      return false;
     }
     break;
   case 6: // ORI
@@ -151,6 +245,8 @@ static bool op_op( uint32_t inst, struct rv_inst_t *ir) {
   ir->rd  = rd;
   ir->rs1 = rs1;
   ir->rs2 = rs2;
+  // the optimizer may fill in a constant divisor
+  ir->imm = 0;
 
   switch (funct7) {
   case 0b0000000:
@@ -191,10 +287,106 @@ static bool op_op( uint32_t inst, struct rv_inst_t *ir) {
     case 0b101: // SRA
       ir->opcode = rv_inst_sra;
       break;
+#if RISCV_VM_SUPPORT_Zbb
+    case 0b100: // XNOR
+      ir->opcode = rv_inst_xnor;
+      break;
+    case 0b110: // ORN
+      ir->opcode = rv_inst_orn;
+      break;
+    case 0b111: // ANDN
+      ir->opcode = rv_inst_andn;
+      break;
+#endif  // RISCV_VM_SUPPORT_Zbb
+    default:
+      return false;
+    }
+    break;
+#if RISCV_VM_SUPPORT_Zba
+  case 0b0010000:
+    // RV32 Zba instructions
+    switch (funct3) {
+    case 0b010: // SH1ADD
+      ir->opcode = rv_inst_sh1add;
+      break;
+    case 0b100: // SH2ADD
+      ir->opcode = rv_inst_sh2add;
+      break;
+    case 0b110: // SH3ADD
+      ir->opcode = rv_inst_sh3add;
+      break;
+    default:
+      return false;
+    }
+    break;
+#endif  // RISCV_VM_SUPPORT_Zba
+#if RISCV_VM_SUPPORT_Zbb
+  case 0b0000101:
+    // RV32 Zbb min and max
+    switch (funct3) {
+    case 0b100: // MIN
+      ir->opcode = rv_inst_min;
+      break;
+    case 0b101: // MINU
+      ir->opcode = rv_inst_minu;
+      break;
+    case 0b110: // MAX
+      ir->opcode = rv_inst_max;
+      break;
+    case 0b111: // MAXU
+      ir->opcode = rv_inst_maxu;
+      break;
+    default:
+      return false;
+    }
+    break;
+  case 0b0110000:
+    // RV32 Zbb rotates
+    switch (funct3) {
+    case 0b001: // ROL
+      ir->opcode = rv_inst_rol;
+      break;
+    case 0b101: // ROR
+      ir->opcode = rv_inst_ror;
+      break;
     default:
       return false;
     }
     break;
+  case 0b0000100: // ZEXT.H
+    if (funct3 != 0b100 || rs2 != rv_reg_zero) {
+      return false;
+    }
+    ir->opcode = rv_inst_zexth;
+    break;
+#endif  // RISCV_VM_SUPPORT_Zbb
+#if RISCV_VM_SUPPORT_Zbs
+  case 0b0100100:
+    // RV32 Zbs clear and extract
+    switch (funct3) {
+    case 0b001: // BCLR
+      ir->opcode = rv_inst_bclr;
+      break;
+    case 0b101: // BEXT
+      ir->opcode = rv_inst_bext;
+      break;
+    default:
+      return false;
+    }
+    break;
+  case 0b0110100: // BINV
+    if (funct3 != 0b001) {
+      return false;
+    }
+    ir->opcode = rv_inst_binv;
+    break;
+  case 0b0010100: // BSET
+    if (funct3 != 0b001) {
+      return false;
+    }
+    ir->opcode = rv_inst_bset;
+    break;
+#endif  // RISCV_VM_SUPPORT_Zbs
 #if RISCV_VM_SUPPORT_RV32M
   case 0b0000001:
     // RV32M instructions
@@ -372,6 +564,135 @@ static bool op_system(uint32_t inst, struct rv_inst_t *ir) {
   return true;
 }
 
+#if RISCV_VM_SUPPORT_RV32A
+static bool op_amo(uint32_t inst, struct rv_inst_t *ir) {
+
+  const uint32_t rd     = dec_rd(inst);
+  const uint32_t rs1    = dec_rs1(inst);
+  const uint32_t rs2    = dec_rs2(inst);
+  const uint32_t funct5 = (dec_funct7(inst) >> 2) & 0x1f;
+
+  ir->rd  = rd;
+  ir->rs1 = rs1;
+  ir->rs2 = rs2;
+
+  switch (funct5) {
+  case 0b00010:  // LR.W
+    ir->opcode = rv_inst_lrw;
+    break;
+  case 0b00011:  // SC.W
+    ir->opcode = rv_inst_scw;
+    break;
+  case 0b00001:  // AMOSWAP.W
+    ir->opcode = rv_inst_amoswapw;
+    break;
+  case 0b00000:  // AMOADD.W
+    ir->opcode = rv_inst_amoaddw;
+    break;
+  case 0b00100:  // AMOXOR.W
+    ir->opcode = rv_inst_amoxorw;
+    break;
+  case 0b01100:  // AMOAND.W
+    ir->opcode = rv_inst_amoandw;
+    break;
+  case 0b01000:  // AMOOR.W
+    ir->opcode = rv_inst_amoorw;
+    break;
+  case 0b10000:  // AMOMIN.W
+    ir->opcode = rv_inst_amominw;
+    break;
+  case 0b10100:  // AMOMAX.W
+    ir->opcode = rv_inst_amomaxw;
+    break;
+  case 0b11000:  // AMOMINU.W
+    ir->opcode = rv_inst_amominuw;
+    break;
+  case 0b11100:  // AMOMAXU.W
+    ir->opcode = rv_inst_amomaxuw;
+    break;
+  default:
+    return false;
+  }
+
+  return true;
+}
+#else
+#define op_amo NULL
+#endif  // RISCV_VM_SUPPORT_RV32A
+
+#if RISCV_VM_SUPPORT_RVV
+// vector loads and stores, which share load-fp and store-fp
+static bool op_vmem(uint32_t inst, struct rv_inst_t *ir, bool is_load) {
+
+  const uint32_t nf    = inst >> 29;
+  const uint32_t mew   = (inst >> 28) & 1;
+  const uint32_t mop   = (inst >> 26) & 3;
+  const uint32_t lumop = dec_rs2(inst);
+
+  // vs3 of a store is a vector register
+  ir->rd  = is_load ? dec_rd(inst) : rv_reg_zero;
+  ir->rs1 = dec_rs1(inst);
+  ir->rs2 = dec_rs2(inst);
+  ir->imm = 0;
+
+  // segment accesses and elements wider than 32 bits are not supported, nf
+  // only giving the register count of a whole register access
+  const bool whole = mop == 0b00 && lumop == 0b01000;
+  if ((nf && !whole) || mew) {
+    return false;
+  }
+  switch (mop) {
+  case 0b00:  // unit stride, plain, of a mask or of whole registers
+    if (lumop != 0b00000 && lumop != 0b01011 && !whole) {
+      return false;
+    }
+    ir->rs2 = rv_reg_zero;
+    ir->opcode = is_load ? rv_inst_vle : rv_inst_vse;
+    break;
+  case 0b10:  // strided
+    ir->opcode = is_load ? rv_inst_vlse : rv_inst_vsse;
+    break;
+  default:    // indexed, unordered or ordered
+    ir->opcode = is_load ? rv_inst_vlxei : rv_inst_vsxei;
+    break;
+  }
+
+  return true;
+}
+
+static bool op_v(uint32_t inst, struct rv_inst_t *ir) {
+
+  const uint32_t funct3 = dec_funct3(inst);
+
+  ir->rd  = dec_rd(inst);
+  ir->rs1 = dec_rs1(inst);
+  ir->rs2 = dec_rs2(inst);
+  ir->imm = 0;
+
+  if (funct3 != 0b111) {
+    // arithmetic, the rest of which is decoded as it runs
+    ir->opcode = (uint8_t)(rv_inst_vopivv + funct3);
+    return true;
+  }
+  if (!(inst >> 31)) {
+    ir->opcode = rv_inst_vsetvli;
+  }
+  else if ((inst >> 30) == 0b11) {
+    ir->opcode = rv_inst_vsetivli;
+  }
+  else if ((inst >> 25) == 0b1000000) {
+    ir->opcode = rv_inst_vsetvl;
+  }
+  else {
+    return false;
+  }
+
+  return true;
+}
+#else
+#define op_v NULL
+#endif  // RISCV_VM_SUPPORT_RVV
+
 #if RISCV_VM_SUPPORT_RV32F
 static bool op_load_fp(uint32_t inst, struct rv_inst_t *ir) {
 
@@ -383,7 +704,25 @@ static bool op_load_fp(uint32_t inst, struct rv_inst_t *ir) {
   ir->rs1 = rs1;
   ir->imm = imm;
 
-  ir->opcode = rv_inst_flw;
+  // dispatch by width
+  switch (dec_funct3(inst)) {
+  case 0b010:  // FLW
+    ir->opcode = rv_inst_flw;
+    break;
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b011:  // FLD
+    ir->opcode = rv_inst_fld;
+    break;
+#endif
+#if RISCV_VM_SUPPORT_RVV
+  case 0b000:  // VLE8 and friends
+  case 0b101:  // VLE16
+  case 0b110:  // VLE32
+    return op_vmem(inst, ir, true);
+#endif
+  default:
+    return false;
+  }
 
   return true;
 }
@@ -399,7 +738,25 @@ static bool op_store_fp(uint32_t inst, struct rv_inst_t *ir) {
   ir->rs2 = rs2;
   ir->imm = imm;
 
-  ir->opcode = rv_inst_fsw;
+  // dispatch by width
+  switch (dec_funct3(inst)) {
+  case 0b010:  // FSW
+    ir->opcode = rv_inst_fsw;
+    break;
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b011:  // FSD
+    ir->opcode = rv_inst_fsd;
+    break;
+#endif
+#if RISCV_VM_SUPPORT_RVV
+  case 0b000:  // VSE8 and friends
+  case 0b101:  // VSE16
+  case 0b110:  // VSE32
+    return op_vmem(inst, ir, false);
+#endif
+  default:
+    return false;
+  }
 
   return true;
 }
@@ -415,6 +772,8 @@ static bool op_fp(uint32_t inst, struct rv_inst_t *ir) {
   ir->rd  = rd;
   ir->rs1 = rs1;
   ir->rs2 = rs2;
+  ir->imm = 0;
+  ir->rm  = rm;
 
   // dispatch based on func7 (low 2 bits are width)
   switch (funct7) {
@@ -514,6 +873,107 @@ static bool op_fp(uint32_t inst, struct rv_inst_t *ir) {
       return false;
     }
     break;
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b0000001:  // FADD.D
+    ir->opcode = rv_inst_faddd;
+    break;
+  case 0b0000101:  // FSUB.D
+    ir->opcode = rv_inst_fsubd;
+    break;
+  case 0b0001001:  // FMUL.D
+    ir->opcode = rv_inst_fmuld;
+    break;
+  case 0b0001101:  // FDIV.D
+    ir->opcode = rv_inst_fdivd;
+    break;
+  case 0b0101101:  // FSQRT.D
+    ir->opcode = rv_inst_fsqrtd;
+    break;
+  case 0b0010001: // FSGNJ.D, FSGNJN.D, FSGNJX.D
+    switch (rm) {
+    case 0b000:  // FSGNJ.D
+      ir->opcode = rv_inst_fsgnjd;
+      break;
+    case 0b001:  // FSGNJN.D
+      ir->opcode = rv_inst_fsgnjnd;
+      break;
+    case 0b010:  // FSGNJX.D
+      ir->opcode = rv_inst_fsgnjxd;
+      break;
+    default:
+      return false;
+    }
+    break;
+  case 0b0010101: // FMIN.D, FMAX.D
+    switch (rm) {
+    case 0b000:  // FMIN.D
+      ir->opcode = rv_inst_fmind;
+      break;
+    case 0b001:  // FMAX.D
+      ir->opcode = rv_inst_fmaxd;
+      break;
+    default:
+      return false;
+    }
+    break;
+  case 0b0100000:  // FCVT.S.D
+    if (rs2 != 0b00001) {
+      return false;
+    }
+    ir->opcode = rv_inst_fcvtsd;
+    break;
+  case 0b0100001:  // FCVT.D.S
+    if (rs2 != 0b00000) {
+      return false;
+    }
+    ir->opcode = rv_inst_fcvtds;
+    break;
+  case 0b1010001: // FEQ.D, FLT.D, FLE.D
+    switch (rm) {
+    case 0b010:  // FEQ.D
+      ir->opcode = rv_inst_feqd;
+      break;
+    case 0b001:  // FLT.D
+      ir->opcode = rv_inst_fltd;
+      break;
+    case 0b000:  // FLE.D
+      ir->opcode = rv_inst_fled;
+      break;
+    default:
+      return false;
+    }
+    break;
+  case 0b1110001:  // FCLASS.D
+    if (rm != 0b001 || rs2 != 0b00000) {
+      return false;
+    }
+    ir->opcode = rv_inst_fclassd;
+    break;
+  case 0b1100001:
+    switch (rs2) {
+    case 0b00000:  // FCVT.W.D
+      ir->opcode = rv_inst_fcvtwd;
+      break;
+    case 0b00001:  // FCVT.WU.D
+      ir->opcode = rv_inst_fcvtwud;
+      break;
+    default:
+      return false;
+    }
+    break;
+  case 0b1101001:
+    switch (rs2) {
+    case 0b00000:  // FCVT.D.W
+      ir->opcode = rv_inst_fcvtdw;
+      break;
+    case 0b00001:  // FCVT.D.WU
+      ir->opcode = rv_inst_fcvtdwu;
+      break;
+    default:
+      return false;
+    }
+    break;
+#endif  // RISCV_VM_SUPPORT_RV32D
   default:
     return false;
   }
@@ -524,18 +984,30 @@ static bool op_fp(uint32_t inst, struct rv_inst_t *ir) {
 static bool op_madd(uint32_t inst, struct rv_inst_t *ir) {
 
   const uint32_t rd  = dec_rd(inst);
-  const uint32_t rm  = dec_funct3(inst);      // todo
+  const uint32_t rm  = dec_funct3(inst);
   const uint32_t rs1 = dec_rs1(inst);
   const uint32_t rs2 = dec_rs2(inst);
-  const uint32_t fmt = dec_r4type_fmt(inst);  // unused
+  const uint32_t fmt = dec_r4type_fmt(inst);
   const uint32_t rs3 = dec_r4type_rs3(inst);
 
   ir->rd  = rd;
   ir->rs1 = rs1;
   ir->rs2 = rs2;
   ir->rs3 = rs3;
+  ir->rm  = rm;
 
-  ir->opcode = rv_inst_fmadds;
+  switch (fmt) {
+  case 0b00:
+    ir->opcode = rv_inst_fmadds;
+    break;
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b01:
+    ir->opcode = rv_inst_fmaddd;
+    break;
+#endif
+  default:
+    return false;
+  }
 
   return true;
 }
@@ -543,18 +1015,30 @@ static bool op_madd(uint32_t inst, struct rv_inst_t *ir) {
 static bool op_msub(uint32_t inst, struct rv_inst_t *ir) {
 
   const uint32_t rd  = dec_rd(inst);
-  const uint32_t rm  = dec_funct3(inst);      // todo
+  const uint32_t rm  = dec_funct3(inst);
   const uint32_t rs1 = dec_rs1(inst);
   const uint32_t rs2 = dec_rs2(inst);
-  const uint32_t fmt = dec_r4type_fmt(inst);  // unused
+  const uint32_t fmt = dec_r4type_fmt(inst);
   const uint32_t rs3 = dec_r4type_rs3(inst);
 
   ir->rd  = rd;
   ir->rs1 = rs1;
   ir->rs2 = rs2;
   ir->rs3 = rs3;
+  ir->rm  = rm;
 
-  ir->opcode = rv_inst_fmsubs;
+  switch (fmt) {
+  case 0b00:
+    ir->opcode = rv_inst_fmsubs;
+    break;
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b01:
+    ir->opcode = rv_inst_fmsubd;
+    break;
+#endif
+  default:
+    return false;
+  }
 
   return true;
 }
@@ -562,18 +1046,30 @@ static bool op_msub(uint32_t inst, struct rv_inst_t *ir) {
 static bool op_nmadd(uint32_t inst, struct rv_inst_t *ir) {
 
   const uint32_t rd  = dec_rd(inst);
-  const uint32_t rm  = dec_funct3(inst);      // todo
+  const uint32_t rm  = dec_funct3(inst);
   const uint32_t rs1 = dec_rs1(inst);
   const uint32_t rs2 = dec_rs2(inst);
-  const uint32_t fmt = dec_r4type_fmt(inst);  // unused
+  const uint32_t fmt = dec_r4type_fmt(inst);
   const uint32_t rs3 = dec_r4type_rs3(inst);
 
   ir->rd  = rd;
   ir->rs1 = rs1;
   ir->rs2 = rs2;
   ir->rs3 = rs3;
+  ir->rm  = rm;
 
-  ir->opcode = rv_inst_fnmadds;
+  switch (fmt) {
+  case 0b00:
+    ir->opcode = rv_inst_fnmadds;
+    break;
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b01:
+    ir->opcode = rv_inst_fnmaddd;
+    break;
+#endif
+  default:
+    return false;
+  }
 
   return true;
 }
@@ -581,18 +1077,30 @@ static bool op_nmadd(uint32_t inst, struct rv_inst_t *ir) {
 static bool op_nmsub(uint32_t inst, struct rv_inst_t *ir) {
 
   const uint32_t rd  = dec_rd(inst);
-  const uint32_t rm  = dec_funct3(inst);      // todo
+  const uint32_t rm  = dec_funct3(inst);
   const uint32_t rs1 = dec_rs1(inst);
   const uint32_t rs2 = dec_rs2(inst);
-  const uint32_t fmt = dec_r4type_fmt(inst);  // unused
+  const uint32_t fmt = dec_r4type_fmt(inst);
   const uint32_t rs3 = dec_r4type_rs3(inst);
 
   ir->rd  = rd;
   ir->rs1 = rs1;
   ir->rs2 = rs2;
   ir->rs3 = rs3;
+  ir->rm  = rm;
 
-  ir->opcode = rv_inst_fnmsubs;
+  switch (fmt) {
+  case 0b00:
+    ir->opcode = rv_inst_fnmsubs;
+    break;
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b01:
+    ir->opcode = rv_inst_fnmsubd;
+    break;
+#endif
+  default:
+    return false;
+  }
 
   return true;
 }
@@ -612,33 +1120,554 @@ typedef bool(*opcode_t)(uint32_t inst, struct rv_inst_t *ir);
 // opcode dispatch table
 static const opcode_t opcodes[] = {
   //  000        001          010       011          100        101       110   111
-      op_load,   op_load_fp,  NULL,     NULL,        op_op_imm, op_auipc, NULL, NULL, // 00
-      op_store,  op_store_fp, NULL,     NULL,        op_op,     op_lui,   NULL, NULL, // 01
-      op_madd,   op_msub,     op_nmsub, op_nmadd,    op_fp,     NULL,     NULL, NULL, // 10
+      op_load,   op_load_fp,  NULL,     op_misc_mem, op_op_imm, op_auipc, NULL, NULL, // 00
+      op_store,  op_store_fp, NULL,     op_amo,      op_op,     op_lui,   NULL, NULL, // 01
+      op_madd,   op_msub,     op_nmsub, op_nmadd,    op_fp,     op_v,     NULL, NULL, // 10
       op_branch, op_jalr,     NULL,     op_jal,      op_system, NULL,     NULL, NULL, // 11
 };
 
-bool decode(uint32_t inst, struct rv_inst_t *out, uint32_t *pc) {
+#if RISCV_VM_SUPPORT_RVC
+// major opcodes of the instructions compressed ones expand to
+enum {
+  OPC_LOAD     = 0b0000011,
+  OPC_LOAD_FP  = 0b0000111,
+  OPC_OP_IMM   = 0b0010011,
+  OPC_STORE    = 0b0100011,
+  OPC_STORE_FP = 0b0100111,
+  OPC_OP       = 0b0110011,
+  OPC_LUI      = 0b0110111,
+  OPC_BRANCH   = 0b1100011,
+  OPC_JALR     = 0b1100111,
+  OPC_JAL      = 0b1101111,
+};
 
-  // standard uncompressed
-  if ((inst & 3) == 3) {
-    const uint32_t index = (inst & INST_6_2) >> 2;
-    // find translation function
-    const opcode_t op = opcodes[index];
-    if (!op) {
-      return false;
+// bits hi to lo of a compressed instruction
+static uint32_t c_bits(uint32_t inst, uint32_t hi, uint32_t lo) {
+  return (inst >> lo) & ((1u << (hi - lo + 1)) - 1);
+}
+
+// sign extend the low bits of a value
+static int32_t c_sext(uint32_t value, uint32_t bits) {
+  return ((int32_t)(value << (32 - bits))) >> (32 - bits);
+}
+
+static uint32_t enc_rtype(uint32_t opcode, uint32_t rd, uint32_t funct3, uint32_t rs1, uint32_t rs2,
+                          uint32_t funct7) {
+  return opcode | (rd << 7) | (funct3 << 12) | (rs1 << 15) | (rs2 << 20) | (funct7 << 25);
+}
+
+static uint32_t enc_itype(uint32_t opcode, uint32_t rd, uint32_t funct3, uint32_t rs1, int32_t imm) {
+  return opcode | (rd << 7) | (funct3 << 12) | (rs1 << 15) | ((uint32_t)imm << 20);
+}
+
+static uint32_t enc_stype(uint32_t opcode, uint32_t funct3, uint32_t rs1, uint32_t rs2, int32_t imm) {
+  const uint32_t u = (uint32_t)imm;
+  return opcode | ((u & 0x1f) << 7) | (funct3 << 12) | (rs1 << 15) | (rs2 << 20) | ((u >> 5) << 25);
+}
+
+static uint32_t enc_btype(uint32_t funct3, uint32_t rs1, uint32_t rs2, int32_t imm) {
+  const uint32_t u = (uint32_t)imm;
+  return OPC_BRANCH | (((u >> 11) & 1) << 7) | (((u >> 1) & 0xf) << 8) | (funct3 << 12) | (rs1 << 15) |
+         (rs2 << 20) | (((u >> 5) & 0x3f) << 25) | (((u >> 12) & 1) << 31);
+}
+
+static uint32_t enc_jtype(uint32_t rd, int32_t imm) {
+  const uint32_t u = (uint32_t)imm;
+  return OPC_JAL | (rd << 7) | (u & 0xff000) | (((u >> 11) & 1) << 20) | (((u >> 1) & 0x3ff) << 21) |
+         (((u >> 20) & 1) << 31);
+}
+
+// quadrant 0, register based loads and stores
+static uint32_t rvc_expand_q0(uint32_t inst) {
+  const uint32_t rd  = c_bits(inst, 4, 2) + 8;   // also rs2'
+  const uint32_t rs1 = c_bits(inst, 9, 7) + 8;
+  // offset of c.lw/c.sw and friends
+  const int32_t uimm = (int32_t)((c_bits(inst, 12, 10) << 3) | (c_bits(inst, 6, 6) << 2) |
+                                 (c_bits(inst, 5, 5) << 6));
+#if RISCV_VM_SUPPORT_RV32D
+  // offset of c.fld/c.fsd
+  const int32_t dimm = (int32_t)((c_bits(inst, 12, 10) << 3) | (c_bits(inst, 6, 5) << 6));
+#endif
+  switch (c_bits(inst, 15, 13)) {
+  case 0b000:  // C.ADDI4SPN
+  {
+    const int32_t nzuimm = (int32_t)((c_bits(inst, 12, 11) << 4) | (c_bits(inst, 10, 7) << 6) |
+                                     (c_bits(inst, 6, 6) << 2) | (c_bits(inst, 5, 5) << 3));
+    return nzuimm ? enc_itype(OPC_OP_IMM, rd, 0, rv_reg_sp, nzuimm) : 0;
+  }
+  case 0b010:  // C.LW
+    return enc_itype(OPC_LOAD, rd, 2, rs1, uimm);
+  case 0b110:  // C.SW
+    return enc_stype(OPC_STORE, 2, rs1, rd, uimm);
+#if RISCV_VM_SUPPORT_RV32F
+  case 0b011:  // C.FLW
+    return enc_itype(OPC_LOAD_FP, rd, 2, rs1, uimm);
+  case 0b111:  // C.FSW
+    return enc_stype(OPC_STORE_FP, 2, rs1, rd, uimm);
+#endif
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b001:  // C.FLD
+    return enc_itype(OPC_LOAD_FP, rd, 3, rs1, dimm);
+  case 0b101:  // C.FSD
+    return enc_stype(OPC_STORE_FP, 3, rs1, rd, dimm);
+#endif
+  default:
+    return 0;
+  }
+}
+
+// quadrant 1, immediates, alu operations and control transfers
+static uint32_t rvc_expand_q1(uint32_t inst) {
+  const uint32_t rd  = c_bits(inst, 11, 7);
+  const uint32_t rdp = c_bits(inst, 9, 7) + 8;
+  const uint32_t rs2p = c_bits(inst, 4, 2) + 8;
+  const int32_t imm = c_sext((c_bits(inst, 12, 12) << 5) | c_bits(inst, 6, 2), 6);
+  // offset of c.jal/c.j
+  const int32_t jimm = c_sext((c_bits(inst, 12, 12) << 11) | (c_bits(inst, 11, 11) << 4) |
+                              (c_bits(inst, 10, 9) << 8) | (c_bits(inst, 8, 8) << 10) |
+                              (c_bits(inst, 7, 7) << 6) | (c_bits(inst, 6, 6) << 7) |
+                              (c_bits(inst, 5, 3) << 1) | (c_bits(inst, 2, 2) << 5), 12);
+  // offset of c.beqz/c.bnez
+  const int32_t bimm = c_sext((c_bits(inst, 12, 12) << 8) | (c_bits(inst, 11, 10) << 3) |
+                              (c_bits(inst, 6, 5) << 6) | (c_bits(inst, 4, 3) << 1) |
+                              (c_bits(inst, 2, 2) << 5), 9);
+  switch (c_bits(inst, 15, 13)) {
+  case 0b000:  // C.ADDI (C.NOP)
+    return enc_itype(OPC_OP_IMM, rd, 0, rd, imm);
+  case 0b001:  // C.JAL
+    return enc_jtype(rv_reg_ra, jimm);
+  case 0b010:  // C.LI
+    return enc_itype(OPC_OP_IMM, rd, 0, rv_reg_zero, imm);
+  case 0b011:
+    if (rd == rv_reg_sp) {
+      // C.ADDI16SP
+      const int32_t nzimm = c_sext((c_bits(inst, 12, 12) << 9) | (c_bits(inst, 6, 6) << 4) |
+                                   (c_bits(inst, 5, 5) << 6) | (c_bits(inst, 4, 3) << 7) |
+                                   (c_bits(inst, 2, 2) << 5), 10);
+      return nzimm ? enc_itype(OPC_OP_IMM, rv_reg_sp, 0, rv_reg_sp, nzimm) : 0;
     }
-    if (!op(inst, out)) {
-      return false;
+    // C.LUI
+    return imm ? (OPC_LUI | (rd << 7) | ((uint32_t)imm << 12)) : 0;
+  case 0b100:
+    switch (c_bits(inst, 11, 10)) {
+    case 0b00:  // C.SRLI
+      // shamt[5] must be clear for RV32
+      return c_bits(inst, 12, 12) ? 0 : enc_itype(OPC_OP_IMM, rdp, 5, rdp, imm);
+    case 0b01:  // C.SRAI
+      return c_bits(inst, 12, 12) ? 0 : enc_itype(OPC_OP_IMM, rdp, 5, rdp, imm | 0x400);
+    case 0b10:  // C.ANDI
+      return enc_itype(OPC_OP_IMM, rdp, 7, rdp, imm);
+    default:
+      if (c_bits(inst, 12, 12)) {
+        // c.subw/c.addw are RV64 only
+        return 0;
+      }
+      switch (c_bits(inst, 6, 5)) {
+      case 0b00: return enc_rtype(OPC_OP, rdp, 0, rdp, rs2p, 0b0100000);  // C.SUB
+      case 0b01: return enc_rtype(OPC_OP, rdp, 4, rdp, rs2p, 0);          // C.XOR
+      case 0b10: return enc_rtype(OPC_OP, rdp, 6, rdp, rs2p, 0);          // C.OR
+      default:   return enc_rtype(OPC_OP, rdp, 7, rdp, rs2p, 0);          // C.AND
+      }
     }
-    *pc += 4;
+  case 0b101:  // C.J
+    return enc_jtype(rv_reg_zero, jimm);
+  case 0b110:  // C.BEQZ
+    return enc_btype(0, rdp, rv_reg_zero, bimm);
+  default:     // C.BNEZ
+    return enc_btype(1, rdp, rv_reg_zero, bimm);
   }
-  else {
-    // compressed instruction
-    // TODO
-    assert(!"Unreachable");
+}
+
+// quadrant 2, stack pointer loads and stores, moves and register jumps
+static uint32_t rvc_expand_q2(uint32_t inst) {
+  const uint32_t rd  = c_bits(inst, 11, 7);   // also rs1
+  const uint32_t rs2 = c_bits(inst, 6, 2);
+  // offsets of c.lwsp and c.swsp
+  const int32_t limm = (int32_t)((c_bits(inst, 12, 12) << 5) | (c_bits(inst, 6, 4) << 2) |
+                                 (c_bits(inst, 3, 2) << 6));
+  const int32_t simm = (int32_t)((c_bits(inst, 12, 9) << 2) | (c_bits(inst, 8, 7) << 6));
+#if RISCV_VM_SUPPORT_RV32D
+  // offsets of c.fldsp and c.fsdsp
+  const int32_t ldimm = (int32_t)((c_bits(inst, 12, 12) << 5) | (c_bits(inst, 6, 5) << 3) |
+                                  (c_bits(inst, 4, 2) << 6));
+  const int32_t sdimm = (int32_t)((c_bits(inst, 12, 10) << 3) | (c_bits(inst, 9, 7) << 6));
+#endif
+  switch (c_bits(inst, 15, 13)) {
+  case 0b000:  // C.SLLI
+    return c_bits(inst, 12, 12) ? 0 : enc_itype(OPC_OP_IMM, rd, 1, rd, (int32_t)rs2);
+  case 0b010:  // C.LWSP
+    return rd ? enc_itype(OPC_LOAD, rd, 2, rv_reg_sp, limm) : 0;
+  case 0b100:
+    if (!c_bits(inst, 12, 12)) {
+      if (rs2 == rv_reg_zero) {
+        // C.JR
+        return rd ? enc_itype(OPC_JALR, rv_reg_zero, 0, rd, 0) : 0;
+      }
+      // C.MV
+      return enc_rtype(OPC_OP, rd, 0, rv_reg_zero, rs2, 0);
+    }
+    if (rs2 == rv_reg_zero) {
+      // C.EBREAK or C.JALR
+      return rd ? enc_itype(OPC_JALR, rv_reg_ra, 0, rd, 0) : 0x00100073;
+    }
+    // C.ADD
+    return enc_rtype(OPC_OP, rd, 0, rd, rs2, 0);
+  case 0b110:  // C.SWSP
+    return enc_stype(OPC_STORE, 2, rv_reg_sp, rs2, simm);
+#if RISCV_VM_SUPPORT_RV32F
+  case 0b011:  // C.FLWSP
+    return enc_itype(OPC_LOAD_FP, rd, 2, rv_reg_sp, limm);
+  case 0b111:  // C.FSWSP
+    return enc_stype(OPC_STORE_FP, 2, rv_reg_sp, rs2, simm);
+#endif
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b001:  // C.FLDSP
+    return enc_itype(OPC_LOAD_FP, rd, 3, rv_reg_sp, ldimm);
+  case 0b101:  // C.FSDSP
+    return enc_stype(OPC_STORE_FP, 3, rv_reg_sp, rs2, sdimm);
+#endif
+  default:
+    return 0;
+  }
+}
+#endif  // RISCV_VM_SUPPORT_RVC
+
+uint32_t rvc_expand(uint32_t inst) {
+#if RISCV_VM_SUPPORT_RVC
+  uint32_t out;
+  switch (inst & 3) {
+  case 0:  out = rvc_expand_q0(inst); break;
+  case 1:  out = rvc_expand_q1(inst); break;
+  default: out = rvc_expand_q2(inst); break;
+  }
+  // clear the low bits to mark the expansion as compressed
+  return out & ~3u;
+#else
+  (void)inst;
+  return 0;
+#endif
+}
+
+bool decode(uint32_t inst, struct rv_inst_t *out, uint32_t *pc) {
+  // illegal compressed instructions expand to 0
+  if (!inst) {
+    return false;
   }
+  const uint32_t index = (inst & INST_6_2) >> 2;
+  // find translation function
+  const opcode_t op = opcodes[index];
+  if (!op) {
+    return false;
+  }
+  if (!op(inst, out)) {
+    return false;
+  }
+  *pc += inst_length(inst);
 
   // success
   return true;
 }
+
+// integer registers read and written by an instruction
+// note: uses may be over approximated but defs are never over approximated.
+//       instructions handled by a host function list no defs.
+void inst_regs(const struct rv_inst_t *i, uint32_t *use, uint32_t *def) {
+  const uint32_t rd  = 1u << i->rd;
+  const uint32_t rs1 = 1u << i->rs1;
+  const uint32_t rs2 = 1u << i->rs2;
+  *use = 0;
+  *def = 0;
+  switch (i->opcode) {
+  case rv_inst_lui:
+  case rv_inst_auipc:
+  case rv_inst_jal:
+    *def = rd;
+    break;
+  case rv_inst_jalr:
+  case rv_inst_lb:
+  case rv_inst_lh:
+  case rv_inst_lw:
+  case rv_inst_lbu:
+  case rv_inst_lhu:
+  case rv_inst_addi:
+  case rv_inst_slti:
+  case rv_inst_sltiu:
+  case rv_inst_xori:
+  case rv_inst_ori:
+  case rv_inst_andi:
+  case rv_inst_slli:
+  case rv_inst_srli:
+  case rv_inst_srai:
+  case rv_inst_clz:
+  case rv_inst_ctz:
+  case rv_inst_cpop:
+  case rv_inst_sextb:
+  case rv_inst_sexth:
+  case rv_inst_zexth:
+  case rv_inst_rori:
+  case rv_inst_orcb:
+  case rv_inst_rev8:
+  case rv_inst_bclri:
+  case rv_inst_bexti:
+  case rv_inst_binvi:
+  case rv_inst_bseti:
+    *use = rs1;
+    *def = rd;
+    break;
+  case rv_inst_add:
+  case rv_inst_sub:
+  case rv_inst_sll:
+  case rv_inst_slt:
+  case rv_inst_sltu:
+  case rv_inst_xor:
+  case rv_inst_srl:
+  case rv_inst_sra:
+  case rv_inst_or:
+  case rv_inst_and:
+  case rv_inst_mul:
+  case rv_inst_mulh:
+  case rv_inst_mulhsu:
+  case rv_inst_mulhu:
+  case rv_inst_div:
+  case rv_inst_divu:
+  case rv_inst_rem:
+  case rv_inst_remu:
+  case rv_inst_sh1add:
+  case rv_inst_sh2add:
+  case rv_inst_sh3add:
+  case rv_inst_andn:
+  case rv_inst_orn:
+  case rv_inst_xnor:
+  case rv_inst_max:
+  case rv_inst_maxu:
+  case rv_inst_min:
+  case rv_inst_minu:
+  case rv_inst_rol:
+  case rv_inst_ror:
+  case rv_inst_bclr:
+  case rv_inst_bext:
+  case rv_inst_binv:
+  case rv_inst_bset:
+    *use = rs1 | rs2;
+    *def = rd;
+    break;
+  case rv_inst_beq:
+  case rv_inst_bne:
+  case rv_inst_blt:
+  case rv_inst_bge:
+  case rv_inst_bltu:
+  case rv_inst_bgeu:
+  case rv_inst_sb:
+  case rv_inst_sh:
+  case rv_inst_sw:
+    *use = rs1 | rs2;
+    break;
+  case rv_inst_flw:
+  case rv_inst_fsw:
+  case rv_inst_fcvtsw:
+  case rv_inst_fcvtswu:
+  case rv_inst_fmvwx:
+  case rv_inst_fld:
+  case rv_inst_fsd:
+  case rv_inst_fcvtdw:
+  case rv_inst_fcvtdwu:
+    *use = rs1;
+    break;
+  case rv_inst_fmvxw:
+  case rv_inst_fcvtws:
+  case rv_inst_fcvtwus:
+  case rv_inst_feqs:
+  case rv_inst_flts:
+  case rv_inst_fles:
+  case rv_inst_fclasss:
+  case rv_inst_fcvtwd:
+  case rv_inst_fcvtwud:
+  case rv_inst_feqd:
+  case rv_inst_fltd:
+  case rv_inst_fled:
+  case rv_inst_fclassd:
+    *def = rd;
+    break;
+  case rv_inst_ecall:
+  case rv_inst_ebreak:
+    // the environment may read any register
+    *use = ~0u;
+    break;
+  default:
+    // assume all register operands are read
+    *use = rs1 | rs2;
+    break;
+  }
+  *use &= ~1u;
+  *def &= ~1u;
+}
+
+// name of a decoded opcode, as it appears in its rv_inst_ enum
+const char *inst_name(uint32_t opcode) {
+  static const char *const names[rv_inst_count] = {
+    [rv_inst_lui]      = "lui",
+    [rv_inst_auipc]    = "auipc",
+    [rv_inst_jal]      = "jal",
+    [rv_inst_jalr]     = "jalr",
+    [rv_inst_beq]      = "beq",
+    [rv_inst_bne]      = "bne",
+    [rv_inst_blt]      = "blt",
+    [rv_inst_bge]      = "bge",
+    [rv_inst_bltu]     = "bltu",
+    [rv_inst_bgeu]     = "bgeu",
+    [rv_inst_lb]       = "lb",
+    [rv_inst_lh]       = "lh",
+    [rv_inst_lw]       = "lw",
+    [rv_inst_lbu]      = "lbu",
+    [rv_inst_lhu]      = "lhu",
+    [rv_inst_sb]       = "sb",
+    [rv_inst_sh]       = "sh",
+    [rv_inst_sw]       = "sw",
+    [rv_inst_addi]     = "addi",
+    [rv_inst_slti]     = "slti",
+    [rv_inst_sltiu]    = "sltiu",
+    [rv_inst_xori]     = "xori",
+    [rv_inst_ori]      = "ori",
+    [rv_inst_andi]     = "andi",
+    [rv_inst_slli]     = "slli",
+    [rv_inst_srli]     = "srli",
+    [rv_inst_srai]     = "srai",
+    [rv_inst_add]      = "add",
+    [rv_inst_sub]      = "sub",
+    [rv_inst_sll]      = "sll",
+    [rv_inst_slt]      = "slt",
+    [rv_inst_sltu]     = "sltu",
+    [rv_inst_xor]      = "xor",
+    [rv_inst_srl]      = "srl",
+    [rv_inst_sra]      = "sra",
+    [rv_inst_or]       = "or",
+    [rv_inst_and]      = "and",
+    [rv_inst_fence]    = "fence",
+    [rv_inst_ecall]    = "ecall",
+    [rv_inst_ebreak]   = "ebreak",
+    [rv_inst_mul]      = "mul",
+    [rv_inst_mulh]     = "mulh",
+    [rv_inst_mulhsu]   = "mulhsu",
+    [rv_inst_mulhu]    = "mulhu",
+    [rv_inst_div]      = "div",
+    [rv_inst_divu]     = "divu",
+    [rv_inst_rem]      = "rem",
+    [rv_inst_remu]     = "remu",
+    [rv_inst_flw]      = "flw",
+    [rv_inst_fsw]      = "fsw",
+    [rv_inst_fmadds]   = "fmadds",
+    [rv_inst_fmsubs]   = "fmsubs",
+    [rv_inst_fnmsubs]  = "fnmsubs",
+    [rv_inst_fnmadds]  = "fnmadds",
+    [rv_inst_fadds]    = "fadds",
+    [rv_inst_fsubs]    = "fsubs",
+    [rv_inst_fmuls]    = "fmuls",
+    [rv_inst_fdivs]    = "fdivs",
+    [rv_inst_fsqrts]   = "fsqrts",
+    [rv_inst_fsgnjs]   = "fsgnjs",
+    [rv_inst_fsgnjns]  = "fsgnjns",
+    [rv_inst_fsgnjxs]  = "fsgnjxs",
+    [rv_inst_fmins]    = "fmins",
+    [rv_inst_fmaxs]    = "fmaxs",
+    [rv_inst_fcvtws]   = "fcvtws",
+    [rv_inst_fcvtwus]  = "fcvtwus",
+    [rv_inst_fmvxw]    = "fmvxw",
+    [rv_inst_feqs]     = "feqs",
+    [rv_inst_flts]     = "flts",
+    [rv_inst_fles]     = "fles",
+    [rv_inst_fclasss]  = "fclasss",
+    [rv_inst_fcvtsw]   = "fcvtsw",
+    [rv_inst_fcvtswu]  = "fcvtswu",
+    [rv_inst_fmvwx]    = "fmvwx",
+    [rv_inst_fld]      = "fld",
+    [rv_inst_fsd]      = "fsd",
+    [rv_inst_fmaddd]   = "fmaddd",
+    [rv_inst_fmsubd]   = "fmsubd",
+    [rv_inst_fnmsubd]  = "fnmsubd",
+    [rv_inst_fnmaddd]  = "fnmaddd",
+    [rv_inst_faddd]    = "faddd",
+    [rv_inst_fsubd]    = "fsubd",
+    [rv_inst_fmuld]    = "fmuld",
+    [rv_inst_fdivd]    = "fdivd",
+    [rv_inst_fsqrtd]   = "fsqrtd",
+    [rv_inst_fsgnjd]   = "fsgnjd",
+    [rv_inst_fsgnjnd]  = "fsgnjnd",
+    [rv_inst_fsgnjxd]  = "fsgnjxd",
+    [rv_inst_fmind]    = "fmind",
+    [rv_inst_fmaxd]    = "fmaxd",
+    [rv_inst_fcvtsd]   = "fcvtsd",
+    [rv_inst_fcvtds]   = "fcvtds",
+    [rv_inst_feqd]     = "feqd",
+    [rv_inst_fltd]     = "fltd",
+    [rv_inst_fled]     = "fled",
+    [rv_inst_fclassd]  = "fclassd",
+    [rv_inst_fcvtwd]   = "fcvtwd",
+    [rv_inst_fcvtwud]  = "fcvtwud",
+    [rv_inst_fcvtdw]   = "fcvtdw",
+    [rv_inst_fcvtdwu]  = "fcvtdwu",
+    [rv_inst_csrrw]    = "csrrw",
+    [rv_inst_csrrs]    = "csrrs",
+    [rv_inst_csrrc]    = "csrrc",
+    [rv_inst_csrrwi]   = "csrrwi",
+    [rv_inst_csrrsi]   = "csrrsi",
+    [rv_inst_csrrci]   = "csrrci",
+    [rv_inst_fencei]   = "fencei",
+    [rv_inst_lrw]      = "lrw",
+    [rv_inst_scw]      = "scw",
+    [rv_inst_amoswapw] = "amoswapw",
+    [rv_inst_amoaddw]  = "amoaddw",
+    [rv_inst_amoxorw]  = "amoxorw",
+    [rv_inst_amoandw]  = "amoandw",
+    [rv_inst_amoorw]   = "amoorw",
+    [rv_inst_amominw]  = "amominw",
+    [rv_inst_amomaxw]  = "amomaxw",
+    [rv_inst_amominuw] = "amominuw",
+    [rv_inst_amomaxuw] = "amomaxuw",
+    [rv_inst_sh1add]   = "sh1add",
+    [rv_inst_sh2add]   = "sh2add",
+    [rv_inst_sh3add]   = "sh3add",
+    [rv_inst_andn]     = "andn",
+    [rv_inst_orn]      = "orn",
+    [rv_inst_xnor]     = "xnor",
+    [rv_inst_clz]      = "clz",
+    [rv_inst_ctz]      = "ctz",
+    [rv_inst_cpop]     = "cpop",
+    [rv_inst_max]      = "max",
+    [rv_inst_maxu]     = "maxu",
+    [rv_inst_min]      = "min",
+    [rv_inst_minu]     = "minu",
+    [rv_inst_sextb]    = "sextb",
+    [rv_inst_sexth]    = "sexth",
+    [rv_inst_zexth]    = "zexth",
+    [rv_inst_rol]      = "rol",
+    [rv_inst_ror]      = "ror",
+    [rv_inst_rori]     = "rori",
+    [rv_inst_orcb]     = "orcb",
+    [rv_inst_rev8]     = "rev8",
+    [rv_inst_bclr]     = "bclr",
+    [rv_inst_bclri]    = "bclri",
+    [rv_inst_bext]     = "bext",
+    [rv_inst_bexti]    = "bexti",
+    [rv_inst_binv]     = "binv",
+    [rv_inst_binvi]    = "binvi",
+    [rv_inst_bset]     = "bset",
+    [rv_inst_bseti]    = "bseti",
+    [rv_inst_vsetvli]  = "vsetvli",
+    [rv_inst_vsetivli] = "vsetivli",
+    [rv_inst_vsetvl]   = "vsetvl",
+    [rv_inst_vle]      = "vle",
+    [rv_inst_vlse]     = "vlse",
+    [rv_inst_vlxei]    = "vlxei",
+    [rv_inst_vse]      = "vse",
+    [rv_inst_vsse]     = "vsse",
+    [rv_inst_vsxei]    = "vsxei",
+    [rv_inst_vopivv]   = "vopivv",
+    [rv_inst_vopfvv]   = "vopfvv",
+    [rv_inst_vopmvv]   = "vopmvv",
+    [rv_inst_vopivi]   = "vopivi",
+    [rv_inst_vopivx]   = "vopivx",
+    [rv_inst_vopfvf]   = "vopfvf",
+    [rv_inst_vopmvx]   = "vopmvx",
+  };
+  return (opcode < rv_inst_count && names[opcode]) ? names[opcode] : "unknown";
+}
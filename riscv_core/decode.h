@@ -85,6 +85,34 @@ enum {
   rv_inst_fcvtswu,
   rv_inst_fmvwx,
 
+  // RV32D
+  rv_inst_fld,
+  rv_inst_fsd,
+  rv_inst_fmaddd,
+  rv_inst_fmsubd,
+  rv_inst_fnmsubd,
+  rv_inst_fnmaddd,
+  rv_inst_faddd,
+  rv_inst_fsubd,
+  rv_inst_fmuld,
+  rv_inst_fdivd,
+  rv_inst_fsqrtd,
+  rv_inst_fsgnjd,
+  rv_inst_fsgnjnd,
+  rv_inst_fsgnjxd,
+  rv_inst_fmind,
+  rv_inst_fmaxd,
+  rv_inst_fcvtsd,
+  rv_inst_fcvtds,
+  rv_inst_feqd,
+  rv_inst_fltd,
+  rv_inst_fled,
+  rv_inst_fclassd,
+  rv_inst_fcvtwd,
+  rv_inst_fcvtwud,
+  rv_inst_fcvtdw,
+  rv_inst_fcvtdwu,
+
   // RV32 Zicsr
   rv_inst_csrrw,
   rv_inst_csrrs,
@@ -108,6 +136,63 @@ enum {
   rv_inst_amomaxw,
   rv_inst_amominuw,
   rv_inst_amomaxuw,
+
+  // RV32 Zba
+  rv_inst_sh1add,
+  rv_inst_sh2add,
+  rv_inst_sh3add,
+
+  // RV32 Zbb
+  rv_inst_andn,
+  rv_inst_orn,
+  rv_inst_xnor,
+  rv_inst_clz,
+  rv_inst_ctz,
+  rv_inst_cpop,
+  rv_inst_max,
+  rv_inst_maxu,
+  rv_inst_min,
+  rv_inst_minu,
+  rv_inst_sextb,
+  rv_inst_sexth,
+  rv_inst_zexth,
+  rv_inst_rol,
+  rv_inst_ror,
+  rv_inst_rori,
+  rv_inst_orcb,
+  rv_inst_rev8,
+
+  // RV32 Zbs
+  rv_inst_bclr,
+  rv_inst_bclri,
+  rv_inst_bext,
+  rv_inst_bexti,
+  rv_inst_binv,
+  rv_inst_binvi,
+  rv_inst_bset,
+  rv_inst_bseti,
+
+  // RVV
+  rv_inst_vsetvli,
+  rv_inst_vsetivli,
+  rv_inst_vsetvl,
+  rv_inst_vle,
+  rv_inst_vlse,
+  rv_inst_vlxei,
+  rv_inst_vse,
+  rv_inst_vsse,
+  rv_inst_vsxei,
+  // op-v arithmetic, in the order of the funct3 selecting its operands
+  rv_inst_vopivv,
+  rv_inst_vopfvv,
+  rv_inst_vopmvv,
+  rv_inst_vopivi,
+  rv_inst_vopivx,
+  rv_inst_vopfvf,
+  rv_inst_vopmvx,
+
+  // number of decoded opcodes
+  rv_inst_count,
 };
 
 struct rv_inst_t {
@@ -115,7 +200,11 @@ struct rv_inst_t {
   uint8_t rd, rs1, rs2;
   union {
     int32_t imm;
-    uint8_t rs3;
+    struct {
+      uint8_t rs3;
+      // static rounding mode of float instructions (RM_DYN to use frm)
+      uint8_t rm;
+    };
   };
 };
 
@@ -183,8 +272,26 @@ static bool inst_bypass_zero_store(const struct rv_inst_t *inst) {
   case rv_inst_sb:
   case rv_inst_sh:
   case rv_inst_sw:
+  case rv_inst_fence:
   case rv_inst_ecall:
   case rv_inst_ebreak:
+  case rv_inst_csrrw:
+  case rv_inst_csrrs:
+  case rv_inst_csrrc:
+  case rv_inst_csrrwi:
+  case rv_inst_csrrsi:
+  case rv_inst_csrrci:
+  case rv_inst_lrw:
+  case rv_inst_scw:
+  case rv_inst_amoswapw:
+  case rv_inst_amoaddw:
+  case rv_inst_amoxorw:
+  case rv_inst_amoandw:
+  case rv_inst_amoorw:
+  case rv_inst_amominw:
+  case rv_inst_amomaxw:
+  case rv_inst_amominuw:
+  case rv_inst_amomaxuw:
   case rv_inst_flw:
   case rv_inst_fsw:
   case rv_inst_fmadds:
@@ -211,13 +318,138 @@ static bool inst_bypass_zero_store(const struct rv_inst_t *inst) {
   case rv_inst_fcvtsw:
   case rv_inst_fcvtswu:
   case rv_inst_fmvwx:
+  case rv_inst_fld:
+  case rv_inst_fsd:
+  case rv_inst_fmaddd:
+  case rv_inst_fmsubd:
+  case rv_inst_fnmsubd:
+  case rv_inst_fnmaddd:
+  case rv_inst_faddd:
+  case rv_inst_fsubd:
+  case rv_inst_fmuld:
+  case rv_inst_fdivd:
+  case rv_inst_fsqrtd:
+  case rv_inst_fsgnjd:
+  case rv_inst_fsgnjnd:
+  case rv_inst_fsgnjxd:
+  case rv_inst_fmind:
+  case rv_inst_fmaxd:
+  case rv_inst_fcvtsd:
+  case rv_inst_fcvtds:
+  case rv_inst_feqd:
+  case rv_inst_fltd:
+  case rv_inst_fled:
+  case rv_inst_fclassd:
+  case rv_inst_fcvtwd:
+  case rv_inst_fcvtwud:
+  case rv_inst_fcvtdw:
+  case rv_inst_fcvtdwu:
+  case rv_inst_vsetvli:
+  case rv_inst_vsetivli:
+  case rv_inst_vsetvl:
+  case rv_inst_vle:
+  case rv_inst_vlse:
+  case rv_inst_vlxei:
+  case rv_inst_vse:
+  case rv_inst_vsse:
+  case rv_inst_vsxei:
+  case rv_inst_vopivv:
+  case rv_inst_vopfvv:
+  case rv_inst_vopmvv:
+  case rv_inst_vopivi:
+  case rv_inst_vopivx:
+  case rv_inst_vopfvf:
+  case rv_inst_vopmvx:
     return true;
   }
   return false;
 }
 
+// expand a compressed instruction into the 32 bit instruction it stands for,
+// or 0 if it is illegal.  the low two bits of the expansion are left clear so
+// the length of the original is still known.
+uint32_t rvc_expand(uint32_t inst);
+
+// an instruction as fetched, expanded if it is compressed
+static inline uint32_t inst_expand(uint32_t inst) {
+  return ((inst & 3) == 3) ? inst : rvc_expand(inst & 0xffff);
+}
+
+// length in bytes of an instruction as expanded by inst_expand
+static inline uint32_t inst_length(uint32_t inst) {
+  return ((inst & 3) == 3) ? 4 : 2;
+}
+
+// decode an instruction expanded by inst_expand, stepping pc over it
 bool decode(uint32_t inst, struct rv_inst_t *out, uint32_t *pc);
+void inst_regs(const struct rv_inst_t *ir, uint32_t *use, uint32_t *def);
+const char *inst_name(uint32_t opcode);
+
+// maximum number of instructions translated into one block
+#define BLOCK_MAX_INSTS 256
+
+// a decoded instruction awaiting translation
+struct block_inst_t {
+  struct rv_inst_t ir;
+  // guest address and encoding of the instruction
+  uint32_t pc;
+  uint32_t inst;
+  // instructions of the block (or trace) run before this one
+  uint32_t retired;
+};
 
-bool codegen(const struct rv_inst_t *ir, struct cg_state_t *cg, uint32_t pc, uint32_t inst);
+// guest registers held in host registers across a block
+struct block_regs_t {
+  // host register holding each guest register (-1 if held in memory)
+  int8_t host[RV_NUM_REGS];
+  // cached registers read on entry to the block
+  uint32_t live_in;
+  // registers read after the current instruction before being written
+  uint32_t live;
+  // cached registers modified since they were last written back
+  uint32_t dirty;
+  // instructions run before the current one not yet taken from the budget
+  uint32_t retired;
+  // rounding mode the host fpu is set to (RM_DYN when it follows frm)
+  uint32_t rm;
+  // guest register the host flags were set from by the last instruction (0 if
+  // none) and the condition under which it is non zero.  cg_cc_ne means the
+  // flags follow its value, so the sign flag is its sign.
+  uint8_t flags_reg;
+  uint8_t flags_cc;
+  // condition under which the branch ending the block is taken
+  uint8_t branch_cc;
+  // branches which used the flags of the instruction setting their operand
+  uint32_t fused;
+};
+
+bool codegen(const struct rv_inst_t *ir, struct cg_state_t *cg, uint32_t pc, uint32_t inst,
+             const struct riscv_jit_t *jit, struct block_regs_t *regs);
+uint32_t optimize(struct block_inst_t *insts, uint32_t count, struct opt_stats_t *stats);
+
+void codegen_regalloc(struct block_regs_t *regs, const struct block_inst_t *insts, uint32_t count,
+                      uint32_t *live, uint32_t live_out);
+void codegen_fill(struct cg_state_t *cg, const struct block_regs_t *regs);
+void codegen_spill(struct cg_state_t *cg, struct block_regs_t *regs);
+// return the host fpu to the rounding mode set from frm before leaving a
+// block, as instructions with a static rounding mode may have changed it
+void codegen_dyn_round(struct cg_state_t *cg, struct block_regs_t *regs);
 void codegen_prologue(struct cg_state_t *cg);
 void codegen_epilogue(struct cg_state_t *cg);
+void codegen_cycles(struct cg_state_t *cg, uint32_t instructions);
+void codegen_exits(struct cg_state_t *cg, struct block_t *block, const struct block_regs_t *regs,
+                   const struct rv_inst_t *ir, uint32_t pc);
+
+// emit the guard after the branch ending a block of a trace, returning the
+// jump to patch with a side exit if it leaves the recorded path to next_pc
+// (else NULL).  exit_pc is set to where the side exit goes, odd if it can only
+// be found at runtime.
+uint8_t *codegen_trace_guard(struct cg_state_t *cg, const struct block_regs_t *regs, const struct rv_inst_t *ir,
+                             uint32_t pc, uint32_t pc_end, uint32_t next_pc, uint32_t *exit_pc);
+// emit the back edge of a trace which loops to its head
+void codegen_trace_loop(struct cg_state_t *cg, struct block_t *block, struct block_regs_t *regs,
+                        const uint8_t *loop_top, uint32_t site_pc, uint8_t **ret);
+// emit a side exit leaving a trace at a guard for pc, with the registers
+// cached at the guard and the instructions run up to it
+void codegen_side_exit(struct cg_state_t *cg, struct block_exit_t *exit, const struct block_regs_t *regs,
+                       uint32_t site_pc, uint32_t pc, uint32_t instructions, uint8_t **ret);
@@ -0,0 +1,10 @@
+// pairs of instructions fused into superinstructions when decoding a
+// block, most frequent first.
+// note: generated by tools/fusion_profile from the static pair counts of
+//       tests/*.elf, the operand rules are fuse_rule in interp.h.
+//
+//   first            second           superinstruction          pairs
+  { rv_inst_auipc,   rv_inst_addi,    rv_fuse_la            },  // 16742
+  { rv_inst_slli,    rv_inst_add,     rv_fuse_index         },  // 3142
+  { rv_inst_lui,     rv_inst_addi,    rv_fuse_li            },  // 2173
+  { rv_inst_sltiu,   rv_inst_bne,     rv_fuse_sltiu_branch  },  // 3
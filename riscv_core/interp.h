@@ -0,0 +1,146 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "decode.h"
+
+struct interp_inst_t;
+
+// superinstructions fused from a pair of decoded instructions, each taking the
+// place of the first while the second is kept in the block but skipped over
+enum {
+  rv_fuse_li = rv_inst_count,  // lui rd, hi + addi rd, rd, lo
+  rv_fuse_la,                  // auipc rd, hi + addi rd, rd, lo
+  rv_fuse_call,                // auipc rt, hi + jalr rd, lo(rt)
+  rv_fuse_index,               // slli rt, rs, sh + add rd, rt, rb
+  rv_fuse_slt_branch,          // slt rt, rs1, rs2 + beqz/bnez rt
+  rv_fuse_sltu_branch,         // sltu rt, rs1, rs2 + beqz/bnez rt
+  rv_fuse_slti_branch,         // slti rt, rs1, imm + beqz/bnez rt
+  rv_fuse_sltiu_branch,        // sltiu rt, rs1, imm + beqz/bnez rt
+
+  // one past the last superinstruction
+  rv_fuse_end,
+};
+
+// number of superinstructions
+#define RV_NUM_FUSED (rv_fuse_end - rv_fuse_li)
+
+// a pair of decoded opcodes to fuse (see fusion.h)
+struct fusion_t {
+  uint8_t first;
+  uint8_t second;
+  uint8_t fused;
+};
+
+// the superinstruction a pair of instructions fits the operands of (or 0)
+// note: the first instruction's result must still be written as a later
+//       instruction may read it.
+static inline uint32_t fuse_rule(const struct rv_inst_t *a, const struct rv_inst_t *b) {
+  // the pair must communicate through a register
+  if (a->rd == 0) {
+    return 0;
+  }
+  const bool b_reads_a = b->rs1 == a->rd;
+  switch (a->opcode) {
+  case rv_inst_lui:
+    if (b->opcode == rv_inst_addi && b->rd == a->rd && b_reads_a) {
+      return rv_fuse_li;
+    }
+    break;
+  case rv_inst_auipc:
+    if (b->opcode == rv_inst_addi && b->rd == a->rd && b_reads_a) {
+      return rv_fuse_la;
+    }
+    if (b->opcode == rv_inst_jalr && b_reads_a) {
+      return rv_fuse_call;
+    }
+    break;
+  case rv_inst_slli:
+    if (b->opcode == rv_inst_add && b->rd != 0 && (b_reads_a || b->rs2 == a->rd)) {
+      return rv_fuse_index;
+    }
+    break;
+  case rv_inst_slt:
+  case rv_inst_sltu:
+  case rv_inst_slti:
+  case rv_inst_sltiu:
+    // beqz/bnez of the comparison
+    if ((b->opcode == rv_inst_beq || b->opcode == rv_inst_bne) &&
+        ((b_reads_a && b->rs2 == 0) || (b->rs1 == 0 && b->rs2 == a->rd))) {
+      switch (a->opcode) {
+      case rv_inst_slt:   return rv_fuse_slt_branch;
+      case rv_inst_sltu:  return rv_fuse_sltu_branch;
+      case rv_inst_slti:  return rv_fuse_slti_branch;
+      default:            return rv_fuse_sltiu_branch;
+      }
+    }
+    break;
+  }
+  return 0;
+}
+
+// handler run for a pre-decoded instruction by the tail call interpreter,
+// returning false if the block stopped at an exception
+typedef bool (*interp_handler_t)(struct riscv_t *rv, const struct interp_inst_t *ii, uint32_t *X);
+
+// a pre-decoded instruction
+struct interp_inst_t {
+  struct rv_inst_t ir;
+  // guest address and encoding of the instruction
+  uint32_t pc;
+  uint32_t inst;
+  // handler specialised for its operands (tail call interpreter only)
+  interp_handler_t handler;
+};
+
+// a basic block of pre-decoded instructions
+struct interp_block_t {
+  // address range of the basic block
+  uint32_t pc_start;
+  uint32_t pc_end;
+  // number of guest instructions encompassed
+  uint32_t instructions;
+  // true if the block ends with fence.i
+  bool flush;
+  // blocks which last followed this one by branching and by falling through
+  struct interp_block_t *predict[2];
+  // decoded instructions, followed by a jal to pc_end if not ending in a branch
+  struct interp_inst_t insts[];
+};
+
+// decoded blocks of a core
+// note: blocks are cheap to decode so they are not shared between cores
+struct interp_cache_t {
+  // block storage, emptied when full
+  uint8_t *start;
+  uint8_t *head;
+  uint8_t *end;
+  // open addressed block hash map
+  struct interp_block_t **map;
+  uint32_t count;
+  // block run last (or NULL)
+  struct interp_block_t *prev;
+  // block being run by the tail call interpreter and how many of its
+  // instructions have been added to csr_cycle
+  const struct interp_block_t *block;
+  uint32_t retired;
+  // superinstructions decoded and run (the latter with RISCV_INTERP_PROFILE)
+  uint64_t fused_decoded[RV_NUM_FUSED];
+  uint64_t fused_hits[RV_NUM_FUSED];
+};
+
+// host address of a guest address in a host mapped page (or NULL)
+static inline uint8_t *host_addr(uint8_t **pages, uint32_t addr) {
+  uint8_t *page = pages ? pages[addr >> RV_PAGE_BITS] : NULL;
+  return page ? page + (addr & ((1u << RV_PAGE_BITS) - 1)) : NULL;
+}
+
+// run an instruction by its single step handler, returning false if it raised
+// an exception (defined in riscv.c)
+bool interp_step_inst(struct riscv_t *rv, uint32_t inst);
+
+// pick the tail call handler for a decoded instruction
+interp_handler_t tail_handler(const struct interp_inst_t *ii);
+// run a decoded block with the tail call interpreter
+void tail_run(struct riscv_t *rv, const struct interp_block_t *block);
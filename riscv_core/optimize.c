@@ -0,0 +1,203 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "riscv.h"
+#include "riscv_private.h"
+#include "decode.h"
+
+
+// instructions which only write rd and can be removed if rd is not read
+static bool inst_is_pure(const struct rv_inst_t *ir) {
+  switch (ir->opcode) {
+  case rv_inst_lui:
+  case rv_inst_auipc:
+  case rv_inst_addi:
+  case rv_inst_slti:
+  case rv_inst_sltiu:
+  case rv_inst_xori:
+  case rv_inst_ori:
+  case rv_inst_andi:
+  case rv_inst_slli:
+  case rv_inst_srli:
+  case rv_inst_srai:
+  case rv_inst_add:
+  case rv_inst_sub:
+  case rv_inst_sll:
+  case rv_inst_slt:
+  case rv_inst_sltu:
+  case rv_inst_xor:
+  case rv_inst_srl:
+  case rv_inst_sra:
+  case rv_inst_or:
+  case rv_inst_and:
+  case rv_inst_mul:
+  case rv_inst_mulh:
+  case rv_inst_mulhsu:
+  case rv_inst_mulhu:
+  // division never traps
+  case rv_inst_div:
+  case rv_inst_divu:
+  case rv_inst_rem:
+  case rv_inst_remu:
+  // bit manipulation
+  case rv_inst_sh1add:
+  case rv_inst_sh2add:
+  case rv_inst_sh3add:
+  case rv_inst_andn:
+  case rv_inst_orn:
+  case rv_inst_xnor:
+  case rv_inst_clz:
+  case rv_inst_ctz:
+  case rv_inst_cpop:
+  case rv_inst_max:
+  case rv_inst_maxu:
+  case rv_inst_min:
+  case rv_inst_minu:
+  case rv_inst_sextb:
+  case rv_inst_sexth:
+  case rv_inst_zexth:
+  case rv_inst_rol:
+  case rv_inst_ror:
+  case rv_inst_rori:
+  case rv_inst_orcb:
+  case rv_inst_rev8:
+  case rv_inst_bclr:
+  case rv_inst_bclri:
+  case rv_inst_bext:
+  case rv_inst_bexti:
+  case rv_inst_binv:
+  case rv_inst_binvi:
+  case rv_inst_bset:
+  case rv_inst_bseti:
+    return true;
+  default:
+    return false;
+  }
+}
+
+static bool inst_is_mem(const struct rv_inst_t *ir) {
+  switch (ir->opcode) {
+  case rv_inst_lb:
+  case rv_inst_lh:
+  case rv_inst_lw:
+  case rv_inst_lbu:
+  case rv_inst_lhu:
+  case rv_inst_sb:
+  case rv_inst_sh:
+  case rv_inst_sw:
+  case rv_inst_flw:
+  case rv_inst_fsw:
+  case rv_inst_fld:
+  case rv_inst_fsd:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// propagate constants produced by lui and auipc:
+//   lui/auipc + addi   -> lui of the combined constant
+//   auipc + jalr       -> jal to the now static target
+//   lui/auipc + ld/st  -> absolute address with rs1 = zero
+//   li/lui + div/rem   -> divisor held in imm for strength reduction
+static void pass_constants(struct block_inst_t *insts, uint32_t count, struct opt_stats_t *stats) {
+  uint32_t known = 0;
+  uint32_t value[RV_NUM_REGS];
+  for (uint32_t n = 0; n < count; ++n) {
+    struct rv_inst_t *ir = &insts[n].ir;
+    const uint32_t pc = insts[n].pc;
+    const bool rs1_known = ir->rs1 != rv_reg_zero && (known & (1u << ir->rs1));
+
+    switch (ir->opcode) {
+    case rv_inst_auipc:
+      ir->opcode = rv_inst_lui;
+      ir->imm = pc + ir->imm;
+      break;
+    case rv_inst_addi:
+      if (rs1_known) {
+        ir->opcode = rv_inst_lui;
+        ir->imm = value[ir->rs1] + ir->imm;
+        ++stats->fuse_const;
+      }
+      break;
+    case rv_inst_jalr:
+      if (rs1_known) {
+        const uint32_t target = (value[ir->rs1] + ir->imm) & ~1u;
+        ir->opcode = rv_inst_jal;
+        ir->imm = target - pc;
+        ++stats->fuse_call;
+      }
+      break;
+    case rv_inst_div:
+    case rv_inst_divu:
+    case rv_inst_rem:
+    case rv_inst_remu:
+      // rs2 is still read so the constant stays live
+      if (ir->rs2 != rv_reg_zero && (known & (1u << ir->rs2)) && value[ir->rs2]) {
+        ir->imm = value[ir->rs2];
+        ++stats->const_div;
+      }
+      break;
+    default:
+      if (rs1_known && inst_is_mem(ir)) {
+        ir->imm = value[ir->rs1] + ir->imm;
+        ir->rs1 = rv_reg_zero;
+        ++stats->fold_addr;
+      }
+      break;
+    }
+
+    // track the constant or invalidate the destination
+    // note: rd is invalidated even if it names an fp register or is unused
+    if (ir->opcode == rv_inst_lui) {
+      known |= 1u << ir->rd;
+      value[ir->rd] = ir->imm;
+    }
+    else if (ir->opcode == rv_inst_addi && ir->rs1 == rv_reg_zero) {
+      // li of a small constant
+      known |= 1u << ir->rd;
+      value[ir->rd] = ir->imm;
+    }
+    else if (ir->opcode == rv_inst_ecall || ir->opcode == rv_inst_ebreak) {
+      known = 0;
+    }
+    else {
+      known &= ~(1u << ir->rd);
+    }
+  }
+}
+
+// remove pure instructions whose result is overwritten before it is read
+static uint32_t pass_dead_writes(struct block_inst_t *insts, uint32_t count, struct opt_stats_t *stats) {
+  uint32_t out = 0;
+  for (uint32_t n = 0; n < count; ++n) {
+    const struct rv_inst_t *ir = &insts[n].ir;
+    bool dead = false;
+    if (inst_is_pure(ir) && ir->rd != rv_reg_zero) {
+      const uint32_t rd = 1u << ir->rd;
+      for (uint32_t m = n + 1; m < count; ++m) {
+        uint32_t use, def;
+        inst_regs(&insts[m].ir, &use, &def);
+        if (use & rd) {
+          break;
+        }
+        if (def & rd) {
+          dead = true;
+          break;
+        }
+      }
+    }
+    if (dead) {
+      ++stats->dead_write;
+      continue;
+    }
+    insts[out++] = insts[n];
+  }
+  return out;
+}
+
+uint32_t optimize(struct block_inst_t *insts, uint32_t count, struct opt_stats_t *stats) {
+  pass_constants(insts, count, stats);
+  return pass_dead_writes(insts, count, stats);
+}
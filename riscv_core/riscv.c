@@ -1,5 +1,6 @@
 #include <assert.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -9,6 +10,7 @@
 
 #include "riscv.h"
 #include "riscv_private.h"
+#include "interp.h"
 
 
 static bool op_load(struct riscv_t *rv, uint32_t inst) {
@@ -53,7 +55,7 @@ static bool op_load(struct riscv_t *rv, uint32_t inst) {
     return false;
   }
   // step over instruction
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   // enforce zero register
   if (rd == rv_reg_zero) {
     rv->X[rv_reg_zero] = 0;
@@ -64,7 +66,7 @@ static bool op_load(struct riscv_t *rv, uint32_t inst) {
 #if RISCV_VM_SUPPORT_Zifencei
 static bool op_misc_mem(struct riscv_t *rv, uint32_t inst) {
   // TODO
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   return true;
 }
 #else
@@ -82,8 +84,50 @@ static bool op_op_imm(struct riscv_t *rv, uint32_t inst) {
   case 0: // ADDI
     rv->X[rd] = (int32_t)(rv->X[rs1]) + imm;
     break;
-  case 1: // SLLI
-    rv->X[rd] = rv->X[rs1] << (imm & 0x1f);
+  case 1:
+    switch ((uint32_t)imm >> 5) {
+    case 0b0000000: // SLLI
+      rv->X[rd] = rv->X[rs1] << (imm & 0x1f);
+      break;
+#if RISCV_VM_SUPPORT_Zbb
+    case 0b0110000:
+      switch (imm & 0x1f) {
+      case 0b00000: // CLZ
+        rv->X[rd] = calc_clz(rv->X[rs1]);
+        break;
+      case 0b00001: // CTZ
+        rv->X[rd] = calc_ctz(rv->X[rs1]);
+        break;
+      case 0b00010: // CPOP
+        rv->X[rd] = calc_cpop(rv->X[rs1]);
+        break;
+      case 0b00100: // SEXT.B
+        rv->X[rd] = sign_extend_b(rv->X[rs1]);
+        break;
+      case 0b00101: // SEXT.H
+        rv->X[rd] = sign_extend_h(rv->X[rs1]);
+        break;
+      default:
+        rv_except_illegal_inst(rv);
+        return false;
+      }
+      break;
+#endif  // RISCV_VM_SUPPORT_Zbb
+#if RISCV_VM_SUPPORT_Zbs
+    case 0b0100100: // BCLRI
+      rv->X[rd] = rv->X[rs1] & ~(1u << (imm & 0x1f));
+      break;
+    case 0b0110100: // BINVI
+      rv->X[rd] = rv->X[rs1] ^ (1u << (imm & 0x1f));
+      break;
+    case 0b0010100: // BSETI
+      rv->X[rd] = rv->X[rs1] | (1u << (imm & 0x1f));
+      break;
+#endif  // RISCV_VM_SUPPORT_Zbs
+    default:
+      rv_except_illegal_inst(rv);
+      return false;
+    }
     break;
   case 2: // SLTI
     rv->X[rd] = ((int32_t)(rv->X[rs1]) < imm) ? 1 : 0;
@@ -95,13 +139,40 @@ static bool op_op_imm(struct riscv_t *rv, uint32_t inst) {
     rv->X[rd] = rv->X[rs1] ^ imm;
     break;
   case 5:
-    if (imm & ~0x1f) {
-      // SRAI
-      rv->X[rd] = ((int32_t)rv->X[rs1]) >> (imm & 0x1f);
-    }
-    else {
-      // SRLI
+    switch ((uint32_t)imm >> 5) {
+    case 0b0000000: // SRLI
       rv->X[rd] = rv->X[rs1] >> (imm & 0x1f);
+      break;
+    case 0b0100000: // SRAI
+      rv->X[rd] = ((int32_t)rv->X[rs1]) >> (imm & 0x1f);
+      break;
+#if RISCV_VM_SUPPORT_Zbb
+    case 0b0110000: // RORI
+      rv->X[rd] = calc_ror(rv->X[rs1], imm);
+      break;
+    case 0b0010100: // ORC.B
+      if ((imm & 0x1f) != 0b00111) {
+        rv_except_illegal_inst(rv);
+        return false;
+      }
+      rv->X[rd] = calc_orcb(rv->X[rs1]);
+      break;
+    case 0b0110100: // REV8
+      if ((imm & 0x1f) != 0b11000) {
+        rv_except_illegal_inst(rv);
+        return false;
+      }
+      rv->X[rd] = calc_rev8(rv->X[rs1]);
+      break;
+#endif  // RISCV_VM_SUPPORT_Zbb
+#if RISCV_VM_SUPPORT_Zbs
+    case 0b0100100: // BEXTI
+      rv->X[rd] = (rv->X[rs1] >> (imm & 0x1f)) & 1;
+      break;
+#endif  // RISCV_VM_SUPPORT_Zbs
+    default:
+      rv_except_illegal_inst(rv);
+      return false;
     }
     break;
   case 6: // ORI
@@ -115,7 +186,7 @@ static bool op_op_imm(struct riscv_t *rv, uint32_t inst) {
     return false;
   }
   // step over instruction
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   // enforce zero register
   if (rd == rv_reg_zero) {
     rv->X[rv_reg_zero] = 0;
@@ -130,7 +201,7 @@ static bool op_auipc(struct riscv_t *rv, uint32_t inst) {
   const uint32_t val = dec_utype_imm(inst) + rv->PC;
   rv->X[rd] = val;
   // step over instruction
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   // enforce zero register
   if (rd == rv_reg_zero) {
     rv->X[rv_reg_zero] = 0;
@@ -171,7 +242,7 @@ static bool op_store(struct riscv_t *rv, uint32_t inst) {
     return false;
   }
   // step over instruction
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   return true;
 }
 
@@ -309,17 +380,120 @@ static bool op_op(struct riscv_t *rv, uint32_t inst) {
     case 0b101:  // SRA
       rv->X[rd] = ((int32_t)rv->X[rs1]) >> (rv->X[rs2] & 0x1f);
       break;
+#if RISCV_VM_SUPPORT_Zbb
+    case 0b100:  // XNOR
+      rv->X[rd] = ~(rv->X[rs1] ^ rv->X[rs2]);
+      break;
+    case 0b110:  // ORN
+      rv->X[rd] = rv->X[rs1] | ~rv->X[rs2];
+      break;
+    case 0b111:  // ANDN
+      rv->X[rd] = rv->X[rs1] & ~rv->X[rs2];
+      break;
+#endif  // RISCV_VM_SUPPORT_Zbb
+    default:
+      rv_except_illegal_inst(rv);
+      return false;
+    }
+    break;
+#if RISCV_VM_SUPPORT_Zba
+  case 0b0010000:
+    // RV32 Zba instructions
+    switch (funct3) {
+    case 0b010:  // SH1ADD
+      rv->X[rd] = (rv->X[rs1] << 1) + rv->X[rs2];
+      break;
+    case 0b100:  // SH2ADD
+      rv->X[rd] = (rv->X[rs1] << 2) + rv->X[rs2];
+      break;
+    case 0b110:  // SH3ADD
+      rv->X[rd] = (rv->X[rs1] << 3) + rv->X[rs2];
+      break;
     default:
       rv_except_illegal_inst(rv);
       return false;
     }
     break;
+#endif  // RISCV_VM_SUPPORT_Zba
+#if RISCV_VM_SUPPORT_Zbb
+  case 0b0000101:
+    // RV32 Zbb min and max
+    switch (funct3) {
+    case 0b100:  // MIN
+      rv->X[rd] = ((int32_t)rv->X[rs1] < (int32_t)rv->X[rs2]) ? rv->X[rs1] : rv->X[rs2];
+      break;
+    case 0b101:  // MINU
+      rv->X[rd] = (rv->X[rs1] < rv->X[rs2]) ? rv->X[rs1] : rv->X[rs2];
+      break;
+    case 0b110:  // MAX
+      rv->X[rd] = ((int32_t)rv->X[rs1] > (int32_t)rv->X[rs2]) ? rv->X[rs1] : rv->X[rs2];
+      break;
+    case 0b111:  // MAXU
+      rv->X[rd] = (rv->X[rs1] > rv->X[rs2]) ? rv->X[rs1] : rv->X[rs2];
+      break;
+    default:
+      rv_except_illegal_inst(rv);
+      return false;
+    }
+    break;
+  case 0b0110000:
+    // RV32 Zbb rotates
+    switch (funct3) {
+    case 0b001:  // ROL
+      rv->X[rd] = calc_rol(rv->X[rs1], rv->X[rs2]);
+      break;
+    case 0b101:  // ROR
+      rv->X[rd] = calc_ror(rv->X[rs1], rv->X[rs2]);
+      break;
+    default:
+      rv_except_illegal_inst(rv);
+      return false;
+    }
+    break;
+  case 0b0000100:  // ZEXT.H
+    if (funct3 != 0b100 || rs2 != rv_reg_zero) {
+      rv_except_illegal_inst(rv);
+      return false;
+    }
+    rv->X[rd] = rv->X[rs1] & 0xffff;
+    break;
+#endif  // RISCV_VM_SUPPORT_Zbb
+#if RISCV_VM_SUPPORT_Zbs
+  case 0b0100100:
+    // RV32 Zbs clear and extract
+    switch (funct3) {
+    case 0b001:  // BCLR
+      rv->X[rd] = rv->X[rs1] & ~(1u << (rv->X[rs2] & 0x1f));
+      break;
+    case 0b101:  // BEXT
+      rv->X[rd] = (rv->X[rs1] >> (rv->X[rs2] & 0x1f)) & 1;
+      break;
+    default:
+      rv_except_illegal_inst(rv);
+      return false;
+    }
+    break;
+  case 0b0110100:  // BINV
+    if (funct3 != 0b001) {
+      rv_except_illegal_inst(rv);
+      return false;
+    }
+    rv->X[rd] = rv->X[rs1] ^ (1u << (rv->X[rs2] & 0x1f));
+    break;
+  case 0b0010100:  // BSET
+    if (funct3 != 0b001) {
+      rv_except_illegal_inst(rv);
+      return false;
+    }
+    rv->X[rd] = rv->X[rs1] | (1u << (rv->X[rs2] & 0x1f));
+    break;
+#endif  // RISCV_VM_SUPPORT_Zbs
   default:
     rv_except_illegal_inst(rv);
     return false;
   }
   // step over instruction
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   // enforce zero register
   if (rd == rv_reg_zero) {
     rv->X[rv_reg_zero] = 0;
@@ -333,7 +507,7 @@ static bool op_lui(struct riscv_t *rv, uint32_t inst) {
   const uint32_t val = dec_utype_imm(inst);
   rv->X[rd] = val;
   // step over instruction
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   // enforce zero register
   if (rd == rv_reg_zero) {
     rv->X[rv_reg_zero] = 0;
@@ -377,13 +551,13 @@ static bool op_branch(struct riscv_t *rv, uint32_t inst) {
   // perform branch action
   if (taken) {
     rv->PC += imm;
-    if (rv->PC & 0x3) {
+    if (rv->PC & PC_ALIGN_MASK) {
       rv_except_inst_misaligned(rv, pc);
     }
   }
   else {
     // step over instruction
-    rv->PC += 4;
+    rv->PC += inst_length(inst);
   }
   // can branch
   return false;
@@ -396,7 +570,7 @@ static bool op_jalr(struct riscv_t *rv, uint32_t inst) {
   const uint32_t rs1 = dec_rs1(inst);
   const int32_t  imm = dec_itype_imm(inst);
   // compute return address
-  const uint32_t ra = rv->PC + 4;
+  const uint32_t ra = rv->PC + inst_length(inst);
   // jump
   rv->PC = (rv->X[rs1] + imm) & ~1u;
   // link
@@ -404,7 +578,7 @@ static bool op_jalr(struct riscv_t *rv, uint32_t inst) {
     rv->X[rd] = ra;
   }
   // check for exception
-  if (rv->PC & 0x3) {
+  if (rv->PC & PC_ALIGN_MASK) {
     rv_except_inst_misaligned(rv, pc);
     return false;
   }
@@ -418,14 +592,14 @@ static bool op_jal(struct riscv_t *rv, uint32_t inst) {
   const uint32_t rd  = dec_rd(inst);
   const int32_t rel = dec_jtype_imm(inst);
   // compute return address
-  const uint32_t ra = rv->PC + 4;
+  const uint32_t ra = rv->PC + inst_length(inst);
   rv->PC += rel;
   // link
   if (rd != rv_reg_zero) {
     rv->X[rd] = ra;
   }
   // check alignment of PC
-  if (rv->PC & 0x3) {
+  if (rv->PC & PC_ALIGN_MASK) {
     rv_except_inst_misaligned(rv, pc);
     return false;
   }
@@ -449,8 +623,10 @@ static bool op_system(struct riscv_t *rv, uint32_t inst) {
     // dispatch from imm field
     switch (imm) {
     case 0: // ECALL
+      // step over first so the handler sees the return address, as in the jit
+      rv->PC += inst_length(inst);
       rv->io.on_ecall(rv);
-      break;
+      return true;
     case 1: // EBREAK
       rv->io.on_ebreak(rv);
       break;
@@ -483,7 +659,7 @@ static bool op_system(struct riscv_t *rv, uint32_t inst) {
     rv->X[rd] = rd ? tmp : rv->X[rd];
     break;
   case 5: // CSRRWI
-    tmp = csr_csrrc(rv, csr, rv->X[rs1]);
+    tmp = csr_csrrw(rv, csr, rs1);
     rv->X[rd] = rd ? tmp : rv->X[rd];
     break;
   case 6: // CSRRSI
@@ -500,7 +676,7 @@ static bool op_system(struct riscv_t *rv, uint32_t inst) {
     return false;
   }
   // step over instruction
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   // enforce zero register
   if (rd == rv_reg_zero) {
     rv->X[rv_reg_zero] = 0;
@@ -514,108 +690,48 @@ static bool op_amo(struct riscv_t *rv, uint32_t inst) {
   const uint32_t rs1    = dec_rs1(inst);
   const uint32_t rs2    = dec_rs2(inst);
   const uint32_t f7     = dec_funct7(inst);
-  const uint32_t rl     = (f7 >> 0) & 1;
-  const uint32_t aq     = (f7 >> 1) & 1;
   const uint32_t funct5 = (f7 >> 2) & 0x1f;
+  // note: all amos are sequentially consistent so the aq/rl bits are ignored
 
+  uint32_t tmp;
   switch (funct5) {
   case 0b00010:  // LR.W
-    rv->X[rd] = rv->io.mem_read_w(rv, rv->X[rs1]);
-    // skip registration of the 'reservation set'
-    // TODO: implement me
+    tmp = amo_lrw(rv, rv->X[rs1]);
     break;
   case 0b00011:  // SC.W
-    // we assume the 'reservation set' is valid
-    // TODO: implement me
-    rv->io.mem_write_w(rv, rv->X[rs1], rv->X[rs2]);
-    rv->X[rd] = 0;
+    tmp = amo_scw(rv, rv->X[rs1], rv->X[rs2]);
     break;
-  case 0b00001:  // AMOSWAP.W
-    {
-      rv->X[rd] = rv->io.mem_read_w(rv, rs1);
-      rv->io.mem_write_s(rv, rs1, rv->X[rs2]);
-      break;
-    }
-  case 0b00000:  // AMOADD.W
-    {
-      rv->X[rd] = rv->io.mem_read_w(rv, rs1);
-      const int32_t res = (int32_t)rv->X[rd] + (int32_t)rv->X[rs2];
-      rv->io.mem_write_s(rv, rs1, res);
-      break;
-    }
-  case 0b00100:  // AMOXOR.W
-    {
-      rv->X[rd] = rv->io.mem_read_w(rv, rs1);
-      const int32_t res = rv->X[rd] ^ rv->X[rs2];
-      rv->io.mem_write_s(rv, rs1, res);
-      break;
-    }
-  case 0b01100:  // AMOAND.W
-    {
-      rv->X[rd] = rv->io.mem_read_w(rv, rs1);
-      const int32_t res = rv->X[rd] & rv->X[rs2];
-      rv->io.mem_write_s(rv, rs1, res);
-      break;
-    }
-  case 0b01000:  // AMOOR.W
-    {
-      rv->X[rd] = rv->io.mem_read_w(rv, rs1);
-      const int32_t res = rv->X[rd] | rv->X[rs2];
-      rv->io.mem_write_s(rv, rs1, res);
-      break;
-    }
-  case 0b10000:  // AMOMIN.W
-    {
-      rv->X[rd] = rv->io.mem_read_w(rv, rs1);
-      const int32_t a = rv->X[rd];
-      const int32_t b = rv->X[rs2];
-      const int32_t res = a < b ? a : b;
-      rv->io.mem_write_s(rv, rs1, res);
-      break;
-    }
-  case 0b10100:  // AMOMAX.W
-    {
-      rv->X[rd] = rv->io.mem_read_w(rv, rs1);
-      const int32_t a = rv->X[rd];
-      const int32_t b = rv->X[rs2];
-      const int32_t res = a > b ? a : b;
-      rv->io.mem_write_s(rv, rs1, res);
-      break;
-    }
-  case 0b11000:  // AMOMINU.W
-    {
-      rv->X[rd] = rv->io.mem_read_w(rv, rs1);
-      const uint32_t a = rv->X[rd];
-      const uint32_t b = rv->X[rs2];
-      const uint32_t res = a < b ? a : b;
-      rv->io.mem_write_s(rv, rs1, res);
-      break;
-    }
-  case 0b11100:  // AMOMAXU.W
-    {
-      rv->X[rd] = rv->io.mem_read_w(rv, rs1);
-      const uint32_t a = rv->X[rd];
-      const uint32_t b = rv->X[rs2];
-      const uint32_t res = a > b ? a : b;
-      rv->io.mem_write_s(rv, rs1, res);
-      break;
+  default:       // AMO*.W
+    if (!amo_rmw(rv, funct5, rv->X[rs1], rv->X[rs2], &tmp)) {
+      rv_except_illegal_inst(rv);
+      return false;
     }
-  default:
-    rv_except_illegal_inst(rv);
-    return false;
+    break;
   }
+  rv->X[rd] = rd ? tmp : rv->X[rd];
   // step over instruction
-  rv->PC += 4;
-  // enforce zero register
-  if (rd == rv_reg_zero) {
-    rv->X[rv_reg_zero] = 0;
-  }
+  rv->PC += inst_length(inst);
   return true;
 }
 #else
 #define op_amo NULL
 #endif  // RISCV_VM_SUPPORT_RV32A
 
+#if RISCV_VM_SUPPORT_RVV
+// vector instructions run on the portable loops of the vector unit
+static bool op_v(struct riscv_t *rv, uint32_t inst) {
+  if (!vec_exec(rv, inst, 0)) {
+    rv_except_illegal_inst(rv);
+    return false;
+  }
+  // step over instruction
+  rv->PC += inst_length(inst);
+  return true;
+}
+#else
+#define op_v NULL
+#endif  // RISCV_VM_SUPPORT_RVV
+
 #if RISCV_VM_SUPPORT_RV32F
 static bool op_load_fp(struct riscv_t *rv, uint32_t inst) {
   const uint32_t rd  = dec_rd(inst);
@@ -624,10 +740,27 @@ static bool op_load_fp(struct riscv_t *rv, uint32_t inst) {
   // calculate load address
   const uint32_t addr = rv->X[rs1] + imm;
   // copy into the float register
-  const uint32_t data = rv->io.mem_read_w(rv, addr);
-  memcpy(rv->F + rd, &data, 4);
+  switch (dec_funct3(inst)) {
+  case 0b010:  // FLW
+    fp_write_w(rv, rd, rv->io.mem_read_w(rv, addr));
+    break;
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b011:  // FLD
+    rv->F[rd].bits = fp_read_d(rv, addr);
+    break;
+#endif
+#if RISCV_VM_SUPPORT_RVV
+  case 0b000:  // VLE8 and friends
+  case 0b101:  // VLE16
+  case 0b110:  // VLE32
+    return op_v(rv, inst);
+#endif
+  default:
+    rv_except_illegal_inst(rv);
+    return false;
+  }
   // step over instruction
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   return true;
 }
 
@@ -638,42 +771,200 @@ static bool op_store_fp(struct riscv_t *rv, uint32_t inst) {
   // calculate store address
   const uint32_t addr = rv->X[rs1] + imm;
   // copy from float registers
-  uint32_t data;
-  memcpy(&data, (const void*)(rv->F + rs2), 4);
-  rv->io.mem_write_w(rv, addr, data);
+  switch (dec_funct3(inst)) {
+  case 0b010:  // FSW
+    rv->io.mem_write_w(rv, addr, (uint32_t)rv->F[rs2].bits);
+    break;
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b011:  // FSD
+    fp_write_d(rv, addr, rv->F[rs2].bits);
+    break;
+#endif
+#if RISCV_VM_SUPPORT_RVV
+  case 0b000:  // VSE8 and friends
+  case 0b101:  // VSE16
+  case 0b110:  // VSE32
+    return op_v(rv, inst);
+#endif
+  default:
+    rv_except_illegal_inst(rv);
+    return false;
+  }
   // step over instruction
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   return true;
 }
 
+#if RISCV_VM_SUPPORT_RV32D
+// double forms of the op-fp instructions, returning false if illegal
+static bool op_fp_d(struct riscv_t *rv, uint32_t inst) {
+  const uint32_t rd     = dec_rd(inst);
+  const uint32_t rs1    = dec_rs1(inst);
+  const uint32_t rs2    = dec_rs2(inst);
+  const uint32_t rm     = dec_funct3(inst);
+  const uint32_t funct7 = dec_funct7(inst);
+  const double a = rv->F[rs1].d;
+  const double b = rv->F[rs2].d;
+  switch (funct7) {
+  case 0b0000001:  // FADD.D
+  case 0b0000101:  // FSUB.D
+  case 0b0001001:  // FMUL.D
+  case 0b0001101:  // FDIV.D
+  case 0b0101101:  // FSQRT.D
+  case 0b0100000:  // FCVT.S.D
+  case 0b1101001:  // FCVT.D.W, FCVT.D.WU
+  {
+    if ((funct7 == 0b0100000 && rs2 != 0b00001) || (funct7 == 0b1101001 && rs2 > 0b00001)) {
+      return false;
+    }
+    // note: operands are read and the result written between the calls which
+    //       set the rounding mode so the arithmetic can't move outside them
+    // note: a square root is never a tie and the integers convert exactly, so
+    //       only the others need fixing up for ties to max magnitude
+    const int round = fp_round_begin(rm);
+    const bool rmm = fp_is_rmm(rv, rm);
+    switch (funct7) {
+    case 0b0000001:
+      rv->F[rd].d = fp_canonical_d(rmm ? fp_rmm_d(FP_RMM_ADD, a + b, a, b, 0.) : a + b);
+      break;
+    case 0b0000101:
+      rv->F[rd].d = fp_canonical_d(rmm ? fp_rmm_d(FP_RMM_SUB, a - b, a, b, 0.) : a - b);
+      break;
+    case 0b0001001:
+      rv->F[rd].d = fp_canonical_d(rmm ? fp_rmm_d(FP_RMM_MUL, a * b, a, b, 0.) : a * b);
+      break;
+    case 0b0001101:
+      rv->F[rd].d = fp_canonical_d(rmm ? fp_rmm_d(FP_RMM_DIV, a / b, a, b, 0.) : a / b);
+      break;
+    case 0b0101101:
+      rv->F[rd].d = fp_canonical_d(sqrt(a));
+      break;
+    case 0b0100000:
+      fp_write_s(rv, rd, fp_canonical(rmm ? fp_rmm(FP_RMM_CVT, (float)a, a, 0., 0.) : (float)a));
+      break;
+    default:
+      rv->F[rd].d = rs2 ? (double)rv->X[rs1] : (double)(int32_t)rv->X[rs1];
+      break;
+    }
+    fp_round_end(round);
+    return true;
+  }
+  case 0b0100001:  // FCVT.D.S
+    if (rs2 != 0b00000) {
+      return false;
+    }
+    // exact, so only a nan needs care
+    rv->F[rd].d = fp_canonical_d((double)rv->F[rs1].f);
+    return true;
+  case 0b0010001:
+  {
+    const uint64_t f1 = rv->F[rs1].bits;
+    const uint64_t f2 = rv->F[rs2].bits;
+    switch (rm) {
+    case 0b000:  // FSGNJ.D
+      rv->F[rd].bits = (f1 & ~DMASK_SIGN) | (f2 & DMASK_SIGN);
+      return true;
+    case 0b001:  // FSGNJN.D
+      rv->F[rd].bits = (f1 & ~DMASK_SIGN) | (~f2 & DMASK_SIGN);
+      return true;
+    case 0b010:  // FSGNJX.D
+      rv->F[rd].bits = f1 ^ (f2 & DMASK_SIGN);
+      return true;
+    }
+    return false;
+  }
+  case 0b0010101:  // FMIN.D, FMAX.D
+    if (rm > 0b001) {
+      return false;
+    }
+    rv->F[rd].d = fp_minmax_d(rv, a, b, rm == 0b001);
+    return true;
+  case 0b1100001:  // FCVT.W.D, FCVT.WU.D
+    if (rs2 > 0b00001) {
+      return false;
+    }
+    rv->X[rd] = fp_cvt_w(rv, a, rm, rs2 == 0b00001);
+    return true;
+  case 0b1110001:  // FCLASS.D
+    if (rm != 0b001) {
+      return false;
+    }
+    rv->X[rd] = calc_fclass_d(rv->F[rs1].bits);
+    return true;
+  case 0b1010001:
+    switch (rm) {
+    case 0b010:  // FEQ.D
+      rv->X[rd] = (a == b) ? 1 : 0;
+      return true;
+    case 0b001:  // FLT.D
+      rv->X[rd] = (a < b) ? 1 : 0;
+      return true;
+    case 0b000:  // FLE.D
+      rv->X[rd] = (a <= b) ? 1 : 0;
+      return true;
+    }
+    return false;
+  default:
+    return false;
+  }
+}
+#endif  // RISCV_VM_SUPPORT_RV32D
+
 static bool op_fp(struct riscv_t *rv, uint32_t inst) {
   const uint32_t rd     = dec_rd(inst);
   const uint32_t rs1    = dec_rs1(inst);
   const uint32_t rs2    = dec_rs2(inst);
-  const uint32_t rm     = dec_funct3(inst); // TODO: rounding!
+  const uint32_t rm     = dec_funct3(inst);
   const uint32_t funct7 = dec_funct7(inst);
+#if RISCV_VM_SUPPORT_RV32D
+  // the low bit of funct7 selects double width, bar fcvt.s.d which is
+  // encoded as a single as that is what it writes
+  if ((funct7 & 1) || funct7 == 0b0100000) {
+    if (!op_fp_d(rv, inst)) {
+      rv_except_illegal_inst(rv);
+      return false;
+    }
+    // x0 is only written by the compares, conversions and fclass
+    rv->X[rv_reg_zero] = 0;
+    rv->PC += inst_length(inst);
+    return true;
+  }
+#endif
   // dispatch based on func7 (low 2 bits are width)
   switch (funct7) {
   case 0b0000000:  // FADD
-    rv->F[rd] = rv->F[rs1] + rv->F[rs2];
-    break;
   case 0b0000100:  // FSUB
-    rv->F[rd] = rv->F[rs1] - rv->F[rs2];
-    break;
   case 0b0001000:  // FMUL
-    rv->F[rd] = rv->F[rs1] * rv->F[rs2];
-    break;
   case 0b0001100:  // FDIV
-    rv->F[rd] = rv->F[rs1] / rv->F[rs2];
-    break;
   case 0b0101100:  // FSQRT
-    rv->F[rd] = sqrtf(rv->F[rs1]);
+  {
+    // note: operands are read and the result written between the calls which
+    //       set the rounding mode so the arithmetic can't move outside them
+    const int round = fp_round_begin(rm);
+    const float a = rv->F[rs1].f;
+    const float b = rv->F[rs2].f;
+    float r;
+    uint32_t op;
+    switch (funct7) {
+    case 0b0000000: r = a + b;     op = FP_RMM_ADD; break;
+    case 0b0000100: r = a - b;     op = FP_RMM_SUB; break;
+    case 0b0001000: r = a * b;     op = FP_RMM_MUL; break;
+    case 0b0001100: r = a / b;     op = FP_RMM_DIV; break;
+    default:        r = sqrtf(a);  op = FP_RMM_CVT; break;
+    }
+    // note: a square root is never a tie so it is left as it is
+    if (fp_is_rmm(rv, rm) && funct7 != 0b0101100) {
+      r = fp_rmm(op, r, a, b, 0.);
+    }
+    fp_write_s(rv, rd, fp_canonical(r));
+    fp_round_end(round);
     break;
+  }
   case 0b0010000:
   {
     uint32_t f1, f2, res;
-    memcpy(&f1, rv->F + rs1, 4);
-    memcpy(&f2, rv->F + rs2, 4);
+    memcpy(&f1, &rv->F[rs1].f, 4);
+    memcpy(&f2, &rv->F[rs2].f, 4);
     switch (rm) {
     case 0b000:  // FSGNJ.S
       res = (f1 & ~FMASK_SIGN) | (f2 & FMASK_SIGN);
@@ -688,16 +979,16 @@ static bool op_fp(struct riscv_t *rv, uint32_t inst) {
       rv_except_illegal_inst(rv);
       return false;
     }
-    memcpy(rv->F + rd, &res, 4);
+    fp_write_w(rv, rd, res);
     break;
   }
   case 0b0010100:
     switch (rm) {
     case 0b000:  // FMIN
-      rv->F[rd] = fminf(rv->F[rs1], rv->F[rs2]);
+      fp_write_s(rv, rd, fp_minmax(rv, rv->F[rs1].f, rv->F[rs2].f, false));
       break;
     case 0b001:  // FMAX
-      rv->F[rd] = fmaxf(rv->F[rs1], rv->F[rs2]);
+      fp_write_s(rv, rd, fp_minmax(rv, rv->F[rs1].f, rv->F[rs2].f, true));
       break;
     default:
       rv_except_illegal_inst(rv);
@@ -707,10 +998,10 @@ static bool op_fp(struct riscv_t *rv, uint32_t inst) {
   case 0b1100000:
     switch (rs2) {
     case 0b00000:  // FCVT.W.S
-      rv->X[rd] = (int32_t)rv->F[rs1];
+      rv->X[rd] = fp_cvt_w(rv, rv->F[rs1].f, rm, false);
       break;
     case 0b00001:  // FCVT.WU.S
-      rv->X[rd] = (uint32_t)rv->F[rs1];
+      rv->X[rd] = fp_cvt_w(rv, rv->F[rs1].f, rm, true);
       break;
     default:
       rv_except_illegal_inst(rv);
@@ -721,12 +1012,12 @@ static bool op_fp(struct riscv_t *rv, uint32_t inst) {
     switch (rm) {
     case 0b000:  // FMV.X.W
       // bit exact copy between register files
-      memcpy(rv->X + rd, rv->F + rs1, 4);
+      memcpy(rv->X + rd, &rv->F[rs1].f, 4);
       break;
     case 0b001:  // FCLASS.S
       {
         uint32_t bits;
-        memcpy(&bits, rv->F + rs1, 4);
+        memcpy(&bits, &rv->F[rs1].f, 4);
         rv->X[rd] = calc_fclass(bits);
         break;
       }
@@ -738,13 +1029,13 @@ static bool op_fp(struct riscv_t *rv, uint32_t inst) {
   case 0b1010000:
     switch (rm) {
     case 0b010:  // FEQ.S
-      rv->X[rd] = (rv->F[rs1] == rv->F[rs2]) ? 1 : 0;
+      rv->X[rd] = (rv->F[rs1].f == rv->F[rs2].f) ? 1 : 0;
       break;
     case 0b001:  // FLT.S
-      rv->X[rd] = (rv->F[rs1] < rv->F[rs2]) ? 1 : 0;
+      rv->X[rd] = (rv->F[rs1].f < rv->F[rs2].f) ? 1 : 0;
       break;
     case 0b000:  // FLE.S
-      rv->X[rd] = (rv->F[rs1] <= rv->F[rs2]) ? 1 : 0;
+      rv->X[rd] = (rv->F[rs1].f <= rv->F[rs2].f) ? 1 : 0;
       break;
     default:
       rv_except_illegal_inst(rv);
@@ -752,85 +1043,99 @@ static bool op_fp(struct riscv_t *rv, uint32_t inst) {
     }
     break;
   case 0b1101000:
+  {
+    const int round = fp_round_begin(rm);
+    const bool rmm = fp_is_rmm(rv, rm);
     switch (rs2) {
     case 0b00000:  // FCVT.S.W
-      rv->F[rd] = (float)(int32_t)rv->X[rs1];
+    {
+      const double x = (double)(int32_t)rv->X[rs1];
+      fp_write_s(rv, rd, rmm ? fp_rmm(FP_RMM_CVT, (float)x, x, 0., 0.) : (float)x);
       break;
+    }
     case 0b00001:  // FCVT.S.WU
-      rv->F[rd] = (float)(uint32_t)rv->X[rs1];
+    {
+      const double x = (double)rv->X[rs1];
+      fp_write_s(rv, rd, rmm ? fp_rmm(FP_RMM_CVT, (float)x, x, 0., 0.) : (float)x);
       break;
+    }
     default:
+      fp_round_end(round);
       rv_except_illegal_inst(rv);
       return false;
     }
+    fp_round_end(round);
     break;
+  }
   case 0b1111000:  // FMV.W.X
     // bit exact copy between register files
-    memcpy(rv->F + rd, rv->X + rs1, 4);
+    fp_write_w(rv, rd, rv->X[rs1]);
     break;
   default:
     rv_except_illegal_inst(rv);
     return false;
   }
   // step over instruction
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   return true;
 }
 
-static bool op_madd(struct riscv_t *rv, uint32_t inst) {
+// fused multiply add of rs1 * rs2 and rs3 with either negated
+static bool op_fma(struct riscv_t *rv, uint32_t inst, bool neg_mul, bool neg_add) {
   const uint32_t rd  = dec_rd(inst);
-  const uint32_t rm  = dec_funct3(inst);      // todo
+  const uint32_t rm  = dec_funct3(inst);
   const uint32_t rs1 = dec_rs1(inst);
   const uint32_t rs2 = dec_rs2(inst);
-  const uint32_t fmt = dec_r4type_fmt(inst);  // unused
+  const uint32_t fmt = dec_r4type_fmt(inst);
   const uint32_t rs3 = dec_r4type_rs3(inst);
-  // compute
-  rv->F[rd] = rv->F[rs1] * rv->F[rs2] + rv->F[rs3];
+  // compute with a single rounding
+  const int round = fp_round_begin(rm);
+  switch (fmt) {
+  case 0b00:
+  {
+    const float a = neg_mul ? -rv->F[rs1].f : rv->F[rs1].f;
+    const float b = rv->F[rs2].f;
+    const float c = neg_add ? -rv->F[rs3].f : rv->F[rs3].f;
+    const float r = fp_fma(rv, a, b, c);
+    fp_write_s(rv, rd, fp_is_rmm(rv, rm) ? fp_rmm(FP_RMM_FMA, r, a, b, c) : r);
+    break;
+  }
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b01:
+  {
+    const double a = neg_mul ? -rv->F[rs1].d : rv->F[rs1].d;
+    const double b = rv->F[rs2].d;
+    const double c = neg_add ? -rv->F[rs3].d : rv->F[rs3].d;
+    const double r = fp_fma_d(rv, a, b, c);
+    rv->F[rd].d = fp_is_rmm(rv, rm) ? fp_rmm_d(FP_RMM_FMA, r, a, b, c) : r;
+    break;
+  }
+#endif
+  default:
+    fp_round_end(round);
+    rv_except_illegal_inst(rv);
+    return false;
+  }
+  fp_round_end(round);
   // step over instruction
-  rv->PC += 4;
+  rv->PC += inst_length(inst);
   return true;
 }
 
+static bool op_madd(struct riscv_t *rv, uint32_t inst) {
+  return op_fma(rv, inst, false, false);
+}
+
 static bool op_msub(struct riscv_t *rv, uint32_t inst) {
-  const uint32_t rd  = dec_rd(inst);
-  const uint32_t rm  = dec_funct3(inst);      // todo
-  const uint32_t rs1 = dec_rs1(inst);
-  const uint32_t rs2 = dec_rs2(inst);
-  const uint32_t fmt = dec_r4type_fmt(inst);  // unused
-  const uint32_t rs3 = dec_r4type_rs3(inst);
-  // compute
-  rv->F[rd] = rv->F[rs1] * rv->F[rs2] - rv->F[rs3];
-  // step over instruction
-  rv->PC += 4;
-  return true;
+  return op_fma(rv, inst, false, true);
 }
 
 static bool op_nmsub(struct riscv_t *rv, uint32_t inst) {
-  const uint32_t rd  = dec_rd(inst);
-  const uint32_t rm  = dec_funct3(inst);      // todo
-  const uint32_t rs1 = dec_rs1(inst);
-  const uint32_t rs2 = dec_rs2(inst);
-  const uint32_t fmt = dec_r4type_fmt(inst);  // unused
-  const uint32_t rs3 = dec_r4type_rs3(inst);
-  // compute
-  rv->F[rd] = rv->F[rs3] - (rv->F[rs1] * rv->F[rs2]);
-  // step over instruction
-  rv->PC += 4;
-  return true;
+  return op_fma(rv, inst, true, false);
 }
 
 static bool op_nmadd(struct riscv_t *rv, uint32_t inst) {
-  const uint32_t rd  = dec_rd(inst);
-  const uint32_t rm  = dec_funct3(inst);      // todo
-  const uint32_t rs1 = dec_rs1(inst);
-  const uint32_t rs2 = dec_rs2(inst);
-  const uint32_t fmt = dec_r4type_fmt(inst);  // unused
-  const uint32_t rs3 = dec_r4type_rs3(inst);
-  // compute
-  rv->F[rd] = -(rv->F[rs1] * rv->F[rs2]) - rv->F[rs3];
-  // step over instruction
-  rv->PC += 4;
-  return true;
+  return op_fma(rv, inst, true, true);
 }
 #else
 #define op_load_fp  NULL
@@ -850,44 +1155,929 @@ static const opcode_t opcodes[] = {
 //  000        001          010       011          100        101       110   111
     op_load,   op_load_fp,  NULL,     op_misc_mem, op_op_imm, op_auipc, NULL, NULL, // 00
     op_store,  op_store_fp, NULL,     op_amo,      op_op,     op_lui,   NULL, NULL, // 01
-    op_madd,   op_msub,     op_nmsub, op_nmadd,    op_fp,     NULL,     NULL, NULL, // 10
+    op_madd,   op_msub,     op_nmsub, op_nmadd,    op_fp,     op_v,     NULL, NULL, // 10
     op_branch, op_jalr,     NULL,     op_jal,      op_system, NULL,     NULL, NULL, // 11
 };
 
+bool interp_step_inst(struct riscv_t *rv, uint32_t inst) {
+  const opcode_t op = opcodes[(inst & INST_6_2) >> 2];
+  assert(op);
+  return op(rv, inst);
+}
+
+// execute a single instruction without the decoded block cache
+static void step_one(struct riscv_t *rv) {
+  // fetch the next instruction
+  const uint32_t inst = inst_expand(rv->io.mem_ifetch(rv, rv->PC));
+  if (!inst) {
+    rv_except_illegal_inst(rv);
+    return;
+  }
+  const uint32_t index = (inst & INST_6_2) >> 2;
+  // dispatch this opcode
+  const opcode_t op = opcodes[index];
+  assert(op);
+  op(rv, inst);
+  // note: branches are counted too so cycles match the decoded blocks
+  rv->csr_cycle++;
+}
+
+// size of the decoded block storage in bytes
+static const uint32_t block_mem_size = 1024 * 1024 * 4;
+
+// number of entries in the block map (must be a power of 2)
+static const uint32_t block_map_size = 1024 * 64;
+
+// this hash function is used when mapping addresses to indexes in the block map
+static uint32_t wang_hash(uint32_t a) {
+  a = (a ^ 61) ^ (a >> 16);
+  a = a + (a << 3);
+  a = a ^ (a >> 4);
+  a = a * 0x27d4eb2d;
+  a = a ^ (a >> 15);
+  return a;
+}
+
+// empty the block storage and block map
+static void cache_clear(struct interp_cache_t *cache) {
+  memset(cache->map, 0, block_map_size * sizeof(struct interp_block_t *));
+  cache->count = 0;
+  cache->head = cache->start;
+  cache->prev = NULL;
+}
+
+// lookup a block in the block map
+static struct interp_block_t *block_find(struct interp_cache_t *cache, uint32_t addr) {
+  const uint32_t mask = block_map_size - 1;
+  for (uint32_t index = wang_hash(addr);; ++index) {
+    struct interp_block_t *block = cache->map[index & mask];
+    if (block == NULL || block->pc_start == addr) {
+      return block;
+    }
+  }
+}
+
+// insert a block into the block map
+static void block_insert(struct interp_cache_t *cache, struct interp_block_t *block) {
+  const uint32_t mask = block_map_size - 1;
+  for (uint32_t index = wang_hash(block->pc_start);; ++index) {
+    if (cache->map[index & mask] == NULL) {
+      cache->map[index & mask] = block;
+      break;
+    }
+  }
+  ++cache->count;
+}
+
+// pairs of instructions to fuse into superinstructions
+static const struct fusion_t fusions[] = {
+#include "fusion.h"
+};
+
+// fuse an instruction with the one that follows if the pair is in the table
+static bool block_fuse(struct interp_inst_t *a, const struct interp_inst_t *b) {
+  const uint32_t fused = fuse_rule(&a->ir, &b->ir);
+  if (!fused) {
+    return false;
+  }
+  for (size_t i = 0; i < sizeof(fusions) / sizeof(fusions[0]); ++i) {
+    const struct fusion_t *f = fusions + i;
+    if (f->first != a->ir.opcode || f->second != b->ir.opcode || f->fused != fused) {
+      continue;
+    }
+    // fold whatever is known when decoding into the immediate
+    switch (fused) {
+    case rv_fuse_li:
+      a->ir.imm += b->ir.imm;
+      break;
+    case rv_fuse_la:
+      a->ir.imm = a->pc + a->ir.imm + b->ir.imm;
+      break;
+    case rv_fuse_call:
+      a->ir.imm = a->pc + a->ir.imm;
+      break;
+    }
+    a->ir.opcode = fused;
+    return true;
+  }
+  return false;
+}
+
+// decode a basic block starting at the current PC, returning NULL if its first
+// instruction is not one the decoder knows about
+static struct interp_block_t *block_decode(struct riscv_t *rv) {
+  struct interp_cache_t *cache = rv->interp;
+  // size of the largest block, including its closing jal
+  const size_t max_size = sizeof(struct interp_block_t) +
+                          sizeof(struct interp_inst_t) * (BLOCK_MAX_INSTS + 1);
+  // keep the map at most half full so probe sequences stay short
+  if (cache->head + max_size > cache->end || (cache->count + 1) * 2 > block_map_size) {
+    cache_clear(cache);
+  }
+  struct interp_block_t *block = (struct interp_block_t *)cache->head;
+  block->pc_start = rv->PC;
+  block->pc_end = rv->PC;
+  block->flush = false;
+  block->predict[0] = NULL;
+  block->predict[1] = NULL;
+  // decode until a branch
+  uint32_t count = 0;
+  while (count < BLOCK_MAX_INSTS) {
+    struct interp_inst_t *bi = block->insts + count;
+    // fetch the next instruction
+    bi->pc = block->pc_end;
+    bi->inst = inst_expand(rv->io.mem_ifetch(rv, bi->pc));
+    // stop before anything the decoder doesnt know (i.e. mret)
+    if (!decode(bi->inst, &bi->ir, &block->pc_end)) {
+      break;
+    }
+    ++count;
+    // stop on branch
+    if (inst_is_branch(&bi->ir)) {
+      break;
+    }
+    // code after a fence.i may have been modified
+    if (bi->ir.opcode == rv_inst_fencei) {
+      block->flush = true;
+      break;
+    }
+  }
+  if (count == 0) {
+    return NULL;
+  }
+  block->instructions = count;
+  // close the block with a jal to the instruction that follows
+  if (!inst_is_branch(&block->insts[count - 1].ir)) {
+    struct interp_inst_t *bi = block->insts + count++;
+    bi->pc = block->pc_end;
+    bi->inst = 0x6f;  // jal zero, 0
+    bi->ir.opcode = rv_inst_jal;
+    bi->ir.rd = rv_reg_zero;
+    bi->ir.imm = 0;
+  }
+  // fuse pairs of guest instructions into superinstructions
+  for (uint32_t i = 0; i + 1 < block->instructions; ++i) {
+    struct interp_inst_t *bi = block->insts + i;
+    if (block_fuse(bi, bi + 1)) {
+      ++cache->fused_decoded[bi->ir.opcode - rv_fuse_li];
+      ++i;
+    }
+  }
+  // specialise the handlers for the tail call interpreter
+  if (rv->interp_type == rv_interp_tail_call) {
+    for (uint32_t i = 0; i < count; ++i) {
+      block->insts[i].handler = tail_handler(block->insts + i);
+    }
+  }
+  cache->head = (uint8_t *)(block->insts + count);
+  block_insert(cache, block);
+  return block;
+}
+
+// lookup the block for the current PC decoding it if needed
+static struct interp_block_t *block_find_or_decode(struct riscv_t *rv) {
+  struct interp_cache_t *cache = rv->interp;
+  struct interp_block_t *prev = cache->prev;
+  // try to predict the next block from the last one
+  struct interp_block_t **predict = NULL;
+  if (prev) {
+    predict = &prev->predict[rv->PC == prev->pc_end];
+    if (*predict && (*predict)->pc_start == rv->PC) {
+      return *predict;
+    }
+  }
+  struct interp_block_t *next = block_find(cache, rv->PC);
+  if (!next) {
+    next = block_decode(rv);
+    // decoding may have emptied the cache
+    if (!cache->prev) {
+      return next;
+    }
+  }
+  if (predict) {
+    *predict = next;
+  }
+  return next;
+}
+
+// run a decoded block until it branches or raises an exception
+// note: each instruction is dispatched from its opcode with a computed goto
+//       where supported so every handler has its own indirect branch.
+static void block_run(struct riscv_t *rv, const struct interp_block_t *block) {
+  const struct interp_inst_t *bi = block->insts;
+  // instructions which have been added to csr_cycle
+  const struct interp_inst_t *retired = block->insts;
+  uint32_t *X = rv->X;
+  uint8_t **pages = rv->jit.page_table;
+
+#if RISCV_INTERP_COMPUTED_GOTO
+#define OP(op)         inst_##op:
+#define FUSED(op)      inst_fuse_##op:
+#define OP_DEFAULT()   inst_default:
+#define DISPATCH()     goto *dispatch[bi->ir.opcode]
+  static const void *const dispatch[] = {
+    // RV32I
+    [rv_inst_lui]      = &&inst_lui,
+    [rv_inst_auipc]    = &&inst_auipc,
+    [rv_inst_jal]      = &&inst_jal,
+    [rv_inst_jalr]     = &&inst_jalr,
+    [rv_inst_beq]      = &&inst_beq,
+    [rv_inst_bne]      = &&inst_bne,
+    [rv_inst_blt]      = &&inst_blt,
+    [rv_inst_bge]      = &&inst_bge,
+    [rv_inst_bltu]     = &&inst_bltu,
+    [rv_inst_bgeu]     = &&inst_bgeu,
+    [rv_inst_lb]       = &&inst_lb,
+    [rv_inst_lh]       = &&inst_lh,
+    [rv_inst_lw]       = &&inst_lw,
+    [rv_inst_lbu]      = &&inst_lbu,
+    [rv_inst_lhu]      = &&inst_lhu,
+    [rv_inst_sb]       = &&inst_sb,
+    [rv_inst_sh]       = &&inst_sh,
+    [rv_inst_sw]       = &&inst_sw,
+    [rv_inst_addi]     = &&inst_addi,
+    [rv_inst_slti]     = &&inst_slti,
+    [rv_inst_sltiu]    = &&inst_sltiu,
+    [rv_inst_xori]     = &&inst_xori,
+    [rv_inst_ori]      = &&inst_ori,
+    [rv_inst_andi]     = &&inst_andi,
+    [rv_inst_slli]     = &&inst_slli,
+    [rv_inst_srli]     = &&inst_srli,
+    [rv_inst_srai]     = &&inst_srai,
+    [rv_inst_add]      = &&inst_add,
+    [rv_inst_sub]      = &&inst_sub,
+    [rv_inst_sll]      = &&inst_sll,
+    [rv_inst_slt]      = &&inst_slt,
+    [rv_inst_sltu]     = &&inst_sltu,
+    [rv_inst_xor]      = &&inst_xor,
+    [rv_inst_srl]      = &&inst_srl,
+    [rv_inst_sra]      = &&inst_sra,
+    [rv_inst_or]       = &&inst_or,
+    [rv_inst_and]      = &&inst_and,
+    [rv_inst_fence]    = &&inst_fence,
+    [rv_inst_ecall]    = &&inst_ecall,
+    [rv_inst_ebreak]   = &&inst_ebreak,
+    // RV32M
+    [rv_inst_mul]      = &&inst_mul,
+    [rv_inst_mulh]     = &&inst_mulh,
+    [rv_inst_mulhsu]   = &&inst_mulhsu,
+    [rv_inst_mulhu]    = &&inst_mulhu,
+    [rv_inst_div]      = &&inst_div,
+    [rv_inst_divu]     = &&inst_divu,
+    [rv_inst_rem]      = &&inst_rem,
+    [rv_inst_remu]     = &&inst_remu,
+    // RV32F
+#if RISCV_VM_SUPPORT_RV32F
+    [rv_inst_flw]      = &&inst_flw,
+    [rv_inst_fsw]      = &&inst_fsw,
+    [rv_inst_fadds]    = &&inst_fadds,
+    [rv_inst_fsubs]    = &&inst_fsubs,
+    [rv_inst_fmuls]    = &&inst_fmuls,
+    [rv_inst_fdivs]    = &&inst_fdivs,
+#else
+    [rv_inst_flw]      = &&inst_default,
+    [rv_inst_fsw]      = &&inst_default,
+    [rv_inst_fadds]    = &&inst_default,
+    [rv_inst_fsubs]    = &&inst_default,
+    [rv_inst_fmuls]    = &&inst_default,
+    [rv_inst_fdivs]    = &&inst_default,
+#endif
+    [rv_inst_fmadds]   = &&inst_default,
+    [rv_inst_fmsubs]   = &&inst_default,
+    [rv_inst_fnmsubs]  = &&inst_default,
+    [rv_inst_fnmadds]  = &&inst_default,
+    [rv_inst_fsqrts]   = &&inst_default,
+    [rv_inst_fsgnjs]   = &&inst_default,
+    [rv_inst_fsgnjns]  = &&inst_default,
+    [rv_inst_fsgnjxs]  = &&inst_default,
+    [rv_inst_fmins]    = &&inst_default,
+    [rv_inst_fmaxs]    = &&inst_default,
+    [rv_inst_fcvtws]   = &&inst_default,
+    [rv_inst_fcvtwus]  = &&inst_default,
+    [rv_inst_fmvxw]    = &&inst_default,
+    [rv_inst_feqs]     = &&inst_default,
+    [rv_inst_flts]     = &&inst_default,
+    [rv_inst_fles]     = &&inst_default,
+    [rv_inst_fclasss]  = &&inst_default,
+    [rv_inst_fcvtsw]   = &&inst_default,
+    [rv_inst_fcvtswu]  = &&inst_default,
+    [rv_inst_fmvwx]    = &&inst_default,
+    // RV32D
+#if RISCV_VM_SUPPORT_RV32D
+    [rv_inst_fld]      = &&inst_fld,
+    [rv_inst_fsd]      = &&inst_fsd,
+    [rv_inst_faddd]    = &&inst_faddd,
+    [rv_inst_fsubd]    = &&inst_fsubd,
+    [rv_inst_fmuld]    = &&inst_fmuld,
+    [rv_inst_fdivd]    = &&inst_fdivd,
+#else
+    [rv_inst_fld]      = &&inst_default,
+    [rv_inst_fsd]      = &&inst_default,
+    [rv_inst_faddd]    = &&inst_default,
+    [rv_inst_fsubd]    = &&inst_default,
+    [rv_inst_fmuld]    = &&inst_default,
+    [rv_inst_fdivd]    = &&inst_default,
+#endif
+    [rv_inst_fmaddd]   = &&inst_default,
+    [rv_inst_fmsubd]   = &&inst_default,
+    [rv_inst_fnmsubd]  = &&inst_default,
+    [rv_inst_fnmaddd]  = &&inst_default,
+    [rv_inst_fsqrtd]   = &&inst_default,
+    [rv_inst_fsgnjd]   = &&inst_default,
+    [rv_inst_fsgnjnd]  = &&inst_default,
+    [rv_inst_fsgnjxd]  = &&inst_default,
+    [rv_inst_fmind]    = &&inst_default,
+    [rv_inst_fmaxd]    = &&inst_default,
+    [rv_inst_fcvtsd]   = &&inst_default,
+    [rv_inst_fcvtds]   = &&inst_default,
+    [rv_inst_feqd]     = &&inst_default,
+    [rv_inst_fltd]     = &&inst_default,
+    [rv_inst_fled]     = &&inst_default,
+    [rv_inst_fclassd]  = &&inst_default,
+    [rv_inst_fcvtwd]   = &&inst_default,
+    [rv_inst_fcvtwud]  = &&inst_default,
+    [rv_inst_fcvtdw]   = &&inst_default,
+    [rv_inst_fcvtdwu]  = &&inst_default,
+    // RV32 Zicsr
+    [rv_inst_csrrw]    = &&inst_default,
+    [rv_inst_csrrs]    = &&inst_default,
+    [rv_inst_csrrc]    = &&inst_default,
+    [rv_inst_csrrwi]   = &&inst_default,
+    [rv_inst_csrrsi]   = &&inst_default,
+    [rv_inst_csrrci]   = &&inst_default,
+    // RV32 Zifencei
+    [rv_inst_fencei]   = &&inst_fencei,
+    // RV32A
+    [rv_inst_lrw]      = &&inst_default,
+    [rv_inst_scw]      = &&inst_default,
+    [rv_inst_amoswapw] = &&inst_default,
+    [rv_inst_amoaddw]  = &&inst_default,
+    [rv_inst_amoxorw]  = &&inst_default,
+    [rv_inst_amoandw]  = &&inst_default,
+    [rv_inst_amoorw]   = &&inst_default,
+    [rv_inst_amominw]  = &&inst_default,
+    [rv_inst_amomaxw]  = &&inst_default,
+    [rv_inst_amominuw] = &&inst_default,
+    [rv_inst_amomaxuw] = &&inst_default,
+    // RV32 Zba
+    [rv_inst_sh1add]   = &&inst_sh1add,
+    [rv_inst_sh2add]   = &&inst_sh2add,
+    [rv_inst_sh3add]   = &&inst_sh3add,
+    // RV32 Zbb
+    [rv_inst_andn]     = &&inst_andn,
+    [rv_inst_orn]      = &&inst_orn,
+    [rv_inst_xnor]     = &&inst_xnor,
+    [rv_inst_clz]      = &&inst_clz,
+    [rv_inst_ctz]      = &&inst_ctz,
+    [rv_inst_cpop]     = &&inst_cpop,
+    [rv_inst_max]      = &&inst_max,
+    [rv_inst_maxu]     = &&inst_maxu,
+    [rv_inst_min]      = &&inst_min,
+    [rv_inst_minu]     = &&inst_minu,
+    [rv_inst_sextb]    = &&inst_sextb,
+    [rv_inst_sexth]    = &&inst_sexth,
+    [rv_inst_zexth]    = &&inst_zexth,
+    [rv_inst_rol]      = &&inst_rol,
+    [rv_inst_ror]      = &&inst_ror,
+    [rv_inst_rori]     = &&inst_rori,
+    [rv_inst_orcb]     = &&inst_orcb,
+    [rv_inst_rev8]     = &&inst_rev8,
+    // RV32 Zbs
+    [rv_inst_bclr]     = &&inst_bclr,
+    [rv_inst_bclri]    = &&inst_bclri,
+    [rv_inst_bext]     = &&inst_bext,
+    [rv_inst_bexti]    = &&inst_bexti,
+    [rv_inst_binv]     = &&inst_binv,
+    [rv_inst_binvi]    = &&inst_binvi,
+    [rv_inst_bset]     = &&inst_bset,
+    [rv_inst_bseti]    = &&inst_bseti,
+    // RVV
+    [rv_inst_vsetvli]  = &&inst_default,
+    [rv_inst_vsetivli] = &&inst_default,
+    [rv_inst_vsetvl]   = &&inst_default,
+    [rv_inst_vle]      = &&inst_default,
+    [rv_inst_vlse]     = &&inst_default,
+    [rv_inst_vlxei]    = &&inst_default,
+    [rv_inst_vse]      = &&inst_default,
+    [rv_inst_vsse]     = &&inst_default,
+    [rv_inst_vsxei]    = &&inst_default,
+    [rv_inst_vopivv]   = &&inst_default,
+    [rv_inst_vopfvv]   = &&inst_default,
+    [rv_inst_vopmvv]   = &&inst_default,
+    [rv_inst_vopivi]   = &&inst_default,
+    [rv_inst_vopivx]   = &&inst_default,
+    [rv_inst_vopfvf]   = &&inst_default,
+    [rv_inst_vopmvx]   = &&inst_default,
+    // superinstructions
+    [rv_fuse_li]           = &&inst_fuse_li,
+    [rv_fuse_la]           = &&inst_fuse_la,
+    [rv_fuse_call]         = &&inst_fuse_call,
+    [rv_fuse_index]        = &&inst_fuse_index,
+    [rv_fuse_slt_branch]   = &&inst_fuse_slt_branch,
+    [rv_fuse_sltu_branch]  = &&inst_fuse_sltu_branch,
+    [rv_fuse_slti_branch]  = &&inst_fuse_slti_branch,
+    [rv_fuse_sltiu_branch] = &&inst_fuse_sltiu_branch,
+  };
+  DISPATCH();
+#else
+#define OP(op)         case rv_inst_##op:
+#define FUSED(op)      case rv_fuse_##op:
+#define OP_DEFAULT()   default:
+#define DISPATCH()     goto dispatch
+dispatch:
+  switch (bi->ir.opcode) {
+#endif
+
+// move onto the next instruction, enforcing the zero register
+#define NEXT()         do { X[rv_reg_zero] = 0; ++bi; DISPATCH(); } while (0)
+// leave the block after its last instruction
+#define EXIT()         goto block_exit
+// leave the block after an instruction raised an exception
+#define TRAP()         goto block_trap
+// bring csr_cycle up to date before an instruction which may read it
+#define SYNC_CYCLES()  do { rv->csr_cycle += bi - retired; retired = bi; } while (0)
+
+  // jumps and branches
+  OP(jal)
+    X[bi->ir.rd] = bi->pc + inst_length(bi->inst);
+    rv->PC = bi->pc + bi->ir.imm;
+    if (rv->PC & PC_ALIGN_MASK) {
+      rv_except_inst_misaligned(rv, bi->pc);
+    }
+    EXIT();
+  OP(jalr) {
+    const uint32_t target = (X[bi->ir.rs1] + bi->ir.imm) & ~1u;
+    X[bi->ir.rd] = bi->pc + inst_length(bi->inst);
+    rv->PC = target;
+    if (rv->PC & PC_ALIGN_MASK) {
+      rv_except_inst_misaligned(rv, bi->pc);
+    }
+    EXIT();
+  }
+#define BRANCH(cond)                                                          \
+    rv->PC = bi->pc + ((cond) ? bi->ir.imm : (int32_t)inst_length(bi->inst)); \
+    if (rv->PC & PC_ALIGN_MASK) {                                             \
+      rv_except_inst_misaligned(rv, bi->pc);                                  \
+    }                                                                         \
+    EXIT();
+  OP(beq)  BRANCH(X[bi->ir.rs1] == X[bi->ir.rs2])
+  OP(bne)  BRANCH(X[bi->ir.rs1] != X[bi->ir.rs2])
+  OP(blt)  BRANCH((int32_t)X[bi->ir.rs1] <  (int32_t)X[bi->ir.rs2])
+  OP(bge)  BRANCH((int32_t)X[bi->ir.rs1] >= (int32_t)X[bi->ir.rs2])
+  OP(bltu) BRANCH(X[bi->ir.rs1] <  X[bi->ir.rs2])
+  OP(bgeu) BRANCH(X[bi->ir.rs1] >= X[bi->ir.rs2])
+#undef BRANCH
+
+  // loads and stores, accessing host mapped pages directly
+#define ADDR()   (X[bi->ir.rs1] + bi->ir.imm)
+#define CHECK_ALIGN(addr, mask, except)              \
+    if ((addr) & (mask)) {                           \
+      rv->PC = bi->pc;                               \
+      except(rv, addr);                              \
+      TRAP();                                        \
+    }
+#define LOAD(type, addr, read)                       \
+    uint8_t *ptr = host_addr(pages, addr);           \
+    type data;                                       \
+    if (ptr) {                                       \
+      memcpy(&data, ptr, sizeof(data));              \
+    }                                                \
+    else {                                           \
+      data = (type)rv->io.read(rv, addr);            \
+    }
+#define STORE(type, addr, write)                     \
+    uint8_t *ptr = host_addr(pages, addr);           \
+    const type data = (type)X[bi->ir.rs2];           \
+    if (ptr) {                                       \
+      memcpy(ptr, &data, sizeof(data));              \
+    }                                                \
+    else {                                           \
+      rv->io.write(rv, addr, data);                  \
+    }
+  OP(lb) {
+    const uint32_t addr = ADDR();
+    LOAD(uint8_t, addr, mem_read_b);
+    X[bi->ir.rd] = sign_extend_b(data);
+    NEXT();
+  }
+  OP(lh) {
+    const uint32_t addr = ADDR();
+    CHECK_ALIGN(addr, 1, rv_except_load_misaligned);
+    LOAD(uint16_t, addr, mem_read_s);
+    X[bi->ir.rd] = sign_extend_h(data);
+    NEXT();
+  }
+  OP(lw) {
+    const uint32_t addr = ADDR();
+    CHECK_ALIGN(addr, 3, rv_except_load_misaligned);
+    LOAD(uint32_t, addr, mem_read_w);
+    X[bi->ir.rd] = data;
+    NEXT();
+  }
+  OP(lbu) {
+    const uint32_t addr = ADDR();
+    LOAD(uint8_t, addr, mem_read_b);
+    X[bi->ir.rd] = data;
+    NEXT();
+  }
+  OP(lhu) {
+    const uint32_t addr = ADDR();
+    CHECK_ALIGN(addr, 1, rv_except_load_misaligned);
+    LOAD(uint16_t, addr, mem_read_s);
+    X[bi->ir.rd] = data;
+    NEXT();
+  }
+  OP(sb) {
+    const uint32_t addr = ADDR();
+    STORE(uint8_t, addr, mem_write_b);
+    NEXT();
+  }
+  OP(sh) {
+    const uint32_t addr = ADDR();
+    CHECK_ALIGN(addr, 1, rv_except_store_misaligned);
+    STORE(uint16_t, addr, mem_write_s);
+    NEXT();
+  }
+  OP(sw) {
+    const uint32_t addr = ADDR();
+    CHECK_ALIGN(addr, 3, rv_except_store_misaligned);
+    STORE(uint32_t, addr, mem_write_w);
+    NEXT();
+  }
+#if RISCV_VM_SUPPORT_RV32F
+  OP(flw) {
+    const uint32_t addr = ADDR();
+    LOAD(uint32_t, addr, mem_read_w);
+    fp_write_w(rv, bi->ir.rd, data);
+    NEXT();
+  }
+  OP(fsw) {
+    const uint32_t addr = ADDR();
+    uint8_t *ptr = host_addr(pages, addr);
+    if (ptr) {
+      memcpy(ptr, &rv->F[bi->ir.rs2].f, 4);
+    }
+    else {
+      rv->io.mem_write_w(rv, addr, (uint32_t)rv->F[bi->ir.rs2].bits);
+    }
+    NEXT();
+  }
+#endif  // RISCV_VM_SUPPORT_RV32F
+#if RISCV_VM_SUPPORT_RV32D
+  // note: only aligned doubles are accessed directly, as they can't cross into
+  //       the next page
+  OP(fld) {
+    const uint32_t addr = ADDR();
+    uint8_t *ptr = (addr & 7) ? NULL : host_addr(pages, addr);
+    if (ptr) {
+      memcpy(&rv->F[bi->ir.rd].bits, ptr, 8);
+    }
+    else {
+      rv->F[bi->ir.rd].bits = fp_read_d(rv, addr);
+    }
+    NEXT();
+  }
+  OP(fsd) {
+    const uint32_t addr = ADDR();
+    uint8_t *ptr = (addr & 7) ? NULL : host_addr(pages, addr);
+    if (ptr) {
+      memcpy(ptr, &rv->F[bi->ir.rs2].bits, 8);
+    }
+    else {
+      fp_write_d(rv, addr, rv->F[bi->ir.rs2].bits);
+    }
+    NEXT();
+  }
+#endif  // RISCV_VM_SUPPORT_RV32D
+#undef STORE
+#undef LOAD
+#undef CHECK_ALIGN
+#undef ADDR
+
+  // register immediate and register register operations
+#define RS1      X[bi->ir.rs1]
+#define RS2      X[bi->ir.rs2]
+#define IMM      ((uint32_t)bi->ir.imm)
+#define ALU(op, expr)  OP(op) X[bi->ir.rd] = (expr); NEXT();
+  ALU(lui,   IMM)
+  ALU(auipc, bi->pc + IMM)
+  ALU(addi,  RS1 + IMM)
+  ALU(slti,  ((int32_t)RS1 < bi->ir.imm) ? 1 : 0)
+  ALU(sltiu, (RS1 < IMM) ? 1 : 0)
+  ALU(xori,  RS1 ^ IMM)
+  ALU(ori,   RS1 | IMM)
+  ALU(andi,  RS1 & IMM)
+  ALU(slli,  RS1 << (IMM & 0x1f))
+  ALU(srli,  RS1 >> (IMM & 0x1f))
+  ALU(srai,  (uint32_t)((int32_t)RS1 >> (IMM & 0x1f)))
+  ALU(add,   RS1 + RS2)
+  ALU(sub,   RS1 - RS2)
+  ALU(sll,   RS1 << (RS2 & 0x1f))
+  ALU(slt,   ((int32_t)RS1 < (int32_t)RS2) ? 1 : 0)
+  ALU(sltu,  (RS1 < RS2) ? 1 : 0)
+  ALU(xor,   RS1 ^ RS2)
+  ALU(srl,   RS1 >> (RS2 & 0x1f))
+  ALU(sra,   (uint32_t)((int32_t)RS1 >> (RS2 & 0x1f)))
+  ALU(or,    RS1 | RS2)
+  ALU(and,   RS1 & RS2)
+  // note: only decoded with RV32M support
+  ALU(mul,    RS1 * RS2)
+  ALU(mulh,   (uint32_t)(((int64_t)(int32_t)RS1 * (int64_t)(int32_t)RS2) >> 32))
+  ALU(mulhsu, (uint32_t)(((int64_t)(int32_t)RS1 * (int64_t)(uint64_t)RS2) >> 32))
+  ALU(mulhu,  (uint32_t)(((uint64_t)RS1 * (uint64_t)RS2) >> 32))
+  ALU(div,    (RS2 == 0) ? ~0u :
+              (RS2 == ~0u && RS1 == 0x80000000u) ? RS1 :
+              (uint32_t)((int32_t)RS1 / (int32_t)RS2))
+  ALU(divu,   (RS2 == 0) ? ~0u : RS1 / RS2)
+  ALU(rem,    (RS2 == 0) ? RS1 :
+              (RS2 == ~0u && RS1 == 0x80000000u) ? 0 :
+              (uint32_t)((int32_t)RS1 % (int32_t)RS2))
+  ALU(remu,   (RS2 == 0) ? RS1 : RS1 % RS2)
+  // note: only decoded with Zba, Zbb and Zbs support
+  ALU(sh1add, (RS1 << 1) + RS2)
+  ALU(sh2add, (RS1 << 2) + RS2)
+  ALU(sh3add, (RS1 << 3) + RS2)
+  ALU(andn,   RS1 & ~RS2)
+  ALU(orn,    RS1 | ~RS2)
+  ALU(xnor,   ~(RS1 ^ RS2))
+  ALU(clz,    calc_clz(RS1))
+  ALU(ctz,    calc_ctz(RS1))
+  ALU(cpop,   calc_cpop(RS1))
+  ALU(max,    ((int32_t)RS1 > (int32_t)RS2) ? RS1 : RS2)
+  ALU(maxu,   (RS1 > RS2) ? RS1 : RS2)
+  ALU(min,    ((int32_t)RS1 < (int32_t)RS2) ? RS1 : RS2)
+  ALU(minu,   (RS1 < RS2) ? RS1 : RS2)
+  ALU(sextb,  sign_extend_b(RS1))
+  ALU(sexth,  sign_extend_h(RS1))
+  ALU(zexth,  RS1 & 0xffff)
+  ALU(rol,    calc_rol(RS1, RS2))
+  ALU(ror,    calc_ror(RS1, RS2))
+  ALU(rori,   calc_ror(RS1, IMM))
+  ALU(orcb,   calc_orcb(RS1))
+  ALU(rev8,   calc_rev8(RS1))
+  ALU(bclr,   RS1 & ~(1u << (RS2 & 0x1f)))
+  ALU(bclri,  RS1 & ~(1u << (IMM & 0x1f)))
+  ALU(bext,   (RS1 >> (RS2 & 0x1f)) & 1)
+  ALU(bexti,  (RS1 >> (IMM & 0x1f)) & 1)
+  ALU(binv,   RS1 ^ (1u << (RS2 & 0x1f)))
+  ALU(binvi,  RS1 ^ (1u << (IMM & 0x1f)))
+  ALU(bset,   RS1 | (1u << (RS2 & 0x1f)))
+  ALU(bseti,  RS1 | (1u << (IMM & 0x1f)))
+#undef ALU
+#undef IMM
+#undef RS2
+#undef RS1
+
+#if RISCV_VM_SUPPORT_RV32F
+  // common float arithmetic, with ties to max magnitude fixed up by rmm_op
+#define FPU(op, rmm_op, expr)                              \
+  OP(op) {                                                 \
+    const int round = fp_round_begin(bi->ir.rm);           \
+    const float a = rv->F[bi->ir.rs1].f;                   \
+    const float b = rv->F[bi->ir.rs2].f;                   \
+    float r = (expr);                                      \
+    if (fp_is_rmm(rv, bi->ir.rm)) {                        \
+      r = fp_rmm(rmm_op, r, a, b, 0.);                     \
+    }                                                      \
+    fp_write_s(rv, bi->ir.rd, fp_canonical(r));            \
+    fp_round_end(round);                                   \
+    NEXT();                                                \
+  }
+  FPU(fadds, FP_RMM_ADD, a + b)
+  FPU(fsubs, FP_RMM_SUB, a - b)
+  FPU(fmuls, FP_RMM_MUL, a * b)
+  FPU(fdivs, FP_RMM_DIV, a / b)
+#undef FPU
+#endif  // RISCV_VM_SUPPORT_RV32F
+
+#if RISCV_VM_SUPPORT_RV32D
+#define FPU(op, rmm_op, expr)                              \
+  OP(op) {                                                 \
+    const int round = fp_round_begin(bi->ir.rm);           \
+    const double a = rv->F[bi->ir.rs1].d;                  \
+    const double b = rv->F[bi->ir.rs2].d;                  \
+    double r = (expr);                                     \
+    if (fp_is_rmm(rv, bi->ir.rm)) {                        \
+      r = fp_rmm_d(rmm_op, r, a, b, 0.);                   \
+    }                                                      \
+    rv->F[bi->ir.rd].d = fp_canonical_d(r);                \
+    fp_round_end(round);                                   \
+    NEXT();                                                \
+  }
+  FPU(faddd, FP_RMM_ADD, a + b)
+  FPU(fsubd, FP_RMM_SUB, a - b)
+  FPU(fmuld, FP_RMM_MUL, a * b)
+  FPU(fdivd, FP_RMM_DIV, a / b)
+#undef FPU
+#endif  // RISCV_VM_SUPPORT_RV32D
+
+  // system instructions
+  OP(fence)
+    NEXT();
+  OP(fencei)
+    // the cache is emptied once the block has finished
+    rv->PC = bi->pc + inst_length(bi->inst);
+    EXIT();
+  OP(ecall)
+    // step over first so the handler sees the return address
+    rv->PC = bi->pc + inst_length(bi->inst);
+    SYNC_CYCLES();
+    rv->io.on_ecall(rv);
+    EXIT();
+  OP(ebreak)
+    rv->PC = bi->pc;
+    SYNC_CYCLES();
+    rv->io.on_ebreak(rv);
+    rv->PC += inst_length(bi->inst);
+    EXIT();
+
+  // superinstructions, which skip over the second instruction of their pair
+#if RISCV_INTERP_PROFILE
+#define FUSED_HIT()  ++rv->interp->fused_hits[bi->ir.opcode - rv_fuse_li]
+#else
+#define FUSED_HIT()
+#endif
+  FUSED(li)
+  FUSED(la)
+    FUSED_HIT();
+    X[bi->ir.rd] = bi->ir.imm;
+    ++bi;
+    NEXT();
+  FUSED(call) {
+    // the auipc result was folded into the immediate
+    const struct interp_inst_t *jalr = bi + 1;
+    FUSED_HIT();
+    X[bi->ir.rd] = bi->ir.imm;
+    X[jalr->ir.rd] = jalr->pc + inst_length(jalr->inst);
+    rv->PC = (bi->ir.imm + jalr->ir.imm) & ~1u;
+    if (rv->PC & PC_ALIGN_MASK) {
+      rv_except_inst_misaligned(rv, jalr->pc);
+    }
+    EXIT();
+  }
+  FUSED(index) {
+    const struct interp_inst_t *add = bi + 1;
+    FUSED_HIT();
+    X[bi->ir.rd] = X[bi->ir.rs1] << (bi->ir.imm & 0x1f);
+    X[add->ir.rd] = X[add->ir.rs1] + X[add->ir.rs2];
+    ++bi;
+    NEXT();
+  }
+#define CMP_BRANCH(cmp) {                                                    \
+    const struct interp_inst_t *br = bi + 1;                                 \
+    const uint32_t value = (cmp) ? 1 : 0;                                    \
+    FUSED_HIT();                                                             \
+    X[bi->ir.rd] = value;                                                    \
+    const bool taken = value == (br->ir.opcode == rv_inst_bne);              \
+    rv->PC = br->pc + (taken ? br->ir.imm : (int32_t)inst_length(br->inst)); \
+    if (rv->PC & PC_ALIGN_MASK) {                                            \
+      rv_except_inst_misaligned(rv, br->pc);                                 \
+    }                                                                        \
+    EXIT();                                                                  \
+  }
+  FUSED(slt_branch)
+    CMP_BRANCH((int32_t)X[bi->ir.rs1] < (int32_t)X[bi->ir.rs2])
+  FUSED(sltu_branch)
+    CMP_BRANCH(X[bi->ir.rs1] < X[bi->ir.rs2])
+  FUSED(slti_branch)
+    CMP_BRANCH((int32_t)X[bi->ir.rs1] < bi->ir.imm)
+  FUSED(sltiu_branch)
+    CMP_BRANCH(X[bi->ir.rs1] < (uint32_t)bi->ir.imm)
+#undef CMP_BRANCH
+#undef FUSED_HIT
+
+  // everything else is run by the single step handlers
+  OP_DEFAULT() {
+    const opcode_t op = opcodes[(bi->inst & INST_6_2) >> 2];
+    rv->PC = bi->pc;
+    SYNC_CYCLES();
+    // note: these instructions only return false on an exception
+    if (!op(rv, bi->inst)) {
+      TRAP();
+    }
+    NEXT();
+  }
+
+#if !RISCV_INTERP_COMPUTED_GOTO
+  }
+#endif
+
+block_exit:
+  // the closing jal of a block is not a guest instruction
+  rv->csr_cycle += block->instructions - (retired - block->insts);
+  X[rv_reg_zero] = 0;
+  return;
+block_trap:
+  // the faulting instruction does not retire
+  SYNC_CYCLES();
+  X[rv_reg_zero] = 0;
+  return;
+
+#undef SYNC_CYCLES
+#undef TRAP
+#undef EXIT
+#undef NEXT
+#undef DISPATCH
+#undef OP_DEFAULT
+#undef FUSED
+#undef OP
+}
+
 void rv_step(struct riscv_t *rv, int32_t cycles) {
   assert(rv);
 
-  const uint64_t cycles_start = rv->csr_cycle;
   const uint64_t cycles_target = rv->csr_cycle + cycles;
+  struct interp_cache_t *cache = rv->interp;
+#if RISCV_VM_SUPPORT_RV32F
+  const int host_round = fp_enter(rv);
+#endif
 
   while (rv->csr_cycle < cycles_target && !rv->halt) {
 
-    // fetch the next instruction
-    const uint32_t inst = rv->io.mem_ifetch(rv, rv->PC);
-    const uint32_t index = (inst & INST_6_2) >> 2;
-    // dispatch this opcode
-    const opcode_t op = opcodes[index];
-    assert(op);
-    if (!op(rv, inst)) {
-      break;
+    // lookup the next block in the block map or decode a new one
+    struct interp_block_t *block = block_find_or_decode(rv);
+
+    // single step anything the decoder doesnt handle.  like the jit, blocks
+    // run to their end even if it passes the cycle target unless asked to step
+    // fewer instructions than the block holds (i.e. when tracing).
+    if (!block || block->instructions > (uint32_t)cycles) {
+      step_one(rv);
+      cache->prev = NULL;
+      continue;
+    }
+
+    if (rv->interp_type == rv_interp_tail_call) {
+      tail_run(rv, block);
+    }
+    else {
+      block_run(rv, block);
+    }
+    cache->prev = block;
+
+    // code may have been modified
+    if (block->flush) {
+      cache_clear(cache);
     }
-    // increment the cycles csr
-    rv->csr_cycle++;
   }
+#if RISCV_VM_SUPPORT_RV32F
+  fp_leave(rv, host_round);
+#endif
+}
+
+// no jit present so the table is used by the decoded blocks and atomics
+void rv_set_page_table(struct riscv_t *rv, uint8_t **table) {
+  rv->jit.page_table = table;
 }
 
-// stub function as no jit present
-bool rv_jit_init(struct riscv_t *rv) {
+// no jit present so there is no translated code to restrict
+void rv_set_host_baseline(struct riscv_t *rv) {
   (void)rv;
-  return false;
 }
 
-// stub function as no jit present
+// no jit present so allocate the decoded block cache
+bool rv_jit_init(struct riscv_t *rv, struct riscv_t *share) {
+  (void)share;
+  struct interp_cache_t *cache = (struct interp_cache_t *)calloc(1, sizeof(struct interp_cache_t));
+  if (!cache) {
+    return false;
+  }
+  rv->interp = cache;
+  cache->start = (uint8_t *)malloc(block_mem_size);
+  cache->end = cache->start + block_mem_size;
+  cache->map = (struct interp_block_t **)malloc(block_map_size * sizeof(struct interp_block_t *));
+  if (!cache->start || !cache->map) {
+    return false;
+  }
+  cache_clear(cache);
+  return true;
+}
+
+// no jit present so free the decoded block cache
 void rv_jit_free(struct riscv_t *rv) {
-  (void)rv;
+  struct interp_cache_t *cache = rv->interp;
+  if (!cache) {
+    return;
+  }
+  free(cache->start);
+  free(cache->map);
+  free(cache);
+  rv->interp = NULL;
 }
 
-// stub function as no jit present
+// print how often each superinstruction was decoded and run
 void rv_jit_dump_stats(struct riscv_t *rv) {
-  (void)rv;
+  static const char *const names[RV_NUM_FUSED] = {
+    "lui+addi", "auipc+addi", "auipc+jalr", "slli+add",
+    "slt+branch", "sltu+branch", "slti+branch", "sltiu+branch",
+  };
+  const struct interp_cache_t *cache = rv->interp;
+  for (uint32_t i = 0; i < RV_NUM_FUSED; ++i) {
+#if RISCV_INTERP_PROFILE
+    fprintf(stdout, "Fused %-13s %10llu decoded %12llu run\n", names[i],
+      (unsigned long long)cache->fused_decoded[i], (unsigned long long)cache->fused_hits[i]);
+#else
+    fprintf(stdout, "Fused %-13s %10llu decoded\n", names[i],
+      (unsigned long long)cache->fused_decoded[i]);
+#endif
+  }
 }
@@ -83,9 +83,25 @@ struct riscv_io_t {
   riscv_on_ebreak on_ebreak;
 };
 
+// interpreters which can run a core (ignored when the jit is present)
+enum {
+  // pre-decoded blocks dispatched with a computed goto
+  rv_interp_threaded,
+  // pre-decoded instructions chained by tail calls to specialised handlers
+  rv_interp_tail_call,
+};
+
 // create a riscv emulator
 struct riscv_t *rv_create(const struct riscv_io_t *io, riscv_user_t user_data);
 
+// create a riscv emulator run by a specific interpreter
+struct riscv_t *rv_create_interp(const struct riscv_io_t *io, riscv_user_t user_data, uint32_t interp);
+
+// create a riscv emulator which shares translated code (and its interpreter)
+// with an existing one. both must run the same program, may run on different
+// threads and must all either use rv_set_page_table or not.
+struct riscv_t *rv_create_shared(const struct riscv_io_t *io, riscv_user_t user_data, struct riscv_t *share);
+
 // delete a riscv emulator
 void rv_delete(struct riscv_t *);
 
@@ -113,12 +129,28 @@ riscv_word_t rv_get_reg(struct riscv_t *, uint32_t reg);
 // return the cycle counter
 uint64_t rv_get_csr_cycles(struct riscv_t *);
 
+// provide a table of host pointers, one for each 64KB page of the guest address
+// space, which translated code and decoded blocks can access directly.  NULL
+// pages (i.e. MMIO ranges) are still accessed via the io callbacks.
+void rv_set_page_table(struct riscv_t *, uint8_t **table);
+
+// print execution statistics to stdout
+void rv_print_stats(struct riscv_t *);
+
 // halt the core
 void rv_halt(struct riscv_t *);
 
 // return the halt state
 bool rv_has_halted(struct riscv_t *);
 
+// set the hart index reported by the mhartid csr
+void rv_set_hart_id(struct riscv_t *, riscv_word_t id);
+
+// restrict translated code to the baseline x64 instructions (sse2) so the
+// paths taken on older hosts can be tested.  must be called before the core
+// first runs, and does nothing without the jit.
+void rv_set_host_baseline(struct riscv_t *);
+
 #ifdef __cplusplus
 };  // ifdef __cplusplus
 #endif
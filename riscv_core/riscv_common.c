@@ -3,6 +3,12 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
+#include <fenv.h>
+#include <stdint.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 #include "riscv.h"
 #include "riscv_private.h"
@@ -15,7 +21,7 @@ riscv_user_t rv_userdata(struct riscv_t *rv) {
 
 bool rv_set_pc(struct riscv_t *rv, riscv_word_t pc) {
   assert(rv);
-  if (pc & 3) {
+  if (pc & PC_ALIGN_MASK) {
     return false;
   }
   rv->PC = pc;
@@ -113,12 +119,455 @@ void rv_except_illegal_inst(struct riscv_t *rv) {
   assert(!"illegal instruction");
 }
 
+#if RISCV_VM_SUPPORT_RV32F
+// host rounding mode for each rounding mode
+// note: the host has no ties to max magnitude mode so rmm arithmetic rounds
+//       ties to even and is then fixed up by fp_rmm, and the reserved modes
+//       behave as rne
+static const int fp_host_round[8] = {
+  FE_TONEAREST,   // RNE
+  FE_TOWARDZERO,  // RTZ
+  FE_DOWNWARD,    // RDN
+  FE_UPWARD,      // RUP
+  FE_TONEAREST,   // RMM
+  FE_TONEAREST,
+  FE_TONEAREST,
+  FE_TONEAREST,
+};
+
+// host exception for each of the fflags bits
+static const int fp_host_except[5] = {
+  FE_INEXACT,    // NX
+  FE_UNDERFLOW,  // UF
+  FE_OVERFLOW,   // OF
+  FE_DIVBYZERO,  // DZ
+  FE_INVALID,    // NV
+};
+
+// accrue the host exception flags raised by guest code into fflags
+// note: the host flags are left set as accruing them again changes nothing,
+//       which saves clearing them until fflags is cleared
+static void fp_sync_flags(struct riscv_t *rv) {
+  const int except = fetestexcept(FE_ALL_EXCEPT);
+  if (!except) {
+    return;
+  }
+  for (uint32_t i = 0; i < 5; ++i) {
+    rv->csr_fcsr |= (except & fp_host_except[i]) ? (1u << i) : 0;
+  }
+}
+
+// note: entering and leaving happen every few hundred instructions so they
+//       only touch the host state when it differs from the guest state
+int fp_enter(struct riscv_t *rv) {
+  // host flags not already in fflags were raised by the host since fp_leave
+  int host_only = fetestexcept(FE_ALL_EXCEPT);
+  for (uint32_t i = 0; i < 5; ++i) {
+    host_only &= (rv->csr_fcsr & (1u << i)) ? ~fp_host_except[i] : ~0;
+  }
+  if (host_only) {
+    feclearexcept(host_only);
+  }
+  const int host_round = fegetround();
+  const int round = fp_host_round[(rv->csr_fcsr >> 5) & 0b111];
+  if (host_round != round) {
+    fesetround(round);
+  }
+  return host_round;
+}
+
+void fp_leave(struct riscv_t *rv, int host_round) {
+  fp_sync_flags(rv);
+  if (fegetround() != host_round) {
+    fesetround(host_round);
+  }
+}
+
+int fp_round_set(uint32_t rm) {
+  const int round = fegetround();
+  const int target = fp_host_round[rm & 0b111];
+  if (round == target) {
+    return -1;
+  }
+  fesetround(target);
+  return round;
+}
+
+void fp_round_restore(int round) {
+  fesetround(round);
+}
+
+// convert to a 32 bit integer, accruing the invalid or inexact flag
+static uint32_t fp_cvt_w_flags(struct riscv_t *rv, double f, uint32_t rm, bool is_unsigned) {
+  // note: these are exact and independent of the host rounding mode
+  double r;
+  switch (rm) {
+  case RM_RTZ:
+    r = trunc(f);
+    break;
+  case RM_RDN:
+    r = floor(f);
+    break;
+  case RM_RUP:
+    r = ceil(f);
+    break;
+  case RM_RMM:
+    r = round(f);
+    break;
+  default:
+    // large values are already integers
+    r = (fabs(f) < 4503599627370496.) ? f - remainder(f, 1.) : f;
+    break;
+  }
+  // out of range values saturate and nan converts as the largest value, both
+  // being invalid rather than inexact
+  uint32_t out;
+  if (is_unsigned) {
+    if (isnan(r) || r >= 4294967296.) {
+      rv->csr_fcsr |= FFLAG_NV;
+      return UINT32_MAX;
+    }
+    if (r < 0.) {
+      rv->csr_fcsr |= FFLAG_NV;
+      return 0;
+    }
+    out = (uint32_t)r;
+  }
+  else {
+    if (isnan(r) || r >= 2147483648.) {
+      rv->csr_fcsr |= FFLAG_NV;
+      return INT32_MAX;
+    }
+    if (r < -2147483648.) {
+      rv->csr_fcsr |= FFLAG_NV;
+      return (uint32_t)INT32_MIN;
+    }
+    out = (uint32_t)(int32_t)r;
+  }
+  if (r != f) {
+    rv->csr_fcsr |= FFLAG_NX;
+  }
+  return out;
+}
+
+uint32_t fp_cvt_w(struct riscv_t *rv, double f, uint32_t rm, bool is_unsigned) {
+  if (rm == RM_DYN) {
+    rm = (rv->csr_fcsr >> 5) & 0b111;
+  }
+  // the flags are set explicitly so keep any the host raises along the way
+  fexcept_t except;
+  fegetexceptflag(&except, FE_ALL_EXCEPT);
+  const uint32_t out = fp_cvt_w_flags(rv, f, rm, is_unsigned);
+  fesetexceptflag(&except, FE_ALL_EXCEPT);
+  return out;
+}
+
+static bool fp_is_snan(uint32_t bits) {
+  return (bits & FMASK_EXPN) == FMASK_EXPN && (bits & FMASK_FRAC) && !(bits & FMASK_QNAN);
+}
+
+float fp_minmax(struct riscv_t *rv, float a, float b, bool is_max) {
+  uint32_t x, y;
+  memcpy(&x, &a, sizeof(x));
+  memcpy(&y, &b, sizeof(y));
+  if (fp_is_snan(x) || fp_is_snan(y)) {
+    rv->csr_fcsr |= FFLAG_NV;
+  }
+  // a nan operand yields the other operand, and two nans the canonical nan
+  if (isnan(a)) {
+    return fp_canonical(b);
+  }
+  if (isnan(b)) {
+    return a;
+  }
+  if (a == b) {
+    // only differ when they are zeros of opposite sign, where -0 < +0
+    const uint32_t bits = is_max ? (x & y) : (x | y);
+    float out;
+    memcpy(&out, &bits, sizeof(out));
+    return out;
+  }
+  return ((a < b) != is_max) ? a : b;
+}
+
+float fp_fma(struct riscv_t *rv, float a, float b, float c) {
+  // infinity times zero is invalid even when the addend is a quiet nan,
+  // which the host does not flag
+  if (isnan(c) && ((isinf(a) && b == 0.f) || (a == 0.f && isinf(b)))) {
+    rv->csr_fcsr |= FFLAG_NV;
+  }
+  return fp_canonical(fmaf(a, b, c));
+}
+
+// a finite value, exactly sign * (hi:lo) * 2^exp, where bit 0 of lo also
+// stands for any nonzero bits shifted out below it
+struct fp_exact_t {
+  bool sign;
+  int32_t exp;
+  uint64_t hi;
+  uint64_t lo;
+};
+
+static uint32_t fp_clz64(uint64_t x) {
+  return (x >> 32) ? calc_clz((uint32_t)(x >> 32)) : 32 + calc_clz((uint32_t)x);
+}
+
+static bool fp_exact_zero(const struct fp_exact_t *x) {
+  return !(x->hi | x->lo);
+}
+
+static struct fp_exact_t fp_exact_unpack(double d) {
+  uint64_t bits;
+  memcpy(&bits, &d, sizeof(bits));
+  const int32_t biased = (int32_t)((bits & DMASK_EXPN) >> 52);
+  struct fp_exact_t x;
+  x.sign = (bits & DMASK_SIGN) != 0;
+  x.hi = 0;
+  x.lo = bits & DMASK_FRAC;
+  if (biased) {
+    x.lo |= DMASK_FRAC + 1;
+    x.exp = biased - 1075;
+  }
+  else {
+    x.exp = -1074;
+  }
+  return x;
+}
+
+// shift a nonzero significand left until its top bit is bit top, which is
+// exact as it must not be above it already
+static void fp_exact_norm(struct fp_exact_t *x, uint32_t top) {
+  const uint32_t n = (x->hi ? fp_clz64(x->hi) : 64 + fp_clz64(x->lo)) - (127 - top);
+  if (n >= 64) {
+    x->hi = x->lo << (n - 64);
+    x->lo = 0;
+  }
+  else if (n) {
+    x->hi = (x->hi << n) | (x->lo >> (64 - n));
+    x->lo <<= n;
+  }
+  x->exp -= (int32_t)n;
+}
+
+// shift the significand right, keeping whether any nonzero bits were lost
+static void fp_exact_shr(struct fp_exact_t *x, uint32_t n) {
+  bool sticky;
+  if (n == 0) {
+    return;
+  }
+  if (n >= 128) {
+    sticky = !fp_exact_zero(x);
+    x->hi = 0;
+    x->lo = 0;
+  }
+  else if (n >= 64) {
+    sticky = x->lo || (n > 64 && (x->hi << (128 - n)));
+    x->lo = x->hi >> (n - 64);
+    x->hi = 0;
+  }
+  else {
+    sticky = (x->lo << (64 - n)) != 0;
+    x->lo = (x->lo >> n) | (x->hi << (64 - n));
+    x->hi >>= n;
+  }
+  x->lo |= sticky ? 1 : 0;
+  x->exp += (int32_t)n;
+}
+
+// product of two unpacked doubles
+static struct fp_exact_t fp_exact_mul(struct fp_exact_t x, struct fp_exact_t y) {
+  const uint64_t x0 = (uint32_t)x.lo, x1 = x.lo >> 32;
+  const uint64_t y0 = (uint32_t)y.lo, y1 = y.lo >> 32;
+  const uint64_t p00 = x0 * y0, p01 = x0 * y1, p10 = x1 * y0;
+  const uint64_t mid = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+  struct fp_exact_t z;
+  z.sign = x.sign != y.sign;
+  z.exp = x.exp + y.exp;
+  z.lo = (mid << 32) | (uint32_t)p00;
+  z.hi = x1 * y1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+  return z;
+}
+
+// sum of unpacked doubles or their products
+// note: either significand has its low bits clear once normalized, so those
+//       of the one shifted out can only matter as a sticky bit
+static struct fp_exact_t fp_exact_add(struct fp_exact_t x, struct fp_exact_t y) {
+  if (fp_exact_zero(&y)) {
+    return x;
+  }
+  if (fp_exact_zero(&x)) {
+    return y;
+  }
+  // leave bit 127 clear for a carry, and align to the larger exponent
+  fp_exact_norm(&x, 126);
+  fp_exact_norm(&y, 126);
+  if (x.exp < y.exp) {
+    const struct fp_exact_t t = x;
+    x = y;
+    y = t;
+  }
+  fp_exact_shr(&y, (uint32_t)(x.exp - y.exp));
+  struct fp_exact_t z = x;
+  if (x.sign == y.sign) {
+    z.lo = x.lo + y.lo;
+    z.hi = x.hi + y.hi + ((z.lo < x.lo) ? 1 : 0);
+    return z;
+  }
+  // subtract the smaller magnitude, taking the sign of the larger
+  if (x.hi < y.hi || (x.hi == y.hi && x.lo < y.lo)) {
+    const struct fp_exact_t t = x;
+    x = y;
+    y = t;
+  }
+  z.sign = x.sign;
+  z.lo = x.lo - y.lo;
+  z.hi = x.hi - y.hi - ((x.lo < y.lo) ? 1 : 0);
+  return z;
+}
+
+// quotient of unpacked doubles, y being nonzero, to 63 or more bits with the
+// remainder as a sticky bit
+static struct fp_exact_t fp_exact_div(struct fp_exact_t x, struct fp_exact_t y) {
+  if (fp_exact_zero(&x)) {
+    return x;
+  }
+  // with both significands at bit 52 the quotient is between 1/2 and 2
+  fp_exact_norm(&x, 52);
+  fp_exact_norm(&y, 52);
+  uint64_t r = x.lo;
+  uint64_t q = 0;
+  for (uint32_t i = 0; i < 64; ++i) {
+    q <<= 1;
+    if (r >= y.lo) {
+      r -= y.lo;
+      q |= 1;
+    }
+    r <<= 1;
+  }
+  struct fp_exact_t z;
+  z.sign = x.sign != y.sign;
+  z.exp = x.exp - y.exp - 63;
+  z.hi = 0;
+  z.lo = q | (r ? 1 : 0);
+  return z;
+}
+
+// round a nonzero value to nearest with ties to max magnitude, to p bits with
+// emin the exponent of the smallest normal
+static double fp_exact_round(struct fp_exact_t x, int32_t p, int32_t emin) {
+  fp_exact_norm(&x, 127);
+  const int32_t e = x.exp + 127;
+  const int32_t lsb = ((e < emin) ? emin : e) - (p - 1);
+  // number of bits rounded off, which is at least 128 - p, so the bit below
+  // the result and everything above it are in hi
+  const int32_t d = lsb - x.exp;
+  uint64_t q = 0;
+  if (d <= 128) {
+    q = (d == 128) ? 0 : x.hi >> (d - 64);
+    q += (x.hi >> (d - 65)) & 1;
+  }
+  const double out = ldexp((double)q, lsb);
+  return x.sign ? -out : out;
+}
+
+// the exact result of op, false if an operand is not finite or it is zero
+static bool fp_exact_op(uint32_t op, double a, double b, double c, struct fp_exact_t *out) {
+  if (!isfinite(a) || !isfinite(b) || !isfinite(c)) {
+    return false;
+  }
+  const struct fp_exact_t x = fp_exact_unpack(a);
+  struct fp_exact_t y = fp_exact_unpack(b);
+  switch (op) {
+  case FP_RMM_SUB:
+    y.sign = !y.sign;
+    // fall through
+  case FP_RMM_ADD:
+    *out = fp_exact_add(x, y);
+    break;
+  case FP_RMM_MUL:
+    *out = fp_exact_mul(x, y);
+    break;
+  case FP_RMM_DIV:
+    *out = fp_exact_div(x, y);
+    break;
+  case FP_RMM_FMA:
+    *out = fp_exact_add(fp_exact_mul(x, y), fp_exact_unpack(c));
+    break;
+  default:
+    *out = x;
+    break;
+  }
+  return !fp_exact_zero(out);
+}
+
+// note: results only differ from rounding to nearest even on ties, which are
+//       inexact, and never overflow where those do not, so infinite results,
+//       exact zeros and the flags raised stand
+float fp_rmm(uint32_t op, float rne, double a, double b, double c) {
+  struct fp_exact_t x;
+  if (!isfinite(rne) || !fp_exact_op(op, a, b, c, &x)) {
+    return rne;
+  }
+  return (float)fp_exact_round(x, 24, -126);
+}
+
+#if RISCV_VM_SUPPORT_RV32D
+double fp_rmm_d(uint32_t op, double rne, double a, double b, double c) {
+  struct fp_exact_t x;
+  if (!isfinite(rne) || !fp_exact_op(op, a, b, c, &x)) {
+    return rne;
+  }
+  return fp_exact_round(x, 53, -1022);
+}
+
+static bool fp_is_snan_d(uint64_t bits) {
+  return (bits & DMASK_EXPN) == DMASK_EXPN && (bits & DMASK_FRAC) && !(bits & DMASK_QNAN);
+}
+
+double fp_minmax_d(struct riscv_t *rv, double a, double b, bool is_max) {
+  uint64_t x, y;
+  memcpy(&x, &a, sizeof(x));
+  memcpy(&y, &b, sizeof(y));
+  if (fp_is_snan_d(x) || fp_is_snan_d(y)) {
+    rv->csr_fcsr |= FFLAG_NV;
+  }
+  if (isnan(a)) {
+    return fp_canonical_d(b);
+  }
+  if (isnan(b)) {
+    return a;
+  }
+  if (a == b) {
+    const uint64_t bits = is_max ? (x & y) : (x | y);
+    double out;
+    memcpy(&out, &bits, sizeof(out));
+    return out;
+  }
+  return ((a < b) != is_max) ? a : b;
+}
+
+double fp_fma_d(struct riscv_t *rv, double a, double b, double c) {
+  if (isnan(c) && ((isinf(a) && b == 0.) || (a == 0. && isinf(b)))) {
+    rv->csr_fcsr |= FFLAG_NV;
+  }
+  return fp_canonical_d(fma(a, b, c));
+}
+#endif  // RISCV_VM_SUPPORT_RV32D
+#endif  // RISCV_VM_SUPPORT_RV32F
+
 // get a pointer to a CSR
 static uint32_t *csr_get_ptr(struct riscv_t *rv, uint32_t csr) {
   switch (csr) {
+  // every instruction retires in a single cycle
   case CSR_CYCLE:
+  case CSR_MCYCLE:
+  case CSR_INSTRET:
+  case CSR_MINSTRET:
     return (uint32_t*)(&rv->csr_cycle) + 0;
   case CSR_CYCLEH:
+  case CSR_MCYCLEH:
+  case CSR_INSTRETH:
+  case CSR_MINSTRETH:
     return (uint32_t*)(&rv->csr_cycle) + 1;
   case CSR_MSTATUS:
     return (uint32_t*)(&rv->csr_mstatus);
@@ -136,9 +585,18 @@ static uint32_t *csr_get_ptr(struct riscv_t *rv, uint32_t csr) {
     return (uint32_t*)(&rv->csr_mtval);
   case CSR_MIP:
     return (uint32_t*)(&rv->csr_mip);
-#if RISCV_VM_SUPPORT_RV32F
-  case CSR_FCSR:
-    return (uint32_t*)(&rv->csr_fcsr);
+  case CSR_MHARTID:
+    return (uint32_t*)(&rv->csr_mhartid);
+#if RISCV_VM_SUPPORT_RVV
+  // vl and vtype are only written by vsetvl and friends
+  case CSR_VSTART:
+    return (uint32_t*)(&rv->csr_vstart);
+  case CSR_VL:
+    return (uint32_t*)(&rv->csr_vl);
+  case CSR_VTYPE:
+    return (uint32_t*)(&rv->csr_vtype);
+  case CSR_VLENB:
+    return (uint32_t*)(&rv->csr_vlenb);
 #endif
   default:
     return NULL;
@@ -149,8 +607,48 @@ static bool csr_is_writable(uint32_t csr) {
   return csr < 0xc00;
 }
 
+#if RISCV_VM_SUPPORT_RV32F
+enum { CSR_OP_RW, CSR_OP_RS, CSR_OP_RC };
+
+// fflags (bits 4:0) and frm (bits 7:5) are views of fcsr, so fflags must
+// first accrue the host exception flags and frm be passed back to the host
+static uint32_t csr_fp_op(struct riscv_t *rv, uint32_t csr, uint32_t val, int op) {
+  const uint32_t shift = (csr == CSR_FRM) ? 5 : 0;
+  const uint32_t mask = (csr == CSR_FFLAGS) ? 0x1f : (csr == CSR_FRM) ? 0x07 : 0xff;
+  if (csr != CSR_FRM) {
+    fp_sync_flags(rv);
+  }
+  const uint32_t prev = rv->csr_fcsr;
+  const uint32_t out = (prev >> shift) & mask;
+  uint32_t next = out;
+  switch (op) {
+  case CSR_OP_RW: next = val;   break;
+  case CSR_OP_RS: next |= val;  break;
+  case CSR_OP_RC: next &= ~val; break;
+  }
+  rv->csr_fcsr = (prev & ~(mask << shift)) | ((next & mask) << shift);
+  // the host flags were accrued so can be cleared with fflags
+  if (prev & ~rv->csr_fcsr & 0x1f) {
+    feclearexcept(FE_ALL_EXCEPT);
+  }
+  if ((prev ^ rv->csr_fcsr) & 0xe0) {
+    fesetround(fp_host_round[(rv->csr_fcsr >> 5) & 0b111]);
+  }
+  return out;
+}
+
+static bool csr_is_fp(uint32_t csr) {
+  return csr == CSR_FFLAGS || csr == CSR_FRM || csr == CSR_FCSR;
+}
+#endif  // RISCV_VM_SUPPORT_RV32F
+
 // perform csrrw
 uint32_t csr_csrrw(struct riscv_t *rv, uint32_t csr, uint32_t val) {
+#if RISCV_VM_SUPPORT_RV32F
+  if (csr_is_fp(csr)) {
+    return csr_fp_op(rv, csr, val, CSR_OP_RW);
+  }
+#endif
   uint32_t *c = csr_get_ptr(rv, csr);
   if (!c) {
     return 0;
@@ -164,6 +662,11 @@ uint32_t csr_csrrw(struct riscv_t *rv, uint32_t csr, uint32_t val) {
 
 // perform csrrs (atomic read and set)
 uint32_t csr_csrrs(struct riscv_t *rv, uint32_t csr, uint32_t val) {
+#if RISCV_VM_SUPPORT_RV32F
+  if (csr_is_fp(csr)) {
+    return csr_fp_op(rv, csr, val, CSR_OP_RS);
+  }
+#endif
   uint32_t *c = csr_get_ptr(rv, csr);
   if (!c) {
     return 0;
@@ -177,6 +680,11 @@ uint32_t csr_csrrs(struct riscv_t *rv, uint32_t csr, uint32_t val) {
 
 // perform csrrc (atomic read and clear)
 uint32_t csr_csrrc(struct riscv_t *rv, uint32_t csr, uint32_t val) {
+#if RISCV_VM_SUPPORT_RV32F
+  if (csr_is_fp(csr)) {
+    return csr_fp_op(rv, csr, val, CSR_OP_RC);
+  }
+#endif
   uint32_t *c = csr_get_ptr(rv, csr);
   if (!c) {
     return 0;
@@ -188,7 +696,162 @@ uint32_t csr_csrrc(struct riscv_t *rv, uint32_t csr, uint32_t val) {
   return out;
 }
 
-struct riscv_t *rv_create(const struct riscv_io_t *io, riscv_user_t userdata) {
+#if RISCV_VM_SUPPORT_RV32A
+// serialises atomics on memory which is only reachable via the io callbacks
+static volatile long amo_io_lock;
+
+static void amo_lock(void) {
+#ifdef _MSC_VER
+  while (_InterlockedExchange(&amo_io_lock, 1)) {
+  }
+#else
+  while (__atomic_exchange_n(&amo_io_lock, 1, __ATOMIC_ACQUIRE)) {
+  }
+#endif
+}
+
+static void amo_unlock(void) {
+#ifdef _MSC_VER
+  _InterlockedExchange(&amo_io_lock, 0);
+#else
+  __atomic_store_n(&amo_io_lock, 0, __ATOMIC_RELEASE);
+#endif
+}
+
+// host address of an aligned guest word, or NULL if it is not host mapped
+static uint32_t *amo_host_ptr(struct riscv_t *rv, uint32_t addr) {
+  uint8_t **table = rv->jit.page_table;
+  if (!table || (addr & 3)) {
+    return NULL;
+  }
+  uint8_t *page = table[addr >> RV_PAGE_BITS];
+  return page ? (uint32_t *)(page + (addr & ((1u << RV_PAGE_BITS) - 1))) : NULL;
+}
+
+static uint32_t amo_load(uint32_t *ptr) {
+#ifdef _MSC_VER
+  return *(volatile uint32_t *)ptr;
+#else
+  return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+#endif
+}
+
+// replace *ptr with val if it still holds expect
+static bool amo_cas(uint32_t *ptr, uint32_t expect, uint32_t val) {
+#ifdef _MSC_VER
+  return _InterlockedCompareExchange((volatile long *)ptr, val, expect) == (long)expect;
+#else
+  return __atomic_compare_exchange_n(ptr, &expect, val, false, __ATOMIC_SEQ_CST,
+                                     __ATOMIC_SEQ_CST);
+#endif
+}
+
+// compute the value an amo writes back to memory
+static bool amo_apply(uint32_t funct5, uint32_t a, uint32_t b, uint32_t *res) {
+  switch (funct5) {
+  case 0b00001:  // AMOSWAP.W
+    *res = b;
+    break;
+  case 0b00000:  // AMOADD.W
+    *res = a + b;
+    break;
+  case 0b00100:  // AMOXOR.W
+    *res = a ^ b;
+    break;
+  case 0b01100:  // AMOAND.W
+    *res = a & b;
+    break;
+  case 0b01000:  // AMOOR.W
+    *res = a | b;
+    break;
+  case 0b10000:  // AMOMIN.W
+    *res = (int32_t)a < (int32_t)b ? a : b;
+    break;
+  case 0b10100:  // AMOMAX.W
+    *res = (int32_t)a > (int32_t)b ? a : b;
+    break;
+  case 0b11000:  // AMOMINU.W
+    *res = a < b ? a : b;
+    break;
+  case 0b11100:  // AMOMAXU.W
+    *res = a > b ? a : b;
+    break;
+  default:
+    return false;
+  }
+  return true;
+}
+
+// perform lr.w, registering a reservation on addr
+uint32_t amo_lrw(struct riscv_t *rv, uint32_t addr) {
+  uint32_t *ptr = amo_host_ptr(rv, addr);
+  uint32_t value;
+  if (ptr) {
+    value = amo_load(ptr);
+  }
+  else {
+    amo_lock();
+    value = rv->io.mem_read_w(rv, addr);
+    amo_unlock();
+  }
+  rv->lr_addr = addr;
+  rv->lr_value = value;
+  return value;
+}
+
+// perform sc.w, returning 0 on success
+// note: the reservation holds while memory still contains the value lr.w read
+//       so a store of the same value by another hart goes unnoticed.
+uint32_t amo_scw(struct riscv_t *rv, uint32_t addr, uint32_t val) {
+  // the reservation is used up whether or not the store succeeds
+  const bool reserved = rv->lr_addr == addr;
+  rv->lr_addr = LR_NO_RESERVATION;
+  if (!reserved) {
+    return 1;
+  }
+  uint32_t *ptr = amo_host_ptr(rv, addr);
+  if (ptr) {
+    return amo_cas(ptr, rv->lr_value, val) ? 0 : 1;
+  }
+  amo_lock();
+  const bool ok = rv->io.mem_read_w(rv, addr) == rv->lr_value;
+  if (ok) {
+    rv->io.mem_write_w(rv, addr, val);
+  }
+  amo_unlock();
+  return ok ? 0 : 1;
+}
+
+// perform an atomic read modify write, returning the old memory value in out
+bool amo_rmw(struct riscv_t *rv, uint32_t funct5, uint32_t addr, uint32_t val, uint32_t *out) {
+  uint32_t old, res;
+  uint32_t *ptr = amo_host_ptr(rv, addr);
+  if (ptr) {
+    do {
+      old = amo_load(ptr);
+      if (!amo_apply(funct5, old, val, &res)) {
+        return false;
+      }
+    } while (!amo_cas(ptr, old, res));
+  }
+  else {
+    amo_lock();
+    old = rv->io.mem_read_w(rv, addr);
+    if (!amo_apply(funct5, old, val, &res)) {
+      amo_unlock();
+      return false;
+    }
+    rv->io.mem_write_w(rv, addr, res);
+    amo_unlock();
+  }
+  *out = old;
+  return true;
+}
+#endif  // RISCV_VM_SUPPORT_RV32A
+
+// create a core run by a given interpreter, possibly sharing translated code
+static struct riscv_t *rv_create_core(const struct riscv_io_t *io, riscv_user_t userdata,
+                                      struct riscv_t *share, uint32_t interp) {
   assert(io);
   struct riscv_t *rv = (struct riscv_t *)malloc(sizeof(struct riscv_t));
   memset(rv, 0, sizeof(struct riscv_t));
@@ -196,14 +859,37 @@ struct riscv_t *rv_create(const struct riscv_io_t *io, riscv_user_t userdata) {
   memcpy(&rv->io, io, sizeof(struct riscv_io_t));
   // copy over the userdata
   rv->userdata = userdata;
+  rv->interp_type = interp;
   // reset
   rv_reset(rv, 0u);
   // initalize jit engine
-  rv_jit_init(rv);
+  if (!rv_jit_init(rv, share)) {
+    rv_jit_free(rv);
+    free(rv);
+    return NULL;
+  }
   // return the rv structure
   return rv;
 }
 
+struct riscv_t *rv_create(const struct riscv_io_t *io, riscv_user_t userdata) {
+  return rv_create_core(io, userdata, NULL, rv_interp_threaded);
+}
+
+struct riscv_t *rv_create_interp(const struct riscv_io_t *io, riscv_user_t userdata, uint32_t interp) {
+  return rv_create_core(io, userdata, NULL, interp);
+}
+
+struct riscv_t *rv_create_shared(const struct riscv_io_t *io, riscv_user_t userdata, struct riscv_t *share) {
+  assert(share);
+  return rv_create_core(io, userdata, share, share->interp_type);
+}
+
+void rv_print_stats(struct riscv_t *rv) {
+  assert(rv);
+  rv_jit_dump_stats(rv);
+}
+
 void rv_halt(struct riscv_t *rv) {
   rv->halt = true;
 }
@@ -212,6 +898,11 @@ bool rv_has_halted(struct riscv_t *rv) {
   return rv->halt;
 }
 
+void rv_set_hart_id(struct riscv_t *rv, riscv_word_t id) {
+  assert(rv);
+  rv->csr_mhartid = id;
+}
+
 void rv_delete(struct riscv_t *rv) {
   assert(rv);
   // free any jit state
@@ -233,8 +924,18 @@ void rv_reset(struct riscv_t *rv, riscv_word_t pc) {
   rv->csr_mstatus = 0;
   // reset float registers
 #if RISCV_VM_SUPPORT_RV32F
-  memset(rv->F, 0, sizeof(float) * RV_NUM_REGS);
+  memset(rv->F, 0, sizeof(rv->F));
   rv->csr_fcsr = 0;
+#endif
+#if RISCV_VM_SUPPORT_RVV
+  memset(rv->V, 0, sizeof(rv->V));
+  rv->csr_vstart = 0;
+  rv->csr_vl = 0;
+  rv->csr_vtype = VTYPE_VILL;
+  rv->csr_vlenb = RV_VLENB;
+#endif
+#if RISCV_VM_SUPPORT_RV32A
+  rv->lr_addr = LR_NO_RESERVATION;
 #endif
   rv->halt = false;
 }
@@ -20,10 +20,71 @@
 #ifndef RISCV_VM_SUPPORT_RV32F
 #define RISCV_VM_SUPPORT_RV32F     1
 #endif
+// enable RV32D (needs RV32F)
+#ifndef RISCV_VM_SUPPORT_RV32D
+#define RISCV_VM_SUPPORT_RV32D     RISCV_VM_SUPPORT_RV32F
+#endif
+#if RISCV_VM_SUPPORT_RV32D && !RISCV_VM_SUPPORT_RV32F
+#error "RV32D needs RV32F"
+#endif
+// enable RVV, the Zve32f subset of the vector extension (needs RV32F)
+#ifndef RISCV_VM_SUPPORT_RVV
+#define RISCV_VM_SUPPORT_RVV       RISCV_VM_SUPPORT_RV32F
+#endif
+#if RISCV_VM_SUPPORT_RVV && !RISCV_VM_SUPPORT_RV32F
+#error "RVV needs RV32F"
+#endif
+// vector register length in bits
+#ifndef RISCV_VM_VLEN
+#define RISCV_VM_VLEN              128
+#endif
+#if RISCV_VM_VLEN < 64 || (RISCV_VM_VLEN & (RISCV_VM_VLEN - 1))
+#error "VLEN must be a power of 2 of at least 64"
+#endif
+// enable RV32 Zba (address generation)
+#ifndef RISCV_VM_SUPPORT_Zba
+#define RISCV_VM_SUPPORT_Zba       1
+#endif
+// enable RV32 Zbb (basic bit manipulation)
+#ifndef RISCV_VM_SUPPORT_Zbb
+#define RISCV_VM_SUPPORT_Zbb       1
+#endif
+// enable RV32 Zbs (single bit instructions)
+#ifndef RISCV_VM_SUPPORT_Zbs
+#define RISCV_VM_SUPPORT_Zbs       1
+#endif
+// enable RVC (compressed instructions)
+#ifndef RISCV_VM_SUPPORT_RVC
+#define RISCV_VM_SUPPORT_RVC       1
+#endif
 // enable x64 JIT
 #ifndef RISCV_VM_X64_JIT
 #define RISCV_VM_X64_JIT           0
 #endif
+// lower JIT branches as a jcc to two exits rather than a cmov of the PC
+#ifndef RISCV_JIT_BRANCH_JCC
+#define RISCV_JIT_BRANCH_JCC       1
+#endif
+// predict JIT indirect branches and returns inline before using the dispatcher
+#ifndef RISCV_JIT_IBTC
+#define RISCV_JIT_IBTC             1
+#endif
+// record hot loops through consecutive blocks and translate them as traces
+#ifndef RISCV_JIT_TRACE
+#define RISCV_JIT_TRACE            1
+#endif
+// size of the JIT code cache in bytes
+#ifndef RISCV_JIT_CODE_SIZE
+#define RISCV_JIT_CODE_SIZE        (1024 * 1024 * 8)
+#endif
+// dispatch the interpreter with computed gotos (a gcc and clang extension)
+#ifndef RISCV_INTERP_COMPUTED_GOTO
+#if defined(__GNUC__)
+#define RISCV_INTERP_COMPUTED_GOTO 1
+#else
+#define RISCV_INTERP_COMPUTED_GOTO 0
+#endif
+#endif
 // enable machine mode support
 #ifndef RISCV_SUPPORT_MACHINE
 #define RISCV_SUPPORT_MACHINE      0
@@ -31,6 +92,7 @@
 
 #define RISCV_DUMP_JIT_TRACE       0
 #define RISCV_JIT_PROFILE          0
+#define RISCV_INTERP_PROFILE       0
 #define RISCV_DUMP_JIT_BLOCK       0
 
 // default top of stack address
@@ -1,3 +1,8 @@
+#if __linux__
+// for memfd_create
+#define _GNU_SOURCE
+#endif
+
 #include <assert.h>
 #include <stdbool.h>
 #include <stdlib.h>
@@ -9,9 +14,17 @@
 #include <Windows.h>
 #endif
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
 #if __linux__
 //#include <asm/cachectl.h>
 #include <sys/mman.h>
+#include <unistd.h>
+#include <pthread.h>
 #endif
 
 #include "riscv.h"
@@ -49,9 +62,9 @@
 
 
 // total size of the code block
-static const uint32_t code_size = 1024 * 1024 * 8;
+static const uint32_t code_size = RISCV_JIT_CODE_SIZE;
 
-// total number of block map entries
+// initial number of block map entries
 static const uint32_t map_size = 1024 * 64;
 
 
@@ -69,27 +82,300 @@ static void sys_flush_icache(const void *start, size_t size) {
 #endif
 }
 
-// allocate system executable memory
-static void *sys_alloc_exec_mem(uint32_t size) {
+// query the optional instruction set extensions of the host cpu
+static uint32_t sys_host_features(void) {
+  uint32_t ecx, edx;
+#ifdef _MSC_VER
+  int info[4];
+  __cpuid(info, 1);
+  ecx = info[2];
+  edx = info[3];
+#else
+  uint32_t eax, ebx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    return 0;
+  }
+#endif
+  uint32_t features = 0;
+  if (edx & (1u << 26)) {
+    features |= HOST_SSE2;
+  }
+  if (ecx & (1u << 19)) {
+    features |= HOST_SSE41;
+  }
+  if (ecx & (1u << 23)) {
+    features |= HOST_POPCNT;
+  }
+  // vex encoded instructions also need the os to save the avx register state
+  bool os_avx = false;
+  if (ecx & (1u << 27)) {
+#ifdef _MSC_VER
+    const uint64_t xcr0 = _xgetbv(0);
+#else
+    uint32_t lo, hi;
+    __asm__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    const uint64_t xcr0 = ((uint64_t)hi << 32) | lo;
+#endif
+    os_avx = (xcr0 & 6) == 6;
+  }
+  if (os_avx && (ecx & (1u << 12))) {
+    features |= HOST_FMA;
+  }
+  // lzcnt and tzcnt decode as bsr and bsf on hosts without them
+#ifdef _MSC_VER
+  __cpuid(info, 0x80000000);
+  if ((uint32_t)info[0] >= 0x80000001) {
+    __cpuid(info, 0x80000001);
+    if (info[2] & (1 << 5)) {
+      features |= HOST_LZCNT;
+    }
+  }
+  __cpuid(info, 0);
+  if (info[0] >= 7) {
+    __cpuidex(info, 7, 0);
+    if (info[1] & (1 << 3)) {
+      features |= HOST_BMI1;
+    }
+    if (os_avx && (info[1] & (1 << 5))) {
+      features |= HOST_AVX2;
+    }
+  }
+#else
+  if (__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 5))) {
+    features |= HOST_LZCNT;
+  }
+  if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+    if (ebx & (1u << 3)) {
+      features |= HOST_BMI1;
+    }
+    if (os_avx && (ebx & (1u << 5))) {
+      features |= HOST_AVX2;
+    }
+  }
+#endif
+  return features;
+}
+
+// allocate system executable memory as two views of the same pages, one
+// writable and one executable, so no page is ever writable and executable.
+static bool sys_alloc_exec_mem(struct code_buffer_t *code, uint32_t size) {
 #ifdef _WIN32
-  return VirtualAlloc(NULL, size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+  uint8_t *rw = NULL, *rx = NULL;
+  HANDLE map = CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_EXECUTE_READWRITE, 0, size, NULL);
+  if (map) {
+    rw = (uint8_t *)MapViewOfFile(map, FILE_MAP_WRITE, 0, 0, size);
+    rx = (uint8_t *)MapViewOfFile(map, FILE_MAP_READ | FILE_MAP_EXECUTE, 0, 0, size);
+    // the views keep the mapping alive
+    CloseHandle(map);
+  }
+  if (!rw || !rx) {
+    if (rw) UnmapViewOfFile(rw);
+    if (rx) UnmapViewOfFile(rx);
+    return false;
+  }
+#endif
+#ifdef __linux__
+  uint8_t *rw = MAP_FAILED, *rx = MAP_FAILED;
+  const int fd = memfd_create("riscv_jit", MFD_CLOEXEC);
+  if (fd != -1) {
+    if (ftruncate(fd, size) == 0) {
+      // mmap(addr, length, prot, flags, fd, offset)
+      rw = (uint8_t *)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      rx = (uint8_t *)mmap(NULL, size, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+    }
+    // the mappings keep the file alive
+    close(fd);
+  }
+  if (rw == MAP_FAILED || rx == MAP_FAILED) {
+    if (rw != MAP_FAILED) munmap(rw, size);
+    if (rx != MAP_FAILED) munmap(rx, size);
+    // without memfd fall back to a single rwx mapping
+    const int prot = PROT_READ | PROT_WRITE | PROT_EXEC;
+    rw = rx = (uint8_t *)mmap(NULL, size, prot, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    if (rw == MAP_FAILED) {
+      return false;
+    }
+  }
+#endif
+  code->start = rw;
+  code->head = rw;
+  code->end = rw + size;
+  code->exec_offset = rx - rw;
+  return true;
+}
+
+static void sys_free_exec_mem(struct code_buffer_t *code) {
+  uint8_t *rx = code->start + code->exec_offset;
+#ifdef _WIN32
+  UnmapViewOfFile(code->start);
+  UnmapViewOfFile(rx);
 #endif
 #ifdef __linux__
-  const int prot = PROT_READ | PROT_WRITE | PROT_EXEC;
-  // mmap(addr, length, prot, flags, fd, offset)
-  return mmap(NULL, size, prot, MAP_ANONYMOUS | MAP_PRIVATE, 0, 0);
+  const size_t size = code->end - code->start;
+  if (rx != code->start) {
+    munmap(rx, size);
+  }
+  munmap(code->start, size);
 #endif
 }
 
-static void sys_free_exec_mem(void *ptr) {
+// a reader/writer lock
+#ifdef _WIN32
+typedef SRWLOCK jit_lock_t;
+#define JIT_LOCK_INIT SRWLOCK_INIT
+#endif
+#ifdef __linux__
+typedef pthread_rwlock_t jit_lock_t;
+#define JIT_LOCK_INIT PTHREAD_RWLOCK_INITIALIZER
+#endif
+
+static void lock_init(jit_lock_t *lock) {
 #ifdef _WIN32
-  VirtualFree(ptr, 0, MEM_RELEASE);
+  InitializeSRWLock(lock);
 #endif
 #ifdef __linux__
-  assert(!"todo");
+  pthread_rwlockattr_t attr;
+  pthread_rwlockattr_init(&attr);
+  // a waiting writer must hold off new readers or a flush could starve
+  pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+  pthread_rwlock_init(lock, &attr);
+  pthread_rwlockattr_destroy(&attr);
 #endif
 }
 
+static void lock_free(jit_lock_t *lock) {
+#ifdef _WIN32
+  (void)lock;
+#endif
+#ifdef __linux__
+  pthread_rwlock_destroy(lock);
+#endif
+}
+
+static void lock_shared(jit_lock_t *lock) {
+#ifdef _WIN32
+  AcquireSRWLockShared(lock);
+#endif
+#ifdef __linux__
+  pthread_rwlock_rdlock(lock);
+#endif
+}
+
+static void unlock_shared(jit_lock_t *lock) {
+#ifdef _WIN32
+  ReleaseSRWLockShared(lock);
+#endif
+#ifdef __linux__
+  pthread_rwlock_unlock(lock);
+#endif
+}
+
+static void lock_exclusive(jit_lock_t *lock) {
+#ifdef _WIN32
+  AcquireSRWLockExclusive(lock);
+#endif
+#ifdef __linux__
+  pthread_rwlock_wrlock(lock);
+#endif
+}
+
+static void unlock_exclusive(jit_lock_t *lock) {
+#ifdef _WIN32
+  ReleaseSRWLockExclusive(lock);
+#endif
+#ifdef __linux__
+  pthread_rwlock_unlock(lock);
+#endif
+}
+
+// publish a value read by other threads without a lock, after all of the
+// data it refers to has been written
+static void store_release(void *ptr, void *value) {
+#ifdef _MSC_VER
+  // note: msvc volatile stores have release semantics
+  *(void *volatile *)ptr = value;
+#else
+  __atomic_store_n((void **)ptr, value, __ATOMIC_RELEASE);
+#endif
+}
+
+static void *load_acquire(void *ptr) {
+#ifdef _MSC_VER
+  return *(void *volatile *)ptr;
+#else
+  return __atomic_load_n((void **)ptr, __ATOMIC_ACQUIRE);
+#endif
+}
+
+// number of freed code buffers kept for reuse by new cores
+#define CODE_POOL_SIZE 4
+
+// code buffers are pooled across all cores in the process
+static struct code_buffer_t code_pool[CODE_POOL_SIZE];
+static uint32_t code_pool_count;
+static jit_lock_t code_pool_lock = JIT_LOCK_INIT;
+
+// take a code buffer from the pool or allocate a new one
+static bool code_buffer_acquire(struct code_buffer_t *code) {
+  lock_exclusive(&code_pool_lock);
+  if (code_pool_count) {
+    *code = code_pool[--code_pool_count];
+    unlock_exclusive(&code_pool_lock);
+    return true;
+  }
+  unlock_exclusive(&code_pool_lock);
+  if (!sys_alloc_exec_mem(code, code_size)) {
+    return false;
+  }
+  memset(code->start, 0xcc, code_size);
+  return true;
+}
+
+// return a code buffer to the pool, freeing it if the pool is full
+static void code_buffer_release(struct code_buffer_t *code) {
+  // leave the buffer as it was when allocated
+  memset(code->start, 0xcc, code->head - code->start);
+  code->head = code->start;
+  lock_exclusive(&code_pool_lock);
+  if (code_pool_count < CODE_POOL_SIZE) {
+    code_pool[code_pool_count++] = *code;
+    unlock_exclusive(&code_pool_lock);
+  }
+  else {
+    unlock_exclusive(&code_pool_lock);
+    sys_free_exec_mem(code);
+  }
+  memset(code, 0, sizeof(*code));
+}
+
+// executable alias of an address in the code buffer
+static uint8_t *code_exec(const struct code_buffer_t *code, uint8_t *ptr) {
+  return ptr + code->exec_offset;
+}
+
+// translated code which can be shared by cores running the same program.
+// blocks only reach their core through rbx so any core can run them.
+//
+// lookups in the block map are lock free.  translation and linking take
+// translate_lock, while the indirect branch caches belong to each core (so are
+// filled without it).  cores hold exec_lock shared
+// while they run blocks so a core which finds the code buffer full can take
+// it exclusive, knowing no other core is inside the code it is flushing.
+struct jit_cache_t {
+  // number of cores using the cache
+  uint32_t refs;
+  // code buffer
+  struct code_buffer_t code;
+  // block hash map, replaced when enlarged so it can be read without a lock
+  struct block_map_t *block_map;
+  // if blocks were translated with the host mapped memory fast path
+  bool host_mapped;
+  // incremented whenever the cache is flushed
+  uint32_t generation;
+  jit_lock_t exec_lock;
+  jit_lock_t translate_lock;
+};
+
 // this hash function is used when mapping addresses to indexes in the block map
 static uint32_t wang_hash(uint32_t a) {
   a = (a ^ 61) ^ (a >> 16);
@@ -101,27 +387,38 @@ static uint32_t wang_hash(uint32_t a) {
 }
 
 // allocate a block map
-void block_map_alloc(struct block_map_t *map, uint32_t num_entries) {
+static struct block_map_t *block_map_alloc(uint32_t num_entries) {
   assert(0 == (num_entries & (num_entries - 1)));
+  struct block_map_t *map = (struct block_map_t *)malloc(sizeof(struct block_map_t));
   const uint32_t size = num_entries * sizeof(struct block_t *);
   void *ptr = malloc(size);
   memset(ptr, 0, size);
   map->map = (struct block_t**)ptr;
   map->num_entries = num_entries;
+  map->count = 0;
+  map->retired = NULL;
+  return map;
 }
 
-// free a block map
+// free a block map and any maps it replaced
 static void block_map_free(struct block_map_t *map) {
-  assert(map->map);
-  free(map->map);
-  map->map = NULL;
+  while (map) {
+    struct block_map_t *retired = map->retired;
+    free(map->map);
+    free(map);
+    map = retired;
+  }
 }
 
 // clear all entries in the block map
 // note: will not clear the code buffer
 static void block_map_clear(struct block_map_t *map) {
   assert(map);
+  // no lookups can be using the replaced maps now
+  block_map_free(map->retired);
+  map->retired = NULL;
   memset(map->map, 0, map->num_entries * sizeof(struct block_t *));
+  map->count = 0;
 }
 
 // insert a block into a blockmap
@@ -132,39 +429,65 @@ static void block_map_insert(struct block_map_t *map, struct block_t *block) {
   uint32_t index = wang_hash(block->pc_start);
   for (;; ++index) {
     if (map->map[index & mask] == NULL) {
-      map->map[index & mask] = block;
+      store_release(&map->map[index & mask], block);
       break;
     }
   }
+  ++map->count;
+}
+
+// insert a block into the caches block map, enlarging it by a factor of x2
+// to keep the load factor below 1/2 so probe sequences stay short
+static void cache_insert(struct jit_cache_t *cache, struct block_t *block) {
+  struct block_map_t *map = cache->block_map;
+  if ((map->count + 1) * 2 > map->num_entries) {
+    // fill a new map and publish it once complete
+    struct block_map_t *new_map = block_map_alloc(map->num_entries * 2);
+    for (uint32_t i = 0; i < map->num_entries; ++i) {
+      if (map->map[i]) {
+        block_map_insert(new_map, map->map[i]);
+      }
+    }
+    // lookups may still be reading the old map so keep it until a flush
+    new_map->retired = map;
+    store_release(&cache->block_map, new_map);
+    map = new_map;
+  }
+  block_map_insert(map, block);
 }
 
-// expand the block map by a factor of x2
-static void block_map_enlarge(struct riscv_jit_t *jit) {
-  // allocate a new block map
-  struct block_map_t new_map;
-  block_map_alloc(&new_map, jit->block_map.num_entries * 2);
-  // insert blocks into new map
-  for (uint32_t i = 0; i < jit->block_map.num_entries; ++i) {
-    struct block_t *block = jit->block_map.map[i];
-    if (block) {
-      block_map_insert(&new_map, block);
+// lookup a block in the block map
+static struct block_t *block_map_find(struct jit_cache_t *cache, uint32_t addr) {
+  struct block_map_t *map = (struct block_map_t *)load_acquire(&cache->block_map);
+  const uint32_t mask = map->num_entries - 1;
+  for (uint32_t index = wang_hash(addr);; ++index) {
+    struct block_t *block = (struct block_t *)load_acquire(&map->map[index & mask]);
+    if (block == NULL || block->pc_start == addr) {
+      return block;
     }
   }
-  // release old map
-  block_map_free(&jit->block_map);
-  // use new map
-  jit->block_map.map = new_map.map;
-  jit->block_map.num_entries = new_map.num_entries;
 }
 
-// allocate a new code block
-static struct block_t *block_alloc(struct riscv_jit_t *jit) {
+// index into the direct mapped block cache
+static uint32_t block_l1_index(uint32_t pc) {
+  return (pc >> 2) & (BLOCK_L1_ENTRIES - 1);
+}
+
+// allocate a new code block, returning NULL if the code cache is full
+static struct block_t *block_alloc(struct jit_cache_t *cache) {
+  struct code_buffer_t *code = &cache->code;
+  if (code->head + sizeof(struct block_t) >= code->end) {
+    return NULL;
+  }
   // place a new block
-  struct block_t *block = (struct block_t *)jit->code.head;
+  struct block_t *block = (struct block_t *)code->head;
   struct cg_state_t *cg = &block->cg;
   // set the initial codegen write head
-  cg_init(cg, block->code, jit->code.end);
-  block->predict = NULL;
+  cg_init(cg, block->code, code->end);
+  block->num_exits = 0;
+  block->trace = NULL;
+  block->side = NULL;
+  block->retrace = false;
 #if RISCV_JIT_PROFILE
   block->hit_count = 0;
 #endif
@@ -182,117 +505,42 @@ static void block_dump(struct block_t *block, FILE *fd) {
 }
 
 // finialize a code block and insert into the block map
+// note: must hold translate_lock
 static void block_finish(struct riscv_jit_t *jit, struct block_t *block) {
-  assert(jit && block && jit->code.head && jit->block_map.map);
+  struct jit_cache_t *cache = jit->cache;
+  assert(block && cache->code.head);
   struct cg_state_t *cg = &block->cg;
   // advance the block head ready for the next alloc
-  jit->code.head = block->code + cg_size(cg);
-  // insert into the block map
-  block_map_insert(&jit->block_map, block);
+  cache->code.head = block->code + cg_size(cg);
+  // flush the instructon cache for this block
+  sys_flush_icache(code_exec(&cache->code, block->code), cg_size(cg));
+  // insert into the block map making it visible to other cores
+  cache_insert(cache, block);
+  jit->block_l1[block_l1_index(block->pc_start)] = block;
+  jit->cache_stats.blocks += 1;
+  jit->cache_stats.bytes += cg_size(cg);
 #if RISCV_DUMP_JIT_TRACE
   block_dump(block, stdout);
 #endif
-  // flush the instructon cache for this block
-  sys_flush_icache(block->code, cg_size(cg));
 }
 
 // try to locate an already translated block in the block map
 static struct block_t *block_find(struct riscv_jit_t *jit, uint32_t addr) {
-  assert(jit && jit->block_map.map);
-  uint32_t index = wang_hash(addr);
-  const uint32_t mask = jit->block_map.num_entries - 1;
-  for (;; ++index) {
-    struct block_t *block = jit->block_map.map[index & mask];
-    if (block == NULL) {
-      return NULL;
-    }
-    if (block->pc_start == addr) {
-      return block;
-    }
+  assert(jit && jit->cache);
+  // check the direct mapped cache first as it needs no hashing
+  struct block_t **l1 = &jit->block_l1[block_l1_index(addr)];
+  if (*l1 && (*l1)->pc_start == addr) {
+    jit->lookup_stats.l1_hits++;
+    return *l1;
   }
-}
-
-// callback for unhandled op_op instructions
-static void handle_op_op(struct riscv_t *rv, uint32_t inst) {
-  // r-type decode
-  const uint32_t rd     = dec_rd(inst);
-  const uint32_t funct3 = dec_funct3(inst);
-  const uint32_t rs1    = dec_rs1(inst);
-  const uint32_t rs2    = dec_rs2(inst);
-  const uint32_t funct7 = dec_funct7(inst);
-
-  switch (funct7) {
-  case 0b0000001:
-    // RV32M instructions
-    switch (funct3) {
-    case 0b010: // MULHSU
-      {
-        const int64_t a = (int32_t)rv->X[rs1];
-        const uint64_t b = rv->X[rs2];
-        rv->X[rd] = ((uint64_t)(a * b)) >> 32;
-      }
-      break;
-    case 0b100: // DIV
-      {
-        const int32_t dividend = (int32_t)rv->X[rs1];
-        const int32_t divisor = (int32_t)rv->X[rs2];
-        if (divisor == 0) {
-          rv->X[rd] = ~0u;
-        }
-        else if (divisor == -1 && rv->X[rs1] == 0x80000000u) {
-          rv->X[rd] = rv->X[rs1];
-        }
-        else {
-          rv->X[rd] = dividend / divisor;
-        }
-      }
-      break;
-    case 0b101: // DIVU
-      {
-        const uint32_t dividend = rv->X[rs1];
-        const uint32_t divisor = rv->X[rs2];
-        if (divisor == 0) {
-          rv->X[rd] = ~0u;
-        }
-        else {
-          rv->X[rd] = dividend / divisor;
-        }
-      }
-      break;
-    case 0b110: // REM
-      {
-        const int32_t dividend = rv->X[rs1];
-        const int32_t divisor = rv->X[rs2];
-        if (divisor == 0) {
-          rv->X[rd] = dividend;
-        }
-        else if (divisor == -1 && rv->X[rs1] == 0x80000000u) {
-          rv->X[rd] = 0;
-        }
-        else {
-          rv->X[rd] = dividend % divisor;
-        }
-      }
-      break;
-    case 0b111: // REMU
-      {
-        const uint32_t dividend = rv->X[rs1];
-        const uint32_t divisor = rv->X[rs2];
-        if (divisor == 0) {
-          rv->X[rd] = dividend;
-        }
-        else {
-          rv->X[rd] = dividend % divisor;
-        }
-      }
-      break;
-    default:
-      assert(!"unreachable");
-    }
-    break;
-  default:
-    assert(!"unreachable");
+  struct block_t *block = block_map_find(jit->cache, addr);
+  if (block == NULL) {
+    jit->lookup_stats.misses++;
+    return NULL;
   }
+  jit->lookup_stats.map_hits++;
+  *l1 = block;
+  return block;
 }
 
 static void handle_op_system(struct riscv_t *rv, uint32_t inst) {
@@ -321,7 +569,7 @@ static void handle_op_system(struct riscv_t *rv, uint32_t inst) {
     rv->X[rd] = rd ? tmp : rv->X[rd];
     break;
   case 5: // CSRRWI
-    tmp = csr_csrrc(rv, csr, rv->X[rs1]);
+    tmp = csr_csrrw(rv, csr, rs1);
     rv->X[rd] = rd ? tmp : rv->X[rd];
     break;
   case 6: // CSRRSI
@@ -338,82 +586,158 @@ static void handle_op_system(struct riscv_t *rv, uint32_t inst) {
   }
 }
 
-// callback for unhandled op_fp instructions
-static void handle_op_fp(struct riscv_t *rv, uint32_t inst) {
-  const uint32_t rd = dec_rd(inst);
-  const uint32_t rs1 = dec_rs1(inst);
-  const uint32_t rs2 = dec_rs2(inst);
-  const uint32_t rm = dec_funct3(inst); // TODO: rounding!
-  const uint32_t funct7 = dec_funct7(inst);
-  // dispatch based on func7 (low 2 bits are width)
-  switch (funct7) {
-  case 0b0010000:
-  {
-    uint32_t f1, f2, res;
-    memcpy(&f1, rv->F + rs1, 4);
-    memcpy(&f2, rv->F + rs2, 4);
-    switch (rm) {
-    case 0b000:  // FSGNJ.S
-      res = (f1 & ~FMASK_SIGN) | (f2 & FMASK_SIGN);
-      break;
-    case 0b001:  // FSGNJN.S
-      res = (f1 & ~FMASK_SIGN) | (~f2 & FMASK_SIGN);
-      break;
-    case 0b010:  // FSGNJX.S
-      res = f1 ^ (f2 & FMASK_SIGN);
-      break;
-    default:
+#if RISCV_VM_SUPPORT_RV32A
+// callback for rv32a instructions
+static void handle_op_amo(struct riscv_t *rv, uint32_t inst) {
+  const uint32_t rd     = dec_rd(inst);
+  const uint32_t rs1    = dec_rs1(inst);
+  const uint32_t rs2    = dec_rs2(inst);
+  const uint32_t funct5 = (dec_funct7(inst) >> 2) & 0x1f;
+
+  uint32_t tmp;
+  switch (funct5) {
+  case 0b00010:  // LR.W
+    tmp = amo_lrw(rv, rv->X[rs1]);
+    break;
+  case 0b00011:  // SC.W
+    tmp = amo_scw(rv, rv->X[rs1], rv->X[rs2]);
+    break;
+  default:       // AMO*.W
+    if (!amo_rmw(rv, funct5, rv->X[rs1], rv->X[rs2], &tmp)) {
       assert(!"unreachable");
     }
-    memcpy(rv->F + rd, &res, 4);
     break;
   }
-  case 0b0010100:
-    switch (rm) {
-    case 0b000:  // FMIN
-      rv->F[rd] = fminf(rv->F[rs1], rv->F[rs2]);
-      break;
-    case 0b001:  // FMAX
-      rv->F[rd] = fmaxf(rv->F[rs1], rv->F[rs2]);
-      break;
-    default:
-      assert(!"unreachable");
-    }
+  rv->X[rd] = rd ? tmp : rv->X[rd];
+}
+#endif  // RISCV_VM_SUPPORT_RV32A
+
+#if RISCV_VM_SUPPORT_RV32F
+// callback for the float instructions not lowered inline; conversions to
+// integer with a rounding mode the jit does not handle, and under rv32d the
+// double conversions to integer, fmin.d, fmax.d and fclass.d
+static void handle_op_fp(struct riscv_t *rv, uint32_t inst) {
+  const uint32_t rd = dec_rd(inst);
+  const uint32_t rs1 = dec_rs1(inst);
+  const uint32_t rm = dec_funct3(inst);
+  uint32_t out;
+  switch (dec_funct7(inst)) {
+  case 0b1100000:  // FCVT.W[U].S
+    out = fp_cvt_w(rv, rv->F[rs1].f, rm, dec_rs2(inst) == 0b00001);
     break;
-  case 0b1110000:
-    switch (rm) {
-    case 0b001:  // FCLASS.S
-    {
-      uint32_t bits;
-      memcpy(&bits, rv->F + rs1, 4);
-      rv->X[rd] = calc_fclass(bits);
-      break;
-    }
-    default:
-      assert(!"unreachable");
-    }
+#if RISCV_VM_SUPPORT_RV32D
+  case 0b1100001:  // FCVT.W[U].D
+    out = fp_cvt_w(rv, rv->F[rs1].d, rm, dec_rs2(inst) == 0b00001);
     break;
-  case 0b1010000:
-    switch (rm) {
-    case 0b010:  // FEQ.S
-      rv->X[rd] = (rv->F[rs1] == rv->F[rs2]) ? 1 : 0;
-      break;
-    case 0b001:  // FLT.S
-      rv->X[rd] = (rv->F[rs1] < rv->F[rs2]) ? 1 : 0;
-      break;
-    case 0b000:  // FLE.S
-      rv->X[rd] = (rv->F[rs1] <= rv->F[rs2]) ? 1 : 0;
-      break;
-    default:
-      assert(!"unreachable");
-    }
+  case 0b0010101:  // FMIN.D, FMAX.D
+    rv->F[rd].d = fp_minmax_d(rv, rv->F[rs1].d, rv->F[dec_rs2(inst)].d, rm == 0b001);
+    return;
+  case 0b1110001:  // FCLASS.D
+    out = calc_fclass_d(rv->F[rs1].bits);
     break;
+#endif
   default:
     assert(!"unreachable");
+    return;
+  }
+  rv->X[rd] = rd ? out : rv->X[rd];
+}
+
+// callback for the fused multiply adds on hosts without fma3, where a
+// multiply then add would round twice, for those with a nan addend and for
+// those rounding ties to max magnitude
+// note: the translated code has already set the host rounding mode
+static void handle_op_fma(struct riscv_t *rv, uint32_t inst) {
+  // the opcode says whether the product and the addend are negated
+  const uint32_t op = (inst & INST_6_2) >> 2;
+  const bool neg_mul = (op & 0b10) != 0;
+  const bool neg_add = (op & 0b01) != 0;
+  const bool rmm = fp_is_rmm(rv, dec_funct3(inst));
+  const uint32_t rs1 = dec_rs1(inst);
+  const uint32_t rs2 = dec_rs2(inst);
+  const uint32_t rs3 = dec_r4type_rs3(inst);
+#if RISCV_VM_SUPPORT_RV32D
+  if (dec_r4type_fmt(inst) == 0b01) {
+    const double a = neg_mul ? -rv->F[rs1].d : rv->F[rs1].d;
+    const double b = rv->F[rs2].d;
+    const double c = neg_add ? -rv->F[rs3].d : rv->F[rs3].d;
+    const double r = fp_fma_d(rv, a, b, c);
+    rv->F[dec_rd(inst)].d = rmm ? fp_rmm_d(FP_RMM_FMA, r, a, b, c) : r;
+    return;
+  }
+#endif
+  const float a = neg_mul ? -rv->F[rs1].f : rv->F[rs1].f;
+  const float b = rv->F[rs2].f;
+  const float c = neg_add ? -rv->F[rs3].f : rv->F[rs3].f;
+  const float r = fp_fma(rv, a, b, c);
+  fp_write_s(rv, dec_rd(inst), rmm ? fp_rmm(FP_RMM_FMA, r, a, b, c) : r);
+}
+
+// callback for the arithmetic rounding to nearest with ties to max magnitude,
+// which the host has no mode for
+// note: the translated code has the host rounding to nearest even
+static void handle_op_rmm(struct riscv_t *rv, uint32_t inst) {
+  const uint32_t rd = dec_rd(inst);
+  const uint32_t rs1 = dec_rs1(inst);
+  const uint32_t rs2 = dec_rs2(inst);
+  const uint32_t funct7 = dec_funct7(inst);
+  if (funct7 == 0b1101000) {  // FCVT.S.W[U]
+    const double x = (rs2 == 0b00001) ? (double)rv->X[rs1] : (double)(int32_t)rv->X[rs1];
+    fp_write_s(rv, rd, fp_rmm(FP_RMM_CVT, (float)x, x, 0., 0.));
+    return;
   }
+#if RISCV_VM_SUPPORT_RV32D
+  if (funct7 == 0b0100000) {  // FCVT.S.D
+    const double a = rv->F[rs1].d;
+    fp_write_s(rv, rd, fp_canonical(fp_rmm(FP_RMM_CVT, (float)a, a, 0., 0.)));
+    return;
+  }
+#endif
+  // FADD, FSUB, FMUL and FDIV in the order of FP_RMM_ADD onwards, with the
+  // format in the low bits
+  const uint32_t op = funct7 >> 2;
+#if RISCV_VM_SUPPORT_RV32D
+  if (funct7 & 0b01) {
+    const double a = rv->F[rs1].d;
+    const double b = rv->F[rs2].d;
+    const double r = (op == FP_RMM_ADD) ? a + b : (op == FP_RMM_SUB) ? a - b :
+                     (op == FP_RMM_MUL) ? a * b : a / b;
+    rv->F[rd].d = fp_canonical_d(fp_rmm_d(op, r, a, b, 0.));
+    return;
+  }
+#endif
+  const float a = rv->F[rs1].f;
+  const float b = rv->F[rs2].f;
+  const float r = (op == FP_RMM_ADD) ? a + b : (op == FP_RMM_SUB) ? a - b :
+                  (op == FP_RMM_MUL) ? a * b : a / b;
+  fp_write_s(rv, rd, fp_canonical(fp_rmm(op, r, a, b, 0.)));
 }
+#endif  // RISCV_VM_SUPPORT_RV32F
 
-static void rv_translate_block(struct riscv_t *rv, struct block_t *block) {
+#if RISCV_VM_SUPPORT_RV32D
+// fld and fsd to misaligned or io addresses, taking the effective address as
+// the inst encoding may no longer match the optimized operands
+static void handle_fld(struct riscv_t *rv, uint32_t addr, uint32_t rd) {
+  rv->F[rd].bits = fp_read_d(rv, addr);
+}
+
+static void handle_fsd(struct riscv_t *rv, uint32_t addr, uint32_t rs2) {
+  fp_write_d(rv, addr, rv->F[rs2].bits);
+}
+#endif  // RISCV_VM_SUPPORT_RV32D
+
+#if RISCV_VM_SUPPORT_RVV
+// callback for vector instructions, which run on the simd kernels the host
+// supports where they apply
+static void handle_op_v(struct riscv_t *rv, uint32_t inst) {
+  if (!vec_exec(rv, inst, rv->jit.host_features)) {
+    rv_except_illegal_inst(rv);
+  }
+}
+#endif  // RISCV_VM_SUPPORT_RVV
+
+// translate a block, returning false if it did not fit in the code cache
+static bool rv_translate_block(struct riscv_t *rv, struct block_t *block) {
   assert(rv && block);
 
   struct cg_state_t *cg = &block->cg;
@@ -423,44 +747,402 @@ static void rv_translate_block(struct riscv_t *rv, struct block_t *block) {
   block->pc_start = rv->PC;
   block->pc_end = rv->PC;
 
-  // prologue
-  codegen_prologue(cg);
-
-  // translate the basic block
-  for (;;) {
+  // decode the basic block
+  struct block_inst_t insts[BLOCK_MAX_INSTS];
+  uint32_t count = 0;
+  while (count < BLOCK_MAX_INSTS) {
+    struct block_inst_t *bi = insts + count++;
     // fetch the next instruction
-    const uint32_t inst = rv->io.mem_ifetch(rv, block->pc_end);
+    bi->pc = block->pc_end;
+    bi->inst = inst_expand(rv->io.mem_ifetch(rv, bi->pc));
+    bi->retired = count - 1;
     // decode
-    struct rv_inst_t dec;
-    uint32_t pc = block->pc_end;
-    if (!decode(inst, &dec, &pc)) {
+    if (!decode(bi->inst, &bi->ir, &block->pc_end)) {
       assert(!"unreachable");
     }
+    // stop on branch
+    if (inst_is_branch(&bi->ir)) {
+      break;
+    }
+  }
+  block->instructions = count;
+
+  // peephole optimize the decoded block
+  count = optimize(insts, count, &rv->jit.opt_stats);
+
+  // cache the most used guest registers in host registers
+  struct block_regs_t regs;
+  uint32_t live[BLOCK_MAX_INSTS];
+  codegen_regalloc(&regs, insts, count, live, 0);
+
+  // prologue
+  codegen_prologue(cg);
+  block->chain_entry = cg->head;
+  codegen_fill(cg, &regs);
+
+  // translate the basic block
+  for (uint32_t n = 0; n < count; ++n) {
+    const struct block_inst_t *bi = insts + n;
     // codegen
-    if (!codegen(&dec, cg, block->pc_end, inst)) {
+    regs.live = live[n];
+    regs.retired = bi->retired;
+    if (!codegen(&bi->ir, cg, bi->pc, bi->inst, &rv->jit, &regs)) {
       assert(!"unreachable");
     }
-    ++block->instructions;
+  }
+  codegen_dyn_round(cg, &regs);
+  // blocks account for their own cycles as they may be chained
+  codegen_cycles(cg, block->instructions);
+
+  // write back cached registers, chainable exits and epilogue
+  codegen_spill(cg, &regs);
+  codegen_exits(cg, block, &regs, &insts[count - 1].ir, insts[count - 1].pc);
+  rv->jit.opt_stats.fuse_branch += regs.fused;
+  return !cg_overflow(cg);
+}
+
+#if RISCV_JIT_TRACE
+// if the instruction ending a block of a trace can continue to next_pc
+static bool trace_can_reach(const struct block_inst_t *bi, uint32_t pc_end, uint32_t next_pc) {
+  switch (bi->ir.opcode) {
+  case rv_inst_jal:
+    return bi->pc + bi->ir.imm == next_pc;
+  case rv_inst_jalr:
+    return true;
+  case rv_inst_beq:
+  case rv_inst_bne:
+  case rv_inst_blt:
+  case rv_inst_bge:
+  case rv_inst_bltu:
+  case rv_inst_bgeu:
+    return bi->pc + bi->ir.imm == next_pc || pc_end == next_pc;
+  case rv_inst_ecall:
+  case rv_inst_ebreak:
+    // the handler may halt the core or change the PC
+    return false;
+  default:
+    return pc_end == next_pc;
+  }
+}
+
+// a guard of a trace waiting for its side exit
+struct trace_side_t {
+  uint8_t *jcc;
+  // registers cached at the guard
+  struct block_regs_t regs;
+  // branch guarded, where the side exit goes and instructions run before it
+  uint32_t site_pc;
+  uint32_t pc;
+  uint32_t instructions;
+};
+
+// translate the recorded trace, returning false if it did not fit in the code
+// cache or would be no better than its first block
+static bool rv_translate_trace(struct riscv_t *rv, struct block_t *block, struct block_exit_t *side, bool loop) {
+  const struct trace_rec_t *rec = &rv->jit.trace;
+  struct cg_state_t *cg = &block->cg;
+
+  block->side = side;
+  block->instructions = 0;
+  block->pc_start = rec->pc[0];
+
+  // decode and optimize each block on its own as the optimizer does not know
+  // about the side exits between them
+  struct block_inst_t insts[BLOCK_MAX_INSTS];
+  uint32_t count = 0;
+  uint32_t num_blocks = 0;
+  // last instruction, end address and instructions run up to each block end
+  uint32_t last[TRACE_MAX_BLOCKS];
+  uint32_t pc_end[TRACE_MAX_BLOCKS];
+  uint32_t cycles[TRACE_MAX_BLOCKS];
+  while (num_blocks < rec->count) {
+    struct block_inst_t *seg = insts + count;
+    uint32_t pc = rec->pc[num_blocks];
+    uint32_t n = 0;
+    while (count + n < BLOCK_MAX_INSTS) {
+      struct block_inst_t *bi = seg + n++;
+      bi->pc = pc;
+      bi->inst = inst_expand(rv->io.mem_ifetch(rv, pc));
+      bi->retired = block->instructions + n - 1;
+      if (!decode(bi->inst, &bi->ir, &pc)) {
+        assert(!"unreachable");
+      }
+      if (inst_is_branch(&bi->ir)) {
+        break;
+      }
+    }
+    block->instructions += n;
     block->pc_end = pc;
-    // stop on branch
-    if (inst_is_branch(&dec)) {
+    count += optimize(seg, n, &rv->jit.opt_stats);
+    last[num_blocks] = count - 1;
+    pc_end[num_blocks] = pc;
+    cycles[num_blocks] = block->instructions;
+    ++num_blocks;
+    // stop early if the code no longer follows the recorded path
+    const bool at_end = num_blocks == rec->count;
+    if (at_end && !loop) {
+      break;
+    }
+    const uint32_t next_pc = at_end ? rec->pc[0] : rec->pc[num_blocks];
+    if (!trace_can_reach(insts + count - 1, pc, next_pc) || (!at_end && count >= BLOCK_MAX_INSTS)) {
+      loop = false;
       break;
     }
   }
+  if (!loop && num_blocks < 2) {
+    return false;
+  }
 
-  // epilogue
+  // cache the most used guest registers in host registers, which for a loop
+  // must hold the registers read at its head when it loops back
+  struct block_regs_t regs;
+  uint32_t live[BLOCK_MAX_INSTS];
+  codegen_regalloc(&regs, insts, count, live, 0);
+  if (loop) {
+    codegen_regalloc(&regs, insts, count, live, regs.live_in);
+  }
+
+  // registers are not written back as it loops so may be dirty at the head,
+  // and are filled on entry so a side exit taken before their write on the
+  // first iteration still holds the guest value
+  uint32_t loop_dirty = 0;
+  if (loop) {
+    for (uint32_t n = 0; n < count; ++n) {
+      uint32_t use, def;
+      inst_regs(&insts[n].ir, &use, &def);
+      for (uint32_t r = 1; r < RV_NUM_REGS; ++r) {
+        if ((def & (1u << r)) && regs.host[r] >= 0) {
+          loop_dirty |= 1u << r;
+        }
+      }
+    }
+    regs.live_in |= loop_dirty;
+  }
+
+  // prologue
+  codegen_prologue(cg);
+  block->chain_entry = cg->head;
+  codegen_fill(cg, &regs);
+  const uint8_t *loop_top = cg->head;
+  regs.dirty |= loop_dirty;
+
+  // translate the blocks, guarding that each continues along the trace
+  struct trace_side_t pending[TRACE_MAX_BLOCKS];
+  uint32_t num_side = 0;
+  for (uint32_t n = 0, b = 0; n < count; ++n) {
+    const struct block_inst_t *bi = insts + n;
+    regs.live = live[n];
+    regs.retired = bi->retired;
+    if (!codegen(&bi->ir, cg, bi->pc, bi->inst, &rv->jit, &regs)) {
+      assert(!"unreachable");
+    }
+    if (n != last[b]) {
+      continue;
+    }
+    if (b + 1 < num_blocks || loop) {
+      const uint32_t next_pc = (b + 1 < num_blocks) ? rec->pc[b + 1] : rec->pc[0];
+      struct trace_side_t *ts = pending + num_side;
+      ts->jcc = codegen_trace_guard(cg, &regs, &bi->ir, bi->pc, pc_end[b], next_pc, &ts->pc);
+      if (ts->jcc) {
+        ts->regs = regs;
+        ts->site_pc = bi->pc;
+        ts->instructions = cycles[b];
+        ++num_side;
+      }
+    }
+    ++b;
+  }
+  codegen_dyn_round(cg, &regs);
+
+  uint8_t *ret[TRACE_MAX_BLOCKS + 1];
+  uint32_t num_ret = 0;
+  if (loop) {
+    codegen_trace_loop(cg, block, &regs, loop_top, insts[count - 1].pc, ret + num_ret++);
+  }
+  else {
+    codegen_cycles(cg, block->instructions);
+    codegen_spill(cg, &regs);
+    codegen_exits(cg, block, &regs, &insts[count - 1].ir, insts[count - 1].pc);
+  }
+  rv->jit.opt_stats.fuse_branch += regs.fused;
+  // side exits out of the trace
+  for (uint32_t i = 0; i < num_side; ++i) {
+    const struct trace_side_t *ts = pending + i;
+    cg_patch_rel32(ts->jcc, cg->head);
+    codegen_side_exit(cg, side + i, &ts->regs, ts->site_pc, ts->pc, ts->instructions, ret + num_ret++);
+  }
+  // which return to the dispatcher via the epilogue
+  for (uint32_t i = 0; i < num_ret; ++i) {
+    cg_patch_rel32(ret[i], cg->head);
+  }
   codegen_epilogue(cg);
+  return !cg_overflow(cg);
+}
+#endif
+
+// chain a block exit directly to its successor block
+static void block_link(struct riscv_jit_t *jit, struct block_exit_t *exit, struct block_t *next) {
+  if (exit && exit->jmp && !exit->linked && exit->pc == next->pc_start) {
+    struct jit_cache_t *cache = jit->cache;
+    lock_exclusive(&cache->translate_lock);
+    // another core may have beaten us to it
+    if (!exit->linked) {
+      // note: the displacement is the same in both views of the code buffer
+      //       and is aligned so cores running the exit see a whole update
+      cg_patch_rel32(exit->jmp, next->chain_entry);
+      sys_flush_icache(code_exec(&cache->code, exit->jmp), 4);
+      exit->linked = true;
+    }
+    unlock_exclusive(&cache->translate_lock);
+  }
+}
+
+#if RISCV_JIT_IBTC
+// empty the guest return address stack and the indirect branch caches
+static void ibtc_clear(struct riscv_jit_t *jit) {
+  for (uint32_t i = 0; i < RAS_ENTRIES; ++i) {
+    jit->ras[i].pc = 1;
+    jit->ras[i].code = NULL;
+  }
+  jit->ras_top = 0;
+  for (uint32_t i = 0; i < RAS_CONTINUATIONS; ++i) {
+    jit->ras_cont[i].pc = 1;
+    jit->ras_cont[i].code = NULL;
+  }
+  jit->ras_fill = NULL;
+  memset(jit->ibtc, 0, sizeof(jit->ibtc));
+  for (uint32_t i = 0; i < IBTC_SITES; ++i) {
+    for (uint32_t j = 0; j < IBTC_ENTRIES; ++j) {
+      jit->ibtc[i].ibtc[j].pc = 1;
+    }
+  }
+}
+
+// update the caches of the indirect branch exit we left by with its target
+// note: the caches belong to this core so the code reading them is not
+//       running while they are written
+static void ibtc_update(struct riscv_jit_t *jit, struct block_t *next) {
+  uint8_t *code = code_exec(&jit->cache->code, next->chain_entry);
+  // fill in the continuation of a call for its predicted return
+  if (jit->ras_fill) {
+    jit->ras_fill->code = code;
+    jit->ras_fill->pc = next->pc_start;
+    jit->ras_fill = NULL;
+  }
+  const struct block_exit_t *exit = jit->exit;
+  if (!exit || !exit->indirect) {
+    return;
+  }
+  struct ibtc_site_t *site = jit->ibtc + ibtc_site(exit->site_pc);
+  site->miss_pc = exit->site_pc;
+  site->misses++;
+  for (uint32_t i = 0; i < IBTC_ENTRIES; ++i) {
+    // we may have only come here as the cycle budget ran out
+    if (site->ibtc[i].pc == next->pc_start) {
+      return;
+    }
+  }
+  // replace the entries in turn, as branches sharing the cache may have
+  // filled it with targets which are no longer taken
+  struct ibtc_entry_t *entry = site->ibtc + site->next;
+  site->next = (site->next + 1) % IBTC_ENTRIES;
+  entry->code = code;
+  entry->pc = next->pc_start;
+}
+#endif
+
+#if RISCV_JIT_TRACE
+// stop recording a trace, restoring the cycle budget
+static void trace_stop(struct riscv_jit_t *jit) {
+  jit->trace.hot = NULL;
+  jit->cycles_target = jit->trace.cycles_target;
+}
+#endif
+
+// bring this cores state up to date after the cache was flushed
+// note: must hold exec_lock
+static void jit_sync(struct riscv_jit_t *jit) {
+  if (jit->generation == jit->cache->generation) {
+    return;
+  }
+  jit->generation = jit->cache->generation;
+  memset(jit->block_l1, 0, sizeof(jit->block_l1));
+  // forget the last exit taken (predictors live inside the blocks)
+  jit->exit = NULL;
+#if RISCV_JIT_TRACE
+  // the recorded blocks are gone too
+  if (jit->trace.hot) {
+    trace_stop(jit);
+  }
+#endif
+#if RISCV_JIT_IBTC
+  // the return stack and branch caches hold code inside the blocks
+  ibtc_clear(jit);
+#endif
 }
 
-static struct block_t *block_find_or_translate(struct riscv_t *rv, struct block_t *prev) {
+// flush the blockmap and code cache
+// note: must hold exec_lock exclusive
+// note: chained exits are discarded along with the code that holds them
+static void cache_clear(struct jit_cache_t *cache) {
+  block_map_clear(cache->block_map);
+  // reset the code buffer write position
+  memset(cache->code.start, 0xcc, cache->code.head - cache->code.start);
+  cache->code.head = cache->code.start;
+  cache->generation += 1;
+}
+
+// flush the full code cache once every core has left its blocks
+// note: must hold exec_lock shared which is dropped while waiting
+static void cache_flush(struct riscv_t *rv) {
+  struct riscv_jit_t *jit = &rv->jit;
+  struct jit_cache_t *cache = jit->cache;
+  unlock_shared(&cache->exec_lock);
+  lock_exclusive(&cache->exec_lock);
+  // another core may have flushed it while we waited
+  if (cache->generation == jit->generation) {
+    cache_clear(cache);
+    jit->cache_stats.flushes += 1;
+  }
+  unlock_exclusive(&cache->exec_lock);
+  lock_shared(&cache->exec_lock);
+  jit_sync(jit);
+}
+
+// translate a block for the current PC unless another core already has
+static struct block_t *block_translate(struct riscv_t *rv) {
+  struct jit_cache_t *cache = rv->jit.cache;
+  lock_exclusive(&cache->translate_lock);
+  struct block_t *next = block_map_find(cache, rv->PC);
+  if (!next) {
+    const bool empty = cache->code.head == cache->code.start;
+    next = block_alloc(cache);
+    if (next && rv_translate_block(rv, next)) {
+      block_finish(&rv->jit, next);
+    }
+    else {
+      assert(!empty && "block too large for the code cache");
+      next = NULL;
+    }
+  }
+  unlock_exclusive(&cache->translate_lock);
+  return next;
+}
+
+// lookup the block for the current PC translating it if needed
+// note: the code cache may be flushed, invalidating all blocks and exits
+static struct block_t *block_find_or_translate(struct riscv_t *rv) {
+  struct riscv_jit_t *jit = &rv->jit;
+  struct block_exit_t *prev = jit->exit;
   // lookup the next block in the block map
-  struct block_t *next = block_find(&rv->jit, rv->PC);
+  struct block_t *next = block_find(jit, rv->PC);
   // translate if we didnt find one
   if (!next) {
-    next = block_alloc(&rv->jit);
-    assert(next);
-    rv_translate_block(rv, next);
-    block_finish(&rv->jit, next);
+    while (!(next = block_translate(rv))) {
+      // the code cache is full so flush it and start over
+      cache_flush(rv);
+      prev = jit->exit;
+    }
     // update the block predictor
     // note: if the block predictor gives us a win when we
     //       translate a new block but gives us a huge penalty when
@@ -469,18 +1151,145 @@ static struct block_t *block_find_or_translate(struct riscv_t *rv, struct block_
       prev->predict = next;
     }
   }
+  // fill an empty prediction slot
+  else if (prev && !prev->predict) {
+    prev->predict = next;
+  }
   assert(next);
   return next;
 }
 
-static void rv_jit_dump_stats(struct riscv_t *rv) {
+#if RISCV_JIT_TRACE
+// chain an exit to a trace, replacing the block it may already be chained to
+static void trace_link(struct riscv_jit_t *jit, struct block_exit_t *exit, struct block_t *trace) {
+  if (!exit->jmp || exit->pc != trace->pc_start) {
+    return;
+  }
+  struct jit_cache_t *cache = jit->cache;
+  lock_exclusive(&cache->translate_lock);
+  cg_patch_rel32(exit->jmp, trace->chain_entry);
+  sys_flush_icache(code_exec(&cache->code, exit->jmp), 4);
+  exit->linked = true;
+  unlock_exclusive(&cache->translate_lock);
+}
+
+// translate the recorded trace unless another core already has, returning
+// NULL if it could not be built
+// note: a full code cache is left to be flushed by the next block translated
+static struct block_t *trace_translate(struct riscv_t *rv, bool loop) {
   struct riscv_jit_t *jit = &rv->jit;
+  struct jit_cache_t *cache = jit->cache;
+  struct code_buffer_t *code = &cache->code;
+  struct block_t *head = jit->trace.head;
+  lock_exclusive(&cache->translate_lock);
+  struct block_t *trace = head->trace;
+  if (!trace || trace == jit->trace.stale) {
+    trace = NULL;
+    // the side exits are placed ahead of the block
+    uint8_t *start = code->head;
+    code->head = (uint8_t *)(((uintptr_t)start + 15) & ~(uintptr_t)15);
+    struct block_exit_t *side = (struct block_exit_t *)code->head;
+    code->head += TRACE_MAX_BLOCKS * sizeof(struct block_exit_t);
+    struct block_t *block = (code->head < code->end) ? block_alloc(cache) : NULL;
+    if (block && rv_translate_trace(rv, block, side, loop)) {
+      struct cg_state_t *cg = &block->cg;
+      code->head = block->code + cg_size(cg);
+      sys_flush_icache(code_exec(code, block->code), cg_size(cg));
+      block->retrace = jit->trace.stale != NULL;
+      // the dispatcher runs the trace in place of its head from now on
+      store_release(&head->trace, block);
+      jit->cache_stats.traces += 1;
+      jit->cache_stats.bytes += cg_size(cg);
+      trace = block;
+    }
+    else {
+      code->head = start;
+    }
+  }
+  unlock_exclusive(&cache->translate_lock);
+  return trace;
+}
+
+// add the next block to the trace being recorded, returning the block to run
+// (the trace once the path loops back to its head)
+static struct block_t *trace_record(struct riscv_t *rv, struct block_t *next) {
+  struct riscv_jit_t *jit = &rv->jit;
+  struct trace_rec_t *rec = &jit->trace;
+  const bool loop = rec->count && next == rec->head;
+  // stop at other loops which have a trace
+  if (!loop && !(rec->count && next->trace) && rec->count < TRACE_MAX_BLOCKS &&
+      rec->instructions + next->instructions <= BLOCK_MAX_INSTS) {
+    rec->pc[rec->count++] = next->pc_start;
+    rec->instructions += next->instructions;
+    return next;
+  }
+  struct block_exit_t *hot = rec->hot;
+  trace_stop(jit);
+  struct block_t *trace = (loop || rec->count >= 2) ? trace_translate(rv, loop) : NULL;
+  if (!trace) {
+    // leave the counter to wrap around rather than retry soon
+    return next->trace ? next->trace : next;
+  }
+  trace_link(jit, hot, trace);
+  jit->trace_hot[hot->hot] = TRACE_THRESHOLD;
+  return next->trace ? next->trace : next;
+}
+
+// if an exit is a side exit of a trace which loops back to its head
+static bool trace_side_loops(const struct block_t *trace, const struct block_exit_t *exit) {
+  return exit >= trace->side && exit < trace->side + TRACE_MAX_BLOCKS && exit->pc == trace->pc_start;
+}
+
+// record a trace from the target of a backward exit once it has been taken
+// TRACE_THRESHOLD times, returning the block to run next
+static struct block_t *trace_dispatch(struct riscv_t *rv, struct block_t *next) {
+  struct riscv_jit_t *jit = &rv->jit;
+  struct trace_rec_t *rec = &jit->trace;
+  if (rec->hot) {
+    return trace_record(rv, next);
+  }
+  struct block_t *trace = (struct block_t *)load_acquire(&next->trace);
+  struct block_exit_t *exit = jit->exit;
+  if (!exit || !exit->counted || jit->trace_hot[exit->hot]) {
+    return trace ? trace : next;
+  }
+  // the loop may already have a trace the exit was not chained to, which is
+  // only recorded again if the loop took another path to the one recorded
+  if (trace && (trace->retrace || !trace_side_loops(trace, exit))) {
+    trace_link(jit, exit, trace);
+    jit->trace_hot[exit->hot] = TRACE_THRESHOLD;
+    return trace;
+  }
+  // return to the dispatcher after every block while recording
+  rec->hot = exit;
+  rec->head = next;
+  rec->stale = trace;
+  rec->count = 0;
+  rec->instructions = 0;
+  rec->cycles_target = jit->cycles_target;
+  jit->cycles_target = 0;
+  return trace_record(rv, next);
+}
+#endif
+
+// percentage of a total
+static double percent(uint64_t n, uint64_t total) {
+  return total ? (100.0 * n) / total : 0.0;
+}
+
+void rv_jit_dump_stats(struct riscv_t *rv) {
+  struct riscv_jit_t *jit = &rv->jit;
+  struct jit_cache_t *cache = jit->cache;
+  lock_shared(&cache->exec_lock);
+  lock_exclusive(&cache->translate_lock);
+  const struct block_map_t *map = cache->block_map;
 
   uint32_t num_blocks = 0;
-  uint32_t code_size = (uint32_t)(jit->code.head - jit->code.start);
+  uint32_t code_size = (uint32_t)(cache->code.head - cache->code.start);
+  uint64_t ib_hits = 0, ib_misses = 0;
 
-  for (uint32_t i = 0; i < jit->block_map.num_entries; ++i) {
-    struct block_t *block = jit->block_map.map[i];
+  for (uint32_t i = 0; i < map->num_entries; ++i) {
+    struct block_t *block = map->map[i];
     if (!block) {
       continue;
     }
@@ -494,58 +1303,132 @@ static void rv_jit_dump_stats(struct riscv_t *rv) {
 #endif
   }
 
+#if RISCV_JIT_IBTC
+  // note: hits are counted inline by the slot, so the branches hashed to a
+  //       slot are reported together
+  for (uint32_t i = 0; i < IBTC_SITES; ++i) {
+    const struct ibtc_site_t *site = jit->ibtc + i;
+    ib_hits += site->hits;
+    ib_misses += site->misses;
+    const uint32_t total = site->hits + site->misses;
+    if (total >= 1000) {
+      fprintf(stdout, "Indirect branch slot %u: %u taken, %.1f%% predicted, last miss at %08x\n",
+        i, total, percent(site->hits, total), site->miss_pc);
+    }
+  }
+#endif
+
   fprintf(stdout, "Number of blocks: %u\n", num_blocks);
   fprintf(stdout, "Code size: %u\n", code_size);
+  fprintf(stdout, "Cores sharing the code cache: %u\n", cache->refs);
+
+  const struct cache_stats_t *cs = &jit->cache_stats;
+  fprintf(stdout, "Code cache: %u flushes, %u blocks and %u traces translated, %llu bytes translated\n",
+    cs->flushes, cs->blocks, cs->traces, (unsigned long long)cs->bytes);
+
+  const struct lookup_stats_t *look = &jit->lookup_stats;
+  const uint64_t lookups = look->predict_hits + look->l1_hits + look->map_hits + look->misses;
+  fprintf(stdout, "Block lookups: %llu, predict %.1f%%, l1 %.1f%%, map %.1f%%, miss %.1f%%\n",
+    (unsigned long long)lookups,
+    percent(look->predict_hits, lookups), percent(look->l1_hits, lookups),
+    percent(look->map_hits, lookups), percent(look->misses, lookups));
+  fprintf(stdout, "Indirect branches: %llu, %.1f%% predicted inline\n",
+    (unsigned long long)(ib_hits + ib_misses), percent(ib_hits, ib_hits + ib_misses));
+  fprintf(stdout, "Block map: %u of %u entries\n", map->count, map->num_entries);
+
+  const struct opt_stats_t *opt = &jit->opt_stats;
+  fprintf(stdout, "Optimizer: const fuse %u, call fuse %u, addr fold %u, dead writes %u, const div %u, "
+    "branch fuse %u\n",
+    opt->fuse_const, opt->fuse_call, opt->fold_addr, opt->dead_write, opt->const_div, opt->fuse_branch);
+
+  unlock_exclusive(&cache->translate_lock);
+  unlock_shared(&cache->exec_lock);
 }
 
-// flush the blockmap and code cache
-static void rv_jit_clear(struct riscv_t *rv) {
-  struct riscv_jit_t *jit = &rv->jit;
-  // clear the block map
-  block_map_clear(&jit->block_map);
-  // reset the code buffer write position
-  jit->code.head = jit->code.start;
+void rv_set_page_table(struct riscv_t *rv, uint8_t **table) {
+  assert(rv);
+  struct jit_cache_t *cache = rv->jit.cache;
+  rv->jit.page_table = table;
+  // note: a hart may be added from inside rv_step of a core sharing the cache
+  //       so only lock when the mode actually changes
+  if (cache->host_mapped == (table != NULL)) {
+    return;
+  }
+  // existing blocks were translated for the other memory access path
+  lock_exclusive(&cache->exec_lock);
+  if (cache->host_mapped != (table != NULL)) {
+    cache->host_mapped = table != NULL;
+    cache_clear(cache);
+  }
+  unlock_exclusive(&cache->exec_lock);
 }
 
-void rv_step(struct riscv_t *rv, int32_t cycles) {
+void rv_set_host_baseline(struct riscv_t *rv) {
+  assert(rv);
+  rv->jit.host_features &= HOST_SSE2;
+}
 
-  // find or translate a block for our starting PC
-  struct block_t *block = block_find_or_translate(rv, NULL);
-  assert(block);
+void rv_step(struct riscv_t *rv, int32_t cycles) {
 
-  const uint64_t cycles_start = rv->csr_cycle;
   const uint64_t cycles_target = rv->csr_cycle + cycles;
+  rv->jit.cycles_target = cycles_target;
+
+  // hold off flushes from other cores while we are inside the code cache
+  struct jit_cache_t *cache = rv->jit.cache;
+  lock_shared(&cache->exec_lock);
+  jit_sync(&rv->jit);
+  // blocks assume the memory access path of the core that translated them
+  assert(cache->host_mapped == (rv->jit.page_table != NULL));
+#if RISCV_VM_SUPPORT_RV32F
+  // translated code runs with the host rounding mode following frm
+  const int host_round = fp_enter(rv);
+#endif
 
   // loop until we hit out cycle target
   while (rv->csr_cycle < cycles_target && !rv->halt) {
 
     const uint32_t pc = rv->PC;
 
-    // try to predict the next block
+    // try to predict the next block from the exit we left by
     // note: block predition gives us ~100 MIPS boost.
-    if (block->predict && block->predict->pc_start == pc) {
-      block = block->predict;
+    struct block_exit_t *exit = rv->jit.exit;
+    struct block_t *next;
+    if (exit && exit->predict && exit->predict->pc_start == pc) {
+      next = exit->predict;
+      rv->jit.lookup_stats.predict_hits++;
     }
     else {
       // lookup the next block in the block map or translate a new block
-      struct block_t *next = block_find_or_translate(rv, block);
-      // move onto the next block
-      block = next;
+      next = block_find_or_translate(rv);
     }
 
     // we should have a block by now
-    assert(block);
+    assert(next);
+
+#if RISCV_JIT_TRACE
+    // record hot loops and run the traces built from them
+    next = trace_dispatch(rv, next);
+#endif
+
+    // chain the exit to this block to bypass the dispatcher
+    // note: reloaded as a translation may have flushed the code cache
+    block_link(&rv->jit, rv->jit.exit, next);
+#if RISCV_JIT_IBTC
+    ibtc_update(&rv->jit, next);
+#endif
+    // move onto the next block
+    struct block_t *block = next;
 
     // call the translated block
     typedef void(*call_block_t)(struct riscv_t *);
 #if RISCV_JIT_PROFILE
     block->hit_count++;
 #endif
-    call_block_t c = (call_block_t)block->code;
+    call_block_t c = (call_block_t)code_exec(&cache->code, block->code);
     c(rv);
 
-    // increment the cycles csr
-    rv->csr_cycle += block->instructions;
+    // note: the block (and any blocks chained to it) have updated csr_cycle
+    //       from the cycle budget counted down in a host register
 
     // if this block has no instructions we cant make forward progress so
     // must fallback to instruction emulation
@@ -553,30 +1436,99 @@ void rv_step(struct riscv_t *rv, int32_t cycles) {
       assert(!"unable to execute empty block");
     }
   }
+
+#if RISCV_JIT_TRACE
+  // try again later if we stopped while recording
+  if (rv->jit.trace.hot) {
+    rv->jit.trace_hot[rv->jit.trace.hot->hot] = TRACE_THRESHOLD;
+    trace_stop(&rv->jit);
+  }
+#endif
+
+#if RISCV_VM_SUPPORT_RV32F
+  fp_leave(rv, host_round);
+#endif
+  unlock_shared(&cache->exec_lock);
+}
+
+// create an empty code cache
+static struct jit_cache_t *cache_create(void) {
+  struct jit_cache_t *cache = (struct jit_cache_t *)malloc(sizeof(struct jit_cache_t));
+  memset(cache, 0, sizeof(struct jit_cache_t));
+  // allocate block/code storage space
+  if (!code_buffer_acquire(&cache->code)) {
+    free(cache);
+    return NULL;
+  }
+  // allocate the block map which maps address to blocks
+  cache->block_map = block_map_alloc(map_size);
+  cache->refs = 1;
+  lock_init(&cache->exec_lock);
+  lock_init(&cache->translate_lock);
+  return cache;
+}
+
+// drop a cores reference to a code cache
+static void cache_release(struct jit_cache_t *cache) {
+  lock_exclusive(&cache->translate_lock);
+  const uint32_t refs = --cache->refs;
+  unlock_exclusive(&cache->translate_lock);
+  if (refs) {
+    return;
+  }
+  block_map_free(cache->block_map);
+  code_buffer_release(&cache->code);
+  lock_free(&cache->exec_lock);
+  lock_free(&cache->translate_lock);
+  free(cache);
 }
 
-bool rv_jit_init(struct riscv_t *rv) {
+bool rv_jit_init(struct riscv_t *rv, struct riscv_t *share) {
   struct riscv_jit_t *jit = &rv->jit;
 
-  // allocate the block map which maps address to blocks
-  if (jit->block_map.map == NULL) {
-    jit->block_map.num_entries = map_size;
-    block_map_alloc(&jit->block_map, map_size);
+  if (share) {
+    // use the code cache of an existing core
+    jit->cache = share->jit.cache;
+    lock_exclusive(&jit->cache->translate_lock);
+    jit->cache->refs += 1;
+    unlock_exclusive(&jit->cache->translate_lock);
+  }
+  else {
+    jit->cache = cache_create();
+    if (!jit->cache) {
+      return false;
+    }
   }
+  jit->generation = jit->cache->generation;
+  // cores sharing code must agree on the host instructions it may use
+  jit->host_features = share ? share->jit.host_features : sys_host_features();
 
-  // allocate block/code storage space
-  if (jit->code.start == NULL) {
-    void *ptr = sys_alloc_exec_mem(code_size);
-    memset(ptr, 0xcc, code_size);
-    jit->code.start = ptr;
-    jit->code.head = ptr;
-    jit->code.end = jit->code.start + code_size;
+#if RISCV_JIT_IBTC
+  ibtc_clear(jit);
+#endif
+#if RISCV_JIT_TRACE
+  for (uint32_t i = 0; i < TRACE_COUNTERS; ++i) {
+    jit->trace_hot[i] = TRACE_THRESHOLD;
   }
+#endif
 
   // setup nonjit instruction callbacks
-  jit->handle_op_op     = handle_op_op;
+#if RISCV_VM_SUPPORT_RV32F
   jit->handle_op_fp     = handle_op_fp;
+  jit->handle_op_fma    = handle_op_fma;
+  jit->handle_op_rmm    = handle_op_rmm;
+#endif
+#if RISCV_VM_SUPPORT_RV32D
+  jit->handle_fld       = handle_fld;
+  jit->handle_fsd       = handle_fsd;
+#endif
   jit->handle_op_system = handle_op_system;
+#if RISCV_VM_SUPPORT_RV32A
+  jit->handle_op_amo    = handle_op_amo;
+#endif
+#if RISCV_VM_SUPPORT_RVV
+  jit->handle_op_v      = handle_op_v;
+#endif
 
   return true;
 }
@@ -584,17 +1536,14 @@ bool rv_jit_init(struct riscv_t *rv) {
 void rv_jit_free(struct riscv_t *rv) {
   struct riscv_jit_t *jit = &rv->jit;
 
+  if (!jit->cache) {
+    return;
+  }
+
 #if RISCV_DUMP_JIT_BLOCK
   rv_jit_dump_stats(rv);
 #endif
 
-  if (jit->block_map.map) {
-    block_map_free(&jit->block_map);
-    jit->block_map.map = NULL;
-  }
-
-  if (jit->code.start) {
-    sys_free_exec_mem(jit->code.start);
-    jit->code.start = NULL;
-  }
+  cache_release(jit->cache);
+  jit->cache = NULL;
 }
@@ -1,5 +1,7 @@
 #pragma once
 #include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
 
 #include "riscv_conf.h"
 #include "riscv.h"
@@ -8,12 +10,20 @@
 
 #define RV_NUM_REGS 32
 
+// size of a host mapped memory page in bits
+#define RV_PAGE_BITS 16
+
 // csrs
 enum {
   // floating point
   CSR_FFLAGS     = 0x001,
   CSR_FRM        = 0x002,
   CSR_FCSR       = 0x003,
+  // vector
+  CSR_VSTART     = 0x008,
+  CSR_VL         = 0xC20,
+  CSR_VTYPE      = 0xC21,
+  CSR_VLENB      = 0xC22,
   // machine trap status
   CSR_MSTATUS    = 0x300,
   CSR_MISA       = 0x301,
@@ -28,6 +38,11 @@ enum {
   CSR_MCAUSE     = 0x342,
   CSR_MTVAL      = 0x343,
   CSR_MIP        = 0x344,
+  // machine counters
+  CSR_MCYCLE     = 0xB00,
+  CSR_MINSTRET   = 0xB02,
+  CSR_MCYCLEH    = 0xB80,
+  CSR_MINSTRETH  = 0xB82,
   // low words
   CSR_CYCLE      = 0xC00,
   CSR_TIME       = 0xC01,
@@ -43,6 +58,13 @@ enum {
   CSR_MHARTID    = 0xF14,
 };
 
+// low bits of the PC which must be clear for an instruction fetch
+#if RISCV_VM_SUPPORT_RVC
+#define PC_ALIGN_MASK 1u
+#else
+#define PC_ALIGN_MASK 3u
+#endif
+
 // instruction decode masks
 enum {
   //               ....xxxx....xxxx....xxxx....xxxx
@@ -82,9 +104,138 @@ enum {
   FMASK_SIGN = 0b10000000000000000000000000000000,
   FMASK_EXPN = 0b01111111100000000000000000000000,
   FMASK_FRAC = 0b00000000011111111111111111111111,
+  FMASK_QNAN = 0b00000000010000000000000000000000,
   //             ........xxxxxxxx........xxxxxxxx
 };
 
+// the nan written by any float operation which produces one
+#define FP_CANONICAL_NAN 0x7fc00000
+
+// the same for double operations
+#define DMASK_SIGN         0x8000000000000000ull
+#define DMASK_EXPN         0x7ff0000000000000ull
+#define DMASK_FRAC         0x000fffffffffffffull
+#define DMASK_QNAN         0x0008000000000000ull
+#define FP_CANONICAL_NAN_D 0x7ff8000000000000ull
+
+// the high half of a float register holding a single (nan boxing it)
+#define FP_NAN_BOX 0xffffffffu
+
+// size of a vector register in bytes
+#define RV_VLENB (RISCV_VM_VLEN / 8)
+
+// vtype fields
+#define VTYPE_VLMUL 0x00000007u
+#define VTYPE_VSEW  0x00000038u
+#define VTYPE_VTA   0x00000040u
+#define VTYPE_VMA   0x00000080u
+#define VTYPE_VILL  0x80000000u
+
+// rounding modes
+enum {
+  RM_RNE = 0b000,  // nearest, ties to even
+  RM_RTZ = 0b001,  // towards zero
+  RM_RDN = 0b010,  // down
+  RM_RUP = 0b011,  // up
+  RM_RMM = 0b100,  // nearest, ties to max magnitude
+  RM_DYN = 0b111,  // frm
+};
+
+// accrued exception flags (fflags)
+enum {
+  FFLAG_NX = 1 << 0,  // inexact
+  FFLAG_UF = 1 << 1,  // underflow
+  FFLAG_OF = 1 << 2,  // overflow
+  FFLAG_DZ = 1 << 3,  // divide by zero
+  FFLAG_NV = 1 << 4,  // invalid operation
+};
+
+// maximum number of static exits a block can have
+#define BLOCK_MAX_EXITS 2
+
+// number of targets cached inline at each indirect branch
+#define IBTC_ENTRIES 4
+
+// number of indirect branch target caches, shared by the indirect branches
+// hashed to each (must be a power of 2)
+#define IBTC_SITES 1024
+
+// number of call continuations, shared by the return addresses hashed to
+// each (must be a power of 2)
+#define RAS_CONTINUATIONS 256
+
+// depth of the guest return address stack (must be a power of 2)
+#define RAS_ENTRIES 16
+
+// number of times a backward exit is taken before a trace is recorded from
+// its target
+#define TRACE_THRESHOLD 1024
+
+// number of trace counters, shared by the backward exits hashed to each (must
+// be a power of 2)
+#define TRACE_COUNTERS 1024
+
+// maximum number of blocks recorded into a trace
+#define TRACE_MAX_BLOCKS 16
+
+// an indirect branch target cached inline by an exit
+struct ibtc_entry_t {
+  // guest address of the target (odd when the entry is empty)
+  uint32_t pc;
+  // chain entry of the target block
+  uint8_t *code;
+};
+
+// a slot of target caches shared by the indirect branches hashed to it
+struct ibtc_site_t {
+  struct ibtc_entry_t ibtc[IBTC_ENTRIES];
+  // next entry to replace
+  uint32_t next;
+  // guest address of the last branch to miss, and the prediction accuracy of
+  // every branch in the slot
+  uint32_t miss_pc;
+  uint32_t hits;
+  uint32_t misses;
+};
+
+// an exit from a block which can be chained to its successor
+struct block_exit_t {
+  // guest address of the successor block
+  uint32_t pc;
+  // true once the exit jumps directly to its successor
+  bool linked;
+  // true if the exit is an indirect branch with a target cache
+  bool indirect;
+  // displacement of the patchable jump (NULL if the successor is dynamic)
+  uint8_t *jmp;
+  // next block prediction for this exit
+  struct block_t *predict;
+  // for indirect branches, their guest address
+  uint32_t site_pc;
+  // true for backward exits, which count down the trace counter hot each
+  // time they are taken and ask the dispatcher to record a trace at zero
+  bool counted;
+  uint32_t hot;
+};
+
+// index of the target cache of the indirect branch at pc
+static inline uint32_t ibtc_site(uint32_t pc) {
+  return (pc >> 1) & (IBTC_SITES - 1);
+}
+
+// index of the continuation of the calls returning to pc
+static inline uint32_t ras_cont(uint32_t pc) {
+  return (pc >> 1) & (RAS_CONTINUATIONS - 1);
+}
+
+// a guest return address pushed by a call
+struct ras_entry_t {
+  // guest return address (odd when the entry is empty)
+  uint32_t pc;
+  // continuation the return address is hashed to
+  struct ibtc_entry_t *code;
+};
+
 // a translated basic block
 struct block_t {
   // number of instructions encompased
@@ -92,8 +243,18 @@ struct block_t {
   // address range of the basic block
   uint32_t pc_start;
   uint32_t pc_end;
-  // static next block prediction
-  struct block_t *predict;
+  // exits which can be chained to successor blocks
+  struct block_exit_t exits[BLOCK_MAX_EXITS];
+  uint32_t num_exits;
+  // entry point for chained blocks (after the prologue)
+  uint8_t *chain_entry;
+  // trace translated from a hot loop starting at this block, run in its
+  // place by the dispatcher (or NULL)
+  struct block_t *trace;
+  // for a trace, its side exits off the recorded path (NULL for a block) and
+  // if it replaced a trace whose side exits kept looping back to its head
+  struct block_exit_t *side;
+  bool retrace;
   // code gen structure
   struct cg_state_t cg;
 #if RISCV_JIT_PROFILE
@@ -107,29 +268,174 @@ struct block_t {
 struct block_map_t {
   // max number of entries in the block map
   uint32_t num_entries;
+  // number of occupied entries
+  uint32_t count;
   // block map
   struct block_t **map;
+  // smaller maps this one replaced which lookups may still be reading
+  struct block_map_t *retired;
+};
+
+// number of entries in the direct mapped block lookup cache
+#define BLOCK_L1_ENTRIES 1024
+
+// block lookup statistics for each level of the dispatcher
+struct lookup_stats_t {
+  // next block found via the exit predictor
+  uint64_t predict_hits;
+  // next block found in the direct mapped cache
+  uint64_t l1_hits;
+  // next block found in the block map
+  uint64_t map_hits;
+  // next block had to be translated
+  uint64_t misses;
 };
 
 struct code_buffer_t {
-  // memory range for code buffer
+  // memory range for code buffer (the writable view)
   uint8_t *start;
   uint8_t *end;
   // code buffer write point
   uint8_t *head;
+  // the executable view of an address is at address + exec_offset
+  ptrdiff_t exec_offset;
+};
+
+// code cache statistics
+struct cache_stats_t {
+  // number of times the code cache filled up and was flushed
+  uint32_t flushes;
+  // number of blocks and bytes of code translated
+  uint32_t blocks;
+  uint64_t bytes;
+  // number of traces translated
+  uint32_t traces;
+};
+
+// a path through consecutive blocks being recorded as a trace
+struct trace_rec_t {
+  // exit whose counter started the recording (NULL when not recording)
+  struct block_exit_t *hot;
+  // block the trace starts from and any trace of it being replaced
+  struct block_t *head;
+  struct block_t *stale;
+  // start address of each block recorded
+  uint32_t pc[TRACE_MAX_BLOCKS];
+  uint32_t count;
+  // number of guest instructions recorded
+  uint32_t instructions;
+  // cycle target to restore once recording stops
+  uint64_t cycles_target;
 };
 
+// block optimizer hit counts
+struct opt_stats_t {
+  // lui/auipc + addi fused into a constant
+  uint32_t fuse_const;
+  // auipc + jalr fused into a direct call
+  uint32_t fuse_call;
+  // lui/auipc + load/store folded into an absolute address
+  uint32_t fold_addr;
+  // register writes removed as they are overwritten before use
+  uint32_t dead_write;
+  // div/rem by a constant reduced to shifts and multiplies
+  uint32_t const_div;
+  // branches on a register using the flags left by the instruction setting it
+  uint32_t fuse_branch;
+};
+
+// optional host instruction set extensions used by the jit
+enum {
+  HOST_SSE41  = 1 << 0,
+  HOST_FMA    = 1 << 1,
+  HOST_POPCNT = 1 << 2,
+  HOST_LZCNT  = 1 << 3,
+  HOST_BMI1   = 1 << 4,
+  HOST_SSE2   = 1 << 5,
+  HOST_AVX2   = 1 << 6,
+};
+
+// lr.w address when no reservation is held (never a word address)
+#define LR_NO_RESERVATION 1u
+
+// translated code which can be shared between cores (defined in riscv_jit.c)
+struct jit_cache_t;
+
+// decoded blocks run by the interpreter (defined in riscv.c)
+struct interp_cache_t;
+
 struct riscv_jit_t {
-  // code buffer
-  struct code_buffer_t code;
-  // block hash map
-  struct block_map_t block_map;
-  // handler for non jitted op_op instructions
-  void(*handle_op_op)(struct riscv_t *, uint32_t);
+  // translated code cache, possibly shared with other cores
+  struct jit_cache_t *cache;
+  // cache generation the per core state below refers to
+  uint32_t generation;
+  // direct mapped PC to block cache checked before the block map
+  struct block_t *block_l1[BLOCK_L1_ENTRIES];
+  // optional host mapped memory pages
+  uint8_t **page_table;
+  // chained blocks return to the dispatcher once csr_cycle reaches this
+  uint64_t cycles_target;
+  // block exit last taken back to the dispatcher (or NULL)
+  struct block_exit_t *exit;
+  // guest return address stack
+  struct ras_entry_t ras[RAS_ENTRIES];
+  uint32_t ras_top;
+  // chain entries of the blocks calls return to, hashed by return address
+  struct ibtc_entry_t ras_cont[RAS_CONTINUATIONS];
+  // call continuation to fill in once the predicted return target is found
+  struct ibtc_entry_t *ras_fill;
+  // indirect branch target caches, hashed by the address of the branch
+  // note: like the trace counters these are written as the code runs so are
+  //       kept out of the code buffer
+  struct ibtc_site_t ibtc[IBTC_SITES];
+  // trace being recorded
+  struct trace_rec_t trace;
+  // trace counters, kept out of the code buffer as writes to pages holding
+  // code are treated as self modifying code
+  uint32_t trace_hot[TRACE_COUNTERS];
+  // code cache statistics
+  struct cache_stats_t cache_stats;
+  // block lookup statistics
+  struct lookup_stats_t lookup_stats;
+  // optimizer statistics
+  struct opt_stats_t opt_stats;
+  // HOST_ flags for extensions the code generator may emit
+  uint32_t host_features;
+#if RISCV_VM_SUPPORT_RV32F
+  // mxcsr scratch and the value it held before a static rounding mode was
+  // set, so the dynamic rounding mode can be restored
+  uint32_t mxcsr;
+  uint32_t mxcsr_dyn;
+#endif
+  // handlers for non jitted instructions
   void(*handle_op_fp)(struct riscv_t *, uint32_t);
+  void(*handle_op_fma)(struct riscv_t *, uint32_t);
+  void(*handle_op_rmm)(struct riscv_t *, uint32_t);
   void(*handle_op_system)(struct riscv_t *, uint32_t);
+  void(*handle_op_amo)(struct riscv_t *, uint32_t);
+#if RISCV_VM_SUPPORT_RV32D
+  void(*handle_fld)(struct riscv_t *, uint32_t, uint32_t);
+  void(*handle_fsd)(struct riscv_t *, uint32_t, uint32_t);
+#endif
+#if RISCV_VM_SUPPORT_RVV
+  void(*handle_op_v)(struct riscv_t *, uint32_t);
+#endif
 };
 
+#if RISCV_VM_SUPPORT_RV32F
+// a float register, wide enough for a double.  a single is held in the low
+// half with the high half all ones, so it reads as a nan if used as a double.
+// note: singles are read from the low half without checking the box.
+union riscv_freg_t {
+  uint64_t bits;
+  double d;
+  struct {
+    float f;
+    uint32_t box;
+  };
+};
+#endif  // RISCV_VM_SUPPORT_RV32F
+
 struct riscv_t {
 
   bool halt;
@@ -144,10 +450,19 @@ struct riscv_t {
 
 #if RISCV_VM_SUPPORT_RV32F
   // float registers
-  riscv_float_t F[RV_NUM_REGS];
+  union riscv_freg_t F[RV_NUM_REGS];
   uint32_t csr_fcsr;
 #endif  // RISCV_VM_SUPPORT_RV32F
 
+#if RISCV_VM_SUPPORT_RVV
+  // vector registers, adjacent so a register group is a run of bytes
+  uint8_t V[RV_NUM_REGS][RV_VLENB];
+  uint32_t csr_vstart;
+  uint32_t csr_vl;
+  uint32_t csr_vtype;
+  uint32_t csr_vlenb;
+#endif  // RISCV_VM_SUPPORT_RVV
+
   // csr registers
   uint64_t csr_cycle;
   uint32_t csr_mstatus;
@@ -159,9 +474,20 @@ struct riscv_t {
   uint32_t csr_mepc;
   uint32_t csr_mip;
   uint32_t csr_mbadaddr;
+  uint32_t csr_mhartid;
+
+#if RISCV_VM_SUPPORT_RV32A
+  // word reserved by lr.w (or LR_NO_RESERVATION) and the value it read, which
+  // sc.w checks is still in memory
+  uint32_t lr_addr;
+  uint32_t lr_value;
+#endif  // RISCV_VM_SUPPORT_RV32A
 
   // jit specific data
   struct riscv_jit_t jit;
+  // interpreter specific data
+  uint32_t interp_type;
+  struct interp_cache_t *interp;
 };
 
 // decode rd field
@@ -254,6 +580,57 @@ static inline uint32_t sign_extend_b(uint32_t x) {
   return (int32_t)((int8_t)x);
 }
 
+// count the leading zero bits (32 for zero)
+static inline uint32_t calc_clz(uint32_t x) {
+#if defined(__GNUC__)
+  return x ? (uint32_t)__builtin_clz(x) : 32;
+#else
+  uint32_t n = 0;
+  for (; n < 32 && !(x & 0x80000000u); ++n, x <<= 1);
+  return n;
+#endif
+}
+
+// count the trailing zero bits (32 for zero)
+static inline uint32_t calc_ctz(uint32_t x) {
+#if defined(__GNUC__)
+  return x ? (uint32_t)__builtin_ctz(x) : 32;
+#else
+  uint32_t n = 0;
+  for (; n < 32 && !(x & 1); ++n, x >>= 1);
+  return n;
+#endif
+}
+
+// count the set bits
+static inline uint32_t calc_cpop(uint32_t x) {
+  x = x - ((x >> 1) & 0x55555555u);
+  x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+  x = (x + (x >> 4)) & 0x0f0f0f0fu;
+  return (x * 0x01010101u) >> 24;
+}
+
+// rotate left and right, using the low 5 bits of the shift
+static inline uint32_t calc_rol(uint32_t x, uint32_t shamt) {
+  shamt &= 0x1f;
+  return shamt ? ((x << shamt) | (x >> (32 - shamt))) : x;
+}
+static inline uint32_t calc_ror(uint32_t x, uint32_t shamt) {
+  shamt &= 0x1f;
+  return shamt ? ((x >> shamt) | (x << (32 - shamt))) : x;
+}
+
+// set each byte to 0xff if any of its bits are set (orc.b)
+static inline uint32_t calc_orcb(uint32_t x) {
+  const uint32_t high = (((x & 0x7f7f7f7fu) + 0x7f7f7f7fu) | x) & 0x80808080u;
+  return (high >> 7) * 0xff;
+}
+
+// reverse the byte order (rev8)
+static inline uint32_t calc_rev8(uint32_t x) {
+  return (x >> 24) | ((x >> 8) & 0xff00u) | ((x << 8) & 0xff0000u) | (x << 24);
+}
+
 // compute the fclass result
 static inline uint32_t calc_fclass(uint32_t f) {
   const uint32_t sign = f & FMASK_SIGN;
@@ -266,7 +643,7 @@ static inline uint32_t calc_fclass(uint32_t f) {
   // 0x001    rs1 is -INF
   out |= (f == 0xff800000) ? 0x001 : 0;
   // 0x002    rs1 is negative normal
-  out |= (expn && expn < 0x78000000 && sign) ? 0x002 : 0;
+  out |= (expn && expn != FMASK_EXPN && sign) ? 0x002 : 0;
   // 0x004    rs1 is negative subnormal
   out |= (!expn && frac && sign) ? 0x004 : 0;
   // 0x008    rs1 is -0
@@ -276,17 +653,34 @@ static inline uint32_t calc_fclass(uint32_t f) {
   // 0x020    rs1 is positive subnormal
   out |= (!expn && frac && !sign) ? 0x020 : 0;
   // 0x040    rs1 is positive normal
-  out |= (expn && expn < 0x78000000 && !sign) ? 0x040 : 0;
+  out |= (expn && expn != FMASK_EXPN && !sign) ? 0x040 : 0;
   // 0x080    rs1 is +INF
   out |= (f == 0x7f800000) ? 0x080 : 0;
   // 0x100    rs1 is a signaling NaN
-  out |= (expn == FMASK_EXPN && (frac <= 0x7ff) && frac) ? 0x100 : 0;
+  out |= (expn == FMASK_EXPN && !(frac & FMASK_QNAN) && frac) ? 0x100 : 0;
   // 0x200    rs1 is a quiet NaN
-  out |= (expn == FMASK_EXPN && (frac >= 0x800)) ? 0x200 : 0;
+  out |= (expn == FMASK_EXPN && (frac & FMASK_QNAN)) ? 0x200 : 0;
 
   return out;
 }
 
+// compute the fclass.d result
+static inline uint32_t calc_fclass_d(uint64_t d) {
+  const bool sign = (d & DMASK_SIGN) != 0;
+  const uint64_t expn = d & DMASK_EXPN;
+  const uint64_t frac = d & DMASK_FRAC;
+  if (expn == DMASK_EXPN) {
+    if (frac) {
+      // signaling or quiet nan
+      return (frac & DMASK_QNAN) ? 0x200 : 0x100;
+    }
+    return sign ? 0x001 : 0x080;
+  }
+  // negative classes from -inf upwards mirror the positive ones from +inf
+  const uint32_t k = expn ? 1 : frac ? 2 : 3;
+  return sign ? (1u << k) : (0x80u >> k);
+}
+
 void rv_except_inst_misaligned(struct riscv_t *rv, uint32_t old_pc);
 void rv_except_load_misaligned(struct riscv_t *rv, uint32_t addr);
 void rv_except_store_misaligned(struct riscv_t *rv, uint32_t addr);
@@ -296,5 +690,117 @@ uint32_t csr_csrrw(struct riscv_t *rv, uint32_t csr, uint32_t val);
 uint32_t csr_csrrs(struct riscv_t *rv, uint32_t csr, uint32_t val);
 uint32_t csr_csrrc(struct riscv_t *rv, uint32_t csr, uint32_t val);
 
-bool rv_jit_init(struct riscv_t *rv);
+#if RISCV_VM_SUPPORT_RV32F
+// float instructions run on the host fpu with its rounding mode following
+// frm and its exception flags accrued into fflags when fflags is read, so
+// guest code must run between fp_enter and fp_leave
+int fp_enter(struct riscv_t *rv);
+void fp_leave(struct riscv_t *rv, int host_round);
+// set the host rounding mode for a static rounding mode
+int fp_round_set(uint32_t rm);
+void fp_round_restore(int round);
+// fcvt.w.s and fcvt.wu.s (and their double forms, as singles widen exactly)
+uint32_t fp_cvt_w(struct riscv_t *rv, double f, uint32_t rm, bool is_unsigned);
+// fmin.s and fmax.s
+float fp_minmax(struct riscv_t *rv, float a, float b, bool is_max);
+// fused multiply add of a * b and c, rounded once
+float fp_fma(struct riscv_t *rv, float a, float b, float c);
+// the arithmetic fp_rmm rounds
+enum {
+  FP_RMM_ADD,  // a + b
+  FP_RMM_SUB,  // a - b
+  FP_RMM_MUL,  // a * b
+  FP_RMM_DIV,  // a / b
+  FP_RMM_FMA,  // a * b + c
+  FP_RMM_CVT,  // a
+};
+// round op on a, b and c to nearest with ties to max magnitude given rne, the
+// host result of rounding it to nearest even, as the host has no such mode
+float fp_rmm(uint32_t op, float rne, double a, double b, double c);
+#if RISCV_VM_SUPPORT_RV32D
+// fmin.d and fmax.d
+double fp_minmax_d(struct riscv_t *rv, double a, double b, bool is_max);
+// fused multiply add of doubles, as fp_fma
+double fp_fma_d(struct riscv_t *rv, double a, double b, double c);
+// fp_rmm for double results
+double fp_rmm_d(uint32_t op, double rne, double a, double b, double c);
+#endif
+
+// round the next operation as rm says, returning the host rounding mode to
+// restore after it (or -1 when rm is dyn, as the host already follows frm)
+static inline int fp_round_begin(uint32_t rm) {
+  return (rm == RM_DYN) ? -1 : fp_round_set(rm);
+}
+
+static inline void fp_round_end(int round) {
+  if (round >= 0) {
+    fp_round_restore(round);
+  }
+}
+
+// if rm, or frm when rm is dyn, rounds to nearest with ties to max magnitude
+static inline bool fp_is_rmm(const struct riscv_t *rv, uint32_t rm) {
+  return rm == RM_RMM || (rm == RM_DYN && ((rv->csr_fcsr >> 5) & 0b111) == RM_RMM);
+}
+
+// replace any nan result with the canonical nan
+static inline float fp_canonical(float f) {
+  if (f != f) {
+    const uint32_t bits = FP_CANONICAL_NAN;
+    memcpy(&f, &bits, sizeof(f));
+  }
+  return f;
+}
+
+// write a single to a float register, nan boxing it
+static inline void fp_write_s(struct riscv_t *rv, uint32_t rd, float f) {
+  rv->F[rd].f = f;
+  rv->F[rd].box = FP_NAN_BOX;
+}
+
+// write the bits of a single to a float register, nan boxing them
+static inline void fp_write_w(struct riscv_t *rv, uint32_t rd, uint32_t bits) {
+  rv->F[rd].bits = ((uint64_t)FP_NAN_BOX << 32) | bits;
+}
+
+#if RISCV_VM_SUPPORT_RV32D
+// replace any nan double result with the canonical nan
+static inline double fp_canonical_d(double d) {
+  if (d != d) {
+    const uint64_t bits = FP_CANONICAL_NAN_D;
+    memcpy(&d, &bits, sizeof(d));
+  }
+  return d;
+}
+
+// fld and fsd through the io interface, as two word accesses since the
+// halves may not be mapped together
+static inline uint64_t fp_read_d(struct riscv_t *rv, uint32_t addr) {
+  const uint64_t lo = rv->io.mem_read_w(rv, addr);
+  const uint64_t hi = rv->io.mem_read_w(rv, addr + 4);
+  return lo | (hi << 32);
+}
+
+static inline void fp_write_d(struct riscv_t *rv, uint32_t addr, uint64_t bits) {
+  rv->io.mem_write_w(rv, addr, (uint32_t)bits);
+  rv->io.mem_write_w(rv, addr + 4, (uint32_t)(bits >> 32));
+}
+#endif  // RISCV_VM_SUPPORT_RV32D
+#endif  // RISCV_VM_SUPPORT_RV32F
+
+#if RISCV_VM_SUPPORT_RVV
+// run a vector instruction (op-v, or a load-fp or store-fp of a vector
+// width), returning false if it is illegal.  host holds the HOST_ flags of
+// the simd kernels it may use, or 0 to run on the portable loops alone.
+bool vec_exec(struct riscv_t *rv, uint32_t inst, uint32_t host);
+#endif  // RISCV_VM_SUPPORT_RVV
+
+#if RISCV_VM_SUPPORT_RV32A
+uint32_t amo_lrw(struct riscv_t *rv, uint32_t addr);
+uint32_t amo_scw(struct riscv_t *rv, uint32_t addr, uint32_t val);
+bool amo_rmw(struct riscv_t *rv, uint32_t funct5, uint32_t addr, uint32_t val, uint32_t *out);
+#endif  // RISCV_VM_SUPPORT_RV32A
+
+bool rv_jit_init(struct riscv_t *rv, struct riscv_t *share);
 void rv_jit_free(struct riscv_t *rv);
+void rv_jit_dump_stats(struct riscv_t *rv);
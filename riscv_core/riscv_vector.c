@@ -0,0 +1,1222 @@
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "riscv.h"
+#include "riscv_private.h"
+
+#if RISCV_VM_SUPPORT_RVV
+
+// the simd kernels are written for x64 hosts
+#if defined(__x86_64__) || defined(_M_X64)
+#define VEC_X64 1
+#include <immintrin.h>
+#else
+#define VEC_X64 0
+#endif
+
+// kernels using extensions beyond sse2 are compiled for them alone, being
+// called only once the host is known to support them
+#if defined(__GNUC__)
+#define VEC_TARGET(x) __attribute__((target(x)))
+#else
+#define VEC_TARGET(x)
+#endif
+
+// note: elements are held little endian in the vector registers, as they are
+//       on the host, so they are read and written with memcpy.  this is a
+//       Zve32f subset, ELEN being 32, with tail and masked off elements left
+//       undisturbed whatever the policy bits of vtype ask for.
+
+// operations run on each element, with a and b the first and second source
+// operands (vs2, and vs1 or the scalar) and d the old destination element
+enum {
+  VOP_NONE,
+  // integer
+  VOP_ADD,
+  VOP_SUB,
+  VOP_RSUB,
+  VOP_MINU,
+  VOP_MIN,
+  VOP_MAXU,
+  VOP_MAX,
+  VOP_AND,
+  VOP_OR,
+  VOP_XOR,
+  VOP_SLL,
+  VOP_SRL,
+  VOP_SRA,
+  VOP_MERGE,
+  VOP_MUL,
+  VOP_MULH,
+  VOP_MULHU,
+  VOP_MULHSU,
+  VOP_DIVU,
+  VOP_DIV,
+  VOP_REMU,
+  VOP_REM,
+  VOP_MACC,
+  VOP_NMSAC,
+  VOP_MADD,
+  VOP_NMSUB,
+  // float
+  VOP_FADD,
+  VOP_FSUB,
+  VOP_FRSUB,
+  VOP_FMUL,
+  VOP_FDIV,
+  VOP_FRDIV,
+  VOP_FMIN,
+  VOP_FMAX,
+  VOP_FSGNJ,
+  VOP_FSGNJN,
+  VOP_FSGNJX,
+  VOP_FMERGE,
+  VOP_FMACC,
+  VOP_FNMACC,
+  VOP_FMSAC,
+  VOP_FNMSAC,
+  VOP_FMADD,
+  VOP_FNMADD,
+  VOP_FMSUB,
+  VOP_FNMSUB,
+  VOP_FSQRT,
+  VOP_FCLASS,
+  VOP_FCVT_XU_F,
+  VOP_FCVT_X_F,
+  VOP_FCVT_F_XU,
+  VOP_FCVT_F_X,
+  VOP_FCVT_RTZ_XU_F,
+  VOP_FCVT_RTZ_X_F,
+  // compares, which write a mask
+  VOP_MSEQ,
+  VOP_MSNE,
+  VOP_MSLTU,
+  VOP_MSLT,
+  VOP_MSLEU,
+  VOP_MSLE,
+  VOP_MSGTU,
+  VOP_MSGT,
+  VOP_MFEQ,
+  VOP_MFNE,
+  VOP_MFLT,
+  VOP_MFLE,
+  VOP_MFGT,
+  VOP_MFGE,
+  // permutations
+  VOP_SLIDEUP,
+  VOP_SLIDEDOWN,
+  VOP_MVNR,
+};
+
+// operand forms an operation has, by funct3 of op-v
+enum {
+  VF_VV = 1 << 0,  // opivv, opmvv or opfvv
+  VF_VX = 1 << 1,  // opivx, opmvx or opfvf
+  VF_VI = 1 << 2,  // opivi
+};
+
+struct vec_opdef_t {
+  uint8_t op;
+  uint8_t forms;
+};
+
+// opivv, opivx and opivi by funct6
+static const struct vec_opdef_t opi_defs[64] = {
+  [0b000000] = { VOP_ADD,       VF_VV | VF_VX | VF_VI },
+  [0b000010] = { VOP_SUB,       VF_VV | VF_VX },
+  [0b000011] = { VOP_RSUB,      VF_VX | VF_VI },
+  [0b000100] = { VOP_MINU,      VF_VV | VF_VX },
+  [0b000101] = { VOP_MIN,       VF_VV | VF_VX },
+  [0b000110] = { VOP_MAXU,      VF_VV | VF_VX },
+  [0b000111] = { VOP_MAX,       VF_VV | VF_VX },
+  [0b001001] = { VOP_AND,       VF_VV | VF_VX | VF_VI },
+  [0b001010] = { VOP_OR,        VF_VV | VF_VX | VF_VI },
+  [0b001011] = { VOP_XOR,       VF_VV | VF_VX | VF_VI },
+  [0b001110] = { VOP_SLIDEUP,   VF_VX | VF_VI },
+  [0b001111] = { VOP_SLIDEDOWN, VF_VX | VF_VI },
+  [0b010111] = { VOP_MERGE,     VF_VV | VF_VX | VF_VI },
+  [0b011000] = { VOP_MSEQ,      VF_VV | VF_VX | VF_VI },
+  [0b011001] = { VOP_MSNE,      VF_VV | VF_VX | VF_VI },
+  [0b011010] = { VOP_MSLTU,     VF_VV | VF_VX },
+  [0b011011] = { VOP_MSLT,      VF_VV | VF_VX },
+  [0b011100] = { VOP_MSLEU,     VF_VV | VF_VX | VF_VI },
+  [0b011101] = { VOP_MSLE,      VF_VV | VF_VX | VF_VI },
+  [0b011110] = { VOP_MSGTU,     VF_VX | VF_VI },
+  [0b011111] = { VOP_MSGT,      VF_VX | VF_VI },
+  [0b100101] = { VOP_SLL,       VF_VV | VF_VX | VF_VI },
+  [0b100111] = { VOP_MVNR,      VF_VI },
+  [0b101000] = { VOP_SRL,       VF_VV | VF_VX | VF_VI },
+  [0b101001] = { VOP_SRA,       VF_VV | VF_VX | VF_VI },
+};
+
+// opmvv and opmvx by funct6, bar the reductions, moves and mask operations
+static const struct vec_opdef_t opm_defs[64] = {
+  [0b100000] = { VOP_DIVU,   VF_VV | VF_VX },
+  [0b100001] = { VOP_DIV,    VF_VV | VF_VX },
+  [0b100010] = { VOP_REMU,   VF_VV | VF_VX },
+  [0b100011] = { VOP_REM,    VF_VV | VF_VX },
+  [0b100100] = { VOP_MULHU,  VF_VV | VF_VX },
+  [0b100101] = { VOP_MUL,    VF_VV | VF_VX },
+  [0b100110] = { VOP_MULHSU, VF_VV | VF_VX },
+  [0b100111] = { VOP_MULH,   VF_VV | VF_VX },
+  [0b101001] = { VOP_MADD,   VF_VV | VF_VX },
+  [0b101011] = { VOP_NMSUB,  VF_VV | VF_VX },
+  [0b101101] = { VOP_MACC,   VF_VV | VF_VX },
+  [0b101111] = { VOP_NMSAC,  VF_VV | VF_VX },
+};
+
+// opfvv and opfvf by funct6, bar the reductions, moves and unary operations
+static const struct vec_opdef_t opf_defs[64] = {
+  [0b000000] = { VOP_FADD,   VF_VV | VF_VX },
+  [0b000010] = { VOP_FSUB,   VF_VV | VF_VX },
+  [0b000100] = { VOP_FMIN,   VF_VV | VF_VX },
+  [0b000110] = { VOP_FMAX,   VF_VV | VF_VX },
+  [0b001000] = { VOP_FSGNJ,  VF_VV | VF_VX },
+  [0b001001] = { VOP_FSGNJN, VF_VV | VF_VX },
+  [0b001010] = { VOP_FSGNJX, VF_VV | VF_VX },
+  [0b010111] = { VOP_FMERGE, VF_VX },
+  [0b011000] = { VOP_MFEQ,   VF_VV | VF_VX },
+  [0b011001] = { VOP_MFLE,   VF_VV | VF_VX },
+  [0b011011] = { VOP_MFLT,   VF_VV | VF_VX },
+  [0b011100] = { VOP_MFNE,   VF_VV | VF_VX },
+  [0b011101] = { VOP_MFGT,   VF_VX },
+  [0b011111] = { VOP_MFGE,   VF_VX },
+  [0b100000] = { VOP_FDIV,   VF_VV | VF_VX },
+  [0b100001] = { VOP_FRDIV,  VF_VX },
+  [0b100100] = { VOP_FMUL,   VF_VV | VF_VX },
+  [0b100111] = { VOP_FRSUB,  VF_VX },
+  [0b101000] = { VOP_FMADD,  VF_VV | VF_VX },
+  [0b101001] = { VOP_FNMADD, VF_VV | VF_VX },
+  [0b101010] = { VOP_FMSUB,  VF_VV | VF_VX },
+  [0b101011] = { VOP_FNMSUB, VF_VV | VF_VX },
+  [0b101100] = { VOP_FMACC,  VF_VV | VF_VX },
+  [0b101101] = { VOP_FNMACC, VF_VV | VF_VX },
+  [0b101110] = { VOP_FMSAC,  VF_VV | VF_VX },
+  [0b101111] = { VOP_FNMSAC, VF_VV | VF_VX },
+};
+
+// the vector configuration an instruction runs under
+struct vec_cfg_t {
+  // element width in bits
+  uint32_t sew;
+  // log2 of the number of registers in a group (negative if fractional)
+  int32_t lmul;
+  uint32_t vl;
+  uint32_t vstart;
+};
+
+// first byte of a vector register, and of the group it starts
+static uint8_t *vec_reg(struct riscv_t *rv, uint32_t v) {
+  return &rv->V[0][0] + v * RV_VLENB;
+}
+
+// read element i of a register group, zero extended
+static uint32_t vec_get(const uint8_t *reg, uint32_t i, uint32_t sew) {
+  switch (sew) {
+  case 8:
+    return reg[i];
+  case 16:
+  {
+    uint16_t x;
+    memcpy(&x, reg + i * 2, sizeof(x));
+    return x;
+  }
+  default:
+  {
+    uint32_t x;
+    memcpy(&x, reg + i * 4, sizeof(x));
+    return x;
+  }
+  }
+}
+
+// write element i of a register group, truncating the value to sew
+static void vec_put(uint8_t *reg, uint32_t i, uint32_t sew, uint32_t x) {
+  switch (sew) {
+  case 8:
+    reg[i] = (uint8_t)x;
+    break;
+  case 16:
+  {
+    const uint16_t y = (uint16_t)x;
+    memcpy(reg + i * 2, &y, sizeof(y));
+    break;
+  }
+  default:
+    memcpy(reg + i * 4, &x, sizeof(x));
+    break;
+  }
+}
+
+static bool vec_mask_get(const uint8_t *reg, uint32_t i) {
+  return (reg[i >> 3] >> (i & 7)) & 1;
+}
+
+static void vec_mask_put(uint8_t *reg, uint32_t i, bool bit) {
+  const uint8_t m = (uint8_t)(1u << (i & 7));
+  reg[i >> 3] = bit ? (reg[i >> 3] | m) : (reg[i >> 3] & ~m);
+}
+
+// sign extend an element
+static int32_t vec_sext(uint32_t x, uint32_t sew) {
+  return ((int32_t)(x << (32 - sew))) >> (32 - sew);
+}
+
+static float vec_f(uint32_t bits) {
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+static uint32_t vec_bits(float f) {
+  uint32_t bits;
+  memcpy(&bits, &f, sizeof(bits));
+  return bits;
+}
+
+// the bits of r, the result of op on a, b and c, fixed up when frm rounds
+// ties to max magnitude
+static uint32_t vec_round(struct riscv_t *rv, uint32_t op, float r, double a, double b, double c) {
+  if (fp_is_rmm(rv, RM_DYN)) {
+    r = fp_rmm(op, r, a, b, c);
+  }
+  return vec_bits(fp_canonical(r));
+}
+
+// log2 of the register group size of a vtype (-4 is reserved)
+static int32_t vtype_lmul(uint32_t vtype) {
+  const int32_t x = (int32_t)(vtype & VTYPE_VLMUL);
+  return (x >= 4) ? x - 8 : x;
+}
+
+static uint32_t vtype_sew(uint32_t vtype) {
+  return 8u << ((vtype & VTYPE_VSEW) >> 3);
+}
+
+// vlmax under a vtype, or 0 if the vtype is not supported
+static uint32_t vtype_vlmax(uint32_t vtype) {
+  const int32_t lmul = vtype_lmul(vtype);
+  const uint32_t sew = vtype_sew(vtype);
+  // only the policy bits may be set above vsew, and elements are at most 32
+  // bits with fractional groups needing to hold at least one of them
+  if ((vtype & ~0xffu) || sew > 32 || lmul == -4) {
+    return 0;
+  }
+  if (lmul < 0 && (sew << -lmul) > 32) {
+    return 0;
+  }
+  const uint32_t per_reg = RISCV_VM_VLEN / sew;
+  return (lmul >= 0) ? (per_reg << lmul) : (per_reg >> -lmul);
+}
+
+// read the configuration, failing if vtype is illegal
+static bool vec_cfg(const struct riscv_t *rv, struct vec_cfg_t *cfg) {
+  if (rv->csr_vtype & VTYPE_VILL) {
+    return false;
+  }
+  cfg->sew = vtype_sew(rv->csr_vtype);
+  cfg->lmul = vtype_lmul(rv->csr_vtype);
+  cfg->vl = rv->csr_vl;
+  cfg->vstart = rv->csr_vstart;
+  return true;
+}
+
+// if a register can start a group of 2^lmul registers
+static bool vec_aligned(uint32_t v, int32_t lmul) {
+  return lmul <= 0 || !(v & ((1u << lmul) - 1));
+}
+
+// vsetvli, vsetivli and vsetvl
+static bool vec_setvl(struct riscv_t *rv, uint32_t inst) {
+  const uint32_t rd  = dec_rd(inst);
+  const uint32_t rs1 = dec_rs1(inst);
+  uint32_t vtype, avl;
+  if (!(inst >> 31)) {
+    vtype = (inst >> 20) & 0x7ff;
+  }
+  else if ((inst >> 30) == 0b11) {
+    vtype = (inst >> 20) & 0x3ff;
+  }
+  else {
+    vtype = rv->X[dec_rs2(inst)];
+  }
+  if ((inst >> 30) == 0b11) {
+    // the avl is an immediate
+    avl = rs1;
+  }
+  else if (rs1 != rv_reg_zero) {
+    avl = rv->X[rs1];
+  }
+  else {
+    // x0 asks for vlmax, or to keep vl when rd is also x0
+    avl = (rd != rv_reg_zero) ? UINT32_MAX : rv->csr_vl;
+  }
+  const uint32_t vlmax = vtype_vlmax(vtype);
+  if (!vlmax) {
+    rv->csr_vtype = VTYPE_VILL;
+    rv->csr_vl = 0;
+  }
+  else {
+    rv->csr_vtype = vtype;
+    rv->csr_vl = (avl < vlmax) ? avl : vlmax;
+  }
+  rv->csr_vstart = 0;
+  if (rd != rv_reg_zero) {
+    rv->X[rd] = rv->csr_vl;
+  }
+  return true;
+}
+
+// host address of a run of guest bytes within one mapped page, else NULL
+static uint8_t *vec_host_ptr(struct riscv_t *rv, uint32_t addr, uint32_t size) {
+  const uint32_t page_mask = (1u << RV_PAGE_BITS) - 1;
+  uint8_t **table = rv->jit.page_table;
+  if (!table || (addr & page_mask) + size > page_mask + 1) {
+    return NULL;
+  }
+  uint8_t *page = table[addr >> RV_PAGE_BITS];
+  return page ? page + (addr & page_mask) : NULL;
+}
+
+static uint32_t vec_read(struct riscv_t *rv, uint32_t addr, uint32_t eew) {
+  switch (eew) {
+  case 8:  return rv->io.mem_read_b(rv, addr);
+  case 16: return rv->io.mem_read_s(rv, addr);
+  default: return rv->io.mem_read_w(rv, addr);
+  }
+}
+
+static void vec_write(struct riscv_t *rv, uint32_t addr, uint32_t eew, uint32_t x) {
+  switch (eew) {
+  case 8:  rv->io.mem_write_b(rv, addr, (uint8_t)x);  break;
+  case 16: rv->io.mem_write_s(rv, addr, (uint16_t)x); break;
+  default: rv->io.mem_write_w(rv, addr, x);           break;
+  }
+}
+
+// unit stride, strided and indexed loads and stores
+static bool vec_mem(struct riscv_t *rv, uint32_t inst) {
+  const bool is_load  = (inst & FR_OPCODE) == 0b0000111;
+  const uint32_t vd   = dec_rd(inst);  // vs3 of a store
+  const uint32_t rs1  = dec_rs1(inst);
+  const uint32_t rs2  = dec_rs2(inst);
+  const uint32_t mop  = (inst >> 26) & 3;
+  const bool vm       = (inst >> 25) & 1;
+  const uint32_t width = dec_funct3(inst);
+  const uint32_t eew  = (width == 0b000) ? 8 : (width == 0b101) ? 16 : 32;
+
+  if (mop == 0b00 && rs2 == 0b01000) {
+    // vl<nf>re<eew>.v and vs<nf>r.v move whole registers whatever vtype holds
+    const uint32_t nr = (inst >> 29) + 1;
+    if (!vm || (nr & (nr - 1)) || (vd & (nr - 1)) || (!is_load && eew != 8)) {
+      return false;
+    }
+    uint8_t *reg = vec_reg(rv, vd);
+    const uint32_t base = rv->X[rs1];
+    uint32_t i = rv->csr_vstart * (eew / 8);
+    uint8_t *ptr = i ? NULL : vec_host_ptr(rv, base, nr * RV_VLENB);
+    if (ptr) {
+      memcpy(is_load ? reg : ptr, is_load ? ptr : reg, nr * RV_VLENB);
+      i = nr * RV_VLENB;
+    }
+    for (; i < nr * RV_VLENB; ++i) {
+      if (is_load) {
+        reg[i] = rv->io.mem_read_b(rv, base + i);
+      }
+      else {
+        rv->io.mem_write_b(rv, base + i, reg[i]);
+      }
+    }
+    rv->csr_vstart = 0;
+    return true;
+  }
+  struct vec_cfg_t cfg;
+  if (!vec_cfg(rv, &cfg)) {
+    return false;
+  }
+  // the index or data width sets the group size relative to the sew
+  const int32_t emul = (int32_t)calc_ctz(eew) - (int32_t)calc_ctz(cfg.sew) + cfg.lmul;
+  uint32_t sew = eew;
+  uint32_t vl = cfg.vl;
+  int32_t data_emul = emul;
+  if (mop == 0b00 && rs2 == 0b01011) {
+    // vlm.v and vsm.v move the bytes holding vl mask bits
+    if (eew != 8 || !vm) {
+      return false;
+    }
+    vl = (cfg.vl + 7) / 8;
+    data_emul = 0;
+  }
+  else if (mop & 1) {
+    // indexed, where eew is the index width and the data is sew wide
+    if (emul < -3 || emul > 3 || !vec_aligned(rs2, emul)) {
+      return false;
+    }
+    sew = cfg.sew;
+    data_emul = cfg.lmul;
+  }
+  if (data_emul < -3 || data_emul > 3 || !vec_aligned(vd, data_emul)) {
+    return false;
+  }
+  // a masked load can not overwrite the mask
+  if (is_load && !vm && vd == 0) {
+    return false;
+  }
+
+  uint8_t *reg = vec_reg(rv, vd);
+  const uint32_t base = rv->X[rs1];
+  uint32_t i = cfg.vstart;
+  if (mop == 0b00 && vm && i == 0) {
+    // copy whole unit stride accesses within a host page
+    uint8_t *ptr = vec_host_ptr(rv, base, vl * (sew / 8));
+    if (ptr) {
+      if (is_load) {
+        memcpy(reg, ptr, vl * (sew / 8));
+      }
+      else {
+        memcpy(ptr, reg, vl * (sew / 8));
+      }
+      i = vl;
+    }
+  }
+  const uint8_t *index = vec_reg(rv, rs2);
+  const uint32_t stride = rv->X[rs2];
+  for (; i < vl; ++i) {
+    if (!vm && !vec_mask_get(rv->V[0], i)) {
+      continue;
+    }
+    uint32_t addr;
+    switch (mop) {
+    case 0b00: addr = base + i * (sew / 8);              break;
+    case 0b10: addr = base + i * stride;                 break;
+    default:   addr = base + vec_get(index, i, eew);     break;
+    }
+    if (is_load) {
+      vec_put(reg, i, sew, vec_read(rv, addr, sew));
+    }
+    else {
+      vec_write(rv, addr, sew, vec_get(reg, i, sew));
+    }
+  }
+  rv->csr_vstart = 0;
+  return true;
+}
+
+// compute an element of an element wise operation
+static uint32_t vec_alu(struct riscv_t *rv, uint32_t op, uint32_t a, uint32_t b, uint32_t d,
+                        uint32_t sew) {
+  const int32_t sa = vec_sext(a, sew);
+  const int32_t sb = vec_sext(b, sew);
+  const uint32_t shamt = b & (sew - 1);
+  // the most negative element, which overflows when divided by -1
+  const int32_t smin = vec_sext(1u << (sew - 1), sew);
+  const float fa = vec_f(a);
+  const float fb = vec_f(b);
+  const float fd = vec_f(d);
+  switch (op) {
+  case VOP_ADD:    return a + b;
+  case VOP_SUB:    return a - b;
+  case VOP_RSUB:   return b - a;
+  case VOP_MINU:   return (a < b) ? a : b;
+  case VOP_MIN:    return (sa < sb) ? a : b;
+  case VOP_MAXU:   return (a > b) ? a : b;
+  case VOP_MAX:    return (sa > sb) ? a : b;
+  case VOP_AND:    return a & b;
+  case VOP_OR:     return a | b;
+  case VOP_XOR:    return a ^ b;
+  case VOP_SLL:    return a << shamt;
+  case VOP_SRL:    return a >> shamt;
+  case VOP_SRA:    return (uint32_t)(sa >> shamt);
+  case VOP_MERGE:  return b;
+  case VOP_MUL:    return a * b;
+  case VOP_MULH:   return (uint32_t)(((int64_t)sa * sb) >> sew);
+  case VOP_MULHU:  return (uint32_t)(((uint64_t)a * b) >> sew);
+  case VOP_MULHSU: return (uint32_t)(((int64_t)sa * (int64_t)b) >> sew);
+  // division by zero and overflow give the same results as the scalar forms
+  case VOP_DIVU:   return b ? a / b : ~0u;
+  case VOP_DIV:    return !b ? ~0u : (sa == smin && sb == -1) ? a : (uint32_t)(sa / sb);
+  case VOP_REMU:   return b ? a % b : a;
+  case VOP_REM:    return !b ? a : (sa == smin && sb == -1) ? 0 : (uint32_t)(sa % sb);
+  case VOP_MACC:   return d + a * b;
+  case VOP_NMSAC:  return d - a * b;
+  case VOP_MADD:   return b * d + a;
+  case VOP_NMSUB:  return a - b * d;
+  case VOP_MSEQ:   return a == b;
+  case VOP_MSNE:   return a != b;
+  case VOP_MSLTU:  return a < b;
+  case VOP_MSLT:   return sa < sb;
+  case VOP_MSLEU:  return a <= b;
+  case VOP_MSLE:   return sa <= sb;
+  case VOP_MSGTU:  return a > b;
+  case VOP_MSGT:   return sa > sb;
+  case VOP_FADD:   return vec_round(rv, FP_RMM_ADD, fa + fb, fa, fb, 0.);
+  case VOP_FSUB:   return vec_round(rv, FP_RMM_SUB, fa - fb, fa, fb, 0.);
+  case VOP_FRSUB:  return vec_round(rv, FP_RMM_SUB, fb - fa, fb, fa, 0.);
+  case VOP_FMUL:   return vec_round(rv, FP_RMM_MUL, fa * fb, fa, fb, 0.);
+  case VOP_FDIV:   return vec_round(rv, FP_RMM_DIV, fa / fb, fa, fb, 0.);
+  case VOP_FRDIV:  return vec_round(rv, FP_RMM_DIV, fb / fa, fb, fa, 0.);
+  case VOP_FMIN:   return vec_bits(fp_minmax(rv, fa, fb, false));
+  case VOP_FMAX:   return vec_bits(fp_minmax(rv, fa, fb, true));
+  case VOP_FSGNJ:  return (a & ~FMASK_SIGN) | (b & FMASK_SIGN);
+  case VOP_FSGNJN: return (a & ~FMASK_SIGN) | (~b & FMASK_SIGN);
+  case VOP_FSGNJX: return a ^ (b & FMASK_SIGN);
+  case VOP_FMERGE: return b;
+  // the multiply is of vs1 (or the scalar) with vs2 for the accumulating
+  // forms and with vd for the others, being rounded once
+  case VOP_FMACC:  return vec_round(rv, FP_RMM_FMA, fp_fma(rv, fb, fa, fd), fb, fa, fd);
+  case VOP_FNMACC: return vec_round(rv, FP_RMM_FMA, fp_fma(rv, -fb, fa, -fd), -fb, fa, -fd);
+  case VOP_FMSAC:  return vec_round(rv, FP_RMM_FMA, fp_fma(rv, fb, fa, -fd), fb, fa, -fd);
+  case VOP_FNMSAC: return vec_round(rv, FP_RMM_FMA, fp_fma(rv, -fb, fa, fd), -fb, fa, fd);
+  case VOP_FMADD:  return vec_round(rv, FP_RMM_FMA, fp_fma(rv, fb, fd, fa), fb, fd, fa);
+  case VOP_FNMADD: return vec_round(rv, FP_RMM_FMA, fp_fma(rv, -fb, fd, -fa), -fb, fd, -fa);
+  case VOP_FMSUB:  return vec_round(rv, FP_RMM_FMA, fp_fma(rv, fb, fd, -fa), fb, fd, -fa);
+  case VOP_FNMSUB: return vec_round(rv, FP_RMM_FMA, fp_fma(rv, -fb, fd, fa), -fb, fd, fa);
+  case VOP_FSQRT:  return vec_bits(fp_canonical(sqrtf(fa)));
+  case VOP_FCLASS: return calc_fclass(a);
+  case VOP_FCVT_XU_F:     return fp_cvt_w(rv, fa, RM_DYN, true);
+  case VOP_FCVT_X_F:      return fp_cvt_w(rv, fa, RM_DYN, false);
+  case VOP_FCVT_RTZ_XU_F: return fp_cvt_w(rv, fa, RM_RTZ, true);
+  case VOP_FCVT_RTZ_X_F:  return fp_cvt_w(rv, fa, RM_RTZ, false);
+  case VOP_FCVT_F_XU:     return vec_round(rv, FP_RMM_CVT, (float)a, a, 0., 0.);
+  case VOP_FCVT_F_X:      return vec_round(rv, FP_RMM_CVT, (float)(int32_t)a, (int32_t)a, 0., 0.);
+  case VOP_MFEQ:   return fa == fb;
+  case VOP_MFNE:   return fa != fb;
+  case VOP_MFLT:   return fa < fb;
+  case VOP_MFLE:   return fa <= fb;
+  case VOP_MFGT:   return fa > fb;
+  case VOP_MFGE:   return fa >= fb;
+  default:
+    assert(!"unreachable");
+    return 0;
+  }
+}
+
+static bool vop_is_compare(uint32_t op) {
+  return op >= VOP_MSEQ && op <= VOP_MFGE;
+}
+
+#if VEC_X64
+// the simd kernels run an element wise operation on whole host vectors of
+// unmasked elements from the start of the body, returning how many elements
+// they ran so the portable loop can finish the rest.  b holds the second
+// operand, or is NULL to use the scalar x for every element.
+
+// sse2, which every x64 host has, for the plain integer and float arithmetic
+static uint32_t vec_kernel_sse2(uint32_t op, uint32_t sew, uint8_t *d, const uint8_t *a,
+                                const uint8_t *b, uint32_t x, uint32_t n) {
+  const uint32_t lanes = 128 / sew;
+  const __m128i splat = (sew == 8)  ? _mm_set1_epi8((char)x) :
+                        (sew == 16) ? _mm_set1_epi16((short)x) : _mm_set1_epi32((int)x);
+  const __m128 nan = _mm_castsi128_ps(_mm_set1_epi32(FP_CANONICAL_NAN));
+  uint32_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    const size_t at = (size_t)i * (sew / 8);
+    const __m128i va = _mm_loadu_si128((const __m128i *)(a + at));
+    const __m128i vb = b ? _mm_loadu_si128((const __m128i *)(b + at)) : splat;
+    const __m128 fa = _mm_castsi128_ps(va);
+    const __m128 fb = _mm_castsi128_ps(vb);
+    __m128i r;
+    __m128 f;
+    switch (op) {
+    case VOP_ADD:
+      r = (sew == 8) ? _mm_add_epi8(va, vb) : (sew == 16) ? _mm_add_epi16(va, vb) : _mm_add_epi32(va, vb);
+      break;
+    case VOP_SUB:
+      r = (sew == 8) ? _mm_sub_epi8(va, vb) : (sew == 16) ? _mm_sub_epi16(va, vb) : _mm_sub_epi32(va, vb);
+      break;
+    case VOP_RSUB:
+      r = (sew == 8) ? _mm_sub_epi8(vb, va) : (sew == 16) ? _mm_sub_epi16(vb, va) : _mm_sub_epi32(vb, va);
+      break;
+    case VOP_AND:
+      r = _mm_and_si128(va, vb);
+      break;
+    case VOP_OR:
+      r = _mm_or_si128(va, vb);
+      break;
+    case VOP_XOR:
+      r = _mm_xor_si128(va, vb);
+      break;
+    case VOP_MERGE:
+    case VOP_FMERGE:
+      // unmasked, so vmv.v and vfmv.v.f
+      r = vb;
+      break;
+    case VOP_FADD:
+    case VOP_FSUB:
+    case VOP_FRSUB:
+    case VOP_FMUL:
+    case VOP_FDIV:
+    case VOP_FRDIV:
+      switch (op) {
+      case VOP_FADD:  f = _mm_add_ps(fa, fb); break;
+      case VOP_FSUB:  f = _mm_sub_ps(fa, fb); break;
+      case VOP_FRSUB: f = _mm_sub_ps(fb, fa); break;
+      case VOP_FMUL:  f = _mm_mul_ps(fa, fb); break;
+      case VOP_FDIV:  f = _mm_div_ps(fa, fb); break;
+      default:        f = _mm_div_ps(fb, fa); break;
+      }
+      {
+        // replace nan results with the canonical nan
+        const __m128 is_nan = _mm_cmpunord_ps(f, f);
+        f = _mm_or_ps(_mm_andnot_ps(is_nan, f), _mm_and_ps(is_nan, nan));
+      }
+      r = _mm_castps_si128(f);
+      break;
+    default:
+      return i;
+    }
+    _mm_storeu_si128((__m128i *)(d + at), r);
+  }
+  return i;
+}
+
+// select the 8, 16 or 32 bit form of an integer intrinsic
+#define VEC_BY_SEW(P, OP, x, y) \
+  ((sew == 8) ? P##_##OP##8(x, y) : (sew == 16) ? P##_##OP##16(x, y) : P##_##OP##32(x, y))
+
+// avx2 (and fma where the host has it) kernels for host vectors of W bits,
+// where P is the intrinsic prefix and S the suffix of the integer vector type
+#define VEC_KERNEL_AVX2(NAME, W, P, S, VI, VF)                                                     \
+  VEC_TARGET("avx2,fma")                                                                           \
+  static uint32_t NAME(uint32_t op, uint32_t sew, uint8_t *d, const uint8_t *a, const uint8_t *b,  \
+                       uint32_t x, uint32_t n, bool fma) {                                         \
+    const uint32_t lanes = W / sew;                                                                \
+    const VI splat = (sew == 8)  ? P##_set1_epi8((char)x) :                                        \
+                     (sew == 16) ? P##_set1_epi16((short)x) : P##_set1_epi32((int)x);              \
+    const VF nan = P##_cast##S##_ps(P##_set1_epi32(FP_CANONICAL_NAN));                             \
+    const bool is_fma = op >= VOP_FMACC && op <= VOP_FNMSUB;                                       \
+    const bool is_mul = op == VOP_MUL || (op >= VOP_MACC && op <= VOP_NMSUB);                      \
+    if ((is_fma && !fma) || (is_mul && sew == 8)) {                                                \
+      return 0;                                                                                    \
+    }                                                                                              \
+    uint32_t i = 0;                                                                                \
+    for (; i + lanes <= n; i += lanes) {                                                           \
+      const size_t at = (size_t)i * (sew / 8);                                                     \
+      const VI va = P##_loadu_##S((const VI *)(a + at));                                           \
+      const VI vb = b ? P##_loadu_##S((const VI *)(b + at)) : splat;                               \
+      const VI vd = P##_loadu_##S((const VI *)(d + at));                                           \
+      const VF fa = P##_cast##S##_ps(va);                                                          \
+      const VF fb = P##_cast##S##_ps(vb);                                                          \
+      const VF fd = P##_cast##S##_ps(vd);                                                          \
+      VI r;                                                                                        \
+      VF f;                                                                                        \
+      if (is_fma) {                                                                                \
+        /* the host misses invalid for inf * 0 with a quiet nan addend */                          \
+        const VF c = (op <= VOP_FNMSAC) ? fd : fa;                                                 \
+        if (P##_movemask_ps(P##_cmp_ps(c, c, _CMP_UNORD_Q))) {                                     \
+          return i;                                                                                \
+        }                                                                                          \
+      }                                                                                            \
+      switch (op) {                                                                                \
+      case VOP_ADD:    r = VEC_BY_SEW(P, add_epi, va, vb); break;                                  \
+      case VOP_SUB:    r = VEC_BY_SEW(P, sub_epi, va, vb); break;                                  \
+      case VOP_RSUB:   r = VEC_BY_SEW(P, sub_epi, vb, va); break;                                  \
+      case VOP_MINU:   r = VEC_BY_SEW(P, min_epu, va, vb); break;                                  \
+      case VOP_MIN:    r = VEC_BY_SEW(P, min_epi, va, vb); break;                                  \
+      case VOP_MAXU:   r = VEC_BY_SEW(P, max_epu, va, vb); break;                                  \
+      case VOP_MAX:    r = VEC_BY_SEW(P, max_epi, va, vb); break;                                  \
+      case VOP_AND:    r = P##_and_##S(va, vb); break;                                             \
+      case VOP_OR:     r = P##_or_##S(va, vb); break;                                              \
+      case VOP_XOR:    r = P##_xor_##S(va, vb); break;                                             \
+      case VOP_MERGE:                                                                              \
+      case VOP_FMERGE: r = vb; break;                                                              \
+      case VOP_MUL:                                                                                \
+      case VOP_MACC:                                                                               \
+      case VOP_NMSAC:                                                                              \
+        r = (sew == 16) ? P##_mullo_epi16(va, vb) : P##_mullo_epi32(va, vb);                       \
+        r = (op == VOP_MUL) ? r :                                                                  \
+            (op == VOP_MACC) ? VEC_BY_SEW(P, add_epi, vd, r) : VEC_BY_SEW(P, sub_epi, vd, r);      \
+        break;                                                                                     \
+      case VOP_MADD:                                                                               \
+      case VOP_NMSUB:                                                                              \
+        r = (sew == 16) ? P##_mullo_epi16(vb, vd) : P##_mullo_epi32(vb, vd);                       \
+        r = (op == VOP_MADD) ? VEC_BY_SEW(P, add_epi, r, va) : VEC_BY_SEW(P, sub_epi, va, r);      \
+        break;                                                                                     \
+      case VOP_FADD:   f = P##_add_ps(fa, fb); goto canonical;                                     \
+      case VOP_FSUB:   f = P##_sub_ps(fa, fb); goto canonical;                                     \
+      case VOP_FRSUB:  f = P##_sub_ps(fb, fa); goto canonical;                                     \
+      case VOP_FMUL:   f = P##_mul_ps(fa, fb); goto canonical;                                     \
+      case VOP_FDIV:   f = P##_div_ps(fa, fb); goto canonical;                                     \
+      case VOP_FRDIV:  f = P##_div_ps(fb, fa); goto canonical;                                     \
+      case VOP_FMACC:  f = P##_fmadd_ps(fb, fa, fd); goto canonical;                               \
+      case VOP_FNMACC: f = P##_fnmsub_ps(fb, fa, fd); goto canonical;                              \
+      case VOP_FMSAC:  f = P##_fmsub_ps(fb, fa, fd); goto canonical;                               \
+      case VOP_FNMSAC: f = P##_fnmadd_ps(fb, fa, fd); goto canonical;                              \
+      case VOP_FMADD:  f = P##_fmadd_ps(fb, fd, fa); goto canonical;                               \
+      case VOP_FNMADD: f = P##_fnmsub_ps(fb, fd, fa); goto canonical;                              \
+      case VOP_FMSUB:  f = P##_fmsub_ps(fb, fd, fa); goto canonical;                               \
+      case VOP_FNMSUB: f = P##_fnmadd_ps(fb, fd, fa); goto canonical;                              \
+      canonical:                                                                                   \
+        f = P##_blendv_ps(f, nan, P##_cmp_ps(f, f, _CMP_UNORD_Q));                                 \
+        r = P##_castps_##S(f);                                                                     \
+        break;                                                                                     \
+      default:                                                                                     \
+        return i;                                                                                  \
+      }                                                                                            \
+      P##_storeu_##S((VI *)(d + at), r);                                                           \
+    }                                                                                              \
+    return i;                                                                                      \
+  }
+
+VEC_KERNEL_AVX2(vec_kernel_avx2_256, 256, _mm256, si256, __m256i, __m256)
+VEC_KERNEL_AVX2(vec_kernel_avx2_128, 128, _mm, si128, __m128i, __m128)
+
+#undef VEC_KERNEL_AVX2
+#undef VEC_BY_SEW
+
+static uint32_t vec_kernel(uint32_t host, uint32_t op, uint32_t sew, uint8_t *d, const uint8_t *a,
+                           const uint8_t *b, uint32_t x, uint32_t n) {
+  if (host & HOST_AVX2) {
+    const bool fma = (host & HOST_FMA) != 0;
+    uint32_t i = vec_kernel_avx2_256(op, sew, d, a, b, x, n, fma);
+    // a group too short for the wide vectors may still fill a narrow one
+    const size_t at = (size_t)i * (sew / 8);
+    i += vec_kernel_avx2_128(op, sew, d + at, a + at, b ? b + at : NULL, x, n - i, fma);
+    return i;
+  }
+  if (host & HOST_SSE2) {
+    return vec_kernel_sse2(op, sew, d, a, b, x, n);
+  }
+  return 0;
+}
+#endif  // VEC_X64
+
+// run an element wise operation over the body.  b is the second operand's
+// register group, or NULL to use the scalar x.
+static void vec_run(struct riscv_t *rv, const struct vec_cfg_t *cfg, uint32_t op, uint32_t vd,
+                    uint32_t vs2, const uint8_t *b, uint32_t x, bool vm, uint32_t host) {
+  uint8_t *d = vec_reg(rv, vd);
+  const uint8_t *a = vec_reg(rv, vs2);
+  const uint8_t *v0 = rv->V[0];
+  const uint32_t sew = cfg->sew;
+  uint32_t i = cfg->vstart;
+
+  if (vop_is_compare(op)) {
+    // build the mask aside as its register may also be a source
+    uint8_t mask[RV_VLENB];
+    memcpy(mask, d, sizeof(mask));
+    for (; i < cfg->vl; ++i) {
+      if (vm || vec_mask_get(v0, i)) {
+        const uint32_t y = b ? vec_get(b, i, sew) : x;
+        vec_mask_put(mask, i, vec_alu(rv, op, vec_get(a, i, sew), y, 0, sew) != 0);
+      }
+    }
+    memcpy(d, mask, sizeof(mask));
+    return;
+  }
+#if VEC_X64
+  // the kernels round as the host does, which has no ties to max magnitude
+  if (op >= VOP_FADD && op <= VOP_FCVT_RTZ_X_F && fp_is_rmm(rv, RM_DYN)) {
+    host = 0;
+  }
+  if (host && vm && i == 0) {
+    i = vec_kernel(host, op, sew, d, a, b, x, cfg->vl);
+  }
+#else
+  (void)host;
+#endif
+  // merges write every body element, choosing the source by the mask
+  const bool merge = op == VOP_MERGE || op == VOP_FMERGE;
+  for (; i < cfg->vl; ++i) {
+    const bool active = vm || vec_mask_get(v0, i);
+    if (!active && !merge) {
+      continue;
+    }
+    const uint32_t ai = vec_get(a, i, sew);
+    if (!active) {
+      vec_put(d, i, sew, ai);
+      continue;
+    }
+    const uint32_t bi = b ? vec_get(b, i, sew) : x;
+    vec_put(d, i, sew, vec_alu(rv, op, ai, bi, vec_get(d, i, sew), sew));
+  }
+}
+
+// vslideup and vslidedown by offset elements
+static void vec_slide(struct riscv_t *rv, const struct vec_cfg_t *cfg, bool up, uint32_t vd,
+                      uint32_t vs2, uint32_t offset, bool vm) {
+  uint8_t *d = vec_reg(rv, vd);
+  const uint8_t *a = vec_reg(rv, vs2);
+  const uint32_t vlmax = vtype_vlmax(rv->csr_vtype);
+  uint32_t i = cfg->vstart;
+  if (up) {
+    // elements below the offset are left alone, and vd never overlaps vs2
+    for (i = (i > offset) ? i : offset; i < cfg->vl; ++i) {
+      if (vm || vec_mask_get(rv->V[0], i)) {
+        vec_put(d, i, cfg->sew, vec_get(a, i - offset, cfg->sew));
+      }
+    }
+  }
+  else {
+    // ascending so sliding within a register group reads ahead of writes
+    for (; i < cfg->vl; ++i) {
+      if (vm || vec_mask_get(rv->V[0], i)) {
+        const uint32_t src = i + offset;
+        const bool in = src >= i && src < vlmax;
+        vec_put(d, i, cfg->sew, in ? vec_get(a, src, cfg->sew) : 0);
+      }
+    }
+  }
+}
+
+// integer reductions into element 0 of vd
+static uint32_t vec_reduce(uint32_t funct6, uint32_t acc, uint32_t x, uint32_t sew) {
+  switch (funct6) {
+  case 0b000000: return acc + x;                                                // VREDSUM
+  case 0b000001: return acc & x;                                                // VREDAND
+  case 0b000010: return acc | x;                                                // VREDOR
+  case 0b000011: return acc ^ x;                                                // VREDXOR
+  case 0b000100: return (x < acc) ? x : acc;                                    // VREDMINU
+  case 0b000101: return (vec_sext(x, sew) < vec_sext(acc, sew)) ? x : acc;      // VREDMIN
+  case 0b000110: return (x > acc) ? x : acc;                                    // VREDMAXU
+  default:       return (vec_sext(x, sew) > vec_sext(acc, sew)) ? x : acc;      // VREDMAX
+  }
+}
+
+// float reductions, summing in element order whether or not it is asked for
+// so every runner gives the same result
+static uint32_t vec_reduce_f(struct riscv_t *rv, uint32_t funct6, uint32_t acc, uint32_t x) {
+  switch (funct6) {
+  case 0b000001:  // VFREDUSUM
+  case 0b000011:  // VFREDOSUM
+    return vec_round(rv, FP_RMM_ADD, vec_f(acc) + vec_f(x), vec_f(acc), vec_f(x), 0.);
+  case 0b000101:  // VFREDMIN
+    return vec_bits(fp_minmax(rv, vec_f(acc), vec_f(x), false));
+  default:        // VFREDMAX
+    return vec_bits(fp_minmax(rv, vec_f(acc), vec_f(x), true));
+  }
+}
+
+// opivv, opivx and opivi
+static bool vec_opi(struct riscv_t *rv, uint32_t inst, uint32_t host) {
+  const uint32_t funct3 = dec_funct3(inst);
+  const uint32_t funct6 = inst >> 26;
+  const bool vm         = (inst >> 25) & 1;
+  const uint32_t vs2    = dec_rs2(inst);
+  const uint32_t vs1    = dec_rs1(inst);  // also rs1 and the immediate
+  const uint32_t vd     = dec_rd(inst);
+
+  const struct vec_opdef_t def = opi_defs[funct6];
+  const uint32_t form = (funct3 == 0b000) ? VF_VV : (funct3 == 0b100) ? VF_VX : VF_VI;
+  if (!(def.forms & form)) {
+    return false;
+  }
+  if (def.op == VOP_MVNR) {
+    // vmv<nr>r.v copies whole registers whatever vtype holds
+    const uint32_t nr = vs1 + 1;
+    if (!vm || (nr & (nr - 1)) || nr > 8 || (vd & (nr - 1)) || (vs2 & (nr - 1))) {
+      return false;
+    }
+    memmove(vec_reg(rv, vd), vec_reg(rv, vs2), nr * RV_VLENB);
+    rv->csr_vstart = 0;
+    return true;
+  }
+  struct vec_cfg_t cfg;
+  if (!vec_cfg(rv, &cfg)) {
+    return false;
+  }
+  const uint32_t mask = (cfg.sew == 32) ? ~0u : (1u << cfg.sew) - 1;
+  // the scalar operand, with shifts and slides taking the immediate unsigned
+  const bool uimm = def.op == VOP_SLL || def.op == VOP_SRL || def.op == VOP_SRA ||
+                    def.op == VOP_SLIDEUP || def.op == VOP_SLIDEDOWN;
+  uint32_t x = (form == VF_VX) ? rv->X[vs1] : uimm ? vs1 : (uint32_t)vec_sext(vs1, 5);
+  const bool is_mask = vop_is_compare(def.op);
+  if (!vec_aligned(vs2, cfg.lmul) || (form == VF_VV && !vec_aligned(vs1, cfg.lmul)) ||
+      (!is_mask && !vec_aligned(vd, cfg.lmul))) {
+    return false;
+  }
+  if (def.op == VOP_MERGE) {
+    // the unmasked form is vmv.v, which has no vs2, and merges can not write
+    // over the mask they read
+    if ((vm && vs2 != 0) || (!vm && vd == 0)) {
+      return false;
+    }
+  }
+  else if (!vm && vd == 0 && !is_mask) {
+    return false;
+  }
+  if (def.op == VOP_SLIDEUP || def.op == VOP_SLIDEDOWN) {
+    if (def.op == VOP_SLIDEUP && vd == vs2) {
+      return false;
+    }
+    vec_slide(rv, &cfg, def.op == VOP_SLIDEUP, vd, vs2, x, vm);
+  }
+  else {
+    const uint8_t *b = (form == VF_VV) ? vec_reg(rv, vs1) : NULL;
+    vec_run(rv, &cfg, def.op, vd, vs2, b, x & mask, vm, host);
+  }
+  rv->csr_vstart = 0;
+  return true;
+}
+
+// opmvv and opmvx
+static bool vec_opm(struct riscv_t *rv, uint32_t inst, uint32_t host) {
+  const uint32_t funct3 = dec_funct3(inst);
+  const uint32_t funct6 = inst >> 26;
+  const bool vm         = (inst >> 25) & 1;
+  const uint32_t vs2    = dec_rs2(inst);
+  const uint32_t vs1    = dec_rs1(inst);  // also rs1
+  const uint32_t vd     = dec_rd(inst);   // also rd
+  const bool is_vv      = funct3 == 0b010;
+
+  struct vec_cfg_t cfg;
+  if (!vec_cfg(rv, &cfg)) {
+    return false;
+  }
+  const uint32_t sew = cfg.sew;
+  uint32_t i = cfg.vstart;
+
+  if (is_vv && funct6 <= 0b000111) {
+    // VREDSUM and friends, vd[0] = vs1[0] op the active elements of vs2
+    if (!vec_aligned(vs2, cfg.lmul)) {
+      return false;
+    }
+    if (cfg.vl) {
+      const uint8_t *a = vec_reg(rv, vs2);
+      uint32_t acc = vec_get(vec_reg(rv, vs1), 0, sew);
+      for (i = 0; i < cfg.vl; ++i) {
+        if (vm || vec_mask_get(rv->V[0], i)) {
+          acc = vec_reduce(funct6, acc, vec_get(a, i, sew), sew);
+        }
+      }
+      vec_put(vec_reg(rv, vd), 0, sew, acc);
+    }
+    rv->csr_vstart = 0;
+    return true;
+  }
+  if (is_vv && funct6 >= 0b011000 && funct6 <= 0b011111) {
+    // mask logical operations, vd = vs2 op vs1 bitwise
+    if (!vm) {
+      return false;
+    }
+    uint8_t *d = vec_reg(rv, vd);
+    const uint8_t *a = vec_reg(rv, vs2);
+    const uint8_t *b = vec_reg(rv, vs1);
+    for (; i < cfg.vl; ++i) {
+      const bool x = vec_mask_get(a, i);
+      const bool y = vec_mask_get(b, i);
+      bool out;
+      switch (funct6) {
+      case 0b011000: out = x && !y;    break;  // VMANDN
+      case 0b011001: out = x && y;     break;  // VMAND
+      case 0b011010: out = x || y;     break;  // VMOR
+      case 0b011011: out = x != y;     break;  // VMXOR
+      case 0b011100: out = x || !y;    break;  // VMORN
+      case 0b011101: out = !(x && y);  break;  // VMNAND
+      case 0b011110: out = !(x || y);  break;  // VMNOR
+      default:       out = x == y;     break;  // VMXNOR
+      }
+      vec_mask_put(d, i, out);
+    }
+    rv->csr_vstart = 0;
+    return true;
+  }
+  if (funct6 == 0b010000) {
+    if (is_vv) {
+      // VWXUNARY0, writing the integer register rd
+      uint32_t out;
+      switch (vs1) {
+      case 0b00000:  // VMV.X.S
+        if (!vm) {
+          return false;
+        }
+        out = (uint32_t)vec_sext(vec_get(vec_reg(rv, vs2), 0, sew), sew);
+        break;
+      case 0b10000:  // VCPOP.M
+      case 0b10001:  // VFIRST.M
+        out = (vs1 == 0b10001) ? ~0u : 0;
+        for (; i < cfg.vl; ++i) {
+          if ((vm || vec_mask_get(rv->V[0], i)) && vec_mask_get(vec_reg(rv, vs2), i)) {
+            if (vs1 == 0b10001) {
+              out = i;
+              break;
+            }
+            ++out;
+          }
+        }
+        break;
+      default:
+        return false;
+      }
+      if (vd != rv_reg_zero) {
+        rv->X[vd] = out;
+      }
+    }
+    else {
+      // VMV.S.X, setting element 0 when it is in the body
+      if (!vm || vs2 != 0) {
+        return false;
+      }
+      if (cfg.vstart < cfg.vl) {
+        vec_put(vec_reg(rv, vd), 0, sew, rv->X[vs1]);
+      }
+    }
+    rv->csr_vstart = 0;
+    return true;
+  }
+  if (is_vv && funct6 == 0b010100 && vs1 == 0b10001) {
+    // VID.V
+    if (vs2 != 0 || !vec_aligned(vd, cfg.lmul) || (!vm && vd == 0)) {
+      return false;
+    }
+    uint8_t *d = vec_reg(rv, vd);
+    for (; i < cfg.vl; ++i) {
+      if (vm || vec_mask_get(rv->V[0], i)) {
+        vec_put(d, i, sew, i);
+      }
+    }
+    rv->csr_vstart = 0;
+    return true;
+  }
+
+  const struct vec_opdef_t def = opm_defs[funct6];
+  if (!(def.forms & (is_vv ? VF_VV : VF_VX))) {
+    return false;
+  }
+  if (!vec_aligned(vd, cfg.lmul) || !vec_aligned(vs2, cfg.lmul) ||
+      (is_vv && !vec_aligned(vs1, cfg.lmul)) || (!vm && vd == 0)) {
+    return false;
+  }
+  const uint32_t mask = (sew == 32) ? ~0u : (1u << sew) - 1;
+  const uint8_t *b = is_vv ? vec_reg(rv, vs1) : NULL;
+  vec_run(rv, &cfg, def.op, vd, vs2, b, is_vv ? 0 : (rv->X[vs1] & mask), vm, host);
+  rv->csr_vstart = 0;
+  return true;
+}
+
+// opfvv and opfvf, all of which need 32 bit elements
+static bool vec_opf(struct riscv_t *rv, uint32_t inst, uint32_t host) {
+  const uint32_t funct3 = dec_funct3(inst);
+  const uint32_t funct6 = inst >> 26;
+  const bool vm         = (inst >> 25) & 1;
+  const uint32_t vs2    = dec_rs2(inst);
+  const uint32_t vs1    = dec_rs1(inst);  // also rs1
+  const uint32_t vd     = dec_rd(inst);   // also rd
+  const bool is_vv      = funct3 == 0b001;
+
+  struct vec_cfg_t cfg;
+  if (!vec_cfg(rv, &cfg) || cfg.sew != 32) {
+    return false;
+  }
+  // the scalar operand, read from the low half of the float register
+  const uint32_t x = (uint32_t)rv->F[vs1].bits;
+
+  if (is_vv && (funct6 & 0b111001) == 0b000001) {
+    // VFREDUSUM, VFREDOSUM, VFREDMIN and VFREDMAX
+    if (!vec_aligned(vs2, cfg.lmul)) {
+      return false;
+    }
+    if (cfg.vl) {
+      const uint8_t *a = vec_reg(rv, vs2);
+      uint32_t acc = vec_get(vec_reg(rv, vs1), 0, 32);
+      for (uint32_t i = 0; i < cfg.vl; ++i) {
+        if (vm || vec_mask_get(rv->V[0], i)) {
+          acc = vec_reduce_f(rv, funct6, acc, vec_get(a, i, 32));
+        }
+      }
+      vec_put(vec_reg(rv, vd), 0, 32, acc);
+    }
+    rv->csr_vstart = 0;
+    return true;
+  }
+  if (funct6 == 0b010000) {
+    if (!vm) {
+      return false;
+    }
+    if (is_vv) {
+      // VFMV.F.S
+      if (vs1 != 0) {
+        return false;
+      }
+      fp_write_w(rv, vd, vec_get(vec_reg(rv, vs2), 0, 32));
+    }
+    else {
+      // VFMV.S.F
+      if (vs2 != 0) {
+        return false;
+      }
+      if (cfg.vstart < cfg.vl) {
+        vec_put(vec_reg(rv, vd), 0, 32, x);
+      }
+    }
+    rv->csr_vstart = 0;
+    return true;
+  }
+
+  uint32_t op = VOP_NONE;
+  bool unary = false;
+  if (is_vv && funct6 == 0b010010) {
+    // VFUNARY0, the single width conversions
+    unary = true;
+    switch (vs1) {
+    case 0b00000: op = VOP_FCVT_XU_F;     break;
+    case 0b00001: op = VOP_FCVT_X_F;      break;
+    case 0b00010: op = VOP_FCVT_F_XU;     break;
+    case 0b00011: op = VOP_FCVT_F_X;      break;
+    case 0b00110: op = VOP_FCVT_RTZ_XU_F; break;
+    case 0b00111: op = VOP_FCVT_RTZ_X_F;  break;
+    }
+  }
+  else if (is_vv && funct6 == 0b010011) {
+    // VFUNARY1
+    unary = true;
+    switch (vs1) {
+    case 0b00000: op = VOP_FSQRT;  break;
+    case 0b10000: op = VOP_FCLASS; break;
+    }
+  }
+  else {
+    const struct vec_opdef_t def = opf_defs[funct6];
+    if (def.forms & (is_vv ? VF_VV : VF_VX)) {
+      op = def.op;
+    }
+  }
+  if (op == VOP_NONE) {
+    return false;
+  }
+  const bool is_mask = vop_is_compare(op);
+  if (!vec_aligned(vs2, cfg.lmul) || (is_vv && !unary && !vec_aligned(vs1, cfg.lmul)) ||
+      (!is_mask && !vec_aligned(vd, cfg.lmul))) {
+    return false;
+  }
+  if (op == VOP_FMERGE) {
+    // the unmasked form is vfmv.v.f, which has no vs2
+    if ((vm && vs2 != 0) || (!vm && vd == 0)) {
+      return false;
+    }
+  }
+  else if (!vm && vd == 0 && !is_mask) {
+    return false;
+  }
+  const uint8_t *b = (is_vv && !unary) ? vec_reg(rv, vs1) : NULL;
+  vec_run(rv, &cfg, op, vd, vs2, b, x, vm, host);
+  rv->csr_vstart = 0;
+  return true;
+}
+
+bool vec_exec(struct riscv_t *rv, uint32_t inst, uint32_t host) {
+  if ((inst & FR_OPCODE) != 0b1010111) {
+    // a load-fp or store-fp of a vector width
+    return vec_mem(rv, inst);
+  }
+  switch (dec_funct3(inst)) {
+  case 0b000:  // OPIVV
+  case 0b011:  // OPIVI
+  case 0b100:  // OPIVX
+    return vec_opi(rv, inst, host);
+  case 0b010:  // OPMVV
+  case 0b110:  // OPMVX
+    return vec_opm(rv, inst, host);
+  case 0b001:  // OPFVV
+  case 0b101:  // OPFVF
+    return vec_opf(rv, inst, host);
+  default:     // OPCFG
+    return vec_setvl(rv, inst);
+  }
+}
+
+#endif  // RISCV_VM_SUPPORT_RVV
@@ -0,0 +1,601 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "riscv.h"
+#include "riscv_private.h"
+#include "interp.h"
+
+// each handler ends by calling the handler of the next instruction.  where the
+// compiler can guarantee it these are tail calls, otherwise we rely on the
+// optimizer and a block is short enough to recurse through when it wont.
+#if defined(__has_attribute)
+#if __has_attribute(musttail)
+#define MUSTTAIL __attribute__((musttail))
+#endif
+#endif
+#ifndef MUSTTAIL
+#define MUSTTAIL
+#endif
+
+// X is the integer register file, which not every handler touches
+#if defined(__GNUC__)
+#define MAYBE_UNUSED __attribute__((unused))
+#else
+#define MAYBE_UNUSED
+#endif
+
+#define HANDLER(name) \
+  static bool name(struct riscv_t *rv, const struct interp_inst_t *ii, uint32_t *X MAYBE_UNUSED)
+
+// move onto the next instruction of the block
+#define NEXT() \
+  MUSTTAIL return ii[1].handler(rv, ii + 1, X)
+
+// move past the second instruction of a superinstruction
+#define NEXT_FUSED() \
+  MUSTTAIL return ii[2].handler(rv, ii + 2, X)
+
+// bring csr_cycle up to date before an instruction which may read it
+static void tail_sync(struct riscv_t *rv, const struct interp_inst_t *ii) {
+  struct interp_cache_t *cache = rv->interp;
+  const uint32_t index = (uint32_t)(ii - cache->block->insts);
+  rv->csr_cycle += index - cache->retired;
+  cache->retired = index;
+}
+
+// leave the block after its last instruction
+static bool tail_exit(struct riscv_t *rv) {
+  struct interp_cache_t *cache = rv->interp;
+  // the closing jal of a block is not a guest instruction
+  rv->csr_cycle += cache->block->instructions - cache->retired;
+  return true;
+}
+
+// leave the block after an instruction raised an exception
+static bool tail_trap(struct riscv_t *rv, const struct interp_inst_t *ii) {
+  // the faulting instruction does not retire
+  tail_sync(rv, ii);
+  return false;
+}
+
+// set the PC for a jump, checking its alignment
+static bool tail_jump(struct riscv_t *rv, const struct interp_inst_t *ii, uint32_t target) {
+  rv->PC = target;
+  if (rv->PC & PC_ALIGN_MASK) {
+    rv_except_inst_misaligned(rv, ii->pc);
+  }
+  return tail_exit(rv);
+}
+
+// ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
+// register immediate and register register operations
+// note: instructions writing the zero register are given tc_nop instead
+
+#define RS1   X[ii->ir.rs1]
+#define RS2   X[ii->ir.rs2]
+#define IMM   ((uint32_t)ii->ir.imm)
+
+#define ALU(name, expr)       \
+  HANDLER(tc_##name) {        \
+    X[ii->ir.rd] = (expr);    \
+    NEXT();                   \
+  }
+
+HANDLER(tc_nop) {
+  NEXT();
+}
+
+ALU(li,       IMM)
+ALU(auipc,    ii->pc + IMM)
+ALU(mv,       RS1)
+ALU(mv_rs2,   RS2)
+ALU(addi,     RS1 + IMM)
+ALU(addi_rd,  X[ii->ir.rd] + IMM)
+ALU(slti,     ((int32_t)RS1 < ii->ir.imm) ? 1 : 0)
+ALU(sltiu,    (RS1 < IMM) ? 1 : 0)
+ALU(seqz,     (RS1 == 0) ? 1 : 0)
+ALU(xori,     RS1 ^ IMM)
+ALU(not,      ~RS1)
+ALU(ori,      RS1 | IMM)
+ALU(andi,     RS1 & IMM)
+ALU(slli,     RS1 << (IMM & 0x1f))
+ALU(srli,     RS1 >> (IMM & 0x1f))
+ALU(srai,     (uint32_t)((int32_t)RS1 >> (IMM & 0x1f)))
+ALU(add,      RS1 + RS2)
+ALU(add_rd,   X[ii->ir.rd] + RS2)
+ALU(sub,      RS1 - RS2)
+ALU(neg,      0 - RS2)
+ALU(sll,      RS1 << (RS2 & 0x1f))
+ALU(slt,      ((int32_t)RS1 < (int32_t)RS2) ? 1 : 0)
+ALU(sltu,     (RS1 < RS2) ? 1 : 0)
+ALU(snez,     (RS2 != 0) ? 1 : 0)
+ALU(xor,      RS1 ^ RS2)
+ALU(srl,      RS1 >> (RS2 & 0x1f))
+ALU(sra,      (uint32_t)((int32_t)RS1 >> (RS2 & 0x1f)))
+ALU(or,       RS1 | RS2)
+ALU(and,      RS1 & RS2)
+ALU(mul,      RS1 * RS2)
+ALU(mulh,     (uint32_t)(((int64_t)(int32_t)RS1 * (int64_t)(int32_t)RS2) >> 32))
+ALU(mulhsu,   (uint32_t)(((int64_t)(int32_t)RS1 * (int64_t)(uint64_t)RS2) >> 32))
+ALU(mulhu,    (uint32_t)(((uint64_t)RS1 * (uint64_t)RS2) >> 32))
+ALU(div,      (RS2 == 0) ? ~0u :
+              (RS2 == ~0u && RS1 == 0x80000000u) ? RS1 :
+              (uint32_t)((int32_t)RS1 / (int32_t)RS2))
+ALU(divu,     (RS2 == 0) ? ~0u : RS1 / RS2)
+ALU(rem,      (RS2 == 0) ? RS1 :
+              (RS2 == ~0u && RS1 == 0x80000000u) ? 0 :
+              (uint32_t)((int32_t)RS1 % (int32_t)RS2))
+ALU(remu,     (RS2 == 0) ? RS1 : RS1 % RS2)
+ALU(sh1add,   (RS1 << 1) + RS2)
+ALU(sh2add,   (RS1 << 2) + RS2)
+ALU(sh3add,   (RS1 << 3) + RS2)
+ALU(andn,     RS1 & ~RS2)
+ALU(orn,      RS1 | ~RS2)
+ALU(xnor,     ~(RS1 ^ RS2))
+ALU(clz,      calc_clz(RS1))
+ALU(ctz,      calc_ctz(RS1))
+ALU(cpop,     calc_cpop(RS1))
+ALU(max,      ((int32_t)RS1 > (int32_t)RS2) ? RS1 : RS2)
+ALU(maxu,     (RS1 > RS2) ? RS1 : RS2)
+ALU(min,      ((int32_t)RS1 < (int32_t)RS2) ? RS1 : RS2)
+ALU(minu,     (RS1 < RS2) ? RS1 : RS2)
+ALU(sextb,    sign_extend_b(RS1))
+ALU(sexth,    sign_extend_h(RS1))
+ALU(zexth,    RS1 & 0xffff)
+ALU(rol,      calc_rol(RS1, RS2))
+ALU(ror,      calc_ror(RS1, RS2))
+ALU(rori,     calc_ror(RS1, IMM))
+ALU(orcb,     calc_orcb(RS1))
+ALU(rev8,     calc_rev8(RS1))
+ALU(bclr,     RS1 & ~(1u << (RS2 & 0x1f)))
+ALU(bclri,    RS1 & ~(1u << (IMM & 0x1f)))
+ALU(bext,     (RS1 >> (RS2 & 0x1f)) & 1)
+ALU(bexti,    (RS1 >> (IMM & 0x1f)) & 1)
+ALU(binv,     RS1 ^ (1u << (RS2 & 0x1f)))
+ALU(binvi,    RS1 ^ (1u << (IMM & 0x1f)))
+ALU(bset,     RS1 | (1u << (RS2 & 0x1f)))
+ALU(bseti,    RS1 | (1u << (IMM & 0x1f)))
+
+#undef ALU
+
+// ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
+// loads and stores, accessing host mapped pages directly
+// note: loads into the zero register are given tc_default instead
+
+#define LOAD(name, type, mask, read, ext)                  \
+  HANDLER(tc_##name) {                                     \
+    const uint32_t addr = RS1 + IMM;                       \
+    if (addr & (mask)) {                                   \
+      rv->PC = ii->pc;                                     \
+      rv_except_load_misaligned(rv, addr);                 \
+      return tail_trap(rv, ii);                            \
+    }                                                      \
+    uint8_t *ptr = host_addr(rv->jit.page_table, addr);    \
+    type data;                                             \
+    if (ptr) {                                             \
+      memcpy(&data, ptr, sizeof(data));                    \
+    }                                                      \
+    else {                                                 \
+      data = (type)rv->io.read(rv, addr);                  \
+    }                                                      \
+    X[ii->ir.rd] = ext(data);                              \
+    NEXT();                                                \
+  }
+
+#define STORE(name, type, mask, write)                     \
+  HANDLER(tc_##name) {                                     \
+    const uint32_t addr = RS1 + IMM;                       \
+    if (addr & (mask)) {                                   \
+      rv->PC = ii->pc;                                     \
+      rv_except_store_misaligned(rv, addr);                \
+      return tail_trap(rv, ii);                            \
+    }                                                      \
+    uint8_t *ptr = host_addr(rv->jit.page_table, addr);    \
+    const type data = (type)RS2;                           \
+    if (ptr) {                                             \
+      memcpy(ptr, &data, sizeof(data));                    \
+    }                                                      \
+    else {                                                 \
+      rv->io.write(rv, addr, data);                        \
+    }                                                      \
+    NEXT();                                                \
+  }
+
+LOAD(lb,  uint8_t,  0, mem_read_b, sign_extend_b)
+LOAD(lh,  uint16_t, 1, mem_read_s, sign_extend_h)
+LOAD(lw,  uint32_t, 3, mem_read_w, )
+LOAD(lbu, uint8_t,  0, mem_read_b, )
+LOAD(lhu, uint16_t, 1, mem_read_s, )
+STORE(sb, uint8_t,  0, mem_write_b)
+STORE(sh, uint16_t, 1, mem_write_s)
+STORE(sw, uint32_t, 3, mem_write_w)
+
+#undef STORE
+#undef LOAD
+
+#if RISCV_VM_SUPPORT_RV32F
+HANDLER(tc_flw) {
+  const uint32_t addr = RS1 + IMM;
+  uint8_t *ptr = host_addr(rv->jit.page_table, addr);
+  uint32_t data;
+  if (ptr) {
+    memcpy(&data, ptr, 4);
+  }
+  else {
+    data = rv->io.mem_read_w(rv, addr);
+  }
+  fp_write_w(rv, ii->ir.rd, data);
+  NEXT();
+}
+
+HANDLER(tc_fsw) {
+  const uint32_t addr = RS1 + IMM;
+  uint8_t *ptr = host_addr(rv->jit.page_table, addr);
+  if (ptr) {
+    memcpy(ptr, &rv->F[ii->ir.rs2].f, 4);
+  }
+  else {
+    rv->io.mem_write_w(rv, addr, (uint32_t)rv->F[ii->ir.rs2].bits);
+  }
+  NEXT();
+}
+
+// ties to max magnitude are fixed up as rmm_op
+#define FPU(name, op, rmm_op)                                           \
+  HANDLER(tc_##name) {                                                  \
+    const int round = fp_round_begin(ii->ir.rm);                        \
+    const float a = rv->F[ii->ir.rs1].f;                                \
+    const float b = rv->F[ii->ir.rs2].f;                                \
+    float r = a op b;                                                   \
+    if (fp_is_rmm(rv, ii->ir.rm)) {                                     \
+      r = fp_rmm(rmm_op, r, a, b, 0.);                                  \
+    }                                                                   \
+    fp_write_s(rv, ii->ir.rd, fp_canonical(r));                         \
+    fp_round_end(round);                                                \
+    NEXT();                                                             \
+  }
+
+FPU(fadds, +, FP_RMM_ADD)
+FPU(fsubs, -, FP_RMM_SUB)
+FPU(fmuls, *, FP_RMM_MUL)
+FPU(fdivs, /, FP_RMM_DIV)
+
+#undef FPU
+#endif  // RISCV_VM_SUPPORT_RV32F
+
+#if RISCV_VM_SUPPORT_RV32D
+// only aligned doubles are accessed directly, as they can't cross a page
+HANDLER(tc_fld) {
+  const uint32_t addr = RS1 + IMM;
+  uint8_t *ptr = (addr & 7) ? NULL : host_addr(rv->jit.page_table, addr);
+  if (ptr) {
+    memcpy(&rv->F[ii->ir.rd].bits, ptr, 8);
+  }
+  else {
+    rv->F[ii->ir.rd].bits = fp_read_d(rv, addr);
+  }
+  NEXT();
+}
+
+HANDLER(tc_fsd) {
+  const uint32_t addr = RS1 + IMM;
+  uint8_t *ptr = (addr & 7) ? NULL : host_addr(rv->jit.page_table, addr);
+  if (ptr) {
+    memcpy(ptr, &rv->F[ii->ir.rs2].bits, 8);
+  }
+  else {
+    fp_write_d(rv, addr, rv->F[ii->ir.rs2].bits);
+  }
+  NEXT();
+}
+
+#define FPU(name, op, rmm_op)                                           \
+  HANDLER(tc_##name) {                                                  \
+    const int round = fp_round_begin(ii->ir.rm);                        \
+    const double a = rv->F[ii->ir.rs1].d;                               \
+    const double b = rv->F[ii->ir.rs2].d;                               \
+    double r = a op b;                                                  \
+    if (fp_is_rmm(rv, ii->ir.rm)) {                                     \
+      r = fp_rmm_d(rmm_op, r, a, b, 0.);                                \
+    }                                                                   \
+    rv->F[ii->ir.rd].d = fp_canonical_d(r);                             \
+    fp_round_end(round);                                                \
+    NEXT();                                                             \
+  }
+
+FPU(faddd, +, FP_RMM_ADD)
+FPU(fsubd, -, FP_RMM_SUB)
+FPU(fmuld, *, FP_RMM_MUL)
+FPU(fdivd, /, FP_RMM_DIV)
+
+#undef FPU
+#endif  // RISCV_VM_SUPPORT_RV32D
+
+// ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
+// jumps and branches
+
+HANDLER(tc_jal) {
+  X[ii->ir.rd] = ii->pc + inst_length(ii->inst);
+  return tail_jump(rv, ii, ii->pc + IMM);
+}
+
+HANDLER(tc_j) {
+  return tail_jump(rv, ii, ii->pc + IMM);
+}
+
+HANDLER(tc_jalr) {
+  const uint32_t target = (RS1 + IMM) & ~1u;
+  X[ii->ir.rd] = ii->pc + inst_length(ii->inst);
+  return tail_jump(rv, ii, target);
+}
+
+HANDLER(tc_jr) {
+  return tail_jump(rv, ii, (RS1 + IMM) & ~1u);
+}
+
+#define BRANCH(name, cond)                                                     \
+  HANDLER(tc_##name) {                                                         \
+    return tail_jump(rv, ii, ii->pc + ((cond) ? IMM : inst_length(ii->inst))); \
+  }
+
+BRANCH(beq,  RS1 == RS2)
+BRANCH(bne,  RS1 != RS2)
+BRANCH(blt,  (int32_t)RS1 <  (int32_t)RS2)
+BRANCH(bge,  (int32_t)RS1 >= (int32_t)RS2)
+BRANCH(bltu, RS1 <  RS2)
+BRANCH(bgeu, RS1 >= RS2)
+BRANCH(beqz, RS1 == 0)
+BRANCH(bnez, RS1 != 0)
+BRANCH(bltz, (int32_t)RS1 <  0)
+BRANCH(bgez, (int32_t)RS1 >= 0)
+
+#undef BRANCH
+
+#undef IMM
+#undef RS2
+#undef RS1
+
+// ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
+// superinstructions
+
+#if RISCV_INTERP_PROFILE
+#define FUSED_HIT()  ++rv->interp->fused_hits[ii->ir.opcode - rv_fuse_li]
+#else
+#define FUSED_HIT()
+#endif
+
+HANDLER(tc_fuse_li) {
+  FUSED_HIT();
+  X[ii->ir.rd] = ii->ir.imm;
+  NEXT_FUSED();
+}
+
+HANDLER(tc_fuse_call) {
+  // the auipc result was folded into the immediate
+  const struct interp_inst_t *jalr = ii + 1;
+  FUSED_HIT();
+  X[ii->ir.rd] = ii->ir.imm;
+  X[jalr->ir.rd] = jalr->pc + inst_length(jalr->inst);
+  X[rv_reg_zero] = 0;
+  return tail_jump(rv, jalr, (ii->ir.imm + jalr->ir.imm) & ~1u);
+}
+
+HANDLER(tc_fuse_index) {
+  const struct interp_inst_t *add = ii + 1;
+  FUSED_HIT();
+  X[ii->ir.rd] = X[ii->ir.rs1] << (ii->ir.imm & 0x1f);
+  X[add->ir.rd] = X[add->ir.rs1] + X[add->ir.rs2];
+  NEXT_FUSED();
+}
+
+#define CMP_BRANCH(name, cmp)                                                                 \
+  HANDLER(tc_fuse_##name) {                                                                   \
+    const struct interp_inst_t *br = ii + 1;                                                  \
+    const uint32_t value = (cmp) ? 1 : 0;                                                     \
+    FUSED_HIT();                                                                              \
+    X[ii->ir.rd] = value;                                                                     \
+    const bool taken = value == (br->ir.opcode == rv_inst_bne);                               \
+    return tail_jump(rv, br, br->pc + (taken ? br->ir.imm : (int32_t)inst_length(br->inst))); \
+  }
+
+CMP_BRANCH(slt_branch,   (int32_t)X[ii->ir.rs1] < (int32_t)X[ii->ir.rs2])
+CMP_BRANCH(sltu_branch,  X[ii->ir.rs1] < X[ii->ir.rs2])
+CMP_BRANCH(slti_branch,  (int32_t)X[ii->ir.rs1] < ii->ir.imm)
+CMP_BRANCH(sltiu_branch, X[ii->ir.rs1] < (uint32_t)ii->ir.imm)
+
+#undef CMP_BRANCH
+#undef FUSED_HIT
+
+// ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
+// system instructions
+
+HANDLER(tc_fencei) {
+  // the cache is emptied once the block has finished
+  rv->PC = ii->pc + inst_length(ii->inst);
+  return tail_exit(rv);
+}
+
+HANDLER(tc_ecall) {
+  // step over first so the handler sees the return address
+  rv->PC = ii->pc + inst_length(ii->inst);
+  tail_sync(rv, ii);
+  rv->io.on_ecall(rv);
+  return tail_exit(rv);
+}
+
+HANDLER(tc_ebreak) {
+  rv->PC = ii->pc;
+  tail_sync(rv, ii);
+  rv->io.on_ebreak(rv);
+  rv->PC += inst_length(ii->inst);
+  return tail_exit(rv);
+}
+
+// everything else is run by the single step handlers
+HANDLER(tc_default) {
+  rv->PC = ii->pc;
+  tail_sync(rv, ii);
+  // note: these instructions only return false on an exception
+  if (!interp_step_inst(rv, ii->inst)) {
+    return tail_trap(rv, ii);
+  }
+  // not every single step handler enforces the zero register
+  X[rv_reg_zero] = 0;
+  NEXT();
+}
+
+// ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ---- ----
+
+// pick the handler for an instruction writing rd, or tc_nop if rd is zero
+static interp_handler_t alu_handler(const struct rv_inst_t *ir, interp_handler_t handler) {
+  return (ir->rd == rv_reg_zero) ? tc_nop : handler;
+}
+
+// pick the handler for a load, leaving loads into zero to tc_default
+static interp_handler_t load_handler(const struct rv_inst_t *ir, interp_handler_t handler) {
+  return (ir->rd == rv_reg_zero) ? tc_default : handler;
+}
+
+interp_handler_t tail_handler(const struct interp_inst_t *ii) {
+  const struct rv_inst_t *ir = &ii->ir;
+  const bool rs1_zero = ir->rs1 == rv_reg_zero;
+  const bool rs2_zero = ir->rs2 == rv_reg_zero;
+  switch (ir->opcode) {
+  // RV32I
+  case rv_inst_lui:    return alu_handler(ir, tc_li);
+  case rv_inst_auipc:  return alu_handler(ir, tc_auipc);
+  case rv_inst_jal:    return (ir->rd == rv_reg_zero) ? tc_j : tc_jal;
+  case rv_inst_jalr:   return (ir->rd == rv_reg_zero) ? tc_jr : tc_jalr;
+  case rv_inst_beq:    return rs2_zero ? tc_beqz : tc_beq;
+  case rv_inst_bne:    return rs2_zero ? tc_bnez : tc_bne;
+  case rv_inst_blt:    return rs2_zero ? tc_bltz : tc_blt;
+  case rv_inst_bge:    return rs2_zero ? tc_bgez : tc_bge;
+  case rv_inst_bltu:   return tc_bltu;
+  case rv_inst_bgeu:   return tc_bgeu;
+  case rv_inst_lb:     return load_handler(ir, tc_lb);
+  case rv_inst_lh:     return load_handler(ir, tc_lh);
+  case rv_inst_lw:     return load_handler(ir, tc_lw);
+  case rv_inst_lbu:    return load_handler(ir, tc_lbu);
+  case rv_inst_lhu:    return load_handler(ir, tc_lhu);
+  case rv_inst_sb:     return tc_sb;
+  case rv_inst_sh:     return tc_sh;
+  case rv_inst_sw:     return tc_sw;
+  case rv_inst_addi:
+    if (rs1_zero) {
+      return alu_handler(ir, tc_li);
+    }
+    if (ir->imm == 0) {
+      return alu_handler(ir, tc_mv);
+    }
+    return alu_handler(ir, (ir->rd == ir->rs1) ? tc_addi_rd : tc_addi);
+  case rv_inst_slti:   return alu_handler(ir, tc_slti);
+  case rv_inst_sltiu:  return alu_handler(ir, (ir->imm == 1) ? tc_seqz : tc_sltiu);
+  case rv_inst_xori:   return alu_handler(ir, (ir->imm == -1) ? tc_not : tc_xori);
+  case rv_inst_ori:    return alu_handler(ir, tc_ori);
+  case rv_inst_andi:   return alu_handler(ir, tc_andi);
+  case rv_inst_slli:   return alu_handler(ir, tc_slli);
+  case rv_inst_srli:   return alu_handler(ir, tc_srli);
+  case rv_inst_srai:   return alu_handler(ir, tc_srai);
+  case rv_inst_add:
+    if (rs2_zero) {
+      return alu_handler(ir, tc_mv);
+    }
+    if (rs1_zero) {
+      return alu_handler(ir, tc_mv_rs2);
+    }
+    return alu_handler(ir, (ir->rd == ir->rs1) ? tc_add_rd : tc_add);
+  case rv_inst_sub:    return alu_handler(ir, rs1_zero ? tc_neg : tc_sub);
+  case rv_inst_sll:    return alu_handler(ir, tc_sll);
+  case rv_inst_slt:    return alu_handler(ir, tc_slt);
+  case rv_inst_sltu:   return alu_handler(ir, rs1_zero ? tc_snez : tc_sltu);
+  case rv_inst_xor:    return alu_handler(ir, tc_xor);
+  case rv_inst_srl:    return alu_handler(ir, tc_srl);
+  case rv_inst_sra:    return alu_handler(ir, tc_sra);
+  case rv_inst_or:     return alu_handler(ir, tc_or);
+  case rv_inst_and:    return alu_handler(ir, tc_and);
+  case rv_inst_fence:  return tc_nop;
+  case rv_inst_ecall:  return tc_ecall;
+  case rv_inst_ebreak: return tc_ebreak;
+  // RV32M
+  case rv_inst_mul:    return alu_handler(ir, tc_mul);
+  case rv_inst_mulh:   return alu_handler(ir, tc_mulh);
+  case rv_inst_mulhsu: return alu_handler(ir, tc_mulhsu);
+  case rv_inst_mulhu:  return alu_handler(ir, tc_mulhu);
+  case rv_inst_div:    return alu_handler(ir, tc_div);
+  case rv_inst_divu:   return alu_handler(ir, tc_divu);
+  case rv_inst_rem:    return alu_handler(ir, tc_rem);
+  case rv_inst_remu:   return alu_handler(ir, tc_remu);
+  // RV32 Zba
+  case rv_inst_sh1add: return alu_handler(ir, tc_sh1add);
+  case rv_inst_sh2add: return alu_handler(ir, tc_sh2add);
+  case rv_inst_sh3add: return alu_handler(ir, tc_sh3add);
+  // RV32 Zbb
+  case rv_inst_andn:   return alu_handler(ir, tc_andn);
+  case rv_inst_orn:    return alu_handler(ir, tc_orn);
+  case rv_inst_xnor:   return alu_handler(ir, tc_xnor);
+  case rv_inst_clz:    return alu_handler(ir, tc_clz);
+  case rv_inst_ctz:    return alu_handler(ir, tc_ctz);
+  case rv_inst_cpop:   return alu_handler(ir, tc_cpop);
+  case rv_inst_max:    return alu_handler(ir, tc_max);
+  case rv_inst_maxu:   return alu_handler(ir, tc_maxu);
+  case rv_inst_min:    return alu_handler(ir, tc_min);
+  case rv_inst_minu:   return alu_handler(ir, tc_minu);
+  case rv_inst_sextb:  return alu_handler(ir, tc_sextb);
+  case rv_inst_sexth:  return alu_handler(ir, tc_sexth);
+  case rv_inst_zexth:  return alu_handler(ir, tc_zexth);
+  case rv_inst_rol:    return alu_handler(ir, tc_rol);
+  case rv_inst_ror:    return alu_handler(ir, tc_ror);
+  case rv_inst_rori:   return alu_handler(ir, tc_rori);
+  case rv_inst_orcb:   return alu_handler(ir, tc_orcb);
+  case rv_inst_rev8:   return alu_handler(ir, tc_rev8);
+  // RV32 Zbs
+  case rv_inst_bclr:   return alu_handler(ir, tc_bclr);
+  case rv_inst_bclri:  return alu_handler(ir, tc_bclri);
+  case rv_inst_bext:   return alu_handler(ir, tc_bext);
+  case rv_inst_bexti:  return alu_handler(ir, tc_bexti);
+  case rv_inst_binv:   return alu_handler(ir, tc_binv);
+  case rv_inst_binvi:  return alu_handler(ir, tc_binvi);
+  case rv_inst_bset:   return alu_handler(ir, tc_bset);
+  case rv_inst_bseti:  return alu_handler(ir, tc_bseti);
+#if RISCV_VM_SUPPORT_RV32F
+  // RV32F
+  case rv_inst_flw:    return tc_flw;
+  case rv_inst_fsw:    return tc_fsw;
+  case rv_inst_fadds:  return tc_fadds;
+  case rv_inst_fsubs:  return tc_fsubs;
+  case rv_inst_fmuls:  return tc_fmuls;
+  case rv_inst_fdivs:  return tc_fdivs;
+#endif
+#if RISCV_VM_SUPPORT_RV32D
+  // RV32D
+  case rv_inst_fld:    return tc_fld;
+  case rv_inst_fsd:    return tc_fsd;
+  case rv_inst_faddd:  return tc_faddd;
+  case rv_inst_fsubd:  return tc_fsubd;
+  case rv_inst_fmuld:  return tc_fmuld;
+  case rv_inst_fdivd:  return tc_fdivd;
+#endif
+  // RV32 Zifencei
+  case rv_inst_fencei: return tc_fencei;
+  // superinstructions
+  case rv_fuse_li:
+  case rv_fuse_la:           return tc_fuse_li;
+  case rv_fuse_call:         return tc_fuse_call;
+  case rv_fuse_index:        return tc_fuse_index;
+  case rv_fuse_slt_branch:   return tc_fuse_slt_branch;
+  case rv_fuse_sltu_branch:  return tc_fuse_sltu_branch;
+  case rv_fuse_slti_branch:  return tc_fuse_slti_branch;
+  case rv_fuse_sltiu_branch: return tc_fuse_sltiu_branch;
+  default:
+    return tc_default;
+  }
+}
+
+void tail_run(struct riscv_t *rv, const struct interp_block_t *block) {
+  struct interp_cache_t *cache = rv->interp;
+  cache->block = block;
+  cache->retired = 0;
+  block->insts[0].handler(rv, block->insts, rv->X);
+}
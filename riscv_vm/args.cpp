@@ -7,6 +7,10 @@ extern bool g_arg_compliance;
 extern bool g_arg_show_mips;
 extern bool g_fullscreen;
 extern bool g_no_jit;
+extern bool g_no_host_mem;
+extern bool g_no_host_ext;
+extern bool g_print_stats;
+extern bool g_tail_call;
 
 extern const char *g_arg_program;
 
@@ -21,6 +25,10 @@ void print_usage(const char *filename) {
   --trace        | Print execution trace
   --show-mips    | Show MIPS throughput
   --fullscreen   | Run in a fullscreen window
+  --no-host-mem  | Access all memory via the io callbacks
+  --no-host-ext  | Only emit baseline (sse2) host code from the jit
+  --stats        | Print emulator statistics on exit
+  --tail-call    | Use the tail call interpreter
 )", filename);
 }
 
@@ -49,6 +57,22 @@ bool parse_args(int argc, char **args) {
         g_fullscreen = true;
         continue;
       }
+      if (0 == strcmp(arg, "--no-host-mem")) {
+        g_no_host_mem = true;
+        continue;
+      }
+      if (0 == strcmp(arg, "--no-host-ext")) {
+        g_no_host_ext = true;
+        continue;
+      }
+      if (0 == strcmp(arg, "--stats")) {
+        g_print_stats = true;
+        continue;
+      }
+      if (0 == strcmp(arg, "--tail-call")) {
+        g_tail_call = true;
+        continue;
+      }
       // error
       fprintf(stderr, "Unknown argument '%s'\n", arg);
       return false;
@@ -22,6 +22,14 @@ bool g_arg_show_mips = false;
 bool g_fullscreen = false;
 // disable jit code generation
 bool g_no_jit = false;
+// disable direct access to host mapped memory
+bool g_no_host_mem = false;
+// disable the host instruction set extensions in translated code
+bool g_no_host_ext = false;
+// print emulator statistics on exit
+bool g_print_stats = false;
+// run the interpreter with tail calls between specialised handlers
+bool g_tail_call = false;
 
 // main syscall handler
 void syscall_handler(struct riscv_t *);
@@ -118,8 +126,8 @@ void run_and_show_mips(riscv_t *rv, state_t *state, elf_t &elf) {
   }
 }
 
-// run the core
-void run(riscv_t *rv, state_t *state, elf_t &elf) {
+// run a single hart until it halts
+void run_hart(riscv_t *rv) {
   static const uint32_t cycles_per_step = 100;
   // run until we see the flag that we are done
   for (; !rv_has_halted(rv);) {
@@ -128,6 +136,27 @@ void run(riscv_t *rv, state_t *state, elf_t &elf) {
   }
 }
 
+// run the core
+void run(riscv_t *rv, state_t *state, elf_t &elf) {
+  run_hart(rv);
+}
+
+// wait for all harts spawned by the guest to halt
+void join_harts(state_t *state) {
+  for (size_t i = 0;; ++i) {
+    std::thread thread;
+    {
+      // note: harts may still be spawning more threads
+      std::lock_guard<std::mutex> guard(state->lock);
+      if (i >= state->threads.size()) {
+        break;
+      }
+      thread = std::move(state->threads[i]);
+    }
+    thread.join();
+  }
+}
+
 void print_signature(state_t *state, elf_t &elf) {
   uint32_t start = 0, end = 0;
   // use the entire .data section as a fallback
@@ -146,8 +175,57 @@ void print_signature(state_t *state, elf_t &elf) {
   }
 }
 
+// setup the IO handlers for the VM
+const riscv_io_t io = {
+  imp_mem_ifetch,
+  imp_mem_read_w,
+  imp_mem_read_s,
+  imp_mem_read_b,
+  imp_mem_write_w,
+  imp_mem_write_s,
+  imp_mem_write_b,
+  imp_on_ecall,
+  imp_on_ebreak,
+};
+
 } // namespace {}
 
+// create a new hart as a copy of parent, which is not yet running
+// note: the state lock must be held
+riscv_t *hart_clone(riscv_t *parent) {
+  state_t *state = (state_t*)rv_userdata(parent);
+  // share translated code with the parent as it runs the same program
+  riscv_t *rv = rv_create_shared(&io, state, parent);
+  if (!rv) {
+    return nullptr;
+  }
+  if (!g_no_host_mem) {
+    rv_set_page_table(rv, state->mem.page_table());
+  }
+  for (uint32_t i = 0; i < 32; ++i) {
+    rv_set_reg(rv, i, rv_get_reg(parent, i));
+  }
+  rv_set_pc(rv, rv_get_pc(parent));
+  rv_set_hart_id(rv, riscv_word_t(state->harts.size()));
+  state->harts.push_back(rv);
+  return rv;
+}
+
+// start a hart from hart_clone running on its own thread
+// note: the state lock must be held
+void hart_start(riscv_t *rv) {
+  state_t *state = (state_t*)rv_userdata(rv);
+  state->threads.emplace_back(run_hart, rv);
+}
+
+// halt every hart
+// note: the state lock must be held
+void hart_halt_all(state_t *state) {
+  for (riscv_t *rv : state->harts) {
+    rv_halt(rv);
+  }
+}
+
 
 int main(int argc, char **args) {
 
@@ -164,19 +242,6 @@ int main(int argc, char **args) {
     return 1;
   }
 
-  // setup the IO handlers for the VM
-  const riscv_io_t io = {
-    imp_mem_ifetch,
-    imp_mem_read_w,
-    imp_mem_read_s,
-    imp_mem_read_b,
-    imp_mem_write_w,
-    imp_mem_write_s,
-    imp_mem_write_b,
-    imp_on_ecall,
-    imp_on_ebreak,
-  };
-
   auto state = std::make_unique<state_t>();
   state->break_addr = 0;
   state->fd_map[0] = stdin;
@@ -189,11 +254,23 @@ int main(int argc, char **args) {
   }
 
   // create the VM
-  riscv_t *rv = rv_create(&io, state.get());
+  riscv_t *rv = rv_create_interp(&io, state.get(),
+    g_tail_call ? rv_interp_tail_call : rv_interp_threaded);
   if (!rv) {
     fprintf(stderr, "Unable to create riscv emulator\n");
     return 1;
   }
+  state->harts.push_back(rv);
+
+  // harts cloned from this core share its host instruction set
+  if (g_no_host_ext) {
+    rv_set_host_baseline(rv);
+  }
+
+  // let the core access our memory chunks directly
+  if (!g_no_host_mem) {
+    rv_set_page_table(rv, state->mem.page_table());
+  }
 
   // upload the ELF file into our memory abstraction
   if (!elf.upload(rv, state->mem)) {
@@ -211,13 +288,20 @@ int main(int argc, char **args) {
   else {
     run(rv, state.get(), elf);
   }
+  join_harts(state.get());
 
   // print execution signature
   if (g_arg_compliance) {
     print_signature(state.get(), elf);
   }
 
+  if (g_print_stats) {
+    rv_print_stats(rv);
+  }
+
   // delete the VM
-  rv_delete(rv);
+  for (riscv_t *hart : state->harts) {
+    rv_delete(hart);
+  }
   return 0;
 }
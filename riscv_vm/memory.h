@@ -1,8 +1,10 @@
 #pragma once
 #include <cstdint>
 #include <array>
+#include <atomic>
 #include <cstring>
 #include <cassert>
+#include <mutex>
 
 
 struct memory_t {
@@ -39,7 +41,11 @@ struct memory_t {
   // read an instruction from memory
   uint32_t read_ifetch(uint32_t addr) {
     const uint32_t addr_lo = addr & mask_lo;
-    assert((addr_lo & 3) == 0);
+    assert((addr_lo & 1) == 0);
+    // a compressed instruction may sit in the last halfword of a chunk
+    if (addr_lo > 0xfffc) {
+      return read_w(addr);
+    }
     chunk_t *c = chunks[addr >> 16];
     assert(c);
     return *(const uint32_t *)(c->data.data() + addr_lo);
@@ -127,9 +133,7 @@ struct memory_t {
       uint32_t x = p >> 16;
       chunk_t *c = chunks[x];
       if (c == nullptr) {
-        c = new chunk_t;
-        c->data.fill(0);
-        chunks[x] = c;
+        c = alloc_chunk(x);
       }
       c->data[p & 0xffff] = src[i];
     }
@@ -141,14 +145,18 @@ struct memory_t {
       uint32_t x = p >> 16;
       chunk_t *c = chunks[x];
       if (c == nullptr) {
-        c = new chunk_t;
-        c->data.fill(0);
-        chunks[x] = c;
+        c = alloc_chunk(x);
       }
       c->data[p & 0xffff] = val;
     }
   }
 
+  // return the chunk table so that the core can access memory directly
+  uint8_t **page_table() {
+    // note: chunk_t data must sit at the start of the chunk
+    return (uint8_t**)chunks.data();
+  }
+
   void clear() {
     for (chunk_t *c : chunks) {
       if (c) {
@@ -159,8 +167,23 @@ struct memory_t {
   }
 
 protected:
+  // allocate a chunk which harts on other threads may be accessing
+  chunk_t *alloc_chunk(uint32_t x) {
+    std::lock_guard<std::mutex> guard(alloc_lock);
+    chunk_t *c = chunks[x];
+    if (c == nullptr) {
+      c = new chunk_t;
+      c->data.fill(0);
+      // publish only once zeroed as readers (and the jit) do not lock
+      std::atomic_thread_fence(std::memory_order_release);
+      chunks[x] = c;
+    }
+    return c;
+  }
+
   static const uint32_t mask_lo = 0xffff;
   static const uint32_t mask_hi = ~mask_lo;
 
   std::array<chunk_t*, 0x10000> chunks;
+  std::mutex alloc_lock;
 };
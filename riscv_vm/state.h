@@ -1,6 +1,9 @@
 #pragma once
 #include <map>
+#include <mutex>
 #include <stdio.h>
+#include <thread>
+#include <vector>
 
 #include "../riscv_core/riscv.h"
 
@@ -13,4 +16,10 @@ struct state_t {
   riscv_word_t break_addr;
   // file descriptor map
   std::map<int, FILE *> fd_map;
+  // serialises syscalls made by harts on different threads
+  std::mutex lock;
+  // all harts indexed by hart id
+  std::vector<riscv_t *> harts;
+  // threads running the harts spawned by the guest
+  std::vector<std::thread> threads;
 };
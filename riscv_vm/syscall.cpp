@@ -1,6 +1,11 @@
 #include <cstdint>
 #include <cstdio>
 #include <ctime>
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <alloca.h>
+#endif
 
 #include "../riscv_core/riscv.h"
 #include "state.h"
@@ -37,6 +42,7 @@ enum {
   SYS_brk = 214,
   SYS_munmap = 215,
   SYS_mremap = 216,
+  SYS_clone = 220,
   SYS_mmap = 222,
   SYS_open = 1024,
   SYS_link = 1025,
@@ -49,6 +55,11 @@ enum {
   SYS_getmainvars = 2011,
 };
 
+enum {
+  // note: prefixed as the host headers may define the linux flag
+  RV_CLONE_SETTLS = 0x00080000,
+};
+
 enum {
   O_RDONLY = 0,
   O_WRONLY = 1,
@@ -60,6 +71,11 @@ enum {
 void syscall_draw_frame(struct riscv_t *rv);
 void syscall_draw_frame_pal(struct riscv_t *rv);
 
+// from main.cpp
+riscv_t *hart_clone(riscv_t *parent);
+void hart_start(riscv_t *rv);
+void hart_halt_all(state_t *state);
+
 namespace {
 
 int find_free_fd(struct state_t *s) {
@@ -110,15 +126,52 @@ void syscall_write(struct riscv_t *rv) {
   }
 }
 
-void syscall_exit(struct riscv_t *rv) {
+void syscall_exit_group(struct riscv_t *rv) {
   // access userdata
   state_t *s = (state_t*)rv_userdata(rv);
-  rv_halt(rv);
+  hart_halt_all(s);
   // _exit(code);
   riscv_word_t code = rv_get_reg(rv, rv_reg_a0);
   fprintf(stdout, "inferior exit code %d\n", (int)code);
 }
 
+void syscall_exit(struct riscv_t *rv) {
+  // access userdata
+  state_t *s = (state_t*)rv_userdata(rv);
+  // note: newlib exits the program this way so the first hart ends them all
+  if (rv == s->harts.front()) {
+    syscall_exit_group(rv);
+    return;
+  }
+  // only this hart exits
+  rv_halt(rv);
+}
+
+void syscall_clone(struct riscv_t *rv) {
+  // access userdata
+  state_t *s = (state_t*)rv_userdata(rv);
+  // clone(flags, stack, ptid, tls, ctid);
+  riscv_word_t flags = rv_get_reg(rv, rv_reg_a0);
+  riscv_word_t stack = rv_get_reg(rv, rv_reg_a1);
+  riscv_word_t tls   = rv_get_reg(rv, rv_reg_a3);
+  // the child starts as a copy of this hart returning from the ecall
+  riscv_t *child = hart_clone(rv);
+  if (!child) {
+    rv_set_reg(rv, rv_reg_a0, -1);
+    return;
+  }
+  if (stack) {
+    rv_set_reg(child, rv_reg_sp, stack);
+  }
+  if (flags & RV_CLONE_SETTLS) {
+    rv_set_reg(child, rv_reg_tp, tls);
+  }
+  rv_set_reg(child, rv_reg_a0, 0);
+  // the parent gets the hart id of the child
+  rv_set_reg(rv, rv_reg_a0, riscv_word_t(s->harts.size() - 1));
+  hart_start(child);
+}
+
 void syscall_brk(struct riscv_t *rv) {
   // access userdata
   state_t *s = (state_t*)rv_userdata(rv);
@@ -279,6 +332,8 @@ void syscall_handler(struct riscv_t *rv) {
   state_t *s = (state_t*)rv_userdata(rv);
   // get the syscall number
   riscv_word_t syscall = rv_get_reg(rv, rv_reg_a7);
+  // harts on other threads share the state
+  std::lock_guard<std::mutex> guard(s->lock);
   // dispatch call type
   switch (syscall) {
   case SYS_close: 
@@ -302,6 +357,12 @@ void syscall_handler(struct riscv_t *rv) {
   case SYS_exit:
     syscall_exit(rv);
     break;
+  case SYS_exit_group:
+    syscall_exit_group(rv);
+    break;
+  case SYS_clone:
+    syscall_clone(rv);
+    break;
   case SYS_gettimeofday:
     syscall_gettimeofday(rv);
     break;
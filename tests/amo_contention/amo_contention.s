@@ -0,0 +1,231 @@
+# amo_contention.s
+#
+#   Microbenchmark for RV32A under contention.  Spawns harts with the clone
+#   syscall which all hammer the same words using amoadd.w, lr.w/sc.w and an
+#   amoswap.w spinlock, timing each phase and checking the final counts.
+#
+#   Build:
+#     llvm-mc -triple=riscv32 -mattr=+m,+a,-relax -filetype=obj \
+#       amo_contention.s -o amo_contention.o
+#     ld.lld -Ttext=0x10000 amo_contention.o -o amo_contention.elf
+
+  .equ HARTS,            4
+  .equ ITERS,            1000000
+  .equ STACK_BASE,       0x40000000
+  .equ STACK_SIZE,       0x10000
+
+  # shared words, each on its own cache line in zeroed memory
+  .equ AMO_COUNT,        0x20000
+  .equ LRSC_COUNT,       0x20040
+  .equ LOCK,             0x20080
+  .equ LOCK_COUNT,       0x200c0
+  .equ BAR_COUNT,        0x20100
+  .equ BAR_GEN,          0x20140
+  # first hart only
+  .equ FAILED,           0x20180
+  .equ TV,               0x201c0
+  .equ NUM_END,          0x20200
+
+  .equ SYS_write,        64
+  .equ SYS_exit,         93
+  .equ SYS_gettimeofday, 169
+  .equ SYS_clone,        220
+
+  .text
+  .globl _start
+_start:
+  la a0, msg_title
+  jal ra, print_str
+  # spawn the other harts, each with its own stack
+  li s0, 1
+spawn:
+  li t0, STACK_SIZE
+  mul a1, s0, t0
+  li t0, STACK_BASE
+  add a1, a1, t0
+  li a0, 0
+  li a7, SYS_clone
+  ecall
+  beqz a0, worker
+  addi s0, s0, 1
+  li t0, HARTS
+  bne s0, t0, spawn
+
+worker:
+  csrr s11, mhartid
+
+  # phase 1: amoadd.w on a shared counter
+  jal ra, phase_start
+  li t0, AMO_COUNT
+  li t1, ITERS
+  li t2, 1
+1:
+  amoadd.w zero, t2, (t0)
+  addi t1, t1, -1
+  bnez t1, 1b
+  la a0, msg_amo
+  li a1, AMO_COUNT
+  jal ra, phase_end
+
+  # phase 2: lr.w/sc.w increment of a shared counter
+  jal ra, phase_start
+  li t0, LRSC_COUNT
+  li t1, ITERS
+2:
+  lr.w t2, (t0)
+  addi t2, t2, 1
+  sc.w t3, t2, (t0)
+  bnez t3, 2b
+  addi t1, t1, -1
+  bnez t1, 2b
+  la a0, msg_lrsc
+  li a1, LRSC_COUNT
+  jal ra, phase_end
+
+  # phase 3: amoswap.w spinlock around a plain increment
+  jal ra, phase_start
+  li t0, LOCK
+  li t4, LOCK_COUNT
+  li t1, ITERS
+  li t5, 1
+3:
+  amoswap.w.aq t2, t5, (t0)
+  bnez t2, 3b
+  lw t3, 0(t4)
+  addi t3, t3, 1
+  sw t3, 0(t4)
+  amoswap.w.rl zero, zero, (t0)
+  addi t1, t1, -1
+  bnez t1, 3b
+  la a0, msg_lock
+  li a1, LOCK_COUNT
+  jal ra, phase_end
+
+  # the first hart exits the program once the others are done
+  beqz s11, finish
+  li a0, 0
+  li a7, SYS_exit
+  ecall
+finish:
+  li t0, FAILED
+  lw a0, 0(t0)
+  li a7, SYS_exit
+  ecall
+
+# wait for all harts, then the first hart records the start time in s9
+phase_start:
+  mv s10, ra
+  jal ra, barrier
+  bnez s11, 1f
+  jal ra, now_ms
+  mv s9, a0
+1:
+  jr s10
+
+# wait for all harts, then the first hart reports the time taken and checks
+# the counter at a1 (message in a0)
+phase_end:
+  mv s10, ra
+  mv s7, a0
+  mv s6, a1
+  jal ra, barrier
+  bnez s11, 2f
+  jal ra, now_ms
+  sub s5, a0, s9
+  mv a0, s7
+  jal ra, print_str
+  mv a0, s5
+  jal ra, print_uint
+  la a0, msg_ms
+  jal ra, print_str
+  lw t0, 0(s6)
+  li t1, HARTS * ITERS
+  la a0, msg_ok
+  beq t0, t1, 1f
+  li t2, FAILED
+  li t3, 1
+  sw t3, 0(t2)
+  la a0, msg_fail
+1:
+  jal ra, print_str
+2:
+  jr s10
+
+# sense reversing barrier across all harts
+barrier:
+  li t0, BAR_GEN
+  lw t1, 0(t0)
+  li t2, BAR_COUNT
+  li t3, 1
+  amoadd.w t4, t3, (t2)
+  li t3, HARTS - 1
+  bne t4, t3, 1f
+  # the last hart to arrive resets the count and releases the others
+  sw zero, 0(t2)
+  fence w, w
+  addi t1, t1, 1
+  sw t1, 0(t0)
+  ret
+1:
+  lw t5, 0(t0)
+  beq t5, t1, 1b
+  fence r, rw
+  ret
+
+# return the current time in milliseconds in a0
+now_ms:
+  li a0, TV
+  li a1, 0
+  li a7, SYS_gettimeofday
+  ecall
+  li t0, TV
+  lw t1, 0(t0)
+  lw t2, 8(t0)
+  li t3, 1000
+  mul t1, t1, t3
+  divu t2, t2, t3
+  add a0, t1, t2
+  ret
+
+# write the nul terminated string at a0 to stdout
+print_str:
+  mv a1, a0
+  mv a2, a0
+1:
+  lbu t0, 0(a2)
+  beqz t0, 2f
+  addi a2, a2, 1
+  j 1b
+2:
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout in decimal
+print_uint:
+  li a1, NUM_END
+  li t1, 10
+1:
+  remu t0, a0, t1
+  divu a0, a0, t1
+  addi t0, t0, '0'
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  bnez a0, 1b
+  li a2, NUM_END
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+msg_title: .asciz "AMO contention, 4 harts x 1000000 iterations\n"
+msg_amo:   .asciz "amoadd.w:    "
+msg_lrsc:  .asciz "lr.w/sc.w:   "
+msg_lock:  .asciz "spinlock:    "
+msg_ms:    .asciz " ms  "
+msg_ok:    .asciz "ok\n"
+msg_fail:  .asciz "FAIL\n"
+
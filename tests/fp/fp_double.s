@@ -0,0 +1,2915 @@
+# fp_double.s
+#
+#   Generated by fp_gen.py from the exact results of fpref.py, do not edit.
+#
+#   RV32D arithmetic, conversions, comparisons and classification, and the
+#   nan boxing of singles written over doubles.
+#
+#   Build:
+#     python3 fp_gen.py double > fp_double.s
+#     llvm-mc -triple=riscv32 -mattr=+m,+f,+d,-relax -filetype=obj \
+#       fp_double.s -o fp_double.o
+#     ld.lld -Ttext=0x10000 fp_double.o -o fp_double.elf
+
+  .equ CASE_SIZE,        48
+  .equ MAX_REPORT,       16
+  .equ NUM_END,          0x20200
+
+  .equ SYS_write,        64
+  .equ SYS_exit,         93
+
+  .text
+  .globl _start
+_start:
+  la s0, cases
+  la s1, cases_end
+  la s2, ops
+  li s3, 0                  # case number
+  li s4, 0                  # failures
+next:
+  bgeu s0, s1, done
+  # operands, the first also as an integer, and frm
+  fld fa0, 8(s0)
+  fld fa1, 16(s0)
+  fld fa2, 24(s0)
+  lw a0, 8(s0)
+  lw t0, 4(s0)
+  fsrm t0
+  # results which are not written show up as these
+  la t0, junk
+  fld fa3, 0(t0)
+  lw a2, 0(t0)
+  lw t0, 0(s0)
+  add t0, s2, t0
+  fsflags zero
+  jalr ra, t0
+  frflags a3
+  # the integer result, or all 64 bits of the float one
+  lw t0, 44(s0)
+  li a4, 0
+  bnez t0, 1f
+  la t0, result
+  fsd fa3, 0(t0)
+  lw a2, 0(t0)
+  lw a4, 4(t0)
+1:
+  lw t0, 32(s0)
+  bne a2, t0, 2f
+  lw t0, 36(s0)
+  bne a4, t0, 2f
+  lw t0, 40(s0)
+  beq a3, t0, 3f
+2:
+  jal ra, report
+3:
+  addi s0, s0, CASE_SIZE
+  addi s3, s3, 1
+  j next
+done:
+  bnez s4, fail
+  la a0, msg_ok
+  jal ra, print_str
+  li a0, 0
+  li a7, SYS_exit
+  ecall
+fail:
+  la a0, msg_fail
+  jal ra, print_str
+  mv a0, s4
+  jal ra, print_uint
+  la a0, msg_of
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_nl
+  jal ra, print_str
+  li a0, 1
+  li a7, SYS_exit
+  ecall
+
+# count a failure and write the first few as "case <n>: <result> <fflags>"
+report:
+  addi s4, s4, 1
+  li t0, MAX_REPORT
+  bgtu s4, t0, 1f
+  mv s5, ra
+  mv s6, a2
+  mv s7, a3
+  mv s8, a4
+  la a0, msg_case
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_colon
+  jal ra, print_str
+  mv a0, s8
+  jal ra, print_hex
+  mv a0, s6
+  jal ra, print_hex
+  la a0, msg_space
+  jal ra, print_str
+  mv a0, s7
+  jal ra, print_hex
+  la a0, msg_nl
+  jal ra, print_str
+  mv ra, s5
+1:
+  ret
+
+# write the string at a0 to stdout
+print_str:
+  mv a1, a0
+  mv a2, a0
+1:
+  lbu t0, 0(a2)
+  beqz t0, 2f
+  addi a2, a2, 1
+  j 1b
+2:
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout in decimal
+print_uint:
+  li a1, NUM_END
+  li t1, 10
+1:
+  remu t0, a0, t1
+  divu a0, a0, t1
+  addi t0, t0, '0'
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  bnez a0, 1b
+  li a2, NUM_END
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout as eight hex digits
+print_hex:
+  li a1, NUM_END
+  li t1, 8
+1:
+  andi t0, a0, 15
+  srli a0, a0, 4
+  addi t0, t0, '0'
+  li t2, '9'
+  bleu t0, t2, 2f
+  addi t0, t0, 'a' - '9' - 1
+2:
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  addi t1, t1, -1
+  bnez t1, 1b
+  li a2, 8
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+  .option push
+  .option norvc
+ops:
+  fadd.d fa3, fa0, fa1, rdn
+  ret
+  fsub.d fa3, fa0, fa1, rdn
+  ret
+  fmul.d fa3, fa0, fa1, rne
+  ret
+  fdiv.d fa3, fa0, fa1, rtz
+  ret
+  fmin.d fa3, fa0, fa1
+  ret
+  fmax.d fa3, fa0, fa1
+  ret
+  feq.d a2, fa0, fa1
+  ret
+  flt.d a2, fa0, fa1
+  ret
+  fle.d a2, fa0, fa1
+  ret
+  fadd.d fa3, fa0, fa1, rup
+  ret
+  fsub.d fa3, fa0, fa1, rne
+  ret
+  fmul.d fa3, fa0, fa1
+  ret
+  fdiv.d fa3, fa0, fa1, rdn
+  ret
+  fadd.d fa3, fa0, fa1, rtz
+  ret
+  fmul.d fa3, fa0, fa1, rup
+  ret
+  fdiv.d fa3, fa0, fa1, rne
+  ret
+  fsub.d fa3, fa0, fa1
+  ret
+  fmul.d fa3, fa0, fa1, rtz
+  ret
+  fdiv.d fa3, fa0, fa1
+  ret
+  fadd.d fa3, fa0, fa1
+  ret
+  fadd.d fa3, fa0, fa1, rne
+  ret
+  fsub.d fa3, fa0, fa1, rtz
+  ret
+  fdiv.d fa3, fa0, fa1, rup
+  ret
+  fsub.d fa3, fa0, fa1, rup
+  ret
+  fmul.d fa3, fa0, fa1, rdn
+  ret
+  fsgnj.d fa3, fa0, fa1
+  ret
+  fsgnjn.d fa3, fa0, fa1
+  ret
+  fsgnjx.d fa3, fa0, fa1
+  ret
+  fsqrt.d fa3, fa0, rne
+  ret
+  fcvt.w.d a2, fa0
+  ret
+  fcvt.wu.d a2, fa0, rne
+  ret
+  fcvt.s.d fa3, fa0, rne
+  ret
+  fcvt.s.d fa3, fa0, rtz
+  ret
+  fcvt.s.d fa3, fa0, rdn
+  ret
+  fcvt.s.d fa3, fa0, rup
+  ret
+  fcvt.s.d fa3, fa0
+  ret
+  fclass.d a2, fa0
+  ret
+  fsqrt.d fa3, fa0, rtz
+  ret
+  fcvt.wu.d a2, fa0, rdn
+  ret
+  fcvt.wu.d a2, fa0, rtz
+  ret
+  fsqrt.d fa3, fa0, rdn
+  ret
+  fcvt.w.d a2, fa0, rup
+  ret
+  fcvt.wu.d a2, fa0, rup
+  ret
+  fsqrt.d fa3, fa0, rup
+  ret
+  fsqrt.d fa3, fa0
+  ret
+  fcvt.w.d a2, fa0, rtz
+  ret
+  fcvt.w.d a2, fa0, rne
+  ret
+  fcvt.wu.d a2, fa0
+  ret
+  fcvt.w.d a2, fa0, rdn
+  ret
+  fcvt.d.s fa3, fa0
+  ret
+  fcvt.d.w fa3, a0
+  ret
+  fcvt.d.wu fa3, a0
+  ret
+  fmadd.d fa3, fa0, fa1, fa2, rup
+  ret
+  fmsub.d fa3, fa0, fa1, fa2, rup
+  ret
+  fnmsub.d fa3, fa0, fa1, fa2, rup
+  ret
+  fnmadd.d fa3, fa0, fa1, fa2, rup
+  ret
+  fmadd.d fa3, fa0, fa1, fa2, rtz
+  ret
+  fmsub.d fa3, fa0, fa1, fa2, rtz
+  ret
+  fnmsub.d fa3, fa0, fa1, fa2, rtz
+  ret
+  fnmadd.d fa3, fa0, fa1, fa2, rtz
+  ret
+  fmadd.d fa3, fa0, fa1, fa2, rne
+  ret
+  fmsub.d fa3, fa0, fa1, fa2, rne
+  ret
+  fnmsub.d fa3, fa0, fa1, fa2, rne
+  ret
+  fnmadd.d fa3, fa0, fa1, fa2, rne
+  ret
+  fmadd.d fa3, fa0, fa1, fa2
+  ret
+  fmsub.d fa3, fa0, fa1, fa2
+  ret
+  fnmsub.d fa3, fa0, fa1, fa2
+  ret
+  fnmadd.d fa3, fa0, fa1, fa2
+  ret
+  fmadd.d fa3, fa0, fa1, fa2, rdn
+  ret
+  fmsub.d fa3, fa0, fa1, fa2, rdn
+  ret
+  fnmsub.d fa3, fa0, fa1, fa2, rdn
+  ret
+  fnmadd.d fa3, fa0, fa1, fa2, rdn
+  ret
+  fmv.x.w a2, fa0
+  ret
+  fmv.w.x fa3, a0
+  ret
+  .option pop
+
+  .data
+  .p2align 3
+junk:      .word 0x89abcdef, 0x01234567
+result:    .word 0, 0
+# stub offset, frm, three operands, expected result, fflags, integer result
+cases:
+  .word 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x8, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x10, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x18, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x50, 0x2, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x58, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x60, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x1, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x50, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x70, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x78, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x80, 0x3, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x88, 0x2, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x90, 0x1, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x98, 0x3, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x8, 0x3, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x70, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x18, 0x2, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x3, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xa8, 0x2, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x70, 0x2, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x78, 0x3, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x50, 0x1, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x58, 0x3, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xb0, 0x1, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xa0, 0x2, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb8, 0x0, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x10, 0x1, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x60, 0x3, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0
+  .word 0x28, 0x2, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0
+  .word 0x30, 0x1, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x1, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x1, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x48, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x50, 0x3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x80000000, 0x0, 0x0
+  .word 0xc0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x18, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x0, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0xa8, 0x3, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x60, 0x1, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x50, 0x2, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x80100000, 0x0, 0x0
+  .word 0xc0, 0x3, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xb0, 0x1, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0xa8, 0x0, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xbff80000, 0x0, 0x0
+  .word 0x58, 0x3, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x18, 0x3, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x50, 0x1, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xc0, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xb0, 0x2, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x50, 0x3, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x58, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x18, 0x3, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x1, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0xb8, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x58, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x18, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x0, 0x0, 0x80000000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0xb8, 0x2, 0x0, 0x80000000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0xc0, 0x1, 0x0, 0x80000000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x90, 0x0, 0x0, 0x80000000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0x80000000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x80000000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x80000000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x80000000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0x80000000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x3, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xb8, 0x1, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x58, 0x2, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x78, 0x2, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x2, 0x0, 0x80000000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x80, 0x2, 0x0, 0x80000000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x10, 0x2, 0x0, 0x80000000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x1, 0x0, 0x80000000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0x80000000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x80000000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x80000000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x80000000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x80000000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x80, 0x2, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x70, 0x2, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xb0, 0x0, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xa0, 0x3, 0x0, 0x80000000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x50, 0x1, 0x0, 0x80000000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xc0, 0x3, 0x0, 0x80000000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x78, 0x1, 0x0, 0x80000000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x0, 0x80000000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x10, 0x0
+  .word 0x28, 0x1, 0x0, 0x80000000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x10, 0x0
+  .word 0x30, 0x2, 0x0, 0x80000000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x3, 0x0, 0x80000000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x0, 0x80000000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x98, 0x2, 0x0, 0x80000000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x8, 0x1, 0x0, 0x80000000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x80000000, 0x0, 0x0
+  .word 0x88, 0x2, 0x0, 0x80000000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x90, 0x3, 0x0, 0x80000000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x80000000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x80000000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x80000000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x80000000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x80000000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x0, 0x0
+  .word 0x10, 0x2, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x60, 0x3, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x2, 0x0, 0x80000000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x8, 0x1, 0x0, 0x80000000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x80100000, 0x0, 0x0
+  .word 0x58, 0x2, 0x0, 0x80000000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x90, 0x2, 0x0, 0x80000000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x80000000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x80000000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x80000000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x80000000, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0x80000000, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0x0, 0x80000000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x8, 0x3, 0x0, 0x80000000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xbff80000, 0x0, 0x0
+  .word 0x70, 0x2, 0x0, 0x80000000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xb0, 0x2, 0x0, 0x80000000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0x80000000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x80000000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x80000000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x80000000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x80000000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x50, 0x1, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0xc0, 0x1, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x90, 0x2, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x8, 0x0
+  .word 0x20, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x98, 0x2, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x8, 0x0, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x70, 0x2, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x78, 0x1, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xfff00000, 0x8, 0x0
+  .word 0x20, 0x3, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x0, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x40000000, 0x0, 0x0
+  .word 0xa8, 0x2, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x88, 0x0, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x78, 0x1, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x2, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x8, 0x1, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x40000000, 0x0, 0x0
+  .word 0x58, 0x2, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x78, 0x2, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xa8, 0x3, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x70, 0x2, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x18, 0x2, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x1, 0x0, 0x3ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x80, 0x0, 0x0, 0x3ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xc0, 0x1, 0x0, 0x3ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x60, 0x1, 0x0, 0x3ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x3ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x3ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x3ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x3ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x3ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0x0, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x8, 0x1, 0x0, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x10, 0x2, 0x0, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x60, 0x0, 0x0, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0x0, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xa0, 0x3, 0x0, 0x3ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb8, 0x0, 0x0, 0x3ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xc0, 0x0, 0x0, 0x3ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb0, 0x1, 0x0, 0x3ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x0, 0x3ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x10, 0x0
+  .word 0x28, 0x2, 0x0, 0x3ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x10, 0x0
+  .word 0x30, 0x2, 0x0, 0x3ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x0, 0x0, 0x3ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x0, 0x3ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x2, 0x0, 0x3ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x1, 0x0
+  .word 0x80, 0x3, 0x0, 0x3ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x1, 0x0
+  .word 0x10, 0x1, 0x0, 0x3ff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x90, 0x2, 0x0, 0x3ff00000, 0x1, 0x0, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x20, 0x3, 0x0, 0x3ff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x3ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x3ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x3ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x3ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0x0, 0x3ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x0, 0x3ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x0, 0x3ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x0, 0x3ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x40000, 0x3, 0x0
+  .word 0x20, 0x1, 0x0, 0x3ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x3ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x3ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x3ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x3ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0x0, 0x3ff00000, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x3ff00000, 0x1, 0x0
+  .word 0x50, 0x1, 0x0, 0x3ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x3ff00000, 0x1, 0x0
+  .word 0x10, 0x1, 0x0, 0x3ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x60, 0x3, 0x0, 0x3ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7fd00000, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0x3ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x3ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x3ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x3ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x3ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x40040000, 0x0, 0x0
+  .word 0xb8, 0x1, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xbfe00000, 0x0, 0x0
+  .word 0xc0, 0x0, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x90, 0x2, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x55555555, 0x3fe55555, 0x1, 0x0
+  .word 0x20, 0x3, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0xb8, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0xc0, 0x3, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x60, 0x3, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x8, 0x0
+  .word 0x20, 0x2, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x3, 0x0, 0xbff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x80, 0x1, 0x0, 0xbff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x70, 0x0, 0x0, 0xbff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xb0, 0x0, 0x0, 0xbff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff00000, 0x8, 0x0
+  .word 0x20, 0x0, 0x0, 0xbff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0xbff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0xbff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0xbff00000, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0xbff00000, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x1, 0x0, 0xbff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xa8, 0x2, 0x0, 0xbff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xc0000000, 0x0, 0x0
+  .word 0x10, 0x3, 0x0, 0xbff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x18, 0x0, 0x0, 0xbff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0xbff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xbff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0xbff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0xbff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0xbff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0x0, 0xbff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xc0000000, 0x0, 0x0
+  .word 0xa8, 0x0, 0x0, 0xbff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x70, 0x1, 0x0, 0xbff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x60, 0x1, 0x0, 0xbff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0xbff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0xbff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0xbff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0xbff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0xbff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0x0, 0xbff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xb8, 0x0, 0x0, 0xbff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x10, 0x3, 0x0, 0xbff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x78, 0x1, 0x0, 0xbff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0xbff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0xbff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0xbff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0xbff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0xbff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0x0, 0xbff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xa8, 0x2, 0x0, 0xbff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x70, 0x0, 0x0, 0xbff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x78, 0x1, 0x0, 0xbff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0xbff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xbff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0xbff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0xbff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0xbff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x1, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xa8, 0x3, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xc0, 0x1, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x78, 0x2, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x98, 0x1, 0x0, 0xbff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x8, 0x3, 0x0, 0xbff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x88, 0x2, 0x0, 0xbff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x3, 0x0, 0xbff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x0, 0x0, 0xbff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x10, 0x0
+  .word 0x28, 0x1, 0x0, 0xbff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x10, 0x0
+  .word 0x30, 0x1, 0x0, 0xbff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x3, 0x0, 0xbff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x0, 0xbff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x48, 0x1, 0x0, 0xbff00000, 0x1, 0x0, 0x0, 0x0, 0xffffffff, 0xbfefffff, 0x1, 0x0
+  .word 0x80, 0x3, 0x0, 0xbff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0xbff00000, 0x1, 0x0
+  .word 0x70, 0x2, 0x0, 0xbff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x80000000, 0x0, 0x0
+  .word 0x60, 0x3, 0x0, 0xbff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x20, 0x1, 0x0, 0xbff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0xbff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0xbff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0xbff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0xbff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x2, 0x0, 0xbff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xfffffffe, 0x7fefffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x0, 0xbff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0x0, 0xbff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x0, 0xbff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x80040000, 0x3, 0x0
+  .word 0x20, 0x0, 0x0, 0xbff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0xbff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0xbff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0xbff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0xbff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0x0, 0xbff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0xbff00000, 0x1, 0x0
+  .word 0x8, 0x1, 0x0, 0xbff00000, 0x0, 0x100000, 0x0, 0x0, 0x1, 0xbff00000, 0x1, 0x0
+  .word 0x88, 0x3, 0x0, 0xbff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x80100000, 0x0, 0x0
+  .word 0xb0, 0x0, 0x0, 0xbff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0xffd00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0xbff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0xbff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0xbff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0xbff00000, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0xbff00000, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x3, 0x0, 0xbff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3fe00000, 0x0, 0x0
+  .word 0xb8, 0x0, 0x0, 0xbff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xc0040000, 0x0, 0x0
+  .word 0x88, 0x2, 0x0, 0xbff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xbff80000, 0x0, 0x0
+  .word 0xb0, 0x1, 0x0, 0xbff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x55555555, 0xbfe55555, 0x1, 0x0
+  .word 0x20, 0x0, 0x0, 0xbff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0xbff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0xbff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0xbff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0xbff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xa8, 0x2, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x58, 0x3, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x1, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x80, 0x3, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x10, 0x1, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x78, 0x2, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0x0, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x8, 0x0, 0x0, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x10, 0x1, 0x0, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x90, 0x0, 0x0, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x2, 0x0, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x8, 0x0, 0x0, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x70, 0x0, 0x0, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x90, 0x2, 0x0, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x50, 0x2, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x10, 0x1, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x60, 0x1, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x1, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x2, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x8, 0x1, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x88, 0x2, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x90, 0x3, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0x0, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x80, 0x1, 0x0, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x88, 0x2, 0x0, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x60, 0x3, 0x0, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0x0, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x48, 0x0, 0x0, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xa8, 0x2, 0x0, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x58, 0x3, 0x0, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x2, 0x0, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x1, 0x0, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x10, 0x0
+  .word 0x28, 0x2, 0x0, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x10, 0x0
+  .word 0x30, 0x1, 0x0, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x0, 0x0, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x0, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x3, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x50, 0x1, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x58, 0x0, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x90, 0x3, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x1, 0x0, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x80, 0x3, 0x0, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x10, 0x2, 0x0, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x78, 0x2, 0x0, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xb8, 0x1, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x70, 0x2, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x78, 0x1, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0x0, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xa8, 0x0, 0x0, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x10, 0x3, 0x0, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x78, 0x1, 0x0, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x98, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xa8, 0x2, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x88, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0x0, 0xfff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xb8, 0x0, 0x0, 0xfff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x58, 0x1, 0x0, 0xfff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x1, 0x0, 0xfff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0xfff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xfff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0xfff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0xfff00000, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0xfff00000, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0x0, 0xfff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xb8, 0x1, 0x0, 0xfff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x70, 0x0, 0x0, 0xfff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x90, 0x0, 0x0, 0xfff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0xfff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xfff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0xfff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0xfff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0xfff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x80, 0x2, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xc0, 0x1, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x78, 0x2, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0x0, 0xfff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb8, 0x1, 0x0, 0xfff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x58, 0x2, 0x0, 0xfff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x78, 0x2, 0x0, 0xfff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x0, 0xfff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xfff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0xfff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0xfff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0xfff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x0, 0x0, 0xfff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x80, 0x1, 0x0, 0xfff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x70, 0x1, 0x0, 0xfff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x60, 0x0, 0x0, 0xfff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x1, 0x0, 0xfff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0xfff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0xfff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0xfff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0xfff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x1, 0x0, 0xfff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x80, 0x0, 0x0, 0xfff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x70, 0x1, 0x0, 0xfff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x60, 0x1, 0x0, 0xfff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0xfff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xfff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0xfff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0xfff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x0, 0xfff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x0, 0x1, 0x0, 0xfff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x50, 0x3, 0x0, 0xfff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x88, 0x0, 0x0, 0xfff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x18, 0x0, 0x0, 0xfff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x0, 0x0, 0xfff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x10, 0x0
+  .word 0x28, 0x1, 0x0, 0xfff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x10, 0x0
+  .word 0x30, 0x1, 0x0, 0xfff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x3, 0x0, 0xfff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x0, 0xfff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x0, 0x0, 0xfff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x8, 0x3, 0x0, 0xfff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x88, 0x2, 0x0, 0xfff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x60, 0x0, 0x0, 0xfff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0xfff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0xfff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0xfff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0xfff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0xfff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x0, 0x0, 0xfff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x8, 0x1, 0x0, 0xfff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x88, 0x3, 0x0, 0xfff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x90, 0x3, 0x0, 0xfff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0xfff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xfff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0xfff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0xfff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0xfff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xb8, 0x1, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x70, 0x0, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xb0, 0x0, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0x0, 0xfff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x80, 0x2, 0x0, 0xfff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x88, 0x3, 0x0, 0xfff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x18, 0x0, 0x0, 0xfff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0xfff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0xfff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0xfff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0xfff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0xfff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x80, 0x1, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x88, 0x2, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xb0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x1, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x0, 0x1, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x80, 0x0, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x10, 0x1, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x78, 0x1, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xa0, 0x1, 0x0, 0x7ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xa8, 0x2, 0x0, 0x7ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x70, 0x1, 0x0, 0x7ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x78, 0x2, 0x0, 0x7ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x7ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x7ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x7ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x7ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x0, 0x7ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xa0, 0x3, 0x0, 0x7ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x8, 0x0, 0x0, 0x7ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x88, 0x3, 0x0, 0x7ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xb0, 0x2, 0x0, 0x7ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x7ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x7ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x7ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x7ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x0, 0x7ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x3, 0x0, 0x7ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x50, 0x3, 0x0, 0x7ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x58, 0x2, 0x0, 0x7ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x78, 0x1, 0x0, 0x7ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0x7ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x7ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x7ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x7ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x0, 0x7ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x98, 0x0, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xb8, 0x2, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x70, 0x2, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x60, 0x3, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x0, 0x1, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x80, 0x0, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x58, 0x0, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x18, 0x3, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x2, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xa8, 0x2, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x10, 0x2, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x2, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x0, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x28, 0x1, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x30, 0x3, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x0, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x48, 0x2, 0x0, 0x7ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x50, 0x3, 0x0, 0x7ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x70, 0x2, 0x0, 0x7ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x18, 0x2, 0x0, 0x7ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x7ff80000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x7ff80000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x7ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x7ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0x0, 0x7ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x98, 0x3, 0x0, 0x7ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xb8, 0x2, 0x0, 0x7ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x10, 0x2, 0x0, 0x7ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x90, 0x3, 0x0, 0x7ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x7ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x7ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x7ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x7ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x1, 0x0, 0x7ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xb8, 0x0, 0x0, 0x7ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x88, 0x2, 0x0, 0x7ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x90, 0x3, 0x0, 0x7ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x7ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x7ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x7ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x7ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0x0, 0x7ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x2, 0x0, 0x7ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x80, 0x2, 0x0, 0x7ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x10, 0x3, 0x0, 0x7ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x60, 0x1, 0x0, 0x7ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x7ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x7ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x7ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x7ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x1, 0x0, 0x7ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x48, 0x2, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x8, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x10, 0x1, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x2, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0
+  .word 0x28, 0x2, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0
+  .word 0x30, 0x3, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x3, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb8, 0x0, 0x1, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x70, 0x2, 0x1, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x18, 0x0, 0x1, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x1, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x10, 0x0
+  .word 0x28, 0x1, 0x1, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x10, 0x0
+  .word 0x30, 0x1, 0x1, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x3, 0x1, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x1, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x98, 0x3, 0x1, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x8, 0x1, 0x1, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x10, 0x3, 0x1, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x60, 0x1, 0x1, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x1, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x10, 0x0
+  .word 0x28, 0x0, 0x1, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x10, 0x0
+  .word 0x30, 0x1, 0x1, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x1, 0x1, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x1, 0x1, 0x7ff00000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x48, 0x0, 0x1, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xa8, 0x3, 0x1, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x10, 0x3, 0x1, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x18, 0x2, 0x1, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x3, 0x1, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x10, 0x0
+  .word 0x28, 0x3, 0x1, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x10, 0x0
+  .word 0x30, 0x2, 0x1, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x3, 0x1, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x1, 0x7ff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x98, 0x2, 0x1, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb8, 0x1, 0x1, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x10, 0x1, 0x1, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x18, 0x0, 0x1, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x0, 0x1, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x10, 0x0
+  .word 0x28, 0x2, 0x1, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x10, 0x0
+  .word 0x30, 0x1, 0x1, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x0, 0x1, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x1, 0x1, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x3, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x8, 0x1, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x58, 0x1, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x1, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x10, 0x0
+  .word 0x28, 0x2, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x10, 0x0
+  .word 0x30, 0x2, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x1, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x98, 0x2, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x8, 0x1, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xc0, 0x0, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb0, 0x2, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x1, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x28, 0x0, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x30, 0x2, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x2, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x98, 0x1, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x80, 0x3, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x10, 0x1, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb0, 0x2, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x1, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x28, 0x3, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x30, 0x2, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x2, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xa0, 0x2, 0x1, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xa8, 0x3, 0x1, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xc0, 0x3, 0x1, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb0, 0x2, 0x1, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x3, 0x1, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10, 0x0
+  .word 0x28, 0x0, 0x1, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10, 0x0
+  .word 0x30, 0x2, 0x1, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x0, 0x1, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x1, 0x1, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xa0, 0x1, 0x1, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xa8, 0x0, 0x1, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x58, 0x0, 0x1, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb0, 0x1, 0x1, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x1, 0x1, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x10, 0x0
+  .word 0x28, 0x2, 0x1, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x10, 0x0
+  .word 0x30, 0x1, 0x1, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x3, 0x1, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0x1, 0x7ff00000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x3, 0x1, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x50, 0x2, 0x1, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xc0, 0x1, 0x1, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x3, 0x1, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x1, 0x1, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x10, 0x0
+  .word 0x28, 0x3, 0x1, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x10, 0x0
+  .word 0x30, 0x3, 0x1, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x2, 0x1, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0x1, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x48, 0x2, 0x1, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xa8, 0x0, 0x1, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x10, 0x1, 0x1, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x0, 0x1, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x1, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x10, 0x0
+  .word 0x28, 0x1, 0x1, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x10, 0x0
+  .word 0x30, 0x2, 0x1, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x3, 0x1, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x1, 0x7ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x48, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0xb8, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x70, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x78, 0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x8, 0x0
+  .word 0x20, 0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x0, 0x1, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0xb8, 0x1, 0x1, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x70, 0x1, 0x1, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xb0, 0x2, 0x1, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xfff00000, 0x8, 0x0
+  .word 0x20, 0x1, 0x1, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x3, 0x1, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x1, 0x1, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x1, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x1, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x1, 0x0
+  .word 0x50, 0x3, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x1, 0x0
+  .word 0x58, 0x0, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x78, 0x3, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x20, 0x1, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x2, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x1, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0x1, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x1, 0x0
+  .word 0x8, 0x0, 0x1, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x1, 0x0
+  .word 0xc0, 0x0, 0x1, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x1, 0x80000000, 0x0, 0x0
+  .word 0x18, 0x2, 0x1, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x1, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x0, 0x1, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x1, 0x1, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x0, 0x1, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x1, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x1, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0x1, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x50, 0x3, 0x1, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x10, 0x3, 0x1, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x18, 0x0, 0x1, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x2, 0x1, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x2, 0x1, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x1, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x1, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x1, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x1, 0x1, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xa8, 0x2, 0x1, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x70, 0x1, 0x1, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x78, 0x1, 0x1, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x2, 0x1, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x1, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x2, 0x1, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x1, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x1, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0x1, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x8, 0x3, 0x1, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x70, 0x2, 0x1, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x90, 0x1, 0x1, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x2, 0x1, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x2, 0x1, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x1, 0x1, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x1, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x1, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x48, 0x1, 0x1, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x80, 0x3, 0x1, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x70, 0x1, 0x1, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x18, 0x3, 0x1, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x1, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x10, 0x0
+  .word 0x28, 0x3, 0x1, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x10, 0x0
+  .word 0x30, 0x1, 0x1, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x1, 0x1, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x1, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x48, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+  .word 0xa8, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x10, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0xb0, 0x2, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x20, 0x2, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x3, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x0, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xfffffffe, 0xffefffff, 0x1, 0x0
+  .word 0x10, 0x2, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x3ccfffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x20, 0x0, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x3, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x3, 0x1, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x100000, 0x0, 0x0
+  .word 0x50, 0x2, 0x1, 0x0, 0x0, 0x100000, 0x0, 0x0, 0xffffffff, 0x800fffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0x1, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0xb0, 0x0, 0x1, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x3cb00000, 0x0, 0x0
+  .word 0x20, 0x0, 0x1, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x0, 0x1, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x3, 0x1, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x1, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x1, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0x1, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x3ff80000, 0x1, 0x0
+  .word 0xa8, 0x3, 0x1, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0xffffffff, 0xbff7ffff, 0x1, 0x0
+  .word 0xc0, 0x1, 0x1, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x78, 0x1, 0x1, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x20, 0x3, 0x1, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0x1, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x2, 0x1, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x1, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x1, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x8, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x60, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x8, 0x0
+  .word 0x20, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x98, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x80000000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x80000000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x70, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x78, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xfff00000, 0x8, 0x0
+  .word 0x20, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x80000000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x80, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x3ff00000, 0x0, 0x0, 0xfffffffe, 0x7fefffff, 0x1, 0x0
+  .word 0xc0, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x3ff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x18, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x3ff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x20, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x3ff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0xbff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0x8, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0xbff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0xbff00000, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x0, 0x0
+  .word 0x78, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0xbff00000, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x0, 0x0
+  .word 0x20, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0xbff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xb8, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x88, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x90, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x28, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xb8, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x70, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xb0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0xfff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x50, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x10, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xb0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x7ff80000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x28, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x7ff80000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x2, 0xffffffff, 0x7fefffff, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x80, 0x1, 0xffffffff, 0x7fefffff, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x58, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x90, 0x3, 0xffffffff, 0x7fefffff, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x7ff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x10, 0x0
+  .word 0x28, 0x1, 0xffffffff, 0x7fefffff, 0x1, 0x7ff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x10, 0x0
+  .word 0x30, 0x1, 0xffffffff, 0x7fefffff, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0xffffffff, 0x7fefffff, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xa0, 0x3, 0xffffffff, 0x7fefffff, 0x1, 0x0, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0x8, 0x1, 0xffffffff, 0x7fefffff, 0x1, 0x0, 0x0, 0x0, 0xfffffffe, 0x7fefffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0, 0x0, 0x0, 0xffffffff, 0x3ccfffff, 0x0, 0x0
+  .word 0x60, 0x1, 0xffffffff, 0x7fefffff, 0x1, 0x0, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x20, 0x2, 0xffffffff, 0x7fefffff, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0xffffffff, 0x7fefffff, 0x1, 0x0, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0xffffffff, 0x7fefffff, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0xffffffff, 0x7fefffff, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x1, 0xffffffff, 0x7fefffff, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x8, 0x3, 0xffffffff, 0x7fefffff, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x58, 0x1, 0xffffffff, 0x7fefffff, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x90, 0x1, 0xffffffff, 0x7fefffff, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x20, 0x0, 0xffffffff, 0x7fefffff, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x28, 0x2, 0xffffffff, 0x7fefffff, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x1, 0xffffffff, 0x7fefffff, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0xffffffff, 0x7fefffff, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0xffffffff, 0x7fefffff, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x80, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x100000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0x10, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x100000, 0x0, 0x0, 0xffffffff, 0x400fffff, 0x0, 0x0
+  .word 0x18, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x100000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x20, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x100000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x80, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0xfffffffe, 0x7fefffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x60, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x55555554, 0x7fe55555, 0x1, 0x0
+  .word 0x20, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x28, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0xa8, 0x3, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x58, 0x2, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xb0, 0x2, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x8, 0x0
+  .word 0x20, 0x2, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x2, 0x0, 0x100000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0xb8, 0x2, 0x0, 0x100000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x58, 0x1, 0x0, 0x100000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x90, 0x1, 0x0, 0x100000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xfff00000, 0x8, 0x0
+  .word 0x20, 0x3, 0x0, 0x100000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x100000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x100000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x100000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x100000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0x0, 0x100000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x1, 0x0
+  .word 0x50, 0x3, 0x0, 0x100000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x1, 0x0
+  .word 0x10, 0x2, 0x0, 0x100000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x90, 0x1, 0x0, 0x100000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x100000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x100000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x100000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x100000, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x100000, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0x0, 0x100000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x1, 0x0
+  .word 0xa8, 0x2, 0x0, 0x100000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x1, 0x0
+  .word 0x58, 0x3, 0x0, 0x100000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x80100000, 0x0, 0x0
+  .word 0x90, 0x0, 0x0, 0x100000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x80100000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x100000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x100000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x100000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x100000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0x100000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xa8, 0x0, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xc0, 0x0, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x18, 0x3, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0x0, 0x100000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xb8, 0x1, 0x0, 0x100000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x58, 0x0, 0x0, 0x100000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x60, 0x0, 0x0, 0x100000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x100000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x100000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x100000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x100000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x100000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xa8, 0x3, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x10, 0x3, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x90, 0x0, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x2, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x2, 0x0, 0x100000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb8, 0x0, 0x0, 0x100000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x88, 0x3, 0x0, 0x100000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb0, 0x2, 0x0, 0x100000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x3, 0x0, 0x100000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x100000, 0x10, 0x0
+  .word 0x28, 0x0, 0x0, 0x100000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x100000, 0x10, 0x0
+  .word 0x30, 0x3, 0x0, 0x100000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x2, 0x0, 0x100000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0x0, 0x100000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xa0, 0x1, 0x0, 0x100000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x100000, 0x0, 0x0
+  .word 0xb8, 0x2, 0x0, 0x100000, 0x1, 0x0, 0x0, 0x0, 0xffffffff, 0xfffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x0, 0x100000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x90, 0x0, 0x0, 0x100000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x43300000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x100000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x100000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x100000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x100000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0x100000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x1, 0x0
+  .word 0x10, 0x2, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x400fffff, 0x0, 0x0
+  .word 0x78, 0x1, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x20, 0x0, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0x0, 0x100000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x200000, 0x0, 0x0
+  .word 0x8, 0x3, 0x0, 0x100000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x10, 0x3, 0x0, 0x100000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x18, 0x0, 0x0, 0x100000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0x100000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x100000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x100000, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x100000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x100000, 0x0, 0x100000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0x0, 0x100000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x1, 0x0
+  .word 0xa8, 0x0, 0x0, 0x100000, 0x0, 0x3ff80000, 0x0, 0x0, 0xffffffff, 0xbff7ffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0x0, 0x100000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x180000, 0x0, 0x0
+  .word 0xb0, 0x1, 0x0, 0x100000, 0x0, 0x3ff80000, 0x0, 0x0, 0xaaaaaaab, 0xaaaaa, 0x3, 0x0
+  .word 0x20, 0x1, 0x0, 0x100000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x100000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x100000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x100000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x100000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x50, 0x3, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x70, 0x1, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x78, 0x2, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x8, 0x0
+  .word 0x20, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x0, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0xa8, 0x2, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0xc0, 0x1, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x78, 0x3, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xfff00000, 0x8, 0x0
+  .word 0x20, 0x0, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0x0, 0x3ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x40040000, 0x0, 0x0
+  .word 0x80, 0x2, 0x0, 0x3ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3fe00000, 0x0, 0x0
+  .word 0x70, 0x0, 0x0, 0x3ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x90, 0x0, 0x0, 0x3ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0x3ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x3ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x3ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x3ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x3ff80000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x3fe00000, 0x0, 0x0
+  .word 0xb8, 0x2, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x40040000, 0x0, 0x0
+  .word 0x58, 0x0, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff80000, 0x0, 0x0
+  .word 0x90, 0x0, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff80000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x98, 0x2, 0x0, 0x3ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xa8, 0x0, 0x0, 0x3ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xc0, 0x3, 0x0, 0x3ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x60, 0x1, 0x0, 0x3ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x3ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x3ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x3ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x3ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0x3ff80000, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x2, 0x0, 0x3ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xa8, 0x2, 0x0, 0x3ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x88, 0x2, 0x0, 0x3ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x60, 0x3, 0x0, 0x3ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0x3ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x3ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x3ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x3ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x3ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x1, 0x0, 0x3ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xa8, 0x2, 0x0, 0x3ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x10, 0x2, 0x0, 0x3ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xb0, 0x1, 0x0, 0x3ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x3ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x3ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x3ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x3ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0x0, 0x3ff80000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x98, 0x1, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x50, 0x3, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x10, 0x2, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xb0, 0x2, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x3, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x3ff80000, 0x10, 0x0
+  .word 0x28, 0x2, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x3ff80000, 0x10, 0x0
+  .word 0x30, 0x2, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x1, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x1, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x98, 0x1, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3ff80000, 0x1, 0x0
+  .word 0x8, 0x1, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0xffffffff, 0x3ff7ffff, 0x1, 0x0
+  .word 0x10, 0x3, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x78, 0x2, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x20, 0x3, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0x0, 0x3ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x0, 0x3ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xfffffffe, 0xffefffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x0, 0x3ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x18, 0x2, 0x0, 0x3ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x60000, 0x3, 0x0
+  .word 0x20, 0x1, 0x0, 0x3ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x3ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x3ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x3ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x3ff80000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x1, 0x0, 0x3ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x3ff80000, 0x1, 0x0
+  .word 0x50, 0x2, 0x0, 0x3ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x3ff80000, 0x1, 0x0
+  .word 0xc0, 0x0, 0x0, 0x3ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x180000, 0x0, 0x0
+  .word 0xb0, 0x2, 0x0, 0x3ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7fd80000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x3ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x3ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x3ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0x3ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x3ff80000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x1, 0x0, 0x3ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x40080000, 0x0, 0x0
+  .word 0xb8, 0x2, 0x0, 0x3ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xc0, 0x1, 0x0, 0x3ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x40020000, 0x0, 0x0
+  .word 0x60, 0x1, 0x0, 0x3ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0x3ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x3ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x3ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x3ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x3ff80000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x3, 0x0, 0xfff00000, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x80, 0x0, 0x0, 0xfff00000, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xc0, 0x0, 0x0, 0xfff00000, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x90, 0x2, 0x0, 0xfff00000, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0xfff00000, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xfff00000, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0xc2b3cb62, 0xbe641002, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0xfff00000, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0xfff00000, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0xfff00000, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x2, 0xfdf24503, 0x7d52a9c1, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0xfdf24502, 0x7d52a9c1, 0x1, 0x0
+  .word 0x50, 0x1, 0xfdf24503, 0x7d52a9c1, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0xfdf24503, 0x7d52a9c1, 0x1, 0x0
+  .word 0x58, 0x2, 0xfdf24503, 0x7d52a9c1, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x18ae7151, 0xff087694, 0x1, 0x0
+  .word 0x90, 0x2, 0xfdf24503, 0x7d52a9c1, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x6f7152be, 0xfb9c79f5, 0x1, 0x0
+  .word 0x20, 0x3, 0xfdf24503, 0x7d52a9c1, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0
+  .word 0x28, 0x1, 0xfdf24503, 0x7d52a9c1, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0
+  .word 0x30, 0x3, 0xfdf24503, 0x7d52a9c1, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xfdf24503, 0x7d52a9c1, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0xfdf24503, 0x7d52a9c1, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x98, 0x0, 0x8ac89a22, 0xbf5a610b, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x21a015d3, 0x79d03241, 0x1, 0x0
+  .word 0xb8, 0x1, 0x8ac89a22, 0xbf5a610b, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x21a015d3, 0xf9d03241, 0x1, 0x0
+  .word 0x58, 0x3, 0x8ac89a22, 0xbf5a610b, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x3089470f, 0xf93ab3e6, 0x1, 0x0
+  .word 0x18, 0x0, 0x8ac89a22, 0xbf5a610b, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0xfa1be847, 0x857a0f31, 0x1, 0x0
+  .word 0x20, 0x3, 0x8ac89a22, 0xbf5a610b, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0
+  .word 0x28, 0x2, 0x8ac89a22, 0xbf5a610b, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x21a015d3, 0x79d03241, 0x0, 0x0
+  .word 0x30, 0x0, 0x8ac89a22, 0xbf5a610b, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x8ac89a22, 0xbf5a610b, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x8ac89a22, 0xbf5a610b, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x2, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x53645c31, 0xbf840227, 0x1, 0x0
+  .word 0xa8, 0x3, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x53645c30, 0xbf840227, 0x1, 0x0
+  .word 0x88, 0x3, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0xbcbced3b, 0x211cd8ef, 0x1, 0x0
+  .word 0x18, 0x0, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0xf963cbf6, 0x5debc165, 0x1, 0x0
+  .word 0x20, 0x0, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x53645c31, 0xbf840227, 0x0, 0x0
+  .word 0x28, 0x0, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x15a3b9c1, 0xa1871177, 0x0, 0x0
+  .word 0x30, 0x2, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0xfdf24503, 0x7d52a9c1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0xfdf24503, 0x7d52a9c1, 0x1, 0x0
+  .word 0xb8, 0x1, 0xfdf24503, 0x7d52a9c1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0xfdf24504, 0x7d52a9c1, 0x1, 0x0
+  .word 0x88, 0x0, 0xfdf24503, 0x7d52a9c1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x1eb28ff, 0xfe15846e, 0x1, 0x0
+  .word 0x78, 0x1, 0xfdf24503, 0x7d52a9c1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0xb4448627, 0xfc903001, 0x1, 0x0
+  .word 0x20, 0x3, 0xfdf24503, 0x7d52a9c1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0
+  .word 0x28, 0x2, 0xfdf24503, 0x7d52a9c1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0
+  .word 0x30, 0x1, 0xfdf24503, 0x7d52a9c1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0xfdf24503, 0x7d52a9c1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0xfdf24503, 0x7d52a9c1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0xb4b4e567, 0xc1fb0cf7, 0x1, 0x0
+  .word 0x50, 0x3, 0xb4b4e566, 0xc1fb0cf7, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0xb4b4e564, 0xc1fb0cf7, 0x1, 0x0
+  .word 0x88, 0x3, 0xb4b4e566, 0xc1fb0cf7, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0xf5a5cf18, 0x40c785c6, 0x1, 0x0
+  .word 0x18, 0x3, 0xb4b4e566, 0xc1fb0cf7, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0xa2de666, 0x432f1ba0, 0x1, 0x0
+  .word 0x20, 0x2, 0xb4b4e566, 0xc1fb0cf7, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0
+  .word 0x28, 0x2, 0xb4b4e566, 0xc1fb0cf7, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0
+  .word 0x30, 0x3, 0xb4b4e566, 0xc1fb0cf7, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0xb4b4e566, 0xc1fb0cf7, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0xb4b4e566, 0xc1fb0cf7, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x0, 0xae8de429, 0x4dfa5465, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0xae8de429, 0x4dfa5465, 0x1, 0x0
+  .word 0x80, 0x2, 0xae8de429, 0x4dfa5465, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0xae8de428, 0x4dfa5465, 0x1, 0x0
+  .word 0x10, 0x2, 0xae8de429, 0x4dfa5465, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0xb1091ad6, 0x4faff503, 0x1, 0x0
+  .word 0x90, 0x1, 0xae8de429, 0x4dfa5465, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x52c3ae35, 0x4c45b176, 0x1, 0x0
+  .word 0x20, 0x1, 0xae8de429, 0x4dfa5465, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0xecb4b274, 0x41a36b6e, 0x0, 0x0
+  .word 0x28, 0x1, 0xae8de429, 0x4dfa5465, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x0
+  .word 0x30, 0x3, 0xae8de429, 0x4dfa5465, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0xae8de429, 0x4dfa5465, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0xae8de429, 0x4dfa5465, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0x7dc67e9e, 0xbebbd38e, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x7dc67e9e, 0xbebbd38e, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x1, 0x0
+  .word 0x10, 0x2, 0x7dc67e9e, 0xbebbd38e, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x7dc67e9d, 0xfebbd38e, 0x1, 0x0
+  .word 0x60, 0x0, 0x7dc67e9e, 0xbebbd38e, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x6f4e39f8, 0x80000000, 0x3, 0x0
+  .word 0x20, 0x2, 0x7dc67e9e, 0xbebbd38e, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0
+  .word 0x28, 0x0, 0x7dc67e9e, 0xbebbd38e, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x0, 0x7dc67e9e, 0xbebbd38e, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x7dc67e9e, 0xbebbd38e, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x7dc67e9e, 0xbebbd38e, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x3, 0x285f0fca, 0xae635d5f, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x80, 0x0, 0x285f0fca, 0xae635d5f, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xc0, 0x3, 0x285f0fca, 0xae635d5f, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x90, 0x1, 0x285f0fca, 0xae635d5f, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x3, 0x285f0fca, 0xae635d5f, 0x0, 0x7ff00000, 0x0, 0x0, 0x285f0fca, 0xae635d5f, 0x0, 0x0
+  .word 0x28, 0x1, 0x285f0fca, 0xae635d5f, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x3, 0x285f0fca, 0xae635d5f, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x285f0fca, 0xae635d5f, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x285f0fca, 0xae635d5f, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0xbe3c3ee2, 0x93091061, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x16f25dbb, 0xc130997e, 0x1, 0x0
+  .word 0x8, 0x0, 0xbe3c3ee2, 0x93091061, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x16f25dba, 0x4130997e, 0x1, 0x0
+  .word 0x88, 0x0, 0xbe3c3ee2, 0x93091061, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0xe9db4a15, 0x144a00d3, 0x1, 0x0
+  .word 0x18, 0x0, 0xbe3c3ee2, 0x93091061, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0xec0219cc, 0x11c8289e, 0x1, 0x0
+  .word 0x20, 0x2, 0xbe3c3ee2, 0x93091061, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x16f25dbb, 0xc130997e, 0x0, 0x0
+  .word 0x28, 0x0, 0xbe3c3ee2, 0x93091061, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0xbe3c3ee2, 0x93091061, 0x0, 0x0
+  .word 0x30, 0x3, 0xbe3c3ee2, 0x93091061, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xbe3c3ee2, 0x93091061, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0xbe3c3ee2, 0x93091061, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x0, 0x0, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x341123c, 0xc1c70fe2, 0x0, 0x0
+  .word 0x50, 0x2, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x341123c, 0x41c70fe2, 0x0, 0x0
+  .word 0xc0, 0x0, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x90, 0x0, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x341123c, 0xc1c70fe2, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x98, 0x1, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0
+  .word 0x50, 0x2, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0
+  .word 0x88, 0x2, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x60, 0x3, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x8, 0x0
+  .word 0x20, 0x3, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0
+  .word 0x28, 0x0, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x30, 0x3, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x2, 0x16f25dbb, 0xc130997e, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0xfdf24502, 0x7d52a9c1, 0x1, 0x0
+  .word 0xb8, 0x1, 0x16f25dbb, 0xc130997e, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0xfdf24503, 0xfd52a9c1, 0x1, 0x0
+  .word 0x70, 0x0, 0x16f25dbb, 0xc130997e, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x609a7132, 0xfe935ccc, 0x1, 0x0
+  .word 0xb0, 0x1, 0x16f25dbb, 0xc130997e, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0xec1f8342, 0x83cc763a, 0x1, 0x0
+  .word 0x20, 0x1, 0x16f25dbb, 0xc130997e, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x16f25dbb, 0xc130997e, 0x0, 0x0
+  .word 0x28, 0x2, 0x16f25dbb, 0xc130997e, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0
+  .word 0x30, 0x3, 0x16f25dbb, 0xc130997e, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x16f25dbb, 0xc130997e, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x16f25dbb, 0xc130997e, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0xcc8fec8e, 0xc0b27268, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x20b0df21, 0x4184ffb7, 0x1, 0x0
+  .word 0x50, 0x1, 0xcc8fec8e, 0xc0b27268, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x473da81f, 0xc18500de, 0x1, 0x0
+  .word 0x58, 0x2, 0xcc8fec8e, 0xc0b27268, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0xad1ea12e, 0xc248367f, 0x1, 0x0
+  .word 0x90, 0x2, 0xcc8fec8e, 0xc0b27268, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x6b7423c1, 0xbf1c1ba9, 0x1, 0x0
+  .word 0x20, 0x3, 0xcc8fec8e, 0xc0b27268, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0
+  .word 0x28, 0x0, 0xcc8fec8e, 0xc0b27268, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0xb3f743a0, 0x4185004a, 0x0, 0x0
+  .word 0x30, 0x3, 0xcc8fec8e, 0xc0b27268, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0xcc8fec8e, 0xc0b27268, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0xcc8fec8e, 0xc0b27268, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x2, 0xcc8fec8e, 0xc0b27268, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0xccabc01d, 0xc0b27268, 0x1, 0x0
+  .word 0x50, 0x1, 0xcc8fec8e, 0xc0b27268, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0xcc741900, 0xc0b27268, 0x1, 0x0
+  .word 0x88, 0x3, 0xcc8fec8e, 0xc0b27268, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0xf3d0a69b, 0x3f800a7c, 0x1, 0x0
+  .word 0x78, 0x3, 0xcc8fec8e, 0xc0b27268, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x74a6cf9, 0x41e536b6, 0x1, 0x0
+  .word 0x20, 0x3, 0xcc8fec8e, 0xc0b27268, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0
+  .word 0x28, 0x3, 0xcc8fec8e, 0xc0b27268, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0
+  .word 0x30, 0x2, 0xcc8fec8e, 0xc0b27268, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xcc8fec8e, 0xc0b27268, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0xcc8fec8e, 0xc0b27268, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x3, 0xa29af482, 0xc0f1d978, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0xa29af482, 0xc0f1d978, 0x1, 0x0
+  .word 0x80, 0x3, 0xa29af482, 0xc0f1d978, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0xa29af482, 0xc0f1d978, 0x1, 0x0
+  .word 0x70, 0x1, 0xa29af482, 0xc0f1d978, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0xe8148323, 0xb3b78ffc, 0x1, 0x0
+  .word 0x78, 0x3, 0xa29af482, 0xc0f1d978, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0xf53cba57, 0xce2b0b1c, 0x1, 0x0
+  .word 0x20, 0x2, 0xa29af482, 0xc0f1d978, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0xa29af482, 0xc0f1d978, 0x0, 0x0
+  .word 0x28, 0x3, 0xa29af482, 0xc0f1d978, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0
+  .word 0x30, 0x0, 0xa29af482, 0xc0f1d978, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0xa29af482, 0xc0f1d978, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0xa29af482, 0xc0f1d978, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x51d4ac20, 0xc168d832, 0x0, 0x0
+  .word 0xb8, 0x1, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x7f4357d5, 0xc1b43230, 0x0, 0x0
+  .word 0x88, 0x2, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0xadc59094, 0xc3597471, 0x1, 0x0
+  .word 0xb0, 0x2, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x64e9f57c, 0xbff14783, 0x1, 0x0
+  .word 0x20, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0
+  .word 0x28, 0x2, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0xecb4b274, 0x41a36b6e, 0x0, 0x0
+  .word 0x30, 0x1, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x1, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xc2b3cb62, 0xbe641002, 0x0, 0x0
+  .word 0x8, 0x3, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xc2b3cb62, 0xbe641002, 0x0, 0x0
+  .word 0x88, 0x2, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x90, 0x3, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x8, 0x0
+  .word 0x20, 0x3, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xc2b3cb62, 0xbe641002, 0x0, 0x0
+  .word 0x28, 0x3, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x30, 0x3, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0x0, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0
+  .word 0x8, 0x1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0x0, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0
+  .word 0x88, 0x2, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xb0, 0x1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff00000, 0x8, 0x0
+  .word 0x20, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0x0, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0
+  .word 0x28, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x30, 0x3, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0xab9e1942, 0x3ff9ab52, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0xa35f5ffa, 0xbffb38a1, 0x0, 0x0
+  .word 0x80, 0x2, 0xab9e1942, 0x3ff9ab52, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0xbea6e49f, 0x4013a3d1, 0x1, 0x0
+  .word 0x10, 0x3, 0xab9e1942, 0x3ff9ab52, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0xd182ce36, 0xc01536a0, 0x1, 0x0
+  .word 0x90, 0x0, 0xab9e1942, 0x3ff9ab52, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x6742521d, 0xbfdf0f9e, 0x1, 0x0
+  .word 0x20, 0x3, 0xab9e1942, 0x3ff9ab52, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0
+  .word 0x28, 0x1, 0xab9e1942, 0x3ff9ab52, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0
+  .word 0x30, 0x0, 0xab9e1942, 0x3ff9ab52, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xab9e1942, 0x3ff9ab52, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0xab9e1942, 0x3ff9ab52, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x50, 0x2, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x88, 0x3, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x60, 0x0, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x2, 0xb4b4e566, 0xc1fb0cf7, 0x1, 0x0, 0x0, 0x0, 0xb4b4e565, 0xc1fb0cf7, 0x1, 0x0
+  .word 0x80, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x1, 0x0, 0x0, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x1, 0x0
+  .word 0xc0, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x1, 0x0, 0x0, 0x0, 0xb0cf7b4c, 0x80000001, 0x3, 0x0
+  .word 0x18, 0x3, 0xb4b4e566, 0xc1fb0cf7, 0x1, 0x0, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x5, 0x0
+  .word 0x20, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x1, 0x0, 0x0, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0
+  .word 0x28, 0x2, 0xb4b4e566, 0xc1fb0cf7, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x30, 0x2, 0xb4b4e566, 0xc1fb0cf7, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xb4b4e566, 0xc1fb0cf7, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0xb4b4e566, 0xc1fb0cf7, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0x15a3b9c1, 0xa1871177, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x16f25dbc, 0xc130997e, 0x1, 0x0
+  .word 0xb8, 0x0, 0x15a3b9c1, 0xa1871177, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x16f25dbb, 0x4130997e, 0x1, 0x0
+  .word 0xc0, 0x1, 0x15a3b9c1, 0xa1871177, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0xe301e4d4, 0x22c7eec3, 0x1, 0x0
+  .word 0x78, 0x1, 0x15a3b9c1, 0xa1871177, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x97d4a4b7, 0x20463c28, 0x1, 0x0
+  .word 0x20, 0x2, 0x15a3b9c1, 0xa1871177, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x16f25dbb, 0xc130997e, 0x0, 0x0
+  .word 0x28, 0x3, 0x15a3b9c1, 0xa1871177, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x15a3b9c1, 0xa1871177, 0x0, 0x0
+  .word 0x30, 0x3, 0x15a3b9c1, 0xa1871177, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x15a3b9c1, 0xa1871177, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x15a3b9c1, 0xa1871177, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0xbe3c3ee2, 0x93091061, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x2b5c138b, 0x3ebabbf3, 0x1, 0x0
+  .word 0xb8, 0x1, 0xbe3c3ee2, 0x93091061, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x2b5c138b, 0xbebabbf3, 0x1, 0x0
+  .word 0xc0, 0x0, 0xbe3c3ee2, 0x93091061, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x9c1d0180, 0x91d4f085, 0x1, 0x0
+  .word 0x78, 0x1, 0xbe3c3ee2, 0x93091061, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0xc99808a5, 0x943e0036, 0x1, 0x0
+  .word 0x20, 0x0, 0xbe3c3ee2, 0x93091061, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0xbe3c3ee2, 0x93091061, 0x0, 0x0
+  .word 0x28, 0x1, 0xbe3c3ee2, 0x93091061, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0
+  .word 0x30, 0x3, 0xbe3c3ee2, 0x93091061, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xbe3c3ee2, 0x93091061, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0xbe3c3ee2, 0x93091061, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0xecb61cb8, 0x32b51ef9, 0x1, 0x0
+  .word 0x80, 0x0, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0
+  .word 0x58, 0x2, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x78, 0x1, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0xecb61cb7, 0x75d51ef9, 0x0, 0x0
+  .word 0x20, 0x2, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0
+  .word 0x30, 0x2, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x3fe00000, 0x0, 0x0
+  .word 0xa8, 0x0, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x40040000, 0x0, 0x0
+  .word 0x88, 0x3, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff80000, 0x0, 0x0
+  .word 0x60, 0x3, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff80000, 0x0, 0x0
+  .word 0x20, 0x2, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0x3ff80000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x98, 0x0, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xa8, 0x2, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x10, 0x2, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x60, 0x0, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x2, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x10, 0x0
+  .word 0x28, 0x1, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x10, 0x0
+  .word 0x30, 0x3, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x3, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x1, 0x1, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xa0, 0x3, 0x0, 0xbff00000, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0xbff00000, 0x1, 0x0
+  .word 0x80, 0x2, 0x0, 0xbff00000, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0xbff00000, 0x1, 0x0
+  .word 0x10, 0x2, 0x0, 0xbff00000, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0xce6f291a, 0x34e16c74, 0x0, 0x0
+  .word 0x18, 0x3, 0x0, 0xbff00000, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x49695758, 0x4afd62a5, 0x1, 0x0
+  .word 0x20, 0x1, 0x0, 0xbff00000, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xbff00000, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0xbff00000, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0xbff00000, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0xbff00000, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0x0, 0x80000000, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x4e55b2be, 0xbee674df, 0x0, 0x0
+  .word 0x8, 0x3, 0x0, 0x80000000, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x4e55b2be, 0x3ee674df, 0x0, 0x0
+  .word 0x58, 0x2, 0x0, 0x80000000, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xb0, 0x0, 0x0, 0x80000000, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x3, 0x0, 0x80000000, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x4e55b2be, 0xbee674df, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0x80000000, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x80000000, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x80000000, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x0, 0x80000000, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0x21a015d3, 0x79d03241, 0x0, 0xbff00000, 0x0, 0x0, 0x21a015d3, 0x79d03241, 0x1, 0x0
+  .word 0x50, 0x2, 0x21a015d3, 0x79d03241, 0x0, 0xbff00000, 0x0, 0x0, 0x21a015d3, 0x79d03241, 0x1, 0x0
+  .word 0x58, 0x3, 0x21a015d3, 0x79d03241, 0x0, 0xbff00000, 0x0, 0x0, 0x21a015d3, 0xf9d03241, 0x0, 0x0
+  .word 0x90, 0x3, 0x21a015d3, 0x79d03241, 0x0, 0xbff00000, 0x0, 0x0, 0x21a015d3, 0xf9d03241, 0x0, 0x0
+  .word 0x20, 0x0, 0x21a015d3, 0x79d03241, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x21a015d3, 0x79d03241, 0x0, 0xbff00000, 0x0, 0x0, 0x21a015d3, 0x79d03241, 0x0, 0x0
+  .word 0x30, 0x2, 0x21a015d3, 0x79d03241, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x21a015d3, 0x79d03241, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x21a015d3, 0x79d03241, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x98, 0x1, 0x0, 0x3ff80000, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0xffffffff, 0x3ff7ffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x0, 0x3ff80000, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x1, 0x3ff80000, 0x1, 0x0
+  .word 0xc0, 0x0, 0x0, 0x3ff80000, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0xbc8e97af, 0xae6d0c0e, 0x0, 0x0
+  .word 0x60, 0x3, 0x0, 0x3ff80000, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0xe08ee3c8, 0xd183d471, 0x1, 0x0
+  .word 0x20, 0x3, 0x0, 0x3ff80000, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x285f0fca, 0xae635d5f, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x3ff80000, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0x3ff80000, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x3ff80000, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x0, 0x3ff80000, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x8, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x88, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x90, 0x1, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x0
+  .word 0x28, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x0
+  .word 0x30, 0x2, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x3, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x0, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x8, 0x0, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x70, 0x2, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x18, 0x0, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x20, 0x0, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x3ff80000, 0x10, 0x0
+  .word 0x28, 0x0, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x3ff80000, 0x10, 0x0
+  .word 0x30, 0x2, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x38, 0x3, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x0, 0x0, 0x3ff80000, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x68, 0x0, 0xffffffff, 0x7fefffff, 0x39c96231, 0xc0188378, 0x0, 0x0, 0xfffffffe, 0x7fefffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xffffffff, 0x7fefffff, 0x39c96231, 0xc0188378, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xffffffff, 0x7fefffff, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x60, 0x3, 0xffffffff, 0x7fefffff, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x6f5cc7b3, 0xffc4e2eb, 0x1, 0x0
+  .word 0x20, 0x3, 0xffffffff, 0x7fefffff, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x39c96231, 0xc0188378, 0x0, 0x0
+  .word 0x28, 0x1, 0xffffffff, 0x7fefffff, 0x39c96231, 0xc0188378, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x0, 0xffffffff, 0x7fefffff, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0xffffffff, 0x7fefffff, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0xffffffff, 0x7fefffff, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x98, 0x0, 0x0, 0xfff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xb8, 0x1, 0x0, 0xfff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x70, 0x0, 0x0, 0xfff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xb0, 0x1, 0x0, 0xfff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0xfff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0xfff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x5765ce15, 0xdfc944f9, 0x0, 0x0
+  .word 0x30, 0x3, 0x0, 0xfff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x0, 0xfff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0xfff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0x15a3b9c1, 0xa1871177, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x21a015d3, 0x79d03241, 0x1, 0x0
+  .word 0x50, 0x3, 0x15a3b9c1, 0xa1871177, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x21a015d3, 0xf9d03241, 0x1, 0x0
+  .word 0x70, 0x0, 0x15a3b9c1, 0xa1871177, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x9135f509, 0xdb6759eb, 0x1, 0x0
+  .word 0x18, 0x0, 0x15a3b9c1, 0xa1871177, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x20, 0x2, 0x15a3b9c1, 0xa1871177, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x15a3b9c1, 0xa1871177, 0x0, 0x0
+  .word 0x28, 0x3, 0x15a3b9c1, 0xa1871177, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x21a015d3, 0x79d03241, 0x0, 0x0
+  .word 0x30, 0x0, 0x15a3b9c1, 0xa1871177, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x15a3b9c1, 0xa1871177, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x15a3b9c1, 0xa1871177, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0x15a3b9c1, 0xa1871177, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0xae8de429, 0x4dfa5465, 0x1, 0x0
+  .word 0xa8, 0x2, 0x15a3b9c1, 0xa1871177, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0xae8de429, 0xcdfa5465, 0x1, 0x0
+  .word 0xc0, 0x0, 0x15a3b9c1, 0xa1871177, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0xe722f1f6, 0xaf92fb07, 0x1, 0x0
+  .word 0x78, 0x3, 0x15a3b9c1, 0xa1871177, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x162a3750, 0x937c0942, 0x1, 0x0
+  .word 0x20, 0x0, 0x15a3b9c1, 0xa1871177, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x15a3b9c1, 0xa1871177, 0x0, 0x0
+  .word 0x28, 0x0, 0x15a3b9c1, 0xa1871177, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x0
+  .word 0x30, 0x0, 0x15a3b9c1, 0xa1871177, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x15a3b9c1, 0xa1871177, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x15a3b9c1, 0xa1871177, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x1, 0x341123c, 0xc1c70fe2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0xc24c8b6a, 0xc1c7182e, 0x1, 0x0
+  .word 0x50, 0x1, 0x341123c, 0xc1c70fe2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x4435990d, 0xc1c70795, 0x1, 0x0
+  .word 0x58, 0x2, 0x341123c, 0xc1c70fe2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0xa2a73833, 0x4307ed1f, 0x1, 0x0
+  .word 0x18, 0x2, 0x341123c, 0xc1c70fe2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x270d571e, 0x40863aa2, 0x1, 0x0
+  .word 0x20, 0x3, 0x341123c, 0xc1c70fe2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x341123c, 0xc1c70fe2, 0x0, 0x0
+  .word 0x28, 0x2, 0x341123c, 0xc1c70fe2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x16f25dbb, 0xc130997e, 0x0, 0x0
+  .word 0x30, 0x3, 0x341123c, 0xc1c70fe2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x341123c, 0xc1c70fe2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x341123c, 0xc1c70fe2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x0, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x277ebc9e, 0xc01a71fa, 0x0, 0x0
+  .word 0x80, 0x2, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xc0, 0x1, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x76886ae1, 0x4025dacc, 0x1, 0x0
+  .word 0xb0, 0x2, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x20, 0x3, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0
+  .word 0x28, 0x3, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0
+  .word 0x30, 0x2, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0x16f25dbb, 0xc130997e, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0xdffe1f2, 0xc1a51a25, 0x1, 0x0
+  .word 0x50, 0x1, 0x16f25dbb, 0xc130997e, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x15a4187b, 0x41a4d7bf, 0x1, 0x0
+  .word 0x10, 0x2, 0x16f25dbb, 0xc130997e, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0xe322ae93, 0x42e5c223, 0x1, 0x0
+  .word 0xb0, 0x2, 0x16f25dbb, 0xc130997e, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0xe9ba714f, 0x3f7953ec, 0x1, 0x0
+  .word 0x20, 0x2, 0x16f25dbb, 0xc130997e, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0
+  .word 0x28, 0x0, 0x16f25dbb, 0xc130997e, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x16f25dbb, 0xc130997e, 0x0, 0x0
+  .word 0x30, 0x3, 0x16f25dbb, 0xc130997e, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x16f25dbb, 0xc130997e, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x16f25dbb, 0xc130997e, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0xfdf24503, 0x7d52a9c1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0xa8, 0x2, 0xfdf24503, 0x7d52a9c1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xfffff6aa, 0xffefffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0xfdf24503, 0x7d52a9c1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x78, 0x2, 0xfdf24503, 0x7d52a9c1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xfdf24504, 0x3d52a9c1, 0x1, 0x0
+  .word 0x20, 0x3, 0xfdf24503, 0x7d52a9c1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0
+  .word 0x28, 0x2, 0xfdf24503, 0x7d52a9c1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x3, 0xfdf24503, 0x7d52a9c1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xfdf24503, 0x7d52a9c1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0xfdf24503, 0x7d52a9c1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x3, 0x285f0fca, 0xae635d5f, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xa8, 0x0, 0x285f0fca, 0xae635d5f, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x10, 0x1, 0x285f0fca, 0xae635d5f, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x18, 0x3, 0x285f0fca, 0xae635d5f, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x20, 0x1, 0x285f0fca, 0xae635d5f, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x28, 0x2, 0x285f0fca, 0xae635d5f, 0x0, 0xfff00000, 0x0, 0x0, 0x285f0fca, 0xae635d5f, 0x0, 0x0
+  .word 0x30, 0x2, 0x285f0fca, 0xae635d5f, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x285f0fca, 0xae635d5f, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x285f0fca, 0xae635d5f, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x15a3b9c1, 0xa1871177, 0x1, 0x0
+  .word 0x50, 0x3, 0xd6fd1d9b, 0x9530fcd9, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x15a3b9c1, 0x21871177, 0x1, 0x0
+  .word 0x70, 0x0, 0xd6fd1d9b, 0x9530fcd9, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x60, 0x1, 0xd6fd1d9b, 0x9530fcd9, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x4e7f9327, 0x339790ae, 0x1, 0x0
+  .word 0x20, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x15a3b9c1, 0xa1871177, 0x0, 0x0
+  .word 0x28, 0x1, 0xd6fd1d9b, 0x9530fcd9, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0
+  .word 0x30, 0x0, 0xd6fd1d9b, 0x9530fcd9, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0xd6fd1d9b, 0x9530fcd9, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x68, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x60, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x55555554, 0x7fe55555, 0x1, 0x0
+  .word 0x20, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x28, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0x1, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0xecb61cb8, 0x32b51ef9, 0x1, 0x0
+  .word 0x80, 0x2, 0x1, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0xecb61cb7, 0xb2b51ef9, 0x1, 0x0
+  .word 0x10, 0x1, 0x1, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0xb0, 0x0, 0x1, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x37064be4, 0xa083dc4, 0x1, 0x0
+  .word 0x20, 0x1, 0x1, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x1, 0x1, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0
+  .word 0x30, 0x0, 0x1, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x1, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x1, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x1, 0x0
+  .word 0x50, 0x2, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x7dc67e9e, 0x3ebbd38e, 0x1, 0x0
+  .word 0xc0, 0x1, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x2ff5855a, 0x2d30d6ce, 0x1, 0x0
+  .word 0xb0, 0x0, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x2e1d07a7, 0x2f9644ea, 0x1, 0x0
+  .word 0x20, 0x3, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0
+  .word 0x28, 0x0, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x285f0fca, 0xae635d5f, 0x0, 0x0
+  .word 0x30, 0x0, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x4c96548b, 0xc1fb0e01, 0x1, 0x0
+  .word 0x50, 0x3, 0xb4b4e566, 0xc1fb0cf7, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x1cd37640, 0xc1fb0bee, 0x1, 0x0
+  .word 0xc0, 0x1, 0xb4b4e566, 0xc1fb0cf7, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0xe24f2d7a, 0x433c1078, 0x1, 0x0
+  .word 0x90, 0x3, 0xb4b4e566, 0xc1fb0cf7, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x1b92495e, 0x40ba12d6, 0x1, 0x0
+  .word 0x20, 0x1, 0xb4b4e566, 0xc1fb0cf7, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0
+  .word 0x28, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x16f25dbb, 0xc130997e, 0x0, 0x0
+  .word 0x30, 0x1, 0xb4b4e566, 0xc1fb0cf7, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xb4b4e566, 0xc1fb0cf7, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0xb4b4e566, 0xc1fb0cf7, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x1, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x0, 0x0, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x0
+  .word 0xa8, 0x2, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x0, 0x0, 0x0, 0xe7b4be3a, 0x5f0ed275, 0x1, 0x0
+  .word 0xc0, 0x1, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x0, 0x0, 0x0, 0xe7b4be3b, 0x1beed275, 0x0, 0x0
+  .word 0x90, 0x3, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x20, 0x3, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0x28, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x0, 0x0, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0
+  .word 0x30, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x98, 0x3, 0xce6f291a, 0xb4e16c74, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xb8, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x70, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x18, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x20, 0x1, 0xce6f291a, 0xb4e16c74, 0x0, 0x7ff80000, 0x0, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x0
+  .word 0x28, 0x2, 0xce6f291a, 0xb4e16c74, 0x0, 0x7ff80000, 0x0, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x0
+  .word 0x30, 0x1, 0xce6f291a, 0xb4e16c74, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0xce6f291a, 0xb4e16c74, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x40, 0x1, 0xce6f291a, 0xb4e16c74, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x48, 0x0, 0xae8de429, 0x4dfa5465, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0xae8de42a, 0x4dfa5465, 0x1, 0x0
+  .word 0x8, 0x0, 0xae8de429, 0x4dfa5465, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0xae8de428, 0x4dfa5465, 0x1, 0x0
+  .word 0xc0, 0x3, 0xae8de429, 0x4dfa5465, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x31cbcd40, 0x4f9147a0, 0x1, 0x0
+  .word 0xb0, 0x1, 0xae8de429, 0x4dfa5465, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x11054e48, 0x4c640f43, 0x1, 0x0
+  .word 0x20, 0x2, 0xae8de429, 0x4dfa5465, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0xb3f743a0, 0x4185004a, 0x0, 0x0
+  .word 0x28, 0x3, 0xae8de429, 0x4dfa5465, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x0
+  .word 0x30, 0x3, 0xae8de429, 0x4dfa5465, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0xae8de429, 0x4dfa5465, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0xae8de429, 0x4dfa5465, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xa0, 0x3, 0x5765ce15, 0xdfc944f9, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x5765ce15, 0xdfd944f9, 0x0, 0x0
+  .word 0x50, 0x2, 0x5765ce15, 0xdfc944f9, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xc0, 0x3, 0x5765ce15, 0xdfc944f9, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x43d95bbb, 0x7fa3f45a, 0x1, 0x0
+  .word 0x18, 0x3, 0x5765ce15, 0xdfc944f9, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x20, 0x0, 0x5765ce15, 0xdfc944f9, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x5765ce15, 0xdfc944f9, 0x0, 0x0
+  .word 0x28, 0x1, 0x5765ce15, 0xdfc944f9, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x5765ce15, 0xdfc944f9, 0x0, 0x0
+  .word 0x30, 0x1, 0x5765ce15, 0xdfc944f9, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x5765ce15, 0xdfc944f9, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x5765ce15, 0xdfc944f9, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0xce6f291a, 0xb4e16c74, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0xa29af483, 0xc0f1d978, 0x1, 0x0
+  .word 0xa8, 0x3, 0xce6f291a, 0xb4e16c74, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0xa29af481, 0x40f1d978, 0x1, 0x0
+  .word 0x10, 0x2, 0xce6f291a, 0xb4e16c74, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x6a04c85d, 0x35e3700e, 0x1, 0x0
+  .word 0x78, 0x1, 0xce6f291a, 0xb4e16c74, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0xbfa3380e, 0x33df3c8f, 0x1, 0x0
+  .word 0x20, 0x0, 0xce6f291a, 0xb4e16c74, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0xa29af482, 0xc0f1d978, 0x0, 0x0
+  .word 0x28, 0x0, 0xce6f291a, 0xb4e16c74, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x0
+  .word 0x30, 0x2, 0xce6f291a, 0xb4e16c74, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0xce6f291a, 0xb4e16c74, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0xce6f291a, 0xb4e16c74, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x80, 0x1, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x58, 0x1, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x78, 0x3, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x20, 0x1, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0
+  .word 0x28, 0x3, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x30, 0x2, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x98, 0x1, 0xd6fd1d9b, 0x9530fcd9, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x2b5c138a, 0x3ebabbf3, 0x1, 0x0
+  .word 0x8, 0x0, 0xd6fd1d9b, 0x9530fcd9, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x2b5c138c, 0xbebabbf3, 0x1, 0x0
+  .word 0x58, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x5d91bba1, 0x93fc626f, 0x1, 0x0
+  .word 0x60, 0x1, 0xd6fd1d9b, 0x9530fcd9, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x40f656c7, 0x96645571, 0x1, 0x0
+  .word 0x20, 0x1, 0xd6fd1d9b, 0x9530fcd9, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0
+  .word 0x28, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0
+  .word 0x30, 0x1, 0xd6fd1d9b, 0x9530fcd9, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0xd6fd1d9b, 0x9530fcd9, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0x11d1fd36, 0xc1a4f8f2, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x0
+  .word 0x8, 0x1, 0x11d1fd36, 0xc1a4f8f2, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0xe7b4be3c, 0xdf0ed275, 0x1, 0x0
+  .word 0xc0, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0xeb5a6908, 0xe0c43351, 0x1, 0x0
+  .word 0x78, 0x2, 0x11d1fd36, 0xc1a4f8f2, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0xa250ffef, 0xa285c61f, 0x1, 0x0
+  .word 0x20, 0x2, 0x11d1fd36, 0xc1a4f8f2, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0
+  .word 0x28, 0x2, 0x11d1fd36, 0xc1a4f8f2, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0
+  .word 0x30, 0x2, 0x11d1fd36, 0xc1a4f8f2, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x48, 0x0, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x5cf7508a, 0x3ff9834e, 0x1, 0x0
+  .word 0x50, 0x1, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0xfa44e1fa, 0xbff9d356, 0x1, 0x0
+  .word 0x58, 0x3, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0xec1f2a96, 0xbf900ccd, 0x1, 0x0
+  .word 0x18, 0x2, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x83f57e33, 0xbf78f16c, 0x1, 0x0
+  .word 0x20, 0x1, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x53645c31, 0xbf840227, 0x0, 0x0
+  .word 0x28, 0x0, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0
+  .word 0x30, 0x1, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x2, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x0, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0xbe3c3ee2, 0x93091061, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x285f0fcb, 0xae635d5f, 0x1, 0x0
+  .word 0x80, 0x2, 0xbe3c3ee2, 0x93091061, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x285f0fc9, 0x2e635d5f, 0x1, 0x0
+  .word 0x10, 0x2, 0xbe3c3ee2, 0x93091061, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x5a8b80bb, 0x17e55b8, 0x1, 0x0
+  .word 0x78, 0x2, 0xbe3c3ee2, 0x93091061, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0xada51a0c, 0x2494b57f, 0x1, 0x0
+  .word 0x20, 0x2, 0xbe3c3ee2, 0x93091061, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x285f0fca, 0xae635d5f, 0x0, 0x0
+  .word 0x28, 0x3, 0xbe3c3ee2, 0x93091061, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0xbe3c3ee2, 0x93091061, 0x0, 0x0
+  .word 0x30, 0x3, 0xbe3c3ee2, 0x93091061, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0xbe3c3ee2, 0x93091061, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0xbe3c3ee2, 0x93091061, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x48, 0x1, 0x277ebc9e, 0xc00a71fa, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x277ebc9e, 0xc00a71fa, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x10, 0x2, 0x277ebc9e, 0xc00a71fa, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x90, 0x1, 0x277ebc9e, 0xc00a71fa, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x13bf5e4f, 0x800d38fd, 0x3, 0x0
+  .word 0x20, 0x0, 0x277ebc9e, 0xc00a71fa, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0
+  .word 0x28, 0x0, 0x277ebc9e, 0xc00a71fa, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0x30, 0x1, 0x277ebc9e, 0xc00a71fa, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x0, 0x277ebc9e, 0xc00a71fa, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x1, 0x277ebc9e, 0xc00a71fa, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xa0, 0x2, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x40040000, 0x0, 0x0
+  .word 0xa8, 0x0, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xbfe00000, 0x0, 0x0
+  .word 0x58, 0x0, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x18, 0x3, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x55555555, 0x3fe55555, 0x1, 0x0
+  .word 0x20, 0x1, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x1, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x40, 0x2, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x0, 0x1, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0xd6fd1d9b, 0x9530fcd9, 0x1, 0x0
+  .word 0x8, 0x3, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0xd6fd1d9b, 0x1530fcd9, 0x1, 0x0
+  .word 0xc0, 0x1, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x90, 0x2, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x5dcf87c8, 0xaace23b3, 0x1, 0x0
+  .word 0x20, 0x1, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0x30, 0x1, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x38, 0x3, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x40, 0x3, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xc8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x3ff00000, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x3ff00000, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0xbff00000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x7ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x7ff00000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0xfff00000, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0xfff00000, 0x0, 0x100000, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff80000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x7ff80000, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0xfff80000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfff00000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x1, 0xfff00000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x1, 0x7ff00000, 0x1, 0x7ff00000, 0x0, 0x0, 0x1, 0x7ff00000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0xd0, 0x0, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x80000000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0xc8, 0x0, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0xd0, 0x0, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x80000000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x1, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0
+  .word 0xc8, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0xd0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x0, 0x0
+  .word 0xd8, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0xc8, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0xd0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x0, 0x0
+  .word 0xd8, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x3ff80000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x80100000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xbff80000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x3ff80000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0xbff80000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0xbff80000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x3ff80000, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0xc8, 0x0, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x53645c31, 0xbf840227, 0x0, 0x0
+  .word 0xd0, 0x0, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x53645c31, 0x3f840227, 0x0, 0x0
+  .word 0xd8, 0x0, 0x53645c31, 0xbf840227, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x53645c31, 0x3f840227, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x80000000, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xc8, 0x0, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xc2b3cb62, 0x3e641002, 0x0, 0x0
+  .word 0xd0, 0x0, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xc2b3cb62, 0xbe641002, 0x0, 0x0
+  .word 0xd8, 0x0, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xc2b3cb62, 0xbe641002, 0x0, 0x0
+  .word 0xc8, 0x0, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0
+  .word 0xd0, 0x0, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0xecb61cb7, 0xb2b51ef9, 0x0, 0x0
+  .word 0xd8, 0x0, 0xecb61cb7, 0x32b51ef9, 0x1, 0x0, 0x0, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0
+  .word 0xc8, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x0
+  .word 0xd0, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0xae8de429, 0xcdfa5465, 0x0, 0x0
+  .word 0xd8, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x7ff80000, 0x0, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x0
+  .word 0xc8, 0x0, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0
+  .word 0xd0, 0x0, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x277ebc9e, 0x400a71fa, 0x0, 0x0
+  .word 0xd8, 0x0, 0x277ebc9e, 0xc00a71fa, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x277ebc9e, 0x400a71fa, 0x0, 0x0
+  .word 0xc8, 0x0, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x285f0fca, 0xae635d5f, 0x0, 0x0
+  .word 0xd0, 0x0, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x285f0fca, 0x2e635d5f, 0x0, 0x0
+  .word 0xd8, 0x0, 0x285f0fca, 0xae635d5f, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x285f0fca, 0x2e635d5f, 0x0, 0x0
+  .word 0xc8, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x277ebc9e, 0x400a71fa, 0x0, 0x0
+  .word 0xd0, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0
+  .word 0xd8, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff00000, 0x0, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0
+  .word 0xc8, 0x0, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x80100000, 0x0, 0x0
+  .word 0xd0, 0x0, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x0
+  .word 0xd8, 0x0, 0x0, 0x100000, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x80100000, 0x0, 0x0
+  .word 0xe0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xf0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xf8, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x1
+  .word 0x128, 0x3, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0xe8, 0x1, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x130, 0x3, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0xf8, 0x1, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x3, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x1, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x1, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x1, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x1
+  .word 0xe0, 0x3, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0xe8, 0x3, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x138, 0x2, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0xf8, 0x2, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x1, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x1, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x140, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x148, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0, 0x1
+  .word 0x150, 0x1, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x1, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x1, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x2, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x0, 0x0, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x158, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x148, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7fffffff, 0x0, 0x10, 0x1
+  .word 0x150, 0x1, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x10, 0x1
+  .word 0xf8, 0x3, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x3, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x1, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x3, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x0, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x1
+  .word 0x160, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x168, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x10, 0x1
+  .word 0x130, 0x3, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x2, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x3, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x2, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x0, 0x0, 0xfff00000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1
+  .word 0x158, 0x2, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x170, 0x2, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x7fffffff, 0x0, 0x10, 0x1
+  .word 0x178, 0x2, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x10, 0x1
+  .word 0xf8, 0x1, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x1, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x0, 0x0, 0x7ff80000, 0x0, 0x0, 0x0, 0x0, 0x200, 0x0, 0x0, 0x1
+  .word 0x128, 0x2, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x180, 0x3, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7fffffff, 0x0, 0x10, 0x1
+  .word 0x138, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x10, 0x1
+  .word 0xf8, 0x1, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x100, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x108, 0x3, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x110, 0x1, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x118, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x120, 0x0, 0x1, 0x7ff00000, 0x0, 0x0, 0x0, 0x0, 0x100, 0x0, 0x0, 0x1
+  .word 0x128, 0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e600000, 0x0, 0x0
+  .word 0xe8, 0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x178, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x100, 0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x108, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x110, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0x118, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x120, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x1
+  .word 0x158, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5ff00000, 0x1, 0x0
+  .word 0x168, 0x3, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x7fffffff, 0x0, 0x10, 0x1
+  .word 0x178, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x10, 0x1
+  .word 0xf8, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x100, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x108, 0x1, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x110, 0x2, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x118, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x120, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x160, 0x1, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20000000, 0x0, 0x0
+  .word 0xe8, 0x2, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x130, 0x3, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x2, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x100, 0x2, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x108, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x110, 0x2, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0x118, 0x2, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x120, 0x0, 0x0, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0xe0, 0x2, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x1409212e, 0x3ff3988e, 0x1, 0x0
+  .word 0x148, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x138, 0x3, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0xf8, 0x2, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x3fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x3, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x3fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x1, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x3fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x3fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x3fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x0, 0x0, 0x3ff80000, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x158, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xe8, 0x1, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf0, 0x3, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x3, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x100, 0x0, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x108, 0x1, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x110, 0x1, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x118, 0x1, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x120, 0x0, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x128, 0x3, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x0, 0x0, 0x507bb40b, 0x3f54ae9a, 0x1, 0x0
+  .word 0x168, 0x3, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x150, 0x1, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0xf8, 0x1, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x0, 0x0, 0x35d5df99, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x0, 0x0, 0x35d5df99, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x1, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x0, 0x0, 0x35d5df99, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x0, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x0, 0x0, 0x35d5df9a, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x0, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x0, 0x0, 0x35d5df99, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0x2b5c138b, 0x3ebabbf3, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0xe0, 0x2, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x168, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x10, 0x1
+  .word 0xf0, 0x1, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x2, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0, 0x0, 0x0, 0xcfd867be, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0, 0x0, 0x0, 0xcfd867bd, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0, 0x0, 0x0, 0xcfd867be, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0, 0x0, 0x0, 0xcfd867bd, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0, 0x0, 0x0, 0xcfd867be, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x160, 0x3, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x168, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x130, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x1, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x100, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x108, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x110, 0x1, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x118, 0x2, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x120, 0x0, 0xce6f291a, 0xb4e16c74, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x128, 0x2, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x148, 0x0, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0xd1e03bfa, 0x0, 0x1, 0x1
+  .word 0x178, 0x2, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x3, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0xce387f10, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0xce387f10, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0xce387f11, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x2, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0xce387f10, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0xce387f11, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0x341123c, 0xc1c70fe2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0xe0, 0x1, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x148, 0x0, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0xfffee269, 0x0, 0x1, 0x1
+  .word 0xf0, 0x2, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x2, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0xc78ecbc5, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x3, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0xc78ecbc5, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x1, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0xc78ecbc6, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x2, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0xc78ecbc5, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x0, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0xc78ecbc5, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0xa29af482, 0xc0f1d978, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x160, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x170, 0x1, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x138, 0x3, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x1, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0xb5de9c74, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0xb5de9c73, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0xb5de9c74, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0xb5de9c73, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0xb5de9c74, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0xe0, 0x2, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x0, 0x0, 0x1f4dc72c, 0x46f48665, 0x1, 0x0
+  .word 0x170, 0x2, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x0, 0x0, 0x7fffffff, 0x0, 0x10, 0x1
+  .word 0x178, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x10, 0x1
+  .word 0xf8, 0x3, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x100, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x108, 0x1, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x110, 0x2, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x118, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x120, 0x0, 0xae8de429, 0x4dfa5465, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x128, 0x0, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0xe8, 0x2, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x1, 0x1
+  .word 0x138, 0x3, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x3, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xb3208016, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x3, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xb3208016, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xb3208017, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x1, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xb3208016, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0xb3208017, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0xc2b3cb62, 0xbe641002, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x140, 0x3, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x148, 0x2, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x138, 0x0, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x1, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x100, 0x3, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x108, 0x1, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x110, 0x2, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x118, 0x3, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x120, 0x0, 0x285f0fca, 0xae635d5f, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x128, 0x2, 0x8ac6285a, 0x3f4a623b, 0x0, 0x0, 0x0, 0x0, 0x85a89b2d, 0x3f9d0e75, 0x1, 0x0
+  .word 0x170, 0x2, 0x8ac6285a, 0x3f4a623b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf0, 0x2, 0x8ac6285a, 0x3f4a623b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x2, 0x8ac6285a, 0x3f4a623b, 0x0, 0x0, 0x0, 0x0, 0x3a5311dc, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x0, 0x8ac6285a, 0x3f4a623b, 0x0, 0x0, 0x0, 0x0, 0x3a5311dc, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x1, 0x8ac6285a, 0x3f4a623b, 0x0, 0x0, 0x0, 0x0, 0x3a5311dc, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x0, 0x8ac6285a, 0x3f4a623b, 0x0, 0x0, 0x0, 0x0, 0x3a5311dd, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x0, 0x8ac6285a, 0x3f4a623b, 0x0, 0x0, 0x0, 0x0, 0x3a5311dc, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0x8ac6285a, 0x3f4a623b, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x140, 0x1, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0xed6e58e0, 0x40c8edb0, 0x1, 0x0
+  .word 0x148, 0x0, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x9b5b777, 0x0, 0x1, 0x1
+  .word 0x130, 0x0, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x9b5b776, 0x0, 0x1, 0x1
+  .word 0xf8, 0x1, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x4d1b5b77, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x0, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x4d1b5b77, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x1, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x4d1b5b77, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x1, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x4d1b5b78, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x0, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x4d1b5b77, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0xecb4b274, 0x41a36b6e, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x160, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x148, 0x2, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0xf58386f8, 0x0, 0x1, 0x1
+  .word 0x178, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0xcd27c791, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0xcd27c790, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0xcd27c791, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x1, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0xcd27c790, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0xcd27c791, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x158, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x170, 0x3, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0xffffed8e, 0x0, 0x1, 0x1
+  .word 0x138, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x1, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0xc5939346, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x3, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0xc5939346, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0xc5939347, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x2, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0xc5939346, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0xc5939347, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0xcc8fec8e, 0xc0b27268, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x158, 0x1, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x0, 0x0, 0xd058d2aa, 0x5ea147c3, 0x1, 0x0
+  .word 0x170, 0x1, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x0, 0x0, 0x7fffffff, 0x0, 0x10, 0x1
+  .word 0x130, 0x3, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x10, 0x1
+  .word 0xf8, 0x2, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x100, 0x0, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x108, 0x0, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x110, 0x0, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x118, 0x2, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x120, 0x0, 0xfdf24503, 0x7d52a9c1, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x160, 0x3, 0x44339624, 0x8ff03dcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x180, 0x0, 0x44339624, 0x8ff03dcd, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x1, 0x1
+  .word 0x138, 0x2, 0x44339624, 0x8ff03dcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x1, 0x44339624, 0x8ff03dcd, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x100, 0x2, 0x44339624, 0x8ff03dcd, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x108, 0x3, 0x44339624, 0x8ff03dcd, 0x0, 0x0, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x110, 0x2, 0x44339624, 0x8ff03dcd, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x118, 0x3, 0x44339624, 0x8ff03dcd, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x120, 0x0, 0x44339624, 0x8ff03dcd, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x140, 0x1, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0xa79df285, 0x3952620e, 0x1, 0x0
+  .word 0x148, 0x1, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x178, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x1, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x100, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x108, 0x1, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x110, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0x118, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x120, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x160, 0x3, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x148, 0x2, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0xfffffffd, 0x0, 0x1, 0x1
+  .word 0x138, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x2, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0xc0538fd1, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0xc0538fd1, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x1, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0xc0538fd2, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x1, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0xc0538fd1, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0xc0538fd1, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x140, 0x1, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x0, 0x0, 0x9b8b2df6, 0x3ff44413, 0x1, 0x0
+  .word 0x170, 0x2, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x130, 0x3, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0xf8, 0x2, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x0, 0x0, 0x3fcd5a95, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x0, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x0, 0x0, 0x3fcd5a95, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x0, 0x0, 0x3fcd5a95, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x1, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x0, 0x0, 0x3fcd5a96, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x3, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x0, 0x0, 0x3fcd5a96, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0xab9e1942, 0x3ff9ab52, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x128, 0x0, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x0, 0xf48cb05f, 0x5ce0190c, 0x1, 0x0
+  .word 0xe8, 0x0, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x0, 0x7fffffff, 0x0, 0x10, 0x1
+  .word 0xf0, 0x2, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x10, 0x1
+  .word 0xf8, 0x2, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x100, 0x2, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x108, 0x0, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x110, 0x1, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x118, 0x2, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x120, 0x0, 0x21a015d3, 0x79d03241, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x158, 0x0, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x180, 0x0, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0xfffffff9, 0x0, 0x1, 0x1
+  .word 0x178, 0x0, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x2, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0xc0c41bc2, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x0, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0xc0c41bc1, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x1, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0xc0c41bc2, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x2, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0xc0c41bc1, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0xc0c41bc2, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0x39c96231, 0xc0188378, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x160, 0x0, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x148, 0x0, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x138, 0x2, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x3, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x100, 0x3, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x108, 0x0, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x110, 0x1, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x118, 0x2, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x120, 0x0, 0x15a3b9c1, 0xa1871177, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0xe0, 0x3, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x168, 0x0, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x178, 0x3, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x2, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0xbad3085c, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x3, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0xbad3085c, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0xbad3085d, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x1, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0xbad3085c, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0xbad3085d, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x160, 0x3, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x168, 0x0, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x150, 0x1, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x3, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0xb733a6fa, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0xb733a6fa, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0xb733a6fb, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x0, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0xb733a6fa, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x0, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0xb733a6fa, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0x4e55b2be, 0xbee674df, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x128, 0x2, 0x53645c31, 0xbf840227, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x170, 0x1, 0x53645c31, 0xbf840227, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x178, 0x0, 0x53645c31, 0xbf840227, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x1, 0x53645c31, 0xbf840227, 0x0, 0x0, 0x0, 0x0, 0xbc20113b, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x0, 0x53645c31, 0xbf840227, 0x0, 0x0, 0x0, 0x0, 0xbc20113a, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0x53645c31, 0xbf840227, 0x0, 0x0, 0x0, 0x0, 0xbc20113b, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x2, 0x53645c31, 0xbf840227, 0x0, 0x0, 0x0, 0x0, 0xbc20113a, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0x53645c31, 0xbf840227, 0x0, 0x0, 0x0, 0x0, 0xbc20113b, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0x53645c31, 0xbf840227, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x158, 0x0, 0xbe3c3ee2, 0x93091061, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x168, 0x2, 0xbe3c3ee2, 0x93091061, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf0, 0x1, 0xbe3c3ee2, 0x93091061, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0xf8, 0x1, 0xbe3c3ee2, 0x93091061, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x100, 0x3, 0xbe3c3ee2, 0x93091061, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x108, 0x3, 0xbe3c3ee2, 0x93091061, 0x0, 0x0, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x110, 0x1, 0xbe3c3ee2, 0x93091061, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x118, 0x1, 0xbe3c3ee2, 0x93091061, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x120, 0x0, 0xbe3c3ee2, 0x93091061, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x158, 0x2, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x168, 0x2, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x10, 0x1
+  .word 0x150, 0x2, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x3, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x100, 0x2, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x108, 0x3, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x110, 0x1, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x118, 0x1, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x120, 0x0, 0x5765ce15, 0xdfc944f9, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0xe0, 0x3, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x0, 0x0, 0x14db0a29, 0x4f7f67d1, 0x1, 0x0
+  .word 0x170, 0x1, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x0, 0x0, 0x7fffffff, 0x0, 0x10, 0x1
+  .word 0x150, 0x2, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x10, 0x1
+  .word 0xf8, 0x3, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x100, 0x3, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x108, 0x3, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x110, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x118, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x120, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x158, 0x0, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x658e79be, 0x40b9ec75, 0x1, 0x0
+  .word 0x170, 0x3, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x2a00956, 0x0, 0x1, 0x1
+  .word 0x130, 0x0, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x2a00956, 0x0, 0x1, 0x1
+  .word 0xf8, 0x3, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x4c280256, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x0, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x4c280255, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x4c280255, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x0, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x4c280256, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x3, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x4c280256, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0xb3f743a0, 0x4185004a, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1
+  .word 0x158, 0x1, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x170, 0x2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0xffef6682, 0x0, 0x1, 0x1
+  .word 0x138, 0x2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0xf8, 0x1, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0xc984cbf1, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0xc984cbf0, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0xc984cbf1, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x1, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0xc984cbf0, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x1, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0xc984cbf0, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x0, 0x16f25dbb, 0xc130997e, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1
+  .word 0x188, 0x1, 0x0, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x188, 0x2, 0x80000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x188, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x188, 0x2, 0xbf800000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x188, 0x3, 0x7f800000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x188, 0x0, 0xff800000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x188, 0x2, 0x7fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x188, 0x0, 0x7f800001, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x188, 0x1, 0x1, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36a00000, 0x0, 0x0
+  .word 0x188, 0x0, 0x7f7fffff, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xe0000000, 0x47efffff, 0x0, 0x0
+  .word 0x188, 0x2, 0x800000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38100000, 0x0, 0x0
+  .word 0x188, 0x1, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff80000, 0x0, 0x0
+  .word 0x188, 0x1, 0xbf4501d5, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xa0000000, 0xbfe8a03a, 0x0, 0x0
+  .word 0x188, 0x0, 0xbfb9d5f9, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x20000000, 0xbff73abf, 0x0, 0x0
+  .word 0x188, 0x1, 0x3dc6afdc, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x3fb8d5fb, 0x0, 0x0
+  .word 0x188, 0x3, 0xb20dd2eb, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x60000000, 0xbe41ba5d, 0x0, 0x0
+  .word 0x188, 0x2, 0xd7e12e3f, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xe0000000, 0xc2fc25c7, 0x0, 0x0
+  .word 0x188, 0x0, 0xb19162e7, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xe0000000, 0xbe322c5c, 0x0, 0x0
+  .word 0x188, 0x3, 0x4dac896e, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xc0000000, 0x41b5912d, 0x0, 0x0
+  .word 0x188, 0x2, 0xca2791dd, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xa0000000, 0xc144f23b, 0x0, 0x0
+  .word 0x188, 0x3, 0x408f0194, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x4011e032, 0x0, 0x0
+  .word 0x188, 0x0, 0x70d75574, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x461aeaae, 0x0, 0x0
+  .word 0x188, 0x0, 0x59653c0d, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xa0000000, 0x432ca781, 0x0, 0x0
+  .word 0x188, 0x3, 0xba664ed7, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xe0000000, 0xbf4cc9da, 0x0, 0x0
+  .word 0x188, 0x1, 0x3c22ff14, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x3f845fe2, 0x0, 0x0
+  .word 0x188, 0x2, 0x29e0ca6, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xc0000000, 0x3853c194, 0x0, 0x0
+  .word 0x188, 0x3, 0xb4e038f1, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x20000000, 0xbe9c071e, 0x0, 0x0
+  .word 0x188, 0x1, 0x3e7e52ee, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xc0000000, 0x3fcfca5d, 0x0, 0x0
+  .word 0x188, 0x1, 0xb9d76981, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x20000000, 0xbf3aed30, 0x0, 0x0
+  .word 0x188, 0x3, 0x3183ea14, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x3e307d42, 0x0, 0x0
+  .word 0x188, 0x1, 0xbac66cb2, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x40000000, 0xbf58cd96, 0x0, 0x0
+  .word 0x188, 0x1, 0x12a28e37, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xe0000000, 0x3a5451c6, 0x0, 0x0
+  .word 0x190, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x198, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x190, 0x3, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x198, 0x3, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x190, 0x0, 0x7fffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffc00000, 0x41dfffff, 0x0, 0x0
+  .word 0x198, 0x2, 0x7fffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffc00000, 0x41dfffff, 0x0, 0x0
+  .word 0x190, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc1e00000, 0x0, 0x0
+  .word 0x198, 0x3, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x41e00000, 0x0, 0x0
+  .word 0x190, 0x2, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x198, 0x0, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffe00000, 0x41efffff, 0x0, 0x0
+  .word 0x190, 0x2, 0x8edf530a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d800000, 0xc1dc482b, 0x0, 0x0
+  .word 0x198, 0x1, 0x8edf530a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x61400000, 0x41e1dbea, 0x0, 0x0
+  .word 0x190, 0x3, 0xe7ef682d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd3000000, 0xc1b81097, 0x0, 0x0
+  .word 0x198, 0x3, 0xe7ef682d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a00000, 0x41ecfded, 0x0, 0x0
+  .word 0x190, 0x2, 0xb4688188, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e000000, 0xc1d2e5df, 0x0, 0x0
+  .word 0x198, 0x0, 0xb4688188, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31000000, 0x41e68d10, 0x0, 0x0
+  .word 0x190, 0x1, 0x5c78dbc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf1400000, 0x41d71e36, 0x0, 0x0
+  .word 0x198, 0x2, 0x5c78dbc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf1400000, 0x41d71e36, 0x0, 0x0
+  .word 0x190, 0x1, 0x7ee038f7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3dc00000, 0x41dfb80e, 0x0, 0x0
+  .word 0x198, 0x2, 0x7ee038f7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3dc00000, 0x41dfb80e, 0x0, 0x0
+  .word 0x190, 0x0, 0x48336162, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58800000, 0x41d20cd8, 0x0, 0x0
+  .word 0x198, 0x3, 0x48336162, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58800000, 0x41d20cd8, 0x0, 0x0
+  .word 0x190, 0x0, 0x71200614, 0x0, 0x0, 0x0, 0x0, 0x0, 0x85000000, 0x41dc4801, 0x0, 0x0
+  .word 0x198, 0x2, 0x71200614, 0x0, 0x0, 0x0, 0x0, 0x0, 0x85000000, 0x41dc4801, 0x0, 0x0
+  .word 0x190, 0x1, 0xed5ffddf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21000000, 0xc1b2a002, 0x0, 0x0
+  .word 0x198, 0x0, 0xed5ffddf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbbe00000, 0x41edabff, 0x0, 0x0
+  .word 0x190, 0x2, 0x4fe0f537, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dc00000, 0x41d3f83d, 0x0, 0x0
+  .word 0x198, 0x2, 0x4fe0f537, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dc00000, 0x41d3f83d, 0x0, 0x0
+  .word 0x190, 0x3, 0xc8db9523, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e800000, 0xc1cb9235, 0x0, 0x0
+  .word 0x198, 0x2, 0xc8db9523, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa4600000, 0x41e91b72, 0x0, 0x0
+  .word 0x190, 0x0, 0x4b91ed16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x45800000, 0x41d2e47b, 0x0, 0x0
+  .word 0x198, 0x1, 0x4b91ed16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x45800000, 0x41d2e47b, 0x0, 0x0
+  .word 0x190, 0x0, 0xdb9b98c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa0000000, 0xc1c23233, 0x0, 0x0
+  .word 0x198, 0x2, 0xdb9b98c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18000000, 0x41eb7373, 0x0, 0x0
+  .word 0x190, 0x0, 0x34ee954c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa6000000, 0x41ca774a, 0x0, 0x0
+  .word 0x198, 0x2, 0x34ee954c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa6000000, 0x41ca774a, 0x0, 0x0
+  .word 0x190, 0x2, 0xeabdb4bc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44000000, 0xc1b5424b, 0x0, 0x0
+  .word 0x198, 0x2, 0xeabdb4bc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x97800000, 0x41ed57b6, 0x0, 0x0
+  .word 0x190, 0x2, 0x9228596, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c000000, 0x41a2450b, 0x0, 0x0
+  .word 0x198, 0x2, 0x9228596, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c000000, 0x41a2450b, 0x0, 0x0
+  .word 0x190, 0x0, 0x3f2e7f6a, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb5000000, 0x41cf973f, 0x0, 0x0
+  .word 0x198, 0x0, 0x3f2e7f6a, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb5000000, 0x41cf973f, 0x0, 0x0
+  .word 0x190, 0x1, 0x430e43e1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8400000, 0x41d0c390, 0x0, 0x0
+  .word 0x198, 0x1, 0x430e43e1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8400000, 0x41d0c390, 0x0, 0x0
+  .word 0x190, 0x0, 0x22fc4b1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e000000, 0x41c17e25, 0x0, 0x0
+  .word 0x198, 0x3, 0x22fc4b1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e000000, 0x41c17e25, 0x0, 0x0
+  .word 0x190, 0x0, 0xab98f309, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3dc00000, 0xc1d519c3, 0x0, 0x0
+  .word 0x198, 0x3, 0xab98f309, 0x0, 0x0, 0x0, 0x0, 0x0, 0x61200000, 0x41e5731e, 0x0, 0x0
+  .word 0x190, 0x1, 0x941454c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x98000000, 0x41a2828a, 0x0, 0x0
+  .word 0x198, 0x2, 0x941454c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x98000000, 0x41a2828a, 0x0, 0x0
+  .word 0x1a0, 0x2, 0x1, 0x3ff00000, 0x1, 0x3ff00000, 0x2, 0xbff00000, 0x0, 0x39700000, 0x0, 0x0
+  .word 0x1a8, 0x2, 0x1, 0x3ff00000, 0x1, 0x3ff00000, 0x2, 0xbff00000, 0x3, 0x40000000, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x1, 0x3ff00000, 0x1, 0x3ff00000, 0x2, 0xbff00000, 0x2, 0xc0000000, 0x1, 0x0
+  .word 0x1b8, 0x2, 0x1, 0x3ff00000, 0x1, 0x3ff00000, 0x2, 0xbff00000, 0x0, 0xb9700000, 0x0, 0x0
+  .word 0x1a0, 0x0, 0x0, 0x7fe00000, 0x0, 0x40000000, 0xffffffff, 0xffefffff, 0x0, 0x7ca00000, 0x0, 0x0
+  .word 0x1a8, 0x0, 0x0, 0x7fe00000, 0x0, 0x40000000, 0xffffffff, 0xffefffff, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x1b0, 0x0, 0x0, 0x7fe00000, 0x0, 0x40000000, 0xffffffff, 0xffefffff, 0xffffffff, 0xffefffff, 0x5, 0x0
+  .word 0x1b8, 0x0, 0x0, 0x7fe00000, 0x0, 0x40000000, 0xffffffff, 0xffefffff, 0x0, 0xfca00000, 0x0, 0x0
+  .word 0x1c0, 0x0, 0x0, 0x20000000, 0x0, 0x20000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x1, 0x0
+  .word 0x1c8, 0x0, 0x0, 0x20000000, 0x0, 0x20000000, 0x0, 0x3ff00000, 0xffffffff, 0xbfefffff, 0x1, 0x0
+  .word 0x1d0, 0x0, 0x0, 0x20000000, 0x0, 0x20000000, 0x0, 0x3ff00000, 0xffffffff, 0x3fefffff, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x0, 0x20000000, 0x0, 0x20000000, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x1, 0x0
+  .word 0x1e0, 0x1, 0x1, 0x3ff00000, 0x1, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1e8, 0x1, 0x1, 0x3ff00000, 0x1, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1f0, 0x1, 0x1, 0x3ff00000, 0x1, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1f8, 0x1, 0x1, 0x3ff00000, 0x1, 0x3ff00000, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x200, 0x1, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x208, 0x1, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x210, 0x1, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x218, 0x1, 0x0, 0x7ff00000, 0x0, 0x0, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x1c0, 0x3, 0x277ebc9e, 0xc00a71fa, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1c8, 0x3, 0x277ebc9e, 0xc00a71fa, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1d0, 0x3, 0x277ebc9e, 0xc00a71fa, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1d8, 0x3, 0x277ebc9e, 0xc00a71fa, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x200, 0x1, 0x0, 0x7ff80000, 0x53645c31, 0xbf840227, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x208, 0x1, 0x0, 0x7ff80000, 0x53645c31, 0xbf840227, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x210, 0x1, 0x0, 0x7ff80000, 0x53645c31, 0xbf840227, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x218, 0x1, 0x0, 0x7ff80000, 0x53645c31, 0xbf840227, 0x277ebc9e, 0xc00a71fa, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x220, 0x0, 0x277ebc9e, 0xc00a71fa, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x100000, 0xb80f2d57, 0x41c154f7, 0x1, 0x0
+  .word 0x228, 0x0, 0x277ebc9e, 0xc00a71fa, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x100000, 0xb80f2d57, 0x41c154f7, 0x1, 0x0
+  .word 0x230, 0x0, 0x277ebc9e, 0xc00a71fa, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x100000, 0xb80f2d58, 0xc1c154f7, 0x1, 0x0
+  .word 0x238, 0x0, 0x277ebc9e, 0xc00a71fa, 0x11d1fd36, 0xc1a4f8f2, 0x0, 0x100000, 0xb80f2d58, 0xc1c154f7, 0x1, 0x0
+  .word 0x1e0, 0x1, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x1e8, 0x1, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x1f0, 0x1, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x1f8, 0x1, 0x0, 0x100000, 0xffffffff, 0x7fefffff, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x1a0, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0xc2b3cb62, 0xbe641002, 0x11d1fd36, 0xc1a4f8f2, 0x4abe7a2, 0xc1a4f8f2, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0xc2b3cb62, 0xbe641002, 0x11d1fd36, 0xc1a4f8f2, 0x1ef812ca, 0x41a4f8f2, 0x1, 0x0
+  .word 0x1b0, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0xc2b3cb62, 0xbe641002, 0x11d1fd36, 0xc1a4f8f2, 0x1ef812c9, 0xc1a4f8f2, 0x1, 0x0
+  .word 0x1b8, 0x0, 0x11d1fd36, 0xc1a4f8f2, 0xc2b3cb62, 0xbe641002, 0x11d1fd36, 0xc1a4f8f2, 0x4abe7a3, 0x41a4f8f2, 0x1, 0x0
+  .word 0x200, 0x3, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x341123c, 0xc1c70fe2, 0x341123c, 0xc1c70fe2, 0x0, 0x0
+  .word 0x208, 0x3, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x341123c, 0xc1c70fe2, 0x341123c, 0x41c70fe2, 0x0, 0x0
+  .word 0x210, 0x3, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x341123c, 0xc1c70fe2, 0x341123c, 0xc1c70fe2, 0x0, 0x0
+  .word 0x218, 0x3, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x341123c, 0xc1c70fe2, 0x341123c, 0x41c70fe2, 0x0, 0x0
+  .word 0x1a0, 0x2, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x1a8, 0x2, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x1b0, 0x2, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x1b8, 0x2, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x0, 0x80000000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x220, 0x1, 0xc2b3cb62, 0xbe641002, 0xb3f743a0, 0x4185004a, 0xd6fd1d9b, 0x9530fcd9, 0x4b41ea49, 0xbffa5561, 0x1, 0x0
+  .word 0x228, 0x1, 0xc2b3cb62, 0xbe641002, 0xb3f743a0, 0x4185004a, 0xd6fd1d9b, 0x9530fcd9, 0x4b41ea49, 0xbffa5561, 0x1, 0x0
+  .word 0x230, 0x1, 0xc2b3cb62, 0xbe641002, 0xb3f743a0, 0x4185004a, 0xd6fd1d9b, 0x9530fcd9, 0x4b41ea48, 0x3ffa5561, 0x1, 0x0
+  .word 0x238, 0x1, 0xc2b3cb62, 0xbe641002, 0xb3f743a0, 0x4185004a, 0xd6fd1d9b, 0x9530fcd9, 0x4b41ea48, 0x3ffa5561, 0x1, 0x0
+  .word 0x1c0, 0x3, 0x39c96231, 0xc0188378, 0x1, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x7dc67e9e, 0xbebbd38e, 0x1, 0x0
+  .word 0x1c8, 0x3, 0x39c96231, 0xc0188378, 0x1, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x7dc67e9d, 0x3ebbd38e, 0x1, 0x0
+  .word 0x1d0, 0x3, 0x39c96231, 0xc0188378, 0x1, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x7dc67e9d, 0xbebbd38e, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x39c96231, 0xc0188378, 0x1, 0x0, 0x7dc67e9e, 0xbebbd38e, 0x7dc67e9e, 0x3ebbd38e, 0x1, 0x0
+  .word 0x200, 0x3, 0x0, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x208, 0x3, 0x0, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x210, 0x3, 0x0, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x218, 0x3, 0x0, 0x0, 0xecb61cb7, 0x32b51ef9, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x220, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0x4e55b2be, 0xbee674df, 0x285f0fca, 0xae635d5f, 0x67ddb7dc, 0x409d6f7e, 0x1, 0x0
+  .word 0x228, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0x4e55b2be, 0xbee674df, 0x285f0fca, 0xae635d5f, 0x67ddb7dc, 0x409d6f7e, 0x1, 0x0
+  .word 0x230, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0x4e55b2be, 0xbee674df, 0x285f0fca, 0xae635d5f, 0x67ddb7dd, 0xc09d6f7e, 0x1, 0x0
+  .word 0x238, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0x4e55b2be, 0xbee674df, 0x285f0fca, 0xae635d5f, 0x67ddb7dd, 0xc09d6f7e, 0x1, 0x0
+  .word 0x1a0, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x80000000, 0xce6f291a, 0xb4e16c74, 0xce6f291a, 0xb4e16c74, 0x0, 0x0
+  .word 0x1a8, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x80000000, 0xce6f291a, 0xb4e16c74, 0xce6f291a, 0x34e16c74, 0x0, 0x0
+  .word 0x1b0, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x80000000, 0xce6f291a, 0xb4e16c74, 0xce6f291a, 0xb4e16c74, 0x0, 0x0
+  .word 0x1b8, 0x0, 0xb4b4e566, 0xc1fb0cf7, 0x0, 0x80000000, 0xce6f291a, 0xb4e16c74, 0xce6f291a, 0x34e16c74, 0x0, 0x0
+  .word 0x1a0, 0x0, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x1a8, 0x0, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x1b0, 0x0, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x1b8, 0x0, 0x0, 0x7ff80000, 0x1, 0x7ff00000, 0x5765ce15, 0xdfc944f9, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x220, 0x1, 0x285f0fca, 0xae635d5f, 0xe7b4be3b, 0x5f0ed275, 0xa29af482, 0xc0f1d978, 0x4fed6182, 0xcd82a6e5, 0x1, 0x0
+  .word 0x228, 0x1, 0x285f0fca, 0xae635d5f, 0xe7b4be3b, 0x5f0ed275, 0xa29af482, 0xc0f1d978, 0x4fed6182, 0xcd82a6e5, 0x1, 0x0
+  .word 0x230, 0x1, 0x285f0fca, 0xae635d5f, 0xe7b4be3b, 0x5f0ed275, 0xa29af482, 0xc0f1d978, 0x4fed6181, 0x4d82a6e5, 0x1, 0x0
+  .word 0x238, 0x1, 0x285f0fca, 0xae635d5f, 0xe7b4be3b, 0x5f0ed275, 0xa29af482, 0xc0f1d978, 0x4fed6181, 0x4d82a6e5, 0x1, 0x0
+  .word 0x220, 0x1, 0xcc8fec8e, 0xc0b27268, 0x5765ce15, 0xdfc944f9, 0x0, 0x3ff00000, 0x7648ae72, 0x608d2249, 0x1, 0x0
+  .word 0x228, 0x1, 0xcc8fec8e, 0xc0b27268, 0x5765ce15, 0xdfc944f9, 0x0, 0x3ff00000, 0x7648ae72, 0x608d2249, 0x1, 0x0
+  .word 0x230, 0x1, 0xcc8fec8e, 0xc0b27268, 0x5765ce15, 0xdfc944f9, 0x0, 0x3ff00000, 0x7648ae73, 0xe08d2249, 0x1, 0x0
+  .word 0x238, 0x1, 0xcc8fec8e, 0xc0b27268, 0x5765ce15, 0xdfc944f9, 0x0, 0x3ff00000, 0x7648ae73, 0xe08d2249, 0x1, 0x0
+  .word 0x1e0, 0x1, 0x1, 0x0, 0x8ac89a22, 0xbf5a610b, 0xd6fd1d9b, 0x9530fcd9, 0xd6fd1d9b, 0x9530fcd9, 0x1, 0x0
+  .word 0x1e8, 0x1, 0x1, 0x0, 0x8ac89a22, 0xbf5a610b, 0xd6fd1d9b, 0x9530fcd9, 0xd6fd1d9b, 0x1530fcd9, 0x1, 0x0
+  .word 0x1f0, 0x1, 0x1, 0x0, 0x8ac89a22, 0xbf5a610b, 0xd6fd1d9b, 0x9530fcd9, 0xd6fd1d9b, 0x9530fcd9, 0x1, 0x0
+  .word 0x1f8, 0x1, 0x1, 0x0, 0x8ac89a22, 0xbf5a610b, 0xd6fd1d9b, 0x9530fcd9, 0xd6fd1d9b, 0x1530fcd9, 0x1, 0x0
+  .word 0x220, 0x3, 0x44339624, 0x8ff03dcd, 0x0, 0x100000, 0xfdf24503, 0x7d52a9c1, 0xfdf24502, 0x7d52a9c1, 0x1, 0x0
+  .word 0x228, 0x3, 0x44339624, 0x8ff03dcd, 0x0, 0x100000, 0xfdf24503, 0x7d52a9c1, 0xfdf24504, 0xfd52a9c1, 0x1, 0x0
+  .word 0x230, 0x3, 0x44339624, 0x8ff03dcd, 0x0, 0x100000, 0xfdf24503, 0x7d52a9c1, 0xfdf24503, 0x7d52a9c1, 0x1, 0x0
+  .word 0x238, 0x3, 0x44339624, 0x8ff03dcd, 0x0, 0x100000, 0xfdf24503, 0x7d52a9c1, 0xfdf24503, 0xfd52a9c1, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xa29af482, 0xc0f1d978, 0x5765ce15, 0xdfc944f9, 0x7dc67e9e, 0xbebbd38e, 0xe8aaa5cb, 0x60cc30be, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xa29af482, 0xc0f1d978, 0x5765ce15, 0xdfc944f9, 0x7dc67e9e, 0xbebbd38e, 0xe8aaa5cb, 0x60cc30be, 0x1, 0x0
+  .word 0x1b0, 0x1, 0xa29af482, 0xc0f1d978, 0x5765ce15, 0xdfc944f9, 0x7dc67e9e, 0xbebbd38e, 0xe8aaa5ca, 0xe0cc30be, 0x1, 0x0
+  .word 0x1b8, 0x1, 0xa29af482, 0xc0f1d978, 0x5765ce15, 0xdfc944f9, 0x7dc67e9e, 0xbebbd38e, 0xe8aaa5ca, 0xe0cc30be, 0x1, 0x0
+  .word 0x220, 0x0, 0xb3f743a0, 0x4185004a, 0xcc8fec8e, 0xc0b27268, 0xce6f291a, 0xb4e16c74, 0xad1ea12e, 0xc248367f, 0x1, 0x0
+  .word 0x228, 0x0, 0xb3f743a0, 0x4185004a, 0xcc8fec8e, 0xc0b27268, 0xce6f291a, 0xb4e16c74, 0xad1ea12e, 0xc248367f, 0x1, 0x0
+  .word 0x230, 0x0, 0xb3f743a0, 0x4185004a, 0xcc8fec8e, 0xc0b27268, 0xce6f291a, 0xb4e16c74, 0xad1ea12d, 0x4248367f, 0x1, 0x0
+  .word 0x238, 0x0, 0xb3f743a0, 0x4185004a, 0xcc8fec8e, 0xc0b27268, 0xce6f291a, 0xb4e16c74, 0xad1ea12d, 0x4248367f, 0x1, 0x0
+  .word 0x1c0, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1c8, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1d0, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1d8, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x0, 0x100000, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1e0, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x21a015d3, 0x79d03241, 0x21a015d3, 0x79d03241, 0x1, 0x0
+  .word 0x1e8, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x21a015d3, 0x79d03241, 0x21a015d3, 0xf9d03241, 0x1, 0x0
+  .word 0x1f0, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x21a015d3, 0x79d03241, 0x21a015d3, 0x79d03241, 0x1, 0x0
+  .word 0x1f8, 0x3, 0x11d1fd36, 0xc1a4f8f2, 0xecb4b274, 0x41a36b6e, 0x21a015d3, 0x79d03241, 0x21a015d3, 0xf9d03241, 0x1, 0x0
+  .word 0x1e0, 0x3, 0x7dc67e9e, 0xbebbd38e, 0xecb4b274, 0x41a36b6e, 0xfdf24503, 0x7d52a9c1, 0xfdf24503, 0x7d52a9c1, 0x1, 0x0
+  .word 0x1e8, 0x3, 0x7dc67e9e, 0xbebbd38e, 0xecb4b274, 0x41a36b6e, 0xfdf24503, 0x7d52a9c1, 0xfdf24503, 0xfd52a9c1, 0x1, 0x0
+  .word 0x1f0, 0x3, 0x7dc67e9e, 0xbebbd38e, 0xecb4b274, 0x41a36b6e, 0xfdf24503, 0x7d52a9c1, 0xfdf24503, 0x7d52a9c1, 0x1, 0x0
+  .word 0x1f8, 0x3, 0x7dc67e9e, 0xbebbd38e, 0xecb4b274, 0x41a36b6e, 0xfdf24503, 0x7d52a9c1, 0xfdf24503, 0xfd52a9c1, 0x1, 0x0
+  .word 0x220, 0x1, 0x7dc67e9e, 0xbebbd38e, 0xb3f743a0, 0x4185004a, 0x16f25dbb, 0xc130997e, 0x234c3ec4, 0xc13099c7, 0x1, 0x0
+  .word 0x228, 0x1, 0x7dc67e9e, 0xbebbd38e, 0xb3f743a0, 0x4185004a, 0x16f25dbb, 0xc130997e, 0xa987cb2, 0x41309935, 0x1, 0x0
+  .word 0x230, 0x1, 0x7dc67e9e, 0xbebbd38e, 0xb3f743a0, 0x4185004a, 0x16f25dbb, 0xc130997e, 0xa987cb3, 0xc1309935, 0x1, 0x0
+  .word 0x238, 0x1, 0x7dc67e9e, 0xbebbd38e, 0xb3f743a0, 0x4185004a, 0x16f25dbb, 0xc130997e, 0x234c3ec3, 0x413099c7, 0x1, 0x0
+  .word 0x220, 0x1, 0xae8de429, 0x4dfa5465, 0x4e55b2be, 0xbee674df, 0x285f0fca, 0xae635d5f, 0x953322be, 0xccf27a2f, 0x1, 0x0
+  .word 0x228, 0x1, 0xae8de429, 0x4dfa5465, 0x4e55b2be, 0xbee674df, 0x285f0fca, 0xae635d5f, 0x953322be, 0xccf27a2f, 0x1, 0x0
+  .word 0x230, 0x1, 0xae8de429, 0x4dfa5465, 0x4e55b2be, 0xbee674df, 0x285f0fca, 0xae635d5f, 0x953322bd, 0x4cf27a2f, 0x1, 0x0
+  .word 0x238, 0x1, 0xae8de429, 0x4dfa5465, 0x4e55b2be, 0xbee674df, 0x285f0fca, 0xae635d5f, 0x953322bd, 0x4cf27a2f, 0x1, 0x0
+  .word 0x200, 0x0, 0x0, 0x80000000, 0x5765ce15, 0xdfc944f9, 0x8ac89a22, 0xbf5a610b, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0
+  .word 0x208, 0x0, 0x0, 0x80000000, 0x5765ce15, 0xdfc944f9, 0x8ac89a22, 0xbf5a610b, 0x8ac89a22, 0x3f5a610b, 0x0, 0x0
+  .word 0x210, 0x0, 0x0, 0x80000000, 0x5765ce15, 0xdfc944f9, 0x8ac89a22, 0xbf5a610b, 0x8ac89a22, 0xbf5a610b, 0x0, 0x0
+  .word 0x218, 0x0, 0x0, 0x80000000, 0x5765ce15, 0xdfc944f9, 0x8ac89a22, 0xbf5a610b, 0x8ac89a22, 0x3f5a610b, 0x0, 0x0
+  .word 0x1e0, 0x3, 0xecb4b274, 0x41a36b6e, 0xae8de429, 0x4dfa5465, 0x285f0fca, 0xae635d5f, 0xb1091ad6, 0x4faff503, 0x1, 0x0
+  .word 0x1e8, 0x3, 0xecb4b274, 0x41a36b6e, 0xae8de429, 0x4dfa5465, 0x285f0fca, 0xae635d5f, 0xb1091ad6, 0x4faff503, 0x1, 0x0
+  .word 0x1f0, 0x3, 0xecb4b274, 0x41a36b6e, 0xae8de429, 0x4dfa5465, 0x285f0fca, 0xae635d5f, 0xb1091ad6, 0xcfaff503, 0x1, 0x0
+  .word 0x1f8, 0x3, 0xecb4b274, 0x41a36b6e, 0xae8de429, 0x4dfa5465, 0x285f0fca, 0xae635d5f, 0xb1091ad6, 0xcfaff503, 0x1, 0x0
+  .word 0x1a0, 0x2, 0x15a3b9c1, 0xa1871177, 0x0, 0x3ff00000, 0x5765ce15, 0xdfc944f9, 0x5765ce15, 0xdfc944f9, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x15a3b9c1, 0xa1871177, 0x0, 0x3ff00000, 0x5765ce15, 0xdfc944f9, 0x5765ce15, 0x5fc944f9, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x15a3b9c1, 0xa1871177, 0x0, 0x3ff00000, 0x5765ce15, 0xdfc944f9, 0x5765ce14, 0xdfc944f9, 0x1, 0x0
+  .word 0x1b8, 0x2, 0x15a3b9c1, 0xa1871177, 0x0, 0x3ff00000, 0x5765ce15, 0xdfc944f9, 0x5765ce16, 0x5fc944f9, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x0, 0x3ff80000, 0xce6f291a, 0xb4e16c74, 0xc2b3cb62, 0xbe641002, 0xc2b3cb62, 0xbe641002, 0x1, 0x0
+  .word 0x1e8, 0x2, 0x0, 0x3ff80000, 0xce6f291a, 0xb4e16c74, 0xc2b3cb62, 0xbe641002, 0xc2b3cb62, 0x3e641002, 0x1, 0x0
+  .word 0x1f0, 0x2, 0x0, 0x3ff80000, 0xce6f291a, 0xb4e16c74, 0xc2b3cb62, 0xbe641002, 0xc2b3cb62, 0xbe641002, 0x1, 0x0
+  .word 0x1f8, 0x2, 0x0, 0x3ff80000, 0xce6f291a, 0xb4e16c74, 0xc2b3cb62, 0xbe641002, 0xc2b3cb62, 0x3e641002, 0x1, 0x0
+  .word 0x1e0, 0x3, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0xe7b4be3b, 0x5f0ed275, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0
+  .word 0x1e8, 0x3, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0xe7b4be3b, 0x5f0ed275, 0xe7b4be3b, 0xdf0ed275, 0x0, 0x0
+  .word 0x1f0, 0x3, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0xe7b4be3b, 0x5f0ed275, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x0
+  .word 0x1f8, 0x3, 0xcc8fec8e, 0xc0b27268, 0x0, 0x80000000, 0xe7b4be3b, 0x5f0ed275, 0xe7b4be3b, 0xdf0ed275, 0x0, 0x0
+  .word 0x1c0, 0x3, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x100000, 0x0, 0x0
+  .word 0x1c8, 0x3, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x80100000, 0x0, 0x0
+  .word 0x1d0, 0x3, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x100000, 0x0, 0x0
+  .word 0x1d8, 0x3, 0x277ebc9e, 0xc00a71fa, 0x0, 0x0, 0x0, 0x100000, 0x0, 0x80100000, 0x0, 0x0
+  .word 0x1e0, 0x1, 0x44339624, 0x8ff03dcd, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0xab9e1942, 0x3ff9ab52, 0x1, 0x0
+  .word 0x1e8, 0x1, 0x44339624, 0x8ff03dcd, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0xab9e1942, 0xbff9ab52, 0x1, 0x0
+  .word 0x1f0, 0x1, 0x44339624, 0x8ff03dcd, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0xab9e1942, 0x3ff9ab52, 0x1, 0x0
+  .word 0x1f8, 0x1, 0x44339624, 0x8ff03dcd, 0x53645c31, 0xbf840227, 0xab9e1942, 0x3ff9ab52, 0xab9e1942, 0xbff9ab52, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x5765ce15, 0xdfc944f9, 0x44339624, 0x8ff03dcd, 0xfdf24503, 0x7d52a9c1, 0xfdf24504, 0x7d52a9c1, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x5765ce15, 0xdfc944f9, 0x44339624, 0x8ff03dcd, 0xfdf24503, 0x7d52a9c1, 0xfdf24502, 0xfd52a9c1, 0x1, 0x0
+  .word 0x1b0, 0x1, 0x5765ce15, 0xdfc944f9, 0x44339624, 0x8ff03dcd, 0xfdf24503, 0x7d52a9c1, 0xfdf24503, 0x7d52a9c1, 0x1, 0x0
+  .word 0x1b8, 0x1, 0x5765ce15, 0xdfc944f9, 0x44339624, 0x8ff03dcd, 0xfdf24503, 0x7d52a9c1, 0xfdf24503, 0xfd52a9c1, 0x1, 0x0
+  .word 0x1c0, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x21a015d3, 0x79d03241, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x1c8, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x21a015d3, 0x79d03241, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x1d0, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x21a015d3, 0x79d03241, 0x0, 0x7ff00000, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x1d8, 0x2, 0xd6fd1d9b, 0x9530fcd9, 0x21a015d3, 0x79d03241, 0x0, 0x7ff00000, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x200, 0x2, 0x7dc67e9e, 0xbebbd38e, 0x8ac6285a, 0x3f4a623b, 0x0, 0x100000, 0x714dd541, 0xbe16f14f, 0x1, 0x0
+  .word 0x208, 0x2, 0x7dc67e9e, 0xbebbd38e, 0x8ac6285a, 0x3f4a623b, 0x0, 0x100000, 0x714dd541, 0xbe16f14f, 0x1, 0x0
+  .word 0x210, 0x2, 0x7dc67e9e, 0xbebbd38e, 0x8ac6285a, 0x3f4a623b, 0x0, 0x100000, 0x714dd540, 0x3e16f14f, 0x1, 0x0
+  .word 0x218, 0x2, 0x7dc67e9e, 0xbebbd38e, 0x8ac6285a, 0x3f4a623b, 0x0, 0x100000, 0x714dd540, 0x3e16f14f, 0x1, 0x0
+  .word 0x200, 0x0, 0xc2b3cb62, 0xbe641002, 0xb3f743a0, 0x4185004a, 0x21a015d3, 0x79d03241, 0x21a015d3, 0x79d03241, 0x1, 0x0
+  .word 0x208, 0x0, 0xc2b3cb62, 0xbe641002, 0xb3f743a0, 0x4185004a, 0x21a015d3, 0x79d03241, 0x21a015d3, 0xf9d03241, 0x1, 0x0
+  .word 0x210, 0x0, 0xc2b3cb62, 0xbe641002, 0xb3f743a0, 0x4185004a, 0x21a015d3, 0x79d03241, 0x21a015d3, 0x79d03241, 0x1, 0x0
+  .word 0x218, 0x0, 0xc2b3cb62, 0xbe641002, 0xb3f743a0, 0x4185004a, 0x21a015d3, 0x79d03241, 0x21a015d3, 0xf9d03241, 0x1, 0x0
+  .word 0x1c0, 0x2, 0x0, 0x7ff00000, 0x1, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x1c8, 0x2, 0x0, 0x7ff00000, 0x1, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x1d0, 0x2, 0x0, 0x7ff00000, 0x1, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x1d8, 0x2, 0x0, 0x7ff00000, 0x1, 0x0, 0xe7b4be3b, 0x5f0ed275, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x1a0, 0x0, 0xae8de429, 0x4dfa5465, 0x5765ce15, 0xdfc944f9, 0x11d1fd36, 0xc1a4f8f2, 0xf1123669, 0xedd4caaf, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xae8de429, 0x4dfa5465, 0x5765ce15, 0xdfc944f9, 0x11d1fd36, 0xc1a4f8f2, 0xf1123669, 0xedd4caaf, 0x1, 0x0
+  .word 0x1b0, 0x0, 0xae8de429, 0x4dfa5465, 0x5765ce15, 0xdfc944f9, 0x11d1fd36, 0xc1a4f8f2, 0xf112366a, 0x6dd4caaf, 0x1, 0x0
+  .word 0x1b8, 0x0, 0xae8de429, 0x4dfa5465, 0x5765ce15, 0xdfc944f9, 0x11d1fd36, 0xc1a4f8f2, 0xf112366a, 0x6dd4caaf, 0x1, 0x0
+  .word 0x200, 0x1, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x208, 0x1, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x0
+  .word 0x210, 0x1, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x218, 0x1, 0x0, 0x100000, 0x0, 0x7ff00000, 0x0, 0x100000, 0x0, 0xfff00000, 0x0, 0x0
+  .word 0x220, 0x1, 0x0, 0x3ff00000, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x228, 0x1, 0x0, 0x3ff00000, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x230, 0x1, 0x0, 0x3ff00000, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x238, 0x1, 0x0, 0x3ff00000, 0xe7b4be3b, 0x5f0ed275, 0x1, 0x7ff00000, 0x0, 0x7ff80000, 0x10, 0x0
+  .word 0x1e0, 0x3, 0x0, 0x100000, 0x53645c31, 0xbf840227, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1e8, 0x3, 0x0, 0x100000, 0x53645c31, 0xbf840227, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1f0, 0x3, 0x0, 0x100000, 0x53645c31, 0xbf840227, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x1f8, 0x3, 0x0, 0x100000, 0x53645c31, 0xbf840227, 0x0, 0x7ff80000, 0x0, 0x7ff80000, 0x0, 0x0
+  .word 0x240, 0x0, 0xffffffff, 0x7fefffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0, 0x1
+  .word 0x240, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1
+  .word 0x240, 0x0, 0x3f800000, 0xfffffffe, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0x0, 0x0, 0x1
+  .word 0x248, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x248, 0x0, 0x3f800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x248, 0x0, 0x7fc00001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7fc00001, 0xffffffff, 0x0, 0x0
+  .word 0x248, 0x0, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0xffffffff, 0x0, 0x0
+cases_end:
+
+msg_ok:    .asciz "fp double: ok\n"
+msg_fail:  .asciz "fp double: FAIL "
+msg_of:    .asciz " of "
+msg_case:  .asciz "case "
+msg_colon: .asciz ": "
+msg_space: .asciz " "
+msg_nl:    .asciz "\n"
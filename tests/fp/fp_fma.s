@@ -0,0 +1,1754 @@
+# fp_fma.s
+#
+#   Generated by fp_gen.py from the exact results of fpref.py, do not edit.
+#
+#   fused multiply adds, which must round once. Run with --no-host-ext
+#   to check the path taken on hosts without fma3.
+#
+#   Build:
+#     python3 fp_gen.py fma > fp_fma.s
+#     llvm-mc -triple=riscv32 -mattr=+m,+f,+d,-relax -filetype=obj \
+#       fp_fma.s -o fp_fma.o
+#     ld.lld -Ttext=0x10000 fp_fma.o -o fp_fma.elf
+
+  .equ CASE_SIZE,        48
+  .equ MAX_REPORT,       16
+  .equ NUM_END,          0x20200
+
+  .equ SYS_write,        64
+  .equ SYS_exit,         93
+
+  .text
+  .globl _start
+_start:
+  la s0, cases
+  la s1, cases_end
+  la s2, ops
+  li s3, 0                  # case number
+  li s4, 0                  # failures
+next:
+  bgeu s0, s1, done
+  # operands, the first also as an integer, and frm
+  fld fa0, 8(s0)
+  fld fa1, 16(s0)
+  fld fa2, 24(s0)
+  lw a0, 8(s0)
+  lw t0, 4(s0)
+  fsrm t0
+  # results which are not written show up as these
+  la t0, junk
+  fld fa3, 0(t0)
+  lw a2, 0(t0)
+  lw t0, 0(s0)
+  add t0, s2, t0
+  fsflags zero
+  jalr ra, t0
+  frflags a3
+  # the integer result, or all 64 bits of the float one
+  lw t0, 44(s0)
+  li a4, 0
+  bnez t0, 1f
+  la t0, result
+  fsd fa3, 0(t0)
+  lw a2, 0(t0)
+  lw a4, 4(t0)
+1:
+  lw t0, 32(s0)
+  bne a2, t0, 2f
+  lw t0, 36(s0)
+  bne a4, t0, 2f
+  lw t0, 40(s0)
+  beq a3, t0, 3f
+2:
+  jal ra, report
+3:
+  addi s0, s0, CASE_SIZE
+  addi s3, s3, 1
+  j next
+done:
+  bnez s4, fail
+  la a0, msg_ok
+  jal ra, print_str
+  li a0, 0
+  li a7, SYS_exit
+  ecall
+fail:
+  la a0, msg_fail
+  jal ra, print_str
+  mv a0, s4
+  jal ra, print_uint
+  la a0, msg_of
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_nl
+  jal ra, print_str
+  li a0, 1
+  li a7, SYS_exit
+  ecall
+
+# count a failure and write the first few as "case <n>: <result> <fflags>"
+report:
+  addi s4, s4, 1
+  li t0, MAX_REPORT
+  bgtu s4, t0, 1f
+  mv s5, ra
+  mv s6, a2
+  mv s7, a3
+  mv s8, a4
+  la a0, msg_case
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_colon
+  jal ra, print_str
+  mv a0, s8
+  jal ra, print_hex
+  mv a0, s6
+  jal ra, print_hex
+  la a0, msg_space
+  jal ra, print_str
+  mv a0, s7
+  jal ra, print_hex
+  la a0, msg_nl
+  jal ra, print_str
+  mv ra, s5
+1:
+  ret
+
+# write the string at a0 to stdout
+print_str:
+  mv a1, a0
+  mv a2, a0
+1:
+  lbu t0, 0(a2)
+  beqz t0, 2f
+  addi a2, a2, 1
+  j 1b
+2:
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout in decimal
+print_uint:
+  li a1, NUM_END
+  li t1, 10
+1:
+  remu t0, a0, t1
+  divu a0, a0, t1
+  addi t0, t0, '0'
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  bnez a0, 1b
+  li a2, NUM_END
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout as eight hex digits
+print_hex:
+  li a1, NUM_END
+  li t1, 8
+1:
+  andi t0, a0, 15
+  srli a0, a0, 4
+  addi t0, t0, '0'
+  li t2, '9'
+  bleu t0, t2, 2f
+  addi t0, t0, 'a' - '9' - 1
+2:
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  addi t1, t1, -1
+  bnez t1, 1b
+  li a2, 8
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+  .option push
+  .option norvc
+ops:
+  fmadd.s fa3, fa0, fa1, fa2, rne
+  ret
+  fmadd.s fa3, fa0, fa1, fa2, rtz
+  ret
+  fmadd.s fa3, fa0, fa1, fa2, rdn
+  ret
+  fmadd.s fa3, fa0, fa1, fa2, rup
+  ret
+  fmadd.s fa3, fa0, fa1, fa2
+  ret
+  fmsub.s fa3, fa0, fa1, fa2, rne
+  ret
+  fmsub.s fa3, fa0, fa1, fa2, rtz
+  ret
+  fmsub.s fa3, fa0, fa1, fa2, rdn
+  ret
+  fmsub.s fa3, fa0, fa1, fa2, rup
+  ret
+  fmsub.s fa3, fa0, fa1, fa2
+  ret
+  fnmsub.s fa3, fa0, fa1, fa2, rne
+  ret
+  fnmsub.s fa3, fa0, fa1, fa2, rtz
+  ret
+  fnmsub.s fa3, fa0, fa1, fa2, rdn
+  ret
+  fnmsub.s fa3, fa0, fa1, fa2, rup
+  ret
+  fnmsub.s fa3, fa0, fa1, fa2
+  ret
+  fnmadd.s fa3, fa0, fa1, fa2, rne
+  ret
+  fnmadd.s fa3, fa0, fa1, fa2, rtz
+  ret
+  fnmadd.s fa3, fa0, fa1, fa2, rdn
+  ret
+  fnmadd.s fa3, fa0, fa1, fa2, rup
+  ret
+  fnmadd.s fa3, fa0, fa1, fa2
+  ret
+  .option pop
+
+  .data
+  .p2align 3
+junk:      .word 0x89abcdef, 0x01234567
+result:    .word 0, 0
+# stub offset, frm, three operands, expected result, fflags, integer result
+cases:
+  .word 0x0, 0x3, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0xd3b2635e, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x0, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0xd3b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x3, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0xd3b2635e, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x0, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0xd3b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0xd3b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0xd3b2635e, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0xd3b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0xd3b2635e, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0xd3b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0xd3b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0x53b2635e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0x53b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0x53b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0x53b2635e, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0x53b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0x53b2635e, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x0, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0x53b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0x53b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x0, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0x53b2635e, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x1, 0x4e707eb3, 0xffffffff, 0xc4bde39d, 0xffffffff, 0x41af5ab0, 0xffffffff, 0x53b2635d, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x1, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x1, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x1, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x2, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x3, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x1, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x1, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x1, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x1, 0x795b929e, 0xffffffff, 0x496fb6d4, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x8, 0x2, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x10, 0x0, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x18, 0x1, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x20, 0x3, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x28, 0x3, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x73800000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x73800000, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x0, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x73800000, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x1, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x73800000, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x3, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x73800000, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x3, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xf3800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xf3800000, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x0, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xf3800000, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x1, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xf3800000, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x3, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xf3800000, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x3, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x80, 0x2, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x0, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x90, 0x1, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x98, 0x3, 0x7f000000, 0xffffffff, 0x40000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x0, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0x73ffffff, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0x73ffffff, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0x73ffffff, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x1, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0x73ffffff, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0x73ffffff, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x30, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x38, 0x0, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x40, 0x1, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x48, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x50, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x58, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x60, 0x0, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x68, 0x1, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x70, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x78, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0xf3ffffff, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0xf3ffffff, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0xf3ffffff, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x1, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0xf3ffffff, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x2, 0x7f7fffff, 0xffffffff, 0x3f800001, 0xffffffff, 0xff7fffff, 0xffffffff, 0xf3ffffff, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x1, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x3, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x0, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x0, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800001, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x0, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x0, 0x1c800000, 0xffffffff, 0x1c800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x1, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x400001, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x400001, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x400001, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x1, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x400001, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x400001, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x3fffff, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x0, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x3fffff, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x3fffff, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x1, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x3fffff, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x3, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x3fffff, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x803fffff, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x803fffff, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x3, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x803fffff, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x1, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x803fffff, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x3, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x803fffff, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x1, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x80400001, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x80400001, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x80400001, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x1, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x80400001, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x800000, 0xffffffff, 0x3f000000, 0xffffffff, 0x1, 0xffffffff, 0x80400001, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x8, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x10, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x18, 0x1, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0x20, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x28, 0x3, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0x30, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0x38, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0x40, 0x1, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x3, 0xffffffff, 0x3, 0x0
+  .word 0x48, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0x50, 0x3, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x80000002, 0xffffffff, 0x3, 0x0
+  .word 0x58, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x80000002, 0xffffffff, 0x3, 0x0
+  .word 0x60, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x80000003, 0xffffffff, 0x3, 0x0
+  .word 0x68, 0x1, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x80000002, 0xffffffff, 0x3, 0x0
+  .word 0x70, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x80000002, 0xffffffff, 0x3, 0x0
+  .word 0x78, 0x3, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x80, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x90, 0x1, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x98, 0x0, 0x3, 0xffffffff, 0x3f000000, 0xffffffff, 0x80000001, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x0, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x8, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x10, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x18, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x20, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x28, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x30, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x38, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x40, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x48, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x50, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x58, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x60, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x68, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x70, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x78, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x80, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x88, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x90, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x98, 0x1, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x0, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x0, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x0, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x0, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x0, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x3, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x0, 0x3f800001, 0xffffffff, 0x3f800001, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x1, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x8, 0x2, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x10, 0x0, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x18, 0x0, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x20, 0x1, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x28, 0x1, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x30, 0x2, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x38, 0x0, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x40, 0x0, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x48, 0x1, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x50, 0x1, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x58, 0x2, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x60, 0x0, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x68, 0x0, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x70, 0x1, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x78, 0x1, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x80, 0x2, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x88, 0x0, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x90, 0x0, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x98, 0x1, 0x7f800000, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x0, 0x3, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x8, 0x2, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x10, 0x0, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x18, 0x2, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x20, 0x3, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x28, 0x3, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x30, 0x2, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x38, 0x0, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x40, 0x2, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x48, 0x3, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x50, 0x3, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x58, 0x2, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x60, 0x0, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x68, 0x2, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x70, 0x3, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x78, 0x3, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x80, 0x2, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x88, 0x0, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x90, 0x2, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x98, 0x3, 0x0, 0xffffffff, 0xff800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x0, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0xb60b78bc, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0xb60b78bc, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x1, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0xb60b78bc, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0xb60b78bc, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0xb60b78bc, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0x41accbd9, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0x41accbd8, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0x41accbd8, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0x41accbd9, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0x41accbd8, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0xc1accbd9, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0xc1accbd8, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0xc1accbd9, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0xc1accbd8, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0xc1accbd8, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0x360b78bc, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0x360b78bc, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0x360b78bc, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0x360b78bc, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x1, 0x3f3d6898, 0xffffffff, 0x41698c16, 0xffffffff, 0xc12ccbda, 0xffffffff, 0x360b78bc, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0x339a2a2a, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0x339a2a29, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0x339a2a29, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x1, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0x339a2a2a, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0x339a2a29, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0x3f004223, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0x3f004223, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0x3f004223, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0x3f004224, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0x3f004223, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0xbf004223, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0xbf004223, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0xbf004224, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0xbf004223, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0xbf004223, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0xb39a2a2a, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0xb39a2a29, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0xb39a2a2a, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x1, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0xb39a2a29, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x1, 0x3eb0b047, 0xffffffff, 0x3f39d4a1, 0xffffffff, 0xbe804222, 0xffffffff, 0xb39a2a29, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0xe96d09e2, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0xe96d09e2, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0xe96d09e2, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0xe96d09e2, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x0, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0xe96d09e2, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0x75ae3211, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0x75ae3210, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0x75ae3210, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0x75ae3211, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0x75ae3211, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0xf5ae3211, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0xf5ae3210, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0xf5ae3211, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0xf5ae3210, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0xf5ae3211, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0x696d09e2, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0x696d09e2, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0x696d09e2, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0x696d09e2, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x0, 0x3ea584cf, 0xffffffff, 0x7606b5c1, 0xffffffff, 0xf52e3211, 0xffffffff, 0x696d09e2, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0xbb1cc047, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0xbb1cc047, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0xbb1cc048, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x0, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0xbb1cc047, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x3, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0xbb1cc047, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0x46a4b056, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0x46a4b055, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0x46a4b055, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0x46a4b056, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0x46a4b056, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0xc6a4b056, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0xc6a4b055, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0xc6a4b056, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0xc6a4b055, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0xc6a4b055, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0x3b1cc047, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0x3b1cc047, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0x3b1cc047, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x0, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0x3b1cc048, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x46604313, 0xffffffff, 0x3f3bfef1, 0xffffffff, 0xc624b057, 0xffffffff, 0x3b1cc048, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x1, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x80059fa6, 0xffffffff, 0x3, 0x0
+  .word 0x8, 0x0, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x80059fa5, 0xffffffff, 0x3, 0x0
+  .word 0x10, 0x3, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x80059fa6, 0xffffffff, 0x3, 0x0
+  .word 0x18, 0x1, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x80059fa5, 0xffffffff, 0x3, 0x0
+  .word 0x20, 0x0, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x80059fa6, 0xffffffff, 0x3, 0x0
+  .word 0x28, 0x1, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0xa030cb4, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0xa030cb4, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0xa030cb4, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0xa030cb5, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0xa030cb4, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x8a030cb4, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x8a030cb4, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x8a030cb5, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x8a030cb4, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x8a030cb4, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x59fa6, 0xffffffff, 0x3, 0x0
+  .word 0x80, 0x0, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x59fa5, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x3, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x59fa5, 0xffffffff, 0x3, 0x0
+  .word 0x90, 0x1, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x59fa6, 0xffffffff, 0x3, 0x0
+  .word 0x98, 0x0, 0x134bd5bf, 0xffffffff, 0x35a4966c, 0xffffffff, 0x89830cb5, 0xffffffff, 0x59fa6, 0xffffffff, 0x3, 0x0
+  .word 0x0, 0x3, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0x3e5fae00, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0x3e5fae00, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0x3e5fae00, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0x3e5fae00, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x2, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0x3e5fae00, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0xcc73ee7d, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0xcc73ee7c, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0xcc73ee7d, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0xcc73ee7c, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0xcc73ee7d, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0x4c73ee7d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0x4c73ee7c, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0x4c73ee7c, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0x4c73ee7d, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0x4c73ee7c, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0xbe5fae00, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0xbe5fae00, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0xbe5fae00, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0xbe5fae00, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x2, 0x4e939bfc, 0xffffffff, 0xbcd386b8, 0xffffffff, 0x4bf3ee7d, 0xffffffff, 0xbe5fae00, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0xa1d63500, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0xa1d63500, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0xa1d63500, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0xa1d63500, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x2, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0xa1d63500, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0x317169ed, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0x317169ec, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0x317169ec, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0x317169ed, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0x317169ec, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0xb17169ed, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0xb17169ec, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0xb17169ed, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0xb17169ec, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0xb17169ed, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0x21d63500, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0x21d63500, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0x21d63500, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0x21d63500, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x2, 0x35eba05a, 0xffffffff, 0x3a8324d7, 0xffffffff, 0xb0f169ed, 0xffffffff, 0x21d63500, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0x4b96f1ae, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0x4b96f1ae, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0x4b96f1ae, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0x4b96f1ae, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0x4b96f1ae, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0xd77ad8e4, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0xd77ad8e3, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0xd77ad8e4, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0xd77ad8e3, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0xd77ad8e4, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0x577ad8e4, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0x577ad8e3, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0x577ad8e3, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0x577ad8e4, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0x577ad8e3, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0xcb96f1ae, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x3, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0xcb96f1ae, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0xcb96f1ae, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0xcb96f1ae, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x2, 0x489164c3, 0xffffffff, 0xcddcd68c, 0xffffffff, 0x56fad8e5, 0xffffffff, 0xcb96f1ae, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0x2811dfda, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0x2811dfda, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0x2811dfda, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0x2811dfda, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0x2811dfda, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0xb4b617c9, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0xb4b617c8, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0xb4b617c9, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0xb4b617c8, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0xb4b617c9, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0x34b617c9, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0x34b617c8, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0x34b617c8, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0x34b617c9, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0x34b617c9, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0xa811dfda, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0xa811dfda, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0xa811dfda, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0xa811dfda, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x0, 0x2e681589, 0xffffffff, 0xc548db76, 0xffffffff, 0x343617c9, 0xffffffff, 0xa811dfda, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0xb70a317c, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0xb70a317c, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0xb70a317c, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x1, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0xb70a317c, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x2, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0xb70a317c, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0x43264be1, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0x43264be1, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0x43264be1, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0x43264be2, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0x43264be1, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0xc3264be1, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0xc3264be1, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0xc3264be2, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0xc3264be1, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0xc3264be2, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0x370a317c, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0x370a317c, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0x370a317c, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x1, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0x370a317c, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x2, 0x4e41a87c, 0xffffffff, 0x33dbd47e, 0xffffffff, 0xc2a64be2, 0xffffffff, 0x370a317c, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0xbc1a9512, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0xbc1a9511, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x3, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0xbc1a9512, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x0, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0xbc1a9511, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0xbc1a9512, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0x47c0d4e2, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0x47c0d4e1, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0x47c0d4e1, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0x47c0d4e2, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0x47c0d4e1, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0xc7c0d4e2, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0xc7c0d4e1, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0xc7c0d4e2, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0xc7c0d4e1, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0xc7c0d4e2, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0x3c1a9512, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0x3c1a9511, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0x3c1a9511, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x0, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0x3c1a9512, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x2, 0x3eebbef9, 0xffffffff, 0x47d1660a, 0xffffffff, 0xc740d4e3, 0xffffffff, 0x3c1a9511, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0x2cd23640, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0x2cd23640, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0x2cd23640, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x1, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0x2cd23640, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0x2cd23640, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0x3b71cec8, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0x3b71cec8, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0x3b71cec8, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0x3b71cec9, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0x3b71cec8, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0xbb71cec8, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0xbb71cec8, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0xbb71cec9, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0xbb71cec8, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0xbb71cec8, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0xacd23640, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0xacd23640, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0xacd23640, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x1, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0xacd23640, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x0, 0x3e3a9cd5, 0xffffffff, 0x3c25dbea, 0xffffffff, 0xbaf1cec8, 0xffffffff, 0xacd23640, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0x26830c26, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x0, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0x26830c26, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0x26830c26, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0x26830c27, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x3, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0x26830c27, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0xb27e7863, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0xb27e7862, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0xb27e7863, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0xb27e7862, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0xb27e7862, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0x327e7863, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0x327e7862, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0x327e7862, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0x327e7863, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0x327e7863, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0xa6830c26, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x0, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0xa6830c26, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0xa6830c27, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0xa6830c26, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x2a65e649, 0xffffffff, 0xc70dae1b, 0xffffffff, 0x31fe7864, 0xffffffff, 0xa6830c26, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0xbd6365a6, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0xbd6365a6, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0xbd6365a6, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0xbd6365a6, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x2, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0xbd6365a6, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0xc91f8f4b, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0xc91f8f4a, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0xc91f8f4b, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0xc91f8f4a, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0xc91f8f4b, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0x491f8f4b, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0x491f8f4a, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0x491f8f4a, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0x491f8f4b, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0x491f8f4a, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0x3d6365a6, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0x3d6365a6, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0x3d6365a6, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0x3d6365a6, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x2, 0x464e7c11, 0xffffffff, 0xc1c5d28c, 0xffffffff, 0x489f8f4a, 0xffffffff, 0x3d6365a6, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0xbe86c4a8, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0xbe86c4a8, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x1, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0xbe86c4a8, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0xbe86c4a8, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x0, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0xbe86c4a8, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0x4b5f75a7, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0x4b5f75a6, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0x4b5f75a6, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0x4b5f75a7, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0x4b5f75a7, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0xcb5f75a7, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0xcb5f75a6, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0xcb5f75a7, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0xcb5f75a6, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0xcb5f75a7, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0x3e86c4a8, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0x3e86c4a8, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0x3e86c4a8, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0x3e86c4a8, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x0, 0x4b906cb4, 0xffffffff, 0x3ec60bf7, 0xffffffff, 0xcadf75a7, 0xffffffff, 0x3e86c4a8, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0xb6a07498, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0xb6a07498, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x1, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0xb6a07498, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0xb6a07498, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0xb6a07498, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0xc281ca17, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0xc281ca16, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0xc281ca17, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0xc281ca16, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0xc281ca16, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0x4281ca17, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0x4281ca16, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0x4281ca16, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0x4281ca17, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0x4281ca17, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0x36a07498, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0x36a07498, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0x36a07498, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0x36a07498, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x422680f0, 0xffffffff, 0xbf478d3d, 0xffffffff, 0x4201ca16, 0xffffffff, 0x36a07498, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0x281f725b, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0x281f725b, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0x281f725b, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0x281f725b, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0x281f725b, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0xb42e6aae, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0xb42e6aae, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0xb42e6aaf, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0xb42e6aae, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0xb42e6aae, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0x342e6aae, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0x342e6aae, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0x342e6aae, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0x342e6aaf, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0x342e6aaf, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0xa81f725b, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0xa81f725b, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0xa81f725b, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0xa81f725b, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x368829ab, 0xffffffff, 0xbca3f5ef, 0xffffffff, 0x33ae6aaf, 0xffffffff, 0xa81f725b, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x1ffa1a5c, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x1ffa1a5c, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x1ffa1a5c, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x1ffa1a5c, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x1ffa1a5c, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0xac6a97e3, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0xac6a97e2, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0xac6a97e3, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0xac6a97e2, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0xac6a97e2, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x2c6a97e3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x2c6a97e2, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x2c6a97e2, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x2c6a97e3, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x2c6a97e2, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x9ffa1a5c, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x9ffa1a5c, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x9ffa1a5c, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x9ffa1a5c, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x1, 0x37a79a2b, 0xffffffff, 0xb3b32976, 0xffffffff, 0x2bea97e3, 0xffffffff, 0x9ffa1a5c, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0x249b9afa, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0x249b9afa, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0x249b9afa, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0x249b9afa, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x0, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0x249b9afa, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0xb0904213, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0xb0904213, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0xb0904214, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0xb0904213, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0xb0904213, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0x30904213, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0x30904213, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0x30904213, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0x30904214, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0x30904213, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0xa49b9afa, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0xa49b9afa, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0xa49b9afa, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0xa49b9afa, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x0, 0x364dd4ae, 0xffffffff, 0xb9336b6a, 0xffffffff, 0x30104214, 0xffffffff, 0xa49b9afa, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x1, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0xa05467cc, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0xa05467cc, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0xa05467cc, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0xa05467cc, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0xa05467cc, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0x2de23075, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0x2de23074, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0x2de23074, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0x2de23075, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0x2de23075, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0xade23075, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0xade23074, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0xade23075, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0xade23074, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0xade23074, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0x205467cc, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0x205467cc, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0x205467cc, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0x205467cc, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x576569ab, 0xffffffff, 0x157c6727, 0xffffffff, 0xad623075, 0xffffffff, 0x205467cc, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0x289e14c0, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0x289e14bf, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x1, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0x289e14bf, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0x289e14c0, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0x289e14bf, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0x3424cc3f, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0x3424cc3f, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0x3424cc3f, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0x3424cc40, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0x3424cc3f, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0xb424cc3f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0xb424cc3f, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0xb424cc40, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0xb424cc3f, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0xb424cc40, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0xa89e14c0, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0xa89e14bf, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0xa89e14c0, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0xa89e14bf, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x2, 0x3f66f733, 0xffffffff, 0x33b6a90a, 0xffffffff, 0xb3a4cc3e, 0xffffffff, 0xa89e14c0, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x1, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0x2541e1a6, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0x2541e1a6, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0x2541e1a6, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0x2541e1a6, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0x2541e1a6, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0x3119af8b, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0x3119af8a, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0x3119af8a, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0x3119af8b, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0x3119af8b, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0xb119af8b, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0xb119af8a, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0xb119af8b, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0xb119af8a, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0xb119af8a, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0xa541e1a6, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x3, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0xa541e1a6, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0xa541e1a6, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0xa541e1a6, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x360908a2, 0xffffffff, 0x3a0f8de3, 0xffffffff, 0xb099af8a, 0xffffffff, 0xa541e1a6, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0x264b9388, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0x264b9388, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0x264b9388, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0x264b9388, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0x264b9388, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0x331fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0x331fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0x331fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0x331fd2af, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0x331fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0xb31fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0xb31fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0xb31fd2af, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0xb31fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0xb31fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0xa64b9388, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0xa64b9388, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0xa64b9388, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0xa64b9388, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x0, 0x31e8e5e9, 0xffffffff, 0x402fad24, 0xffffffff, 0xb29fd2ae, 0xffffffff, 0xa64b9388, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x1, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x0, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x3, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x1, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x0, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x2, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x3, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x1, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x3, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x1, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x0, 0x4e0ee2e6, 0xffffffff, 0x7d223cc9, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0xbe1da3dd, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0xbe1da3dd, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0xbe1da3dd, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0xbe1da3dd, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0xbe1da3dd, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0x498036f7, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0x498036f6, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0x498036f6, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0x498036f7, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0x498036f7, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0xc98036f7, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0xc98036f6, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0xc98036f7, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0xc98036f6, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0xc98036f6, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0x3e1da3dd, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0x3e1da3dd, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0x3e1da3dd, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0x3e1da3dd, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x44c9abdc, 0xffffffff, 0x43a2c135, 0xffffffff, 0xc90036f8, 0xffffffff, 0x3e1da3dd, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x1, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x4bbf496, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x4bbf496, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x4bbf496, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x4bbf496, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x4bbf496, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x9122318e, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x9122318d, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x9122318e, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x9122318d, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x9122318d, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x1122318e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x1122318d, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x1122318d, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x1122318e, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x1122318d, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x84bbf496, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x3, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x84bbf496, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x84bbf496, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x84bbf496, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x1, 0x66dd6ca, 0xffffffff, 0xc9ae9411, 0xffffffff, 0x10a2318e, 0xffffffff, 0x84bbf496, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x1, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0xbada64bc, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0xbada64bc, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0xbada64bc, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x1, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0xbada64bc, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0xbada64bc, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0xc7826b3c, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0xc7826b3c, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0xc7826b3d, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0xc7826b3c, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0xc7826b3c, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0x47826b3c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0x47826b3c, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0x47826b3c, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0x47826b3d, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0x47826b3d, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0x3ada64bc, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0x3ada64bc, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0x3ada64bc, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x1, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0x3ada64bc, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x3cdba682, 0xffffffff, 0xc998006f, 0xffffffff, 0x47026b3c, 0xffffffff, 0x3ada64bc, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0xa21943d8, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0xa21943d8, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0xa21943d8, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0xa21943d8, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0xa21943d8, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0xaf731480, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0xaf731480, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0xaf731481, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0xaf731480, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0xaf731480, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0x2f731480, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0x2f731480, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0x2f731480, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0x2f731481, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0x2f731480, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0x221943d8, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0x221943d8, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0x221943d8, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0x221943d8, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x1, 0x32cc65b2, 0xffffffff, 0xbb983973, 0xffffffff, 0x2ef31480, 0xffffffff, 0x221943d8, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0x3902b230, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0x3902b230, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0x3902b230, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0x3902b230, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0x3902b230, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0xc61c7af0, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0xc61c7aef, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0xc61c7af0, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0xc61c7aef, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0xc61c7aef, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0x461c7af0, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0x461c7aef, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0x461c7aef, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0x461c7af0, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0x461c7aef, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0xb902b230, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x3, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0xb902b230, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0xb902b230, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0xb902b230, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x1, 0x54b49fbc, 0xffffffff, 0xb05dc7e6, 0xffffffff, 0x459c7af0, 0xffffffff, 0xb902b230, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x8000002c, 0xffffffff, 0x3, 0x0
+  .word 0x8, 0x0, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x8000002c, 0xffffffff, 0x3, 0x0
+  .word 0x10, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x8000002d, 0xffffffff, 0x3, 0x0
+  .word 0x18, 0x2, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x8000002c, 0xffffffff, 0x3, 0x0
+  .word 0x20, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x8000002c, 0xffffffff, 0x3, 0x0
+  .word 0x28, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x426afd2, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x426afd1, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x426afd1, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x426afd2, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x426afd2, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x8426afd2, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x8426afd1, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x8426afd2, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x8426afd1, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x8426afd1, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x2c, 0xffffffff, 0x3, 0x0
+  .word 0x80, 0x0, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x2c, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x2c, 0xffffffff, 0x3, 0x0
+  .word 0x90, 0x2, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x2d, 0xffffffff, 0x3, 0x0
+  .word 0x98, 0x3, 0x32411aff, 0xffffffff, 0x10dcfa0d, 0xffffffff, 0x83a6afd2, 0xffffffff, 0x2d, 0xffffffff, 0x3, 0x0
+  .word 0x0, 0x2, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0xbd9618c8, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0xbd9618c8, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x1, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0xbd9618c8, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0xbd9618c8, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0xbd9618c8, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0x49c979dd, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0x49c979dd, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0x49c979dd, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0x49c979de, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0x49c979de, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0xc9c979dd, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0xc9c979dd, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0xc9c979de, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0xc9c979dd, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0xc9c979dd, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0x3d9618c8, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x3, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0x3d9618c8, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0x3d9618c8, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0x3d9618c8, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x41727fc6, 0xffffffff, 0x4754b168, 0xffffffff, 0xc94979de, 0xffffffff, 0x3d9618c8, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0xbdf22466, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0xbdf22466, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0xbdf22466, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0xbdf22466, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0xbdf22466, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0x4a0310f8, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0x4a0310f7, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0x4a0310f7, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0x4a0310f8, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0x4a0310f8, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0xca0310f8, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0xca0310f7, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0xca0310f8, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0xca0310f7, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0xca0310f8, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0x3df22466, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0x3df22466, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0x3df22466, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0x3df22466, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x0, 0x4bfa388a, 0xffffffff, 0x3d0617e9, 0xffffffff, 0xc98310f8, 0xffffffff, 0x3df22466, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x1e0f951c, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x1e0f951b, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x1, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x1e0f951b, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x0, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x1e0f951c, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x1e0f951b, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x2996ccc4, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x2996ccc4, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x2996ccc4, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x2996ccc5, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x2996ccc4, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0xa996ccc4, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0xa996ccc4, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0xa996ccc5, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0xa996ccc4, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0xa996ccc4, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x9e0f951c, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x9e0f951b, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x9e0f951c, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x0, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x9e0f951b, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x1, 0x2b38e681, 0xffffffff, 0x3d50c96e, 0xffffffff, 0xa916ccc3, 0xffffffff, 0x9e0f951b, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0xd55e2996, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0xd55e2996, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0xd55e2996, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x1, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0xd55e2996, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0xd55e2996, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0x62017b68, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0x62017b67, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0x62017b67, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0x62017b68, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0x62017b67, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0xe2017b68, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0xe2017b67, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0xe2017b68, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0xe2017b67, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0xe2017b67, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0x555e2996, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0x555e2996, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0x555e2996, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x1, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0x555e2996, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x1, 0x5b5f743b, 0xffffffff, 0x4594574f, 0xffffffff, 0xe1817b68, 0xffffffff, 0x555e2996, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0x49b762e4, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0x49b762e4, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x1, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0x49b762e4, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0x49b762e4, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x0, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0x49b762e4, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0x57024de5, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0x57024de5, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0x57024de5, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0x57024de6, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0x57024de5, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0xd7024de5, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0xd7024de5, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0xd7024de6, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0xd7024de5, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0xd7024de5, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0xc9b762e4, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0xc9b762e4, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0xc9b762e4, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0xc9b762e4, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x0, 0x54bbf9b5, 0xffffffff, 0x41317575, 0xffffffff, 0xd6824de5, 0xffffffff, 0xc9b762e4, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x1, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x1eabb2d4, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x1eabb2d4, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x1eabb2d4, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x1eabb2d4, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x1eabb2d4, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x2b28162c, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x2b28162c, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x2b28162c, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x2b28162d, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x2b28162c, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0xab28162c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0xab28162c, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0xab28162d, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0xab28162c, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0xab28162c, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x9eabb2d4, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x9eabb2d4, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x9eabb2d4, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x9eabb2d4, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x0, 0xd02168b, 0xffffffff, 0x5d25637e, 0xffffffff, 0xaaa8162c, 0xffffffff, 0x9eabb2d4, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x8, 0x2, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x10, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x18, 0x1, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x20, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x28, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x30, 0x2, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x38, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x40, 0x1, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x48, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x50, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x58, 0x2, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x60, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x68, 0x1, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x70, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x78, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x80, 0x2, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x88, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x90, 0x1, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x98, 0x3, 0x7e886191, 0xffffffff, 0xc12bb7eb, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x0, 0x1, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0xc0cedc48, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0xc0cedc48, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x1, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0xc0cedc48, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0xc0cedc48, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x2, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0xc0cedc48, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0x4df514ef, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0x4df514ee, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0x4df514ee, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0x4df514ef, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0x4df514ee, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0xcdf514ef, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0xcdf514ee, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0xcdf514ef, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0xcdf514ee, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0xcdf514ef, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0x40cedc48, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0x40cedc48, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0x40cedc48, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0x40cedc48, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x2, 0x4988ca79, 0xffffffff, 0x436554de, 0xffffffff, 0xcd7514ef, 0xffffffff, 0x40cedc48, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0xba21c536, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0xba21c536, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0xba21c536, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x0, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0xba21c536, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0xba21c536, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0x470e646c, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0x470e646b, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0x470e646b, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0x470e646c, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0x470e646c, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0xc70e646c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0xc70e646b, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0xc70e646c, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0xc70e646b, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0xc70e646b, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0x3a21c536, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0x3a21c536, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0x3a21c536, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0x3a21c536, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x45f10675, 0xffffffff, 0x40173d31, 0xffffffff, 0xc68e646c, 0xffffffff, 0x3a21c536, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x9515fa9c, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x0, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x9515fa9c, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x1, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x9515fa9d, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x1, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x9515fa9c, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x0, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x9515fa9c, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0xa09b6825, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0xa09b6825, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0xa09b6826, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0xa09b6825, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0xa09b6825, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x209b6825, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x209b6825, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x209b6825, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x209b6826, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x209b6825, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x1515fa9c, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x0, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x1515fa9c, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x1515fa9c, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x1, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x1515fa9d, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x0, 0x3941948e, 0xffffffff, 0xa64d847f, 0xffffffff, 0x201b6824, 0xffffffff, 0x1515fa9c, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x1, 0xd8daf791, 0xffffffff, 0xc433c489, 0xffffffff, 0x4375412d, 0xffffffff, 0x5d99c335, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0xd8daf791, 0xffffffff, 0xc433c489, 0xffffffff, 0x4375412d, 0xffffffff, 0x5d99c335, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0xd8daf791, 0xffffffff, 0xc433c489, 0xffffffff, 0x4375412d, 0xffffffff, 0xdd99c336, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xd8daf791, 0xffffffff, 0xc433c489, 0xffffffff, 0x4375412d, 0xffffffff, 0xdd99c336, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x1, 0xcec0a01a, 0xffffffff, 0xd05252a2, 0xffffffff, 0xc8e519e9, 0xffffffff, 0x5f9e4183, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0xcec0a01a, 0xffffffff, 0xd05252a2, 0xffffffff, 0xc8e519e9, 0xffffffff, 0x5f9e4183, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0xcec0a01a, 0xffffffff, 0xd05252a2, 0xffffffff, 0xc8e519e9, 0xffffffff, 0xdf9e4182, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x1, 0xcec0a01a, 0xffffffff, 0xd05252a2, 0xffffffff, 0xc8e519e9, 0xffffffff, 0xdf9e4182, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x1, 0xb97c6079, 0xffffffff, 0x3c107913, 0xffffffff, 0xf9068d36, 0xffffffff, 0xf9068d36, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x1, 0xb97c6079, 0xffffffff, 0x3c107913, 0xffffffff, 0xf9068d36, 0xffffffff, 0x79068d35, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xb97c6079, 0xffffffff, 0x3c107913, 0xffffffff, 0xf9068d36, 0xffffffff, 0xf9068d35, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xb97c6079, 0xffffffff, 0x3c107913, 0xffffffff, 0xf9068d36, 0xffffffff, 0x79068d36, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xbe844365, 0xffffffff, 0xba70bbda, 0xffffffff, 0x8dc13c00, 0xffffffff, 0x3978c079, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xbe844365, 0xffffffff, 0xba70bbda, 0xffffffff, 0x8dc13c00, 0xffffffff, 0x3978c079, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0xbe844365, 0xffffffff, 0xba70bbda, 0xffffffff, 0x8dc13c00, 0xffffffff, 0xb978c079, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xbe844365, 0xffffffff, 0xba70bbda, 0xffffffff, 0x8dc13c00, 0xffffffff, 0xb978c079, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x2, 0xb0d64cba, 0xffffffff, 0x70857c50, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x30, 0x2, 0xb0d64cba, 0xffffffff, 0x70857c50, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x58, 0x2, 0xb0d64cba, 0xffffffff, 0x70857c50, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x80, 0x2, 0xb0d64cba, 0xffffffff, 0x70857c50, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x18, 0x1, 0x4baf5be2, 0xffffffff, 0x7f800001, 0xffffffff, 0x747d68d3, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x40, 0x1, 0x4baf5be2, 0xffffffff, 0x7f800001, 0xffffffff, 0x747d68d3, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x68, 0x1, 0x4baf5be2, 0xffffffff, 0x7f800001, 0xffffffff, 0x747d68d3, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x90, 0x1, 0x4baf5be2, 0xffffffff, 0x7f800001, 0xffffffff, 0x747d68d3, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x10, 0x0, 0xc9f94e90, 0xffffffff, 0xb81dcfb4, 0xffffffff, 0x488e2552, 0xffffffff, 0x488e2eec, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0xc9f94e90, 0xffffffff, 0xb81dcfb4, 0xffffffff, 0x488e2552, 0xffffffff, 0xc88e1bb8, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0xc9f94e90, 0xffffffff, 0xb81dcfb4, 0xffffffff, 0x488e2552, 0xffffffff, 0x488e1bb7, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xc9f94e90, 0xffffffff, 0xb81dcfb4, 0xffffffff, 0x488e2552, 0xffffffff, 0xc88e2eed, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x41650cc1, 0xffffffff, 0x4bf709fd, 0xffffffff, 0xbb1eeb23, 0xffffffff, 0x4ddd083e, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x41650cc1, 0xffffffff, 0x4bf709fd, 0xffffffff, 0xbb1eeb23, 0xffffffff, 0x4ddd083e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x41650cc1, 0xffffffff, 0x4bf709fd, 0xffffffff, 0xbb1eeb23, 0xffffffff, 0xcddd083e, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0x41650cc1, 0xffffffff, 0x4bf709fd, 0xffffffff, 0xbb1eeb23, 0xffffffff, 0xcddd083e, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x0, 0xc3155c89, 0xffffffff, 0xb46b2c33, 0xffffffff, 0xbdd01190, 0xffffffff, 0xbdd00069, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xc3155c89, 0xffffffff, 0xb46b2c33, 0xffffffff, 0xbdd01190, 0xffffffff, 0x3dd022b7, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0xc3155c89, 0xffffffff, 0xb46b2c33, 0xffffffff, 0xbdd01190, 0xffffffff, 0xbdd022b6, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x0, 0xc3155c89, 0xffffffff, 0xb46b2c33, 0xffffffff, 0xbdd01190, 0xffffffff, 0x3dd0006a, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x1, 0xfa0998e7, 0xffffffff, 0x4e463005, 0xffffffff, 0x97ea2b02, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x38, 0x1, 0xfa0998e7, 0xffffffff, 0x4e463005, 0xffffffff, 0x97ea2b02, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x60, 0x1, 0xfa0998e7, 0xffffffff, 0x4e463005, 0xffffffff, 0x97ea2b02, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x1, 0xfa0998e7, 0xffffffff, 0x4e463005, 0xffffffff, 0x97ea2b02, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x18, 0x0, 0x3d85c667, 0xffffffff, 0x3f800000, 0xffffffff, 0xc9bd216a, 0xffffffff, 0xc9bd2169, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x3d85c667, 0xffffffff, 0x3f800000, 0xffffffff, 0xc9bd216a, 0xffffffff, 0x49bd216b, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x0, 0x3d85c667, 0xffffffff, 0x3f800000, 0xffffffff, 0xc9bd216a, 0xffffffff, 0xc9bd216a, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x0, 0x3d85c667, 0xffffffff, 0x3f800000, 0xffffffff, 0xc9bd216a, 0xffffffff, 0x49bd216a, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x2, 0xc31cf881, 0xffffffff, 0x453e8fb0, 0xffffffff, 0x8698e64a, 0xffffffff, 0xc8e9b114, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xc31cf881, 0xffffffff, 0x453e8fb0, 0xffffffff, 0x8698e64a, 0xffffffff, 0xc8e9b114, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xc31cf881, 0xffffffff, 0x453e8fb0, 0xffffffff, 0x8698e64a, 0xffffffff, 0x48e9b114, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x2, 0xc31cf881, 0xffffffff, 0x453e8fb0, 0xffffffff, 0x8698e64a, 0xffffffff, 0x48e9b114, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x1, 0x3a3dc99a, 0xffffffff, 0x4ee3ada3, 0xffffffff, 0x4caf7db4, 0xffffffff, 0x4cb220de, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x3a3dc99a, 0xffffffff, 0x4ee3ada3, 0xffffffff, 0x4caf7db4, 0xffffffff, 0xccacda8a, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x3a3dc99a, 0xffffffff, 0x4ee3ada3, 0xffffffff, 0x4caf7db4, 0xffffffff, 0x4cacda8a, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0x3a3dc99a, 0xffffffff, 0x4ee3ada3, 0xffffffff, 0x4caf7db4, 0xffffffff, 0xccb220de, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x86b75902, 0xffffffff, 0xba91f386, 0xffffffff, 0x3fbd9f55, 0xffffffff, 0x3fbd9f55, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x86b75902, 0xffffffff, 0xba91f386, 0xffffffff, 0x3fbd9f55, 0xffffffff, 0xbfbd9f55, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x86b75902, 0xffffffff, 0xba91f386, 0xffffffff, 0x3fbd9f55, 0xffffffff, 0x3fbd9f54, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x86b75902, 0xffffffff, 0xba91f386, 0xffffffff, 0x3fbd9f55, 0xffffffff, 0xbfbd9f56, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xbf800000, 0xffffffff, 0x65837ff8, 0xffffffff, 0xb3764550, 0xffffffff, 0xe5837ff8, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xbf800000, 0xffffffff, 0x65837ff8, 0xffffffff, 0xb3764550, 0xffffffff, 0xe5837ff8, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0xbf800000, 0xffffffff, 0x65837ff8, 0xffffffff, 0xb3764550, 0xffffffff, 0x65837ff8, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xbf800000, 0xffffffff, 0x65837ff8, 0xffffffff, 0xb3764550, 0xffffffff, 0x65837ff8, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xc0330d04, 0xffffffff, 0x4c12aee2, 0xffffffff, 0xc703007e, 0xffffffff, 0xcccd3fda, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0xc0330d04, 0xffffffff, 0x4c12aee2, 0xffffffff, 0xc703007e, 0xffffffff, 0xcccd1f1a, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0xc0330d04, 0xffffffff, 0x4c12aee2, 0xffffffff, 0xc703007e, 0xffffffff, 0x4ccd1f1b, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xc0330d04, 0xffffffff, 0x4c12aee2, 0xffffffff, 0xc703007e, 0xffffffff, 0x4ccd3fdb, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x3, 0xbaa6addb, 0xffffffff, 0x7f800000, 0xffffffff, 0x4847f182, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0xbaa6addb, 0xffffffff, 0x7f800000, 0xffffffff, 0x4847f182, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x3, 0xbaa6addb, 0xffffffff, 0x7f800000, 0xffffffff, 0x4847f182, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x3, 0xbaa6addb, 0xffffffff, 0x7f800000, 0xffffffff, 0x4847f182, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x2, 0xcc8b7141, 0xffffffff, 0x314cf01e, 0xffffffff, 0xc5d74c56, 0xffffffff, 0xc5d74e15, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xcc8b7141, 0xffffffff, 0x314cf01e, 0xffffffff, 0xc5d74c56, 0xffffffff, 0x45d74a97, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0xcc8b7141, 0xffffffff, 0x314cf01e, 0xffffffff, 0xc5d74c56, 0xffffffff, 0xc5d74a98, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x2, 0xcc8b7141, 0xffffffff, 0x314cf01e, 0xffffffff, 0xc5d74c56, 0xffffffff, 0x45d74e14, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x2, 0xd32b55d3, 0xffffffff, 0x4878350e, 0xffffffff, 0x43f5bf00, 0xffffffff, 0xdc261ea7, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x2, 0xd32b55d3, 0xffffffff, 0x4878350e, 0xffffffff, 0x43f5bf00, 0xffffffff, 0xdc261ea7, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xd32b55d3, 0xffffffff, 0x4878350e, 0xffffffff, 0x43f5bf00, 0xffffffff, 0x5c261ea6, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xd32b55d3, 0xffffffff, 0x4878350e, 0xffffffff, 0x43f5bf00, 0xffffffff, 0x5c261ea6, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x0, 0x422d24e5, 0xffffffff, 0x10973539, 0xffffffff, 0x6e0c5345, 0xffffffff, 0x6e0c5345, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x422d24e5, 0xffffffff, 0x10973539, 0xffffffff, 0x6e0c5345, 0xffffffff, 0xee0c5344, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x422d24e5, 0xffffffff, 0x10973539, 0xffffffff, 0x6e0c5345, 0xffffffff, 0x6e0c5344, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x0, 0x422d24e5, 0xffffffff, 0x10973539, 0xffffffff, 0x6e0c5345, 0xffffffff, 0xee0c5345, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x36bc30e0, 0xffffffff, 0xff800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x1, 0x36bc30e0, 0xffffffff, 0xff800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x1, 0x36bc30e0, 0xffffffff, 0xff800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x1, 0x36bc30e0, 0xffffffff, 0xff800000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x3, 0x4d1344bb, 0xffffffff, 0x21550964, 0xffffffff, 0x320a9a99, 0xffffffff, 0x320c84d0, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x3, 0x4d1344bb, 0xffffffff, 0x21550964, 0xffffffff, 0x320a9a99, 0xffffffff, 0xb208b062, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x4d1344bb, 0xffffffff, 0x21550964, 0xffffffff, 0x320a9a99, 0xffffffff, 0x3208b063, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x3, 0x4d1344bb, 0xffffffff, 0x21550964, 0xffffffff, 0x320a9a99, 0xffffffff, 0xb20c84cf, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x1, 0x4da7c0f7, 0xffffffff, 0xabfb303d, 0xffffffff, 0xcbe3f50e, 0xffffffff, 0xcbe3f50e, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0x4da7c0f7, 0xffffffff, 0xabfb303d, 0xffffffff, 0xcbe3f50e, 0xffffffff, 0x4be3f50e, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0x4da7c0f7, 0xffffffff, 0xabfb303d, 0xffffffff, 0xcbe3f50e, 0xffffffff, 0xcbe3f50d, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x1, 0x4da7c0f7, 0xffffffff, 0xabfb303d, 0xffffffff, 0xcbe3f50e, 0xffffffff, 0x4be3f50f, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x1, 0xbad22dc5, 0xffffffff, 0x3dee963f, 0xffffffff, 0xa5895613, 0xffffffff, 0xb943e1e8, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0xbad22dc5, 0xffffffff, 0x3dee963f, 0xffffffff, 0xa5895613, 0xffffffff, 0xb943e1e8, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0xbad22dc5, 0xffffffff, 0x3dee963f, 0xffffffff, 0xa5895613, 0xffffffff, 0x3943e1e7, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xbad22dc5, 0xffffffff, 0x3dee963f, 0xffffffff, 0xa5895613, 0xffffffff, 0x3943e1e7, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x3b68f9c8, 0xffffffff, 0xd3644032, 0xffffffff, 0xc737806b, 0xffffffff, 0xcf4fb999, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0x3b68f9c8, 0xffffffff, 0xd3644032, 0xffffffff, 0xc737806b, 0xffffffff, 0xcf4fb82a, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0x3b68f9c8, 0xffffffff, 0xd3644032, 0xffffffff, 0xc737806b, 0xffffffff, 0x4f4fb82a, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x1, 0x3b68f9c8, 0xffffffff, 0xd3644032, 0xffffffff, 0xc737806b, 0xffffffff, 0x4f4fb999, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x2, 0x82c63d4, 0xffffffff, 0x52f938e6, 0xffffffff, 0xd13f552b, 0xffffffff, 0xd13f552b, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x82c63d4, 0xffffffff, 0x52f938e6, 0xffffffff, 0xd13f552b, 0xffffffff, 0x513f552b, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x82c63d4, 0xffffffff, 0x52f938e6, 0xffffffff, 0xd13f552b, 0xffffffff, 0xd13f552c, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x2, 0x82c63d4, 0xffffffff, 0x52f938e6, 0xffffffff, 0xd13f552b, 0xffffffff, 0x513f552a, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x2, 0xcb957169, 0xffffffff, 0xc6ba4ab6, 0xffffffff, 0x5468559d, 0xffffffff, 0x5481c2ce, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xcb957169, 0xffffffff, 0xc6ba4ab6, 0xffffffff, 0x5468559d, 0xffffffff, 0xd44d259c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xcb957169, 0xffffffff, 0xc6ba4ab6, 0xffffffff, 0x5468559d, 0xffffffff, 0x544d259c, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x2, 0xcb957169, 0xffffffff, 0xc6ba4ab6, 0xffffffff, 0x5468559d, 0xffffffff, 0xd481c2ce, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x2, 0x58cf83b9, 0xffffffff, 0x4b355892, 0xffffffff, 0xcbe69e07, 0xffffffff, 0x6492ffed, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x58cf83b9, 0xffffffff, 0x4b355892, 0xffffffff, 0xcbe69e07, 0xffffffff, 0x6492ffed, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0x58cf83b9, 0xffffffff, 0x4b355892, 0xffffffff, 0xcbe69e07, 0xffffffff, 0xe492ffee, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x2, 0x58cf83b9, 0xffffffff, 0x4b355892, 0xffffffff, 0xcbe69e07, 0xffffffff, 0xe492ffee, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x2, 0x4d1908cd, 0xffffffff, 0x1, 0xffffffff, 0xc497b359, 0xffffffff, 0xc497b358, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x4d1908cd, 0xffffffff, 0x1, 0xffffffff, 0xc497b359, 0xffffffff, 0x4497b359, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x4d1908cd, 0xffffffff, 0x1, 0xffffffff, 0xc497b359, 0xffffffff, 0xc497b359, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x2, 0x4d1908cd, 0xffffffff, 0x1, 0xffffffff, 0xc497b359, 0xffffffff, 0x4497b358, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x1, 0xbdd02636, 0xffffffff, 0x409fd591, 0xffffffff, 0xbff2e802, 0xffffffff, 0xc019f159, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0xbdd02636, 0xffffffff, 0x409fd591, 0xffffffff, 0xbff2e802, 0xffffffff, 0x3fb1ed52, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0xbdd02636, 0xffffffff, 0x409fd591, 0xffffffff, 0xbff2e802, 0xffffffff, 0xbfb1ed51, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x1, 0xbdd02636, 0xffffffff, 0x409fd591, 0xffffffff, 0xbff2e802, 0xffffffff, 0x4019f15a, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x72a2c1cf, 0xffffffff, 0x1, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x40, 0x2, 0x72a2c1cf, 0xffffffff, 0x1, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xff7ffffe, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x72a2c1cf, 0xffffffff, 0x1, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x72a2c1cf, 0xffffffff, 0x1, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xff7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x3e1c12c2, 0xffffffff, 0x800000, 0xffffffff, 0x30c27f81, 0xffffffff, 0x30c27f81, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x3e1c12c2, 0xffffffff, 0x800000, 0xffffffff, 0x30c27f81, 0xffffffff, 0xb0c27f80, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x3e1c12c2, 0xffffffff, 0x800000, 0xffffffff, 0x30c27f81, 0xffffffff, 0x30c27f80, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0x3e1c12c2, 0xffffffff, 0x800000, 0xffffffff, 0x30c27f81, 0xffffffff, 0xb0c27f81, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x4acdfe10, 0xffffffff, 0x5925020e, 0xffffffff, 0x41c690d8, 0xffffffff, 0x6484c667, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0x4acdfe10, 0xffffffff, 0x5925020e, 0xffffffff, 0x41c690d8, 0xffffffff, 0x6484c667, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0x4acdfe10, 0xffffffff, 0x5925020e, 0xffffffff, 0x41c690d8, 0xffffffff, 0xe484c667, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x1, 0x4acdfe10, 0xffffffff, 0x5925020e, 0xffffffff, 0x41c690d8, 0xffffffff, 0xe484c667, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x1, 0xc167b0d7, 0xffffffff, 0x2e79a9cb, 0xffffffff, 0xed56ddfe, 0xffffffff, 0xed56ddfe, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x1, 0xc167b0d7, 0xffffffff, 0x2e79a9cb, 0xffffffff, 0xed56ddfe, 0xffffffff, 0x6d56ddfd, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xc167b0d7, 0xffffffff, 0x2e79a9cb, 0xffffffff, 0xed56ddfe, 0xffffffff, 0xed56ddfd, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xc167b0d7, 0xffffffff, 0x2e79a9cb, 0xffffffff, 0xed56ddfe, 0xffffffff, 0x6d56ddfe, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xc6918e7c, 0xffffffff, 0x7f800000, 0xffffffff, 0x800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x0, 0xc6918e7c, 0xffffffff, 0x7f800000, 0xffffffff, 0x800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x0, 0xc6918e7c, 0xffffffff, 0x7f800000, 0xffffffff, 0x800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xc6918e7c, 0xffffffff, 0x7f800000, 0xffffffff, 0x800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x365c97d5, 0xffffffff, 0x376cadca, 0xffffffff, 0x46c535da, 0xffffffff, 0x46c535da, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x365c97d5, 0xffffffff, 0x376cadca, 0xffffffff, 0x46c535da, 0xffffffff, 0xc6c535d9, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x365c97d5, 0xffffffff, 0x376cadca, 0xffffffff, 0x46c535da, 0xffffffff, 0x46c535d9, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0x365c97d5, 0xffffffff, 0x376cadca, 0xffffffff, 0x46c535da, 0xffffffff, 0xc6c535da, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x3, 0x4024a6ff, 0xffffffff, 0x34d6b58c, 0xffffffff, 0xbffc31d2, 0xffffffff, 0xbffc31c9, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x3, 0x4024a6ff, 0xffffffff, 0x34d6b58c, 0xffffffff, 0xbffc31d2, 0xffffffff, 0x3ffc31db, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x4024a6ff, 0xffffffff, 0x34d6b58c, 0xffffffff, 0xbffc31d2, 0xffffffff, 0xbffc31da, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x3, 0x4024a6ff, 0xffffffff, 0x34d6b58c, 0xffffffff, 0xbffc31d2, 0xffffffff, 0x3ffc31ca, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x3, 0x4181e0e2, 0xffffffff, 0x47950445, 0xffffffff, 0xbdb968e0, 0xffffffff, 0x4997341b, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x4181e0e2, 0xffffffff, 0x47950445, 0xffffffff, 0xbdb968e0, 0xffffffff, 0x4997341d, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x4181e0e2, 0xffffffff, 0x47950445, 0xffffffff, 0xbdb968e0, 0xffffffff, 0xc997341d, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x4181e0e2, 0xffffffff, 0x47950445, 0xffffffff, 0xbdb968e0, 0xffffffff, 0xc997341b, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x3, 0xa8c93847, 0xffffffff, 0xbf800000, 0xffffffff, 0x3d81c1f4, 0xffffffff, 0x3d81c1f5, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x3, 0xa8c93847, 0xffffffff, 0xbf800000, 0xffffffff, 0x3d81c1f4, 0xffffffff, 0xbd81c1f3, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xa8c93847, 0xffffffff, 0xbf800000, 0xffffffff, 0x3d81c1f4, 0xffffffff, 0x3d81c1f4, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x3, 0xa8c93847, 0xffffffff, 0xbf800000, 0xffffffff, 0x3d81c1f4, 0xffffffff, 0xbd81c1f4, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xb94a51c4, 0xffffffff, 0x7f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x28, 0x2, 0xb94a51c4, 0xffffffff, 0x7f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x50, 0x2, 0xb94a51c4, 0xffffffff, 0x7f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x78, 0x2, 0xb94a51c4, 0xffffffff, 0x7f800001, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x10, 0x1, 0xbe56127f, 0xffffffff, 0x491a026b, 0xffffffff, 0xec511aef, 0xffffffff, 0xec511af0, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0xbe56127f, 0xffffffff, 0x491a026b, 0xffffffff, 0xec511aef, 0xffffffff, 0x6c511aee, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0xbe56127f, 0xffffffff, 0x491a026b, 0xffffffff, 0xec511aef, 0xffffffff, 0xec511aef, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xbe56127f, 0xffffffff, 0x491a026b, 0xffffffff, 0xec511aef, 0xffffffff, 0x6c511aef, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xc4beb7a9, 0xffffffff, 0x922fd13a, 0xffffffff, 0x4cffadb7, 0xffffffff, 0x4cffadb7, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0xc4beb7a9, 0xffffffff, 0x922fd13a, 0xffffffff, 0x4cffadb7, 0xffffffff, 0xccffadb6, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xc4beb7a9, 0xffffffff, 0x922fd13a, 0xffffffff, 0x4cffadb7, 0xffffffff, 0x4cffadb6, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0xc4beb7a9, 0xffffffff, 0x922fd13a, 0xffffffff, 0x4cffadb7, 0xffffffff, 0xccffadb7, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x3, 0x425b7259, 0xffffffff, 0xb42bb297, 0xffffffff, 0x96c2c297, 0xffffffff, 0xb7132e79, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x425b7259, 0xffffffff, 0xb42bb297, 0xffffffff, 0x96c2c297, 0xffffffff, 0xb7132e79, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0x425b7259, 0xffffffff, 0xb42bb297, 0xffffffff, 0x96c2c297, 0xffffffff, 0x37132e78, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x425b7259, 0xffffffff, 0xb42bb297, 0xffffffff, 0x96c2c297, 0xffffffff, 0x37132e78, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x3480c3ac, 0xffffffff, 0xc0841d6a, 0xffffffff, 0x2ad5c06, 0xffffffff, 0xb584e761, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x3480c3ac, 0xffffffff, 0xc0841d6a, 0xffffffff, 0x2ad5c06, 0xffffffff, 0xb584e761, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x3480c3ac, 0xffffffff, 0xc0841d6a, 0xffffffff, 0x2ad5c06, 0xffffffff, 0x3584e760, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x3480c3ac, 0xffffffff, 0xc0841d6a, 0xffffffff, 0x2ad5c06, 0xffffffff, 0x3584e760, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x2, 0x3b3c1f59, 0xffffffff, 0x3ed77b47, 0xffffffff, 0x3e1de6f6, 0xffffffff, 0x3e1f23a7, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x2, 0x3b3c1f59, 0xffffffff, 0x3ed77b47, 0xffffffff, 0x3e1de6f6, 0xffffffff, 0xbe1caa45, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x3b3c1f59, 0xffffffff, 0x3ed77b47, 0xffffffff, 0x3e1de6f6, 0xffffffff, 0x3e1caa44, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x3b3c1f59, 0xffffffff, 0x3ed77b47, 0xffffffff, 0x3e1de6f6, 0xffffffff, 0xbe1f23a8, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x3, 0x796acddf, 0xffffffff, 0x1, 0xffffffff, 0x31418a20, 0xffffffff, 0x3148e08f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x796acddf, 0xffffffff, 0x1, 0xffffffff, 0x31418a20, 0xffffffff, 0xb13a33b1, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x796acddf, 0xffffffff, 0x1, 0xffffffff, 0x31418a20, 0xffffffff, 0x313a33b1, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x796acddf, 0xffffffff, 0x1, 0xffffffff, 0x31418a20, 0xffffffff, 0xb148e08f, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x2, 0x4e8036b0, 0xffffffff, 0xc362b209, 0xffffffff, 0xc39eb826, 0xffffffff, 0xd26312e4, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x2, 0x4e8036b0, 0xffffffff, 0xc362b209, 0xffffffff, 0xc39eb826, 0xffffffff, 0xd26312e4, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x4e8036b0, 0xffffffff, 0xc362b209, 0xffffffff, 0xc39eb826, 0xffffffff, 0x526312e3, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x4e8036b0, 0xffffffff, 0xc362b209, 0xffffffff, 0xc39eb826, 0xffffffff, 0x526312e3, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x9eeb4af, 0xffffffff, 0x7be00739, 0xffffffff, 0xc48bc66d, 0xffffffff, 0x463f6c08, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x9eeb4af, 0xffffffff, 0x7be00739, 0xffffffff, 0xc48bc66d, 0xffffffff, 0x46625da3, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x9eeb4af, 0xffffffff, 0x7be00739, 0xffffffff, 0xc48bc66d, 0xffffffff, 0xc6625da3, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x9eeb4af, 0xffffffff, 0x7be00739, 0xffffffff, 0xc48bc66d, 0xffffffff, 0xc63f6c08, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x2, 0xbb851c43, 0xffffffff, 0x9eb055ee, 0xffffffff, 0x8cb938f2, 0xffffffff, 0x1ab76038, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xbb851c43, 0xffffffff, 0x9eb055ee, 0xffffffff, 0x8cb938f2, 0xffffffff, 0x1ab76038, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xbb851c43, 0xffffffff, 0x9eb055ee, 0xffffffff, 0x8cb938f2, 0xffffffff, 0x9ab76038, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x2, 0xbb851c43, 0xffffffff, 0x9eb055ee, 0xffffffff, 0x8cb938f2, 0xffffffff, 0x9ab76038, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xca4d28f9, 0xffffffff, 0x3d21d30c, 0xffffffff, 0xbdc3fd86, 0xffffffff, 0xc801afed, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0xca4d28f9, 0xffffffff, 0x3d21d30c, 0xffffffff, 0xbdc3fd86, 0xffffffff, 0xc801afe0, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xca4d28f9, 0xffffffff, 0x3d21d30c, 0xffffffff, 0xbdc3fd86, 0xffffffff, 0x4801afe0, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0xca4d28f9, 0xffffffff, 0x3d21d30c, 0xffffffff, 0xbdc3fd86, 0xffffffff, 0x4801afed, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x1, 0x356eaadf, 0xffffffff, 0x35d26a1a, 0xffffffff, 0xed292550, 0xffffffff, 0xed292550, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0x356eaadf, 0xffffffff, 0x35d26a1a, 0xffffffff, 0xed292550, 0xffffffff, 0x6d292550, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0x356eaadf, 0xffffffff, 0x35d26a1a, 0xffffffff, 0xed292550, 0xffffffff, 0xed292551, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x356eaadf, 0xffffffff, 0x35d26a1a, 0xffffffff, 0xed292550, 0xffffffff, 0x6d29254f, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xbf800000, 0xffffffff, 0x52d063e9, 0xffffffff, 0xcc2bc070, 0xffffffff, 0xd2d06947, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0xbf800000, 0xffffffff, 0x52d063e9, 0xffffffff, 0xcc2bc070, 0xffffffff, 0xd2d05e8a, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0xbf800000, 0xffffffff, 0x52d063e9, 0xffffffff, 0xcc2bc070, 0xffffffff, 0x52d05e8a, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x1, 0xbf800000, 0xffffffff, 0x52d063e9, 0xffffffff, 0xcc2bc070, 0xffffffff, 0x52d06947, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x0, 0x5f349e3a, 0xffffffff, 0x3dd4f00e, 0xffffffff, 0xfe2b10d0, 0xffffffff, 0xfe2b10d0, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x5f349e3a, 0xffffffff, 0x3dd4f00e, 0xffffffff, 0xfe2b10d0, 0xffffffff, 0x7e2b10d0, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x5f349e3a, 0xffffffff, 0x3dd4f00e, 0xffffffff, 0xfe2b10d0, 0xffffffff, 0xfe2b10d0, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x0, 0x5f349e3a, 0xffffffff, 0x3dd4f00e, 0xffffffff, 0xfe2b10d0, 0xffffffff, 0x7e2b10d0, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x3, 0x3f800000, 0xffffffff, 0xfcfd2ed8, 0xffffffff, 0x1, 0xffffffff, 0xfcfd2ed8, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x3f800000, 0xffffffff, 0xfcfd2ed8, 0xffffffff, 0x1, 0xffffffff, 0xfcfd2ed8, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x3f800000, 0xffffffff, 0xfcfd2ed8, 0xffffffff, 0x1, 0xffffffff, 0x7cfd2ed8, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x3f800000, 0xffffffff, 0xfcfd2ed8, 0xffffffff, 0x1, 0xffffffff, 0x7cfd2ed8, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x2, 0x3511b71, 0xffffffff, 0xbf14bb09, 0xffffffff, 0xbf9af48e, 0xffffffff, 0xbf9af48f, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x2, 0x3511b71, 0xffffffff, 0xbf14bb09, 0xffffffff, 0xbf9af48e, 0xffffffff, 0x3f9af48d, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x3511b71, 0xffffffff, 0xbf14bb09, 0xffffffff, 0xbf9af48e, 0xffffffff, 0xbf9af48e, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x3511b71, 0xffffffff, 0xbf14bb09, 0xffffffff, 0xbf9af48e, 0xffffffff, 0x3f9af48e, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x2, 0xb8cecb5e, 0xffffffff, 0x4b653b42, 0xffffffff, 0x4d4187d2, 0xffffffff, 0x4d418775, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x2, 0xb8cecb5e, 0xffffffff, 0x4b653b42, 0xffffffff, 0x4d4187d2, 0xffffffff, 0xcd41882f, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xb8cecb5e, 0xffffffff, 0x4b653b42, 0xffffffff, 0x4d4187d2, 0xffffffff, 0x4d41882e, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xb8cecb5e, 0xffffffff, 0x4b653b42, 0xffffffff, 0x4d4187d2, 0xffffffff, 0xcd418776, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x1, 0x800000, 0xffffffff, 0xbde81943, 0xffffffff, 0xc3b420a6, 0xffffffff, 0xc3b420a6, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0x800000, 0xffffffff, 0xbde81943, 0xffffffff, 0xc3b420a6, 0xffffffff, 0x43b420a6, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0x800000, 0xffffffff, 0xbde81943, 0xffffffff, 0xc3b420a6, 0xffffffff, 0xc3b420a5, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x1, 0x800000, 0xffffffff, 0xbde81943, 0xffffffff, 0xc3b420a6, 0xffffffff, 0x43b420a7, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x0, 0x80000000, 0xffffffff, 0x487196f5, 0xffffffff, 0x3fdf77f3, 0xffffffff, 0x3fdf77f3, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x0, 0x80000000, 0xffffffff, 0x487196f5, 0xffffffff, 0x3fdf77f3, 0xffffffff, 0xbfdf77f3, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0x80000000, 0xffffffff, 0x487196f5, 0xffffffff, 0x3fdf77f3, 0xffffffff, 0x3fdf77f3, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x0, 0x80000000, 0xffffffff, 0x487196f5, 0xffffffff, 0x3fdf77f3, 0xffffffff, 0xbfdf77f3, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x4790c927, 0xffffffff, 0x3e0e1adc, 0xffffffff, 0x1, 0xffffffff, 0x4620bd89, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x4790c927, 0xffffffff, 0x3e0e1adc, 0xffffffff, 0x1, 0xffffffff, 0x4620bd89, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x4790c927, 0xffffffff, 0x3e0e1adc, 0xffffffff, 0x1, 0xffffffff, 0xc620bd88, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x4790c927, 0xffffffff, 0x3e0e1adc, 0xffffffff, 0x1, 0xffffffff, 0xc620bd88, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xc8ab7889, 0xffffffff, 0xe2a4a475, 0xffffffff, 0xc2f9b6f0, 0xffffffff, 0x6bdc8ebe, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0xc8ab7889, 0xffffffff, 0xe2a4a475, 0xffffffff, 0xc2f9b6f0, 0xffffffff, 0x6bdc8ebe, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xc8ab7889, 0xffffffff, 0xe2a4a475, 0xffffffff, 0xc2f9b6f0, 0xffffffff, 0xebdc8ebe, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0xc8ab7889, 0xffffffff, 0xe2a4a475, 0xffffffff, 0xc2f9b6f0, 0xffffffff, 0xebdc8ebe, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x0, 0x86438b2a, 0xffffffff, 0xcd8efbce, 0xffffffff, 0x6f54ba47, 0xffffffff, 0x6f54ba47, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x86438b2a, 0xffffffff, 0xcd8efbce, 0xffffffff, 0x6f54ba47, 0xffffffff, 0xef54ba47, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x86438b2a, 0xffffffff, 0xcd8efbce, 0xffffffff, 0x6f54ba47, 0xffffffff, 0x6f54ba47, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x0, 0x86438b2a, 0xffffffff, 0xcd8efbce, 0xffffffff, 0x6f54ba47, 0xffffffff, 0xef54ba47, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x3, 0xb70839b1, 0xffffffff, 0x93cd4302, 0xffffffff, 0x3585d138, 0xffffffff, 0x3585d139, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0xb70839b1, 0xffffffff, 0x93cd4302, 0xffffffff, 0x3585d138, 0xffffffff, 0xb585d137, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0xb70839b1, 0xffffffff, 0x93cd4302, 0xffffffff, 0x3585d138, 0xffffffff, 0x3585d138, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xb70839b1, 0xffffffff, 0x93cd4302, 0xffffffff, 0x3585d138, 0xffffffff, 0xb585d138, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x3, 0x35797465, 0xffffffff, 0x800000, 0xffffffff, 0xf65b8569, 0xffffffff, 0xf65b8569, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x35797465, 0xffffffff, 0x800000, 0xffffffff, 0xf65b8569, 0xffffffff, 0x765b8569, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x35797465, 0xffffffff, 0x800000, 0xffffffff, 0xf65b8569, 0xffffffff, 0xf65b8569, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x35797465, 0xffffffff, 0x800000, 0xffffffff, 0xf65b8569, 0xffffffff, 0x765b8569, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x1, 0x493b1f03, 0xffffffff, 0xf7775c3a, 0xffffffff, 0x43e22915, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x38, 0x1, 0x493b1f03, 0xffffffff, 0xf7775c3a, 0xffffffff, 0x43e22915, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x60, 0x1, 0x493b1f03, 0xffffffff, 0xf7775c3a, 0xffffffff, 0x43e22915, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x1, 0x493b1f03, 0xffffffff, 0xf7775c3a, 0xffffffff, 0x43e22915, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x20, 0x2, 0xc2fadf88, 0xffffffff, 0xbe7a023a, 0xffffffff, 0x7acba9, 0xffffffff, 0x41f50079, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xc2fadf88, 0xffffffff, 0xbe7a023a, 0xffffffff, 0x7acba9, 0xffffffff, 0x41f50079, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x2, 0xc2fadf88, 0xffffffff, 0xbe7a023a, 0xffffffff, 0x7acba9, 0xffffffff, 0xc1f5007a, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x2, 0xc2fadf88, 0xffffffff, 0xbe7a023a, 0xffffffff, 0x7acba9, 0xffffffff, 0xc1f5007a, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x1, 0x4548faf9, 0xffffffff, 0xc7b5623a, 0xffffffff, 0x30b76dc1, 0xffffffff, 0xcd8e668f, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x1, 0x4548faf9, 0xffffffff, 0xc7b5623a, 0xffffffff, 0x30b76dc1, 0xffffffff, 0xcd8e668f, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x1, 0x4548faf9, 0xffffffff, 0xc7b5623a, 0xffffffff, 0x30b76dc1, 0xffffffff, 0x4d8e6690, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x1, 0x4548faf9, 0xffffffff, 0xc7b5623a, 0xffffffff, 0x30b76dc1, 0xffffffff, 0x4d8e6690, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x34c67afc, 0xffffffff, 0xcee036a1, 0xffffffff, 0xb32e8307, 0xffffffff, 0xc42dd5f7, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x34c67afc, 0xffffffff, 0xcee036a1, 0xffffffff, 0xb32e8307, 0xffffffff, 0xc42dd5f7, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x34c67afc, 0xffffffff, 0xcee036a1, 0xffffffff, 0xb32e8307, 0xffffffff, 0x442dd5f7, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x34c67afc, 0xffffffff, 0xcee036a1, 0xffffffff, 0xb32e8307, 0xffffffff, 0x442dd5f7, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x2, 0xb94ad0e7, 0xffffffff, 0xbddb8d58, 0xffffffff, 0x21eb9de4, 0xffffffff, 0x37adf0b0, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xb94ad0e7, 0xffffffff, 0xbddb8d58, 0xffffffff, 0x21eb9de4, 0xffffffff, 0x37adf0b0, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xb94ad0e7, 0xffffffff, 0xbddb8d58, 0xffffffff, 0x21eb9de4, 0xffffffff, 0xb7adf0b0, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x2, 0xb94ad0e7, 0xffffffff, 0xbddb8d58, 0xffffffff, 0x21eb9de4, 0xffffffff, 0xb7adf0b0, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x79f2fa7a, 0xffffffff, 0x4ac48575, 0xffffffff, 0xb2107d13, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x28, 0x2, 0x79f2fa7a, 0xffffffff, 0x4ac48575, 0xffffffff, 0xb2107d13, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x50, 0x2, 0x79f2fa7a, 0xffffffff, 0x4ac48575, 0xffffffff, 0xb2107d13, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x78, 0x2, 0x79f2fa7a, 0xffffffff, 0x4ac48575, 0xffffffff, 0xb2107d13, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x8, 0x0, 0x5e81f0a9, 0xffffffff, 0x47a71e13, 0xffffffff, 0x3de4e2e1, 0xffffffff, 0x66a9a684, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x5e81f0a9, 0xffffffff, 0x47a71e13, 0xffffffff, 0x3de4e2e1, 0xffffffff, 0x66a9a684, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x5e81f0a9, 0xffffffff, 0x47a71e13, 0xffffffff, 0x3de4e2e1, 0xffffffff, 0xe6a9a684, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x0, 0x5e81f0a9, 0xffffffff, 0x47a71e13, 0xffffffff, 0x3de4e2e1, 0xffffffff, 0xe6a9a684, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x1, 0x7f800001, 0xffffffff, 0x4e48f9ff, 0xffffffff, 0xb9d6df68, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x28, 0x1, 0x7f800001, 0xffffffff, 0x4e48f9ff, 0xffffffff, 0xb9d6df68, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x50, 0x1, 0x7f800001, 0xffffffff, 0x4e48f9ff, 0xffffffff, 0xb9d6df68, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x78, 0x1, 0x7f800001, 0xffffffff, 0x4e48f9ff, 0xffffffff, 0xb9d6df68, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x20, 0x0, 0xb1e34d08, 0xffffffff, 0xbc23b9e2, 0xffffffff, 0x478be7c3, 0xffffffff, 0x478be7c3, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0xb1e34d08, 0xffffffff, 0xbc23b9e2, 0xffffffff, 0x478be7c3, 0xffffffff, 0xc78be7c3, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xb1e34d08, 0xffffffff, 0xbc23b9e2, 0xffffffff, 0x478be7c3, 0xffffffff, 0x478be7c3, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x0, 0xb1e34d08, 0xffffffff, 0xbc23b9e2, 0xffffffff, 0x478be7c3, 0xffffffff, 0xc78be7c3, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x0, 0x2ee5a09f, 0xffffffff, 0x45f01c29, 0xffffffff, 0x2028e25e, 0xffffffff, 0x35575fd7, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x2ee5a09f, 0xffffffff, 0x45f01c29, 0xffffffff, 0x2028e25e, 0xffffffff, 0x35575fd7, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x2ee5a09f, 0xffffffff, 0x45f01c29, 0xffffffff, 0x2028e25e, 0xffffffff, 0xb5575fd7, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x0, 0x2ee5a09f, 0xffffffff, 0x45f01c29, 0xffffffff, 0x2028e25e, 0xffffffff, 0xb5575fd7, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x4aaa6134, 0xffffffff, 0xcd963b8a, 0xffffffff, 0xe8a52af8, 0xffffffff, 0xe8a52af8, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x2, 0x4aaa6134, 0xffffffff, 0xcd963b8a, 0xffffffff, 0xe8a52af8, 0xffffffff, 0x68a52af8, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x2, 0x4aaa6134, 0xffffffff, 0xcd963b8a, 0xffffffff, 0xe8a52af8, 0xffffffff, 0xe8a52af7, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x4aaa6134, 0xffffffff, 0xcd963b8a, 0xffffffff, 0xe8a52af8, 0xffffffff, 0x68a52af9, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x2, 0xff800000, 0xffffffff, 0xc24b1a67, 0xffffffff, 0x46301100, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0xff800000, 0xffffffff, 0xc24b1a67, 0xffffffff, 0x46301100, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0xff800000, 0xffffffff, 0xc24b1a67, 0xffffffff, 0x46301100, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0xff800000, 0xffffffff, 0xc24b1a67, 0xffffffff, 0x46301100, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x4eca7a3e, 0xffffffff, 0xcdb87dbb, 0xffffffff, 0x7946e04f, 0xffffffff, 0x7946e04f, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x4eca7a3e, 0xffffffff, 0xcdb87dbb, 0xffffffff, 0x7946e04f, 0xffffffff, 0xf946e04f, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x4eca7a3e, 0xffffffff, 0xcdb87dbb, 0xffffffff, 0x7946e04f, 0xffffffff, 0x7946e050, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x4eca7a3e, 0xffffffff, 0xcdb87dbb, 0xffffffff, 0x7946e04f, 0xffffffff, 0xf946e04e, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xb2387654, 0xffffffff, 0x49b1d4f4, 0xffffffff, 0xcc5d6ffe, 0xffffffff, 0xcc5d6fff, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0xb2387654, 0xffffffff, 0x49b1d4f4, 0xffffffff, 0xcc5d6ffe, 0xffffffff, 0x4c5d6ffd, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0xb2387654, 0xffffffff, 0x49b1d4f4, 0xffffffff, 0xcc5d6ffe, 0xffffffff, 0xcc5d6ffe, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xb2387654, 0xffffffff, 0x49b1d4f4, 0xffffffff, 0xcc5d6ffe, 0xffffffff, 0x4c5d6ffe, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xfb2794a9, 0xffffffff, 0x9e47e0eb, 0xffffffff, 0x3f800000, 0xffffffff, 0x5a02d7cb, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xfb2794a9, 0xffffffff, 0x9e47e0eb, 0xffffffff, 0x3f800000, 0xffffffff, 0x5a02d7cb, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0xfb2794a9, 0xffffffff, 0x9e47e0eb, 0xffffffff, 0x3f800000, 0xffffffff, 0xda02d7cb, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xfb2794a9, 0xffffffff, 0x9e47e0eb, 0xffffffff, 0x3f800000, 0xffffffff, 0xda02d7cb, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x6dc4040b, 0xffffffff, 0xbca7ed1f, 0xffffffff, 0x4885e0ac, 0xffffffff, 0xeb009432, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x6dc4040b, 0xffffffff, 0xbca7ed1f, 0xffffffff, 0x4885e0ac, 0xffffffff, 0xeb009432, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x6dc4040b, 0xffffffff, 0xbca7ed1f, 0xffffffff, 0x4885e0ac, 0xffffffff, 0x6b009432, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0x6dc4040b, 0xffffffff, 0xbca7ed1f, 0xffffffff, 0x4885e0ac, 0xffffffff, 0x6b009432, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x3, 0xcc8b5d3e, 0xffffffff, 0x3f800000, 0xffffffff, 0x9877a22, 0xffffffff, 0xcc8b5d3e, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xcc8b5d3e, 0xffffffff, 0x3f800000, 0xffffffff, 0x9877a22, 0xffffffff, 0xcc8b5d3f, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0xcc8b5d3e, 0xffffffff, 0x3f800000, 0xffffffff, 0x9877a22, 0xffffffff, 0x4c8b5d3e, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xcc8b5d3e, 0xffffffff, 0x3f800000, 0xffffffff, 0x9877a22, 0xffffffff, 0x4c8b5d3d, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x3, 0x4c86cab3, 0xffffffff, 0x528a090b, 0xffffffff, 0x322a4da9, 0xffffffff, 0x5f915c0f, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x3, 0x4c86cab3, 0xffffffff, 0x528a090b, 0xffffffff, 0x322a4da9, 0xffffffff, 0x5f915c0f, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x4c86cab3, 0xffffffff, 0x528a090b, 0xffffffff, 0x322a4da9, 0xffffffff, 0xdf915c0e, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x3, 0x4c86cab3, 0xffffffff, 0x528a090b, 0xffffffff, 0x322a4da9, 0xffffffff, 0xdf915c0e, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x80000000, 0xffffffff, 0x25a6ad3d, 0xffffffff, 0x3fc00000, 0xffffffff, 0x3fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x80000000, 0xffffffff, 0x25a6ad3d, 0xffffffff, 0x3fc00000, 0xffffffff, 0xbfc00000, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x2, 0x80000000, 0xffffffff, 0x25a6ad3d, 0xffffffff, 0x3fc00000, 0xffffffff, 0x3fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x80000000, 0xffffffff, 0x25a6ad3d, 0xffffffff, 0x3fc00000, 0xffffffff, 0xbfc00000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x7cfc8195, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x48, 0x3, 0x7cfc8195, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x70, 0x3, 0x7cfc8195, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x98, 0x3, 0x7cfc8195, 0xffffffff, 0x7f800001, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x0, 0x1, 0xb7f8aba3, 0xffffffff, 0xa5dfe30c, 0xffffffff, 0x4dbf1ab5, 0xffffffff, 0x4dbf1ab5, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xb7f8aba3, 0xffffffff, 0xa5dfe30c, 0xffffffff, 0x4dbf1ab5, 0xffffffff, 0xcdbf1ab5, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xb7f8aba3, 0xffffffff, 0xa5dfe30c, 0xffffffff, 0x4dbf1ab5, 0xffffffff, 0x4dbf1ab5, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0xb7f8aba3, 0xffffffff, 0xa5dfe30c, 0xffffffff, 0x4dbf1ab5, 0xffffffff, 0xcdbf1ab5, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x3, 0x7f800001, 0xffffffff, 0x4d69d342, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x40, 0x3, 0x7f800001, 0xffffffff, 0x4d69d342, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x68, 0x3, 0x7f800001, 0xffffffff, 0x4d69d342, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x90, 0x3, 0x7f800001, 0xffffffff, 0x4d69d342, 0xffffffff, 0x0, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x8, 0x2, 0xa7660338, 0xffffffff, 0xf09dcacb, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0xa7660338, 0xffffffff, 0xf09dcacb, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0xa7660338, 0xffffffff, 0xf09dcacb, 0xffffffff, 0xff800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0xa7660338, 0xffffffff, 0xf09dcacb, 0xffffffff, 0xff800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x1, 0xdfc15859, 0xffffffff, 0xcaff9427, 0xffffffff, 0xf6d53991, 0xffffffff, 0xf6d5398f, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x1, 0xdfc15859, 0xffffffff, 0xcaff9427, 0xffffffff, 0xf6d53991, 0xffffffff, 0x76d53992, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xdfc15859, 0xffffffff, 0xcaff9427, 0xffffffff, 0xf6d53991, 0xffffffff, 0xf6d53992, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xdfc15859, 0xffffffff, 0xcaff9427, 0xffffffff, 0xf6d53991, 0xffffffff, 0x76d5398f, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x1, 0xc6985f5a, 0xffffffff, 0x417baeca, 0xffffffff, 0x80000000, 0xffffffff, 0xc895cd87, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0xc6985f5a, 0xffffffff, 0x417baeca, 0xffffffff, 0x80000000, 0xffffffff, 0xc895cd87, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0xc6985f5a, 0xffffffff, 0x417baeca, 0xffffffff, 0x80000000, 0xffffffff, 0x4895cd86, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xc6985f5a, 0xffffffff, 0x417baeca, 0xffffffff, 0x80000000, 0xffffffff, 0x4895cd86, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x1, 0x41ebff35, 0xffffffff, 0xc73b93da, 0xffffffff, 0x4c49f348, 0xffffffff, 0x4c448bea, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x41ebff35, 0xffffffff, 0xc73b93da, 0xffffffff, 0x4c49f348, 0xffffffff, 0xcc4f5aa6, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x41ebff35, 0xffffffff, 0xc73b93da, 0xffffffff, 0x4c49f348, 0xffffffff, 0x4c4f5aa6, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0x41ebff35, 0xffffffff, 0xc73b93da, 0xffffffff, 0x4c49f348, 0xffffffff, 0xcc448bea, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x3, 0x7f800001, 0xffffffff, 0x1, 0xffffffff, 0x80000000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x40, 0x3, 0x7f800001, 0xffffffff, 0x1, 0xffffffff, 0x80000000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x68, 0x3, 0x7f800001, 0xffffffff, 0x1, 0xffffffff, 0x80000000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x90, 0x3, 0x7f800001, 0xffffffff, 0x1, 0xffffffff, 0x80000000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x10, 0x0
+  .word 0x0, 0x1, 0x80000000, 0xffffffff, 0x316633de, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x80000000, 0xffffffff, 0x316633de, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x80000000, 0xffffffff, 0x316633de, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x1, 0x80000000, 0xffffffff, 0x316633de, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x3, 0xb31126ab, 0xffffffff, 0xf9863366, 0xffffffff, 0x2395f0a7, 0xffffffff, 0x6d182ec4, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xb31126ab, 0xffffffff, 0xf9863366, 0xffffffff, 0x2395f0a7, 0xffffffff, 0x6d182ec4, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x3, 0xb31126ab, 0xffffffff, 0xf9863366, 0xffffffff, 0x2395f0a7, 0xffffffff, 0xed182ec5, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xb31126ab, 0xffffffff, 0xf9863366, 0xffffffff, 0x2395f0a7, 0xffffffff, 0xed182ec5, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x8dc5ca6a, 0xffffffff, 0x1, 0xffffffff, 0x331b4c8d, 0xffffffff, 0x331b4c8c, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0x8dc5ca6a, 0xffffffff, 0x1, 0xffffffff, 0x331b4c8d, 0xffffffff, 0xb31b4c8d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x8dc5ca6a, 0xffffffff, 0x1, 0xffffffff, 0x331b4c8d, 0xffffffff, 0x331b4c8d, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0x8dc5ca6a, 0xffffffff, 0x1, 0xffffffff, 0x331b4c8d, 0xffffffff, 0xb31b4c8c, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x0, 0x7fc00000, 0xffffffff, 0x4df24b9b, 0xffffffff, 0x4ed0423c, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0x7fc00000, 0xffffffff, 0x4df24b9b, 0xffffffff, 0x4ed0423c, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x0, 0x7fc00000, 0xffffffff, 0x4df24b9b, 0xffffffff, 0x4ed0423c, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x7fc00000, 0xffffffff, 0x4df24b9b, 0xffffffff, 0x4ed0423c, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0xcc153f30, 0xffffffff, 0xba68e596, 0xffffffff, 0xaed0202, 0xffffffff, 0x4707c71c, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0xcc153f30, 0xffffffff, 0xba68e596, 0xffffffff, 0xaed0202, 0xffffffff, 0x4707c71c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xcc153f30, 0xffffffff, 0xba68e596, 0xffffffff, 0xaed0202, 0xffffffff, 0xc707c71c, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x0, 0xcc153f30, 0xffffffff, 0xba68e596, 0xffffffff, 0xaed0202, 0xffffffff, 0xc707c71c, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x3, 0xbedca886, 0xffffffff, 0xfbe14521, 0xffffffff, 0xc3056343, 0xffffffff, 0x7b422bb4, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x3, 0xbedca886, 0xffffffff, 0xfbe14521, 0xffffffff, 0xc3056343, 0xffffffff, 0x7b422bb4, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xbedca886, 0xffffffff, 0xfbe14521, 0xffffffff, 0xc3056343, 0xffffffff, 0xfb422bb3, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x3, 0xbedca886, 0xffffffff, 0xfbe14521, 0xffffffff, 0xc3056343, 0xffffffff, 0xfb422bb3, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x0, 0xce50cb8f, 0xffffffff, 0x3f800000, 0xffffffff, 0x9ce41630, 0xffffffff, 0xce50cb8f, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0xce50cb8f, 0xffffffff, 0x3f800000, 0xffffffff, 0x9ce41630, 0xffffffff, 0xce50cb8e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xce50cb8f, 0xffffffff, 0x3f800000, 0xffffffff, 0x9ce41630, 0xffffffff, 0x4e50cb8e, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x0, 0xce50cb8f, 0xffffffff, 0x3f800000, 0xffffffff, 0x9ce41630, 0xffffffff, 0x4e50cb8f, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x3272daca, 0xffffffff, 0x3f800000, 0xffffffff, 0x1926c967, 0xffffffff, 0x3272daca, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x0, 0x3272daca, 0xffffffff, 0x3f800000, 0xffffffff, 0x1926c967, 0xffffffff, 0x3272dac9, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x0, 0x3272daca, 0xffffffff, 0x3f800000, 0xffffffff, 0x1926c967, 0xffffffff, 0xb272daca, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x3272daca, 0xffffffff, 0x3f800000, 0xffffffff, 0x1926c967, 0xffffffff, 0xb272dacb, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x390a4427, 0xffffffff, 0x70c672d3, 0xffffffff, 0x17471e3d, 0xffffffff, 0x6a565d75, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x390a4427, 0xffffffff, 0x70c672d3, 0xffffffff, 0x17471e3d, 0xffffffff, 0x6a565d75, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0x390a4427, 0xffffffff, 0x70c672d3, 0xffffffff, 0x17471e3d, 0xffffffff, 0xea565d75, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x390a4427, 0xffffffff, 0x70c672d3, 0xffffffff, 0x17471e3d, 0xffffffff, 0xea565d75, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x1, 0xcbff336a, 0xffffffff, 0x3f800000, 0xffffffff, 0x478aac27, 0xffffffff, 0xcbfea8bd, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x1, 0xcbff336a, 0xffffffff, 0x3f800000, 0xffffffff, 0x478aac27, 0xffffffff, 0xcbffbe16, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xcbff336a, 0xffffffff, 0x3f800000, 0xffffffff, 0x478aac27, 0xffffffff, 0x4bffbe16, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xcbff336a, 0xffffffff, 0x3f800000, 0xffffffff, 0x478aac27, 0xffffffff, 0x4bfea8bd, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x2, 0x3f6dc531, 0xffffffff, 0x4b183810, 0xffffffff, 0x4c072054, 0xffffffff, 0x4c2a789d, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x3f6dc531, 0xffffffff, 0x4b183810, 0xffffffff, 0x4c072054, 0xffffffff, 0xcbc79014, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x3f6dc531, 0xffffffff, 0x4b183810, 0xffffffff, 0x4c072054, 0xffffffff, 0x4bc79014, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x2, 0x3f6dc531, 0xffffffff, 0x4b183810, 0xffffffff, 0x4c072054, 0xffffffff, 0xcc2a789d, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x0, 0x621c4a43, 0xffffffff, 0x80000000, 0xffffffff, 0x3e3b00c7, 0xffffffff, 0x3e3b00c7, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0x621c4a43, 0xffffffff, 0x80000000, 0xffffffff, 0x3e3b00c7, 0xffffffff, 0xbe3b00c7, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x0, 0x621c4a43, 0xffffffff, 0x80000000, 0xffffffff, 0x3e3b00c7, 0xffffffff, 0x3e3b00c7, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x0, 0x621c4a43, 0xffffffff, 0x80000000, 0xffffffff, 0x3e3b00c7, 0xffffffff, 0xbe3b00c7, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x3, 0x9383e9b8, 0xffffffff, 0x4e23ce1a, 0xffffffff, 0xbf800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x9383e9b8, 0xffffffff, 0x4e23ce1a, 0xffffffff, 0xbf800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x9383e9b8, 0xffffffff, 0x4e23ce1a, 0xffffffff, 0xbf800000, 0xffffffff, 0xbf7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x9383e9b8, 0xffffffff, 0x4e23ce1a, 0xffffffff, 0xbf800000, 0xffffffff, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x3, 0x80000000, 0xffffffff, 0xc23cc778, 0xffffffff, 0xc50734b4, 0xffffffff, 0xc50734b4, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x3, 0x80000000, 0xffffffff, 0xc23cc778, 0xffffffff, 0xc50734b4, 0xffffffff, 0x450734b4, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x3, 0x80000000, 0xffffffff, 0xc23cc778, 0xffffffff, 0xc50734b4, 0xffffffff, 0xc50734b4, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x80000000, 0xffffffff, 0xc23cc778, 0xffffffff, 0xc50734b4, 0xffffffff, 0x450734b4, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x39eeb1e7, 0xffffffff, 0xc50a153d, 0xffffffff, 0x2c6a3c99, 0xffffffff, 0xbf80bfb3, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x39eeb1e7, 0xffffffff, 0xc50a153d, 0xffffffff, 0x2c6a3c99, 0xffffffff, 0xbf80bfb3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x39eeb1e7, 0xffffffff, 0xc50a153d, 0xffffffff, 0x2c6a3c99, 0xffffffff, 0x3f80bfb3, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x0, 0x39eeb1e7, 0xffffffff, 0xc50a153d, 0xffffffff, 0x2c6a3c99, 0xffffffff, 0x3f80bfb3, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x3, 0x34a40f3b, 0xffffffff, 0x3f3756d8, 0xffffffff, 0xc0e06444, 0xffffffff, 0xc0e06444, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x34a40f3b, 0xffffffff, 0x3f3756d8, 0xffffffff, 0xc0e06444, 0xffffffff, 0x40e06444, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x3, 0x34a40f3b, 0xffffffff, 0x3f3756d8, 0xffffffff, 0xc0e06444, 0xffffffff, 0xc0e06444, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x3, 0x34a40f3b, 0xffffffff, 0x3f3756d8, 0xffffffff, 0xc0e06444, 0xffffffff, 0x40e06444, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xd69f4f7e, 0xffffffff, 0xbf800000, 0xffffffff, 0x5e8ed057, 0xffffffff, 0x5e8ed0f6, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xd69f4f7e, 0xffffffff, 0xbf800000, 0xffffffff, 0x5e8ed057, 0xffffffff, 0xde8ecfb8, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x2, 0xd69f4f7e, 0xffffffff, 0xbf800000, 0xffffffff, 0x5e8ed057, 0xffffffff, 0x5e8ecfb8, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xd69f4f7e, 0xffffffff, 0xbf800000, 0xffffffff, 0x5e8ed057, 0xffffffff, 0xde8ed0f6, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x2, 0x7f800000, 0xffffffff, 0xc518d095, 0xffffffff, 0xba2c38c4, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x7f800000, 0xffffffff, 0xc518d095, 0xffffffff, 0xba2c38c4, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x7f800000, 0xffffffff, 0xc518d095, 0xffffffff, 0xba2c38c4, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x7f800000, 0xffffffff, 0xc518d095, 0xffffffff, 0xba2c38c4, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0xc046ac63, 0xffffffff, 0x43d23623, 0xffffffff, 0x3172711e, 0xffffffff, 0xc4a3236c, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x1, 0xc046ac63, 0xffffffff, 0x43d23623, 0xffffffff, 0x3172711e, 0xffffffff, 0xc4a3236c, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x1, 0xc046ac63, 0xffffffff, 0x43d23623, 0xffffffff, 0x3172711e, 0xffffffff, 0x44a3236c, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x1, 0xc046ac63, 0xffffffff, 0x43d23623, 0xffffffff, 0x3172711e, 0xffffffff, 0x44a3236c, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x0, 0x35d05a8b, 0xffffffff, 0x3fc45edb, 0xffffffff, 0xb0b7f73e, 0xffffffff, 0x361fbb87, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x0, 0x35d05a8b, 0xffffffff, 0x3fc45edb, 0xffffffff, 0xb0b7f73e, 0xffffffff, 0x361fe985, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x35d05a8b, 0xffffffff, 0x3fc45edb, 0xffffffff, 0xb0b7f73e, 0xffffffff, 0xb61fe985, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x0, 0x35d05a8b, 0xffffffff, 0x3fc45edb, 0xffffffff, 0xb0b7f73e, 0xffffffff, 0xb61fbb87, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x3, 0x3f800000, 0xffffffff, 0xfa3a9eaf, 0xffffffff, 0xc2f98446, 0xffffffff, 0xfa3a9eaf, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x3, 0x3f800000, 0xffffffff, 0xfa3a9eaf, 0xffffffff, 0xc2f98446, 0xffffffff, 0xfa3a9eae, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x3, 0x3f800000, 0xffffffff, 0xfa3a9eaf, 0xffffffff, 0xc2f98446, 0xffffffff, 0x7a3a9eaf, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x3f800000, 0xffffffff, 0xfa3a9eaf, 0xffffffff, 0xc2f98446, 0xffffffff, 0x7a3a9eb0, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xbf47b0e3, 0xffffffff, 0x3deb75db, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x0, 0xbf47b0e3, 0xffffffff, 0x3deb75db, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x0, 0xbf47b0e3, 0xffffffff, 0x3deb75db, 0xffffffff, 0x7f800000, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xbf47b0e3, 0xffffffff, 0x3deb75db, 0xffffffff, 0x7f800000, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x2, 0x7f800000, 0xffffffff, 0x368bc96c, 0xffffffff, 0xcecdfcba, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x7f800000, 0xffffffff, 0x368bc96c, 0xffffffff, 0xcecdfcba, 0xffffffff, 0x7f800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x7f800000, 0xffffffff, 0x368bc96c, 0xffffffff, 0xcecdfcba, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x2, 0x7f800000, 0xffffffff, 0x368bc96c, 0xffffffff, 0xcecdfcba, 0xffffffff, 0xff800000, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x3, 0x800000, 0xffffffff, 0x1, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x28, 0x3, 0x800000, 0xffffffff, 0x1, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x50, 0x3, 0x800000, 0xffffffff, 0x1, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x78, 0x3, 0x800000, 0xffffffff, 0x1, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x0, 0x1, 0xa1f73c9e, 0xffffffff, 0x1, 0xffffffff, 0xbf800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xa1f73c9e, 0xffffffff, 0x1, 0xffffffff, 0xbf800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xa1f73c9e, 0xffffffff, 0x1, 0xffffffff, 0xbf800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x1, 0xa1f73c9e, 0xffffffff, 0x1, 0xffffffff, 0xbf800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x1, 0xb621cf99, 0xffffffff, 0x40abc7ed, 0xffffffff, 0x2f98b6c9, 0xffffffff, 0xb75926e2, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x1, 0xb621cf99, 0xffffffff, 0x40abc7ed, 0xffffffff, 0x2f98b6c9, 0xffffffff, 0xb7592945, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x1, 0xb621cf99, 0xffffffff, 0x40abc7ed, 0xffffffff, 0x2f98b6c9, 0xffffffff, 0x37592944, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xb621cf99, 0xffffffff, 0x40abc7ed, 0xffffffff, 0x2f98b6c9, 0xffffffff, 0x375926e1, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x2, 0x40e32387, 0xffffffff, 0x5c1e93d6, 0xffffffff, 0x4cc59ecc, 0xffffffff, 0x5d8cb318, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x2, 0x40e32387, 0xffffffff, 0x5c1e93d6, 0xffffffff, 0x4cc59ecc, 0xffffffff, 0x5d8cb318, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x40e32387, 0xffffffff, 0x5c1e93d6, 0xffffffff, 0x4cc59ecc, 0xffffffff, 0xdd8cb319, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x40e32387, 0xffffffff, 0x5c1e93d6, 0xffffffff, 0x4cc59ecc, 0xffffffff, 0xdd8cb319, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xc429adb6, 0xffffffff, 0x3f800000, 0xffffffff, 0x376b56c8, 0xffffffff, 0xc429adb5, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x3, 0xc429adb6, 0xffffffff, 0x3f800000, 0xffffffff, 0x376b56c8, 0xffffffff, 0xc429adb6, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xc429adb6, 0xffffffff, 0x3f800000, 0xffffffff, 0x376b56c8, 0xffffffff, 0x4429adb6, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x3, 0xc429adb6, 0xffffffff, 0x3f800000, 0xffffffff, 0x376b56c8, 0xffffffff, 0x4429adb5, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x2, 0x7fcabd01, 0xffffffff, 0x59a64ddc, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0x7fcabd01, 0xffffffff, 0x59a64ddc, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x2, 0x7fcabd01, 0xffffffff, 0x59a64ddc, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x2, 0x7fcabd01, 0xffffffff, 0x59a64ddc, 0xffffffff, 0x7fc00000, 0xffffffff, 0x7fc00000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x0, 0x400798b4, 0xffffffff, 0xca3c122e, 0xffffffff, 0x8eafa7d0, 0xffffffff, 0xcac73b8a, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x0, 0x400798b4, 0xffffffff, 0xca3c122e, 0xffffffff, 0x8eafa7d0, 0xffffffff, 0xcac73b8a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x400798b4, 0xffffffff, 0xca3c122e, 0xffffffff, 0x8eafa7d0, 0xffffffff, 0x4ac73b8a, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x0, 0x400798b4, 0xffffffff, 0xca3c122e, 0xffffffff, 0x8eafa7d0, 0xffffffff, 0x4ac73b8a, 0xffffffff, 0x1, 0x0
+cases_end:
+
+msg_ok:    .asciz "fp fma: ok\n"
+msg_fail:  .asciz "fp fma: FAIL "
+msg_of:    .asciz " of "
+msg_case:  .asciz "case "
+msg_colon: .asciz ": "
+msg_space: .asciz " "
+msg_nl:    .asciz "\n"
@@ -0,0 +1,511 @@
+#!/usr/bin/env python3
+# fp_gen.py
+#
+#   Generates the float guest tests.  Each test is a table of cases whose
+#   expected result and fflags are worked out exactly by fpref.py, and a
+#   runner which loads the operands and rounding mode of each case, calls a
+#   stub holding its instruction and checks what comes back.
+#
+#   Usage:
+#     python3 fp_gen.py <test> > fp_<test>.s
+#
+#   where <test> is one of the names in TESTS below.
+
+import random
+import sys
+
+from fpref import *
+
+MODES = [('rne', RNE), ('rtz', RTZ), ('rdn', RDN), ('rup', RUP), ('rmm', RMM)]
+
+# fill for the upper half of a single in a double register
+BOX = 0xffffffff00000000
+
+
+class Case:
+    def __init__(self, inst, frm, args, expect, flags, int_result=False):
+        self.inst = inst
+        self.frm = frm
+        self.args = args
+        self.expect = expect
+        self.flags = flags
+        self.int_result = int_result
+
+
+def random_bits(f, rng):
+    """mostly moderate exponents so results stay in range, with some of
+    anything"""
+    if rng.random() < 0.6:
+        exp = rng.randint(f.bias - 30, f.bias + 30)
+        return (rng.getrandbits(1) << (f.width - 1)) | (exp << f.frac_bits) | rng.getrandbits(f.frac_bits)
+    return rng.getrandbits(f.width)
+
+
+def special_bits(f):
+    one = f.bias << f.frac_bits
+    return [0, f.sign, one, one | f.sign, f.inf, f.inf | f.sign, f.qnan, f.inf | 1,
+            1, f.max, 1 << f.frac_bits, one | (1 << (f.frac_bits - 1))]
+
+
+def rounding(mode):
+    return '' if mode is None else ', ' + MODES[mode][0]
+
+
+def fma_cases(f, sfx, a, b, c, modes):
+    """the four fused multiply adds of a, b and c under each static rounding
+    mode and frm pair in modes"""
+    cases = []
+    for name, neg_mul, neg_add in (('fmadd', 0, 0), ('fmsub', 0, 1), ('fnmsub', 1, 0), ('fnmadd', 1, 1)):
+        # the negations flip signs without touching nans
+        aa = a ^ f.sign if neg_mul and not is_nan(f, a) else a
+        cc = c ^ f.sign if neg_add and not is_nan(f, c) else c
+        for mode, frm in modes:
+            r, fl = arith(f, 'fma', frm if mode is None else mode, aa, b, cc)
+            cases.append(Case(f'{name}{sfx} fa3, fa0, fa1, fa2{rounding(mode)}', frm, [a, b, c], r, fl))
+    return cases
+
+
+def static_and_dynamic(rng, frms):
+    """each mode as a static rounding mode under some other frm, and one of
+    them through frm"""
+    modes = [(m, rng.choice([x for x in frms if x != m])) for m in frms]
+    return modes + [(None, rng.choice(frms))]
+
+
+def test_fma():
+    """fused multiply adds, which must round once.  Run with --no-host-ext
+    to check the path taken on hosts without fma3."""
+    f, rng = SINGLE, random.Random(19)
+    frms = [RNE, RTZ, RDN, RUP]
+    cases = []
+    triples = [
+        # a multiply then add rounds to a different result
+        (0x4e707eb3, 0xc4bde39d, 0x41af5ab0),
+        # the product alone overflows but the sum does not
+        (0x795b929e, 0x496fb6d4, 0x7f800000),
+        (0x7f000000, 0x40000000, 0x7f7fffff),
+        (0x7f7fffff, 0x3f800001, 0xff7fffff),
+        # the product alone underflows
+        (0x1c800000, 0x1c800000, 0x3f800000),
+        (0x00800000, 0x3f000000, 0x00000001),
+        (0x00000003, 0x3f000000, 0x80000001),
+        # inexact products with a nan or infinite addend
+        (0x3f800001, 0x3f800001, 0x7fc00000),
+        (0x3f800001, 0x3f800001, 0x7f800001),
+        (0x3f800001, 0x3f800001, 0xff800000),
+        # invalid products whatever the addend
+        (0x7f800000, 0x00000000, 0x7fc00000),
+        (0x00000000, 0xff800000, 0x3f800000),
+    ]
+    for a, b, c in triples:
+        cases += fma_cases(f, '.s', a, b, c, static_and_dynamic(rng, frms))
+    # products cancelling most of the addend, where only the low bits of
+    # the product survive
+    for _ in range(40):
+        a, b = random_bits(f, rng) & ~f.sign, random_bits(f, rng)
+        p, _ = arith(f, 'mul', RNE, a, b)
+        c = (p ^ f.sign) + rng.randint(-2, 2) if not is_nan(f, p) else p
+        cases += fma_cases(f, '.s', a, b, c & 0xffffffff, static_and_dynamic(rng, frms))
+    specials = special_bits(f)
+    for _ in range(120):
+        a, b, c = [rng.choice(specials) if rng.random() < 0.2 else random_bits(f, rng) for _ in range(3)]
+        cases += fma_cases(f, '.s', a, b, c, [(rng.choice(frms + [None]), rng.choice(frms))])
+    for case in cases:
+        case.args = [x | BOX for x in case.args]
+        case.expect |= BOX
+    return cases
+
+
+def one_mode(rng, frms):
+    """a static rounding mode under some other frm, or frm alone"""
+    return [rng.choice(static_and_dynamic(rng, frms))]
+
+
+def mode_cases(inst, args, frm_modes, result, int_result=False):
+    """cases of inst under each static rounding mode and frm pair, where
+    result gives the expected result and fflags for a rounding mode"""
+    cases = []
+    for mode, frm in frm_modes:
+        r, fl = result(frm if mode is None else mode)
+        cases.append(Case(inst + rounding(mode), frm, args, r, fl, int_result))
+    return cases
+
+
+def test_double():
+    """RV32D arithmetic, conversions, comparisons and classification, and the
+    nan boxing of singles written over doubles."""
+    f, rng = DOUBLE, random.Random(24)
+    frms = [RNE, RTZ, RDN, RUP]
+    cases = []
+    specials = special_bits(f)
+    values = specials + [random_bits(f, rng) for _ in range(30)]
+    pairs = [(a, b) for a in specials for b in specials]
+    pairs += [(rng.choice(values), rng.choice(values)) for _ in range(60)]
+    for a, b in pairs:
+        for op in ('add', 'sub', 'mul', 'div'):
+            cases += mode_cases(f'f{op}.d fa3, fa0, fa1', [a, b], one_mode(rng, frms),
+                                lambda m: arith(f, op, m, a, b))
+        for name, is_max in (('fmin', False), ('fmax', True)):
+            r, fl = minmax(f, a, b, is_max)
+            cases.append(Case(f'{name}.d fa3, fa0, fa1', rng.choice(frms), [a, b], r, fl))
+        for op in ('eq', 'lt', 'le'):
+            r, fl = compare(f, a, b, op)
+            cases.append(Case(f'f{op}.d a2, fa0, fa1', rng.choice(frms), [a, b], r, fl, True))
+    for a, b in pairs[::7]:
+        sign = b & f.sign
+        cases.append(Case('fsgnj.d fa3, fa0, fa1', RNE, [a, b], (a & ~f.sign) | sign, 0))
+        cases.append(Case('fsgnjn.d fa3, fa0, fa1', RNE, [a, b], (a & ~f.sign) | (sign ^ f.sign), 0))
+        cases.append(Case('fsgnjx.d fa3, fa0, fa1', RNE, [a, b], a ^ sign, 0))
+    for a in values:
+        cases += mode_cases('fsqrt.d fa3, fa0', [a], one_mode(rng, frms), lambda m: arith(f, 'sqrt', m, a))
+        cases += mode_cases('fcvt.w.d a2, fa0', [a], one_mode(rng, frms),
+                            lambda m: fcvt_w(f, a, m, False), True)
+        cases += mode_cases('fcvt.wu.d a2, fa0', [a], one_mode(rng, frms),
+                            lambda m: fcvt_w(f, a, m, True), True)
+        # singles written over doubles must be nan boxed
+        cases += mode_cases('fcvt.s.d fa3, fa0', [a], static_and_dynamic(rng, frms),
+                            lambda m: (lambda r: (r[0] | BOX, r[1]))(convert(f, SINGLE, a, m)))
+        cases.append(Case('fclass.d a2, fa0', RNE, [a], fclass(f, a), 0, True))
+    for x in special_bits(SINGLE) + [random_bits(SINGLE, rng) for _ in range(20)]:
+        r, fl = convert(SINGLE, f, x, RNE)
+        cases.append(Case('fcvt.d.s fa3, fa0', rng.choice(frms), [x | BOX], r, fl))
+    for x in [0, 1, 0x7fffffff, 0x80000000, 0xffffffff] + [rng.getrandbits(32) for _ in range(20)]:
+        for name, unsigned in (('fcvt.d.w', False), ('fcvt.d.wu', True)):
+            r, fl = fcvt_from_w(f, x, RNE, unsigned)
+            cases.append(Case(f'{name} fa3, a0', rng.choice(frms), [x], r, fl))
+    triples = [
+        # a multiply then add rounds to a different result
+        (0x3ff0000000000001, 0x3ff0000000000001, 0xbff0000000000002),
+        # the product alone overflows, or underflows
+        (0x7fe0000000000000, 0x4000000000000000, 0xffefffffffffffff),
+        (0x2000000000000000, 0x2000000000000000, 0x3ff0000000000000),
+        # an inexact product with a nan addend, and an invalid one
+        (0x3ff0000000000001, 0x3ff0000000000001, f.qnan),
+        (f.inf, 0, f.qnan),
+    ]
+    triples += [tuple(rng.choice(values) for _ in range(3)) for _ in range(40)]
+    for a, b, c in triples:
+        cases += fma_cases(f, '.d', a, b, c, one_mode(rng, frms))
+    # singles written over doubles are nan boxed, while fmv.x.w moves the low
+    # bits of a double as they are
+    for a in [f.max, 0x3ff0000000000000, 0xfffffffe3f800000]:
+        cases.append(Case('fmv.x.w a2, fa0', RNE, [a], a & 0xffffffff, 0, True))
+    for x in [0, 0x3f800000, 0x7fc00001, 0xffffffff]:
+        cases.append(Case('fmv.w.x fa3, a0', RNE, [x], x | BOX, 0))
+    return cases
+
+
+def ulp_ties(f, rng, n):
+    """pairs whose sum, difference or product lands halfway between two
+    floats, and some which land just either side"""
+    pairs = []
+    for _ in range(n):
+        a = random_bits(f, rng) & ~f.sign
+        if is_nan(f, a) or a >= f.inf:
+            continue
+        exp = a >> f.frac_bits
+        # half an ulp of a, and an odd number of them
+        half = max(exp - f.frac_bits - 1, 1) << f.frac_bits
+        odd = decode(f, half)[1] * (2 * rng.randint(0, 3) + 1)
+        b, _ = encode(f, odd, RNE)
+        b += rng.choice([0, 0, 0, -1, 1])
+        sign = rng.getrandbits(1) << (f.width - 1)
+        pairs.append((a | sign, b | (f.sign if rng.random() < 0.5 else 0)))
+    # odd significands whose product is one bit too long to fit
+    half = (f.frac_bits + 2) // 2
+    for _ in range(n):
+        x = rng.getrandbits(half) | (1 << half) | 1
+        y = rng.getrandbits(half) | (1 << half) | 1
+        if (x * y).bit_length() != f.frac_bits + 2:
+            continue
+        ex, ey = rng.randint(-20, 20), rng.randint(-20, 20)
+        a, _ = encode(f, Fraction(x) * Fraction(2) ** ex, RNE)
+        b, _ = encode(f, Fraction(y) * Fraction(2) ** ey, RNE)
+        pairs.append((a | (rng.getrandbits(1) << (f.width - 1)), b))
+    return pairs
+
+
+def test_round():
+    """Rounding in every mode, static and through frm, of the arithmetic
+    and conversions, with many ties to tell rne from rmm, which the host
+    has no mode for."""
+    rng = random.Random(20)
+    frms = [m for _, m in MODES]
+    every = [(m, rng.choice([x for x in frms if x != m])) for m in frms]
+    every += [(None, m) for m in frms]
+    cases = []
+    for f, sfx in ((SINGLE, '.s'), (DOUBLE, '.d')):
+        box = BOX if f is SINGLE else 0
+        pairs = ulp_ties(f, rng, 40)
+        # the ties first found between rne and rmm, and ties in subnormals
+        pairs += [(0xc3d90849, 0x42650644), (0x3f800000, 0x33800000), (0xbf800000, 0xb3800000)]
+        pairs += [(0x3ff8000000000000, 0x6d4b9adbebcd1f5e)] if f is DOUBLE else []
+        one = f.bias << f.frac_bits
+        two = (f.bias + 1) << f.frac_bits
+        pairs += [(x, two) for x in (1, 3, 5, f.sign | 1, f.sign | 5)]
+        pairs += [(x, one) for x in (0, f.sign)]
+        for a, b in pairs:
+            for op in ('add', 'sub', 'mul', 'div'):
+                cases += mode_cases(f'f{op}{sfx} fa3, fa0, fa1', [a | box, b | box], every,
+                                    lambda m: (lambda r: (r[0] | box, r[1]))(arith(f, op, m, a, b)))
+        # fused multiply adds whose sum is a tie, or whose product is as -0
+        # leaves it be
+        for a, b in pairs[::2]:
+            for x, y, z in ((a, one, b), (a, b, f.sign)):
+                for case in fma_cases(f, sfx, x, y, z, rng.sample(every, 3)):
+                    case.args = [v | box for v in case.args]
+                    case.expect |= box
+                    cases.append(case)
+    # integers and doubles one bit too long for a single, and some either side
+    ints = [0x1000001, 0x1000003, 0xfeffffff, 0xffffff80, 0xfffffe80, 0x7fffffc0, 0x80000040]
+    ints += [(rng.getrandbits(25) | 1 | (1 << 24)) << rng.randint(0, 7) for _ in range(20)]
+    for x in ints:
+        for name, unsigned in (('fcvt.s.w', False), ('fcvt.s.wu', True)):
+            cases += mode_cases(f'{name} fa3, a0', [x], every,
+                                lambda m: (lambda r: (r[0] | BOX, r[1]))(fcvt_from_w(SINGLE, x, m, unsigned)))
+    doubles = [0x3ff0000010000000, 0xbff0000030000000, 0x3810000010000000, 0x47efffffff000000]
+    for x in ints[7:]:
+        doubles.append(encode(DOUBLE, Fraction(x) * Fraction(2) ** rng.randint(-60, 60), RNE)[0])
+    for x in doubles:
+        cases += mode_cases('fcvt.s.d fa3, fa0', [x], every,
+                            lambda m: (lambda r: (r[0] | BOX, r[1]))(convert(DOUBLE, SINGLE, x, m)))
+    # halves rounded to integers
+    for x in (0x3f000000, 0x3fc00000, 0x40200000, 0xbfc00000, 0xc0200000, 0xbf000000):
+        for name, unsigned in (('fcvt.w.s', False), ('fcvt.wu.s', True)):
+            cases += mode_cases(f'{name} a2, fa0', [x | BOX], every,
+                                lambda m: fcvt_w(SINGLE, x, m, unsigned), True)
+    return cases
+
+
+TESTS = {
+    'fma': test_fma,
+    'double': test_double,
+    'round': test_round,
+}
+
+RUNNER = '''\
+  .equ CASE_SIZE,        48
+  .equ MAX_REPORT,       16
+  .equ NUM_END,          0x20200
+
+  .equ SYS_write,        64
+  .equ SYS_exit,         93
+
+  .text
+  .globl _start
+_start:
+  la s0, cases
+  la s1, cases_end
+  la s2, ops
+  li s3, 0                  # case number
+  li s4, 0                  # failures
+next:
+  bgeu s0, s1, done
+  # operands, the first also as an integer, and frm
+  fld fa0, 8(s0)
+  fld fa1, 16(s0)
+  fld fa2, 24(s0)
+  lw a0, 8(s0)
+  lw t0, 4(s0)
+  fsrm t0
+  # results which are not written show up as these
+  la t0, junk
+  fld fa3, 0(t0)
+  lw a2, 0(t0)
+  lw t0, 0(s0)
+  add t0, s2, t0
+  fsflags zero
+  jalr ra, t0
+  frflags a3
+  # the integer result, or all 64 bits of the float one
+  lw t0, 44(s0)
+  li a4, 0
+  bnez t0, 1f
+  la t0, result
+  fsd fa3, 0(t0)
+  lw a2, 0(t0)
+  lw a4, 4(t0)
+1:
+  lw t0, 32(s0)
+  bne a2, t0, 2f
+  lw t0, 36(s0)
+  bne a4, t0, 2f
+  lw t0, 40(s0)
+  beq a3, t0, 3f
+2:
+  jal ra, report
+3:
+  addi s0, s0, CASE_SIZE
+  addi s3, s3, 1
+  j next
+done:
+  bnez s4, fail
+  la a0, msg_ok
+  jal ra, print_str
+  li a0, 0
+  li a7, SYS_exit
+  ecall
+fail:
+  la a0, msg_fail
+  jal ra, print_str
+  mv a0, s4
+  jal ra, print_uint
+  la a0, msg_of
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_nl
+  jal ra, print_str
+  li a0, 1
+  li a7, SYS_exit
+  ecall
+
+# count a failure and write the first few as "case <n>: <result> <fflags>"
+report:
+  addi s4, s4, 1
+  li t0, MAX_REPORT
+  bgtu s4, t0, 1f
+  mv s5, ra
+  mv s6, a2
+  mv s7, a3
+  mv s8, a4
+  la a0, msg_case
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_colon
+  jal ra, print_str
+  mv a0, s8
+  jal ra, print_hex
+  mv a0, s6
+  jal ra, print_hex
+  la a0, msg_space
+  jal ra, print_str
+  mv a0, s7
+  jal ra, print_hex
+  la a0, msg_nl
+  jal ra, print_str
+  mv ra, s5
+1:
+  ret
+
+# write the string at a0 to stdout
+print_str:
+  mv a1, a0
+  mv a2, a0
+1:
+  lbu t0, 0(a2)
+  beqz t0, 2f
+  addi a2, a2, 1
+  j 1b
+2:
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout in decimal
+print_uint:
+  li a1, NUM_END
+  li t1, 10
+1:
+  remu t0, a0, t1
+  divu a0, a0, t1
+  addi t0, t0, '0'
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  bnez a0, 1b
+  li a2, NUM_END
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout as eight hex digits
+print_hex:
+  li a1, NUM_END
+  li t1, 8
+1:
+  andi t0, a0, 15
+  srli a0, a0, 4
+  addi t0, t0, '0'
+  li t2, '9'
+  bleu t0, t2, 2f
+  addi t0, t0, 'a' - '9' - 1
+2:
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  addi t1, t1, -1
+  bnez t1, 1b
+  li a2, 8
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+'''
+
+
+def emit(name, doc, cases):
+    out = []
+    w = out.append
+    w(f'# fp_{name}.s')
+    w('#')
+    w('#   Generated by fp_gen.py from the exact results of fpref.py, do not edit.')
+    w('#')
+    for line in doc.strip().split('\n'):
+        w('#   ' + ' '.join(line.split()))
+    w('#')
+    w('#   Build:')
+    w(f'#     python3 fp_gen.py {name} > fp_{name}.s')
+    w('#     llvm-mc -triple=riscv32 -mattr=+m,+f,+d,-relax -filetype=obj \\')
+    w(f'#       fp_{name}.s -o fp_{name}.o')
+    w(f'#     ld.lld -Ttext=0x10000 fp_{name}.o -o fp_{name}.elf')
+    w('')
+    w(RUNNER)
+    # one stub per distinct instruction, each eight bytes
+    stubs = {}
+    for case in cases:
+        stubs.setdefault(case.inst, len(stubs) * 8)
+    w('  .option push')
+    w('  .option norvc')
+    w('ops:')
+    for inst in stubs:
+        w(f'  {inst}')
+        w('  ret')
+    w('  .option pop')
+    w('')
+    w('  .data')
+    w('  .p2align 3')
+    w('junk:      .word 0x89abcdef, 0x01234567')
+    w('result:    .word 0, 0')
+    w('# stub offset, frm, three operands, expected result, fflags, integer result')
+    w('cases:')
+    for case in cases:
+        words = [stubs[case.inst], case.frm]
+        for x in (case.args + [0, 0, 0])[:3] + [case.expect]:
+            words += [x & 0xffffffff, x >> 32]
+        words += [case.flags, int(case.int_result)]
+        w('  .word ' + ', '.join(f'0x{x:x}' for x in words))
+    w('cases_end:')
+    w('')
+    w(f'msg_ok:    .asciz "fp {name}: ok\\n"')
+    w(f'msg_fail:  .asciz "fp {name}: FAIL "')
+    w('msg_of:    .asciz " of "')
+    w('msg_case:  .asciz "case "')
+    w('msg_colon: .asciz ": "')
+    w('msg_space: .asciz " "')
+    w('msg_nl:    .asciz "\\n"')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    if len(sys.argv) != 2 or sys.argv[1] not in TESTS:
+        sys.exit(f'usage: fp_gen.py <{"|".join(TESTS)}>')
+    test = TESTS[sys.argv[1]]
+    sys.stdout.write(emit(sys.argv[1], test.__doc__, test()))
+
+
+if __name__ == '__main__':
+    main()
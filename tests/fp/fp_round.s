@@ -0,0 +1,7507 @@
+# fp_round.s
+#
+#   Generated by fp_gen.py from the exact results of fpref.py, do not edit.
+#
+#   Rounding in every mode, static and through frm, of the arithmetic
+#   and conversions, with many ties to tell rne from rmm, which the host
+#   has no mode for.
+#
+#   Build:
+#     python3 fp_gen.py round > fp_round.s
+#     llvm-mc -triple=riscv32 -mattr=+m,+f,+d,-relax -filetype=obj \
+#       fp_round.s -o fp_round.o
+#     ld.lld -Ttext=0x10000 fp_round.o -o fp_round.elf
+
+  .equ CASE_SIZE,        48
+  .equ MAX_REPORT,       16
+  .equ NUM_END,          0x20200
+
+  .equ SYS_write,        64
+  .equ SYS_exit,         93
+
+  .text
+  .globl _start
+_start:
+  la s0, cases
+  la s1, cases_end
+  la s2, ops
+  li s3, 0                  # case number
+  li s4, 0                  # failures
+next:
+  bgeu s0, s1, done
+  # operands, the first also as an integer, and frm
+  fld fa0, 8(s0)
+  fld fa1, 16(s0)
+  fld fa2, 24(s0)
+  lw a0, 8(s0)
+  lw t0, 4(s0)
+  fsrm t0
+  # results which are not written show up as these
+  la t0, junk
+  fld fa3, 0(t0)
+  lw a2, 0(t0)
+  lw t0, 0(s0)
+  add t0, s2, t0
+  fsflags zero
+  jalr ra, t0
+  frflags a3
+  # the integer result, or all 64 bits of the float one
+  lw t0, 44(s0)
+  li a4, 0
+  bnez t0, 1f
+  la t0, result
+  fsd fa3, 0(t0)
+  lw a2, 0(t0)
+  lw a4, 4(t0)
+1:
+  lw t0, 32(s0)
+  bne a2, t0, 2f
+  lw t0, 36(s0)
+  bne a4, t0, 2f
+  lw t0, 40(s0)
+  beq a3, t0, 3f
+2:
+  jal ra, report
+3:
+  addi s0, s0, CASE_SIZE
+  addi s3, s3, 1
+  j next
+done:
+  bnez s4, fail
+  la a0, msg_ok
+  jal ra, print_str
+  li a0, 0
+  li a7, SYS_exit
+  ecall
+fail:
+  la a0, msg_fail
+  jal ra, print_str
+  mv a0, s4
+  jal ra, print_uint
+  la a0, msg_of
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_nl
+  jal ra, print_str
+  li a0, 1
+  li a7, SYS_exit
+  ecall
+
+# count a failure and write the first few as "case <n>: <result> <fflags>"
+report:
+  addi s4, s4, 1
+  li t0, MAX_REPORT
+  bgtu s4, t0, 1f
+  mv s5, ra
+  mv s6, a2
+  mv s7, a3
+  mv s8, a4
+  la a0, msg_case
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_colon
+  jal ra, print_str
+  mv a0, s8
+  jal ra, print_hex
+  mv a0, s6
+  jal ra, print_hex
+  la a0, msg_space
+  jal ra, print_str
+  mv a0, s7
+  jal ra, print_hex
+  la a0, msg_nl
+  jal ra, print_str
+  mv ra, s5
+1:
+  ret
+
+# write the string at a0 to stdout
+print_str:
+  mv a1, a0
+  mv a2, a0
+1:
+  lbu t0, 0(a2)
+  beqz t0, 2f
+  addi a2, a2, 1
+  j 1b
+2:
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout in decimal
+print_uint:
+  li a1, NUM_END
+  li t1, 10
+1:
+  remu t0, a0, t1
+  divu a0, a0, t1
+  addi t0, t0, '0'
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  bnez a0, 1b
+  li a2, NUM_END
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout as eight hex digits
+print_hex:
+  li a1, NUM_END
+  li t1, 8
+1:
+  andi t0, a0, 15
+  srli a0, a0, 4
+  addi t0, t0, '0'
+  li t2, '9'
+  bleu t0, t2, 2f
+  addi t0, t0, 'a' - '9' - 1
+2:
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  addi t1, t1, -1
+  bnez t1, 1b
+  li a2, 8
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+  .option push
+  .option norvc
+ops:
+  fadd.s fa3, fa0, fa1, rne
+  ret
+  fadd.s fa3, fa0, fa1, rtz
+  ret
+  fadd.s fa3, fa0, fa1, rdn
+  ret
+  fadd.s fa3, fa0, fa1, rup
+  ret
+  fadd.s fa3, fa0, fa1, rmm
+  ret
+  fadd.s fa3, fa0, fa1
+  ret
+  fsub.s fa3, fa0, fa1, rne
+  ret
+  fsub.s fa3, fa0, fa1, rtz
+  ret
+  fsub.s fa3, fa0, fa1, rdn
+  ret
+  fsub.s fa3, fa0, fa1, rup
+  ret
+  fsub.s fa3, fa0, fa1, rmm
+  ret
+  fsub.s fa3, fa0, fa1
+  ret
+  fmul.s fa3, fa0, fa1, rne
+  ret
+  fmul.s fa3, fa0, fa1, rtz
+  ret
+  fmul.s fa3, fa0, fa1, rdn
+  ret
+  fmul.s fa3, fa0, fa1, rup
+  ret
+  fmul.s fa3, fa0, fa1, rmm
+  ret
+  fmul.s fa3, fa0, fa1
+  ret
+  fdiv.s fa3, fa0, fa1, rne
+  ret
+  fdiv.s fa3, fa0, fa1, rtz
+  ret
+  fdiv.s fa3, fa0, fa1, rdn
+  ret
+  fdiv.s fa3, fa0, fa1, rup
+  ret
+  fdiv.s fa3, fa0, fa1, rmm
+  ret
+  fdiv.s fa3, fa0, fa1
+  ret
+  fmadd.s fa3, fa0, fa1, fa2
+  ret
+  fmadd.s fa3, fa0, fa1, fa2, rtz
+  ret
+  fmadd.s fa3, fa0, fa1, fa2, rne
+  ret
+  fmsub.s fa3, fa0, fa1, fa2
+  ret
+  fmsub.s fa3, fa0, fa1, fa2, rtz
+  ret
+  fmsub.s fa3, fa0, fa1, fa2, rne
+  ret
+  fnmsub.s fa3, fa0, fa1, fa2
+  ret
+  fnmsub.s fa3, fa0, fa1, fa2, rtz
+  ret
+  fnmsub.s fa3, fa0, fa1, fa2, rne
+  ret
+  fnmadd.s fa3, fa0, fa1, fa2
+  ret
+  fnmadd.s fa3, fa0, fa1, fa2, rtz
+  ret
+  fnmadd.s fa3, fa0, fa1, fa2, rne
+  ret
+  fmadd.s fa3, fa0, fa1, fa2, rmm
+  ret
+  fmsub.s fa3, fa0, fa1, fa2, rmm
+  ret
+  fnmsub.s fa3, fa0, fa1, fa2, rmm
+  ret
+  fnmadd.s fa3, fa0, fa1, fa2, rmm
+  ret
+  fmadd.s fa3, fa0, fa1, fa2, rdn
+  ret
+  fmsub.s fa3, fa0, fa1, fa2, rdn
+  ret
+  fnmsub.s fa3, fa0, fa1, fa2, rdn
+  ret
+  fnmadd.s fa3, fa0, fa1, fa2, rdn
+  ret
+  fmadd.s fa3, fa0, fa1, fa2, rup
+  ret
+  fmsub.s fa3, fa0, fa1, fa2, rup
+  ret
+  fnmsub.s fa3, fa0, fa1, fa2, rup
+  ret
+  fnmadd.s fa3, fa0, fa1, fa2, rup
+  ret
+  fadd.d fa3, fa0, fa1, rne
+  ret
+  fadd.d fa3, fa0, fa1, rtz
+  ret
+  fadd.d fa3, fa0, fa1, rdn
+  ret
+  fadd.d fa3, fa0, fa1, rup
+  ret
+  fadd.d fa3, fa0, fa1, rmm
+  ret
+  fadd.d fa3, fa0, fa1
+  ret
+  fsub.d fa3, fa0, fa1, rne
+  ret
+  fsub.d fa3, fa0, fa1, rtz
+  ret
+  fsub.d fa3, fa0, fa1, rdn
+  ret
+  fsub.d fa3, fa0, fa1, rup
+  ret
+  fsub.d fa3, fa0, fa1, rmm
+  ret
+  fsub.d fa3, fa0, fa1
+  ret
+  fmul.d fa3, fa0, fa1, rne
+  ret
+  fmul.d fa3, fa0, fa1, rtz
+  ret
+  fmul.d fa3, fa0, fa1, rdn
+  ret
+  fmul.d fa3, fa0, fa1, rup
+  ret
+  fmul.d fa3, fa0, fa1, rmm
+  ret
+  fmul.d fa3, fa0, fa1
+  ret
+  fdiv.d fa3, fa0, fa1, rne
+  ret
+  fdiv.d fa3, fa0, fa1, rtz
+  ret
+  fdiv.d fa3, fa0, fa1, rdn
+  ret
+  fdiv.d fa3, fa0, fa1, rup
+  ret
+  fdiv.d fa3, fa0, fa1, rmm
+  ret
+  fdiv.d fa3, fa0, fa1
+  ret
+  fmadd.d fa3, fa0, fa1, fa2, rmm
+  ret
+  fmadd.d fa3, fa0, fa1, fa2, rdn
+  ret
+  fmadd.d fa3, fa0, fa1, fa2, rtz
+  ret
+  fmsub.d fa3, fa0, fa1, fa2, rmm
+  ret
+  fmsub.d fa3, fa0, fa1, fa2, rdn
+  ret
+  fmsub.d fa3, fa0, fa1, fa2, rtz
+  ret
+  fnmsub.d fa3, fa0, fa1, fa2, rmm
+  ret
+  fnmsub.d fa3, fa0, fa1, fa2, rdn
+  ret
+  fnmsub.d fa3, fa0, fa1, fa2, rtz
+  ret
+  fnmadd.d fa3, fa0, fa1, fa2, rmm
+  ret
+  fnmadd.d fa3, fa0, fa1, fa2, rdn
+  ret
+  fnmadd.d fa3, fa0, fa1, fa2, rtz
+  ret
+  fmadd.d fa3, fa0, fa1, fa2
+  ret
+  fmsub.d fa3, fa0, fa1, fa2
+  ret
+  fnmsub.d fa3, fa0, fa1, fa2
+  ret
+  fnmadd.d fa3, fa0, fa1, fa2
+  ret
+  fmadd.d fa3, fa0, fa1, fa2, rup
+  ret
+  fmsub.d fa3, fa0, fa1, fa2, rup
+  ret
+  fnmsub.d fa3, fa0, fa1, fa2, rup
+  ret
+  fnmadd.d fa3, fa0, fa1, fa2, rup
+  ret
+  fmadd.d fa3, fa0, fa1, fa2, rne
+  ret
+  fmsub.d fa3, fa0, fa1, fa2, rne
+  ret
+  fnmsub.d fa3, fa0, fa1, fa2, rne
+  ret
+  fnmadd.d fa3, fa0, fa1, fa2, rne
+  ret
+  fcvt.s.w fa3, a0, rne
+  ret
+  fcvt.s.w fa3, a0, rtz
+  ret
+  fcvt.s.w fa3, a0, rdn
+  ret
+  fcvt.s.w fa3, a0, rup
+  ret
+  fcvt.s.w fa3, a0, rmm
+  ret
+  fcvt.s.w fa3, a0
+  ret
+  fcvt.s.wu fa3, a0, rne
+  ret
+  fcvt.s.wu fa3, a0, rtz
+  ret
+  fcvt.s.wu fa3, a0, rdn
+  ret
+  fcvt.s.wu fa3, a0, rup
+  ret
+  fcvt.s.wu fa3, a0, rmm
+  ret
+  fcvt.s.wu fa3, a0
+  ret
+  fcvt.s.d fa3, fa0, rne
+  ret
+  fcvt.s.d fa3, fa0, rtz
+  ret
+  fcvt.s.d fa3, fa0, rdn
+  ret
+  fcvt.s.d fa3, fa0, rup
+  ret
+  fcvt.s.d fa3, fa0, rmm
+  ret
+  fcvt.s.d fa3, fa0
+  ret
+  fcvt.w.s a2, fa0, rne
+  ret
+  fcvt.w.s a2, fa0, rtz
+  ret
+  fcvt.w.s a2, fa0, rdn
+  ret
+  fcvt.w.s a2, fa0, rup
+  ret
+  fcvt.w.s a2, fa0, rmm
+  ret
+  fcvt.w.s a2, fa0
+  ret
+  fcvt.wu.s a2, fa0, rne
+  ret
+  fcvt.wu.s a2, fa0, rtz
+  ret
+  fcvt.wu.s a2, fa0, rdn
+  ret
+  fcvt.wu.s a2, fa0, rup
+  ret
+  fcvt.wu.s a2, fa0, rmm
+  ret
+  fcvt.wu.s a2, fa0
+  ret
+  .option pop
+
+  .data
+  .p2align 3
+junk:      .word 0x89abcdef, 0x01234567
+result:    .word 0, 0
+# stub offset, frm, three operands, expected result, fflags, integer result
+cases:
+  .word 0x0, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999dd, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999dd, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999dd, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999dd, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999df, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999df, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999df, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0x3d8999df, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xcb8999de, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xcb8999de, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xcb8999de, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xcb8999de, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xcb8999de, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xcb8999de, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xcb8999de, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xcb8999de, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xcb8999de, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x0, 0x0, 0xcb8999de, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999390, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999390, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999390, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999391, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999391, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999390, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999390, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999390, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999391, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999391, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999396, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999395, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999395, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999396, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999396, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999396, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999395, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999395, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999396, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0x3d999396, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xb0bff878, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xb0bff877, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xb0bff878, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xb0bff877, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xb0bff878, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xb0bff878, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xb0bff877, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xb0bff878, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xb0bff877, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xb0bff878, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xca75b8eb, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xca75b8eb, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xca75b8ec, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xca75b8eb, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xca75b8eb, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xca75b8eb, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xca75b8eb, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xca75b8ec, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xca75b8eb, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x3d999393, 0xffffffff, 0xb2a00000, 0xffffffff, 0x0, 0x0, 0xca75b8eb, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2af, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2ae, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2ae, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2af, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2af, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2af, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2ae, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2ae, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2af, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2af, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2b6, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2b6, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0x4e3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xd223785c, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xd223785c, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xca558316, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xca558315, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xca558316, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xca558315, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xca558316, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xca558316, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xca558315, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xca558316, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xca558315, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x0, 0x0, 0xca558316, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85c, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85c, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85d, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85c, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85c, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85c, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85c, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85d, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab860, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85f, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab860, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85f, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab860, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab860, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab860, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab85f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xb68ab860, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xa250148d, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xa250148d, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xa250148d, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xa250148d, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xa250148d, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xa250148d, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xa250148d, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xa250148d, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xa250148d, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xa250148d, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xcab8f5d3, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xcab8f5d2, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xcab8f5d3, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xcab8f5d2, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xcab8f5d3, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xcab8f5d3, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xcab8f5d2, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xcab8f5d3, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xcab8f5d2, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xb68ab85e, 0xffffffff, 0x2b400000, 0xffffffff, 0x0, 0x0, 0xcab8f5d3, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd4, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd3, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd3, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd4, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd4, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd4, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd3, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd3, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd4, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd4, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd2, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd2, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd2, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd3, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd2, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd2, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd2, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x38cfddd3, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x4bcfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x4bcfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x4bcfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x4bcfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x4bcfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x4bcfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x4bcfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x4bcfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x4bcfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x0, 0x0, 0x4bcfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017c, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017c, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017c, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017d, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017c, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017c, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017c, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017d, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017a, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c0179, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c0179, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017a, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c0179, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c0179, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x383c017a, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x258d011c, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x258d011c, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x258d011c, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x258d011d, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x258d011c, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x258d011c, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x258d011c, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x258d011c, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x258d011d, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x258d011c, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x4afaaca4, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x4afaaca4, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x4afaaca4, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x4afaaca4, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x4afaaca4, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x4afaaca4, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x4afaaca4, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x4afaaca4, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x4afaaca4, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x383c017b, 0xffffffff, 0x2cc00000, 0xffffffff, 0x0, 0x0, 0x4afaaca4, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a226, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a226, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a227, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a226, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a227, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a226, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a226, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a227, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a226, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a227, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a22a, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a229, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a22a, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a229, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a22a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a22a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a229, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a22a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a229, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc786a22a, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xcab382e0, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xcab382e0, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xcab382e0, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xcab382e0, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xcab382e0, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xcab382e0, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xcab382e0, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xcab382e0, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xcab382e0, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x0, 0x0, 0xcab382e0, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246346, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246345, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246346, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246345, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246346, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246346, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246345, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246346, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246345, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246346, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246340, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246340, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246341, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246340, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246340, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246340, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246340, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246341, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246340, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0xec246340, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x68, 0x3, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x70, 0x0, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x78, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x80, 0x1, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x0, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x1, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x3, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x4, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x90, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x4a83829b, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x4a83829b, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x4a83829b, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x4a83829c, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x4a83829b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x4a83829b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x4a83829b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x4a83829b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x4a83829c, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xec246343, 0xffffffff, 0xe1200001, 0xffffffff, 0x0, 0x0, 0x4a83829b, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5e, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5e, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5e, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c60, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c60, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c60, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c60, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c60, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xce6e7c60, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xcbee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xcbee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xcbee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xcbee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xcbee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xcbee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xcbee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xcbee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xcbee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x0, 0x0, 0xcbee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122b, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122b, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122b, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122c, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122b, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122b, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122b, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122b, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122c, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122b, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122d, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122c, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122c, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122d, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0x37f4122d, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xa3f4122e, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xa3f4122d, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xa3f4122e, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xa3f4122d, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xa3f4122e, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xa3f4122e, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xa3f4122d, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xa3f4122e, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xa3f4122d, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xa3f4122e, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xcbf4122a, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xcbf4122a, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xcbf4122b, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xcbf4122a, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xcbf4122a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xcbf4122a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xcbf4122a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xcbf4122b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xcbf4122a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x37f4122c, 0xffffffff, 0xab800001, 0xffffffff, 0x0, 0x0, 0xcbf4122a, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e85419, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e85419, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e85419, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e85419, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541b, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541b, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541b, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xd6e8541b, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xcbe8541a, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xcbe8541a, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xcbe8541a, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xcbe8541a, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xcbe8541a, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xcbe8541a, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xcbe8541a, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xcbe8541a, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xcbe8541a, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x0, 0x0, 0xcbe8541a, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285c9d, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285c9c, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285c9d, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285c9c, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285c9d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285c9d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285c9c, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285c9d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285c9c, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285c9d, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285ca3, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285ca3, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285ca4, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285ca3, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285ca3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285ca3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285ca3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285ca4, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285ca3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc5285ca3, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc013510b, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc013510b, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc013510c, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc013510b, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc013510b, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc013510b, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc013510b, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc013510c, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc013510b, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xc013510b, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xca4069dc, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xca4069dc, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xca4069dd, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xca4069dc, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xca4069dc, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xca4069dc, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xca4069dc, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xca4069dd, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xca4069dc, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xc5285ca0, 0xffffffff, 0x3a5fffff, 0xffffffff, 0x0, 0x0, 0xca4069dc, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f88230, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f88230, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f88231, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f88230, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f88231, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f88230, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f88230, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f88231, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f88230, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f88231, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f8822e, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f8822d, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f8822e, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f8822d, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f8822e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f8822e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f8822d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f8822e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f8822d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0xd5f8822e, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x60ba61a4, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x60ba61a4, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x4b25ac1f, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x4b25ac1f, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x4b25ac1f, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x4b25ac20, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x4b25ac1f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x4b25ac1f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x4b25ac1f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x4b25ac1f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x4b25ac20, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x0, 0x0, 0x4b25ac1f, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa583, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa583, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa583, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa583, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa585, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa585, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa584, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa585, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x32dfa585, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x99dfa584, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x99dfa584, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x99dfa584, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x99dfa584, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x99dfa584, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x99dfa584, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x99dfa584, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x99dfa584, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x99dfa584, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0x99dfa584, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0xcbdfa584, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0xcbdfa584, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0xcbdfa584, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0xcbdfa584, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0xcbdfa584, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0xcbdfa584, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0xcbdfa584, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0xcbdfa584, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0xcbdfa584, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x32dfa584, 0xffffffff, 0xa6800000, 0xffffffff, 0x0, 0x0, 0xcbdfa584, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68775, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68775, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68775, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68775, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68777, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68777, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68777, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0x45a68777, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xcba68776, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xcba68776, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xcba68776, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xcba68776, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xcba68776, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xcba68776, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xcba68776, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xcba68776, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xcba68776, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x0, 0x0, 0xcba68776, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b64, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b64, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b65, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b64, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b65, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b64, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b64, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b65, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b64, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b65, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b62, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b61, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b62, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b61, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b62, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b62, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b61, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b62, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b61, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0xb0830b62, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x16449114, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x16449114, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x16449114, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x16449115, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x16449115, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x16449114, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x16449114, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x16449114, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x16449115, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x16449115, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x4aaeb9d9, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x4aaeb9d9, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x4aaeb9d9, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x4aaeb9da, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x4aaeb9d9, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x4aaeb9d9, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x4aaeb9d9, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x4aaeb9d9, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x4aaeb9da, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xb0830b63, 0xffffffff, 0xa5400000, 0xffffffff, 0x0, 0x0, 0x4aaeb9d9, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77e, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77d, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77e, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77d, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77e, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77a, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77a, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77b, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77a, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77b, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77b, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0xbc9be77b, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x4acfdf50, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x4acfdf50, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x4acfdf50, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x4acfdf50, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x4acfdf50, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x4acfdf50, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x4acfdf50, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x4acfdf50, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x4acfdf50, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x0, 0x0, 0x4acfdf50, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4a, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e49, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e49, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4a, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4a, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4a, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e49, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e49, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4a, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4a, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4c, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4c, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4c, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4d, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0x42716e4d, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xb9b512b8, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xb9b512b8, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xb9b512b9, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xb9b512b8, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xb9b512b8, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xb9b512b8, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xb9b512b8, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xb9b512b9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xb9b512b8, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xb9b512b8, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xcb20f432, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xcb20f432, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xcb20f432, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xcb20f432, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xcb20f432, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xcb20f432, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xcb20f432, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xcb20f432, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xcb20f432, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x42716e4b, 0xffffffff, 0xb6c00000, 0xffffffff, 0x0, 0x0, 0xcb20f432, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d854, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d854, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d855, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d854, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d855, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d854, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d854, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d855, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d854, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d855, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d85c, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d85b, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d85c, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d85b, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d85c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d85c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d85b, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d85c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d85b, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcaa7d85c, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xca3fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xca3fd2ad, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xca3fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xca3fd2ad, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xca3fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xca3fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xca3fd2ad, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xca3fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xca3fd2ad, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x0, 0x0, 0xca3fd2ae, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x4412695f, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x4412695f, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x4412695f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x4412695f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126961, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126961, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126960, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126961, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0x44126961, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xbc926960, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xbc926960, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xbc926960, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xbc926960, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xbc926960, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xbc926960, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xbc926960, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xbc926960, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xbc926960, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xbc926960, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xcb926960, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xcb926960, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xcb926960, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xcb926960, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xcb926960, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xcb926960, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xcb926960, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xcb926960, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xcb926960, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x44126960, 0xffffffff, 0xb8000000, 0xffffffff, 0x0, 0x0, 0xcb926960, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429ea, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429ea, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429eb, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429ea, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429ea, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429ea, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429ea, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429eb, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429ea, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429ea, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429e4, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429e3, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429e4, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429e3, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429e4, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429e4, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429e3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429e4, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429e3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0xc82429e4, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x460fa4aa, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x460fa4aa, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x4a3b9d9b, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x4a3b9d9b, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x4a3b9d9b, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x4a3b9d9c, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x4a3b9d9b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x4a3b9d9b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x4a3b9d9b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x4a3b9d9b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x4a3b9d9c, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x0, 0x0, 0x4a3b9d9b, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dd0, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dcf, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dcf, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dd0, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dd0, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dd0, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dcf, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dcf, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dd0, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dd0, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dce, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dce, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dce, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dcf, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dce, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dce, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dce, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dce, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dcf, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x37757dce, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x22f57dd1, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x22f57dd0, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x22f57dd0, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x22f57dd1, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x22f57dd1, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x22f57dd1, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x22f57dd0, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x22f57dd0, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x22f57dd1, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x22f57dd1, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x4bf57dcd, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x4bf57dcd, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x4bf57dcd, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x4bf57dce, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x4bf57dcd, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x4bf57dcd, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x4bf57dcd, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x4bf57dcd, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x4bf57dce, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x37757dcf, 0xffffffff, 0x2b000001, 0xffffffff, 0x0, 0x0, 0x4bf57dcd, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc8a, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc89, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc89, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc8a, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc8a, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc8a, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc89, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc89, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc8a, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc8a, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc86, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc86, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc86, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc87, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc87, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc86, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc86, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc86, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc87, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x3b01fc87, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x4aad50b5, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x4aad50b5, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x4aad50b5, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x4aad50b6, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x4aad50b5, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x4aad50b5, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x4aad50b5, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x4aad50b5, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x4aad50b6, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x0, 0x0, 0x4aad50b5, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x810fd55d, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x810fd55d, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x810fd55d, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x810fd55d, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x810fd55d, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x810fd55d, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x810fd55d, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x810fd55d, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x810fd55d, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x810fd55d, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x801faaba, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x801faaba, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x801faaba, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x801faaba, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x801faaba, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x801faaba, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x801faaba, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x801faaba, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x801faaba, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x801faaba, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x68, 0x3, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x70, 0x0, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x78, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0x80, 0x1, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x0, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x1, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x3, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x4, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x90, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x3f9faaba, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x3f9faaba, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x3f9faaba, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x3f9faaba, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x3f9faaba, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x3f9faaba, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x3f9faaba, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x3f9faaba, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x3f9faaba, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x809faaba, 0xffffffff, 0x80800000, 0xffffffff, 0x0, 0x0, 0x3f9faaba, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84e, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84d, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84e, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84d, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84e, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84c, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84c, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84d, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84c, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84c, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0xb047d84c, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x14c7d84f, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x14c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x14c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x14c7d84f, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x14c7d84f, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x14c7d84f, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x14c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x14c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x14c7d84f, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x14c7d84f, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x4bc7d84b, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x4bc7d84b, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x4bc7d84b, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x4bc7d84c, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x4bc7d84b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x4bc7d84b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x4bc7d84b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x4bc7d84b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x4bc7d84c, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x0, 0x0, 0x4bc7d84b, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86e, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86d, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86d, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86e, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86e, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86a, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86a, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86a, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86b, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86b, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x3253d86a, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x199ee252, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x199ee251, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x199ee251, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x199ee252, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x199ee252, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x199ee252, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x199ee251, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x199ee251, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x199ee252, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x199ee252, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x4b0d3af2, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x4b0d3af1, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x4b0d3af1, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x4b0d3af2, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x4b0d3af2, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x4b0d3af2, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x4b0d3af1, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x4b0d3af1, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x4b0d3af2, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x3253d86c, 0xffffffff, 0x26c00001, 0xffffffff, 0x0, 0x0, 0x4b0d3af2, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd007778, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd007777, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd007778, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd007777, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd007778, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd007778, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd007777, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd007778, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd007777, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd007778, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd00777e, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd00777e, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd00777f, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd00777e, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd00777f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd00777e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd00777e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd00777f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd00777e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xbd00777f, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xafe0d118, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xafe0d118, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xca12d1b1, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xca12d1b1, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xca12d1b2, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xca12d1b1, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xca12d1b1, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xca12d1b1, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xca12d1b1, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xca12d1b2, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xca12d1b1, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x0, 0x0, 0xca12d1b1, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed0, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ecf, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ecf, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed0, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed0, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed0, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ecf, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ecf, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed0, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed0, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed6, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed6, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed6, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed7, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed7, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed6, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed6, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed6, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed7, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0x49257ed7, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xc810cef9, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xc810cef8, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xc810cef9, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xc810cef8, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xc810cef9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xc810cef9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xc810cef8, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xc810cef9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xc810cef8, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xc810cef9, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xca3d233a, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xca3d233a, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xca3d233b, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xca3d233a, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xca3d233a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xca3d233a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xca3d233a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xca3d233b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xca3d233a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x49257ed3, 0xffffffff, 0xbe600000, 0xffffffff, 0x0, 0x0, 0xca3d233a, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48bade2, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48bade2, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48bade3, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48bade2, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48bade3, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48bade2, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48bade2, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48bade3, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48bade2, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48bade3, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48badde, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48baddd, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48badde, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48baddd, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48badde, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48badde, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48baddd, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48badde, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48baddd, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0xb48badde, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x4a5f7c9a, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x4a5f7c99, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x4a5f7c99, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x4a5f7c9a, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x4a5f7c9a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x4a5f7c9a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x4a5f7c99, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x4a5f7c99, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x4a5f7c9a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x0, 0x0, 0x4a5f7c9a, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d5, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d5, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d5, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d5, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d3, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d3, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0xb56346d4, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x1ee346d4, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x1ee346d4, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x1ee346d4, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x1ee346d4, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x1ee346d4, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x1ee346d4, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x1ee346d4, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x1ee346d4, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x1ee346d4, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x1ee346d4, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x4be346d4, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x4be346d4, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x4be346d4, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x4be346d4, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x4be346d4, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x4be346d4, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x4be346d4, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x4be346d4, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x4be346d4, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0xb56346d4, 0xffffffff, 0xa9000000, 0xffffffff, 0x0, 0x0, 0x4be346d4, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb137600e, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb137600d, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb137600e, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb137600d, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb137600e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb137600e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb137600d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb137600e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb137600d, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb137600e, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb1376006, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb1376006, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb1376007, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb1376006, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb1376007, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb1376006, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb1376006, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb1376007, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb1376006, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0xb1376007, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x18207409, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x18207408, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x18207408, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x18207409, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x18207409, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x18207409, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x18207408, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x18207408, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x18207409, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x18207409, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x4a519255, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x4a519254, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x4a519254, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x4a519255, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x4a519255, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x4a519255, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x4a519254, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x4a519254, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x4a519255, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x0, 0x0, 0x4a519255, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e169, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e169, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16a, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e169, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e169, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e169, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e169, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16a, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e169, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e169, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16f, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16e, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16f, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16e, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xc1d9e16f, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xb9082ce4, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xb9082ce4, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xb9082ce5, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xb9082ce4, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xb9082ce4, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xb9082ce4, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xb9082ce4, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xb9082ce5, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xb9082ce4, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xb9082ce4, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xcaae4def, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xcaae4dee, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xcaae4def, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xcaae4dee, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xcaae4def, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xcaae4def, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xcaae4dee, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xcaae4def, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xcaae4dee, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xc1d9e16c, 0xffffffff, 0x36a00001, 0xffffffff, 0x0, 0x0, 0xcaae4def, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e6f, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e6f, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e6f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e6f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e71, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e71, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x68, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x70, 0x0, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x78, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x80, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x0, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x4, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x90, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0xcbe34e71, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0xcbe34e70, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0xcbe34e71, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0xcbe34e70, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0xcbe34e71, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0xcbe34e71, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0xcbe34e70, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0xcbe34e71, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0xcbe34e70, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x0, 0x0, 0xcbe34e71, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0915, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0914, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0914, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0915, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0915, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0915, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0914, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0914, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0915, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0915, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0917, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0917, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0917, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0918, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0917, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0917, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0917, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0917, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0918, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0x45ed0917, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xc0b1c6d0, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xc0b1c6cf, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xc0b1c6d0, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xc0b1c6cf, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xc0b1c6d0, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xc0b1c6d0, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xc0b1c6cf, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xc0b1c6d0, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xc0b1c6cf, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xc0b1c6d0, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xcb1e060f, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xcb1e060f, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xcb1e0610, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xcb1e060f, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xcb1e060f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xcb1e060f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xcb1e060f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xcb1e0610, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xcb1e060f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x45ed0916, 0xffffffff, 0xba3fffff, 0xffffffff, 0x0, 0x0, 0xcb1e060f, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fb, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fb, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fe, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fd, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fe, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fd, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fe, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fe, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fd, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fe, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fd, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xfd9d94fe, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x68, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x70, 0x0, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x78, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x80, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x0, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x88, 0x4, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x90, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xcad21bfa, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xcad21bf9, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xcad21bfa, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xcad21bf9, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xcad21bfa, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xcad21bfa, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xcad21bf9, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xcad21bfa, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xcad21bf9, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x0, 0x0, 0xcad21bfa, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a1, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a1, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a1, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a2, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a1, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a1, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a1, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a1, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a2, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a1, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a3, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a2, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a2, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a3, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a2, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a2, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x253548a3, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x800b548a, 0xffffffff, 0x3, 0x0
+  .word 0x68, 0x3, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x800b548a, 0xffffffff, 0x3, 0x0
+  .word 0x70, 0x0, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x800b548b, 0xffffffff, 0x3, 0x0
+  .word 0x78, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x800b548a, 0xffffffff, 0x3, 0x0
+  .word 0x80, 0x1, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x800b548a, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x0, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x800b548a, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x1, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x800b548a, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x800b548b, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x3, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x800b548a, 0xffffffff, 0x3, 0x0
+  .word 0x88, 0x4, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0x800b548a, 0xffffffff, 0x3, 0x0
+  .word 0x90, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0xcbb548a1, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0xcbb548a0, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0xcbb548a1, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0xcbb548a0, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0xcbb548a1, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0xcbb548a1, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0xcbb548a0, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0xcbb548a1, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0xcbb548a0, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x253548a2, 0xffffffff, 0x99000001, 0xffffffff, 0x0, 0x0, 0xcbb548a1, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d56, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d56, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d57, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d56, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d57, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d56, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d56, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d57, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d56, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d57, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d5e, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d5d, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d5e, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d5d, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d5e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d5e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d5d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d5e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d5d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xc0a74d5e, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xb71263af, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xb71263ae, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xb71263af, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xb71263ae, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xb71263af, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xb71263af, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xb71263ae, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xb71263af, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xb71263ae, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xb71263af, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xca3f33d5, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xca3f33d4, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xca3f33d5, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xca3f33d4, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xca3f33d5, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xca3f33d5, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xca3f33d4, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xca3f33d5, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xca3f33d4, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x0, 0x0, 0xca3f33d5, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9e, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9e, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9e, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9f, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9f, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88ca0, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9f, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9f, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88ca0, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88ca0, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88ca0, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88c9f, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88ca0, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0x4cc88ca0, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcdc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcdc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcdc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcdc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcdc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcdc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcdc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcdc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcdc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcdc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcbc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcbc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcbc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcbc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcbc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcbc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcbc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcbc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcbc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x4cc88c9f, 0xffffffff, 0xc0800000, 0xffffffff, 0x0, 0x0, 0xcbc88c9f, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eae, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0ead, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0ead, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eae, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eae, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eae, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0ead, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0ead, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eae, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eae, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eb2, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eb2, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eb2, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eb3, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eb3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eb2, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eb2, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eb2, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eb3, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x295a0eb3, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0xcaae7226, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0xcaae7226, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0xcaae7227, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0xcaae7226, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0xcaae7226, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0xcaae7226, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0xcaae7226, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0xcaae7227, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0xcaae7226, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x0, 0x0, 0xcaae7226, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b272, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b271, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b272, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b271, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b272, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b272, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b271, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b272, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b271, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b272, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b26a, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b26a, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b26b, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b26a, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b26b, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b26a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b26a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b26b, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b26a, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0xba09b26b, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x29f0f840, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x29f0f840, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x29f0f840, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x29f0f841, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x29f0f841, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x29f0f840, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x29f0f840, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x29f0f840, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x29f0f841, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x29f0f841, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x4a1d5e35, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x4a1d5e34, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x4a1d5e34, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x4a1d5e35, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x4a1d5e35, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x4a1d5e35, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x4a1d5e34, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x4a1d5e34, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x4a1d5e35, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xba09b26e, 0xffffffff, 0xaf600000, 0xffffffff, 0x0, 0x0, 0x4a1d5e35, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc56a41cf, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc56a41cf, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc56a41cf, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xc56a41cf, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xba433593, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xba433592, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xba433593, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xba433592, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xba433593, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xba433593, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xba433592, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xba433593, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xba433592, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x0, 0x0, 0xba433593, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x4c3f0740, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x4c3f0740, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x4c3f0740, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x4c3f0740, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x4c3f0740, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x4c3f0740, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x4c3f0740, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x4c3f0740, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x4c3f0740, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x4c3f0740, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0xcc35a8c0, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0xcc35a8c0, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0xcc35a8c0, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0xcc35a8c0, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0xcc35a8c0, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0xcc35a8c0, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0xcc35a8c0, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0xcc35a8c0, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0xcc35a8c0, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0xcc35a8c0, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x565a3c30, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x565a3c2f, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x565a3c2f, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x565a3c30, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x565a3c30, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x565a3c30, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x565a3c2f, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x565a3c2f, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x565a3c30, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x565a3c30, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x3ccdf125, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x3ccdf125, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x3ccdf125, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x3ccdf126, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x3ccdf125, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x3ccdf125, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x3ccdf125, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x3ccdf125, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x3ccdf126, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x4995e800, 0xffffffff, 0x4c3a5800, 0xffffffff, 0x0, 0x0, 0x3ccdf125, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x46b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x46b37559, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x46b37559, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x46b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x46b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x46b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x46b37559, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x46b37559, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x46b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x46b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x3c7d955b, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x3c7d955a, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x3c7d955a, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x3c7d955b, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x3c7d955b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x3c7d955b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x3c7d955a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x3c7d955a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x3c7d955b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x0, 0x0, 0x3c7d955b, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x4a429d80, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x4a429d80, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x4a429d80, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x4a429d80, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x4a429d80, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x4a429d80, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x4a429d80, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x4a429d80, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x4a429d80, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x4a429d80, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0xca2f9280, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0xca2f9280, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0xca2f9280, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0xca2f9280, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0xca2f9280, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0xca2f9280, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0xca2f9280, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0xca2f9280, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0xca2f9280, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0xca2f9280, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x52dc4bc0, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x52dc4bc0, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x52dc4bc0, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x52dc4bc1, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x52dc4bc1, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x52dc4bc0, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x52dc4bc0, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x52dc4bc0, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x52dc4bc1, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x52dc4bc1, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x3d52b43c, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x3d52b43b, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x3d52b43b, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x3d52b43c, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x3d52b43c, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x3d52b43c, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x3d52b43b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x3d52b43b, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x3d52b43c, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x48185800, 0xffffffff, 0x4a391800, 0xffffffff, 0x0, 0x0, 0x3d52b43c, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc4daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc4daf6fd, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc4daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc4daf6fd, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc4daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc4daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc4daf6fd, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc4daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc4daf6fd, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xc4daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xbfb048ae, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xbfb048ad, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xbfb048ae, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xbfb048ad, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xbfb048ae, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xbfb048ae, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xbfb048ad, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xbfb048ae, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xbfb048ad, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x0, 0x0, 0xbfb048ae, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x4abd1300, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x4abd1300, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x4abd1300, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x4abd1300, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x4abd1300, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x4abd1300, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x4abd1300, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x4abd1300, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x4abd1300, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x4abd1300, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0xca8cdd00, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0xca8cdd00, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0xca8cdd00, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0xca8cdd00, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0xca8cdd00, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0xca8cdd00, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0xca8cdd00, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0xca8cdd00, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0xca8cdd00, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0xca8cdd00, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x54788a62, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x54788a62, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x54788a62, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x54788a63, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x54788a63, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x54788a62, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x54788a62, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x54788a62, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x54788a63, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x54788a63, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x3e15a0db, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x3e15a0da, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x3e15a0da, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x3e15a0db, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x3e15a0db, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x3e15a0db, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x3e15a0da, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x3e15a0da, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x3e15a0db, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x4940d800, 0xffffffff, 0x4aa4f800, 0xffffffff, 0x0, 0x0, 0x3e15a0db, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd9781c2, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd9781c2, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd9781c3, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd9781c2, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd9781c2, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd9781c2, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd9781c2, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd9781c3, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd9781c2, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd9781c2, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd978e3e, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd978e3d, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd978e3e, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd978e3d, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd978e3e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd978e3e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd978e3d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd978e3e, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd978e3d, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xcd978e3e, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xd56c6f44, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xd56c6f43, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xd56c6f44, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xd56c6f43, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xd56c6f44, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xd56c6f44, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xd56c6f43, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xd56c6f44, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xd56c6f43, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xd56c6f44, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xc5c23baf, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xc5c23baf, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xc5c23bb0, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xc5c23baf, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xc5c23baf, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xc5c23baf, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xc5c23baf, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xc5c23bb0, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xc5c23baf, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x0, 0x0, 0xc5c23baf, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0x461347fb, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0x461347fa, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0x461347fa, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0x461347fb, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0x461347fb, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0x461347fb, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0x461347fa, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0x461347fa, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0x461347fb, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0x461347fb, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc6134805, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc6134805, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc6134806, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc6134805, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc6134805, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc6134805, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc6134805, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc6134806, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc6134805, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc6134805, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc23e527a, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc23e527a, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc23e527b, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc23e527a, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc23e527b, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc23e527a, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc23e527a, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc23e527b, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc23e527a, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xc23e527b, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xb50fc08f, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xb50fc08e, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xb50fc08f, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xb50fc08e, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xb50fc08f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xb50fc08f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xb50fc08e, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xb50fc08f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xb50fc08e, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xbba56800, 0xffffffff, 0x46134800, 0xffffffff, 0x0, 0x0, 0xb50fc08f, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0x4b92d53f, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0x4b92d53e, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0x4b92d53e, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0x4b92d53f, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0x4b92d53f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0x4b92d53f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0x4b92d53e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0x4b92d53e, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0x4b92d53f, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0x4b92d53f, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xcb92dac1, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xcb92dac1, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xcb92dac2, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xcb92dac1, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xcb92dac1, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xcb92dac1, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xcb92dac1, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xcb92dac2, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xcb92dac1, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xcb92dac1, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xd0ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xd0ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xd0ca4df5, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xd0ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xd0ca4df5, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xd0ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xd0ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xd0ca4df5, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xd0ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xd0ca4df5, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xb899b6e3, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xb899b6e3, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xb899b6e4, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xb899b6e3, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xb899b6e3, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xb899b6e3, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xb899b6e3, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xb899b6e4, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xb899b6e3, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x0, 0x0, 0xb899b6e3, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9801, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9801, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd97ff, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd97ff, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd97ff, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd97ff, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4bdd9800, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x49fa1abe, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x49fa1abe, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x49fa1abe, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x49fa1abf, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x49fa1abf, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x49fa1abe, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x49fa1abe, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x49fa1abe, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x49fa1abf, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x49fa1abf, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4dc45547, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4dc45547, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4dc45547, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4dc45548, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4dc45547, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4dc45547, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4dc45547, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4dc45547, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4dc45548, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x4bdd9800, 0xffffffff, 0x3d907800, 0xffffffff, 0x0, 0x0, 0x4dc45547, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xcd142cae, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xcd142cad, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xcd142cae, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xcd142cad, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xcd142cae, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xcd142cae, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xcd142cad, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xcd142cae, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xcd142cad, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xcd142cae, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xbaedc012, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xbaedc011, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xbaedc012, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xbaedc011, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xbaedc012, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xbaedc012, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xbaedc011, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xbaedc012, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xbaedc011, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x0, 0x0, 0xbaedc012, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec46e26, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec46e26, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec46e26, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec46e26, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec46e26, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec46e26, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec46e26, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec46e26, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec46e26, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec46e26, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec421da, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec421da, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec421da, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec421da, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec421da, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec421da, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec421da, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec421da, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec421da, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x4ec421da, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x58e9fe96, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x58e9fe95, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x58e9fe95, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x58e9fe96, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x58e9fe96, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x58e9fe96, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x58e9fe95, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x58e9fe95, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x58e9fe96, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x58e9fe96, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x44a4a575, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x44a4a575, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x44a4a575, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x44a4a576, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x44a4a575, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x44a4a575, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x44a4a575, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x44a4a575, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x44a4a576, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x4ec44800, 0xffffffff, 0x49989800, 0xffffffff, 0x0, 0x0, 0x44a4a575, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc2e525f2, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc2e525f2, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc2e525f3, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc2e525f2, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc2e525f3, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc2e525f2, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc2e525f2, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc2e525f3, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc2e525f2, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xc2e525f3, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xbfd28eb5, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xbfd28eb5, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xbfd28eb6, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xbfd28eb5, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xbfd28eb5, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xbfd28eb5, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xbfd28eb5, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xbfd28eb6, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xbfd28eb5, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x0, 0x0, 0xbfd28eb5, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0x4e8a6970, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0x4e8a6970, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0x4e8a6970, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0x4e8a6970, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0x4e8a6970, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0x4e8a6970, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0x4e8a6970, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0x4e8a6970, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0x4e8a6970, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0x4e8a6970, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xce8e0690, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xce8e0690, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xce8e0690, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xce8e0690, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xce8e0690, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xce8e0690, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xce8e0690, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xce8e0690, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xce8e0690, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xce8e0690, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xda7d5bf0, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xda7d5bef, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xda7d5bf0, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xda7d5bef, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xda7d5bf0, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xda7d5bf0, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xda7d5bef, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xda7d5bf0, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xda7d5bef, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xda7d5bf0, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xbc532094, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xbc532093, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xbc532094, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xbc532093, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xbc532094, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xbc532094, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xbc532093, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xbc532094, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xbc532093, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xcb674800, 0xffffffff, 0x4e8c3800, 0xffffffff, 0x0, 0x0, 0xbc532094, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc7c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc7c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc7c07bb7, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc7c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc7c07bb7, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc7c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc7c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc7c07bb7, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc7c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xc7c07bb7, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xbe8f6e1d, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xbe8f6e1d, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xbe8f6e1e, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xbe8f6e1d, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xbe8f6e1d, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xbe8f6e1d, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xbe8f6e1d, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xbe8f6e1e, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xbe8f6e1d, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x0, 0x0, 0xbe8f6e1d, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0x4d0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0x4d0f07ff, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0x4d0f07ff, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0x4d0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0x4d0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0x4d0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0x4d0f07ff, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0x4d0f07ff, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0x4d0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0x4d0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcd0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcd0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcd0f0801, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcd0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcd0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcd0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcd0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcd0f0801, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcd0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcd0f0800, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcc30612e, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcc30612d, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcc30612e, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcc30612d, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcc30612e, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcc30612e, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcc30612d, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcc30612e, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcc30612d, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xcc30612e, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xb10d417f, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xb10d417f, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xb10d4180, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xb10d417f, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xb10d417f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xb10d417f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xb10d417f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xb10d4180, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xb10d417f, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xbe9dd800, 0xffffffff, 0x4d0f0800, 0xffffffff, 0x0, 0x0, 0xb10d417f, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4bc55802, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4bc55802, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4bc55802, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4bc55803, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4bc55802, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4bc55802, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4bc55802, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4bc55802, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4bc55803, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4bc55802, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0xcbc557fe, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0xcbc557fd, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0xcbc557fe, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0xcbc557fd, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0xcbc557fe, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0xcbc557fe, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0xcbc557fd, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0xcbc557fe, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0xcbc557fd, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0xcbc557fe, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4cf438f8, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4cf438f7, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4cf438f7, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4cf438f8, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4cf438f8, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4cf438f8, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4cf438f7, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4cf438f7, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4cf438f8, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x4cf438f8, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x344d7d39, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x344d7d39, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x344d7d39, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x344d7d3a, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x344d7d39, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x344d7d39, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x344d7d39, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x344d7d39, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x344d7d3a, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x0, 0x0, 0x344d7d39, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3bc6780, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3bc6780, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3bc6781, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3bc6780, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3bc6781, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3bc6780, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3bc6780, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3bc6781, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3bc6780, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3bc6781, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3f5a912, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3f5a911, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3f5a912, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3f5a911, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3f5a912, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3f5a912, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3f5a911, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3f5a912, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3f5a911, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc3f5a912, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc6c229b9, 0xffffffff, 0x1, 0x0
+  .word 0x68, 0x3, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc6c229b9, 0xffffffff, 0x1, 0x0
+  .word 0x70, 0x0, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc6c229ba, 0xffffffff, 0x1, 0x0
+  .word 0x78, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc6c229b9, 0xffffffff, 0x1, 0x0
+  .word 0x80, 0x1, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc6c229b9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x0, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc6c229b9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x1, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc6c229b9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc6c229ba, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x3, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc6c229b9, 0xffffffff, 0x1, 0x0
+  .word 0x88, 0x4, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc6c229b9, 0xffffffff, 0x1, 0x0
+  .word 0x90, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc0f2986c, 0xffffffff, 0x1, 0x0
+  .word 0x98, 0x3, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc0f2986c, 0xffffffff, 0x1, 0x0
+  .word 0xa0, 0x0, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc0f2986d, 0xffffffff, 0x1, 0x0
+  .word 0xa8, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc0f2986c, 0xffffffff, 0x1, 0x0
+  .word 0xb0, 0x1, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc0f2986c, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x0, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc0f2986c, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x1, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc0f2986c, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x2, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc0f2986d, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x3, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc0f2986c, 0xffffffff, 0x1, 0x0
+  .word 0xb8, 0x4, 0xc3d90849, 0xffffffff, 0x42650644, 0xffffffff, 0x0, 0x0, 0xc0f2986c, 0xffffffff, 0x1, 0x0
+  .word 0x0, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf800001, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf800001, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf800001, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf800001, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0xbf800000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000001, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000001, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x98, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0xa0, 0x0, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0xa8, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0xb0, 0x1, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x0, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x1, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x4, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0x0, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000001, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000001, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x6, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x6, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x6, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x6, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x6, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x6, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x6, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x6, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x6, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x6, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0x98, 0x3, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0xa0, 0x0, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0xa8, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0xb0, 0x1, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x0, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x1, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x2, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x1, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x3, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x4, 0x3, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0x0, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000001, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000001, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0x98, 0x3, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0xa0, 0x0, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0xa8, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3, 0xffffffff, 0x3, 0x0
+  .word 0xb0, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x0, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x2, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x3, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x4, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3, 0xffffffff, 0x3, 0x0
+  .word 0x0, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3fffffff, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3fffffff, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3fffffff, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3fffffff, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000001, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000001, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x98, 0x3, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0xa0, 0x0, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0xa8, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0xb0, 0x1, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x0, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x1, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x2, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x3, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x4, 0x80000001, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000001, 0xffffffff, 0x3, 0x0
+  .word 0x0, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x8, 0x3, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3fffffff, 0xffffffff, 0x1, 0x0
+  .word 0x10, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3fffffff, 0xffffffff, 0x1, 0x0
+  .word 0x18, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x20, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3fffffff, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x3fffffff, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x3, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x28, 0x4, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x30, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x38, 0x3, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x40, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000001, 0xffffffff, 0x1, 0x0
+  .word 0x48, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x50, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000001, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x3, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x58, 0x4, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x60, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x3, 0x0
+  .word 0x98, 0x3, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x3, 0x0
+  .word 0xa0, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000003, 0xffffffff, 0x3, 0x0
+  .word 0xa8, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x3, 0x0
+  .word 0xb0, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000003, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000003, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x3, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000002, 0xffffffff, 0x3, 0x0
+  .word 0xb8, 0x4, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x0, 0x0, 0x80000003, 0xffffffff, 0x3, 0x0
+  .word 0x0, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x0, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x0, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x8, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x10, 0x0, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x18, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x20, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x0, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x28, 0x4, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x30, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x38, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x40, 0x0, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x48, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x50, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x0, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x58, 0x4, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x60, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x68, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x70, 0x0, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x78, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x80, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x0, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x88, 0x4, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x90, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x98, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0xa0, 0x0, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0xa8, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0xb0, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x0, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0xb8, 0x4, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x2, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0x3d8999dd, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0x3d8999dd, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0x3d8999de, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0xbd8999df, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0xbd8999de, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0xbd8999de, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0xbd8999de, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0xbd8999dd, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0x3d8999de, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1800000, 0xffffffff, 0xbd8999de, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0xd0, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x4, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x128, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0xe8, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x4, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0xaf8999de, 0xffffffff, 0x0, 0x0
+  .word 0x130, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0x2f8999de, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0x2f8999de, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x4, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0x2f8999de, 0xffffffff, 0x0, 0x0
+  .word 0x138, 0x1, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0x2f8999de, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0x2f8999de, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x4, 0x3d8999de, 0xffffffff, 0xb1800000, 0xffffffff, 0x80000000, 0xffffffff, 0x2f8999de, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x0, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0x4e3ad2af, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0x4e3ad2af, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0x4e3ad2af, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0x4e3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0x4e3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0x4e3ad2b6, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0xce3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0xce3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0xce3ad2b5, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0xce3ad2af, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0xce3ad2af, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x4e3ad2b2, 0xffffffff, 0x3f800000, 0xffffffff, 0xc35fffff, 0xffffffff, 0xce3ad2ae, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xd223785b, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x5223785c, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x5223785b, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x5223785b, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x5223785c, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x1, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x5223785b, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0x4e3ad2b2, 0xffffffff, 0xc35fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x5223785b, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0x38cfddd4, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0x38cfddd4, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0x38cfddd4, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0x38cfddd2, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0x38cfddd2, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0x38cfddd3, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0xb8cfddd2, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0xb8cfddd2, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0xb8cfddd2, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0xb8cfddd4, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0xb8cfddd4, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x38cfddd3, 0xffffffff, 0x3f800000, 0xffffffff, 0x2c800000, 0xffffffff, 0xb8cfddd3, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x4, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x140, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x4, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x148, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0x25cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x4, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0xa5cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x150, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0xa5cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0xa5cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x4, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0xa5cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x158, 0x0, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0xa5cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0x38cfddd3, 0xffffffff, 0x2c800000, 0xffffffff, 0x80000000, 0xffffffff, 0xa5cfddd3, 0xffffffff, 0x0, 0x0
+  .word 0x160, 0x2, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0xc786a226, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0xc786a226, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0xc786a227, 0xffffffff, 0x1, 0x0
+  .word 0x168, 0x2, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0xc786a229, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0xc786a229, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0xc786a22a, 0xffffffff, 0x1, 0x0
+  .word 0x170, 0x2, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0x4786a22a, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0x4786a229, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0x4786a229, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0x4786a227, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0x4786a226, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0xc786a228, 0xffffffff, 0x3f800000, 0xffffffff, 0x3c400000, 0xffffffff, 0x4786a226, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0xd0, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0xe8, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0xc449f33c, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0x4449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0x4449f33c, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0x4449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x1, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0x4449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0x4449f33c, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0xc786a228, 0xffffffff, 0x3c400000, 0xffffffff, 0x80000000, 0xffffffff, 0x4449f33c, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x4, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0xce6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0xce6e7c5e, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x1, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0xce6e7c5e, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x4, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0xce6e7c60, 0xffffffff, 0x1, 0x0
+  .word 0x168, 0x2, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0xce6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x1, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0xce6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x4, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0x4e6e7c60, 0xffffffff, 0x1, 0x0
+  .word 0x170, 0x2, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0x4e6e7c60, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x1, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0x4e6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x4, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0x4e6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0x4e6e7c5f, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x1, 0xce6e7c5f, 0xffffffff, 0x3f800000, 0xffffffff, 0x42000000, 0xffffffff, 0x4e6e7c5e, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x4, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x4, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0x50ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x4, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0x50ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0x50ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0x50ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x4, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0x50ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x2, 0xce6e7c5f, 0xffffffff, 0x42000000, 0xffffffff, 0x80000000, 0xffffffff, 0x50ee7c5f, 0xffffffff, 0x0, 0x0
+  .word 0xc8, 0x3, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0xd6e85419, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0xd6e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0xd6e8541b, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0xd6e8541b, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0x56e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0x56e8541b, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0x56e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0x56e85419, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0x56e8541a, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0xd6e8541a, 0xffffffff, 0x3f800000, 0xffffffff, 0x4a800000, 0xffffffff, 0x56e85419, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x128, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0xe1e8541a, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0x61e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x130, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0x61e8541a, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0x61e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0x61e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x138, 0x1, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0x61e8541a, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x0, 0xd6e8541a, 0xffffffff, 0x4a800000, 0xffffffff, 0x80000000, 0xffffffff, 0x61e8541a, 0xffffffff, 0x0, 0x0
+  .word 0xc8, 0x3, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0xd5f88230, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0xd5f88231, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0xd5f88230, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0xd5f8822d, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0xd5f8822e, 0xffffffff, 0x1, 0x0
+  .word 0x168, 0x2, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0xd5f8822d, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0x55f8822d, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0x55f8822d, 0xffffffff, 0x1, 0x0
+  .word 0x170, 0x2, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0x55f8822e, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0x55f88230, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0x55f88230, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0xd5f8822f, 0xffffffff, 0x3f800000, 0xffffffff, 0xca400000, 0xffffffff, 0x55f88231, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x148, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0x60ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x150, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0xe0ba61a4, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0xe0ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0xe0ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x158, 0x0, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0xe0ba61a4, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0xe0ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xd5f8822f, 0xffffffff, 0xca400000, 0xffffffff, 0x80000000, 0xffffffff, 0xe0ba61a3, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0x45a68775, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x148, 0x0, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0x45a68776, 0xffffffff, 0x1, 0x0
+  .word 0x168, 0x2, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0x45a68777, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0xc5a68776, 0xffffffff, 0x1, 0x0
+  .word 0x150, 0x0, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0xc5a68777, 0xffffffff, 0x1, 0x0
+  .word 0x170, 0x2, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0xc5a68776, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0xc5a68776, 0xffffffff, 0x1, 0x0
+  .word 0x158, 0x0, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0xc5a68776, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0x45a68776, 0xffffffff, 0x3f800000, 0xffffffff, 0xb9800000, 0xffffffff, 0xc5a68775, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x160, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x148, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x168, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x128, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0xbfa68776, 0xffffffff, 0x0, 0x0
+  .word 0x150, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0x3fa68776, 0xffffffff, 0x0, 0x0
+  .word 0x170, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0x3fa68776, 0xffffffff, 0x0, 0x0
+  .word 0x130, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0x3fa68776, 0xffffffff, 0x0, 0x0
+  .word 0x158, 0x0, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0x3fa68776, 0xffffffff, 0x0, 0x0
+  .word 0x178, 0x2, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0x3fa68776, 0xffffffff, 0x0, 0x0
+  .word 0x138, 0x1, 0x45a68776, 0xffffffff, 0xb9800000, 0xffffffff, 0x80000000, 0xffffffff, 0x3fa68776, 0xffffffff, 0x0, 0x0
+  .word 0xd0, 0x2, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0xbc9be77e, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0xbc9be77d, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x4, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0xbc9be77e, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0xbc9be77a, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0xbc9be77a, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x4, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0xbc9be77b, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0x3c9be77a, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0x3c9be77a, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x4, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0x3c9be77b, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0x3c9be77e, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0x3c9be77d, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x4, 0xbc9be77c, 0xffffffff, 0x3f800000, 0xffffffff, 0xb1400000, 0xffffffff, 0x3c9be77e, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x168, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0x2e69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x170, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0xae69db3a, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0xae69db3a, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0xae69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x178, 0x2, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0xae69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x1, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0xae69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0xbc9be77c, 0xffffffff, 0xb1400000, 0xffffffff, 0x80000000, 0xffffffff, 0xae69db3a, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x1, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0xcaa7d855, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0xcaa7d854, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0xcaa7d855, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0xcaa7d85c, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0xcaa7d85c, 0xffffffff, 0x1, 0x0
+  .word 0x148, 0x0, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0xcaa7d85c, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0x4aa7d85c, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0x4aa7d85c, 0xffffffff, 0x1, 0x0
+  .word 0x150, 0x0, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0x4aa7d85b, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0x4aa7d855, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0x4aa7d854, 0xffffffff, 0x1, 0x0
+  .word 0x158, 0x0, 0xcaa7d858, 0xffffffff, 0x3f800000, 0xffffffff, 0x3fe00000, 0xffffffff, 0x4aa7d854, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0xd0, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0xe8, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0xcb12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0x4b12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0x4b12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0x4b12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x0, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0x4b12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0x4b12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0xcaa7d858, 0xffffffff, 0x3fe00000, 0xffffffff, 0x80000000, 0xffffffff, 0x4b12dd4d, 0xffffffff, 0x0, 0x0
+  .word 0xc8, 0x3, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0xc82429ea, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0xc82429ea, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0xc82429eb, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0xc82429e3, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0xc82429e3, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0xc82429e4, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x482429e3, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x482429e4, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x482429e3, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x482429ea, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x482429eb, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0xc82429e7, 0xffffffff, 0x3f800000, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x482429ea, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x4, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x460fa4aa, 0xffffffff, 0x1, 0x0
+  .word 0x148, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x4, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x460fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x168, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x460fa4aa, 0xffffffff, 0x1, 0x0
+  .word 0x150, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xc60fa4aa, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x4, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xc60fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x170, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xc60fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x158, 0x0, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xc60fa4aa, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x4, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xc60fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0xc82429e7, 0xffffffff, 0xbd5fffff, 0xffffffff, 0x80000000, 0xffffffff, 0xc60fa4a9, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0x3b01fc8a, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0x3b01fc8a, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0x3b01fc89, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0x3b01fc87, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0x3b01fc86, 0xffffffff, 0x1, 0x0
+  .word 0x148, 0x0, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0x3b01fc86, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0xbb01fc86, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0xbb01fc86, 0xffffffff, 0x1, 0x0
+  .word 0x150, 0x0, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0xbb01fc87, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0xbb01fc89, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0xbb01fc8a, 0xffffffff, 0x1, 0x0
+  .word 0x158, 0x0, 0x3b01fc88, 0xffffffff, 0x3f800000, 0xffffffff, 0x2fc00000, 0xffffffff, 0xbb01fc8a, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0xc8, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x148, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x128, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0xe0, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0x2b42facc, 0xffffffff, 0x0, 0x0
+  .word 0x150, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0xab42facc, 0xffffffff, 0x0, 0x0
+  .word 0x130, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0xab42facc, 0xffffffff, 0x0, 0x0
+  .word 0xf8, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0xab42facc, 0xffffffff, 0x0, 0x0
+  .word 0x158, 0x0, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0xab42facc, 0xffffffff, 0x0, 0x0
+  .word 0x138, 0x1, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0xab42facc, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x3, 0x3b01fc88, 0xffffffff, 0x2fc00000, 0xffffffff, 0x80000000, 0xffffffff, 0xab42facc, 0xffffffff, 0x0, 0x0
+  .word 0x140, 0x0, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0xb047d84e, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0xb047d84d, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0xb047d84e, 0xffffffff, 0x1, 0x0
+  .word 0x148, 0x0, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0xb047d84d, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0xb047d84c, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0xb047d84c, 0xffffffff, 0x1, 0x0
+  .word 0x150, 0x0, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0x3047d84c, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0x3047d84d, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0x3047d84c, 0xffffffff, 0x1, 0x0
+  .word 0x158, 0x0, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0x3047d84d, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0x3047d84e, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0xb047d84d, 0xffffffff, 0x3f800000, 0xffffffff, 0xa4000001, 0xffffffff, 0x3047d84e, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x14c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x14c7d84f, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x14c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x14c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0x168, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x14c7d84f, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x14c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x94c7d84f, 0xffffffff, 0x1, 0x0
+  .word 0x170, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x94c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x94c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x94c7d84f, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x94c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xb047d84d, 0xffffffff, 0xa4000001, 0xffffffff, 0x80000000, 0xffffffff, 0x94c7d84e, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0xbd007777, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0xbd007778, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0xbd007778, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0xbd00777e, 0xffffffff, 0x1, 0x0
+  .word 0x148, 0x0, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0xbd00777f, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0xbd00777e, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0x3d00777e, 0xffffffff, 0x1, 0x0
+  .word 0x150, 0x0, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0x3d00777e, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0x3d00777e, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0x3d007777, 0xffffffff, 0x1, 0x0
+  .word 0x158, 0x0, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0x3d007777, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xbd00777b, 0xffffffff, 0x3f800000, 0xffffffff, 0x32600000, 0xffffffff, 0x3d007778, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x4, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0xafe0d118, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x4, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x148, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0xafe0d118, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0xafe0d117, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x4, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0x2fe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x150, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0x2fe0d117, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0x2fe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x4, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0x2fe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x158, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0x2fe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0xbd00777b, 0xffffffff, 0x32600000, 0xffffffff, 0x80000000, 0xffffffff, 0x2fe0d117, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0xb48bade3, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0xb48bade2, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0xb48bade2, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0xb48badde, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0xb48badde, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0xb48badde, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0x348badde, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0x348badde, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0x348badde, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0x348bade3, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0x348bade2, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xb48bade0, 0xffffffff, 0x3f800000, 0xffffffff, 0xa9a00000, 0xffffffff, 0x348bade2, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0xd0, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x128, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0xe8, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x1eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x130, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x9eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x9eae9958, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x9eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x138, 0x1, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x9eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x9eae9958, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x2, 0xb48bade0, 0xffffffff, 0xa9a00000, 0xffffffff, 0x80000000, 0xffffffff, 0x9eae9958, 0xffffffff, 0x0, 0x0
+  .word 0xd0, 0x2, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0xb137600e, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0xb137600e, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0xb137600e, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0xb1376006, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0xb1376006, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0xb1376007, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0x31376006, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0x31376006, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0x31376007, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0x3137600e, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0x3137600e, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0xb137600a, 0xffffffff, 0x3f800000, 0xffffffff, 0xa6600000, 0xffffffff, 0x3137600e, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x18207408, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x4, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x18207409, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x18207409, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x18207408, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x4, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x18207409, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x18207409, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x98207409, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x4, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x98207409, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x98207409, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x98207409, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x4, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x98207409, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0xb137600a, 0xffffffff, 0xa6600000, 0xffffffff, 0x80000000, 0xffffffff, 0x98207409, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x4, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x4, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x1ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x1ee34e71, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x9ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x4, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x9ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x9ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x9ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x4, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x9ee34e70, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x1ee34e70, 0xffffffff, 0x3f800000, 0xffffffff, 0x927fffff, 0xffffffff, 0x9ee34e6f, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0xd0, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x120, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0xe0, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0xe8, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0x128, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x3, 0x0
+  .word 0xf8, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x100, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x130, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x110, 0x3, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x118, 0x2, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0x138, 0x1, 0x1ee34e70, 0xffffffff, 0x927fffff, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x3, 0x0
+  .word 0xc0, 0x1, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0xfd9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0xfd9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0xfd9d94fb, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x1, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0xfd9d94fd, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0xfd9d94fe, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0xfd9d94fe, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x1, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0x7d9d94fd, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0x7d9d94fe, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0x7d9d94fd, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x1, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0x7d9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0x7d9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0xfd9d94fc, 0xffffffff, 0x3f800000, 0xffffffff, 0x72400001, 0xffffffff, 0x7d9d94fa, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x4, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x120, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0xc8, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0xd8, 0x4, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0x128, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0xff800000, 0xffffffff, 0x5, 0x0
+  .word 0xe0, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0xff7fffff, 0xffffffff, 0x5, 0x0
+  .word 0xf0, 0x4, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x130, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0xf8, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0x108, 0x4, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x138, 0x1, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x110, 0x3, 0xfd9d94fc, 0xffffffff, 0x72400001, 0xffffffff, 0x80000000, 0xffffffff, 0x7f7fffff, 0xffffffff, 0x5, 0x0
+  .word 0xc0, 0x1, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0xc0a74d56, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0xc0a74d56, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0xc0a74d56, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x1, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0xc0a74d5d, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0xc0a74d5d, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0xc0a74d5e, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x1, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0x40a74d5d, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0x40a74d5d, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0x40a74d5e, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x1, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0x40a74d56, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0x40a74d56, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xc0a74d5a, 0xffffffff, 0x3f800000, 0xffffffff, 0x35e00000, 0xffffffff, 0x40a74d56, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0xb71263ae, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0xb71263af, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0xb71263af, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0xb71263ae, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0xb71263af, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0xb71263af, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0x371263ae, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0x371263af, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0x371263af, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0x371263ae, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0x371263af, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0xc0a74d5a, 0xffffffff, 0x35e00000, 0xffffffff, 0x80000000, 0xffffffff, 0x371263af, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0x295a0eae, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0x295a0eae, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0x295a0ead, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0x295a0eb2, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0x295a0eb3, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0x295a0eb2, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0xa95a0eb2, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0xa95a0eb2, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0xa95a0eb2, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0xa95a0eae, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0xa95a0ead, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0x295a0eb0, 0xffffffff, 0x3f800000, 0xffffffff, 0x9e200000, 0xffffffff, 0xa95a0ead, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0xc8, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0xe8, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0xe0, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x8808492e, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x808492e, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x808492e, 0xffffffff, 0x0, 0x0
+  .word 0xf8, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x808492e, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x808492e, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x0, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x808492e, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x3, 0x295a0eb0, 0xffffffff, 0x9e200000, 0xffffffff, 0x80000000, 0xffffffff, 0x808492e, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x2, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x1, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0xc8, 0x3, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0x450c1d45, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x2, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x1, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0xe0, 0x3, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0xc50c52bb, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x2, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0x450c52bb, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x1, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0x450c52bb, 0xffffffff, 0x0, 0x0
+  .word 0xf8, 0x3, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0x450c52bb, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x2, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0xc50c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x1, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0xc50c1d45, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x3, 0xbfd5d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x450c3800, 0xffffffff, 0xc50c1d45, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0xc56a41ce, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0x456a41ce, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0x456a41cf, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0x456a41ce, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0x456a41ce, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0x456a41cf, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xbfd5d800, 0xffffffff, 0x450c3800, 0xffffffff, 0x80000000, 0xffffffff, 0x456a41ce, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0xc8, 0x3, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x4, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0x449aa360, 0xffffffff, 0x0, 0x0
+  .word 0xe8, 0x2, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0xe0, 0x3, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x4, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0xc495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0x4495eca0, 0xffffffff, 0x0, 0x0
+  .word 0xf8, 0x3, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0x4495eca0, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x4, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0x4495eca0, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0xc49aa360, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x3, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0xc49aa360, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x4, 0x4196d800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44984800, 0xffffffff, 0xc49aa360, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x4, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0x46b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0x46b3755a, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0x46b37559, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x4, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0x46b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x168, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0x46b3755a, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0x46b37559, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x4, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0xc6b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x170, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0xc6b37559, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0xc6b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x4, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0xc6b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0xc6b37559, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0x4196d800, 0xffffffff, 0x44984800, 0xffffffff, 0x80000000, 0xffffffff, 0xc6b3755a, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x0, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0xc1574000, 0xffffffff, 0x0, 0x0
+  .word 0x168, 0x2, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x0, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x3, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0xc2a99000, 0xffffffff, 0x0, 0x0
+  .word 0x170, 0x2, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0x42a99000, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x0, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0x42a99000, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x3, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0x42a99000, 0xffffffff, 0x0, 0x0
+  .word 0x178, 0x2, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0x41574000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x0, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0x41574000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0xc2447800, 0xffffffff, 0x3f800000, 0xffffffff, 0x420ea800, 0xffffffff, 0x41574000, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0xc4daf6fd, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0xc4daf6fd, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x4, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0xc4daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0xc4daf6fd, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0xc4daf6fd, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x4, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0xc4daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0x44daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0x44daf6fd, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x4, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0x44daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0x44daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0x44daf6fd, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x4, 0xc2447800, 0xffffffff, 0x420ea800, 0xffffffff, 0x80000000, 0xffffffff, 0x44daf6fe, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0xcd9781c2, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0xcd9781c2, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0xcd9781c2, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0xcd978e3d, 0xffffffff, 0x1, 0x0
+  .word 0x168, 0x2, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0xcd978e3d, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0xcd978e3e, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0x4d978e3d, 0xffffffff, 0x1, 0x0
+  .word 0x170, 0x2, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0x4d978e3e, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0x4d978e3e, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0x4d9781c2, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0x4d9781c3, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0xcd978800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4747b800, 0xffffffff, 0x4d9781c2, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x4, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0xd56c6f44, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0xd56c6f44, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0xd56c6f43, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x4, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0xd56c6f44, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0xd56c6f44, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0xd56c6f43, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x4, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0x556c6f44, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0x556c6f43, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0x556c6f44, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x4, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0x556c6f44, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0x556c6f43, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0xcd978800, 0xffffffff, 0x4747b800, 0xffffffff, 0x80000000, 0xffffffff, 0x556c6f44, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0x4b92d53e, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0x4b92d53f, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0x4b92d53f, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0xcb92dac2, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0xcb92dac1, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0xcb92dac1, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0x4b92dac1, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0x4b92dac1, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0x4b92dac2, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0xcb92d53f, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0xcb92d53f, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0xc4b05800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4b92d800, 0xffffffff, 0xcb92d53e, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ca4df5, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ca4df5, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ca4df5, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x148, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0xd0ca4df5, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0x50ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0x50ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x150, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0x50ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0x50ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0x50ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x158, 0x0, 0xc4b05800, 0xffffffff, 0x4b92d800, 0xffffffff, 0x80000000, 0xffffffff, 0x50ca4df4, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x160, 0x2, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0x488ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x148, 0x0, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x3, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x168, 0x2, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0xc88f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x150, 0x0, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0x488f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x3, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0x488f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x170, 0x2, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0x488f2a5c, 0xffffffff, 0x0, 0x0
+  .word 0x158, 0x0, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0xc88ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0xc88ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0x178, 0x2, 0xc404b800, 0xffffffff, 0x3f800000, 0xffffffff, 0x488ee800, 0xffffffff, 0xc88ea5a4, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0xcd142cad, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0xcd142cad, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x4, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0xcd142cae, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0xcd142cad, 0xffffffff, 0x1, 0x0
+  .word 0x168, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0xcd142cad, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x4, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0xcd142cae, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0x4d142cae, 0xffffffff, 0x1, 0x0
+  .word 0x170, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0x4d142cae, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x4, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0x4d142cae, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0x4d142cae, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0x4d142cae, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x4, 0xc404b800, 0xffffffff, 0x488ee800, 0xffffffff, 0x80000000, 0xffffffff, 0x4d142cae, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x120, 0x1, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0xd0, 0x2, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0xc0ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x168, 0x2, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x128, 0x1, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0xe8, 0x2, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0xc1b09800, 0xffffffff, 0x0, 0x0
+  .word 0x170, 0x2, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0x41b09800, 0xffffffff, 0x0, 0x0
+  .word 0x130, 0x1, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0x41b09800, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0x41b09800, 0xffffffff, 0x0, 0x0
+  .word 0x178, 0x2, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0x40ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x138, 0x1, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0x40ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0xc15ba800, 0xffffffff, 0x3f800000, 0xffffffff, 0x41058800, 0xffffffff, 0x40ac4000, 0xffffffff, 0x0, 0x0
+  .word 0x140, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0xc2e525f3, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0xc2e525f2, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0xc2e525f3, 0xffffffff, 0x1, 0x0
+  .word 0x148, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0xc2e525f3, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0xc2e525f2, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0xc2e525f3, 0xffffffff, 0x1, 0x0
+  .word 0x150, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0x42e525f2, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0x42e525f2, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0x42e525f2, 0xffffffff, 0x1, 0x0
+  .word 0x158, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0x42e525f2, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0x42e525f2, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0xc15ba800, 0xffffffff, 0x41058800, 0xffffffff, 0x80000000, 0xffffffff, 0x42e525f2, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x2, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0x43d57c00, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x0, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x2, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x3, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0xc43dd200, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x0, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0x443dd200, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x2, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0x443dd200, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x3, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0x443dd200, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x0, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0xc3d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x2, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0xc3d57c00, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0xc3262800, 0xffffffff, 0x3f800000, 0xffffffff, 0x44144800, 0xffffffff, 0xc3d57c00, 0xffffffff, 0x0, 0x0
+  .word 0xd0, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0xc7c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0xc7c07bb7, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0xc7c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0xc7c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0xc7c07bb7, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0xc7c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0x47c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0x47c07bb7, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0x47c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0x47c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0x47c07bb7, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0xc3262800, 0xffffffff, 0x44144800, 0xffffffff, 0x80000000, 0xffffffff, 0x47c07bb6, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0x4bc55802, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0x4bc55803, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0x4bc55802, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0xcbc557fe, 0xffffffff, 0x1, 0x0
+  .word 0x168, 0x2, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0xcbc557fd, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0xcbc557fe, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0x4bc557fe, 0xffffffff, 0x1, 0x0
+  .word 0x170, 0x2, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0x4bc557fe, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0x4bc557fe, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0xcbc55802, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0xcbc55802, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0x409e6800, 0xffffffff, 0x3f800000, 0xffffffff, 0x4bc55800, 0xffffffff, 0xcbc55802, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0x4cf438f7, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0x4cf438f8, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x4, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0x4cf438f8, 0xffffffff, 0x1, 0x0
+  .word 0x148, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0x4cf438f7, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0x4cf438f8, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x4, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0x4cf438f8, 0xffffffff, 0x1, 0x0
+  .word 0x150, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0xccf438f8, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0xccf438f7, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x4, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0xccf438f8, 0xffffffff, 0x1, 0x0
+  .word 0x158, 0x0, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0xccf438f8, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0xccf438f7, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x4, 0x409e6800, 0xffffffff, 0x4bc55800, 0xffffffff, 0x80000000, 0xffffffff, 0xccf438f8, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x168, 0x2, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x128, 0x1, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x3f7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x170, 0x2, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x130, 0x1, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0xbf7fffff, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0xbf800001, 0xffffffff, 0x1, 0x0
+  .word 0x140, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0xd0, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x148, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0xe8, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0x33800000, 0xffffffff, 0x0, 0x0
+  .word 0x150, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0
+  .word 0x158, 0x0, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0x3f800000, 0xffffffff, 0x33800000, 0xffffffff, 0x80000000, 0xffffffff, 0xb3800000, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000001, 0xffffffff, 0x1, 0x0
+  .word 0xd0, 0x2, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0xc8, 0x3, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0xe8, 0x2, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0xe0, 0x3, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x100, 0x2, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0xf8, 0x3, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x3fffffff, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x118, 0x2, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x110, 0x3, 0x1, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0xc8, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x168, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0xe0, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x2, 0xffffffff, 0x0, 0x0
+  .word 0x170, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0xf8, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x178, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x3, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x2, 0x1, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x80000002, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x2, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x3, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000001, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x2, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x3, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x2, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x3fffffff, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x3, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x2, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000001, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x3, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0x5, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x160, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0xd0, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x168, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0xe8, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x170, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x100, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x178, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x118, 0x2, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x1, 0x5, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x160, 0x2, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0xc0, 0x0, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x168, 0x2, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x128, 0x1, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0xd8, 0x0, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x170, 0x2, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000001, 0xffffffff, 0x1, 0x0
+  .word 0x130, 0x1, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0xf0, 0x0, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0x40000000, 0xffffffff, 0x1, 0x0
+  .word 0x178, 0x2, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xbfffffff, 0xffffffff, 0x1, 0x0
+  .word 0x138, 0x1, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x108, 0x0, 0x80000005, 0xffffffff, 0x3f800000, 0xffffffff, 0x40000000, 0xffffffff, 0xc0000000, 0xffffffff, 0x1, 0x0
+  .word 0x120, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x160, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x128, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x168, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0x8000000a, 0xffffffff, 0x0, 0x0
+  .word 0x130, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x170, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x138, 0x1, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x178, 0x2, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x0, 0x80000005, 0xffffffff, 0x40000000, 0xffffffff, 0x80000000, 0xffffffff, 0xa, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0xc8, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0xe0, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0xf8, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x1, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x110, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x3f800000, 0xffffffff, 0xbf800000, 0xffffffff, 0x0, 0x0
+  .word 0x160, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x4, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0xc0, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0x0
+  .word 0x168, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x4, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xd8, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x170, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x4, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0xf0, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x178, 0x2, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x4, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x108, 0x3, 0x80000000, 0xffffffff, 0x3f800000, 0xffffffff, 0x80000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0x0
+  .word 0x180, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a3890, 0x77cf01e7, 0x1, 0x0
+  .word 0x188, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388f, 0x77cf01e7, 0x1, 0x0
+  .word 0x190, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388f, 0x77cf01e7, 0x1, 0x0
+  .word 0x198, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a3890, 0x77cf01e7, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a3890, 0x77cf01e7, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a3890, 0x77cf01e7, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388f, 0x77cf01e7, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388f, 0x77cf01e7, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a3890, 0x77cf01e7, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a3890, 0x77cf01e7, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388a, 0x77cf01e7, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388a, 0x77cf01e7, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388a, 0x77cf01e7, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388b, 0x77cf01e7, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388b, 0x77cf01e7, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388a, 0x77cf01e7, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388a, 0x77cf01e7, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388a, 0x77cf01e7, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388b, 0x77cf01e7, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x7f7a388b, 0x77cf01e7, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x1e8, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x1f0, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x1f8, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x200, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x208, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x208, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x4, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x210, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xcc61c6d7, 0x4328ce52, 0x1, 0x0
+  .word 0x218, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xcc61c6d7, 0x4328ce52, 0x1, 0x0
+  .word 0x220, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xcc61c6d7, 0x4328ce52, 0x1, 0x0
+  .word 0x228, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xcc61c6d8, 0x4328ce52, 0x1, 0x0
+  .word 0x230, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xcc61c6d7, 0x4328ce52, 0x1, 0x0
+  .word 0x238, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xcc61c6d7, 0x4328ce52, 0x1, 0x0
+  .word 0x238, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xcc61c6d7, 0x4328ce52, 0x1, 0x0
+  .word 0x238, 0x2, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xcc61c6d7, 0x4328ce52, 0x1, 0x0
+  .word 0x238, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xcc61c6d8, 0x4328ce52, 0x1, 0x0
+  .word 0x238, 0x4, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x0, 0xcc61c6d7, 0x4328ce52, 0x1, 0x0
+  .word 0x180, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbca, 0x10803de2, 0x1, 0x0
+  .word 0x188, 0x3, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbca, 0x10803de2, 0x1, 0x0
+  .word 0x190, 0x0, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbca, 0x10803de2, 0x1, 0x0
+  .word 0x198, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0x10803de2, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0x10803de2, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbca, 0x10803de2, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbca, 0x10803de2, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbca, 0x10803de2, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0x10803de2, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0x10803de2, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcc, 0x10803de2, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0x10803de2, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0x10803de2, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcc, 0x10803de2, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcc, 0x10803de2, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcc, 0x10803de2, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0x10803de2, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0x10803de2, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcc, 0x10803de2, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcc, 0x10803de2, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1e8, 0x3, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1f0, 0x0, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x1f8, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x200, 0x1, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x0, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x1, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x3, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x4, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x210, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0xc3403de2, 0x0, 0x0
+  .word 0x218, 0x3, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0xc3403de2, 0x0, 0x0
+  .word 0x220, 0x0, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0xc3403de2, 0x0, 0x0
+  .word 0x228, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0xc3403de2, 0x0, 0x0
+  .word 0x230, 0x1, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0xc3403de2, 0x0, 0x0
+  .word 0x238, 0x0, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0xc3403de2, 0x0, 0x0
+  .word 0x238, 0x1, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0xc3403de2, 0x0, 0x0
+  .word 0x238, 0x2, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0xc3403de2, 0x0, 0x0
+  .word 0x238, 0x3, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0xc3403de2, 0x0, 0x0
+  .word 0x238, 0x4, 0xf89cbbcb, 0x10803de2, 0x0, 0x8d300000, 0x0, 0x0, 0xf89cbbcb, 0xc3403de2, 0x0, 0x0
+  .word 0x180, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14914, 0x401b76bf, 0x1, 0x0
+  .word 0x188, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14914, 0x401b76bf, 0x1, 0x0
+  .word 0x190, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14914, 0x401b76bf, 0x1, 0x0
+  .word 0x198, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14915, 0x401b76bf, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14915, 0x401b76bf, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14914, 0x401b76bf, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14914, 0x401b76bf, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14914, 0x401b76bf, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14915, 0x401b76bf, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14915, 0x401b76bf, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14910, 0x401b76bf, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba1490f, 0x401b76bf, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba1490f, 0x401b76bf, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14910, 0x401b76bf, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14910, 0x401b76bf, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14910, 0x401b76bf, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba1490f, 0x401b76bf, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba1490f, 0x401b76bf, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14910, 0x401b76bf, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x7ba14910, 0x401b76bf, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x1e8, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x1f0, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x1f8, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0xad44cdac, 0x3d112a37, 0x1, 0x0
+  .word 0x200, 0x1, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x208, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x208, 0x1, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x208, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x208, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0xad44cdac, 0x3d112a37, 0x1, 0x0
+  .word 0x208, 0x4, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x210, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x2fb43a75, 0x4325f899, 0x1, 0x0
+  .word 0x218, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x2fb43a74, 0x4325f899, 0x1, 0x0
+  .word 0x220, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x2fb43a74, 0x4325f899, 0x1, 0x0
+  .word 0x228, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x2fb43a75, 0x4325f899, 0x1, 0x0
+  .word 0x230, 0x1, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x2fb43a75, 0x4325f899, 0x1, 0x0
+  .word 0x238, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x2fb43a75, 0x4325f899, 0x1, 0x0
+  .word 0x238, 0x1, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x2fb43a74, 0x4325f899, 0x1, 0x0
+  .word 0x238, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x2fb43a74, 0x4325f899, 0x1, 0x0
+  .word 0x238, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x2fb43a75, 0x4325f899, 0x1, 0x0
+  .word 0x238, 0x4, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x0, 0x2fb43a75, 0x4325f899, 0x1, 0x0
+  .word 0x180, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef4, 0xbe8fad9d, 0x1, 0x0
+  .word 0x188, 0x3, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef4, 0xbe8fad9d, 0x1, 0x0
+  .word 0x190, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x1, 0x0
+  .word 0x198, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef4, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef4, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef4, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef4, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef6, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef6, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef6, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef6, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef6, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef6, 0xbe8fad9d, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xb9cfad9d, 0x0, 0x0
+  .word 0x1e8, 0x3, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xb9cfad9d, 0x0, 0x0
+  .word 0x1f0, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xb9cfad9d, 0x0, 0x0
+  .word 0x1f8, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xb9cfad9d, 0x0, 0x0
+  .word 0x200, 0x1, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xb9cfad9d, 0x0, 0x0
+  .word 0x208, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xb9cfad9d, 0x0, 0x0
+  .word 0x208, 0x1, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xb9cfad9d, 0x0, 0x0
+  .word 0x208, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xb9cfad9d, 0x0, 0x0
+  .word 0x208, 0x3, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xb9cfad9d, 0x0, 0x0
+  .word 0x208, 0x4, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xb9cfad9d, 0x0, 0x0
+  .word 0x210, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xc34fad9d, 0x0, 0x0
+  .word 0x218, 0x3, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xc34fad9d, 0x0, 0x0
+  .word 0x220, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xc34fad9d, 0x0, 0x0
+  .word 0x228, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xc34fad9d, 0x0, 0x0
+  .word 0x230, 0x1, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xc34fad9d, 0x0, 0x0
+  .word 0x238, 0x0, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xc34fad9d, 0x0, 0x0
+  .word 0x238, 0x1, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xc34fad9d, 0x0, 0x0
+  .word 0x238, 0x2, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xc34fad9d, 0x0, 0x0
+  .word 0x238, 0x3, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xc34fad9d, 0x0, 0x0
+  .word 0x238, 0x4, 0xc9007ef5, 0xbe8fad9d, 0x0, 0x3b300000, 0x0, 0x0, 0xc9007ef5, 0xc34fad9d, 0x0, 0x0
+  .word 0x180, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2a, 0x60e4e8d, 0x1, 0x0
+  .word 0x188, 0x3, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2a, 0x60e4e8d, 0x1, 0x0
+  .word 0x190, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2a, 0x60e4e8d, 0x1, 0x0
+  .word 0x198, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2a, 0x60e4e8d, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2a, 0x60e4e8d, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2a, 0x60e4e8d, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2a, 0x60e4e8d, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2a, 0x60e4e8d, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2c, 0x60e4e8d, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2c, 0x60e4e8d, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2c, 0x60e4e8d, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2c, 0x60e4e8d, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2c, 0x60e4e8d, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2c, 0x60e4e8d, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1e8, 0x3, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1f0, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x1f8, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x200, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x3, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x4, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x210, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf29, 0xc34e4e8d, 0x1, 0x0
+  .word 0x218, 0x3, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf29, 0xc34e4e8d, 0x1, 0x0
+  .word 0x220, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2a, 0xc34e4e8d, 0x1, 0x0
+  .word 0x228, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf29, 0xc34e4e8d, 0x1, 0x0
+  .word 0x230, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf29, 0xc34e4e8d, 0x1, 0x0
+  .word 0x238, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf29, 0xc34e4e8d, 0x1, 0x0
+  .word 0x238, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf29, 0xc34e4e8d, 0x1, 0x0
+  .word 0x238, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf2a, 0xc34e4e8d, 0x1, 0x0
+  .word 0x238, 0x3, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf29, 0xc34e4e8d, 0x1, 0x0
+  .word 0x238, 0x4, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x0, 0x6354cf29, 0xc34e4e8d, 0x1, 0x0
+  .word 0x180, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d52, 0x7a1d967c, 0x1, 0x0
+  .word 0x188, 0x3, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d52, 0x7a1d967c, 0x1, 0x0
+  .word 0x190, 0x0, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d52, 0x7a1d967c, 0x1, 0x0
+  .word 0x198, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d53, 0x7a1d967c, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d53, 0x7a1d967c, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d52, 0x7a1d967c, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d52, 0x7a1d967c, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d52, 0x7a1d967c, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d53, 0x7a1d967c, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d53, 0x7a1d967c, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d4e, 0x7a1d967c, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d4d, 0x7a1d967c, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d4d, 0x7a1d967c, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d4e, 0x7a1d967c, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d4e, 0x7a1d967c, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d4e, 0x7a1d967c, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d4d, 0x7a1d967c, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d4d, 0x7a1d967c, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d4e, 0x7a1d967c, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x8ef96d4e, 0x7a1d967c, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x1e8, 0x3, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x1f0, 0x0, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x1f8, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x200, 0x1, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x0, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x1, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x208, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x208, 0x3, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x4, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x210, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xd8c78aa6, 0x4327ab96, 0x1, 0x0
+  .word 0x218, 0x3, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xd8c78aa6, 0x4327ab96, 0x1, 0x0
+  .word 0x220, 0x0, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xd8c78aa6, 0x4327ab96, 0x1, 0x0
+  .word 0x228, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xd8c78aa7, 0x4327ab96, 0x1, 0x0
+  .word 0x230, 0x1, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xd8c78aa6, 0x4327ab96, 0x1, 0x0
+  .word 0x238, 0x0, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xd8c78aa6, 0x4327ab96, 0x1, 0x0
+  .word 0x238, 0x1, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xd8c78aa6, 0x4327ab96, 0x1, 0x0
+  .word 0x238, 0x2, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xd8c78aa6, 0x4327ab96, 0x1, 0x0
+  .word 0x238, 0x3, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xd8c78aa7, 0x4327ab96, 0x1, 0x0
+  .word 0x238, 0x4, 0x8ef96d50, 0x7a1d967c, 0x0, 0x76e40000, 0x0, 0x0, 0xd8c78aa6, 0x4327ab96, 0x1, 0x0
+  .word 0x180, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x40d0c3c8, 0x1, 0x0
+  .word 0x188, 0x3, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x0
+  .word 0x190, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x0
+  .word 0x198, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x40d0c3c8, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x1e8, 0x3, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x1f0, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x1f8, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc485, 0x3e60c3c8, 0x1, 0x0
+  .word 0x200, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x208, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x208, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x208, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x208, 0x3, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc485, 0x3e60c3c8, 0x1, 0x0
+  .word 0x208, 0x4, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x210, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x4340c3c8, 0x1, 0x0
+  .word 0x218, 0x3, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc481, 0x4340c3c8, 0x1, 0x0
+  .word 0x220, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc481, 0x4340c3c8, 0x1, 0x0
+  .word 0x228, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x4340c3c8, 0x1, 0x0
+  .word 0x230, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x4340c3c8, 0x1, 0x0
+  .word 0x238, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x4340c3c8, 0x1, 0x0
+  .word 0x238, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc481, 0x4340c3c8, 0x1, 0x0
+  .word 0x238, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc481, 0x4340c3c8, 0x1, 0x0
+  .word 0x238, 0x3, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x4340c3c8, 0x1, 0x0
+  .word 0x238, 0x4, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x0, 0xc4bc482, 0x4340c3c8, 0x1, 0x0
+  .word 0x180, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0x3f514a0c, 0x1, 0x0
+  .word 0x188, 0x3, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0x3f514a0c, 0x1, 0x0
+  .word 0x190, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0x3f514a0c, 0x1, 0x0
+  .word 0x198, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0x3f514a0c, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0x3f514a0c, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0x3f514a0c, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0x3f514a0c, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0x3f514a0c, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0x3f514a0c, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0x3f514a0c, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0x3f514a0c, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0x3f514a0c, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0x3f514a0c, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0x3f514a0c, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0xbb614a0c, 0x1, 0x0
+  .word 0x1e8, 0x3, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0xbb614a0c, 0x1, 0x0
+  .word 0x1f0, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76924, 0xbb614a0c, 0x1, 0x0
+  .word 0x1f8, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0xbb614a0c, 0x1, 0x0
+  .word 0x200, 0x1, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0xbb614a0c, 0x1, 0x0
+  .word 0x208, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0xbb614a0c, 0x1, 0x0
+  .word 0x208, 0x1, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0xbb614a0c, 0x1, 0x0
+  .word 0x208, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76924, 0xbb614a0c, 0x1, 0x0
+  .word 0x208, 0x3, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0xbb614a0c, 0x1, 0x0
+  .word 0x208, 0x4, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76923, 0xbb614a0c, 0x1, 0x0
+  .word 0x210, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0xc3414a0c, 0x1, 0x0
+  .word 0x218, 0x3, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76920, 0xc3414a0c, 0x1, 0x0
+  .word 0x220, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0xc3414a0c, 0x1, 0x0
+  .word 0x228, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76920, 0xc3414a0c, 0x1, 0x0
+  .word 0x230, 0x1, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0xc3414a0c, 0x1, 0x0
+  .word 0x238, 0x0, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0xc3414a0c, 0x1, 0x0
+  .word 0x238, 0x1, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76920, 0xc3414a0c, 0x1, 0x0
+  .word 0x238, 0x2, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0xc3414a0c, 0x1, 0x0
+  .word 0x238, 0x3, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76920, 0xc3414a0c, 0x1, 0x0
+  .word 0x238, 0x4, 0x5ed76922, 0x3f514a0c, 0x1, 0xbc000000, 0x0, 0x0, 0x5ed76921, 0xc3414a0c, 0x1, 0x0
+  .word 0x180, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f6, 0x3e5b0052, 0x1, 0x0
+  .word 0x188, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f5, 0x3e5b0052, 0x1, 0x0
+  .word 0x190, 0x0, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f5, 0x3e5b0052, 0x1, 0x0
+  .word 0x198, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f6, 0x3e5b0052, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f6, 0x3e5b0052, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f6, 0x3e5b0052, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f5, 0x3e5b0052, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f5, 0x3e5b0052, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f6, 0x3e5b0052, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f6, 0x3e5b0052, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f2, 0x3e5b0052, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f2, 0x3e5b0052, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f2, 0x3e5b0052, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f3, 0x3e5b0052, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f3, 0x3e5b0052, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f2, 0x3e5b0052, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f2, 0x3e5b0052, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f2, 0x3e5b0052, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f3, 0x3e5b0052, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0xf67ca4f3, 0x3e5b0052, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x1e8, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x1f0, 0x0, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x1f8, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x200, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x208, 0x0, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x208, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x208, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x208, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x208, 0x4, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x210, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x4efdc34d, 0x43320037, 0x1, 0x0
+  .word 0x218, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x4efdc34d, 0x43320037, 0x1, 0x0
+  .word 0x220, 0x0, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x4efdc34d, 0x43320037, 0x1, 0x0
+  .word 0x228, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x4efdc34e, 0x43320037, 0x1, 0x0
+  .word 0x230, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x4efdc34d, 0x43320037, 0x1, 0x0
+  .word 0x238, 0x0, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x4efdc34d, 0x43320037, 0x1, 0x0
+  .word 0x238, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x4efdc34d, 0x43320037, 0x1, 0x0
+  .word 0x238, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x4efdc34d, 0x43320037, 0x1, 0x0
+  .word 0x238, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x4efdc34e, 0x43320037, 0x1, 0x0
+  .word 0x238, 0x4, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x0, 0x4efdc34d, 0x43320037, 0x1, 0x0
+  .word 0x180, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a542e, 0x41d1743a, 0x1, 0x0
+  .word 0x188, 0x3, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a542d, 0x41d1743a, 0x1, 0x0
+  .word 0x190, 0x0, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a542d, 0x41d1743a, 0x1, 0x0
+  .word 0x198, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a542e, 0x41d1743a, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a542e, 0x41d1743a, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a542e, 0x41d1743a, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a542d, 0x41d1743a, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a542d, 0x41d1743a, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a542e, 0x41d1743a, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a542e, 0x41d1743a, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a5432, 0x41d1743a, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a5432, 0x41d1743a, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a5432, 0x41d1743a, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a5433, 0x41d1743a, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a5433, 0x41d1743a, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a5432, 0x41d1743a, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a5432, 0x41d1743a, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a5432, 0x41d1743a, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a5433, 0x41d1743a, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0x360a5433, 0x41d1743a, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xc38ce93c, 0xc085d148, 0x0, 0x0
+  .word 0x1e8, 0x3, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xc38ce93c, 0xc085d148, 0x0, 0x0
+  .word 0x1f0, 0x0, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xc38ce93c, 0xc085d148, 0x0, 0x0
+  .word 0x1f8, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xc38ce93c, 0xc085d148, 0x0, 0x0
+  .word 0x200, 0x1, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xc38ce93c, 0xc085d148, 0x0, 0x0
+  .word 0x208, 0x0, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xc38ce93c, 0xc085d148, 0x0, 0x0
+  .word 0x208, 0x1, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xc38ce93c, 0xc085d148, 0x0, 0x0
+  .word 0x208, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xc38ce93c, 0xc085d148, 0x0, 0x0
+  .word 0x208, 0x3, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xc38ce93c, 0xc085d148, 0x0, 0x0
+  .word 0x208, 0x4, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xc38ce93c, 0xc085d148, 0x0, 0x0
+  .word 0x210, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xf01086b3, 0xc31bed29, 0x1, 0x0
+  .word 0x218, 0x3, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xf01086b3, 0xc31bed29, 0x1, 0x0
+  .word 0x220, 0x0, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xf01086b4, 0xc31bed29, 0x1, 0x0
+  .word 0x228, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xf01086b3, 0xc31bed29, 0x1, 0x0
+  .word 0x230, 0x1, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xf01086b3, 0xc31bed29, 0x1, 0x0
+  .word 0x238, 0x0, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xf01086b3, 0xc31bed29, 0x1, 0x0
+  .word 0x238, 0x1, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xf01086b3, 0xc31bed29, 0x1, 0x0
+  .word 0x238, 0x2, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xf01086b4, 0xc31bed29, 0x1, 0x0
+  .word 0x238, 0x3, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xf01086b3, 0xc31bed29, 0x1, 0x0
+  .word 0x238, 0x4, 0x360a5430, 0x41d1743a, 0x0, 0xbea40000, 0x0, 0x0, 0xf01086b3, 0xc31bed29, 0x1, 0x0
+  .word 0x180, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158290, 0x37d958f2, 0x1, 0x0
+  .word 0x188, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158290, 0x37d958f2, 0x1, 0x0
+  .word 0x190, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158290, 0x37d958f2, 0x1, 0x0
+  .word 0x198, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158291, 0x37d958f2, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158291, 0x37d958f2, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158290, 0x37d958f2, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158290, 0x37d958f2, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158290, 0x37d958f2, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158291, 0x37d958f2, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158291, 0x37d958f2, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158298, 0x37d958f2, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158297, 0x37d958f2, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158297, 0x37d958f2, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158298, 0x37d958f2, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158298, 0x37d958f2, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158298, 0x37d958f2, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158297, 0x37d958f2, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158297, 0x37d958f2, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158298, 0x37d958f2, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0xfa158298, 0x37d958f2, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x9ad2d242, 0xac962dd4, 0x1, 0x0
+  .word 0x1e8, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x9ad2d241, 0xac962dd4, 0x1, 0x0
+  .word 0x1f0, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x9ad2d242, 0xac962dd4, 0x1, 0x0
+  .word 0x1f8, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x9ad2d241, 0xac962dd4, 0x1, 0x0
+  .word 0x200, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x9ad2d242, 0xac962dd4, 0x1, 0x0
+  .word 0x208, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x9ad2d242, 0xac962dd4, 0x1, 0x0
+  .word 0x208, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x9ad2d241, 0xac962dd4, 0x1, 0x0
+  .word 0x208, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x9ad2d242, 0xac962dd4, 0x1, 0x0
+  .word 0x208, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x9ad2d241, 0xac962dd4, 0x1, 0x0
+  .word 0x208, 0x4, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x9ad2d242, 0xac962dd4, 0x1, 0x0
+  .word 0x210, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x1dcf70a9, 0xc31cf7f1, 0x1, 0x0
+  .word 0x218, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x1dcf70a9, 0xc31cf7f1, 0x1, 0x0
+  .word 0x220, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x1dcf70aa, 0xc31cf7f1, 0x1, 0x0
+  .word 0x228, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x1dcf70a9, 0xc31cf7f1, 0x1, 0x0
+  .word 0x230, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x1dcf70a9, 0xc31cf7f1, 0x1, 0x0
+  .word 0x238, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x1dcf70a9, 0xc31cf7f1, 0x1, 0x0
+  .word 0x238, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x1dcf70a9, 0xc31cf7f1, 0x1, 0x0
+  .word 0x238, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x1dcf70aa, 0xc31cf7f1, 0x1, 0x0
+  .word 0x238, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x1dcf70a9, 0xc31cf7f1, 0x1, 0x0
+  .word 0x238, 0x4, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x0, 0x1dcf70a9, 0xc31cf7f1, 0x1, 0x0
+  .word 0x180, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d2, 0x3416bd14, 0x1, 0x0
+  .word 0x188, 0x3, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d2, 0x3416bd14, 0x1, 0x0
+  .word 0x190, 0x0, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d2, 0x3416bd14, 0x1, 0x0
+  .word 0x198, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0x3416bd14, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0x3416bd14, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d2, 0x3416bd14, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d2, 0x3416bd14, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d2, 0x3416bd14, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0x3416bd14, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0x3416bd14, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d4, 0x3416bd14, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0x3416bd14, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0x3416bd14, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d4, 0x3416bd14, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d4, 0x3416bd14, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d4, 0x3416bd14, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0x3416bd14, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0x3416bd14, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d4, 0x3416bd14, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d4, 0x3416bd14, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xa4e6bd14, 0x0, 0x0
+  .word 0x1e8, 0x3, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xa4e6bd14, 0x0, 0x0
+  .word 0x1f0, 0x0, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xa4e6bd14, 0x0, 0x0
+  .word 0x1f8, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xa4e6bd14, 0x0, 0x0
+  .word 0x200, 0x1, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xa4e6bd14, 0x0, 0x0
+  .word 0x208, 0x0, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xa4e6bd14, 0x0, 0x0
+  .word 0x208, 0x1, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xa4e6bd14, 0x0, 0x0
+  .word 0x208, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xa4e6bd14, 0x0, 0x0
+  .word 0x208, 0x3, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xa4e6bd14, 0x0, 0x0
+  .word 0x208, 0x4, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xa4e6bd14, 0x0, 0x0
+  .word 0x210, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xc346bd14, 0x0, 0x0
+  .word 0x218, 0x3, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xc346bd14, 0x0, 0x0
+  .word 0x220, 0x0, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xc346bd14, 0x0, 0x0
+  .word 0x228, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xc346bd14, 0x0, 0x0
+  .word 0x230, 0x1, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xc346bd14, 0x0, 0x0
+  .word 0x238, 0x0, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xc346bd14, 0x0, 0x0
+  .word 0x238, 0x1, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xc346bd14, 0x0, 0x0
+  .word 0x238, 0x2, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xc346bd14, 0x0, 0x0
+  .word 0x238, 0x3, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xc346bd14, 0x0, 0x0
+  .word 0x238, 0x4, 0x8fedb2d3, 0x3416bd14, 0x0, 0xb0c00000, 0x0, 0x0, 0x8fedb2d3, 0xc346bd14, 0x0, 0x0
+  .word 0x180, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433eb, 0xbfbedda7, 0x1, 0x0
+  .word 0x188, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433eb, 0xbfbedda7, 0x1, 0x0
+  .word 0x190, 0x0, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ec, 0xbfbedda7, 0x1, 0x0
+  .word 0x198, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433eb, 0xbfbedda7, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433eb, 0xbfbedda7, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433eb, 0xbfbedda7, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433eb, 0xbfbedda7, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ec, 0xbfbedda7, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433eb, 0xbfbedda7, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433eb, 0xbfbedda7, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ef, 0xbfbedda7, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ee, 0xbfbedda7, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ef, 0xbfbedda7, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ee, 0xbfbedda7, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ef, 0xbfbedda7, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ef, 0xbfbedda7, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ee, 0xbfbedda7, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ef, 0xbfbedda7, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ee, 0xbfbedda7, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x1fc433ef, 0xbfbedda7, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x57d326f3, 0xbc47263d, 0x1, 0x0
+  .word 0x1e8, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x57d326f2, 0xbc47263d, 0x1, 0x0
+  .word 0x1f0, 0x0, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x57d326f3, 0xbc47263d, 0x1, 0x0
+  .word 0x1f8, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x57d326f2, 0xbc47263d, 0x1, 0x0
+  .word 0x200, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x57d326f3, 0xbc47263d, 0x1, 0x0
+  .word 0x208, 0x0, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x57d326f3, 0xbc47263d, 0x1, 0x0
+  .word 0x208, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x57d326f2, 0xbc47263d, 0x1, 0x0
+  .word 0x208, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x57d326f3, 0xbc47263d, 0x1, 0x0
+  .word 0x208, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x57d326f2, 0xbc47263d, 0x1, 0x0
+  .word 0x208, 0x4, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0x57d326f3, 0xbc47263d, 0x1, 0x0
+  .word 0x210, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0xbfd8229d, 0xc33493c4, 0x1, 0x0
+  .word 0x218, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0xbfd8229d, 0xc33493c4, 0x1, 0x0
+  .word 0x220, 0x0, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0xbfd8229e, 0xc33493c4, 0x1, 0x0
+  .word 0x228, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0xbfd8229d, 0xc33493c4, 0x1, 0x0
+  .word 0x230, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0xbfd8229d, 0xc33493c4, 0x1, 0x0
+  .word 0x238, 0x0, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0xbfd8229d, 0xc33493c4, 0x1, 0x0
+  .word 0x238, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0xbfd8229d, 0xc33493c4, 0x1, 0x0
+  .word 0x238, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0xbfd8229e, 0xc33493c4, 0x1, 0x0
+  .word 0x238, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0xbfd8229d, 0xc33493c4, 0x1, 0x0
+  .word 0x238, 0x4, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x0, 0xbfd8229d, 0xc33493c4, 0x1, 0x0
+  .word 0x180, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbdc, 0x1a9d5a08, 0x1, 0x0
+  .word 0x188, 0x3, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbdc, 0x1a9d5a08, 0x1, 0x0
+  .word 0x190, 0x0, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbdc, 0x1a9d5a08, 0x1, 0x0
+  .word 0x198, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbdd, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbdd, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbdc, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbdc, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbdc, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbdd, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbdd, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbda, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbd9, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbd9, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbda, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbda, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbda, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbd9, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbd9, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbda, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0xded8fbda, 0x1a9d5a08, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1e8, 0x3, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f0, 0x0, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f8, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x200, 0x1, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x0, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x1, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x3, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x208, 0x4, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x210, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x3f3b5292, 0x4333915b, 0x0, 0x0
+  .word 0x218, 0x3, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x3f3b5292, 0x4333915b, 0x0, 0x0
+  .word 0x220, 0x0, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x3f3b5292, 0x4333915b, 0x0, 0x0
+  .word 0x228, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x3f3b5292, 0x4333915b, 0x0, 0x0
+  .word 0x230, 0x1, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x3f3b5292, 0x4333915b, 0x0, 0x0
+  .word 0x238, 0x0, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x3f3b5292, 0x4333915b, 0x0, 0x0
+  .word 0x238, 0x1, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x3f3b5292, 0x4333915b, 0x0, 0x0
+  .word 0x238, 0x2, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x3f3b5292, 0x4333915b, 0x0, 0x0
+  .word 0x238, 0x3, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x3f3b5292, 0x4333915b, 0x0, 0x0
+  .word 0x238, 0x4, 0xded8fbdb, 0x1a9d5a08, 0x0, 0x17580000, 0x0, 0x0, 0x3f3b5292, 0x4333915b, 0x0, 0x0
+  .word 0x180, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9a, 0x85b30312, 0x1, 0x0
+  .word 0x188, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb99, 0x85b30312, 0x1, 0x0
+  .word 0x190, 0x0, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9a, 0x85b30312, 0x1, 0x0
+  .word 0x198, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb99, 0x85b30312, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9a, 0x85b30312, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9a, 0x85b30312, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb99, 0x85b30312, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9a, 0x85b30312, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb99, 0x85b30312, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9a, 0x85b30312, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9c, 0x85b30312, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9c, 0x85b30312, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9d, 0x85b30312, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9c, 0x85b30312, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9d, 0x85b30312, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9c, 0x85b30312, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9c, 0x85b30312, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9d, 0x85b30312, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9c, 0x85b30312, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0xd99acb9d, 0x85b30312, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1e8, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1f0, 0x0, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x1f8, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x200, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x0, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x4, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x210, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x77790f79, 0xc329596e, 0x1, 0x0
+  .word 0x218, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x77790f79, 0xc329596e, 0x1, 0x0
+  .word 0x220, 0x0, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x77790f7a, 0xc329596e, 0x1, 0x0
+  .word 0x228, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x77790f79, 0xc329596e, 0x1, 0x0
+  .word 0x230, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x77790f79, 0xc329596e, 0x1, 0x0
+  .word 0x238, 0x0, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x77790f79, 0xc329596e, 0x1, 0x0
+  .word 0x238, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x77790f79, 0xc329596e, 0x1, 0x0
+  .word 0x238, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x77790f7a, 0xc329596e, 0x1, 0x0
+  .word 0x238, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x77790f79, 0xc329596e, 0x1, 0x0
+  .word 0x238, 0x4, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x0, 0x77790f79, 0xc329596e, 0x1, 0x0
+  .word 0x180, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e5, 0x69919e03, 0x1, 0x0
+  .word 0x188, 0x3, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e4, 0x69919e03, 0x1, 0x0
+  .word 0x190, 0x0, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e4, 0x69919e03, 0x1, 0x0
+  .word 0x198, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e5, 0x69919e03, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e5, 0x69919e03, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e5, 0x69919e03, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e4, 0x69919e03, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e4, 0x69919e03, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e5, 0x69919e03, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e5, 0x69919e03, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e7, 0x69919e03, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e7, 0x69919e03, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e7, 0x69919e03, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e8, 0x69919e03, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e7, 0x69919e03, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e7, 0x69919e03, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e7, 0x69919e03, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e7, 0x69919e03, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e8, 0x69919e03, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x5661f8e7, 0x69919e03, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x1e8, 0x3, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x5, 0x0
+  .word 0x1f0, 0x0, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x1f8, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x5, 0x0
+  .word 0x200, 0x1, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x208, 0x0, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x208, 0x1, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x5, 0x0
+  .word 0x208, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x208, 0x3, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xffffffff, 0xffefffff, 0x5, 0x0
+  .word 0x208, 0x4, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x210, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xc882a134, 0xc3277d59, 0x1, 0x0
+  .word 0x218, 0x3, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xc882a133, 0xc3277d59, 0x1, 0x0
+  .word 0x220, 0x0, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xc882a134, 0xc3277d59, 0x1, 0x0
+  .word 0x228, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xc882a133, 0xc3277d59, 0x1, 0x0
+  .word 0x230, 0x1, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xc882a134, 0xc3277d59, 0x1, 0x0
+  .word 0x238, 0x0, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xc882a134, 0xc3277d59, 0x1, 0x0
+  .word 0x238, 0x1, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xc882a133, 0xc3277d59, 0x1, 0x0
+  .word 0x238, 0x2, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xc882a134, 0xc3277d59, 0x1, 0x0
+  .word 0x238, 0x3, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xc882a133, 0xc3277d59, 0x1, 0x0
+  .word 0x238, 0x4, 0x5661f8e6, 0x69919e03, 0xffffffff, 0xe657ffff, 0x0, 0x0, 0xc882a134, 0xc3277d59, 0x1, 0x0
+  .word 0x180, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72b8, 0x3f49e8fc, 0x1, 0x0
+  .word 0x188, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72b8, 0x3f49e8fc, 0x1, 0x0
+  .word 0x190, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72b8, 0x3f49e8fc, 0x1, 0x0
+  .word 0x198, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72b9, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72b9, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72b8, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72b8, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72b8, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72b9, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72b9, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72be, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72bd, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72bd, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72be, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72be, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72be, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72bd, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72bd, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72be, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xa94f72be, 0x3f49e8fc, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xe9d1a7b5, 0xbb70319d, 0x1, 0x0
+  .word 0x1e8, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xe9d1a7b4, 0xbb70319d, 0x1, 0x0
+  .word 0x1f0, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xe9d1a7b5, 0xbb70319d, 0x1, 0x0
+  .word 0x1f8, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xe9d1a7b4, 0xbb70319d, 0x1, 0x0
+  .word 0x200, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xe9d1a7b5, 0xbb70319d, 0x1, 0x0
+  .word 0x208, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xe9d1a7b5, 0xbb70319d, 0x1, 0x0
+  .word 0x208, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xe9d1a7b4, 0xbb70319d, 0x1, 0x0
+  .word 0x208, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xe9d1a7b5, 0xbb70319d, 0x1, 0x0
+  .word 0x208, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xe9d1a7b4, 0xbb70319d, 0x1, 0x0
+  .word 0x208, 0x4, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xe9d1a7b5, 0xbb70319d, 0x1, 0x0
+  .word 0x210, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xbaa5f562, 0xc324ba63, 0x1, 0x0
+  .word 0x218, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xbaa5f562, 0xc324ba63, 0x1, 0x0
+  .word 0x220, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xbaa5f563, 0xc324ba63, 0x1, 0x0
+  .word 0x228, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xbaa5f562, 0xc324ba63, 0x1, 0x0
+  .word 0x230, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xbaa5f562, 0xc324ba63, 0x1, 0x0
+  .word 0x238, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xbaa5f562, 0xc324ba63, 0x1, 0x0
+  .word 0x238, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xbaa5f562, 0xc324ba63, 0x1, 0x0
+  .word 0x238, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xbaa5f563, 0xc324ba63, 0x1, 0x0
+  .word 0x238, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xbaa5f562, 0xc324ba63, 0x1, 0x0
+  .word 0x238, 0x4, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x0, 0xbaa5f562, 0xc324ba63, 0x1, 0x0
+  .word 0x180, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x7411345a, 0x1aea7a4e, 0x1, 0x0
+  .word 0x188, 0x3, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113459, 0x1aea7a4e, 0x1, 0x0
+  .word 0x190, 0x0, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113459, 0x1aea7a4e, 0x1, 0x0
+  .word 0x198, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x7411345a, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x7411345a, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x7411345a, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113459, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113459, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x7411345a, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x7411345a, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113456, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113456, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113456, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113457, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113457, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113456, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113456, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113456, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113457, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x74113457, 0x1aea7a4e, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1e8, 0x3, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f0, 0x0, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f8, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x200, 0x1, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x0, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x1, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x3, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x208, 0x4, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x210, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0xf80b783b, 0x4331a6de, 0x1, 0x0
+  .word 0x218, 0x3, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0xf80b783a, 0x4331a6de, 0x1, 0x0
+  .word 0x220, 0x0, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0xf80b783a, 0x4331a6de, 0x1, 0x0
+  .word 0x228, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0xf80b783b, 0x4331a6de, 0x1, 0x0
+  .word 0x230, 0x1, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0xf80b783b, 0x4331a6de, 0x1, 0x0
+  .word 0x238, 0x0, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0xf80b783b, 0x4331a6de, 0x1, 0x0
+  .word 0x238, 0x1, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0xf80b783a, 0x4331a6de, 0x1, 0x0
+  .word 0x238, 0x2, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0xf80b783a, 0x4331a6de, 0x1, 0x0
+  .word 0x238, 0x3, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0xf80b783b, 0x4331a6de, 0x1, 0x0
+  .word 0x238, 0x4, 0x74113458, 0x1aea7a4e, 0x0, 0x17a80000, 0x0, 0x0, 0xf80b783b, 0x4331a6de, 0x1, 0x0
+  .word 0x180, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x188, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x190, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x198, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c852a, 0x4163523e, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c852a, 0x4163523e, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x4163523e, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x4163523e, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x4163523e, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x4163523e, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x1e8, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x1f0, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x1f8, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x3f83523e, 0x1, 0x0
+  .word 0x200, 0x1, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x208, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x208, 0x1, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x208, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x208, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x3f83523e, 0x1, 0x0
+  .word 0x208, 0x4, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x210, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c852a, 0x4343523e, 0x1, 0x0
+  .word 0x218, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4343523e, 0x1, 0x0
+  .word 0x220, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4343523e, 0x1, 0x0
+  .word 0x228, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c852a, 0x4343523e, 0x1, 0x0
+  .word 0x230, 0x1, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c852a, 0x4343523e, 0x1, 0x0
+  .word 0x238, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c852a, 0x4343523e, 0x1, 0x0
+  .word 0x238, 0x1, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4343523e, 0x1, 0x0
+  .word 0x238, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c8529, 0x4343523e, 0x1, 0x0
+  .word 0x238, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c852a, 0x4343523e, 0x1, 0x0
+  .word 0x238, 0x4, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x0, 0x1e2c852a, 0x4343523e, 0x1, 0x0
+  .word 0x180, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad4, 0x6a875c43, 0x1, 0x0
+  .word 0x188, 0x3, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad3, 0x6a875c43, 0x1, 0x0
+  .word 0x190, 0x0, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad3, 0x6a875c43, 0x1, 0x0
+  .word 0x198, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad4, 0x6a875c43, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad4, 0x6a875c43, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad4, 0x6a875c43, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad3, 0x6a875c43, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad3, 0x6a875c43, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad4, 0x6a875c43, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad4, 0x6a875c43, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad0, 0x6a875c43, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad0, 0x6a875c43, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad0, 0x6a875c43, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad1, 0x6a875c43, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad1, 0x6a875c43, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad0, 0x6a875c43, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad0, 0x6a875c43, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad0, 0x6a875c43, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad1, 0x6a875c43, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x808e8ad1, 0x6a875c43, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x1e8, 0x3, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x1f0, 0x0, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x1f8, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x200, 0x1, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x0, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x1, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x208, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x208, 0x3, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x4, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x210, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x561363c3, 0x432f25af, 0x1, 0x0
+  .word 0x218, 0x3, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x561363c2, 0x432f25af, 0x1, 0x0
+  .word 0x220, 0x0, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x561363c2, 0x432f25af, 0x1, 0x0
+  .word 0x228, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x561363c3, 0x432f25af, 0x1, 0x0
+  .word 0x230, 0x1, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x561363c3, 0x432f25af, 0x1, 0x0
+  .word 0x238, 0x0, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x561363c3, 0x432f25af, 0x1, 0x0
+  .word 0x238, 0x1, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x561363c2, 0x432f25af, 0x1, 0x0
+  .word 0x238, 0x2, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x561363c2, 0x432f25af, 0x1, 0x0
+  .word 0x238, 0x3, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x561363c3, 0x432f25af, 0x1, 0x0
+  .word 0x238, 0x4, 0x808e8ad2, 0x6a875c43, 0x0, 0x67480000, 0x0, 0x0, 0x561363c3, 0x432f25af, 0x1, 0x0
+  .word 0x180, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec1, 0x3ff952eb, 0x1, 0x0
+  .word 0x188, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec1, 0x3ff952eb, 0x1, 0x0
+  .word 0x190, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec1, 0x3ff952eb, 0x1, 0x0
+  .word 0x198, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec1, 0x3ff952eb, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec1, 0x3ff952eb, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec1, 0x3ff952eb, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec1, 0x3ff952eb, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec1, 0x3ff952eb, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec3, 0x3ff952eb, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec3, 0x3ff952eb, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec3, 0x3ff952eb, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec3, 0x3ff952eb, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec3, 0x3ff952eb, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec3, 0x3ff952eb, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec4, 0xbca952eb, 0x1, 0x0
+  .word 0x1e8, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec3, 0xbca952eb, 0x1, 0x0
+  .word 0x1f0, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec4, 0xbca952eb, 0x1, 0x0
+  .word 0x1f8, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec3, 0xbca952eb, 0x1, 0x0
+  .word 0x200, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec4, 0xbca952eb, 0x1, 0x0
+  .word 0x208, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec4, 0xbca952eb, 0x1, 0x0
+  .word 0x208, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec3, 0xbca952eb, 0x1, 0x0
+  .word 0x208, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec4, 0xbca952eb, 0x1, 0x0
+  .word 0x208, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec3, 0xbca952eb, 0x1, 0x0
+  .word 0x208, 0x4, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec4, 0xbca952eb, 0x1, 0x0
+  .word 0x210, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec0, 0xc34952eb, 0x1, 0x0
+  .word 0x218, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec0, 0xc34952eb, 0x1, 0x0
+  .word 0x220, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec1, 0xc34952eb, 0x1, 0x0
+  .word 0x228, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec0, 0xc34952eb, 0x1, 0x0
+  .word 0x230, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec0, 0xc34952eb, 0x1, 0x0
+  .word 0x238, 0x0, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec0, 0xc34952eb, 0x1, 0x0
+  .word 0x238, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec0, 0xc34952eb, 0x1, 0x0
+  .word 0x238, 0x2, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec1, 0xc34952eb, 0x1, 0x0
+  .word 0x238, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec0, 0xc34952eb, 0x1, 0x0
+  .word 0x238, 0x4, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x0, 0xaf15eec0, 0xc34952eb, 0x1, 0x0
+  .word 0x180, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e70, 0x3e59ceae, 0x1, 0x0
+  .word 0x188, 0x3, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e6f, 0x3e59ceae, 0x1, 0x0
+  .word 0x190, 0x0, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e6f, 0x3e59ceae, 0x1, 0x0
+  .word 0x198, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e70, 0x3e59ceae, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e70, 0x3e59ceae, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e70, 0x3e59ceae, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e6f, 0x3e59ceae, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e6f, 0x3e59ceae, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e70, 0x3e59ceae, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e70, 0x3e59ceae, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e74, 0x3e59ceae, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e74, 0x3e59ceae, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e74, 0x3e59ceae, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e75, 0x3e59ceae, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e75, 0x3e59ceae, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e74, 0x3e59ceae, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e74, 0x3e59ceae, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e74, 0x3e59ceae, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e75, 0x3e59ceae, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x155c7e75, 0x3e59ceae, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0xcd59cf07, 0xb990212c, 0x1, 0x0
+  .word 0x1e8, 0x3, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0xcd59cf07, 0xb990212c, 0x1, 0x0
+  .word 0x1f0, 0x0, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0xcd59cf08, 0xb990212c, 0x1, 0x0
+  .word 0x1f8, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0xcd59cf07, 0xb990212c, 0x1, 0x0
+  .word 0x200, 0x1, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0xcd59cf07, 0xb990212c, 0x1, 0x0
+  .word 0x208, 0x0, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0xcd59cf07, 0xb990212c, 0x1, 0x0
+  .word 0x208, 0x1, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0xcd59cf07, 0xb990212c, 0x1, 0x0
+  .word 0x208, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0xcd59cf08, 0xb990212c, 0x1, 0x0
+  .word 0x208, 0x3, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0xcd59cf07, 0xb990212c, 0x1, 0x0
+  .word 0x208, 0x4, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0xcd59cf07, 0xb990212c, 0x1, 0x0
+  .word 0x210, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x1116cb8e, 0xc324a558, 0x1, 0x0
+  .word 0x218, 0x3, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x1116cb8e, 0xc324a558, 0x1, 0x0
+  .word 0x220, 0x0, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x1116cb8f, 0xc324a558, 0x1, 0x0
+  .word 0x228, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x1116cb8e, 0xc324a558, 0x1, 0x0
+  .word 0x230, 0x1, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x1116cb8e, 0xc324a558, 0x1, 0x0
+  .word 0x238, 0x0, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x1116cb8e, 0xc324a558, 0x1, 0x0
+  .word 0x238, 0x1, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x1116cb8e, 0xc324a558, 0x1, 0x0
+  .word 0x238, 0x2, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x1116cb8f, 0xc324a558, 0x1, 0x0
+  .word 0x238, 0x3, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x1116cb8e, 0xc324a558, 0x1, 0x0
+  .word 0x238, 0x4, 0x155c7e72, 0x3e59ceae, 0x0, 0xbb240000, 0x0, 0x0, 0x1116cb8e, 0xc324a558, 0x1, 0x0
+  .word 0x180, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x188, 0x3, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621b, 0x7dac18b, 0x1, 0x0
+  .word 0x190, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621b, 0x7dac18b, 0x1, 0x0
+  .word 0x198, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621b, 0x7dac18b, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621b, 0x7dac18b, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621d, 0x7dac18b, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621d, 0x7dac18b, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621d, 0x7dac18b, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621d, 0x7dac18b, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1e8, 0x3, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1f0, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x1f8, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x200, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x3, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x4, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x210, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0xc34ac18b, 0x0, 0x0
+  .word 0x218, 0x3, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0xc34ac18b, 0x0, 0x0
+  .word 0x220, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0xc34ac18b, 0x0, 0x0
+  .word 0x228, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0xc34ac18b, 0x0, 0x0
+  .word 0x230, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0xc34ac18b, 0x0, 0x0
+  .word 0x238, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0xc34ac18b, 0x0, 0x0
+  .word 0x238, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0xc34ac18b, 0x0, 0x0
+  .word 0x238, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0xc34ac18b, 0x0, 0x0
+  .word 0x238, 0x3, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0xc34ac18b, 0x0, 0x0
+  .word 0x238, 0x4, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x0, 0x217b621c, 0xc34ac18b, 0x0, 0x0
+  .word 0x180, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b5234, 0xbf1df011, 0x1, 0x0
+  .word 0x188, 0x3, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b5233, 0xbf1df011, 0x1, 0x0
+  .word 0x190, 0x0, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b5234, 0xbf1df011, 0x1, 0x0
+  .word 0x198, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b5233, 0xbf1df011, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b5234, 0xbf1df011, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b5234, 0xbf1df011, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b5233, 0xbf1df011, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b5234, 0xbf1df011, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b5233, 0xbf1df011, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b5234, 0xbf1df011, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b522c, 0xbf1df011, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b522c, 0xbf1df011, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b522d, 0xbf1df011, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b522c, 0xbf1df011, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b522d, 0xbf1df011, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b522c, 0xbf1df011, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b522c, 0xbf1df011, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b522d, 0xbf1df011, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b522c, 0xbf1df011, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xc75b522d, 0xbf1df011, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0x8e6fe7ea, 0x3b1a320f, 0x0, 0x0
+  .word 0x1e8, 0x3, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0x8e6fe7ea, 0x3b1a320f, 0x0, 0x0
+  .word 0x1f0, 0x0, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0x8e6fe7ea, 0x3b1a320f, 0x0, 0x0
+  .word 0x1f8, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0x8e6fe7ea, 0x3b1a320f, 0x0, 0x0
+  .word 0x200, 0x1, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0x8e6fe7ea, 0x3b1a320f, 0x0, 0x0
+  .word 0x208, 0x0, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0x8e6fe7ea, 0x3b1a320f, 0x0, 0x0
+  .word 0x208, 0x1, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0x8e6fe7ea, 0x3b1a320f, 0x0, 0x0
+  .word 0x208, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0x8e6fe7ea, 0x3b1a320f, 0x0, 0x0
+  .word 0x208, 0x3, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0x8e6fe7ea, 0x3b1a320f, 0x0, 0x0
+  .word 0x208, 0x4, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0x8e6fe7ea, 0x3b1a320f, 0x0, 0x0
+  .word 0x210, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xdfa1e5d2, 0x43211b77, 0x1, 0x0
+  .word 0x218, 0x3, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xdfa1e5d2, 0x43211b77, 0x1, 0x0
+  .word 0x220, 0x0, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xdfa1e5d2, 0x43211b77, 0x1, 0x0
+  .word 0x228, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xdfa1e5d3, 0x43211b77, 0x1, 0x0
+  .word 0x230, 0x1, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xdfa1e5d2, 0x43211b77, 0x1, 0x0
+  .word 0x238, 0x0, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xdfa1e5d2, 0x43211b77, 0x1, 0x0
+  .word 0x238, 0x1, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xdfa1e5d2, 0x43211b77, 0x1, 0x0
+  .word 0x238, 0x2, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xdfa1e5d2, 0x43211b77, 0x1, 0x0
+  .word 0x238, 0x3, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xdfa1e5d3, 0x43211b77, 0x1, 0x0
+  .word 0x238, 0x4, 0xc75b5230, 0xbf1df011, 0x0, 0xbbec0000, 0x0, 0x0, 0xdfa1e5d2, 0x43211b77, 0x1, 0x0
+  .word 0x180, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x3178687d, 0x9cb43524, 0x1, 0x0
+  .word 0x188, 0x3, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x3178687d, 0x9cb43524, 0x1, 0x0
+  .word 0x190, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x3178687e, 0x9cb43524, 0x1, 0x0
+  .word 0x198, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x3178687d, 0x9cb43524, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x3178687d, 0x9cb43524, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x3178687d, 0x9cb43524, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x3178687d, 0x9cb43524, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x3178687e, 0x9cb43524, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x3178687d, 0x9cb43524, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x3178687d, 0x9cb43524, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x31786879, 0x9cb43524, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x31786878, 0x9cb43524, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x31786879, 0x9cb43524, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x31786878, 0x9cb43524, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x31786879, 0x9cb43524, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x31786879, 0x9cb43524, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x31786878, 0x9cb43524, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x31786879, 0x9cb43524, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x31786878, 0x9cb43524, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x31786879, 0x9cb43524, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1e8, 0x3, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f0, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f8, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x200, 0x1, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x1, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x3, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x208, 0x4, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x210, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x5ac6b9fd, 0x43202a83, 0x1, 0x0
+  .word 0x218, 0x3, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x5ac6b9fc, 0x43202a83, 0x1, 0x0
+  .word 0x220, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x5ac6b9fc, 0x43202a83, 0x1, 0x0
+  .word 0x228, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x5ac6b9fd, 0x43202a83, 0x1, 0x0
+  .word 0x230, 0x1, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x5ac6b9fd, 0x43202a83, 0x1, 0x0
+  .word 0x238, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x5ac6b9fd, 0x43202a83, 0x1, 0x0
+  .word 0x238, 0x1, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x5ac6b9fc, 0x43202a83, 0x1, 0x0
+  .word 0x238, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x5ac6b9fc, 0x43202a83, 0x1, 0x0
+  .word 0x238, 0x3, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x5ac6b9fd, 0x43202a83, 0x1, 0x0
+  .word 0x238, 0x4, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x0, 0x5ac6b9fd, 0x43202a83, 0x1, 0x0
+  .word 0x180, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a78, 0x8cc48387, 0x1, 0x0
+  .word 0x188, 0x3, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a77, 0x8cc48387, 0x1, 0x0
+  .word 0x190, 0x0, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a78, 0x8cc48387, 0x1, 0x0
+  .word 0x198, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a77, 0x8cc48387, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a78, 0x8cc48387, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a78, 0x8cc48387, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a77, 0x8cc48387, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a78, 0x8cc48387, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a77, 0x8cc48387, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a78, 0x8cc48387, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a7c, 0x8cc48387, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a7c, 0x8cc48387, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a7d, 0x8cc48387, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a7c, 0x8cc48387, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a7d, 0x8cc48387, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a7c, 0x8cc48387, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a7c, 0x8cc48387, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a7d, 0x8cc48387, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a7c, 0x8cc48387, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0xdb5a4a7d, 0x8cc48387, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1e8, 0x3, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1f0, 0x0, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x1f8, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x200, 0x1, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x0, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x1, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x3, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x4, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x210, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x7c483b95, 0xc3206939, 0x1, 0x0
+  .word 0x218, 0x3, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x7c483b94, 0xc3206939, 0x1, 0x0
+  .word 0x220, 0x0, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x7c483b95, 0xc3206939, 0x1, 0x0
+  .word 0x228, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x7c483b94, 0xc3206939, 0x1, 0x0
+  .word 0x230, 0x1, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x7c483b95, 0xc3206939, 0x1, 0x0
+  .word 0x238, 0x0, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x7c483b95, 0xc3206939, 0x1, 0x0
+  .word 0x238, 0x1, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x7c483b94, 0xc3206939, 0x1, 0x0
+  .word 0x238, 0x2, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x7c483b95, 0xc3206939, 0x1, 0x0
+  .word 0x238, 0x3, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x7c483b94, 0xc3206939, 0x1, 0x0
+  .word 0x238, 0x4, 0xdb5a4a7a, 0x8cc48387, 0x0, 0x9940000, 0x0, 0x0, 0x7c483b95, 0xc3206939, 0x1, 0x0
+  .word 0x180, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x188, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x190, 0x0, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe353666a, 0xcea6bcd3, 0x1, 0x0
+  .word 0x198, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe353666a, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x1e8, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x1f0, 0x0, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x1f8, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0x5a06bcd3, 0x1, 0x0
+  .word 0x200, 0x1, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x208, 0x0, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x208, 0x1, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x208, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x208, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0x5a06bcd3, 0x1, 0x0
+  .word 0x208, 0x4, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x210, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe353666a, 0x4346bcd3, 0x1, 0x0
+  .word 0x218, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0x4346bcd3, 0x1, 0x0
+  .word 0x220, 0x0, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0x4346bcd3, 0x1, 0x0
+  .word 0x228, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe353666a, 0x4346bcd3, 0x1, 0x0
+  .word 0x230, 0x1, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe353666a, 0x4346bcd3, 0x1, 0x0
+  .word 0x238, 0x0, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe353666a, 0x4346bcd3, 0x1, 0x0
+  .word 0x238, 0x1, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0x4346bcd3, 0x1, 0x0
+  .word 0x238, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe3536669, 0x4346bcd3, 0x1, 0x0
+  .word 0x238, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe353666a, 0x4346bcd3, 0x1, 0x0
+  .word 0x238, 0x4, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x0, 0xe353666a, 0x4346bcd3, 0x1, 0x0
+  .word 0x180, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c3a, 0x715b48bb, 0x1, 0x0
+  .word 0x188, 0x3, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c3a, 0x715b48bb, 0x1, 0x0
+  .word 0x190, 0x0, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c3a, 0x715b48bb, 0x1, 0x0
+  .word 0x198, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c3b, 0x715b48bb, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c3b, 0x715b48bb, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c3a, 0x715b48bb, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c3a, 0x715b48bb, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c3a, 0x715b48bb, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c3b, 0x715b48bb, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c3b, 0x715b48bb, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c38, 0x715b48bb, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c37, 0x715b48bb, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c37, 0x715b48bb, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c38, 0x715b48bb, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c38, 0x715b48bb, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c38, 0x715b48bb, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c37, 0x715b48bb, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c37, 0x715b48bb, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c38, 0x715b48bb, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xc6779c38, 0x715b48bb, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x1e8, 0x3, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x1f0, 0x0, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x1f8, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x200, 0x1, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x0, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x1, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x208, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x208, 0x3, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x208, 0x4, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x210, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x2efa6826, 0x4332307d, 0x0, 0x0
+  .word 0x218, 0x3, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x2efa6826, 0x4332307d, 0x0, 0x0
+  .word 0x220, 0x0, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x2efa6826, 0x4332307d, 0x0, 0x0
+  .word 0x228, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x2efa6826, 0x4332307d, 0x0, 0x0
+  .word 0x230, 0x1, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x2efa6826, 0x4332307d, 0x0, 0x0
+  .word 0x238, 0x0, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x2efa6826, 0x4332307d, 0x0, 0x0
+  .word 0x238, 0x1, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x2efa6826, 0x4332307d, 0x0, 0x0
+  .word 0x238, 0x2, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x2efa6826, 0x4332307d, 0x0, 0x0
+  .word 0x238, 0x3, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x2efa6826, 0x4332307d, 0x0, 0x0
+  .word 0x238, 0x4, 0xc6779c39, 0x715b48bb, 0x0, 0x6e180000, 0x0, 0x0, 0x2efa6826, 0x4332307d, 0x0, 0x0
+  .word 0x180, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad48, 0x1f0adcf6, 0x1, 0x0
+  .word 0x188, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad47, 0x1f0adcf6, 0x1, 0x0
+  .word 0x190, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad47, 0x1f0adcf6, 0x1, 0x0
+  .word 0x198, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad48, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad48, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad48, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad47, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad47, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad48, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad48, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad4a, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad4a, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad4a, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad4b, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad4b, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad4a, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad4a, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad4a, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad4b, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x6e12ad4b, 0x1f0adcf6, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1e8, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1f0, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x1f8, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x200, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x4, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x210, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x4961c8db, 0xc331e8a4, 0x1, 0x0
+  .word 0x218, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x4961c8db, 0xc331e8a4, 0x1, 0x0
+  .word 0x220, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x4961c8dc, 0xc331e8a4, 0x1, 0x0
+  .word 0x228, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x4961c8db, 0xc331e8a4, 0x1, 0x0
+  .word 0x230, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x4961c8db, 0xc331e8a4, 0x1, 0x0
+  .word 0x238, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x4961c8db, 0xc331e8a4, 0x1, 0x0
+  .word 0x238, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x4961c8db, 0xc331e8a4, 0x1, 0x0
+  .word 0x238, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x4961c8dc, 0xc331e8a4, 0x1, 0x0
+  .word 0x238, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x4961c8db, 0xc331e8a4, 0x1, 0x0
+  .word 0x238, 0x4, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x0, 0x4961c8db, 0xc331e8a4, 0x1, 0x0
+  .word 0x180, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a76, 0xa5a0bc14, 0x1, 0x0
+  .word 0x188, 0x3, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a76, 0xa5a0bc14, 0x1, 0x0
+  .word 0x190, 0x0, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a77, 0xa5a0bc14, 0x1, 0x0
+  .word 0x198, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a76, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a77, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a76, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a76, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a77, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a76, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a77, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a7c, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a7b, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a7c, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a7b, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a7c, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a7c, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a7b, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a7c, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a7b, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x93886a7c, 0xa5a0bc14, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0xb86a8517, 0x8824eb19, 0x1, 0x0
+  .word 0x1e8, 0x3, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0xb86a8517, 0x8824eb19, 0x1, 0x0
+  .word 0x1f0, 0x0, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0xb86a8518, 0x8824eb19, 0x1, 0x0
+  .word 0x1f8, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0xb86a8517, 0x8824eb19, 0x1, 0x0
+  .word 0x200, 0x1, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0xb86a8517, 0x8824eb19, 0x1, 0x0
+  .word 0x208, 0x0, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0xb86a8517, 0x8824eb19, 0x1, 0x0
+  .word 0x208, 0x1, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0xb86a8517, 0x8824eb19, 0x1, 0x0
+  .word 0x208, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0xb86a8518, 0x8824eb19, 0x1, 0x0
+  .word 0x208, 0x3, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0xb86a8517, 0x8824eb19, 0x1, 0x0
+  .word 0x208, 0x4, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0xb86a8517, 0x8824eb19, 0x1, 0x0
+  .word 0x210, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x5273dd8e, 0xc31ac687, 0x1, 0x0
+  .word 0x218, 0x3, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x5273dd8e, 0xc31ac687, 0x1, 0x0
+  .word 0x220, 0x0, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x5273dd8f, 0xc31ac687, 0x1, 0x0
+  .word 0x228, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x5273dd8e, 0xc31ac687, 0x1, 0x0
+  .word 0x230, 0x1, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x5273dd8e, 0xc31ac687, 0x1, 0x0
+  .word 0x238, 0x0, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x5273dd8e, 0xc31ac687, 0x1, 0x0
+  .word 0x238, 0x1, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x5273dd8e, 0xc31ac687, 0x1, 0x0
+  .word 0x238, 0x2, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x5273dd8f, 0xc31ac687, 0x1, 0x0
+  .word 0x238, 0x3, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x5273dd8e, 0xc31ac687, 0x1, 0x0
+  .word 0x238, 0x4, 0x93886a79, 0xa5a0bc14, 0x0, 0x22740000, 0x0, 0x0, 0x5273dd8e, 0xc31ac687, 0x1, 0x0
+  .word 0x180, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b2, 0x11538beb, 0x1, 0x0
+  .word 0x188, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b1, 0x11538beb, 0x1, 0x0
+  .word 0x190, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b1, 0x11538beb, 0x1, 0x0
+  .word 0x198, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b2, 0x11538beb, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b2, 0x11538beb, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b2, 0x11538beb, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b1, 0x11538beb, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b1, 0x11538beb, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b2, 0x11538beb, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b2, 0x11538beb, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b4, 0x11538beb, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b4, 0x11538beb, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b4, 0x11538beb, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b5, 0x11538beb, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b4, 0x11538beb, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b4, 0x11538beb, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b4, 0x11538beb, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b4, 0x11538beb, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b5, 0x11538beb, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0xdf1e78b4, 0x11538beb, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1e8, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1f0, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x1f8, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x200, 0x1, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x1, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x4, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x210, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x297df645, 0xc32a0fe5, 0x1, 0x0
+  .word 0x218, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x297df645, 0xc32a0fe5, 0x1, 0x0
+  .word 0x220, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x297df646, 0xc32a0fe5, 0x1, 0x0
+  .word 0x228, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x297df645, 0xc32a0fe5, 0x1, 0x0
+  .word 0x230, 0x1, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x297df645, 0xc32a0fe5, 0x1, 0x0
+  .word 0x238, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x297df645, 0xc32a0fe5, 0x1, 0x0
+  .word 0x238, 0x1, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x297df645, 0xc32a0fe5, 0x1, 0x0
+  .word 0x238, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x297df646, 0xc32a0fe5, 0x1, 0x0
+  .word 0x238, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x297df645, 0xc32a0fe5, 0x1, 0x0
+  .word 0x238, 0x4, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x0, 0x297df645, 0xc32a0fe5, 0x1, 0x0
+  .word 0x180, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fc8, 0xa91548f7, 0x1, 0x0
+  .word 0x188, 0x3, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fc8, 0xa91548f7, 0x1, 0x0
+  .word 0x190, 0x0, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fc9, 0xa91548f7, 0x1, 0x0
+  .word 0x198, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fc8, 0xa91548f7, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fc8, 0xa91548f7, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fc8, 0xa91548f7, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fc8, 0xa91548f7, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fc9, 0xa91548f7, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fc8, 0xa91548f7, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fc8, 0xa91548f7, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fd0, 0xa91548f7, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fcf, 0xa91548f7, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fd0, 0xa91548f7, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fcf, 0xa91548f7, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fd0, 0xa91548f7, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fd0, 0xa91548f7, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fcf, 0xa91548f7, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fd0, 0xa91548f7, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fcf, 0xa91548f7, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x5ce9fd0, 0xa91548f7, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x2514cbd3, 0x8f129fd8, 0x1, 0x0
+  .word 0x1e8, 0x3, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x2514cbd3, 0x8f129fd8, 0x1, 0x0
+  .word 0x1f0, 0x0, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x2514cbd4, 0x8f129fd8, 0x1, 0x0
+  .word 0x1f8, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x2514cbd3, 0x8f129fd8, 0x1, 0x0
+  .word 0x200, 0x1, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x2514cbd3, 0x8f129fd8, 0x1, 0x0
+  .word 0x208, 0x0, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x2514cbd3, 0x8f129fd8, 0x1, 0x0
+  .word 0x208, 0x1, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x2514cbd3, 0x8f129fd8, 0x1, 0x0
+  .word 0x208, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x2514cbd4, 0x8f129fd8, 0x1, 0x0
+  .word 0x208, 0x3, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x2514cbd3, 0x8f129fd8, 0x1, 0x0
+  .word 0x208, 0x4, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x2514cbd3, 0x8f129fd8, 0x1, 0x0
+  .word 0x210, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x7459db31, 0xc3185363, 0x1, 0x0
+  .word 0x218, 0x3, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x7459db31, 0xc3185363, 0x1, 0x0
+  .word 0x220, 0x0, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x7459db32, 0xc3185363, 0x1, 0x0
+  .word 0x228, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x7459db31, 0xc3185363, 0x1, 0x0
+  .word 0x230, 0x1, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x7459db31, 0xc3185363, 0x1, 0x0
+  .word 0x238, 0x0, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x7459db31, 0xc3185363, 0x1, 0x0
+  .word 0x238, 0x1, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x7459db31, 0xc3185363, 0x1, 0x0
+  .word 0x238, 0x2, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x7459db32, 0xc3185363, 0x1, 0x0
+  .word 0x238, 0x3, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x7459db31, 0xc3185363, 0x1, 0x0
+  .word 0x238, 0x4, 0x5ce9fcc, 0xa91548f7, 0x1, 0x25ec0000, 0x0, 0x0, 0x7459db31, 0xc3185363, 0x1, 0x0
+  .word 0x180, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb9850c, 0xc033b679, 0x1, 0x0
+  .word 0x188, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb9850b, 0xc033b679, 0x1, 0x0
+  .word 0x190, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb9850c, 0xc033b679, 0x1, 0x0
+  .word 0x198, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb9850b, 0xc033b679, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb9850c, 0xc033b679, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb9850c, 0xc033b679, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb9850b, 0xc033b679, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb9850c, 0xc033b679, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb9850b, 0xc033b679, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb9850c, 0xc033b679, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb98512, 0xc033b679, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb98512, 0xc033b679, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb98513, 0xc033b679, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb98512, 0xc033b679, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb98513, 0xc033b679, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb98512, 0xc033b679, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb98512, 0xc033b679, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb98513, 0xc033b679, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb98512, 0xc033b679, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0xabb98513, 0xc033b679, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x1e8, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x1f0, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7642546e, 0xbd513faa, 0x1, 0x0
+  .word 0x1f8, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x200, 0x1, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x208, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x208, 0x1, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x208, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7642546e, 0xbd513faa, 0x1, 0x0
+  .word 0x208, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x208, 0x4, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x210, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7b1d2a5a, 0xc3168766, 0x1, 0x0
+  .word 0x218, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7b1d2a5a, 0xc3168766, 0x1, 0x0
+  .word 0x220, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7b1d2a5b, 0xc3168766, 0x1, 0x0
+  .word 0x228, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7b1d2a5a, 0xc3168766, 0x1, 0x0
+  .word 0x230, 0x1, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7b1d2a5a, 0xc3168766, 0x1, 0x0
+  .word 0x238, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7b1d2a5a, 0xc3168766, 0x1, 0x0
+  .word 0x238, 0x1, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7b1d2a5a, 0xc3168766, 0x1, 0x0
+  .word 0x238, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7b1d2a5b, 0xc3168766, 0x1, 0x0
+  .word 0x238, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7b1d2a5a, 0xc3168766, 0x1, 0x0
+  .word 0x238, 0x4, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x0, 0x7b1d2a5a, 0xc3168766, 0x1, 0x0
+  .word 0x180, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b8, 0xc05ac7e0, 0x1, 0x0
+  .word 0x188, 0x3, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b8, 0xc05ac7e0, 0x1, 0x0
+  .word 0x190, 0x0, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b9, 0xc05ac7e0, 0x1, 0x0
+  .word 0x198, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b8, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b9, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b8, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b8, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b9, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b8, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b9, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b2, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b1, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b2, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b1, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b2, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b2, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b1, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b2, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b1, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x349084b2, 0xc05ac7e0, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x2dfe741e, 0x3d976ee4, 0x1, 0x0
+  .word 0x1e8, 0x3, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x2dfe741e, 0x3d976ee4, 0x1, 0x0
+  .word 0x1f0, 0x0, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x2dfe741e, 0x3d976ee4, 0x1, 0x0
+  .word 0x1f8, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x2dfe741f, 0x3d976ee4, 0x1, 0x0
+  .word 0x200, 0x1, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x2dfe741e, 0x3d976ee4, 0x1, 0x0
+  .word 0x208, 0x0, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x2dfe741e, 0x3d976ee4, 0x1, 0x0
+  .word 0x208, 0x1, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x2dfe741e, 0x3d976ee4, 0x1, 0x0
+  .word 0x208, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x2dfe741e, 0x3d976ee4, 0x1, 0x0
+  .word 0x208, 0x3, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x2dfe741f, 0x3d976ee4, 0x1, 0x0
+  .word 0x208, 0x4, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x2dfe741e, 0x3d976ee4, 0x1, 0x0
+  .word 0x210, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x60a529f3, 0x431e9b49, 0x1, 0x0
+  .word 0x218, 0x3, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x60a529f3, 0x431e9b49, 0x1, 0x0
+  .word 0x220, 0x0, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x60a529f3, 0x431e9b49, 0x1, 0x0
+  .word 0x228, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x60a529f4, 0x431e9b49, 0x1, 0x0
+  .word 0x230, 0x1, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x60a529f3, 0x431e9b49, 0x1, 0x0
+  .word 0x238, 0x0, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x60a529f3, 0x431e9b49, 0x1, 0x0
+  .word 0x238, 0x1, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x60a529f3, 0x431e9b49, 0x1, 0x0
+  .word 0x238, 0x2, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x60a529f3, 0x431e9b49, 0x1, 0x0
+  .word 0x238, 0x3, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x60a529f4, 0x431e9b49, 0x1, 0x0
+  .word 0x238, 0x4, 0x349084b5, 0xc05ac7e0, 0x0, 0xbd2c0000, 0x0, 0x0, 0x60a529f3, 0x431e9b49, 0x1, 0x0
+  .word 0x180, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ced8, 0x1b6e3435, 0x1, 0x0
+  .word 0x188, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ced7, 0x1b6e3435, 0x1, 0x0
+  .word 0x190, 0x0, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ced7, 0x1b6e3435, 0x1, 0x0
+  .word 0x198, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ced8, 0x1b6e3435, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ced8, 0x1b6e3435, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ced8, 0x1b6e3435, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ced7, 0x1b6e3435, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ced7, 0x1b6e3435, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ced8, 0x1b6e3435, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ced8, 0x1b6e3435, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ceda, 0x1b6e3435, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ceda, 0x1b6e3435, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ceda, 0x1b6e3435, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192cedb, 0x1b6e3435, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ceda, 0x1b6e3435, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ceda, 0x1b6e3435, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ceda, 0x1b6e3435, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ceda, 0x1b6e3435, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192cedb, 0x1b6e3435, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0xb192ceda, 0x1b6e3435, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1e8, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x1f0, 0x0, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x1f8, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x200, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x0, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x208, 0x4, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x210, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x7661df3c, 0xc33422ce, 0x1, 0x0
+  .word 0x218, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x7661df3c, 0xc33422ce, 0x1, 0x0
+  .word 0x220, 0x0, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x7661df3d, 0xc33422ce, 0x1, 0x0
+  .word 0x228, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x7661df3c, 0xc33422ce, 0x1, 0x0
+  .word 0x230, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x7661df3c, 0xc33422ce, 0x1, 0x0
+  .word 0x238, 0x0, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x7661df3c, 0xc33422ce, 0x1, 0x0
+  .word 0x238, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x7661df3c, 0xc33422ce, 0x1, 0x0
+  .word 0x238, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x7661df3d, 0xc33422ce, 0x1, 0x0
+  .word 0x238, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x7661df3c, 0xc33422ce, 0x1, 0x0
+  .word 0x238, 0x4, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x0, 0x7661df3c, 0xc33422ce, 0x1, 0x0
+  .word 0x180, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e74, 0xc05b9eed, 0x1, 0x0
+  .word 0x188, 0x3, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e73, 0xc05b9eed, 0x1, 0x0
+  .word 0x190, 0x0, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e74, 0xc05b9eed, 0x1, 0x0
+  .word 0x198, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e73, 0xc05b9eed, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e74, 0xc05b9eed, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e74, 0xc05b9eed, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e73, 0xc05b9eed, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e74, 0xc05b9eed, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e73, 0xc05b9eed, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e74, 0xc05b9eed, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e78, 0xc05b9eed, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e78, 0xc05b9eed, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e79, 0xc05b9eed, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e78, 0xc05b9eed, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e79, 0xc05b9eed, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e78, 0xc05b9eed, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e78, 0xc05b9eed, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e79, 0xc05b9eed, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e78, 0xc05b9eed, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0xb3096e79, 0xc05b9eed, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x8fe5e50a, 0xbd914354, 0x1, 0x0
+  .word 0x1e8, 0x3, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x8fe5e509, 0xbd914354, 0x1, 0x0
+  .word 0x1f0, 0x0, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x8fe5e50a, 0xbd914354, 0x1, 0x0
+  .word 0x1f8, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x8fe5e509, 0xbd914354, 0x1, 0x0
+  .word 0x200, 0x1, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x8fe5e50a, 0xbd914354, 0x1, 0x0
+  .word 0x208, 0x0, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x8fe5e50a, 0xbd914354, 0x1, 0x0
+  .word 0x208, 0x1, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x8fe5e509, 0xbd914354, 0x1, 0x0
+  .word 0x208, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x8fe5e50a, 0xbd914354, 0x1, 0x0
+  .word 0x208, 0x3, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x8fe5e509, 0xbd914354, 0x1, 0x0
+  .word 0x208, 0x4, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x8fe5e50a, 0xbd914354, 0x1, 0x0
+  .word 0x210, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x28d4585e, 0xc32618be, 0x1, 0x0
+  .word 0x218, 0x3, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x28d4585e, 0xc32618be, 0x1, 0x0
+  .word 0x220, 0x0, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x28d4585f, 0xc32618be, 0x1, 0x0
+  .word 0x228, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x28d4585e, 0xc32618be, 0x1, 0x0
+  .word 0x230, 0x1, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x28d4585e, 0xc32618be, 0x1, 0x0
+  .word 0x238, 0x0, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x28d4585e, 0xc32618be, 0x1, 0x0
+  .word 0x238, 0x1, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x28d4585e, 0xc32618be, 0x1, 0x0
+  .word 0x238, 0x2, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x28d4585f, 0xc32618be, 0x1, 0x0
+  .word 0x238, 0x3, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x28d4585e, 0xc32618be, 0x1, 0x0
+  .word 0x238, 0x4, 0xb3096e76, 0xc05b9eed, 0x0, 0x3d240000, 0x0, 0x0, 0x28d4585e, 0xc32618be, 0x1, 0x0
+  .word 0x180, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43ceff4, 0x2d0e75f9, 0x1, 0x0
+  .word 0x188, 0x3, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43ceff4, 0x2d0e75f9, 0x1, 0x0
+  .word 0x190, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43ceff4, 0x2d0e75f9, 0x1, 0x0
+  .word 0x198, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43ceff5, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43ceff5, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43ceff4, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43ceff4, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43ceff4, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43ceff5, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43ceff5, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43cefee, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43cefed, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43cefed, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43cefee, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43cefee, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43cefee, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43cefed, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43cefed, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43cefee, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0xa43cefee, 0x2d0e75f9, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x6fb551f3, 0x16faa73a, 0x1, 0x0
+  .word 0x1e8, 0x3, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x6fb551f2, 0x16faa73a, 0x1, 0x0
+  .word 0x1f0, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x6fb551f2, 0x16faa73a, 0x1, 0x0
+  .word 0x1f8, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x6fb551f3, 0x16faa73a, 0x1, 0x0
+  .word 0x200, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x6fb551f3, 0x16faa73a, 0x1, 0x0
+  .word 0x208, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x6fb551f3, 0x16faa73a, 0x1, 0x0
+  .word 0x208, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x6fb551f2, 0x16faa73a, 0x1, 0x0
+  .word 0x208, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x6fb551f2, 0x16faa73a, 0x1, 0x0
+  .word 0x208, 0x3, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x6fb551f3, 0x16faa73a, 0x1, 0x0
+  .word 0x208, 0x4, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x6fb551f3, 0x16faa73a, 0x1, 0x0
+  .word 0x210, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x5dd9adae, 0x432167fc, 0x1, 0x0
+  .word 0x218, 0x3, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x5dd9adae, 0x432167fc, 0x1, 0x0
+  .word 0x220, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x5dd9adae, 0x432167fc, 0x1, 0x0
+  .word 0x228, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x5dd9adaf, 0x432167fc, 0x1, 0x0
+  .word 0x230, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x5dd9adae, 0x432167fc, 0x1, 0x0
+  .word 0x238, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x5dd9adae, 0x432167fc, 0x1, 0x0
+  .word 0x238, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x5dd9adae, 0x432167fc, 0x1, 0x0
+  .word 0x238, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x5dd9adae, 0x432167fc, 0x1, 0x0
+  .word 0x238, 0x3, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x5dd9adaf, 0x432167fc, 0x1, 0x0
+  .word 0x238, 0x4, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x0, 0x5dd9adae, 0x432167fc, 0x1, 0x0
+  .word 0x180, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183352, 0x3ee1dc74, 0x1, 0x0
+  .word 0x188, 0x3, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183352, 0x3ee1dc74, 0x1, 0x0
+  .word 0x190, 0x0, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183352, 0x3ee1dc74, 0x1, 0x0
+  .word 0x198, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183352, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183352, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183352, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183354, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183354, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183354, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183354, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183354, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183354, 0x3ee1dc74, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xba81dc74, 0x0, 0x0
+  .word 0x1e8, 0x3, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xba81dc74, 0x0, 0x0
+  .word 0x1f0, 0x0, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xba81dc74, 0x0, 0x0
+  .word 0x1f8, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xba81dc74, 0x0, 0x0
+  .word 0x200, 0x1, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xba81dc74, 0x0, 0x0
+  .word 0x208, 0x0, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xba81dc74, 0x0, 0x0
+  .word 0x208, 0x1, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xba81dc74, 0x0, 0x0
+  .word 0x208, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xba81dc74, 0x0, 0x0
+  .word 0x208, 0x3, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xba81dc74, 0x0, 0x0
+  .word 0x208, 0x4, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xba81dc74, 0x0, 0x0
+  .word 0x210, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xc341dc74, 0x0, 0x0
+  .word 0x218, 0x3, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xc341dc74, 0x0, 0x0
+  .word 0x220, 0x0, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xc341dc74, 0x0, 0x0
+  .word 0x228, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xc341dc74, 0x0, 0x0
+  .word 0x230, 0x1, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xc341dc74, 0x0, 0x0
+  .word 0x238, 0x0, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xc341dc74, 0x0, 0x0
+  .word 0x238, 0x1, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xc341dc74, 0x0, 0x0
+  .word 0x238, 0x2, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xc341dc74, 0x0, 0x0
+  .word 0x238, 0x3, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xc341dc74, 0x0, 0x0
+  .word 0x238, 0x4, 0x55183353, 0x3ee1dc74, 0x0, 0xbb900000, 0x0, 0x0, 0x55183353, 0xc341dc74, 0x0, 0x0
+  .word 0x180, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d3fb, 0x3eeb9efa, 0x1, 0x0
+  .word 0x188, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d3fb, 0x3eeb9efa, 0x1, 0x0
+  .word 0x190, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d3fb, 0x3eeb9efa, 0x1, 0x0
+  .word 0x198, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d3fc, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d3fb, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d3fb, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d3fb, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d3fb, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d3fc, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d3fb, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d401, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d400, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d400, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d401, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d401, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d401, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d400, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d400, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d401, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xd4b2d401, 0x3eeb9efa, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xc4efc480, 0xbab1435c, 0x1, 0x0
+  .word 0x1e8, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xc4efc47f, 0xbab1435c, 0x1, 0x0
+  .word 0x1f0, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xc4efc480, 0xbab1435c, 0x1, 0x0
+  .word 0x1f8, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xc4efc47f, 0xbab1435c, 0x1, 0x0
+  .word 0x200, 0x1, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xc4efc480, 0xbab1435c, 0x1, 0x0
+  .word 0x208, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xc4efc480, 0xbab1435c, 0x1, 0x0
+  .word 0x208, 0x1, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xc4efc47f, 0xbab1435c, 0x1, 0x0
+  .word 0x208, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xc4efc480, 0xbab1435c, 0x1, 0x0
+  .word 0x208, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xc4efc47f, 0xbab1435c, 0x1, 0x0
+  .word 0x208, 0x4, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xc4efc480, 0xbab1435c, 0x1, 0x0
+  .word 0x210, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xaa28a997, 0xc32618c8, 0x1, 0x0
+  .word 0x218, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xaa28a996, 0xc32618c8, 0x1, 0x0
+  .word 0x220, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xaa28a997, 0xc32618c8, 0x1, 0x0
+  .word 0x228, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xaa28a996, 0xc32618c8, 0x1, 0x0
+  .word 0x230, 0x1, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xaa28a997, 0xc32618c8, 0x1, 0x0
+  .word 0x238, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xaa28a997, 0xc32618c8, 0x1, 0x0
+  .word 0x238, 0x1, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xaa28a996, 0xc32618c8, 0x1, 0x0
+  .word 0x238, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xaa28a997, 0xc32618c8, 0x1, 0x0
+  .word 0x238, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xaa28a996, 0xc32618c8, 0x1, 0x0
+  .word 0x238, 0x4, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x0, 0xaa28a997, 0xc32618c8, 0x1, 0x0
+  .word 0x180, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb630, 0x3f371f40, 0x1, 0x0
+  .word 0x188, 0x3, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3f371f40, 0x1, 0x0
+  .word 0x190, 0x0, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3f371f40, 0x1, 0x0
+  .word 0x198, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb630, 0x3f371f40, 0x1, 0x0
+  .word 0x1a0, 0x1, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb630, 0x3f371f40, 0x1, 0x0
+  .word 0x1a8, 0x0, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb630, 0x3f371f40, 0x1, 0x0
+  .word 0x1a8, 0x1, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3f371f40, 0x1, 0x0
+  .word 0x1a8, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3f371f40, 0x1, 0x0
+  .word 0x1a8, 0x3, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb630, 0x3f371f40, 0x1, 0x0
+  .word 0x1a8, 0x4, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb630, 0x3f371f40, 0x1, 0x0
+  .word 0x1b0, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62e, 0x3f371f40, 0x1, 0x0
+  .word 0x1b8, 0x3, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62e, 0x3f371f40, 0x1, 0x0
+  .word 0x1c0, 0x0, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62e, 0x3f371f40, 0x1, 0x0
+  .word 0x1c8, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3f371f40, 0x1, 0x0
+  .word 0x1d0, 0x1, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3f371f40, 0x1, 0x0
+  .word 0x1d8, 0x0, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62e, 0x3f371f40, 0x1, 0x0
+  .word 0x1d8, 0x1, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62e, 0x3f371f40, 0x1, 0x0
+  .word 0x1d8, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62e, 0x3f371f40, 0x1, 0x0
+  .word 0x1d8, 0x3, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3f371f40, 0x1, 0x0
+  .word 0x1d8, 0x4, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3f371f40, 0x1, 0x0
+  .word 0x1e0, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3b271f40, 0x0, 0x0
+  .word 0x1e8, 0x3, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3b271f40, 0x0, 0x0
+  .word 0x1f0, 0x0, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3b271f40, 0x0, 0x0
+  .word 0x1f8, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3b271f40, 0x0, 0x0
+  .word 0x200, 0x1, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3b271f40, 0x0, 0x0
+  .word 0x208, 0x0, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3b271f40, 0x0, 0x0
+  .word 0x208, 0x1, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3b271f40, 0x0, 0x0
+  .word 0x208, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3b271f40, 0x0, 0x0
+  .word 0x208, 0x3, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3b271f40, 0x0, 0x0
+  .word 0x208, 0x4, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x3b271f40, 0x0, 0x0
+  .word 0x210, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x43471f40, 0x0, 0x0
+  .word 0x218, 0x3, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x43471f40, 0x0, 0x0
+  .word 0x220, 0x0, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x43471f40, 0x0, 0x0
+  .word 0x228, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x43471f40, 0x0, 0x0
+  .word 0x230, 0x1, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x43471f40, 0x0, 0x0
+  .word 0x238, 0x0, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x43471f40, 0x0, 0x0
+  .word 0x238, 0x1, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x43471f40, 0x0, 0x0
+  .word 0x238, 0x2, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x43471f40, 0x0, 0x0
+  .word 0x238, 0x3, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x43471f40, 0x0, 0x0
+  .word 0x238, 0x4, 0xcc8eb62f, 0x3f371f40, 0x0, 0x3be00000, 0x0, 0x0, 0xcc8eb62f, 0x43471f40, 0x0, 0x0
+  .word 0x180, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x188, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x190, 0x0, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x198, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x1a0, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x1a8, 0x0, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x1a8, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x1a8, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x1a8, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x1a8, 0x4, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x1b0, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x1b8, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x1c0, 0x0, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x1c8, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x1d0, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x0, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x4, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x1e0, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1e8, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f0, 0x0, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f8, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x200, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x0, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x208, 0x4, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x210, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x5c5e55e6, 0x40079918, 0x1, 0x0
+  .word 0x218, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x5c5e55e6, 0x40079918, 0x1, 0x0
+  .word 0x220, 0x0, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x5c5e55e6, 0x40079918, 0x1, 0x0
+  .word 0x228, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x5c5e55e7, 0x40079918, 0x1, 0x0
+  .word 0x230, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x5c5e55e6, 0x40079918, 0x1, 0x0
+  .word 0x238, 0x0, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x5c5e55e6, 0x40079918, 0x1, 0x0
+  .word 0x238, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x5c5e55e6, 0x40079918, 0x1, 0x0
+  .word 0x238, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x5c5e55e6, 0x40079918, 0x1, 0x0
+  .word 0x238, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x5c5e55e7, 0x40079918, 0x1, 0x0
+  .word 0x238, 0x4, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x0, 0x5c5e55e6, 0x40079918, 0x1, 0x0
+  .word 0x180, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x73000000, 0x0, 0x0, 0x0
+  .word 0x188, 0x3, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x73000000, 0x0, 0x0, 0x0
+  .word 0x190, 0x0, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x73000000, 0x0, 0x0, 0x0
+  .word 0x198, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x73000000, 0x0, 0x0, 0x0
+  .word 0x1a0, 0x1, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x73000000, 0x0, 0x0, 0x0
+  .word 0x1a8, 0x0, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x73000000, 0x0, 0x0, 0x0
+  .word 0x1a8, 0x1, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x73000000, 0x0, 0x0, 0x0
+  .word 0x1a8, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x73000000, 0x0, 0x0, 0x0
+  .word 0x1a8, 0x3, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x73000000, 0x0, 0x0, 0x0
+  .word 0x1a8, 0x4, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x73000000, 0x0, 0x0, 0x0
+  .word 0x1b0, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1b8, 0x3, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1c0, 0x0, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1c8, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d0, 0x1, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x0, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x1, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x3, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x4, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1e0, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1e8, 0x3, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f0, 0x0, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f8, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x200, 0x1, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x0, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x1, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x3, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x208, 0x4, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x210, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x636adfb0, 0x3ff3ba68, 0x1, 0x0
+  .word 0x218, 0x3, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x636adfb0, 0x3ff3ba68, 0x1, 0x0
+  .word 0x220, 0x0, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x636adfb0, 0x3ff3ba68, 0x1, 0x0
+  .word 0x228, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x636adfb1, 0x3ff3ba68, 0x1, 0x0
+  .word 0x230, 0x1, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x636adfb0, 0x3ff3ba68, 0x1, 0x0
+  .word 0x238, 0x0, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x636adfb0, 0x3ff3ba68, 0x1, 0x0
+  .word 0x238, 0x1, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x636adfb0, 0x3ff3ba68, 0x1, 0x0
+  .word 0x238, 0x2, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x636adfb0, 0x3ff3ba68, 0x1, 0x0
+  .word 0x238, 0x3, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x636adfb1, 0x3ff3ba68, 0x1, 0x0
+  .word 0x238, 0x4, 0x3f800000, 0x0, 0x33800000, 0x0, 0x0, 0x0, 0x636adfb0, 0x3ff3ba68, 0x1, 0x0
+  .word 0x180, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x188, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x190, 0x0, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x198, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x1a0, 0x1, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x1a8, 0x0, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x1a8, 0x1, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x1a8, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x1a8, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x1a8, 0x4, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x1b0, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1b8, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1c0, 0x0, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1c8, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d0, 0x1, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x0, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x1, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1d8, 0x4, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x1e0, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1e8, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f0, 0x0, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x1f8, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x200, 0x1, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x0, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x1, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x208, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x208, 0x4, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x210, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc9ce1565, 0x3ff111d3, 0x1, 0x0
+  .word 0x218, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc9ce1564, 0x3ff111d3, 0x1, 0x0
+  .word 0x220, 0x0, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc9ce1564, 0x3ff111d3, 0x1, 0x0
+  .word 0x228, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc9ce1565, 0x3ff111d3, 0x1, 0x0
+  .word 0x230, 0x1, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc9ce1565, 0x3ff111d3, 0x1, 0x0
+  .word 0x238, 0x0, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc9ce1565, 0x3ff111d3, 0x1, 0x0
+  .word 0x238, 0x1, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc9ce1564, 0x3ff111d3, 0x1, 0x0
+  .word 0x238, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc9ce1564, 0x3ff111d3, 0x1, 0x0
+  .word 0x238, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc9ce1565, 0x3ff111d3, 0x1, 0x0
+  .word 0x238, 0x4, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x0, 0xc9ce1565, 0x3ff111d3, 0x1, 0x0
+  .word 0x180, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0x6d4b9adb, 0x1, 0x0
+  .word 0x188, 0x3, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0x6d4b9adb, 0x1, 0x0
+  .word 0x190, 0x0, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0x6d4b9adb, 0x1, 0x0
+  .word 0x198, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5f, 0x6d4b9adb, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0x6d4b9adb, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0x6d4b9adb, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0x6d4b9adb, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0x6d4b9adb, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5f, 0x6d4b9adb, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0x6d4b9adb, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0xed4b9adb, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5d, 0xed4b9adb, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0xed4b9adb, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5d, 0xed4b9adb, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0xed4b9adb, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0xed4b9adb, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5d, 0xed4b9adb, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0xed4b9adb, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5d, 0xed4b9adb, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xebcd1f5e, 0xed4b9adb, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xf0d9d786, 0x6d54b424, 0x1, 0x0
+  .word 0x1e8, 0x3, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xf0d9d786, 0x6d54b424, 0x1, 0x0
+  .word 0x1f0, 0x0, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xf0d9d786, 0x6d54b424, 0x1, 0x0
+  .word 0x1f8, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xf0d9d787, 0x6d54b424, 0x1, 0x0
+  .word 0x200, 0x1, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xf0d9d787, 0x6d54b424, 0x1, 0x0
+  .word 0x208, 0x0, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xf0d9d786, 0x6d54b424, 0x1, 0x0
+  .word 0x208, 0x1, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xf0d9d786, 0x6d54b424, 0x1, 0x0
+  .word 0x208, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xf0d9d786, 0x6d54b424, 0x1, 0x0
+  .word 0x208, 0x3, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xf0d9d787, 0x6d54b424, 0x1, 0x0
+  .word 0x208, 0x4, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0xf0d9d787, 0x6d54b424, 0x1, 0x0
+  .word 0x210, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0x88014280, 0x129bd235, 0x1, 0x0
+  .word 0x218, 0x3, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0x88014280, 0x129bd235, 0x1, 0x0
+  .word 0x220, 0x0, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0x88014280, 0x129bd235, 0x1, 0x0
+  .word 0x228, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0x88014281, 0x129bd235, 0x1, 0x0
+  .word 0x230, 0x1, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0x88014280, 0x129bd235, 0x1, 0x0
+  .word 0x238, 0x0, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0x88014280, 0x129bd235, 0x1, 0x0
+  .word 0x238, 0x1, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0x88014280, 0x129bd235, 0x1, 0x0
+  .word 0x238, 0x2, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0x88014280, 0x129bd235, 0x1, 0x0
+  .word 0x238, 0x3, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0x88014281, 0x129bd235, 0x1, 0x0
+  .word 0x238, 0x4, 0x0, 0x3ff80000, 0xebcd1f5e, 0x6d4b9adb, 0x0, 0x0, 0x88014280, 0x129bd235, 0x1, 0x0
+  .word 0x180, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x188, 0x3, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x190, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x198, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x40000000, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+  .word 0x1e8, 0x3, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+  .word 0x1f0, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+  .word 0x1f8, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+  .word 0x200, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+  .word 0x208, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+  .word 0x208, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+  .word 0x208, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+  .word 0x208, 0x3, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+  .word 0x208, 0x4, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+  .word 0x210, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x218, 0x3, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x220, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x228, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x230, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x238, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x238, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x238, 0x2, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0
+  .word 0x238, 0x3, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x238, 0x4, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x180, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x188, 0x3, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x190, 0x0, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x198, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x40000000, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0
+  .word 0x1e8, 0x3, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0
+  .word 0x1f0, 0x0, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0
+  .word 0x1f8, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0
+  .word 0x200, 0x1, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0
+  .word 0x208, 0x0, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0
+  .word 0x208, 0x1, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0
+  .word 0x208, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0
+  .word 0x208, 0x3, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0
+  .word 0x208, 0x4, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0
+  .word 0x210, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x218, 0x3, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x220, 0x0, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x228, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x230, 0x1, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x238, 0x0, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x238, 0x1, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x238, 0x2, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0
+  .word 0x238, 0x3, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x238, 0x4, 0x3, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x180, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x188, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x190, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x198, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x40000000, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0
+  .word 0x1e8, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0
+  .word 0x1f0, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0
+  .word 0x1f8, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0
+  .word 0x200, 0x1, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0
+  .word 0x208, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0
+  .word 0x208, 0x1, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0
+  .word 0x208, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0
+  .word 0x208, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0
+  .word 0x208, 0x4, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0
+  .word 0x210, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x218, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x220, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x228, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x3, 0x0, 0x3, 0x0
+  .word 0x230, 0x1, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x3, 0x0, 0x3, 0x0
+  .word 0x238, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x238, 0x1, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x238, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0
+  .word 0x238, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x3, 0x0, 0x3, 0x0
+  .word 0x238, 0x4, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x0, 0x3, 0x0, 0x3, 0x0
+  .word 0x180, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x188, 0x3, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x190, 0x0, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x198, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0xc0000000, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x1e8, 0x3, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x1f0, 0x0, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x1f8, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x200, 0x1, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x0, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x1, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x3, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x4, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x210, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x218, 0x3, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x220, 0x0, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x228, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x230, 0x1, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x238, 0x0, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x238, 0x1, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x238, 0x2, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x238, 0x3, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x238, 0x4, 0x1, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x180, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x188, 0x3, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x190, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x198, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a0, 0x1, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x1, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x1a8, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x1a8, 0x3, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1a8, 0x4, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x1b0, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1b8, 0x3, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1c0, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0xc0000000, 0x1, 0x0
+  .word 0x1c8, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d0, 0x1, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x1, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x1, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x3, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1d8, 0x4, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x1e0, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x1e8, 0x3, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x1f0, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x1f8, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x200, 0x1, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x1, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x3, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x4, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x210, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x3, 0x0
+  .word 0x218, 0x3, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x3, 0x0
+  .word 0x220, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x3, 0x80000000, 0x3, 0x0
+  .word 0x228, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x3, 0x0
+  .word 0x230, 0x1, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x3, 0x80000000, 0x3, 0x0
+  .word 0x238, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x3, 0x0
+  .word 0x238, 0x1, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x3, 0x0
+  .word 0x238, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x3, 0x80000000, 0x3, 0x0
+  .word 0x238, 0x3, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x2, 0x80000000, 0x3, 0x0
+  .word 0x238, 0x4, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x0, 0x3, 0x80000000, 0x3, 0x0
+  .word 0x180, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x188, 0x3, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x190, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x198, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a0, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a8, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a8, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a8, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a8, 0x3, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a8, 0x4, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1b0, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1b8, 0x3, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1c0, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1c8, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d0, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d8, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d8, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d8, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d8, 0x3, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d8, 0x4, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1e0, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x1e8, 0x3, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x1f0, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x1f8, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x200, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x208, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x208, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x208, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x208, 0x3, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x208, 0x4, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x210, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x218, 0x3, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x220, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x228, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x230, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x238, 0x0, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x238, 0x1, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x238, 0x2, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x238, 0x3, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x238, 0x4, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+  .word 0x180, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x188, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x190, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x198, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a0, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a8, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a8, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a8, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a8, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1a8, 0x4, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x1b0, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1b8, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1c0, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1c8, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d0, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d8, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d8, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d8, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d8, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1d8, 0x4, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x1e0, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x1e8, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x1f0, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x1f8, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x200, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x208, 0x4, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x210, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x218, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x220, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x228, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x230, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x238, 0x0, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x238, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x238, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x238, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x238, 0x4, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x240, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a3890, 0x77cf01e7, 0x1, 0x0
+  .word 0x248, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a388f, 0x77cf01e7, 0x1, 0x0
+  .word 0x250, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a388f, 0x77cf01e7, 0x1, 0x0
+  .word 0x258, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a388b, 0x77cf01e7, 0x1, 0x0
+  .word 0x260, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a388a, 0x77cf01e7, 0x1, 0x0
+  .word 0x268, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a388a, 0x77cf01e7, 0x1, 0x0
+  .word 0x270, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a388b, 0xf7cf01e7, 0x1, 0x0
+  .word 0x278, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a388b, 0xf7cf01e7, 0x1, 0x0
+  .word 0x280, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a388a, 0xf7cf01e7, 0x1, 0x0
+  .word 0x288, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a3890, 0xf7cf01e7, 0x1, 0x0
+  .word 0x290, 0x0, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a3890, 0xf7cf01e7, 0x1, 0x0
+  .word 0x298, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x3ff00000, 0x0, 0x74940000, 0x7f7a388f, 0xf7cf01e7, 0x1, 0x0
+  .word 0x240, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x2a0, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x2a0, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x258, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x2a8, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0x0, 0x7ff00000, 0x5, 0x0
+  .word 0x2a8, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0xffffffff, 0x7fefffff, 0x5, 0x0
+  .word 0x270, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x2b0, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0xffffffff, 0xffefffff, 0x5, 0x0
+  .word 0x2b0, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0xffffffff, 0xffefffff, 0x5, 0x0
+  .word 0x288, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0x0, 0xfff00000, 0x5, 0x0
+  .word 0x2b8, 0x3, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0xffffffff, 0xffefffff, 0x5, 0x0
+  .word 0x2b8, 0x1, 0x7f7a388d, 0x77cf01e7, 0x0, 0x74940000, 0x0, 0x80000000, 0xffffffff, 0xffefffff, 0x5, 0x0
+  .word 0x250, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba14914, 0x401b76bf, 0x1, 0x0
+  .word 0x2c0, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba14915, 0x401b76bf, 0x1, 0x0
+  .word 0x2a0, 0x4, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba14915, 0x401b76bf, 0x1, 0x0
+  .word 0x268, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba1490f, 0x401b76bf, 0x1, 0x0
+  .word 0x2c8, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba14910, 0x401b76bf, 0x1, 0x0
+  .word 0x2a8, 0x4, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba14910, 0x401b76bf, 0x1, 0x0
+  .word 0x280, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba1490f, 0xc01b76bf, 0x1, 0x0
+  .word 0x2d0, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba1490f, 0xc01b76bf, 0x1, 0x0
+  .word 0x2b0, 0x4, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba14910, 0xc01b76bf, 0x1, 0x0
+  .word 0x298, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba14914, 0xc01b76bf, 0x1, 0x0
+  .word 0x2d8, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba14914, 0xc01b76bf, 0x1, 0x0
+  .word 0x2b8, 0x4, 0x7ba14912, 0x401b76bf, 0x0, 0x3ff00000, 0x0, 0x3ce40000, 0x7ba14915, 0xc01b76bf, 0x1, 0x0
+  .word 0x250, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x248, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x2e0, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x268, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x260, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x2e8, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdab, 0x3d112a37, 0x1, 0x0
+  .word 0x280, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdab, 0xbd112a37, 0x1, 0x0
+  .word 0x278, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdac, 0xbd112a37, 0x1, 0x0
+  .word 0x2f0, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdab, 0xbd112a37, 0x1, 0x0
+  .word 0x298, 0x3, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdab, 0xbd112a37, 0x1, 0x0
+  .word 0x290, 0x0, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdac, 0xbd112a37, 0x1, 0x0
+  .word 0x2f8, 0x2, 0x7ba14912, 0x401b76bf, 0x0, 0x3ce40000, 0x0, 0x80000000, 0xad44cdab, 0xbd112a37, 0x1, 0x0
+  .word 0x2a0, 0x1, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2a, 0x60e4e8d, 0x1, 0x0
+  .word 0x2a0, 0x4, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2a, 0x60e4e8d, 0x1, 0x0
+  .word 0x2e0, 0x2, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2a, 0x60e4e8d, 0x1, 0x0
+  .word 0x2a8, 0x1, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2b, 0x60e4e8d, 0x1, 0x0
+  .word 0x2a8, 0x4, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2c, 0x60e4e8d, 0x1, 0x0
+  .word 0x2e8, 0x2, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2c, 0x60e4e8d, 0x1, 0x0
+  .word 0x2b0, 0x1, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2b, 0x860e4e8d, 0x1, 0x0
+  .word 0x2b0, 0x4, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2c, 0x860e4e8d, 0x1, 0x0
+  .word 0x2f0, 0x2, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2c, 0x860e4e8d, 0x1, 0x0
+  .word 0x2b8, 0x1, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2a, 0x860e4e8d, 0x1, 0x0
+  .word 0x2b8, 0x4, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2a, 0x860e4e8d, 0x1, 0x0
+  .word 0x2f8, 0x2, 0x6354cf2b, 0x60e4e8d, 0x0, 0x3ff00000, 0x1, 0x82b00000, 0x6354cf2a, 0x860e4e8d, 0x1, 0x0
+  .word 0x2e0, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a0, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a0, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2e8, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a8, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a8, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2f0, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b0, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b0, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2f8, 0x2, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b8, 0x1, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b8, 0x0, 0x6354cf2b, 0x60e4e8d, 0x1, 0x82b00000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2a0, 0x1, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc483, 0x40d0c3c8, 0x1, 0x0
+  .word 0x248, 0x0, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc483, 0x40d0c3c8, 0x1, 0x0
+  .word 0x2a0, 0x3, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc484, 0x40d0c3c8, 0x1, 0x0
+  .word 0x2a8, 0x1, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc482, 0x40d0c3c8, 0x1, 0x0
+  .word 0x260, 0x0, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc482, 0x40d0c3c8, 0x1, 0x0
+  .word 0x2a8, 0x3, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc483, 0x40d0c3c8, 0x1, 0x0
+  .word 0x2b0, 0x1, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc482, 0xc0d0c3c8, 0x1, 0x0
+  .word 0x278, 0x0, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc483, 0xc0d0c3c8, 0x1, 0x0
+  .word 0x2b0, 0x3, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc482, 0xc0d0c3c8, 0x1, 0x0
+  .word 0x2b8, 0x1, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc483, 0xc0d0c3c8, 0x1, 0x0
+  .word 0x290, 0x0, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc484, 0xc0d0c3c8, 0x1, 0x0
+  .word 0x2b8, 0x3, 0xc4bc483, 0x40d0c3c8, 0x0, 0x3ff00000, 0x1, 0x3d800000, 0xc4bc483, 0xc0d0c3c8, 0x1, 0x0
+  .word 0x2e0, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x240, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x2a0, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x2e8, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x258, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x2a8, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0x3e60c3c8, 0x1, 0x0
+  .word 0x2f0, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0xbe60c3c8, 0x1, 0x0
+  .word 0x270, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0xbe60c3c8, 0x1, 0x0
+  .word 0x2b0, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0xbe60c3c8, 0x1, 0x0
+  .word 0x2f8, 0x2, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0xbe60c3c8, 0x1, 0x0
+  .word 0x288, 0x1, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0xbe60c3c8, 0x1, 0x0
+  .word 0x2b8, 0x0, 0xc4bc483, 0x40d0c3c8, 0x1, 0x3d800000, 0x0, 0x80000000, 0xc4bc484, 0xbe60c3c8, 0x1, 0x0
+  .word 0x2e0, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f6, 0x3e5b0052, 0x1, 0x0
+  .word 0x240, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f6, 0x3e5b0052, 0x1, 0x0
+  .word 0x2a0, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f5, 0x3e5b0052, 0x1, 0x0
+  .word 0x2e8, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f2, 0x3e5b0052, 0x1, 0x0
+  .word 0x258, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f3, 0x3e5b0052, 0x1, 0x0
+  .word 0x2a8, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f2, 0x3e5b0052, 0x1, 0x0
+  .word 0x2f0, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f2, 0xbe5b0052, 0x1, 0x0
+  .word 0x270, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f3, 0xbe5b0052, 0x1, 0x0
+  .word 0x2b0, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f3, 0xbe5b0052, 0x1, 0x0
+  .word 0x2f8, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f6, 0xbe5b0052, 0x1, 0x0
+  .word 0x288, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f6, 0xbe5b0052, 0x1, 0x0
+  .word 0x2b8, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3ff00000, 0x0, 0x3b180000, 0xf67ca4f6, 0xbe5b0052, 0x1, 0x0
+  .word 0x2a0, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x240, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x2a0, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x2a8, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x258, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x2a8, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0x3984403e, 0x0, 0x0
+  .word 0x2b0, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0xb984403e, 0x0, 0x0
+  .word 0x270, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0xb984403e, 0x0, 0x0
+  .word 0x2b0, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0xb984403e, 0x0, 0x0
+  .word 0x2b8, 0x2, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0xb984403e, 0x0, 0x0
+  .word 0x288, 0x1, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0xb984403e, 0x0, 0x0
+  .word 0x2b8, 0x3, 0xf67ca4f4, 0x3e5b0052, 0x0, 0x3b180000, 0x0, 0x80000000, 0x38dd7bb7, 0xb984403e, 0x0, 0x0
+  .word 0x2a0, 0x4, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158291, 0x37d958f2, 0x1, 0x0
+  .word 0x2c0, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158291, 0x37d958f2, 0x1, 0x0
+  .word 0x250, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158290, 0x37d958f2, 0x1, 0x0
+  .word 0x2a8, 0x4, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158298, 0x37d958f2, 0x1, 0x0
+  .word 0x2c8, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158298, 0x37d958f2, 0x1, 0x0
+  .word 0x268, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158297, 0x37d958f2, 0x1, 0x0
+  .word 0x2b0, 0x4, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158298, 0xb7d958f2, 0x1, 0x0
+  .word 0x2d0, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158297, 0xb7d958f2, 0x1, 0x0
+  .word 0x280, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158297, 0xb7d958f2, 0x1, 0x0
+  .word 0x2b8, 0x4, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158291, 0xb7d958f2, 0x1, 0x0
+  .word 0x2d8, 0x2, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158290, 0xb7d958f2, 0x1, 0x0
+  .word 0x298, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0x3ff00000, 0x0, 0xb4ac0000, 0xfa158290, 0xb7d958f2, 0x1, 0x0
+  .word 0x250, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d241, 0xac962dd4, 0x1, 0x0
+  .word 0x248, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d242, 0xac962dd4, 0x1, 0x0
+  .word 0x240, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d242, 0xac962dd4, 0x1, 0x0
+  .word 0x268, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d241, 0xac962dd4, 0x1, 0x0
+  .word 0x260, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d242, 0xac962dd4, 0x1, 0x0
+  .word 0x258, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d242, 0xac962dd4, 0x1, 0x0
+  .word 0x280, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d241, 0x2c962dd4, 0x1, 0x0
+  .word 0x278, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d241, 0x2c962dd4, 0x1, 0x0
+  .word 0x270, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d242, 0x2c962dd4, 0x1, 0x0
+  .word 0x298, 0x3, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d241, 0x2c962dd4, 0x1, 0x0
+  .word 0x290, 0x0, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d241, 0x2c962dd4, 0x1, 0x0
+  .word 0x288, 0x1, 0xfa158294, 0x37d958f2, 0x0, 0xb4ac0000, 0x0, 0x80000000, 0x9ad2d242, 0x2c962dd4, 0x1, 0x0
+  .word 0x250, 0x3, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433eb, 0xbfbedda7, 0x1, 0x0
+  .word 0x2c0, 0x2, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433eb, 0xbfbedda7, 0x1, 0x0
+  .word 0x240, 0x1, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433eb, 0xbfbedda7, 0x1, 0x0
+  .word 0x268, 0x3, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433ee, 0xbfbedda7, 0x1, 0x0
+  .word 0x2c8, 0x2, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433ee, 0xbfbedda7, 0x1, 0x0
+  .word 0x258, 0x1, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433ef, 0xbfbedda7, 0x1, 0x0
+  .word 0x280, 0x3, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433ee, 0x3fbedda7, 0x1, 0x0
+  .word 0x2d0, 0x2, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433ef, 0x3fbedda7, 0x1, 0x0
+  .word 0x270, 0x1, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433ef, 0x3fbedda7, 0x1, 0x0
+  .word 0x298, 0x3, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433eb, 0x3fbedda7, 0x1, 0x0
+  .word 0x2d8, 0x2, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433ec, 0x3fbedda7, 0x1, 0x0
+  .word 0x288, 0x1, 0x1fc433ed, 0xbfbedda7, 0x0, 0x3ff00000, 0x1, 0x3c780000, 0x1fc433eb, 0x3fbedda7, 0x1, 0x0
+  .word 0x2a0, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f3, 0xbc47263d, 0x1, 0x0
+  .word 0x240, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f3, 0xbc47263d, 0x1, 0x0
+  .word 0x2a0, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f2, 0xbc47263d, 0x1, 0x0
+  .word 0x2a8, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f3, 0xbc47263d, 0x1, 0x0
+  .word 0x258, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f3, 0xbc47263d, 0x1, 0x0
+  .word 0x2a8, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f2, 0xbc47263d, 0x1, 0x0
+  .word 0x2b0, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f2, 0x3c47263d, 0x1, 0x0
+  .word 0x270, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f3, 0x3c47263d, 0x1, 0x0
+  .word 0x2b0, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f3, 0x3c47263d, 0x1, 0x0
+  .word 0x2b8, 0x2, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f2, 0x3c47263d, 0x1, 0x0
+  .word 0x288, 0x1, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f3, 0x3c47263d, 0x1, 0x0
+  .word 0x2b8, 0x3, 0x1fc433ed, 0xbfbedda7, 0x1, 0x3c780000, 0x0, 0x80000000, 0x57d326f3, 0x3c47263d, 0x1, 0x0
+  .word 0x2c0, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb99, 0x85b30312, 0x1, 0x0
+  .word 0x250, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb99, 0x85b30312, 0x1, 0x0
+  .word 0x240, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb9a, 0x85b30312, 0x1, 0x0
+  .word 0x2c8, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb9c, 0x85b30312, 0x1, 0x0
+  .word 0x268, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb9c, 0x85b30312, 0x1, 0x0
+  .word 0x258, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb9d, 0x85b30312, 0x1, 0x0
+  .word 0x2d0, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb9d, 0x5b30312, 0x1, 0x0
+  .word 0x280, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb9c, 0x5b30312, 0x1, 0x0
+  .word 0x270, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb9d, 0x5b30312, 0x1, 0x0
+  .word 0x2d8, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb9a, 0x5b30312, 0x1, 0x0
+  .word 0x298, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb99, 0x5b30312, 0x1, 0x0
+  .word 0x288, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x3ff00000, 0x0, 0x2780000, 0xd99acb9a, 0x5b30312, 0x1, 0x0
+  .word 0x2e0, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x240, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x250, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2e8, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x258, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x268, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2f0, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x270, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x280, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2f8, 0x2, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x288, 0x1, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x298, 0x3, 0xd99acb9b, 0x85b30312, 0x0, 0x2780000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x240, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72b9, 0x3f49e8fc, 0x1, 0x0
+  .word 0x248, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72b8, 0x3f49e8fc, 0x1, 0x0
+  .word 0x2a0, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72b8, 0x3f49e8fc, 0x1, 0x0
+  .word 0x258, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72be, 0x3f49e8fc, 0x1, 0x0
+  .word 0x260, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72bd, 0x3f49e8fc, 0x1, 0x0
+  .word 0x2a8, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72bd, 0x3f49e8fc, 0x1, 0x0
+  .word 0x270, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72be, 0xbf49e8fc, 0x1, 0x0
+  .word 0x278, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72be, 0xbf49e8fc, 0x1, 0x0
+  .word 0x2b0, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72be, 0xbf49e8fc, 0x1, 0x0
+  .word 0x288, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72b9, 0xbf49e8fc, 0x1, 0x0
+  .word 0x290, 0x0, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72b9, 0xbf49e8fc, 0x1, 0x0
+  .word 0x2b8, 0x2, 0xa94f72bb, 0x3f49e8fc, 0x0, 0x3ff00000, 0x0, 0xbc140000, 0xa94f72b9, 0xbf49e8fc, 0x1, 0x0
+  .word 0x240, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b5, 0xbb70319d, 0x1, 0x0
+  .word 0x2a0, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b4, 0xbb70319d, 0x1, 0x0
+  .word 0x250, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b4, 0xbb70319d, 0x1, 0x0
+  .word 0x258, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b5, 0xbb70319d, 0x1, 0x0
+  .word 0x2a8, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b4, 0xbb70319d, 0x1, 0x0
+  .word 0x268, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b4, 0xbb70319d, 0x1, 0x0
+  .word 0x270, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b5, 0x3b70319d, 0x1, 0x0
+  .word 0x2b0, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b4, 0x3b70319d, 0x1, 0x0
+  .word 0x280, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b4, 0x3b70319d, 0x1, 0x0
+  .word 0x288, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b5, 0x3b70319d, 0x1, 0x0
+  .word 0x2b8, 0x1, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b4, 0x3b70319d, 0x1, 0x0
+  .word 0x298, 0x3, 0xa94f72bb, 0x3f49e8fc, 0x0, 0xbc140000, 0x0, 0x80000000, 0xe9d1a7b4, 0x3b70319d, 0x1, 0x0
+  .word 0x250, 0x3, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x2a0, 0x0, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x2a0, 0x2, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x268, 0x3, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c8528, 0x4163523e, 0x1, 0x0
+  .word 0x2a8, 0x0, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c8529, 0x4163523e, 0x1, 0x0
+  .word 0x2a8, 0x2, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c8528, 0x4163523e, 0x1, 0x0
+  .word 0x280, 0x3, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c8528, 0xc163523e, 0x1, 0x0
+  .word 0x2b0, 0x0, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c8529, 0xc163523e, 0x1, 0x0
+  .word 0x2b0, 0x2, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c8529, 0xc163523e, 0x1, 0x0
+  .word 0x298, 0x3, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c8529, 0xc163523e, 0x1, 0x0
+  .word 0x2b8, 0x0, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c8529, 0xc163523e, 0x1, 0x0
+  .word 0x2b8, 0x2, 0x1e2c8529, 0x4163523e, 0x0, 0x3ff00000, 0xffffffff, 0x3e0fffff, 0x1e2c852a, 0xc163523e, 0x1, 0x0
+  .word 0x2c0, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8529, 0x3f83523e, 0x1, 0x0
+  .word 0x250, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x248, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x2c8, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8529, 0x3f83523e, 0x1, 0x0
+  .word 0x268, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x260, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8528, 0x3f83523e, 0x1, 0x0
+  .word 0x2d0, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8528, 0xbf83523e, 0x1, 0x0
+  .word 0x280, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8528, 0xbf83523e, 0x1, 0x0
+  .word 0x278, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8529, 0xbf83523e, 0x1, 0x0
+  .word 0x2d8, 0x2, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8528, 0xbf83523e, 0x1, 0x0
+  .word 0x298, 0x3, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8528, 0xbf83523e, 0x1, 0x0
+  .word 0x290, 0x0, 0x1e2c8529, 0x4163523e, 0xffffffff, 0x3e0fffff, 0x0, 0x80000000, 0x1e2c8529, 0xbf83523e, 0x1, 0x0
+  .word 0x2a0, 0x2, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec1, 0x3ff952eb, 0x1, 0x0
+  .word 0x240, 0x1, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec1, 0x3ff952eb, 0x1, 0x0
+  .word 0x2a0, 0x0, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec1, 0x3ff952eb, 0x1, 0x0
+  .word 0x2a8, 0x2, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec2, 0x3ff952eb, 0x1, 0x0
+  .word 0x258, 0x1, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec3, 0x3ff952eb, 0x1, 0x0
+  .word 0x2a8, 0x0, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec3, 0x3ff952eb, 0x1, 0x0
+  .word 0x2b0, 0x2, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec3, 0xbff952eb, 0x1, 0x0
+  .word 0x270, 0x1, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec3, 0xbff952eb, 0x1, 0x0
+  .word 0x2b0, 0x0, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec3, 0xbff952eb, 0x1, 0x0
+  .word 0x2b8, 0x2, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec2, 0xbff952eb, 0x1, 0x0
+  .word 0x288, 0x1, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec1, 0xbff952eb, 0x1, 0x0
+  .word 0x2b8, 0x0, 0xaf15eec2, 0x3ff952eb, 0x0, 0x3ff00000, 0x1, 0xbca00000, 0xaf15eec1, 0xbff952eb, 0x1, 0x0
+  .word 0x250, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec3, 0xbca952eb, 0x1, 0x0
+  .word 0x240, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec4, 0xbca952eb, 0x1, 0x0
+  .word 0x2a0, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec3, 0xbca952eb, 0x1, 0x0
+  .word 0x268, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec3, 0xbca952eb, 0x1, 0x0
+  .word 0x258, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec4, 0xbca952eb, 0x1, 0x0
+  .word 0x2a8, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec3, 0xbca952eb, 0x1, 0x0
+  .word 0x280, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec3, 0x3ca952eb, 0x1, 0x0
+  .word 0x270, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec4, 0x3ca952eb, 0x1, 0x0
+  .word 0x2b0, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec3, 0x3ca952eb, 0x1, 0x0
+  .word 0x298, 0x3, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec3, 0x3ca952eb, 0x1, 0x0
+  .word 0x288, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec4, 0x3ca952eb, 0x1, 0x0
+  .word 0x2b8, 0x1, 0xaf15eec2, 0x3ff952eb, 0x1, 0xbca00000, 0x0, 0x80000000, 0xaf15eec3, 0x3ca952eb, 0x1, 0x0
+  .word 0x2c0, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x2a0, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621b, 0x7dac18b, 0x1, 0x0
+  .word 0x2a0, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621b, 0x7dac18b, 0x1, 0x0
+  .word 0x2c8, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621d, 0x7dac18b, 0x1, 0x0
+  .word 0x2a8, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x2a8, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621c, 0x7dac18b, 0x1, 0x0
+  .word 0x2d0, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621c, 0x87dac18b, 0x1, 0x0
+  .word 0x2b0, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621d, 0x87dac18b, 0x1, 0x0
+  .word 0x2b0, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621c, 0x87dac18b, 0x1, 0x0
+  .word 0x2d8, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621b, 0x87dac18b, 0x1, 0x0
+  .word 0x2b8, 0x2, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621c, 0x87dac18b, 0x1, 0x0
+  .word 0x2b8, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x3ff00000, 0x0, 0x84800000, 0x217b621b, 0x87dac18b, 0x1, 0x0
+  .word 0x2a0, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x240, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a0, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a8, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x258, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a8, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2b0, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x270, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b0, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b8, 0x0, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x288, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b8, 0x1, 0x217b621c, 0x7dac18b, 0x0, 0x84800000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2e0, 0x2, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x3178687d, 0x9cb43524, 0x1, 0x0
+  .word 0x2a0, 0x0, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x3178687d, 0x9cb43524, 0x1, 0x0
+  .word 0x2a0, 0x2, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x3178687e, 0x9cb43524, 0x1, 0x0
+  .word 0x2e8, 0x2, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x31786879, 0x9cb43524, 0x1, 0x0
+  .word 0x2a8, 0x0, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x31786879, 0x9cb43524, 0x1, 0x0
+  .word 0x2a8, 0x2, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x31786879, 0x9cb43524, 0x1, 0x0
+  .word 0x2f0, 0x2, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x31786879, 0x1cb43524, 0x1, 0x0
+  .word 0x2b0, 0x0, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x31786879, 0x1cb43524, 0x1, 0x0
+  .word 0x2b0, 0x2, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x31786878, 0x1cb43524, 0x1, 0x0
+  .word 0x2f8, 0x2, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x3178687d, 0x1cb43524, 0x1, 0x0
+  .word 0x2b8, 0x0, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x3178687d, 0x1cb43524, 0x1, 0x0
+  .word 0x2b8, 0x2, 0x3178687b, 0x9cb43524, 0x0, 0x3ff00000, 0xffffffff, 0x9983ffff, 0x3178687d, 0x1cb43524, 0x1, 0x0
+  .word 0x248, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2a0, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2e0, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x260, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2a8, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2e8, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x278, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x2b0, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2f0, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x290, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x2b8, 0x0, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2f8, 0x2, 0x3178687b, 0x9cb43524, 0xffffffff, 0x9983ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a0, 0x2, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe353666a, 0xcea6bcd3, 0x1, 0x0
+  .word 0x2a0, 0x4, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x2a0, 0x3, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x2a8, 0x2, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x2a8, 0x4, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe3536669, 0xcea6bcd3, 0x1, 0x0
+  .word 0x2a8, 0x3, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe3536668, 0xcea6bcd3, 0x1, 0x0
+  .word 0x2b0, 0x2, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe3536668, 0x4ea6bcd3, 0x1, 0x0
+  .word 0x2b0, 0x4, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe3536669, 0x4ea6bcd3, 0x1, 0x0
+  .word 0x2b0, 0x3, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe3536669, 0x4ea6bcd3, 0x1, 0x0
+  .word 0x2b8, 0x2, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe3536669, 0x4ea6bcd3, 0x1, 0x0
+  .word 0x2b8, 0x4, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe3536669, 0x4ea6bcd3, 0x1, 0x0
+  .word 0x2b8, 0x3, 0xe3536669, 0xcea6bcd3, 0x0, 0x3ff00000, 0xffffffff, 0xcb4fffff, 0xe353666a, 0x4ea6bcd3, 0x1, 0x0
+  .word 0x2a0, 0x4, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x2a0, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x2a0, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536669, 0x5a06bcd3, 0x1, 0x0
+  .word 0x2a8, 0x4, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x2a8, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536668, 0x5a06bcd3, 0x1, 0x0
+  .word 0x2a8, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536669, 0x5a06bcd3, 0x1, 0x0
+  .word 0x2b0, 0x4, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536668, 0xda06bcd3, 0x1, 0x0
+  .word 0x2b0, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536669, 0xda06bcd3, 0x1, 0x0
+  .word 0x2b0, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536668, 0xda06bcd3, 0x1, 0x0
+  .word 0x2b8, 0x4, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536668, 0xda06bcd3, 0x1, 0x0
+  .word 0x2b8, 0x2, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536669, 0xda06bcd3, 0x1, 0x0
+  .word 0x2b8, 0x3, 0xe3536669, 0xcea6bcd3, 0xffffffff, 0xcb4fffff, 0x0, 0x80000000, 0xe3536668, 0xda06bcd3, 0x1, 0x0
+  .word 0x2a0, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad47, 0x1f0adcf6, 0x1, 0x0
+  .word 0x2a0, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad48, 0x1f0adcf6, 0x1, 0x0
+  .word 0x2a0, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad48, 0x1f0adcf6, 0x1, 0x0
+  .word 0x2a8, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad4a, 0x1f0adcf6, 0x1, 0x0
+  .word 0x2a8, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad4a, 0x1f0adcf6, 0x1, 0x0
+  .word 0x2a8, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad4b, 0x1f0adcf6, 0x1, 0x0
+  .word 0x2b0, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad4b, 0x9f0adcf6, 0x1, 0x0
+  .word 0x2b0, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad4a, 0x9f0adcf6, 0x1, 0x0
+  .word 0x2b0, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad4a, 0x9f0adcf6, 0x1, 0x0
+  .word 0x2b8, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad48, 0x9f0adcf6, 0x1, 0x0
+  .word 0x2b8, 0x0, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad48, 0x9f0adcf6, 0x1, 0x0
+  .word 0x2b8, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x3ff00000, 0x0, 0x9bc80000, 0x6e12ad47, 0x9f0adcf6, 0x1, 0x0
+  .word 0x240, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2e0, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x250, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x258, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2e8, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x268, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x270, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2f0, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x280, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x288, 0x1, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2f8, 0x2, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x298, 0x3, 0x6e12ad49, 0x1f0adcf6, 0x0, 0x9bc80000, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2a0, 0x4, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b2, 0x11538beb, 0x1, 0x0
+  .word 0x2a0, 0x0, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b2, 0x11538beb, 0x1, 0x0
+  .word 0x2e0, 0x2, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b2, 0x11538beb, 0x1, 0x0
+  .word 0x2a8, 0x4, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b4, 0x11538beb, 0x1, 0x0
+  .word 0x2a8, 0x0, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b4, 0x11538beb, 0x1, 0x0
+  .word 0x2e8, 0x2, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b4, 0x11538beb, 0x1, 0x0
+  .word 0x2b0, 0x4, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b4, 0x91538beb, 0x1, 0x0
+  .word 0x2b0, 0x0, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b4, 0x91538beb, 0x1, 0x0
+  .word 0x2f0, 0x2, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b4, 0x91538beb, 0x1, 0x0
+  .word 0x2b8, 0x4, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b2, 0x91538beb, 0x1, 0x0
+  .word 0x2b8, 0x0, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b2, 0x91538beb, 0x1, 0x0
+  .word 0x2f8, 0x2, 0xdf1e78b3, 0x11538beb, 0x0, 0x3ff00000, 0xffffffff, 0x8e17ffff, 0xdf1e78b2, 0x91538beb, 0x1, 0x0
+  .word 0x250, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a0, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x2a0, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x268, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a8, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x2a8, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x280, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b0, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b0, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x298, 0x3, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b8, 0x2, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b8, 0x0, 0xdf1e78b3, 0x11538beb, 0xffffffff, 0x8e17ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x248, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb9850c, 0xc033b679, 0x1, 0x0
+  .word 0x2a0, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb9850b, 0xc033b679, 0x1, 0x0
+  .word 0x2a0, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb9850c, 0xc033b679, 0x1, 0x0
+  .word 0x260, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb98513, 0xc033b679, 0x1, 0x0
+  .word 0x2a8, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb98512, 0xc033b679, 0x1, 0x0
+  .word 0x2a8, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb98513, 0xc033b679, 0x1, 0x0
+  .word 0x278, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb98512, 0x4033b679, 0x1, 0x0
+  .word 0x2b0, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb98513, 0x4033b679, 0x1, 0x0
+  .word 0x2b0, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb98512, 0x4033b679, 0x1, 0x0
+  .word 0x290, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb9850b, 0x4033b679, 0x1, 0x0
+  .word 0x2b8, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb9850c, 0x4033b679, 0x1, 0x0
+  .word 0x2b8, 0x2, 0xabb9850f, 0xc033b679, 0x0, 0x3ff00000, 0x0, 0x3d0c0000, 0xabb9850b, 0x4033b679, 0x1, 0x0
+  .word 0x248, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546e, 0xbd513faa, 0x1, 0x0
+  .word 0x2a0, 0x4, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x2a0, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x260, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546e, 0xbd513faa, 0x1, 0x0
+  .word 0x2a8, 0x4, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x2a8, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546d, 0xbd513faa, 0x1, 0x0
+  .word 0x278, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546d, 0x3d513faa, 0x1, 0x0
+  .word 0x2b0, 0x4, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546d, 0x3d513faa, 0x1, 0x0
+  .word 0x2b0, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546e, 0x3d513faa, 0x1, 0x0
+  .word 0x290, 0x0, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546d, 0x3d513faa, 0x1, 0x0
+  .word 0x2b8, 0x4, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546d, 0x3d513faa, 0x1, 0x0
+  .word 0x2b8, 0x3, 0xabb9850f, 0xc033b679, 0x0, 0x3d0c0000, 0x0, 0x80000000, 0x7642546e, 0x3d513faa, 0x1, 0x0
+  .word 0x2a0, 0x4, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ced8, 0x1b6e3435, 0x1, 0x0
+  .word 0x250, 0x3, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ced7, 0x1b6e3435, 0x1, 0x0
+  .word 0x2e0, 0x2, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ced8, 0x1b6e3435, 0x1, 0x0
+  .word 0x2a8, 0x4, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ceda, 0x1b6e3435, 0x1, 0x0
+  .word 0x268, 0x3, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ceda, 0x1b6e3435, 0x1, 0x0
+  .word 0x2e8, 0x2, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ceda, 0x1b6e3435, 0x1, 0x0
+  .word 0x2b0, 0x4, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ceda, 0x9b6e3435, 0x1, 0x0
+  .word 0x280, 0x3, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ceda, 0x9b6e3435, 0x1, 0x0
+  .word 0x2f0, 0x2, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ceda, 0x9b6e3435, 0x1, 0x0
+  .word 0x2b8, 0x4, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ced8, 0x9b6e3435, 0x1, 0x0
+  .word 0x298, 0x3, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ced7, 0x9b6e3435, 0x1, 0x0
+  .word 0x2f8, 0x2, 0xb192ced9, 0x1b6e3435, 0x0, 0x3ff00000, 0xffffffff, 0x9827ffff, 0xb192ced8, 0x9b6e3435, 0x1, 0x0
+  .word 0x2a0, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x240, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a0, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a8, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x258, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2a8, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2b0, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x270, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b0, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x1, 0x0, 0x3, 0x0
+  .word 0x2b8, 0x2, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x288, 0x1, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2b8, 0x3, 0xb192ced9, 0x1b6e3435, 0xffffffff, 0x9827ffff, 0x0, 0x80000000, 0x1, 0x0, 0x3, 0x0
+  .word 0x240, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43ceff5, 0x2d0e75f9, 0x1, 0x0
+  .word 0x2a0, 0x4, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43ceff5, 0x2d0e75f9, 0x1, 0x0
+  .word 0x248, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43ceff4, 0x2d0e75f9, 0x1, 0x0
+  .word 0x258, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43cefee, 0x2d0e75f9, 0x1, 0x0
+  .word 0x2a8, 0x4, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43cefee, 0x2d0e75f9, 0x1, 0x0
+  .word 0x260, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43cefed, 0x2d0e75f9, 0x1, 0x0
+  .word 0x270, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43cefee, 0xad0e75f9, 0x1, 0x0
+  .word 0x2b0, 0x4, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43cefee, 0xad0e75f9, 0x1, 0x0
+  .word 0x278, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43cefee, 0xad0e75f9, 0x1, 0x0
+  .word 0x288, 0x1, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43ceff5, 0xad0e75f9, 0x1, 0x0
+  .word 0x2b8, 0x4, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43ceff5, 0xad0e75f9, 0x1, 0x0
+  .word 0x290, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x3ff00000, 0x0, 0x29dc0000, 0xa43ceff5, 0xad0e75f9, 0x1, 0x0
+  .word 0x248, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f2, 0x16faa73a, 0x1, 0x0
+  .word 0x2c0, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f3, 0x16faa73a, 0x1, 0x0
+  .word 0x2a0, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f2, 0x16faa73a, 0x1, 0x0
+  .word 0x260, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f2, 0x16faa73a, 0x1, 0x0
+  .word 0x2c8, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f3, 0x16faa73a, 0x1, 0x0
+  .word 0x2a8, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f2, 0x16faa73a, 0x1, 0x0
+  .word 0x278, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f3, 0x96faa73a, 0x1, 0x0
+  .word 0x2d0, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f2, 0x96faa73a, 0x1, 0x0
+  .word 0x2b0, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f3, 0x96faa73a, 0x1, 0x0
+  .word 0x290, 0x0, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f3, 0x96faa73a, 0x1, 0x0
+  .word 0x2d8, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f2, 0x96faa73a, 0x1, 0x0
+  .word 0x2b8, 0x2, 0xa43ceff1, 0x2d0e75f9, 0x0, 0x29dc0000, 0x0, 0x80000000, 0x6fb551f3, 0x96faa73a, 0x1, 0x0
+  .word 0x2a0, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d3fb, 0x3eeb9efa, 0x1, 0x0
+  .word 0x2a0, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d3fc, 0x3eeb9efa, 0x1, 0x0
+  .word 0x248, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d3fb, 0x3eeb9efa, 0x1, 0x0
+  .word 0x2a8, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d401, 0x3eeb9efa, 0x1, 0x0
+  .word 0x2a8, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d401, 0x3eeb9efa, 0x1, 0x0
+  .word 0x260, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d400, 0x3eeb9efa, 0x1, 0x0
+  .word 0x2b0, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d401, 0xbeeb9efa, 0x1, 0x0
+  .word 0x2b0, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d400, 0xbeeb9efa, 0x1, 0x0
+  .word 0x278, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d401, 0xbeeb9efa, 0x1, 0x0
+  .word 0x2b8, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d3fb, 0xbeeb9efa, 0x1, 0x0
+  .word 0x2b8, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d3fb, 0xbeeb9efa, 0x1, 0x0
+  .word 0x290, 0x0, 0xd4b2d3fe, 0x3eeb9efa, 0x0, 0x3ff00000, 0x1, 0xbbb40000, 0xd4b2d3fc, 0xbeeb9efa, 0x1, 0x0
+  .word 0x2a0, 0x4, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc480, 0xbab1435c, 0x1, 0x0
+  .word 0x250, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc47f, 0xbab1435c, 0x1, 0x0
+  .word 0x2a0, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc480, 0xbab1435c, 0x1, 0x0
+  .word 0x2a8, 0x4, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc480, 0xbab1435c, 0x1, 0x0
+  .word 0x268, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc47f, 0xbab1435c, 0x1, 0x0
+  .word 0x2a8, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc480, 0xbab1435c, 0x1, 0x0
+  .word 0x2b0, 0x4, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc480, 0x3ab1435c, 0x1, 0x0
+  .word 0x280, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc47f, 0x3ab1435c, 0x1, 0x0
+  .word 0x2b0, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc47f, 0x3ab1435c, 0x1, 0x0
+  .word 0x2b8, 0x4, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc480, 0x3ab1435c, 0x1, 0x0
+  .word 0x298, 0x3, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc47f, 0x3ab1435c, 0x1, 0x0
+  .word 0x2b8, 0x2, 0xd4b2d3fe, 0x3eeb9efa, 0x1, 0xbbb40000, 0x0, 0x80000000, 0xc4efc47f, 0x3ab1435c, 0x1, 0x0
+  .word 0x2a0, 0x1, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x2a0, 0x4, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x2c0, 0x2, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x63e0e8d, 0x1, 0x0, 0x0
+  .word 0x2a8, 0x1, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x2a8, 0x4, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x2c8, 0x2, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x81740205, 0x0, 0x0, 0x0
+  .word 0x2b0, 0x1, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x81740205, 0x80000000, 0x0, 0x0
+  .word 0x2b0, 0x4, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x81740205, 0x80000000, 0x0, 0x0
+  .word 0x2d0, 0x2, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x81740205, 0x80000000, 0x0, 0x0
+  .word 0x2b8, 0x1, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x63e0e8d, 0x80000001, 0x0, 0x0
+  .word 0x2b8, 0x4, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x63e0e8d, 0x80000001, 0x0, 0x0
+  .word 0x2d8, 0x2, 0xc3d90849, 0x0, 0x0, 0x3ff00000, 0x42650644, 0x0, 0x63e0e8d, 0x80000001, 0x0, 0x0
+  .word 0x2a0, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2e0, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2a0, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x1, 0x0, 0x3, 0x0
+  .word 0x2a8, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2e8, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2a8, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x1, 0x0, 0x3, 0x0
+  .word 0x2b0, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2f0, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2b0, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2b8, 0x1, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2f8, 0x2, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2b8, 0x3, 0xc3d90849, 0x0, 0x42650644, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x240, 0x1, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x2a0, 0x1, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x2a0, 0x0, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0x73000000, 0x1, 0x0, 0x0
+  .word 0x258, 0x1, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x2a8, 0x1, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x2a8, 0x0, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0xc000000, 0x0, 0x0, 0x0
+  .word 0x270, 0x1, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0xc000000, 0x80000000, 0x0, 0x0
+  .word 0x2b0, 0x1, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0xc000000, 0x80000000, 0x0, 0x0
+  .word 0x2b0, 0x0, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0xc000000, 0x80000000, 0x0, 0x0
+  .word 0x288, 0x1, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0x73000000, 0x80000001, 0x0, 0x0
+  .word 0x2b8, 0x1, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0x73000000, 0x80000001, 0x0, 0x0
+  .word 0x2b8, 0x0, 0xbf800000, 0x0, 0x0, 0x3ff00000, 0xb3800000, 0x0, 0x73000000, 0x80000001, 0x0, 0x0
+  .word 0x2e0, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x250, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2a0, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2e8, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x268, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2a8, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x0, 0x0, 0x3, 0x0
+  .word 0x2f0, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x280, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2b0, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x2f8, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x298, 0x3, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x0, 0x80000000, 0x3, 0x0
+  .word 0x2b8, 0x2, 0xbf800000, 0x0, 0xb3800000, 0x0, 0x0, 0x80000000, 0x1, 0x80000000, 0x3, 0x0
+  .word 0x248, 0x0, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x250, 0x3, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x2a0, 0x2, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x260, 0x0, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x268, 0x3, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x2a8, 0x2, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x278, 0x0, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x280, 0x3, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x2b0, 0x2, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x290, 0x0, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x1, 0xc0000000, 0x1, 0x0
+  .word 0x298, 0x3, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x2b8, 0x2, 0x1, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x1, 0xc0000000, 0x1, 0x0
+  .word 0x240, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x0, 0x0, 0x0
+  .word 0x2a0, 0x4, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x0, 0x0, 0x0
+  .word 0x2a0, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x0, 0x0, 0x0
+  .word 0x258, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x0, 0x0, 0x0
+  .word 0x2a8, 0x4, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x0, 0x0, 0x0
+  .word 0x2a8, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x0, 0x0, 0x0
+  .word 0x270, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x2b0, 0x4, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x2b0, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x288, 0x1, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x2b8, 0x4, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x2b8, 0x0, 0x1, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0x2, 0x80000000, 0x0, 0x0
+  .word 0x2c0, 0x2, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x1, 0x40000000, 0x1, 0x0
+  .word 0x2e0, 0x2, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x2a0, 0x3, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x1, 0x40000000, 0x1, 0x0
+  .word 0x2c8, 0x2, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x2e8, 0x2, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x2a8, 0x3, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0xffffffff, 0xbfffffff, 0x1, 0x0
+  .word 0x2d0, 0x2, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x2f0, 0x2, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x2b0, 0x3, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x2d8, 0x2, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x2f8, 0x2, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x2b8, 0x3, 0x5, 0x0, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x2c0, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x2a0, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x250, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x2c8, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x2a8, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x268, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x2d0, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x2b0, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x280, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x2d8, 0x2, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x2b8, 0x0, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x298, 0x3, 0x5, 0x0, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x2e0, 0x2, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x2a0, 0x2, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0xffffffff, 0x3fffffff, 0x1, 0x0
+  .word 0x2a0, 0x0, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x2e8, 0x2, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x2a8, 0x2, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x1, 0xc0000000, 0x1, 0x0
+  .word 0x2a8, 0x0, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x2f0, 0x2, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x2b0, 0x2, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x2b0, 0x0, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0x40000000, 0x1, 0x0
+  .word 0x2f8, 0x2, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x2b8, 0x2, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x2b8, 0x0, 0x5, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x40000000, 0x0, 0xc0000000, 0x1, 0x0
+  .word 0x248, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x2e0, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x2c0, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x260, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x2e8, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x2c8, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x80000000, 0x0, 0x0
+  .word 0x278, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x2f0, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x2d0, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x290, 0x0, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x2f8, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x2d8, 0x2, 0x5, 0x80000000, 0x0, 0x40000000, 0x0, 0x80000000, 0xa, 0x0, 0x0, 0x0
+  .word 0x2a0, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x2a0, 0x4, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x2a0, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x2a8, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x2a8, 0x4, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x2a8, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x2b0, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x2b0, 0x4, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x2b0, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0x0
+  .word 0x2b8, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x2b8, 0x4, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x2b8, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x3ff00000, 0x0, 0xbff00000, 0x0, 0x0
+  .word 0x2e0, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x250, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x240, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x80000000, 0x0, 0x0
+  .word 0x2e8, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0
+  .word 0x268, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0
+  .word 0x258, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0
+  .word 0x2f0, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0
+  .word 0x280, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0
+  .word 0x270, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0
+  .word 0x2f8, 0x2, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0
+  .word 0x298, 0x3, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0
+  .word 0x288, 0x1, 0x0, 0x80000000, 0x0, 0x3ff00000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0
+  .word 0x300, 0x2, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x1000001, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800001, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x1000003, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b800002, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb800000, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb800000, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb800001, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb800000, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb800001, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb800000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb800000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb800001, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb800000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb800001, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7f0000, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7effff, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7effff, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7f0000, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7f0000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7f0000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7effff, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7effff, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7f0000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0xfeffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7f0000, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3000000, 0xffffffff, 0x0, 0x0
+  .word 0x308, 0x3, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3000000, 0xffffffff, 0x0, 0x0
+  .word 0x310, 0x0, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3000000, 0xffffffff, 0x0, 0x0
+  .word 0x318, 0x2, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3000000, 0xffffffff, 0x0, 0x0
+  .word 0x320, 0x1, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3000000, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x0, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3000000, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x1, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3000000, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x2, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3000000, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x3, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3000000, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x4, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3000000, 0xffffffff, 0x0, 0x0
+  .word 0x330, 0x2, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f800000, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f800000, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f800000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f800000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f800000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0xffffff80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f800000, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3c00000, 0xffffffff, 0x0, 0x0
+  .word 0x308, 0x3, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3c00000, 0xffffffff, 0x0, 0x0
+  .word 0x310, 0x0, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3c00000, 0xffffffff, 0x0, 0x0
+  .word 0x318, 0x2, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3c00000, 0xffffffff, 0x0, 0x0
+  .word 0x320, 0x1, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3c00000, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x0, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3c00000, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x1, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3c00000, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x2, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3c00000, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x3, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3c00000, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x4, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3c00000, 0xffffffff, 0x0, 0x0
+  .word 0x330, 0x2, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7ffffe, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7ffffe, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7ffffe, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7ffffe, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7ffffe, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7ffffe, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0xfffffe80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effffff, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effffff, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effffff, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effffff, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effffff, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effffff, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effffff, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effffff, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x7fffffc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf000000, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceffffff, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf000000, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceffffff, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf000000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf000000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceffffff, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf000000, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceffffff, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf000000, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000001, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000001, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x80000040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f000000, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcae, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x7ade5740, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ef5bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617c9, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617c9, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617c9, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617c9, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617c9, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617c9, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617c9, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617c9, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x2185f26, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c0617ca, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x176b3c70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4dbb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d91, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d91, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d91, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d91, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d91, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d91, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d90, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d91, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x2de36420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e378d91, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce8857df, 0xffffffff, 0x0, 0x0
+  .word 0x308, 0x3, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce8857df, 0xffffffff, 0x0, 0x0
+  .word 0x310, 0x0, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce8857df, 0xffffffff, 0x0, 0x0
+  .word 0x318, 0x2, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce8857df, 0xffffffff, 0x0, 0x0
+  .word 0x320, 0x1, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce8857df, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x0, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce8857df, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x1, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce8857df, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x2, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce8857df, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x3, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce8857df, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x4, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce8857df, 0xffffffff, 0x0, 0x0
+  .word 0x330, 0x2, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f3bd410, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f3bd410, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f3bd410, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f3bd411, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f3bd411, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f3bd410, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f3bd410, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f3bd410, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f3bd411, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0xbbd41080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f3bd411, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x133bfcf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d99dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x3f22fd20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e7c8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84173, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84173, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84173, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84173, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84173, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84173, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84173, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84173, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x6420b9c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec84174, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x61d897c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec3b130, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceefbfa5, 0xffffffff, 0x0, 0x0
+  .word 0x308, 0x3, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceefbfa5, 0xffffffff, 0x0, 0x0
+  .word 0x310, 0x0, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceefbfa5, 0xffffffff, 0x0, 0x0
+  .word 0x318, 0x2, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceefbfa5, 0xffffffff, 0x0, 0x0
+  .word 0x320, 0x1, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceefbfa5, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x0, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceefbfa5, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x1, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceefbfa5, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x2, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceefbfa5, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x3, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceefbfa5, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x4, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xceefbfa5, 0xffffffff, 0x0, 0x0
+  .word 0x330, 0x2, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f08202e, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f08202d, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f08202d, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f08202e, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f08202e, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f08202e, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f08202d, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f08202d, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f08202e, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x88202d80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f08202e, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725d, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725d, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725d, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725d, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725d, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725d, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725c, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725d, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x35dc9720, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e57725d, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x191a9a9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bc8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x3877f320, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e61dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1b, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1b, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1b, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1b, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1b, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1b, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1a, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1b, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x244386a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c110e1b, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x7fe166c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4effc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x273f7060, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e1cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x2b7e9960, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e2dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30d, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30d, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30d, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30d, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30d, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30d, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30d, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30d, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x1d9861b0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4decc30e, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x308, 0x3, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x310, 0x0, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x318, 0x2, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e847, 0xffffffff, 0x1, 0x0
+  .word 0x320, 0x1, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e847, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x0, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x1, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x2, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x3, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e847, 0xffffffff, 0x1, 0x0
+  .word 0x328, 0x4, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e847, 0xffffffff, 0x1, 0x0
+  .word 0x330, 0x2, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e847, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e847, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e846, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e847, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0x62f42340, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4ec5e847, 0xffffffff, 0x1, 0x0
+  .word 0x300, 0x2, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcea6f0e3, 0xffffffff, 0x0, 0x0
+  .word 0x308, 0x3, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcea6f0e3, 0xffffffff, 0x0, 0x0
+  .word 0x310, 0x0, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcea6f0e3, 0xffffffff, 0x0, 0x0
+  .word 0x318, 0x2, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcea6f0e3, 0xffffffff, 0x0, 0x0
+  .word 0x320, 0x1, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcea6f0e3, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x0, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcea6f0e3, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x1, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcea6f0e3, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x2, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcea6f0e3, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x3, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcea6f0e3, 0xffffffff, 0x0, 0x0
+  .word 0x328, 0x4, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcea6f0e3, 0xffffffff, 0x0, 0x0
+  .word 0x330, 0x2, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2c878e, 0xffffffff, 0x1, 0x0
+  .word 0x338, 0x3, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2c878e, 0xffffffff, 0x1, 0x0
+  .word 0x340, 0x0, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2c878e, 0xffffffff, 0x1, 0x0
+  .word 0x348, 0x2, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2c878f, 0xffffffff, 0x1, 0x0
+  .word 0x350, 0x1, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2c878f, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x0, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2c878e, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x1, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2c878e, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x2, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2c878e, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x3, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2c878f, 0xffffffff, 0x1, 0x0
+  .word 0x358, 0x4, 0xac878e80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f2c878f, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x10000000, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x10000000, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x10000000, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x10000000, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x10000000, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x10000000, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x10000000, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x10000000, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800000, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x10000000, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x10000000, 0x3ff00000, 0x0, 0x0, 0x0, 0x0, 0x3f800001, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x30000000, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800002, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x30000000, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800001, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x30000000, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800002, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x30000000, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800001, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x30000000, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800002, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x30000000, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800002, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x30000000, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800001, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x30000000, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800002, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x30000000, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800001, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x30000000, 0xbff00000, 0x0, 0x0, 0x0, 0x0, 0xbf800002, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x10000000, 0x38100000, 0x0, 0x0, 0x0, 0x0, 0x800000, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x10000000, 0x38100000, 0x0, 0x0, 0x0, 0x0, 0x800000, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x10000000, 0x38100000, 0x0, 0x0, 0x0, 0x0, 0x800000, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x10000000, 0x38100000, 0x0, 0x0, 0x0, 0x0, 0x800001, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x10000000, 0x38100000, 0x0, 0x0, 0x0, 0x0, 0x800001, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x10000000, 0x38100000, 0x0, 0x0, 0x0, 0x0, 0x800000, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x10000000, 0x38100000, 0x0, 0x0, 0x0, 0x0, 0x800000, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x10000000, 0x38100000, 0x0, 0x0, 0x0, 0x0, 0x800000, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x10000000, 0x38100000, 0x0, 0x0, 0x0, 0x0, 0x800001, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x10000000, 0x38100000, 0x0, 0x0, 0x0, 0x0, 0x800001, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0xff000000, 0x47efffff, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x368, 0x3, 0xff000000, 0x47efffff, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0xff000000, 0x47efffff, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0xff000000, 0x47efffff, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x380, 0x1, 0xff000000, 0x47efffff, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x388, 0x0, 0xff000000, 0x47efffff, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x388, 0x1, 0xff000000, 0x47efffff, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0xff000000, 0x47efffff, 0x0, 0x0, 0x0, 0x0, 0x7f7fffff, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0xff000000, 0x47efffff, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x388, 0x4, 0xff000000, 0x47efffff, 0x0, 0x0, 0x0, 0x0, 0x7f800000, 0xffffffff, 0x5, 0x0
+  .word 0x360, 0x2, 0xd0000000, 0x442eb795, 0x0, 0x0, 0x0, 0x0, 0x6175bcae, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0xd0000000, 0x442eb795, 0x0, 0x0, 0x0, 0x0, 0x6175bcae, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0xd0000000, 0x442eb795, 0x0, 0x0, 0x0, 0x0, 0x6175bcae, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0xd0000000, 0x442eb795, 0x0, 0x0, 0x0, 0x0, 0x6175bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0xd0000000, 0x442eb795, 0x0, 0x0, 0x0, 0x0, 0x6175bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0xd0000000, 0x442eb795, 0x0, 0x0, 0x0, 0x0, 0x6175bcae, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0xd0000000, 0x442eb795, 0x0, 0x0, 0x0, 0x0, 0x6175bcae, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0xd0000000, 0x442eb795, 0x0, 0x0, 0x0, 0x0, 0x6175bcae, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0xd0000000, 0x442eb795, 0x0, 0x0, 0x0, 0x0, 0x6175bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0xd0000000, 0x442eb795, 0x0, 0x0, 0x0, 0x0, 0x6175bcaf, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x30000000, 0x40e0c2f9, 0x0, 0x0, 0x0, 0x0, 0x470617ca, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x30000000, 0x40e0c2f9, 0x0, 0x0, 0x0, 0x0, 0x470617c9, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x30000000, 0x40e0c2f9, 0x0, 0x0, 0x0, 0x0, 0x470617c9, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x30000000, 0x40e0c2f9, 0x0, 0x0, 0x0, 0x0, 0x470617ca, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x30000000, 0x40e0c2f9, 0x0, 0x0, 0x0, 0x0, 0x470617ca, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x30000000, 0x40e0c2f9, 0x0, 0x0, 0x0, 0x0, 0x470617ca, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x30000000, 0x40e0c2f9, 0x0, 0x0, 0x0, 0x0, 0x470617c9, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x30000000, 0x40e0c2f9, 0x0, 0x0, 0x0, 0x0, 0x470617c9, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x30000000, 0x40e0c2f9, 0x0, 0x0, 0x0, 0x0, 0x470617ca, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x30000000, 0x40e0c2f9, 0x0, 0x0, 0x0, 0x0, 0x470617ca, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x70000000, 0x42d76b3c, 0x0, 0x0, 0x0, 0x0, 0x56bb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x70000000, 0x42d76b3c, 0x0, 0x0, 0x0, 0x0, 0x56bb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x70000000, 0x42d76b3c, 0x0, 0x0, 0x0, 0x0, 0x56bb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x70000000, 0x42d76b3c, 0x0, 0x0, 0x0, 0x0, 0x56bb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x70000000, 0x42d76b3c, 0x0, 0x0, 0x0, 0x0, 0x56bb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x70000000, 0x42d76b3c, 0x0, 0x0, 0x0, 0x0, 0x56bb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x70000000, 0x42d76b3c, 0x0, 0x0, 0x0, 0x0, 0x56bb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x70000000, 0x42d76b3c, 0x0, 0x0, 0x0, 0x0, 0x56bb59e3, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x70000000, 0x42d76b3c, 0x0, 0x0, 0x0, 0x0, 0x56bb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x70000000, 0x42d76b3c, 0x0, 0x0, 0x0, 0x0, 0x56bb59e4, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x10000000, 0x3f96f1b2, 0x0, 0x0, 0x0, 0x0, 0x3cb78d90, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x10000000, 0x3f96f1b2, 0x0, 0x0, 0x0, 0x0, 0x3cb78d90, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x10000000, 0x3f96f1b2, 0x0, 0x0, 0x0, 0x0, 0x3cb78d90, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x10000000, 0x3f96f1b2, 0x0, 0x0, 0x0, 0x0, 0x3cb78d91, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x10000000, 0x3f96f1b2, 0x0, 0x0, 0x0, 0x0, 0x3cb78d91, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x10000000, 0x3f96f1b2, 0x0, 0x0, 0x0, 0x0, 0x3cb78d90, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x10000000, 0x3f96f1b2, 0x0, 0x0, 0x0, 0x0, 0x3cb78d90, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x10000000, 0x3f96f1b2, 0x0, 0x0, 0x0, 0x0, 0x3cb78d90, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x10000000, 0x3f96f1b2, 0x0, 0x0, 0x0, 0x0, 0x3cb78d91, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x10000000, 0x3f96f1b2, 0x0, 0x0, 0x0, 0x0, 0x3cb78d91, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x10000000, 0x45177a82, 0x0, 0x0, 0x0, 0x0, 0x68bbd410, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x10000000, 0x45177a82, 0x0, 0x0, 0x0, 0x0, 0x68bbd410, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x10000000, 0x45177a82, 0x0, 0x0, 0x0, 0x0, 0x68bbd410, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x10000000, 0x45177a82, 0x0, 0x0, 0x0, 0x0, 0x68bbd411, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x10000000, 0x45177a82, 0x0, 0x0, 0x0, 0x0, 0x68bbd411, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x10000000, 0x45177a82, 0x0, 0x0, 0x0, 0x0, 0x68bbd410, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x10000000, 0x45177a82, 0x0, 0x0, 0x0, 0x0, 0x68bbd410, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x10000000, 0x45177a82, 0x0, 0x0, 0x0, 0x0, 0x68bbd410, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x10000000, 0x45177a82, 0x0, 0x0, 0x0, 0x0, 0x68bbd411, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x10000000, 0x45177a82, 0x0, 0x0, 0x0, 0x0, 0x68bbd411, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0xf0000000, 0x3e633bfc, 0x0, 0x0, 0x0, 0x0, 0x3319dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0xf0000000, 0x3e633bfc, 0x0, 0x0, 0x0, 0x0, 0x3319dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0xf0000000, 0x3e633bfc, 0x0, 0x0, 0x0, 0x0, 0x3319dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0xf0000000, 0x3e633bfc, 0x0, 0x0, 0x0, 0x0, 0x3319dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0xf0000000, 0x3e633bfc, 0x0, 0x0, 0x0, 0x0, 0x3319dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0xf0000000, 0x3e633bfc, 0x0, 0x0, 0x0, 0x0, 0x3319dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0xf0000000, 0x3e633bfc, 0x0, 0x0, 0x0, 0x0, 0x3319dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0xf0000000, 0x3e633bfc, 0x0, 0x0, 0x0, 0x0, 0x3319dfe7, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0xf0000000, 0x3e633bfc, 0x0, 0x0, 0x0, 0x0, 0x3319dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0xf0000000, 0x3e633bfc, 0x0, 0x0, 0x0, 0x0, 0x3319dfe8, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x90000000, 0x455f917e, 0x0, 0x0, 0x0, 0x0, 0x6afc8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x90000000, 0x455f917e, 0x0, 0x0, 0x0, 0x0, 0x6afc8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x90000000, 0x455f917e, 0x0, 0x0, 0x0, 0x0, 0x6afc8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x90000000, 0x455f917e, 0x0, 0x0, 0x0, 0x0, 0x6afc8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x90000000, 0x455f917e, 0x0, 0x0, 0x0, 0x0, 0x6afc8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x90000000, 0x455f917e, 0x0, 0x0, 0x0, 0x0, 0x6afc8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x90000000, 0x455f917e, 0x0, 0x0, 0x0, 0x0, 0x6afc8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x90000000, 0x455f917e, 0x0, 0x0, 0x0, 0x0, 0x6afc8bf4, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x90000000, 0x455f917e, 0x0, 0x0, 0x0, 0x0, 0x6afc8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x90000000, 0x455f917e, 0x0, 0x0, 0x0, 0x0, 0x6afc8bf5, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x70000000, 0x3e59082e, 0x0, 0x0, 0x0, 0x0, 0x32c84174, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x70000000, 0x3e59082e, 0x0, 0x0, 0x0, 0x0, 0x32c84173, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x70000000, 0x3e59082e, 0x0, 0x0, 0x0, 0x0, 0x32c84173, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x70000000, 0x3e59082e, 0x0, 0x0, 0x0, 0x0, 0x32c84174, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x70000000, 0x3e59082e, 0x0, 0x0, 0x0, 0x0, 0x32c84174, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x70000000, 0x3e59082e, 0x0, 0x0, 0x0, 0x0, 0x32c84174, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x70000000, 0x3e59082e, 0x0, 0x0, 0x0, 0x0, 0x32c84173, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x70000000, 0x3e59082e, 0x0, 0x0, 0x0, 0x0, 0x32c84173, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x70000000, 0x3e59082e, 0x0, 0x0, 0x0, 0x0, 0x32c84174, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x70000000, 0x3e59082e, 0x0, 0x0, 0x0, 0x0, 0x32c84174, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0xf0000000, 0x41587625, 0x0, 0x0, 0x0, 0x0, 0x4ac3b130, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0xf0000000, 0x41587625, 0x0, 0x0, 0x0, 0x0, 0x4ac3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0xf0000000, 0x41587625, 0x0, 0x0, 0x0, 0x0, 0x4ac3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0xf0000000, 0x41587625, 0x0, 0x0, 0x0, 0x0, 0x4ac3b130, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0xf0000000, 0x41587625, 0x0, 0x0, 0x0, 0x0, 0x4ac3b130, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0xf0000000, 0x41587625, 0x0, 0x0, 0x0, 0x0, 0x4ac3b130, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0xf0000000, 0x41587625, 0x0, 0x0, 0x0, 0x0, 0x4ac3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0xf0000000, 0x41587625, 0x0, 0x0, 0x0, 0x0, 0x4ac3b12f, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0xf0000000, 0x41587625, 0x0, 0x0, 0x0, 0x0, 0x4ac3b130, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0xf0000000, 0x41587625, 0x0, 0x0, 0x0, 0x0, 0x4ac3b130, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0xb0000000, 0x44610405, 0x0, 0x0, 0x0, 0x0, 0x6308202e, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0xb0000000, 0x44610405, 0x0, 0x0, 0x0, 0x0, 0x6308202d, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0xb0000000, 0x44610405, 0x0, 0x0, 0x0, 0x0, 0x6308202d, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0xb0000000, 0x44610405, 0x0, 0x0, 0x0, 0x0, 0x6308202e, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0xb0000000, 0x44610405, 0x0, 0x0, 0x0, 0x0, 0x6308202e, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0xb0000000, 0x44610405, 0x0, 0x0, 0x0, 0x0, 0x6308202e, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0xb0000000, 0x44610405, 0x0, 0x0, 0x0, 0x0, 0x6308202d, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0xb0000000, 0x44610405, 0x0, 0x0, 0x0, 0x0, 0x6308202d, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0xb0000000, 0x44610405, 0x0, 0x0, 0x0, 0x0, 0x6308202e, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0xb0000000, 0x44610405, 0x0, 0x0, 0x0, 0x0, 0x6308202e, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x90000000, 0x3e7aee4b, 0x0, 0x0, 0x0, 0x0, 0x33d7725c, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x90000000, 0x3e7aee4b, 0x0, 0x0, 0x0, 0x0, 0x33d7725c, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x90000000, 0x3e7aee4b, 0x0, 0x0, 0x0, 0x0, 0x33d7725c, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x90000000, 0x3e7aee4b, 0x0, 0x0, 0x0, 0x0, 0x33d7725d, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x90000000, 0x3e7aee4b, 0x0, 0x0, 0x0, 0x0, 0x33d7725d, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x90000000, 0x3e7aee4b, 0x0, 0x0, 0x0, 0x0, 0x33d7725c, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x90000000, 0x3e7aee4b, 0x0, 0x0, 0x0, 0x0, 0x33d7725c, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x90000000, 0x3e7aee4b, 0x0, 0x0, 0x0, 0x0, 0x33d7725c, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x90000000, 0x3e7aee4b, 0x0, 0x0, 0x0, 0x0, 0x33d7725d, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x90000000, 0x3e7aee4b, 0x0, 0x0, 0x0, 0x0, 0x33d7725d, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x90000000, 0x44f91a9a, 0x0, 0x0, 0x0, 0x0, 0x67c8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x90000000, 0x44f91a9a, 0x0, 0x0, 0x0, 0x0, 0x67c8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x90000000, 0x44f91a9a, 0x0, 0x0, 0x0, 0x0, 0x67c8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x90000000, 0x44f91a9a, 0x0, 0x0, 0x0, 0x0, 0x67c8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x90000000, 0x44f91a9a, 0x0, 0x0, 0x0, 0x0, 0x67c8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x90000000, 0x44f91a9a, 0x0, 0x0, 0x0, 0x0, 0x67c8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x90000000, 0x44f91a9a, 0x0, 0x0, 0x0, 0x0, 0x67c8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x90000000, 0x44f91a9a, 0x0, 0x0, 0x0, 0x0, 0x67c8d4d4, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x90000000, 0x44f91a9a, 0x0, 0x0, 0x0, 0x0, 0x67c8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x90000000, 0x44f91a9a, 0x0, 0x0, 0x0, 0x0, 0x67c8d4d5, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x90000000, 0x42ac3bf9, 0x0, 0x0, 0x0, 0x0, 0x5561dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x90000000, 0x42ac3bf9, 0x0, 0x0, 0x0, 0x0, 0x5561dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x90000000, 0x42ac3bf9, 0x0, 0x0, 0x0, 0x0, 0x5561dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x90000000, 0x42ac3bf9, 0x0, 0x0, 0x0, 0x0, 0x5561dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x90000000, 0x42ac3bf9, 0x0, 0x0, 0x0, 0x0, 0x5561dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x90000000, 0x42ac3bf9, 0x0, 0x0, 0x0, 0x0, 0x5561dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x90000000, 0x42ac3bf9, 0x0, 0x0, 0x0, 0x0, 0x5561dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x90000000, 0x42ac3bf9, 0x0, 0x0, 0x0, 0x0, 0x5561dfcc, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x90000000, 0x42ac3bf9, 0x0, 0x0, 0x0, 0x0, 0x5561dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x90000000, 0x42ac3bf9, 0x0, 0x0, 0x0, 0x0, 0x5561dfcd, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x50000000, 0x3ff221c3, 0x0, 0x0, 0x0, 0x0, 0x3f910e1a, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x50000000, 0x3ff221c3, 0x0, 0x0, 0x0, 0x0, 0x3f910e1a, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x50000000, 0x3ff221c3, 0x0, 0x0, 0x0, 0x0, 0x3f910e1a, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x50000000, 0x3ff221c3, 0x0, 0x0, 0x0, 0x0, 0x3f910e1b, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x50000000, 0x3ff221c3, 0x0, 0x0, 0x0, 0x0, 0x3f910e1b, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x50000000, 0x3ff221c3, 0x0, 0x0, 0x0, 0x0, 0x3f910e1a, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x50000000, 0x3ff221c3, 0x0, 0x0, 0x0, 0x0, 0x3f910e1a, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x50000000, 0x3ff221c3, 0x0, 0x0, 0x0, 0x0, 0x3f910e1a, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x50000000, 0x3ff221c3, 0x0, 0x0, 0x0, 0x0, 0x3f910e1b, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x50000000, 0x3ff221c3, 0x0, 0x0, 0x0, 0x0, 0x3f910e1b, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0xb0000000, 0x424ff859, 0x0, 0x0, 0x0, 0x0, 0x527fc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0xb0000000, 0x424ff859, 0x0, 0x0, 0x0, 0x0, 0x527fc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0xb0000000, 0x424ff859, 0x0, 0x0, 0x0, 0x0, 0x527fc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0xb0000000, 0x424ff859, 0x0, 0x0, 0x0, 0x0, 0x527fc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0xb0000000, 0x424ff859, 0x0, 0x0, 0x0, 0x0, 0x527fc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0xb0000000, 0x424ff859, 0x0, 0x0, 0x0, 0x0, 0x527fc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0xb0000000, 0x424ff859, 0x0, 0x0, 0x0, 0x0, 0x527fc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0xb0000000, 0x424ff859, 0x0, 0x0, 0x0, 0x0, 0x527fc2cd, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0xb0000000, 0x424ff859, 0x0, 0x0, 0x0, 0x0, 0x527fc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0xb0000000, 0x424ff859, 0x0, 0x0, 0x0, 0x0, 0x527fc2ce, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0x30000000, 0x3e739fb8, 0x0, 0x0, 0x0, 0x0, 0x339cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0x30000000, 0x3e739fb8, 0x0, 0x0, 0x0, 0x0, 0x339cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0x30000000, 0x3e739fb8, 0x0, 0x0, 0x0, 0x0, 0x339cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0x30000000, 0x3e739fb8, 0x0, 0x0, 0x0, 0x0, 0x339cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0x30000000, 0x3e739fb8, 0x0, 0x0, 0x0, 0x0, 0x339cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0x30000000, 0x3e739fb8, 0x0, 0x0, 0x0, 0x0, 0x339cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0x30000000, 0x3e739fb8, 0x0, 0x0, 0x0, 0x0, 0x339cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0x30000000, 0x3e739fb8, 0x0, 0x0, 0x0, 0x0, 0x339cfdc1, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0x30000000, 0x3e739fb8, 0x0, 0x0, 0x0, 0x0, 0x339cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0x30000000, 0x3e739fb8, 0x0, 0x0, 0x0, 0x0, 0x339cfdc2, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0xb0000000, 0x42a5bf4c, 0x0, 0x0, 0x0, 0x0, 0x552dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0xb0000000, 0x42a5bf4c, 0x0, 0x0, 0x0, 0x0, 0x552dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0xb0000000, 0x42a5bf4c, 0x0, 0x0, 0x0, 0x0, 0x552dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0xb0000000, 0x42a5bf4c, 0x0, 0x0, 0x0, 0x0, 0x552dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0xb0000000, 0x42a5bf4c, 0x0, 0x0, 0x0, 0x0, 0x552dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0xb0000000, 0x42a5bf4c, 0x0, 0x0, 0x0, 0x0, 0x552dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0xb0000000, 0x42a5bf4c, 0x0, 0x0, 0x0, 0x0, 0x552dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0xb0000000, 0x42a5bf4c, 0x0, 0x0, 0x0, 0x0, 0x552dfa65, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0xb0000000, 0x42a5bf4c, 0x0, 0x0, 0x0, 0x0, 0x552dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0xb0000000, 0x42a5bf4c, 0x0, 0x0, 0x0, 0x0, 0x552dfa66, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0xb0000000, 0x441d9861, 0x0, 0x0, 0x0, 0x0, 0x60ecc30e, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0xb0000000, 0x441d9861, 0x0, 0x0, 0x0, 0x0, 0x60ecc30d, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0xb0000000, 0x441d9861, 0x0, 0x0, 0x0, 0x0, 0x60ecc30d, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0xb0000000, 0x441d9861, 0x0, 0x0, 0x0, 0x0, 0x60ecc30e, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0xb0000000, 0x441d9861, 0x0, 0x0, 0x0, 0x0, 0x60ecc30e, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0xb0000000, 0x441d9861, 0x0, 0x0, 0x0, 0x0, 0x60ecc30e, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0xb0000000, 0x441d9861, 0x0, 0x0, 0x0, 0x0, 0x60ecc30d, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0xb0000000, 0x441d9861, 0x0, 0x0, 0x0, 0x0, 0x60ecc30d, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0xb0000000, 0x441d9861, 0x0, 0x0, 0x0, 0x0, 0x60ecc30e, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0xb0000000, 0x441d9861, 0x0, 0x0, 0x0, 0x0, 0x60ecc30e, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0xd0000000, 0x4238bd08, 0x0, 0x0, 0x0, 0x0, 0x51c5e846, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0xd0000000, 0x4238bd08, 0x0, 0x0, 0x0, 0x0, 0x51c5e846, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0xd0000000, 0x4238bd08, 0x0, 0x0, 0x0, 0x0, 0x51c5e846, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0xd0000000, 0x4238bd08, 0x0, 0x0, 0x0, 0x0, 0x51c5e847, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0xd0000000, 0x4238bd08, 0x0, 0x0, 0x0, 0x0, 0x51c5e847, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0xd0000000, 0x4238bd08, 0x0, 0x0, 0x0, 0x0, 0x51c5e846, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0xd0000000, 0x4238bd08, 0x0, 0x0, 0x0, 0x0, 0x51c5e846, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0xd0000000, 0x4238bd08, 0x0, 0x0, 0x0, 0x0, 0x51c5e846, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0xd0000000, 0x4238bd08, 0x0, 0x0, 0x0, 0x0, 0x51c5e847, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0xd0000000, 0x4238bd08, 0x0, 0x0, 0x0, 0x0, 0x51c5e847, 0xffffffff, 0x1, 0x0
+  .word 0x360, 0x2, 0xd0000000, 0x449590f1, 0x0, 0x0, 0x0, 0x0, 0x64ac878e, 0xffffffff, 0x1, 0x0
+  .word 0x368, 0x3, 0xd0000000, 0x449590f1, 0x0, 0x0, 0x0, 0x0, 0x64ac878e, 0xffffffff, 0x1, 0x0
+  .word 0x370, 0x0, 0xd0000000, 0x449590f1, 0x0, 0x0, 0x0, 0x0, 0x64ac878e, 0xffffffff, 0x1, 0x0
+  .word 0x378, 0x2, 0xd0000000, 0x449590f1, 0x0, 0x0, 0x0, 0x0, 0x64ac878f, 0xffffffff, 0x1, 0x0
+  .word 0x380, 0x1, 0xd0000000, 0x449590f1, 0x0, 0x0, 0x0, 0x0, 0x64ac878f, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x0, 0xd0000000, 0x449590f1, 0x0, 0x0, 0x0, 0x0, 0x64ac878e, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x1, 0xd0000000, 0x449590f1, 0x0, 0x0, 0x0, 0x0, 0x64ac878e, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x2, 0xd0000000, 0x449590f1, 0x0, 0x0, 0x0, 0x0, 0x64ac878e, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x3, 0xd0000000, 0x449590f1, 0x0, 0x0, 0x0, 0x0, 0x64ac878f, 0xffffffff, 0x1, 0x0
+  .word 0x388, 0x4, 0xd0000000, 0x449590f1, 0x0, 0x0, 0x0, 0x0, 0x64ac878f, 0xffffffff, 0x1, 0x0
+  .word 0x390, 0x2, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x398, 0x3, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3a0, 0x0, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3a8, 0x2, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3b0, 0x1, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x0, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x1, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x2, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x3, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x4, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3c0, 0x2, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3c8, 0x3, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3d0, 0x0, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3d8, 0x2, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3e0, 0x1, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x0, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x1, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x2, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x3, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x4, 0x3f000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x390, 0x2, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x398, 0x3, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3a0, 0x0, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3a8, 0x2, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3b0, 0x1, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x0, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x1, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x2, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x3, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x4, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3c0, 0x2, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3c8, 0x3, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3d0, 0x0, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3d8, 0x2, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3e0, 0x1, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x0, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x1, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x2, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x3, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x4, 0x3fc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x390, 0x2, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x398, 0x3, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3a0, 0x0, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3a8, 0x2, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1, 0x1
+  .word 0x3b0, 0x1, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x0, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x1, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x2, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x3, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x4, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1, 0x1
+  .word 0x3c0, 0x2, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3c8, 0x3, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3d0, 0x0, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3d8, 0x2, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1, 0x1
+  .word 0x3e0, 0x1, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x0, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x1, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x2, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x3, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x4, 0x40200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1, 0x1
+  .word 0x390, 0x2, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x398, 0x3, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x1, 0x1
+  .word 0x3a0, 0x0, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x3a8, 0x2, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x1, 0x1
+  .word 0x3b0, 0x1, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x0, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x1, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x2, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x3, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x4, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x3c0, 0x2, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3c8, 0x3, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3d0, 0x0, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3d8, 0x2, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e0, 0x1, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x0, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x1, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x2, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x3, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x4, 0xbfc00000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x390, 0x2, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x398, 0x3, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x3a0, 0x0, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffd, 0x0, 0x1, 0x1
+  .word 0x3a8, 0x2, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x3b0, 0x1, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffd, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x0, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x1, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x2, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffd, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x3, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffe, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x4, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xfffffffd, 0x0, 0x1, 0x1
+  .word 0x3c0, 0x2, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3c8, 0x3, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3d0, 0x0, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3d8, 0x2, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e0, 0x1, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x0, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x1, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x2, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x3, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x4, 0xc0200000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x390, 0x2, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x398, 0x3, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3a0, 0x0, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x1, 0x1
+  .word 0x3a8, 0x2, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3b0, 0x1, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x0, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x1, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x2, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x3, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3b8, 0x4, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x0, 0x1, 0x1
+  .word 0x3c0, 0x2, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3c8, 0x3, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3d0, 0x0, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3d8, 0x2, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3e0, 0x1, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x0, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x1, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x2, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+  .word 0x3e8, 0x3, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1
+  .word 0x3e8, 0x4, 0xbf000000, 0xffffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1
+cases_end:
+
+msg_ok:    .asciz "fp round: ok\n"
+msg_fail:  .asciz "fp round: FAIL "
+msg_of:    .asciz " of "
+msg_case:  .asciz "case "
+msg_colon: .asciz ": "
+msg_space: .asciz " "
+msg_nl:    .asciz "\n"
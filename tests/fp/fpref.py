@@ -0,0 +1,287 @@
+# fpref.py
+#
+#   Exact reference for the RISC-V float instructions, working on the bits of
+#   singles and doubles with python fractions so every result and fflags bit
+#   follows the spec rather than whatever host it runs on.  Used by fp_gen.py
+#   to work out what each test case expects.
+
+from fractions import Fraction
+import math
+
+# rounding modes
+RNE, RTZ, RDN, RUP, RMM = 0, 1, 2, 3, 4
+# fflags
+NV, DZ, OF, UF, NX = 16, 8, 4, 2, 1
+
+
+class Format:
+    def __init__(self, exp_bits, frac_bits):
+        self.exp_bits = exp_bits
+        self.frac_bits = frac_bits
+        self.width = 1 + exp_bits + frac_bits
+        self.bias = (1 << (exp_bits - 1)) - 1
+        self.emin = 1 - self.bias
+        self.exp_max = (1 << exp_bits) - 1
+        self.sign = 1 << (self.width - 1)
+        self.qnan = (self.exp_max << frac_bits) | (1 << (frac_bits - 1))
+        self.inf = self.exp_max << frac_bits
+        self.max = ((self.exp_max - 1) << frac_bits) | ((1 << frac_bits) - 1)
+
+
+SINGLE = Format(8, 23)
+DOUBLE = Format(11, 52)
+
+
+def decode(f, bits):
+    """('nan', quiet), ('inf', sign) or ('num', value, sign)"""
+    sign = bits >> (f.width - 1)
+    exp = (bits >> f.frac_bits) & f.exp_max
+    frac = bits & ((1 << f.frac_bits) - 1)
+    if exp == f.exp_max:
+        if frac:
+            return ('nan', bool(frac >> (f.frac_bits - 1)))
+        return ('inf', sign)
+    if exp == 0:
+        value = Fraction(frac) * Fraction(2) ** (f.emin - f.frac_bits)
+    else:
+        value = Fraction((1 << f.frac_bits) | frac) * Fraction(2) ** (exp - f.bias - f.frac_bits)
+    return ('num', -value if sign else value, sign)
+
+
+def is_nan(f, bits):
+    return decode(f, bits)[0] == 'nan'
+
+
+def is_snan(f, bits):
+    d = decode(f, bits)
+    return d[0] == 'nan' and not d[1]
+
+
+def sign_of(d):
+    return d[1] if d[0] == 'inf' else d[2]
+
+
+def floor_log2(x):
+    e = x.numerator.bit_length() - x.denominator.bit_length()
+    if Fraction(2) ** e > x:
+        e -= 1
+    if Fraction(2) ** (e + 1) <= x:
+        e += 1
+    return e
+
+
+def round_int(m, mode, neg):
+    """round the magnitude m to an integer, returning it and if inexact"""
+    n = math.floor(m)
+    r = m - n
+    if r == 0:
+        return n, False
+    up = {
+        RNE: r > Fraction(1, 2) or (r == Fraction(1, 2) and n % 2 == 1),
+        RTZ: False,
+        RDN: neg,
+        RUP: not neg,
+        RMM: r >= Fraction(1, 2),
+    }[mode]
+    return n + (1 if up else 0), True
+
+
+def encode(f, x, mode, sticky=False):
+    """round the nonzero value x, which is a hair larger in magnitude when
+    sticky, returning its bits and fflags"""
+    neg = x < 0
+    a = -x if neg else x
+    if sticky:
+        a += Fraction(1, 1 << 2200)
+    e = floor_log2(a)
+    # tininess is detected after rounding, as if the exponent were unbounded
+    n, inexact = round_int(a / Fraction(2) ** (e - f.frac_bits), mode, neg)
+    tiny = (e + (1 if n >> (f.frac_bits + 1) else 0)) < f.emin
+    e = max(e, f.emin)
+    n, inexact = round_int(a / Fraction(2) ** (e - f.frac_bits), mode, neg)
+    if n >> (f.frac_bits + 1):
+        n >>= 1
+        e += 1
+    flags = NX if inexact else 0
+    if tiny and inexact:
+        flags |= UF
+    if n >> f.frac_bits:
+        exp = e + f.bias
+        frac = n - (1 << f.frac_bits)
+    else:
+        exp = 0
+        frac = n
+    if exp >= f.exp_max:
+        flags |= OF | NX
+        to_inf = {RNE: True, RMM: True, RTZ: False, RDN: neg, RUP: not neg}[mode]
+        bits = f.inf if to_inf else f.max
+    else:
+        bits = (exp << f.frac_bits) | frac
+    return bits | (f.sign if neg else 0), flags
+
+
+def exact_zero(f, mode, signs):
+    """the zero resulting from an exact sum of terms with these signs"""
+    if len(set(signs)) == 1:
+        return f.sign if signs[0] else 0
+    return f.sign if mode == RDN else 0
+
+
+def arith(f, op, mode, a, b=None, c=None):
+    """add, sub, mul, div, sqrt or fma (a * b + c), returning bits and fflags"""
+    args = [x for x in (a, b, c) if x is not None]
+    flags = NV if any(is_snan(f, x) for x in args) else 0
+    ds = [decode(f, x) for x in args]
+    zero = lambda d: d[0] == 'num' and d[1] == 0
+    inf = lambda d: d[0] == 'inf'
+    if any(d[0] == 'nan' for d in ds):
+        # inf * 0 is invalid even when the addend is a quiet nan
+        if op == 'fma' and ((inf(ds[0]) and zero(ds[1])) or (zero(ds[0]) and inf(ds[1]))):
+            flags |= NV
+        return f.qnan, flags
+    if op in ('add', 'sub'):
+        x, y = ds
+        sy = sign_of(y) ^ (op == 'sub')
+        if inf(x) and inf(y) and sign_of(x) != sy:
+            return f.qnan, flags | NV
+        if inf(x) or inf(y):
+            return f.inf | (f.sign if (sign_of(x) if inf(x) else sy) else 0), flags
+        r = x[1] + (-y[1] if op == 'sub' else y[1])
+        if r == 0:
+            return exact_zero(f, mode, [x[2], sy] if x[1] == 0 and y[1] == 0 else [0, 1]), flags
+    elif op == 'mul':
+        x, y = ds
+        s = sign_of(x) ^ sign_of(y)
+        if (inf(x) and zero(y)) or (zero(x) and inf(y)):
+            return f.qnan, flags | NV
+        if inf(x) or inf(y):
+            return f.inf | (f.sign if s else 0), flags
+        r = x[1] * y[1]
+        if r == 0:
+            return f.sign if s else 0, flags
+    elif op == 'div':
+        x, y = ds
+        s = sign_of(x) ^ sign_of(y)
+        if inf(x) and inf(y) or zero(x) and zero(y):
+            return f.qnan, flags | NV
+        if inf(x):
+            return f.inf | (f.sign if s else 0), flags
+        if inf(y):
+            return f.sign if s else 0, flags
+        if zero(y):
+            return f.inf | (f.sign if s else 0), flags | DZ
+        r = x[1] / y[1]
+        if r == 0:
+            return f.sign if s else 0, flags
+    elif op == 'sqrt':
+        x, = ds
+        if inf(x):
+            return (f.qnan, flags | NV) if sign_of(x) else (f.inf, flags)
+        if zero(x):
+            return a, flags
+        if x[1] < 0:
+            return f.qnan, flags | NV
+        # the root to far more bits than either format holds
+        k = 1300
+        y = x[1] * Fraction(2) ** (2 * k)
+        s = math.isqrt(math.floor(y))
+        return_bits, ff = encode(f, Fraction(s) / Fraction(2) ** k, mode, sticky=Fraction(s * s) != y)
+        return return_bits, flags | ff
+    elif op == 'fma':
+        x, y, z = ds
+        s = sign_of(x) ^ sign_of(y)
+        if (inf(x) and zero(y)) or (zero(x) and inf(y)):
+            return f.qnan, flags | NV
+        if inf(x) or inf(y):
+            if inf(z) and sign_of(z) != s:
+                return f.qnan, flags | NV
+            return f.inf | (f.sign if s else 0), flags
+        if inf(z):
+            return f.inf | (f.sign if sign_of(z) else 0), flags
+        p = x[1] * y[1]
+        r = p + z[1]
+        if r == 0:
+            return exact_zero(f, mode, [s, z[2]] if p == 0 and z[1] == 0 else [0, 1]), flags
+    bits, ff = encode(f, r, mode)
+    return bits, flags | ff
+
+
+def fcvt_w(f, a, mode, unsigned):
+    """fcvt.w[u] of the float bits a, returning the integer and fflags"""
+    d = decode(f, a)
+    lo, hi = (0, 2 ** 32 - 1) if unsigned else (-2 ** 31, 2 ** 31 - 1)
+    if d[0] == 'nan':
+        return hi & 0xffffffff, NV
+    if d[0] == 'inf':
+        return (lo if d[1] else hi) & 0xffffffff, NV
+    v = d[1]
+    n, inexact = round_int(abs(v), mode, v < 0)
+    n = -n if v < 0 else n
+    if n < lo or n > hi:
+        return (lo if n < lo else hi) & 0xffffffff, NV
+    return n & 0xffffffff, NX if inexact else 0
+
+
+def fcvt_from_w(f, x, mode, unsigned):
+    """fcvt.[sd].w[u] of the integer x, returning the bits and fflags"""
+    v = x if unsigned or not x >> 31 else x - (1 << 32)
+    return (0, 0) if v == 0 else encode(f, Fraction(v), mode)
+
+
+def convert(src, dst, a, mode):
+    """fcvt between formats, returning the bits and fflags"""
+    d = decode(src, a)
+    if d[0] == 'nan':
+        return dst.qnan, 0 if d[1] else NV
+    if d[0] == 'inf':
+        return dst.inf | (dst.sign if d[1] else 0), 0
+    if d[1] == 0:
+        return dst.sign if d[2] else 0, 0
+    return encode(dst, d[1], mode)
+
+
+def order_key(f, bits):
+    d = decode(f, bits)
+    if d[0] == 'inf':
+        return Fraction(-(10 ** 400) if d[1] else 10 ** 400)
+    return d[1]
+
+
+def minmax(f, a, b, is_max):
+    """fmin or fmax, returning the bits and fflags"""
+    flags = NV if is_snan(f, a) or is_snan(f, b) else 0
+    if is_nan(f, a) and is_nan(f, b):
+        return f.qnan, flags
+    if is_nan(f, a):
+        return b, flags
+    if is_nan(f, b):
+        return a, flags
+    ka, kb = order_key(f, a), order_key(f, b)
+    if ka == kb:
+        # -0 is less than +0
+        neg_a = bool(a & f.sign)
+        return (a if neg_a != is_max else b), flags
+    return (a if (ka > kb) == is_max else b), flags
+
+
+def compare(f, a, b, op):
+    """feq, flt or fle, returning the integer and fflags"""
+    if is_nan(f, a) or is_nan(f, b):
+        quiet = op == 'eq' and not (is_snan(f, a) or is_snan(f, b))
+        return 0, 0 if quiet else NV
+    ka, kb = order_key(f, a), order_key(f, b)
+    return int({'eq': ka == kb, 'lt': ka < kb, 'le': ka <= kb}[op]), 0
+
+
+def fclass(f, a):
+    d = decode(f, a)
+    neg = bool(a & f.sign)
+    if d[0] == 'inf':
+        return 1 << 0 if neg else 1 << 7
+    if d[0] == 'nan':
+        return 1 << 9 if d[1] else 1 << 8
+    if d[1] == 0:
+        return 1 << 3 if neg else 1 << 4
+    if (a >> f.frac_bits) & f.exp_max == 0:
+        return 1 << 2 if neg else 1 << 5
+    return 1 << 1 if neg else 1 << 6
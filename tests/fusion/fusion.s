@@ -0,0 +1,528 @@
+# fusion.s
+#
+#   The instruction pairs the interpreters fuse into superinstructions (see
+#   riscv_core/fusion.h and fuse_rule in interp.h) and the jit folds, with
+#   their registers aliased every way the rules allow, pairs that only look
+#   like them, pairs split over a block boundary or entered at their second
+#   instruction, and loops hot enough to be traced.  Run under --trace too,
+#   where the decoded blocks are single stepped.
+#
+#   Build:
+#     llvm-mc -triple=riscv32 -mattr=+m,-relax -filetype=obj \
+#       fusion.s -o fusion.o
+#     ld.lld -Ttext=0x10000 fusion.o -o fusion.elf
+
+  .equ MAX_REPORT,       16
+  .equ HOT_ITERS,        3000
+  # a count sltiu can compare against, still past the trace threshold
+  .equ COUNT_ITERS,      2000
+  # instructions before the last one of a full size decoded block
+  .equ BLOCK_FILL,       255
+
+  .equ SYS_write,        64
+  .equ SYS_exit,         93
+
+# check that reg holds value, the address of a label or another register
+  .macro expect reg, value
+  mv t4, \reg
+  li t6, \value
+  jal t5, check
+  .endm
+
+  .macro expect_at reg, label
+  mv t4, \reg
+  la t6, \label
+  jal t5, check
+  .endm
+
+  .macro expect_reg reg, other
+  mv t4, \reg
+  mv t6, \other
+  jal t5, check
+  .endm
+
+# run a comparison and the branch on its result, checking the way the branch
+# went and that the comparison's register was still written
+  .macro cmp_branch cmp, branch, taken, reg, value
+  li t3, 1
+  \cmp
+  \branch, 1f
+  li t3, 0
+1:
+  expect t3, \taken
+  expect \reg, \value
+  .endm
+
+# end the block so the next one starts at a known instruction, then fill all
+# but the last of its instructions
+  .macro block_fill
+  j 1f
+1:
+  .rept BLOCK_FILL
+  nop
+  .endr
+  .endm
+
+  .text
+  .globl _start
+_start:
+  la sp, stack_top
+  li s3, 0                  # check number
+  li s4, 0                  # failures
+
+  # ---- lui + addi
+  lui a0, 0x12345
+  addi a0, a0, 0x678
+  expect a0, 0x12345678
+  lui a0, 0x12346
+  addi a0, a0, -0x788
+  expect a0, 0x12345878
+  lui a1, 0
+  addi a1, a1, -2048
+  expect a1, 0xfffff800
+  lui a2, 0xfffff
+  addi a2, a2, -1
+  expect a2, 0xffffefff
+  lui a3, 0x80000
+  addi a3, a3, 2047
+  expect a3, 0x800007ff
+  # not fused: another rd, another rs1, and rd zero
+  lui a0, 0x11111
+  addi a1, a0, 0x111
+  expect a0, 0x11111000
+  expect a1, 0x11111111
+  li a2, 40
+  lui a0, 0x22222
+  addi a0, a2, 2
+  expect a0, 42
+  lui zero, 0x33333
+  addi a0, zero, 3
+  expect a0, 3
+
+  # ---- auipc + addi
+1:
+  auipc a0, %pcrel_hi(la_target)
+  addi a0, a0, %pcrel_lo(1b)
+  expect_at a0, la_target
+2:
+  auipc a1, 1
+  addi a1, a1, -4
+  la t0, 2b
+  li t1, 0xffc
+  add t0, t0, t1
+  expect_reg a1, t0
+  # not fused: another rd
+3:
+  auipc a0, 0
+  addi a1, a0, 8
+  expect_at a0, 3b
+  la t0, 3b
+  addi t0, t0, 8
+  expect_reg a1, t0
+
+  # ---- auipc + jalr, which keep the auipc result
+  li a0, 0
+4:
+  auipc t1, %pcrel_hi(call_target)
+  jalr ra, %pcrel_lo(4b)(t1)
+call_return:
+  expect a0, 55
+  expect_at ra, call_return
+  addi t1, t1, %pcrel_lo(4b)
+  expect_at t1, call_target
+  # the target with bit 0 of the sum cleared, and rd the same as rt
+5:
+  auipc ra, 0
+  jalr ra, 13(ra)
+  j 6f
+  addi a0, zero, 77
+  ret
+6:
+  expect a0, 77
+  la t0, 5b
+  addi t0, t0, 8
+  expect_reg ra, t0
+
+  # ---- slli + add
+  li a0, 0x01234567
+  li a1, 0x1000
+  slli t0, a0, 2
+  add a2, t0, a1
+  expect t0, 0x048d159c
+  expect a2, 0x048d259c
+  slli t0, a0, 3
+  add a2, a1, t0
+  expect a2, 0x091a3b38
+  # everything in one register
+  mv a3, a0
+  slli a3, a3, 4
+  add a3, a3, a3
+  expect a3, 0x2468ace0
+  # rd the same as the other source, and the largest shift
+  li a4, 5
+  slli t0, a4, 31
+  add a1, a1, t0
+  expect a1, 0x80001000
+  # rd the same as rt, and no shift
+  li t0, 0
+  slli t0, a0, 0
+  add t0, t0, t0
+  expect t0, 0x02468ace
+  # the shift in place then read as rs2
+  li t0, 3
+  slli t0, t0, 5
+  add t0, a4, t0
+  expect t0, 101
+  # not fused: rd zero, and an add not reading the shift
+  slli t1, a0, 1
+  add zero, t1, a0
+  expect t1, 0x02468ace
+  li a5, 1
+  li a6, 2
+  slli t2, a0, 1
+  add a5, a5, a6
+  expect t2, 0x02468ace
+  expect a5, 3
+
+  # ---- slt, sltu, slti and sltiu + beqz/bnez, either way round
+  li a0, 5
+  li a1, -1
+  li a2, 0x7fffffff
+  cmp_branch "sltiu t0, a0, 6", "bnez t0", 1, t0, 1
+  cmp_branch "sltiu t0, a0, 5", "bnez t0", 0, t0, 0
+  cmp_branch "sltiu t0, a0, 6", "beqz t0", 0, t0, 1
+  cmp_branch "sltiu t0, a0, 5", "beqz t0", 1, t0, 0
+  cmp_branch "sltiu t0, a0, 6", "bne zero, t0", 1, t0, 1
+  cmp_branch "sltiu t0, a0, 6", "beq zero, t0", 0, t0, 1
+  # the immediate is sign extended then compared unsigned
+  cmp_branch "sltiu t0, a1, -1", "bnez t0", 0, t0, 0
+  cmp_branch "sltiu t0, a2, -1", "bnez t0", 1, t0, 1
+  cmp_branch "sltiu t0, a2, -2048", "bnez t0", 1, t0, 1
+  cmp_branch "sltiu t0, a1, -2048", "bnez t0", 0, t0, 0
+  cmp_branch "sltiu t0, zero, 1", "bnez t0", 1, t0, 1
+  cmp_branch "sltiu t0, a0, 0", "bnez t0", 0, t0, 0
+  cmp_branch "sltiu t0, a0, 2047", "bnez t0", 1, t0, 1
+  # rt the same as rs1
+  mv t1, a0
+  cmp_branch "sltiu t1, t1, 9", "bnez t1", 1, t1, 1
+  mv t1, a1
+  cmp_branch "sltiu t1, t1, 9", "bnez t1", 0, t1, 0
+  cmp_branch "slti t0, a1, 0", "bnez t0", 1, t0, 1
+  cmp_branch "slti t0, a2, -2048", "bnez t0", 0, t0, 0
+  cmp_branch "slti t0, a0, -1", "beqz t0", 1, t0, 0
+  cmp_branch "slt t0, a1, a0", "bnez t0", 1, t0, 1
+  cmp_branch "slt t0, a2, a1", "bne zero, t0", 0, t0, 0
+  cmp_branch "sltu t0, a1, a0", "bnez t0", 0, t0, 0
+  cmp_branch "sltu t0, a0, a1", "beqz t0", 0, t0, 1
+  cmp_branch "sltu t0, zero, a0", "bnez t0", 1, t0, 1
+  # not fused: a branch against another register, and rd zero
+  li a3, 1
+  cmp_branch "sltiu t0, a0, 6", "bne t0, a3", 0, t0, 1
+  cmp_branch "sltiu t0, a0, 6", "beq t0, a3", 1, t0, 1
+  cmp_branch "sltiu zero, a0, 6", "bnez zero", 0, zero, 0
+  cmp_branch "sltiu zero, a0, 6", "beqz zero", 1, zero, 0
+
+  # ---- pairs split over a block boundary
+  block_fill
+  lui a0, 0x12345
+  addi a0, a0, 0x678
+  expect a0, 0x12345678
+  block_fill
+7:
+  auipc a0, %pcrel_hi(la_target)
+  addi a0, a0, %pcrel_lo(7b)
+  expect_at a0, la_target
+  li a0, 0x01234567
+  li a1, 0x1000
+  block_fill
+  slli t0, a0, 2
+  add a2, t0, a1
+  expect a2, 0x048d259c
+  expect t0, 0x048d159c
+  li a0, 5
+  block_fill
+  sltiu t0, a0, 6
+  bnez t0, 8f
+  li t3, 0
+  j 9f
+8:
+  li t3, 1
+9:
+  expect t3, 1
+  expect t0, 1
+
+  # ---- pairs entered at their second instruction, once decoded whole
+  jal ra, li_pair
+  expect a0, 0x12345678
+  li a0, 0x1000
+  jal ra, li_pair_lo
+  expect a0, 0x1678
+  jal ra, la_pair
+  la t0, la_pair
+  addi t0, t0, 16
+  expect_reg a0, t0
+  la a0, la_target
+  jal ra, la_pair_lo
+  la t0, la_target
+  addi t0, t0, 16
+  expect_reg a0, t0
+  li a0, 3
+  li a1, 100
+  jal ra, index_pair
+  expect a2, 124
+  li t0, 7
+  jal ra, index_pair_add
+  expect a2, 107
+  li a0, 3
+  jal ra, sltiu_pair
+  expect a1, 1
+  li t0, 0
+  jal ra, sltiu_pair_br
+  expect a1, 0
+  li a0, 50
+  jal ra, sltiu_pair
+  expect a1, 0
+  li t0, 1
+  jal ra, sltiu_pair_br
+  expect a1, 1
+
+  # ---- hot loops, each pair against the same work kept apart by a nop
+  li s5, HOT_ITERS
+  li s6, 0                  # differences
+  li s7, 0x9e3779b9         # xorshift state
+  li s8, 0                  # fused branches not taken
+  li s9, 0                  # the same counted apart
+hot:
+  slli t0, s7, 13
+  xor s7, s7, t0
+  srli t0, s7, 17
+  xor s7, s7, t0
+  slli t0, s7, 5
+  xor s7, s7, t0
+  # slli + add
+  slli t1, s7, 2
+  add t2, t1, s5
+  slli t3, s7, 2
+  nop
+  add t4, t3, s5
+  xor t5, t2, t4
+  or s6, s6, t5
+  xor t5, t1, t3
+  or s6, s6, t5
+  # lui + addi, and auipc + addi
+  lui t1, 0xabcde
+  addi t1, t1, -0x123
+  lui t3, 0xabcde
+  nop
+  addi t3, t3, -0x123
+  xor t5, t1, t3
+  or s6, s6, t5
+10:
+  auipc t1, %pcrel_hi(la_target)
+  addi t1, t1, %pcrel_lo(10b)
+  la t3, la_target
+  xor t5, t1, t3
+  or s6, s6, t5
+  # sltiu + bnez on random data, then the same comparison unfused
+  andi a0, s7, 0xff
+  sltiu t0, a0, 0x80
+  bnez t0, 11f
+  addi s8, s8, 1
+11:
+  sltiu t1, a0, 0x80
+  nop
+  xori t1, t1, 1
+  add s9, s9, t1
+  xor t5, t0, t1
+  xori t5, t5, 1
+  or s6, s6, t5
+  # close the loop with a fused pair
+  addi s5, s5, -1
+  sltu t0, zero, s5
+  bnez t0, hot
+  expect s6, 0
+  expect_reg s8, s9
+  # a counted loop closed by sltiu + bnez
+  li a0, 0
+  li a1, 0
+12:
+  addi a1, a1, 3
+  addi a0, a0, 1
+  sltiu t0, a0, COUNT_ITERS
+  bnez t0, 12b
+  expect a0, COUNT_ITERS
+  expect a1, COUNT_ITERS * 3
+  expect t0, 0
+
+  # ---- report
+  bnez s4, fail
+  la a0, msg_ok
+  jal ra, print_str
+  li a0, 0
+  li a7, SYS_exit
+  ecall
+fail:
+  la a0, msg_fail
+  jal ra, print_str
+  mv a0, s4
+  jal ra, print_uint
+  la a0, msg_of
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_nl
+  jal ra, print_str
+  li a0, 1
+  li a7, SYS_exit
+  ecall
+
+call_target:
+  addi a0, a0, 55
+  ret
+
+li_pair:
+  lui a0, 0x12345
+li_pair_lo:
+  addi a0, a0, 0x678
+  ret
+
+la_pair:
+  auipc a0, 0
+la_pair_lo:
+  addi a0, a0, 16
+  ret
+
+index_pair:
+  slli t0, a0, 3
+index_pair_add:
+  add a2, t0, a1
+  ret
+
+sltiu_pair:
+  sltiu t0, a0, 10
+sltiu_pair_br:
+  bnez t0, 1f
+  li a1, 0
+  ret
+1:
+  li a1, 1
+  ret
+
+# count a check, and a failure when t4 and t6 differ, writing the first few
+# as "check <n>: <got> <expected>".  returns to t5 with the other registers
+# as they were.
+check:
+  addi s3, s3, 1
+  bne t4, t6, 1f
+  jr t5
+1:
+  addi s4, s4, 1
+  addi sp, sp, -32
+  sw ra, 0(sp)
+  sw a0, 4(sp)
+  sw a1, 8(sp)
+  sw a2, 12(sp)
+  sw a7, 16(sp)
+  sw t0, 20(sp)
+  sw t1, 24(sp)
+  sw t2, 28(sp)
+  li t0, MAX_REPORT
+  bgtu s4, t0, 2f
+  la a0, msg_check
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_colon
+  jal ra, print_str
+  mv a0, t4
+  jal ra, print_hex
+  la a0, msg_space
+  jal ra, print_str
+  mv a0, t6
+  jal ra, print_hex
+  la a0, msg_nl
+  jal ra, print_str
+2:
+  lw ra, 0(sp)
+  lw a0, 4(sp)
+  lw a1, 8(sp)
+  lw a2, 12(sp)
+  lw a7, 16(sp)
+  lw t0, 20(sp)
+  lw t1, 24(sp)
+  lw t2, 28(sp)
+  addi sp, sp, 32
+  jr t5
+
+# write the string at a0 to stdout
+print_str:
+  mv a1, a0
+  mv a2, a0
+1:
+  lbu t0, 0(a2)
+  beqz t0, 2f
+  addi a2, a2, 1
+  j 1b
+2:
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout in decimal
+print_uint:
+  la a1, num_end
+  li t1, 10
+1:
+  remu t0, a0, t1
+  divu a0, a0, t1
+  addi t0, t0, '0'
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  bnez a0, 1b
+  la a2, num_end
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout as eight hex digits
+print_hex:
+  la a1, num_end
+  li t1, 8
+1:
+  andi t0, a0, 15
+  srli a0, a0, 4
+  addi t0, t0, '0'
+  li t2, '9'
+  bleu t0, t2, 2f
+  addi t0, t0, 'a' - '9' - 1
+2:
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  addi t1, t1, -1
+  bnez t1, 1b
+  li a2, 8
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+  .data
+  .p2align 3
+la_target: .skip 64
+num:       .skip 16
+num_end:
+           .skip 1024
+stack:     .skip 1024
+stack_top: .skip 1024
+
+msg_ok:    .asciz "fusion: ok\n"
+msg_fail:  .asciz "fusion: FAIL "
+msg_of:    .asciz " of "
+msg_check: .asciz "check "
+msg_colon: .asciz ": "
+msg_space: .asciz " "
+msg_nl:    .asciz "\n"
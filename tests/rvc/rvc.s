@@ -0,0 +1,509 @@
+# rvc.s
+#
+#   Every RV32C form, and the F and D loads and stores, with the edge values
+#   of their immediates, checking the link registers of the compressed and
+#   full size jumps (pc + 2 and pc + 4), auipc and branches at halfword
+#   addresses, and a full size instruction straddling the 64 KiB chunk
+#   boundary at 0x20000.
+#
+#   Build:
+#     llvm-mc -triple=riscv32 -mattr=+m,+c,+f,+d,-relax -filetype=obj \
+#       rvc.s -o rvc.o
+#     ld.lld -Ttext=0x10000 rvc.o -o rvc.elf
+
+  .equ MAX_REPORT,       16
+
+  .equ SYS_write,        64
+  .equ SYS_exit,         93
+
+# check that reg holds value, or the address of a label
+  .macro expect reg, value
+  mv t4, \reg
+  li t6, \value
+  jal t5, check
+  .endm
+
+  .macro expect_at reg, label
+  mv t4, \reg
+  la t6, \label
+  jal t5, check
+  .endm
+
+# a full size instruction whatever the assembler would make of it
+  .macro full inst:vararg
+  .option push
+  .option norvc
+  \inst
+  .option pop
+  .endm
+
+  .text
+  .globl _start
+_start:
+  la sp, stack_top
+  li s3, 0                  # check number
+  li s4, 0                  # failures
+
+  # ---- immediates
+  c.li a0, -32
+  expect a0, -32
+  c.li a1, 31
+  expect a1, 31
+  c.lui a2, 1
+  expect a2, 0x1000
+  c.lui a3, 31
+  expect a3, 0x1f000
+  c.lui a4, 0xfffe0
+  expect a4, 0xfffe0000
+  c.lui a5, 0xfffff
+  expect a5, 0xfffff000
+  c.addi a0, 31
+  expect a0, -1
+  c.addi a1, -32
+  expect a1, -1
+  c.li t0, 7
+  c.nop
+  c.addi t0, 1
+  expect t0, 8
+  mv s5, sp
+  c.addi16sp sp, -512
+  sub t0, s5, sp
+  expect t0, 512
+  c.addi16sp sp, 496
+  c.addi16sp sp, 16
+  expect_at sp, stack_top
+  c.addi4spn a0, sp, 4
+  sub t0, a0, sp
+  expect t0, 4
+  c.addi4spn s1, sp, 1020
+  sub t0, s1, sp
+  expect t0, 1020
+
+  # ---- shifts and alu operations
+  li a0, 0x80000001
+  c.srli a0, 31
+  expect a0, 1
+  li a1, 0x80000000
+  c.srai a1, 1
+  expect a1, 0xc0000000
+  c.srai a1, 31
+  expect a1, -1
+  li a2, 3
+  c.slli a2, 31
+  expect a2, 0x80000000
+  c.slli a2, 1
+  expect a2, 0
+  li a3, 0x12345677
+  c.andi a3, -32
+  expect a3, 0x12345660
+  c.andi a3, 31
+  expect a3, 0
+  li a4, 0x87654321
+  c.srli a4, 1
+  expect a4, 0x43b2a190
+  li a0, 5
+  li a1, 7
+  c.sub a0, a1
+  expect a0, -2
+  li a0, 0xff00ff00
+  li a1, 0x0ff00ff0
+  mv a2, a0
+  c.xor a2, a1
+  expect a2, 0xf0f0f0f0
+  mv a2, a0
+  c.or a2, a1
+  expect a2, 0xfff0fff0
+  mv a2, a0
+  c.and a2, a1
+  expect a2, 0x0f000f00
+  c.mv t3, a1
+  expect t3, 0x0ff00ff0
+  c.add t3, a0
+  expect t3, 0x0ef10ef0
+  c.add t3, t3
+  expect t3, 0x1de21de0
+  # s0 and s1 are the rest of the registers the compressed alu forms reach
+  li s0, 100
+  li s1, 58
+  c.sub s0, s1
+  expect s0, 42
+
+  # ---- loads and stores
+  la s1, buf
+  li a0, 0x11223344
+  li a1, 0x55667788
+  c.sw a0, 0(s1)
+  c.sw a1, 124(s1)
+  full lw t0, 0(s1)
+  expect t0, 0x11223344
+  full lw t0, 124(s1)
+  expect t0, 0x55667788
+  c.lw a2, 124(s1)
+  expect a2, 0x55667788
+  c.lw a3, 0(s1)
+  expect a3, 0x11223344
+  c.swsp a0, 0(sp)
+  c.swsp a1, 252(sp)
+  full lw t0, 252(sp)
+  expect t0, 0x55667788
+  c.lwsp t1, 0(sp)
+  expect t1, 0x11223344
+  c.lwsp t2, 252(sp)
+  expect t2, 0x55667788
+  # the float forms, through the integer registers
+  li a0, 0x3fc00000
+  fmv.w.x fa0, a0
+  c.fsw fa0, 120(s1)
+  full lw t0, 120(s1)
+  expect t0, 0x3fc00000
+  c.flw fa1, 120(s1)
+  fmv.x.w t0, fa1
+  expect t0, 0x3fc00000
+  c.fswsp fa0, 248(sp)
+  c.flwsp ft0, 248(sp)
+  fmv.x.w t0, ft0
+  expect t0, 0x3fc00000
+  li a0, 0x01234567
+  li a1, 0x89abcdef
+  sw a0, 0(s1)
+  sw a1, 4(s1)
+  full fld fa2, 0(s1)
+  c.fsd fa2, 248(s1)
+  full lw t0, 248(s1)
+  expect t0, 0x01234567
+  full lw t0, 252(s1)
+  expect t0, 0x89abcdef
+  c.fld fa3, 248(s1)
+  c.fsdsp fa3, 504(sp)
+  full lw t0, 508(sp)
+  expect t0, 0x89abcdef
+  c.fldsp fs0, 504(sp)
+  c.fsd fs0, 8(s1)
+  full lw t0, 8(s1)
+  expect t0, 0x01234567
+
+  # ---- link registers, compressed jumps link pc + 2 and full ones pc + 4
+  .p2align 2
+  c.jal cjal_target
+cjal_link:
+  j 1f
+cjal_target:
+  expect_at ra, cjal_link
+  c.jr ra
+1:
+  # a full size jal at a halfword address
+  .p2align 2
+  c.nop
+jal_at:
+  full jal ra, jal_target
+jal_link:
+  j 1f
+jal_target:
+  expect_at ra, jal_link
+  la t0, jal_link
+  la t1, jal_at
+  sub t0, t0, t1
+  expect t0, 4
+  la t0, jal_at
+  andi t0, t0, 3
+  expect t0, 2
+  ret
+1:
+  la t0, jalr_target
+  .p2align 2
+  c.jalr t0
+cjalr_link:
+  j 1f
+jalr_target:
+  # both jalr forms return here
+  mv s5, ra
+  jr ra
+1:
+  expect_at s5, cjalr_link
+  la t0, jalr_target
+  .p2align 2
+  c.nop
+  full jalr ra, 0(t0)
+jalr_link:
+  expect_at s5, jalr_link
+  # jalr to a halfword aligned target by its offset
+  la t0, half_target - 2
+  full jalr ra, 2(t0)
+  expect a0, 61
+  # c.jalr and c.jr through a register other than ra
+  la t1, link_t1
+  c.mv t2, t1
+  c.jr t2
+  c.li a0, 0
+link_t1:
+  c.li a0, 13
+  expect a0, 13
+
+  # ---- auipc at a halfword address, and after compressed code
+  .p2align 2
+  c.nop
+auipc_at:
+  auipc a0, 0
+  expect_at a0, auipc_at
+  c.addi a0, 1
+auipc_next:
+  auipc a1, 1
+  la t0, auipc_next + 0x1000
+  sub t0, a1, t0
+  expect t0, 0
+
+  # ---- c.j as far forward and back as it reaches
+  c.li a0, 0
+cj_fwd:
+  c.j cj_fwd_target
+  .skip 2044
+cj_fwd_target:
+  c.li a0, 19
+  expect a0, 19
+  la t0, cj_fwd_target
+  la t1, cj_fwd
+  sub t0, t0, t1
+  expect t0, 2046
+  c.li a0, 0
+  full j cj_back
+cj_back_target:
+  c.li a0, 17
+  full j cj_back_done
+  .skip 2042
+cj_back:
+  c.j cj_back_target
+cj_back_done:
+  expect a0, 17
+  la t0, cj_back
+  la t1, cj_back_target
+  sub t0, t0, t1
+  expect t0, 2048
+
+  # ---- c.beqz and c.bnez, taken as far as they reach and not taken
+  c.li a0, 0
+  c.li a1, 0
+cbeqz_fwd:
+  c.beqz a0, cbeqz_fwd_target
+  .skip 252
+cbeqz_fwd_target:
+  c.li a1, 23
+  expect a1, 23
+  la t0, cbeqz_fwd_target
+  la t1, cbeqz_fwd
+  sub t0, t0, t1
+  expect t0, 254
+  c.li a1, 0
+  c.li a0, 1
+cbnez_fwd:
+  c.bnez a0, cbnez_fwd_target
+  .skip 252
+cbnez_fwd_target:
+  c.li a1, 29
+  expect a1, 29
+  c.li a0, 0
+  c.li a1, 0
+  full j cbeqz_back
+cbeqz_back_target:
+  c.li a1, 31
+  full j cbeqz_back_done
+  .skip 250
+cbeqz_back:
+  c.beqz a0, cbeqz_back_target
+cbeqz_back_done:
+  expect a1, 31
+  la t0, cbeqz_back
+  la t1, cbeqz_back_target
+  sub t0, t0, t1
+  expect t0, 256
+  c.li a0, 5
+  c.li a1, 1
+  c.beqz a0, 1f
+  c.li a1, 2
+1:
+  expect a1, 2
+  c.li a0, 0
+  c.bnez a0, 1f
+  c.li a1, 3
+1:
+  expect a1, 3
+  c.li s1, 0
+  c.bnez s1, 1f
+  c.beqz s1, 2f
+1:
+  c.li s1, 9
+2:
+  expect s1, 0
+
+  # ---- a loop mixing the sizes, taken back to a halfword address
+  c.li a0, 0
+  li a1, 100
+  c.li a2, 0
+  .p2align 2
+  c.nop
+1:
+  c.addi a0, 3
+  full addi a2, a2, 1
+  c.addi a1, -1
+  c.bnez a1, 1b
+  expect a0, 300
+  expect a2, 100
+
+  # ---- a full size instruction over the chunk boundary
+  c.li a0, 1
+  full jal ra, straddle
+  expect a0, 0x101
+  la t0, straddle
+  expect t0, 0x1fffe
+
+  # ---- report
+  bnez s4, fail
+  la a0, msg_ok
+  jal ra, print_str
+  li a0, 0
+  li a7, SYS_exit
+  ecall
+fail:
+  la a0, msg_fail
+  jal ra, print_str
+  mv a0, s4
+  jal ra, print_uint
+  la a0, msg_of
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_nl
+  jal ra, print_str
+  li a0, 1
+  li a7, SYS_exit
+  ecall
+
+half_target:
+  c.nop
+  li a0, 61
+  ret
+
+# count a check, and a failure when t4 and t6 differ, writing the first few
+# as "check <n>: <got> <expected>".  returns to t5 with the other registers
+# as they were.
+check:
+  addi s3, s3, 1
+  bne t4, t6, 1f
+  jr t5
+1:
+  addi s4, s4, 1
+  addi sp, sp, -32
+  sw ra, 0(sp)
+  sw a0, 4(sp)
+  sw a1, 8(sp)
+  sw a2, 12(sp)
+  sw a7, 16(sp)
+  sw t0, 20(sp)
+  sw t1, 24(sp)
+  sw t2, 28(sp)
+  li t0, MAX_REPORT
+  bgtu s4, t0, 2f
+  la a0, msg_check
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_colon
+  jal ra, print_str
+  mv a0, t4
+  jal ra, print_hex
+  la a0, msg_space
+  jal ra, print_str
+  mv a0, t6
+  jal ra, print_hex
+  la a0, msg_nl
+  jal ra, print_str
+2:
+  lw ra, 0(sp)
+  lw a0, 4(sp)
+  lw a1, 8(sp)
+  lw a2, 12(sp)
+  lw a7, 16(sp)
+  lw t0, 20(sp)
+  lw t1, 24(sp)
+  lw t2, 28(sp)
+  addi sp, sp, 32
+  jr t5
+
+# write the string at a0 to stdout
+print_str:
+  mv a1, a0
+  mv a2, a0
+1:
+  lbu t0, 0(a2)
+  beqz t0, 2f
+  addi a2, a2, 1
+  j 1b
+2:
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout in decimal
+print_uint:
+  la a1, num_end
+  li t1, 10
+1:
+  remu t0, a0, t1
+  divu a0, a0, t1
+  addi t0, t0, '0'
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  bnez a0, 1b
+  la a2, num_end
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout as eight hex digits
+print_hex:
+  la a1, num_end
+  li t1, 8
+1:
+  andi t0, a0, 15
+  srli a0, a0, 4
+  addi t0, t0, '0'
+  li t2, '9'
+  bleu t0, t2, 2f
+  addi t0, t0, 'a' - '9' - 1
+2:
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  addi t1, t1, -1
+  bnez t1, 1b
+  li a2, 8
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+  # the last halfword of the first chunk, so the instruction's upper half is
+  # in the next one
+  .org 0xfffe
+straddle:
+  full addi a0, a0, 0x100
+  c.jr ra
+
+  .data
+  .p2align 3
+buf:       .skip 256
+num:       .skip 16
+num_end:
+           .skip 1024
+stack:     .skip 1024
+stack_top: .skip 1024
+
+msg_ok:    .asciz "rvc: ok\n"
+msg_fail:  .asciz "rvc: FAIL "
+msg_of:    .asciz " of "
+msg_check: .asciz "check "
+msg_colon: .asciz ": "
+msg_space: .asciz " "
+msg_nl:    .asciz "\n"
@@ -0,0 +1,925 @@
+#!/usr/bin/env python3
+# rvv_gen.py
+#
+#   Generates the vector guest test.  Each case loads v0, the register groups
+#   at v8, v16 and v24 and a scratch buffer from a pool of operand blocks,
+#   sets vtype and vl, calls a stub holding its instruction and checks the
+#   whole group at v24, vl, fflags and any scalar result against what is
+#   worked out here, with the float results from ../fp/fpref.py.
+#
+#   Unmasked cases with long enough groups run on the host simd kernels under
+#   the jit, and the rest element by element, as every case does under the
+#   interpreter.
+#
+#   Usage:
+#     python3 rvv_gen.py > rvv.s
+
+import os
+import random
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'fp'))
+from fpref import *  # noqa: E402
+
+VLEN = 128
+GROUP = VLEN // 8 * 8        # bytes in a group of eight registers
+RMODES = [RNE, RTZ, RDN, RUP, RMM]
+
+
+def sext(x, bits):
+    x &= (1 << bits) - 1
+    return x - (1 << bits) if x >> (bits - 1) else x
+
+
+def get(blk, i, sew):
+    n = sew // 8
+    return int.from_bytes(blk[i * n:(i + 1) * n], 'little')
+
+
+def put(blk, i, sew, x):
+    n = sew // 8
+    blk[i * n:(i + 1) * n] = (x & ((1 << sew) - 1)).to_bytes(n, 'little')
+
+
+def mask_bit(blk, i):
+    return (blk[i >> 3] >> (i & 7)) & 1
+
+
+def mask_put(blk, i, bit):
+    blk[i >> 3] = (blk[i >> 3] & ~(1 << (i & 7))) | (int(bool(bit)) << (i & 7))
+
+
+def vlmax(sew, lmul):
+    per = VLEN // sew
+    return per << lmul if lmul >= 0 else per >> -lmul
+
+
+def vtype(sew, lmul):
+    return ({8: 0, 16: 1, 32: 2}[sew] << 3) | (lmul & 7)
+
+
+# ---- operand blocks
+
+def make_pool(rng):
+    pool = {}
+
+    def block(vals):
+        blk = bytearray(GROUP)
+        for i, v in enumerate(vals):
+            put(blk, i, 32, v)
+        return blk
+
+    edges = [0x00, 0xff, 0x80, 0x7f, 0x01, 0xfe]
+    pool['rand0'] = bytearray(rng.getrandbits(8) for _ in range(GROUP))
+    pool['rand1'] = bytearray(rng.getrandbits(8) for _ in range(GROUP))
+    pool['edge'] = bytearray(rng.choice(edges + [rng.getrandbits(8)]) for _ in range(GROUP))
+    # small values, so divisors and shift amounts are often zero or tiny
+    pool['small'] = bytearray(rng.choice([0, 0, 1, 2, 3, 0xff]) for _ in range(GROUP))
+    specials = special_bits(SINGLE) + [0x7f800001 | 0x400000, 0x7fa00000, 0xff800000]
+    pool['fspec'] = block([rng.choice(specials) for _ in range(GROUP // 4)])
+    pool['frand0'] = block([random_float(rng) for _ in range(GROUP // 4)])
+    pool['frand1'] = block([random_float(rng) for _ in range(GROUP // 4)])
+    # pairs which sum, or multiply, to a tie
+    ta, tb = [], []
+    for _ in range(GROUP // 4):
+        a = random_float(rng) & ~SINGLE.sign
+        exp = max((a >> 23) - 24, 1)
+        ta.append(a | (rng.getrandbits(1) << 31))
+        tb.append((exp << 23) | (rng.getrandbits(1) << 31))
+    pool['tie0'] = block(ta)
+    pool['tie1'] = block(tb)
+    # an infinite times zero product in lane 5 or lane 30, and quiet nans to
+    # add to both
+    for n, lane in enumerate((5, 30)):
+        xs = [random_float(rng) & 0x3fffffff for _ in range(GROUP // 4)]
+        ys = [random_float(rng) & 0x3fffffff for _ in range(GROUP // 4)]
+        xs[lane], ys[lane] = SINGLE.inf, 0
+        pool[f'nv_x{n}'] = block(xs)
+        pool[f'nv_y{n}'] = block(ys)
+    zs = [random_float(rng) & 0x3fffffff for _ in range(GROUP // 4)]
+    zs[5] = zs[30] = SINGLE.qnan
+    pool['nv_z'] = block(zs)
+    pool['ints'] = block([rng.choice([0, 1, 3, 0x7fffffff, 0x80000000, 0xffffffff, 0x1000001,
+                                      0x1000003, 0xffffff80, rng.getrandbits(32)])
+                          for _ in range(GROUP // 4)])
+    # byte offsets into the scratch buffer, aligned for any element
+    for eew in (8, 16, 32):
+        blk = bytearray(GROUP)
+        for i in range(GROUP // (eew // 8)):
+            put(blk, i, eew, rng.randrange(0, GROUP // 4) * 4)
+        pool[f'idx{eew}'] = blk
+    pool['ones'] = bytearray([0xff] * GROUP)
+    pool['zeros'] = bytearray(GROUP)
+    pool['alt'] = bytearray([0x55] * GROUP)
+    return pool
+
+
+def random_float(rng):
+    if rng.random() < 0.7:
+        exp = rng.randint(127 - 20, 127 + 20)
+        return (rng.getrandbits(1) << 31) | (exp << 23) | rng.getrandbits(23)
+    return rng.getrandbits(32)
+
+
+def special_bits(f):
+    one = f.bias << f.frac_bits
+    return [0, f.sign, one, one | f.sign, f.inf, f.inf | f.sign, f.qnan, f.inf | 1,
+            1, f.max, 1 << f.frac_bits, one | (1 << (f.frac_bits - 1))]
+
+
+# ---- reference
+
+class State:
+    def __init__(self, sew, lmul, avl, masked, mask, a, b, d, scratch, x, frm):
+        self.sew = sew
+        self.lmul = lmul
+        self.vlmax = vlmax(sew, lmul)
+        self.vl = min(avl, self.vlmax)
+        self.masked = masked
+        self.mask = mask
+        self.a = a
+        self.b = b
+        self.d = bytearray(d)
+        self.scratch = bytearray(scratch)
+        self.x = x
+        self.frm = frm
+        self.flags = 0
+        self.int_result = None
+
+    def active(self, i):
+        return not self.masked or mask_bit(self.mask, i)
+
+    def scalar(self):
+        return self.x & ((1 << self.sew) - 1)
+
+
+def int_binary(fn):
+    def run(st, form):
+        for i in range(st.vl):
+            if st.active(i):
+                a = get(st.a, i, st.sew)
+                b = get(st.b, i, st.sew) if form == 'vv' else st.scalar()
+                put(st.d, i, st.sew, fn(a, b, get(st.d, i, st.sew), st.sew))
+    return run
+
+
+def div(a, b, sew):
+    sa, sb = sext(a, sew), sext(b, sew)
+    if b == 0:
+        return -1
+    if sa == -(1 << (sew - 1)) and sb == -1:
+        return a
+    q = abs(sa) // abs(sb)
+    return -q if (sa < 0) != (sb < 0) else q
+
+
+def rem(a, b, sew):
+    sa, sb = sext(a, sew), sext(b, sew)
+    if b == 0:
+        return a
+    if sa == -(1 << (sew - 1)) and sb == -1:
+        return 0
+    r = abs(sa) % abs(sb)
+    return -r if sa < 0 else r
+
+
+INT_OPS = {
+    'vadd':    lambda a, b, d, s: a + b,
+    'vsub':    lambda a, b, d, s: a - b,
+    'vrsub':   lambda a, b, d, s: b - a,
+    'vminu':   lambda a, b, d, s: min(a, b),
+    'vmin':    lambda a, b, d, s: a if sext(a, s) < sext(b, s) else b,
+    'vmaxu':   lambda a, b, d, s: max(a, b),
+    'vmax':    lambda a, b, d, s: a if sext(a, s) > sext(b, s) else b,
+    'vand':    lambda a, b, d, s: a & b,
+    'vor':     lambda a, b, d, s: a | b,
+    'vxor':    lambda a, b, d, s: a ^ b,
+    'vsll':    lambda a, b, d, s: a << (b & (s - 1)),
+    'vsrl':    lambda a, b, d, s: a >> (b & (s - 1)),
+    'vsra':    lambda a, b, d, s: sext(a, s) >> (b & (s - 1)),
+    'vmul':    lambda a, b, d, s: a * b,
+    'vmulh':   lambda a, b, d, s: (sext(a, s) * sext(b, s)) >> s,
+    'vmulhu':  lambda a, b, d, s: (a * b) >> s,
+    'vmulhsu': lambda a, b, d, s: (sext(a, s) * b) >> s,
+    'vdivu':   lambda a, b, d, s: a // b if b else -1,
+    'vdiv':    lambda a, b, d, s: div(a, b, s),
+    'vremu':   lambda a, b, d, s: a % b if b else a,
+    'vrem':    lambda a, b, d, s: rem(a, b, s),
+    'vmacc':   lambda a, b, d, s: d + a * b,
+    'vnmsac':  lambda a, b, d, s: d - a * b,
+    'vmadd':   lambda a, b, d, s: b * d + a,
+    'vnmsub':  lambda a, b, d, s: a - b * d,
+}
+
+INT_CMP = {
+    'vmseq':  lambda a, b, s: a == b,
+    'vmsne':  lambda a, b, s: a != b,
+    'vmsltu': lambda a, b, s: a < b,
+    'vmslt':  lambda a, b, s: sext(a, s) < sext(b, s),
+    'vmsleu': lambda a, b, s: a <= b,
+    'vmsle':  lambda a, b, s: sext(a, s) <= sext(b, s),
+    'vmsgtu': lambda a, b, s: a > b,
+    'vmsgt':  lambda a, b, s: sext(a, s) > sext(b, s),
+}
+
+INT_RED = {
+    'vredsum':  lambda acc, x, s: acc + x,
+    'vredand':  lambda acc, x, s: acc & x,
+    'vredor':   lambda acc, x, s: acc | x,
+    'vredxor':  lambda acc, x, s: acc ^ x,
+    'vredminu': lambda acc, x, s: min(acc, x),
+    'vredmin':  lambda acc, x, s: x if sext(x, s) < sext(acc, s) else acc,
+    'vredmaxu': lambda acc, x, s: max(acc, x),
+    'vredmax':  lambda acc, x, s: x if sext(x, s) > sext(acc, s) else acc,
+}
+
+MASK_OPS = {
+    'vmandn': lambda x, y: x and not y,
+    'vmand':  lambda x, y: x and y,
+    'vmor':   lambda x, y: x or y,
+    'vmxor':  lambda x, y: x != y,
+    'vmorn':  lambda x, y: x or not y,
+    'vmnand': lambda x, y: not (x and y),
+    'vmnor':  lambda x, y: not (x or y),
+    'vmxnor': lambda x, y: x == y,
+}
+
+
+def neg(x):
+    return x if is_nan(SINGLE, x) else x ^ SINGLE.sign
+
+
+def fma(m, a, b, c):
+    return arith(SINGLE, 'fma', m, a, b, c)
+
+
+# the float operations on a (vs2), b (vs1 or the scalar) and d
+FP_OPS = {
+    'vfadd':   lambda m, a, b, d: arith(SINGLE, 'add', m, a, b),
+    'vfsub':   lambda m, a, b, d: arith(SINGLE, 'sub', m, a, b),
+    'vfrsub':  lambda m, a, b, d: arith(SINGLE, 'sub', m, b, a),
+    'vfmul':   lambda m, a, b, d: arith(SINGLE, 'mul', m, a, b),
+    'vfdiv':   lambda m, a, b, d: arith(SINGLE, 'div', m, a, b),
+    'vfrdiv':  lambda m, a, b, d: arith(SINGLE, 'div', m, b, a),
+    'vfmin':   lambda m, a, b, d: minmax(SINGLE, a, b, False),
+    'vfmax':   lambda m, a, b, d: minmax(SINGLE, a, b, True),
+    'vfsgnj':  lambda m, a, b, d: ((a & ~SINGLE.sign) | (b & SINGLE.sign), 0),
+    'vfsgnjn': lambda m, a, b, d: ((a & ~SINGLE.sign) | (~b & SINGLE.sign), 0),
+    'vfsgnjx': lambda m, a, b, d: (a ^ (b & SINGLE.sign), 0),
+    'vfmacc':  lambda m, a, b, d: fma(m, b, a, d),
+    'vfnmacc': lambda m, a, b, d: fma(m, neg(b), a, neg(d)),
+    'vfmsac':  lambda m, a, b, d: fma(m, b, a, neg(d)),
+    'vfnmsac': lambda m, a, b, d: fma(m, neg(b), a, d),
+    'vfmadd':  lambda m, a, b, d: fma(m, b, d, a),
+    'vfnmadd': lambda m, a, b, d: fma(m, neg(b), d, neg(a)),
+    'vfmsub':  lambda m, a, b, d: fma(m, b, d, neg(a)),
+    'vfnmsub': lambda m, a, b, d: fma(m, neg(b), d, a),
+}
+
+FP_UNARY = {
+    'vfsqrt.v':          lambda m, a: arith(SINGLE, 'sqrt', m, a),
+    'vfclass.v':         lambda m, a: (fclass(SINGLE, a), 0),
+    'vfcvt.xu.f.v':      lambda m, a: fcvt_w(SINGLE, a, m, True),
+    'vfcvt.x.f.v':       lambda m, a: fcvt_w(SINGLE, a, m, False),
+    'vfcvt.rtz.xu.f.v':  lambda m, a: fcvt_w(SINGLE, a, RTZ, True),
+    'vfcvt.rtz.x.f.v':   lambda m, a: fcvt_w(SINGLE, a, RTZ, False),
+    'vfcvt.f.xu.v':      lambda m, a: fcvt_from_w(SINGLE, a, m, True),
+    'vfcvt.f.x.v':       lambda m, a: fcvt_from_w(SINGLE, a, m, False),
+}
+
+FP_CMP = {
+    'vmfeq': lambda a, b: compare(SINGLE, a, b, 'eq'),
+    'vmfne': lambda a, b: (lambda r: (1 - r[0], r[1]))(compare(SINGLE, a, b, 'eq')),
+    'vmflt': lambda a, b: compare(SINGLE, a, b, 'lt'),
+    'vmfle': lambda a, b: compare(SINGLE, a, b, 'le'),
+    'vmfgt': lambda a, b: compare(SINGLE, b, a, 'lt'),
+    'vmfge': lambda a, b: compare(SINGLE, b, a, 'le'),
+}
+
+
+def fp_binary(fn):
+    def run(st, form):
+        for i in range(st.vl):
+            if st.active(i):
+                a = get(st.a, i, 32)
+                b = get(st.b, i, 32) if form == 'vv' else st.x
+                r, fl = fn(st.frm, a, b, get(st.d, i, 32))
+                put(st.d, i, 32, r)
+                st.flags |= fl
+    return run
+
+
+def fp_unary(fn):
+    def run(st, form):
+        for i in range(st.vl):
+            if st.active(i):
+                r, fl = fn(st.frm, get(st.a, i, 32))
+                put(st.d, i, 32, r)
+                st.flags |= fl
+    return run
+
+
+def compare_run(fn, fp):
+    def run(st, form):
+        for i in range(st.vl):
+            if st.active(i):
+                a = get(st.a, i, st.sew)
+                b = get(st.b, i, st.sew) if form == 'vv' else st.scalar()
+                if fp:
+                    r, fl = fn(a, b)
+                    st.flags |= fl
+                else:
+                    r = fn(a, b, st.sew)
+                mask_put(st.d, i, r)
+    return run
+
+
+def merge_run(st, form):
+    for i in range(st.vl):
+        b = get(st.b, i, st.sew) if form == 'vv' else st.scalar()
+        put(st.d, i, st.sew, b if st.active(i) else get(st.a, i, st.sew))
+
+
+def int_reduce(fn):
+    def run(st, form):
+        if st.vl:
+            acc = get(st.b, 0, st.sew)
+            for i in range(st.vl):
+                if st.active(i):
+                    acc = fn(acc, get(st.a, i, st.sew), st.sew)
+            put(st.d, 0, st.sew, acc)
+    return run
+
+
+def fp_reduce(kind):
+    def run(st, form):
+        if st.vl:
+            acc = get(st.b, 0, 32)
+            for i in range(st.vl):
+                if st.active(i):
+                    x = get(st.a, i, 32)
+                    if kind == 'sum':
+                        acc, fl = arith(SINGLE, 'add', st.frm, acc, x)
+                    else:
+                        acc, fl = minmax(SINGLE, acc, x, kind == 'max')
+                    st.flags |= fl
+            put(st.d, 0, 32, acc)
+    return run
+
+
+def slide_run(up):
+    def run(st, form):
+        off = st.x if form == 'vx' else st.imm
+        for i in range(st.vl):
+            if not st.active(i):
+                continue
+            if up:
+                if i >= off:
+                    put(st.d, i, st.sew, get(st.a, i - off, st.sew))
+            else:
+                src = i + off
+                put(st.d, i, st.sew, get(st.a, src, st.sew) if src < st.vlmax else 0)
+    return run
+
+
+def vid_run(st, form):
+    for i in range(st.vl):
+        if st.active(i):
+            put(st.d, i, st.sew, i)
+
+
+def mask_logic(fn):
+    def run(st, form):
+        for i in range(st.vl):
+            mask_put(st.d, i, fn(mask_bit(st.a, i), mask_bit(st.b, i)))
+    return run
+
+
+def cpop_run(st, form):
+    st.int_result = sum(1 for i in range(st.vl) if st.active(i) and mask_bit(st.a, i))
+
+
+def first_run(st, form):
+    st.int_result = next((i for i in range(st.vl) if st.active(i) and mask_bit(st.a, i)), 0xffffffff)
+
+
+def mv_xs_run(st, form):
+    st.int_result = sext(get(st.a, 0, st.sew), st.sew) & 0xffffffff
+
+
+def mv_sx_run(st, form):
+    if st.vl:
+        put(st.d, 0, st.sew, st.x)
+
+
+def fmv_fs_run(st, form):
+    st.int_result = get(st.a, 0, 32)
+
+
+def load_run(eew, mode):
+    """unit stride, strided or indexed loads into v24 from the scratch buffer
+    at a0, with a3 the stride and v8 the indices"""
+    def run(st, form):
+        sew = st.sew if mode == 'index' else eew
+        for i in range(st.vl):
+            if st.active(i):
+                if mode == 'unit':
+                    at = i * (sew // 8)
+                elif mode == 'stride':
+                    at = i * st.x
+                else:
+                    at = get(st.a, i, eew)
+                put(st.d, i, sew, get(st.scratch[at:], 0, sew))
+    return run
+
+
+def store_run(eew, mode):
+    """stores of v8 to the scratch buffer, with v16 the indices, which the
+    stub then loads back into v24"""
+    def run(st, form):
+        sew = st.sew if mode == 'index' else eew
+        for i in range(st.vl):
+            if st.active(i):
+                if mode == 'unit':
+                    at = i * (sew // 8)
+                elif mode == 'stride':
+                    at = i * st.x
+                else:
+                    at = get(st.b, i, eew)
+                st.scratch[at:at + sew // 8] = get(st.a, i, sew).to_bytes(sew // 8, 'little')
+        st.d = bytearray(st.scratch)
+    return run
+
+
+def mask_load_run(st, form):
+    for i in range((st.vl + 7) // 8):
+        st.d[i] = st.scratch[i]
+
+
+def mask_store_run(st, form):
+    for i in range((st.vl + 7) // 8):
+        st.scratch[i] = st.a[i]
+    st.d = bytearray(st.scratch)
+
+
+# ---- cases
+
+class Case:
+    def __init__(self, inst, st, blocks, avl):
+        self.inst = inst
+        self.st = st
+        self.blocks = blocks
+        self.avl = avl
+
+
+def vls(rng, sew, lmul):
+    """vl of zero, an odd length and vlmax from an avl past it for the
+    groups of eight, and one of those or one for the rest"""
+    top = vlmax(sew, lmul)
+    odd = rng.choice([n for n in (1, 3, 5, 7, 9, 13, 17, 31, 33, 63, 127) if n < top])
+    if lmul == 3:
+        return [0, odd, top + rng.randint(0, 100)]
+    return [rng.choice([0, 1, odd, top])]
+
+
+def add_cases(out, rng, pool, inst, run, form, sews, lmuls, blocks, masked_too=True, x=None,
+              imm=None, frm=None, fixed_vl=None):
+    for sew in sews:
+        for lmul in lmuls:
+            if lmul < 0 and (sew << -lmul) > 32:
+                continue
+            for avl in (fixed_vl or vls(rng, sew, lmul)):
+                for masked in ((False, True) if masked_too else (False,)):
+                    blk = [rng.choice(b) if isinstance(b, list) else b for b in blocks]
+                    mode = rng.choice(RMODES) if frm is None else frm
+                    xv = rng.getrandbits(32) if x is None else (x() if callable(x) else x)
+                    st = State(sew, lmul, avl, masked, pool[blk[0]], pool[blk[1]], pool[blk[2]],
+                               pool[blk[3]], pool[blk[2]], xv, mode)
+                    st.imm = imm
+                    run(st, form)
+                    first, _, rest = inst.partition('\n')
+                    text = first + (', v0.t' if masked else '') + (_ + rest)
+                    out.append(Case(text, st, blk, avl))
+
+
+def cases():
+    rng = random.Random(25)
+    pool = make_pool(rng)
+    masks = ['rand0', 'rand1', 'alt']
+    ints = ['rand0', 'rand1', 'edge', 'small']
+    out = []
+    lmuls = [3, 0, -1]
+    imm_ops = {'vadd', 'vrsub', 'vand', 'vor', 'vxor', 'vsll', 'vsrl', 'vsra'}
+    vx_only = {'vrsub'}
+    madd = {'vmacc', 'vnmsac', 'vmadd', 'vnmsub'}
+    for name, fn in INT_OPS.items():
+        run = int_binary(fn)
+        blocks = [masks, ints, ints, ints]
+        if name not in vx_only:
+            # the multiply adds name vs1 before vs2
+            text = f'{name}.vv v24, v16, v8' if name in madd else f'{name}.vv v24, v8, v16'
+            add_cases(out, rng, pool, text, run, 'vv', (8, 16, 32), lmuls, blocks)
+        text = f'{name}.vx v24, a3, v8' if name in madd else f'{name}.vx v24, v8, a3'
+        add_cases(out, rng, pool, text, run, 'vx', (8, 16, 32), [3], blocks,
+                  x=lambda: rng.choice([0, 1, 7, 31, 33, 0xff, 0x8000, 0xffffffff, rng.getrandbits(32)]))
+        if name in imm_ops:
+            for imm in ((-16, 15, 0) if name not in ('vsll', 'vsrl', 'vsra') else (0, 7, 31)):
+                add_cases(out, rng, pool, f'{name}.vi v24, v8, {imm}', run, 'vx', (8, 32), [3],
+                          blocks, x=imm & 0xffffffff, fixed_vl=[rng.choice([5, 17, 127])])
+    for name, fn in INT_CMP.items():
+        run = compare_run(fn, False)
+        blocks = [masks, ints, ints, ints]
+        if name not in ('vmsgtu', 'vmsgt'):
+            add_cases(out, rng, pool, f'{name}.vv v24, v8, v16', run, 'vv', (8, 16, 32), [3, 0], blocks)
+        add_cases(out, rng, pool, f'{name}.vx v24, v8, a3', run, 'vx', (8, 32), [3], blocks,
+                  x=lambda: rng.choice([0, 1, 0x7f, 0x80, 0xffffffff, rng.getrandbits(32)]))
+        if name not in ('vmsltu', 'vmslt'):
+            add_cases(out, rng, pool, f'{name}.vi v24, v8, -1', compare_run(fn, False), 'vx', (16,),
+                      [3], blocks, x=0xffffffff, fixed_vl=[33])
+    # merges, and the unmasked forms which are moves
+    blocks = [masks, ints, ints, ints]
+    for sew in (8, 16, 32):
+        for avl in vls(rng, sew, 3):
+            blk = [rng.choice(masks), rng.choice(ints), rng.choice(ints), rng.choice(ints)]
+            for text, form, x in (('vmerge.vvm v24, v8, v16, v0', 'vv', 0),
+                                  ('vmerge.vxm v24, v8, a3, v0', 'vx', rng.getrandbits(32)),
+                                  ('vmerge.vim v24, v8, -7, v0', 'vx', 0xfffffff9)):
+                st = State(sew, 3, avl, True, pool[blk[0]], pool[blk[1]], pool[blk[2]], pool[blk[3]],
+                           pool[blk[2]], x, RNE)
+                merge_run(st, form)
+                out.append(Case(text, st, blk, avl))
+            for text, form, x in (('vmv.v.v v24, v16', 'vv', 0), ('vmv.v.x v24, a3', 'vx', rng.getrandbits(32)),
+                                  ('vmv.v.i v24, -3', 'vx', 0xfffffffd)):
+                st = State(sew, 3, avl, False, pool[blk[0]], pool[blk[1]], pool[blk[2]], pool[blk[3]],
+                           pool[blk[2]], x, RNE)
+                merge_run(st, form)
+                out.append(Case(text, st, blk, avl))
+    for name, fn in INT_RED.items():
+        add_cases(out, rng, pool, f'{name}.vs v24, v8, v16', int_reduce(fn), 'vv', (8, 16, 32), [3, 0],
+                  blocks)
+    for name, fn in MASK_OPS.items():
+        add_cases(out, rng, pool, f'{name}.mm v24, v8, v16', mask_logic(fn), 'vv', (8,), [3], blocks,
+                  masked_too=False)
+    add_cases(out, rng, pool, 'vid.v v24', vid_run, 'vv', (8, 16, 32), [3, 0], blocks)
+    for up, name in ((True, 'vslideup'), (False, 'vslidedown')):
+        add_cases(out, rng, pool, f'{name}.vx v24, v8, a3', slide_run(up), 'vx', (8, 32), [3, 0], blocks,
+                  x=lambda: rng.choice([0, 1, 3, 17, 200, 0xffffffff]))
+        add_cases(out, rng, pool, f'{name}.vi v24, v8, 5', slide_run(up), 'vi', (16,), [3], blocks, imm=5)
+    add_cases(out, rng, pool, 'vcpop.m a2, v8', cpop_run, 'vv', (8,), [3, 0], blocks)
+    add_cases(out, rng, pool, 'vfirst.m a2, v8', first_run, 'vv', (8,), [3, 0], [masks, 'zeros', ints, ints])
+    add_cases(out, rng, pool, 'vfirst.m a2, v8', first_run, 'vv', (32,), [0], blocks)
+    add_cases(out, rng, pool, 'vmv.x.s a2, v8', mv_xs_run, 'vv', (8, 16, 32), [3], blocks, masked_too=False)
+    add_cases(out, rng, pool, 'vmv.s.x v24, a3', mv_sx_run, 'vx', (8, 16, 32), [3], blocks, masked_too=False)
+
+    # loads and stores through the scratch buffer, a copy of the vs1 block
+    for eew in (8, 16, 32):
+        add_cases(out, rng, pool, f'vle{eew}.v v24, (a0)', load_run(eew, 'unit'), 'vv', (eew,), [3, 0],
+                  blocks)
+        add_cases(out, rng, pool, f'vse{eew}.v v8, (a0)\n  vl8re8.v v24, (a0)', store_run(eew, 'unit'), 'vv',
+                  (eew,), [3, 0], blocks)
+        add_cases(out, rng, pool, f'vlse{eew}.v v24, (a0), a3', load_run(eew, 'stride'), 'vx', (eew,), [0],
+                  blocks, x=lambda: rng.choice([0, eew // 8, eew // 4 * 3]))
+        add_cases(out, rng, pool, f'vsse{eew}.v v8, (a0), a3\n  vl8re8.v v24, (a0)', store_run(eew, 'stride'),
+                  'vx', (eew,), [0], blocks, x=lambda: rng.choice([0, eew // 8 * 2]))
+        add_cases(out, rng, pool, f'vluxei{eew}.v v24, (a0), v8', load_run(eew, 'index'), 'vv', (8, 32), [0],
+                  [masks, f'idx{eew}', ints, ints])
+        add_cases(out, rng, pool, f'vsuxei{eew}.v v8, (a0), v16\n  vl8re8.v v24, (a0)', store_run(eew, 'index'),
+                  'vv', (8, 32), [0], [masks, ints, f'idx{eew}', ints])
+    add_cases(out, rng, pool, 'vlm.v v24, (a0)', mask_load_run, 'vv', (8,), [3], blocks, masked_too=False)
+    add_cases(out, rng, pool, 'vsm.v v8, (a0)\n  vl8re8.v v24, (a0)', mask_store_run, 'vv', (8,), [3],
+              blocks, masked_too=False)
+
+    # float operations, all with 32 bit elements
+    floats = ['fspec', 'frand0', 'frand1']
+    scalars = [0, 0x80000000, 0x3f800000, 0x7f800000, 0xff800000, 0x7fc00000, 0x7f800001, 0x00000001,
+               0x40490fdb, 0xc0000000]
+    fx = lambda: rng.choice(scalars + [random_float(rng)])
+    kernel = {'vfadd', 'vfsub', 'vfmul', 'vfdiv'}
+    madd = {'vfmacc', 'vfnmacc', 'vfmsac', 'vfnmsac', 'vfmadd', 'vfnmadd', 'vfmsub', 'vfnmsub'}
+    for name, fn in FP_OPS.items():
+        run = fp_binary(fn)
+        blocks = [masks, floats, floats, floats]
+        if name not in ('vfrsub', 'vfrdiv'):
+            text = f'{name}.vv v24, v16, v8' if name in madd else f'{name}.vv v24, v8, v16'
+            add_cases(out, rng, pool, text, run, 'vv', (32,), [3, 0], blocks)
+            # every rounding mode over the kernel sized groups, and ties
+            if name in kernel or name in madd:
+                for mode in RMODES:
+                    add_cases(out, rng, pool, text, run, 'vv', (32,), [3],
+                              [masks, 'tie0', 'tie1', floats], masked_too=False, frm=mode, fixed_vl=[32])
+        text = f'{name}.vf v24, fa0, v8' if name in madd else f'{name}.vf v24, v8, fa0'
+        add_cases(out, rng, pool, text, run, 'vx', (32,), [3], blocks, x=fx)
+    # an infinite times zero product with a quiet nan addend is invalid
+    for n in range(2):
+        for name in ('vfmacc', 'vfnmsac', 'vfmsac', 'vfnmacc'):
+            add_cases(out, rng, pool, f'{name}.vv v24, v16, v8', fp_binary(FP_OPS[name]), 'vv', (32,), [3],
+                      ['rand0', f'nv_x{n}', f'nv_y{n}', 'nv_z'], masked_too=False, fixed_vl=[32, 9])
+        for name in ('vfmadd', 'vfnmsub', 'vfmsub', 'vfnmadd'):
+            add_cases(out, rng, pool, f'{name}.vv v24, v16, v8', fp_binary(FP_OPS[name]), 'vv', (32,), [3],
+                      ['rand0', 'nv_z', f'nv_y{n}', f'nv_x{n}'], masked_too=False, fixed_vl=[32, 9])
+    for name, fn in FP_UNARY.items():
+        blk = 'ints' if '.f.x' in name else floats
+        add_cases(out, rng, pool, f'{name} v24, v8', fp_unary(fn), 'vv', (32,), [3, 0],
+                  [masks, blk, floats, floats])
+    for name, fn in FP_CMP.items():
+        run = compare_run(fn, True)
+        if name not in ('vmfgt', 'vmfge'):
+            add_cases(out, rng, pool, f'{name}.vv v24, v8, v16', run, 'vv', (32,), [3, 0],
+                      [masks, floats, floats, ints])
+        add_cases(out, rng, pool, f'{name}.vf v24, v8, fa0', run, 'vx', (32,), [3],
+                  [masks, floats, floats, ints], x=fx)
+    for name, kind in (('vfredusum', 'sum'), ('vfredosum', 'sum'), ('vfredmin', 'min'), ('vfredmax', 'max')):
+        add_cases(out, rng, pool, f'{name}.vs v24, v8, v16', fp_reduce(kind), 'vv', (32,), [3, 0],
+                  [masks, floats, floats, floats])
+    for avl in vls(rng, 32, 3):
+        blk = [rng.choice(masks), 'frand0', 'frand1', 'fspec']
+        x = fx()
+        st = State(32, 3, avl, True, pool[blk[0]], pool[blk[1]], pool[blk[2]], pool[blk[3]], pool[blk[2]], x, RNE)
+        merge_run(st, 'vx')
+        out.append(Case('vfmerge.vfm v24, v8, fa0, v0', st, blk, avl))
+        st = State(32, 3, avl, False, pool[blk[0]], pool[blk[1]], pool[blk[2]], pool[blk[3]], pool[blk[2]], x, RNE)
+        merge_run(st, 'vx')
+        out.append(Case('vfmv.v.f v24, fa0', st, blk, avl))
+    add_cases(out, rng, pool, 'vfmv.f.s fa1, v8\n  fmv.x.w a2, fa1', fmv_fs_run, 'vv', (32,), [3],
+              [masks, floats, floats, floats], masked_too=False)
+    add_cases(out, rng, pool, 'vfmv.s.f v24, fa0', mv_sx_run, 'vx', (32,), [3],
+              [masks, floats, floats, floats], masked_too=False, x=fx)
+    return pool, out
+
+
+RUNNER = '''\
+  .equ CASE_SIZE,        176
+  .equ MAX_REPORT,       16
+
+  .equ SYS_write,        64
+  .equ SYS_exit,         93
+
+  .text
+  .globl _start
+_start:
+  la s0, cases
+  la s1, cases_end
+  la s2, ops
+  la s5, pool
+  li s3, 0                  # case number
+  li s4, 0                  # failures
+next:
+  bgeu s0, s1, done
+  # v0 and the groups at v8, v16 and v24, and the scratch buffer a copy of
+  # the group at v16
+  lw t0, 32(s0)
+  add t0, s5, t0
+  vl1re8.v v0, (t0)
+  lw t0, 36(s0)
+  add t0, s5, t0
+  vl8re8.v v8, (t0)
+  lw t0, 40(s0)
+  add t0, s5, t0
+  vl8re8.v v16, (t0)
+  lw t0, 44(s0)
+  add t0, s5, t0
+  vl8re8.v v24, (t0)
+  la a0, scratch
+  vs8r.v v16, (a0)
+  # the scalar operand, as an integer and as a float, and frm
+  lw a3, 12(s0)
+  flw fa0, 12(s0)
+  lw t0, 16(s0)
+  fsrm t0
+  lw t1, 4(s0)
+  lw t2, 8(s0)
+  vsetvl s6, t2, t1
+  # integer results which are not written show up as this
+  li a2, 0x5a5a5a5a
+  lw t0, 0(s0)
+  add t0, s2, t0
+  fsflags zero
+  jalr ra, t0
+  frflags s7
+  la t0, result
+  vs8r.v v24, (t0)
+  # compare vl, fflags, the integer result and the group at v24, word by word
+  li s8, 0
+  lw t0, 20(s0)
+  mv t1, s6
+  bne t0, t1, 2f
+  li s8, 1
+  lw t0, 24(s0)
+  mv t1, s7
+  bne t0, t1, 2f
+  li s8, 2
+  lw t0, 28(s0)
+  mv t1, a2
+  bne t0, t1, 2f
+  addi t2, s0, 48
+  la t3, result
+  li s8, 3
+1:
+  lw t0, 0(t2)
+  lw t1, 0(t3)
+  bne t0, t1, 2f
+  addi t2, t2, 4
+  addi t3, t3, 4
+  addi s8, s8, 1
+  li t0, 3 + 32
+  bltu s8, t0, 1b
+  j 3f
+2:
+  jal ra, report
+3:
+  addi s0, s0, CASE_SIZE
+  addi s3, s3, 1
+  j next
+done:
+  bnez s4, fail
+  la a0, msg_ok
+  jal ra, print_str
+  li a0, 0
+  li a7, SYS_exit
+  ecall
+fail:
+  la a0, msg_fail
+  jal ra, print_str
+  mv a0, s4
+  jal ra, print_uint
+  la a0, msg_of
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_nl
+  jal ra, print_str
+  li a0, 1
+  li a7, SYS_exit
+  ecall
+
+# count a failure and write the first few as "case <n>: <word> <got> <expected>"
+# where word 0 is vl, 1 fflags, 2 the integer result and 3 on the group at v24
+report:
+  addi s4, s4, 1
+  li t2, MAX_REPORT
+  bgtu s4, t2, 1f
+  mv s9, ra
+  mv s10, t0
+  mv s11, t1
+  la a0, msg_case
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_colon
+  jal ra, print_str
+  mv a0, s8
+  jal ra, print_uint
+  la a0, msg_space
+  jal ra, print_str
+  mv a0, s11
+  jal ra, print_hex
+  la a0, msg_space
+  jal ra, print_str
+  mv a0, s10
+  jal ra, print_hex
+  la a0, msg_nl
+  jal ra, print_str
+  mv ra, s9
+1:
+  ret
+
+# write the string at a0 to stdout
+print_str:
+  mv a1, a0
+  mv a2, a0
+1:
+  lbu t0, 0(a2)
+  beqz t0, 2f
+  addi a2, a2, 1
+  j 1b
+2:
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout in decimal
+print_uint:
+  la a1, num_end
+  li t1, 10
+1:
+  remu t0, a0, t1
+  divu a0, a0, t1
+  addi t0, t0, '0'
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  bnez a0, 1b
+  la a2, num_end
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout as eight hex digits
+print_hex:
+  la a1, num_end
+  li t1, 8
+1:
+  andi t0, a0, 15
+  srli a0, a0, 4
+  addi t0, t0, '0'
+  li t2, '9'
+  bleu t0, t2, 2f
+  addi t0, t0, 'a' - '9' - 1
+2:
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  addi t1, t1, -1
+  bnez t1, 1b
+  li a2, 8
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+'''
+
+
+def words(blk):
+    return [get(blk, i, 32) for i in range(len(blk) // 4)]
+
+
+def emit(pool, cases):
+    out = []
+    w = out.append
+    w('# rvv.s')
+    w('#')
+    w('#   Generated by rvv_gen.py, do not edit.')
+    w('#')
+    w('#   The vector instructions under odd vl, vl of 0 and vl past vlmax, with')
+    w('#   and without a mask, over whole register groups the jit hands to the')
+    w('#   host simd kernels and fractional ones it does not, and with every')
+    w('#   rounding mode.  Run with --no-host-ext to check the sse2 kernels.')
+    w('#')
+    w('#   Build:')
+    w('#     python3 rvv_gen.py > rvv.s')
+    w('#     llvm-mc -triple=riscv32 -mattr=+m,+f,+zve32f,-relax -filetype=obj \\')
+    w('#       rvv.s -o rvv.o')
+    w('#     ld.lld -Ttext=0x10000 rvv.o -o rvv.elf')
+    w('')
+    w(RUNNER)
+    # one stub per distinct instruction sequence, each sixteen bytes
+    stubs = {}
+    for case in cases:
+        stubs.setdefault(case.inst, len(stubs) * 16)
+    w('  .p2align 4')
+    w('ops:')
+    for inst in stubs:
+        w('  .p2align 4')
+        w(f'  {inst}')
+        w('  ret')
+    w('')
+    w('  .data')
+    w('  .p2align 4')
+    names = list(pool)
+    w('pool:')
+    for name in names:
+        w(f'# {name}')
+        ws = words(pool[name])
+        for i in range(0, len(ws), 8):
+            w('  .word ' + ', '.join(f'0x{x:x}' for x in ws[i:i + 8]))
+    w('scratch:   .skip 128')
+    w('result:    .skip 128')
+    w('num:       .skip 16')
+    w('num_end:')
+    w('')
+    w('# stub offset, vtype, avl, scalar, frm, vl, fflags, integer result, the')
+    w('# pool offsets of v0, v8, v16 and v24, and the group expected at v24')
+    w('  .p2align 2')
+    w('cases:')
+    for case in cases:
+        st = case.st
+        ir = 0x5a5a5a5a if st.int_result is None else st.int_result
+        head = [stubs[case.inst], vtype(st.sew, st.lmul), case.avl & 0xffffffff, st.x & 0xffffffff, st.frm,
+                st.vl, st.flags, ir] + [names.index(b) * GROUP for b in case.blocks]
+        w('  .word ' + ', '.join(f'0x{x:x}' for x in head))
+        ws = words(st.d)
+        for i in range(0, len(ws), 8):
+            w('  .word ' + ', '.join(f'0x{x:x}' for x in ws[i:i + 8]))
+    w('cases_end:')
+    w('')
+    w('msg_ok:    .asciz "rvv: ok\\n"')
+    w('msg_fail:  .asciz "rvv: FAIL "')
+    w('msg_of:    .asciz " of "')
+    w('msg_case:  .asciz "case "')
+    w('msg_colon: .asciz ": "')
+    w('msg_space: .asciz " "')
+    w('msg_nl:    .asciz "\\n"')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    if len(sys.argv) != 1:
+        sys.exit('usage: rvv_gen.py')
+    pool, out = cases()
+    sys.stdout.write(emit(pool, out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,107 @@
+# trace_side_exit.s
+#
+#   Regression test for looping traces.  Makes a loop hot enough to be traced
+#   along the path that writes a2, then enters it so that the first guard
+#   exits the trace before a2 is written.  The side exit must leave a2 holding
+#   the value it had on entry.
+#
+#   Build:
+#     llvm-mc -triple=riscv32 -mattr=+m,-relax -filetype=obj \
+#       trace_side_exit.s -o trace_side_exit.o
+#     ld.lld -Ttext=0x10000 trace_side_exit.o -o trace_side_exit.elf
+
+  .equ WARM_ITERS,       4096
+  .equ ROUNDS,           40
+  .equ SENTINEL,         0x5a5a
+  .equ NUM_END,          0x20200
+
+  .equ SYS_write,        64
+  .equ SYS_exit,         93
+
+  .text
+  .globl _start
+_start:
+  li s0, ROUNDS
+  li s1, 0                  # failures
+round:
+  # warm up along the path which writes a2
+  li a0, WARM_ITERS
+  li a1, 0
+  li a2, 0
+  jal ra, kernel
+  # take the guard on the first iteration
+  li a0, WARM_ITERS
+  li a1, 1
+  li a2, SENTINEL
+  jal ra, kernel
+  li t0, SENTINEL
+  beq a2, t0, 1f
+  addi s1, s1, 1
+1:
+  addi s0, s0, -1
+  bnez s0, round
+  bnez s1, fail
+  la a0, msg_ok
+  jal ra, print_str
+  li a0, 0
+  li a7, SYS_exit
+  ecall
+fail:
+  la a0, msg_fail
+  jal ra, print_str
+  mv a0, s1
+  jal ra, print_uint
+  la a0, msg_of
+  jal ra, print_str
+  li a0, 1
+  li a7, SYS_exit
+  ecall
+
+# loop a0 times writing 2*a1 to a2, leaving early when a1 is 1
+kernel:
+  li t0, 1
+  beq a1, t0, 2f
+  mv a2, a1
+  add a2, a2, a2
+  addi a0, a0, -1
+  bnez a0, kernel
+2:
+  ret
+
+# write the string at a0 to stdout
+print_str:
+  mv a1, a0
+  mv a2, a0
+1:
+  lbu t0, 0(a2)
+  beqz t0, 2f
+  addi a2, a2, 1
+  j 1b
+2:
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout in decimal
+print_uint:
+  li a1, NUM_END
+  li t1, 10
+1:
+  remu t0, a0, t1
+  divu a0, a0, t1
+  addi t0, t0, '0'
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  bnez a0, 1b
+  li a2, NUM_END
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+msg_ok:    .asciz "trace side exit: ok\n"
+msg_fail:  .asciz "trace side exit: FAIL "
+msg_of:    .asciz " of 40\n"
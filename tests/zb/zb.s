@@ -0,0 +1,9301 @@
+# zb.s
+#
+#   Generated by zb_gen.py, do not edit.
+#
+#   Zba, Zbb and Zbs instructions on edge values, with shift amounts
+#   past 31, the result written over a source and the zero register as a
+#   source.  Run with --no-host-ext to check the paths taken on hosts
+#   without lzcnt, tzcnt or popcnt.
+#
+#   Build:
+#     python3 zb_gen.py > zb.s
+#     llvm-mc -triple=riscv32 -mattr=+m,+zba,+zbb,+zbs,-relax -filetype=obj \
+#       zb.s -o zb.o
+#     ld.lld -Ttext=0x10000 zb.o -o zb.elf
+
+  .equ CASE_SIZE,        16
+  .equ MAX_REPORT,       16
+  .equ NUM_END,          0x20200
+
+  .equ SYS_write,        64
+  .equ SYS_exit,         93
+
+  .text
+  .globl _start
+_start:
+  la s0, cases
+  la s1, cases_end
+  la s2, ops
+  li s3, 0                  # case number
+  li s4, 0                  # failures
+next:
+  bgeu s0, s1, done
+  lw a0, 4(s0)
+  lw a1, 8(s0)
+  # results which are not written show up as this
+  li a2, 0x5a5a5a5a
+  lw t0, 0(s0)
+  add t0, s2, t0
+  jalr ra, t0
+  lw t0, 12(s0)
+  beq a2, t0, 1f
+  jal ra, report
+1:
+  addi s0, s0, CASE_SIZE
+  addi s3, s3, 1
+  j next
+done:
+  bnez s4, fail
+  la a0, msg_ok
+  jal ra, print_str
+  li a0, 0
+  li a7, SYS_exit
+  ecall
+fail:
+  la a0, msg_fail
+  jal ra, print_str
+  mv a0, s4
+  jal ra, print_uint
+  la a0, msg_of
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_nl
+  jal ra, print_str
+  li a0, 1
+  li a7, SYS_exit
+  ecall
+
+# count a failure and write the first few as "case <n>: <result>"
+report:
+  addi s4, s4, 1
+  li t0, MAX_REPORT
+  bgtu s4, t0, 1f
+  mv s5, ra
+  mv s6, a2
+  la a0, msg_case
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_colon
+  jal ra, print_str
+  mv a0, s6
+  jal ra, print_hex
+  la a0, msg_nl
+  jal ra, print_str
+  mv ra, s5
+1:
+  ret
+
+# write the string at a0 to stdout
+print_str:
+  mv a1, a0
+  mv a2, a0
+1:
+  lbu t0, 0(a2)
+  beqz t0, 2f
+  addi a2, a2, 1
+  j 1b
+2:
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout in decimal
+print_uint:
+  li a1, NUM_END
+  li t1, 10
+1:
+  remu t0, a0, t1
+  divu a0, a0, t1
+  addi t0, t0, '0'
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  bnez a0, 1b
+  li a2, NUM_END
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout as eight hex digits
+print_hex:
+  li a1, NUM_END
+  li t1, 8
+1:
+  andi t0, a0, 15
+  srli a0, a0, 4
+  addi t0, t0, '0'
+  li t2, '9'
+  bleu t0, t2, 2f
+  addi t0, t0, 'a' - '9' - 1
+2:
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  addi t1, t1, -1
+  bnez t1, 1b
+  li a2, 8
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+  .option push
+  .option norvc
+  .p2align 4
+ops:
+  .p2align 4
+  sh1add a2, a0, a1
+  ret
+  .p2align 4
+  sh1add a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  sh1add a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  sh1add a2, a1, a1
+  ret
+  .p2align 4
+  sh1add a2, zero, a1
+  ret
+  .p2align 4
+  sh1add a2, a0, zero
+  ret
+  .p2align 4
+  sh2add a2, a0, a1
+  ret
+  .p2align 4
+  sh2add a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  sh2add a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  sh2add a2, a1, a1
+  ret
+  .p2align 4
+  sh2add a2, zero, a1
+  ret
+  .p2align 4
+  sh2add a2, a0, zero
+  ret
+  .p2align 4
+  sh3add a2, a0, a1
+  ret
+  .p2align 4
+  sh3add a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  sh3add a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  sh3add a2, a1, a1
+  ret
+  .p2align 4
+  sh3add a2, zero, a1
+  ret
+  .p2align 4
+  sh3add a2, a0, zero
+  ret
+  .p2align 4
+  andn a2, a0, a1
+  ret
+  .p2align 4
+  andn a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  andn a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  andn a2, a1, a1
+  ret
+  .p2align 4
+  andn a2, zero, a1
+  ret
+  .p2align 4
+  andn a2, a0, zero
+  ret
+  .p2align 4
+  orn a2, a0, a1
+  ret
+  .p2align 4
+  orn a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  orn a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  orn a2, a1, a1
+  ret
+  .p2align 4
+  orn a2, zero, a1
+  ret
+  .p2align 4
+  orn a2, a0, zero
+  ret
+  .p2align 4
+  xnor a2, a0, a1
+  ret
+  .p2align 4
+  xnor a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  xnor a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  xnor a2, a1, a1
+  ret
+  .p2align 4
+  xnor a2, zero, a1
+  ret
+  .p2align 4
+  xnor a2, a0, zero
+  ret
+  .p2align 4
+  min a2, a0, a1
+  ret
+  .p2align 4
+  min a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  min a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  min a2, a1, a1
+  ret
+  .p2align 4
+  min a2, zero, a1
+  ret
+  .p2align 4
+  min a2, a0, zero
+  ret
+  .p2align 4
+  max a2, a0, a1
+  ret
+  .p2align 4
+  max a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  max a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  max a2, a1, a1
+  ret
+  .p2align 4
+  max a2, zero, a1
+  ret
+  .p2align 4
+  max a2, a0, zero
+  ret
+  .p2align 4
+  minu a2, a0, a1
+  ret
+  .p2align 4
+  minu a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  minu a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  minu a2, a1, a1
+  ret
+  .p2align 4
+  minu a2, zero, a1
+  ret
+  .p2align 4
+  minu a2, a0, zero
+  ret
+  .p2align 4
+  maxu a2, a0, a1
+  ret
+  .p2align 4
+  maxu a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  maxu a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  maxu a2, a1, a1
+  ret
+  .p2align 4
+  maxu a2, zero, a1
+  ret
+  .p2align 4
+  maxu a2, a0, zero
+  ret
+  .p2align 4
+  rol a2, a0, a1
+  ret
+  .p2align 4
+  rol a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  rol a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  rol a2, a1, a1
+  ret
+  .p2align 4
+  rol a2, zero, a1
+  ret
+  .p2align 4
+  rol a2, a0, zero
+  ret
+  .p2align 4
+  ror a2, a0, a1
+  ret
+  .p2align 4
+  ror a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  ror a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  ror a2, a1, a1
+  ret
+  .p2align 4
+  ror a2, zero, a1
+  ret
+  .p2align 4
+  ror a2, a0, zero
+  ret
+  .p2align 4
+  bclr a2, a0, a1
+  ret
+  .p2align 4
+  bclr a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  bclr a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  bclr a2, a1, a1
+  ret
+  .p2align 4
+  bclr a2, zero, a1
+  ret
+  .p2align 4
+  bclr a2, a0, zero
+  ret
+  .p2align 4
+  bset a2, a0, a1
+  ret
+  .p2align 4
+  bset a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  bset a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  bset a2, a1, a1
+  ret
+  .p2align 4
+  bset a2, zero, a1
+  ret
+  .p2align 4
+  bset a2, a0, zero
+  ret
+  .p2align 4
+  binv a2, a0, a1
+  ret
+  .p2align 4
+  binv a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  binv a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  binv a2, a1, a1
+  ret
+  .p2align 4
+  binv a2, zero, a1
+  ret
+  .p2align 4
+  binv a2, a0, zero
+  ret
+  .p2align 4
+  bext a2, a0, a1
+  ret
+  .p2align 4
+  bext a0, a0, a1
+  mv a2, a0
+  ret
+  .p2align 4
+  bext a1, a0, a1
+  mv a2, a1
+  ret
+  .p2align 4
+  bext a2, a1, a1
+  ret
+  .p2align 4
+  bext a2, zero, a1
+  ret
+  .p2align 4
+  bext a2, a0, zero
+  ret
+  .p2align 4
+  clz a2, a0
+  ret
+  .p2align 4
+  clz a0, a0
+  mv a2, a0
+  ret
+  .p2align 4
+  clz a2, zero
+  ret
+  .p2align 4
+  ctz a2, a0
+  ret
+  .p2align 4
+  ctz a0, a0
+  mv a2, a0
+  ret
+  .p2align 4
+  ctz a2, zero
+  ret
+  .p2align 4
+  cpop a2, a0
+  ret
+  .p2align 4
+  cpop a0, a0
+  mv a2, a0
+  ret
+  .p2align 4
+  cpop a2, zero
+  ret
+  .p2align 4
+  sext.b a2, a0
+  ret
+  .p2align 4
+  sext.b a0, a0
+  mv a2, a0
+  ret
+  .p2align 4
+  sext.b a2, zero
+  ret
+  .p2align 4
+  sext.h a2, a0
+  ret
+  .p2align 4
+  sext.h a0, a0
+  mv a2, a0
+  ret
+  .p2align 4
+  sext.h a2, zero
+  ret
+  .p2align 4
+  zext.h a2, a0
+  ret
+  .p2align 4
+  zext.h a0, a0
+  mv a2, a0
+  ret
+  .p2align 4
+  zext.h a2, zero
+  ret
+  .p2align 4
+  orc.b a2, a0
+  ret
+  .p2align 4
+  orc.b a0, a0
+  mv a2, a0
+  ret
+  .p2align 4
+  orc.b a2, zero
+  ret
+  .p2align 4
+  rev8 a2, a0
+  ret
+  .p2align 4
+  rev8 a0, a0
+  mv a2, a0
+  ret
+  .p2align 4
+  rev8 a2, zero
+  ret
+  .p2align 4
+  rori a2, a0, 0
+  ret
+  .p2align 4
+  rori a2, a0, 1
+  ret
+  .p2align 4
+  rori a2, a0, 8
+  ret
+  .p2align 4
+  rori a2, a0, 15
+  ret
+  .p2align 4
+  rori a2, a0, 16
+  ret
+  .p2align 4
+  rori a2, a0, 31
+  ret
+  .p2align 4
+  bclri a2, a0, 0
+  ret
+  .p2align 4
+  bclri a2, a0, 1
+  ret
+  .p2align 4
+  bclri a2, a0, 8
+  ret
+  .p2align 4
+  bclri a2, a0, 15
+  ret
+  .p2align 4
+  bclri a2, a0, 16
+  ret
+  .p2align 4
+  bclri a2, a0, 31
+  ret
+  .p2align 4
+  bseti a2, a0, 0
+  ret
+  .p2align 4
+  bseti a2, a0, 1
+  ret
+  .p2align 4
+  bseti a2, a0, 8
+  ret
+  .p2align 4
+  bseti a2, a0, 15
+  ret
+  .p2align 4
+  bseti a2, a0, 16
+  ret
+  .p2align 4
+  bseti a2, a0, 31
+  ret
+  .p2align 4
+  binvi a2, a0, 0
+  ret
+  .p2align 4
+  binvi a2, a0, 1
+  ret
+  .p2align 4
+  binvi a2, a0, 8
+  ret
+  .p2align 4
+  binvi a2, a0, 15
+  ret
+  .p2align 4
+  binvi a2, a0, 16
+  ret
+  .p2align 4
+  binvi a2, a0, 31
+  ret
+  .p2align 4
+  bexti a2, a0, 0
+  ret
+  .p2align 4
+  bexti a2, a0, 1
+  ret
+  .p2align 4
+  bexti a2, a0, 8
+  ret
+  .p2align 4
+  bexti a2, a0, 15
+  ret
+  .p2align 4
+  bexti a2, a0, 16
+  ret
+  .p2align 4
+  bexti a2, a0, 31
+  ret
+  .option pop
+
+  .data
+  .p2align 2
+# stub offset, two operands, expected result
+cases:
+  .word 0x0, 0x0, 0x0, 0x0
+  .word 0x0, 0x0, 0x2, 0x2
+  .word 0x0, 0x0, 0x80, 0x80
+  .word 0x0, 0x0, 0x100, 0x100
+  .word 0x0, 0x0, 0x8000, 0x8000
+  .word 0x0, 0x0, 0x10000, 0x10000
+  .word 0x0, 0x0, 0x80000000, 0x80000000
+  .word 0x0, 0x0, 0xfffffffe, 0xfffffffe
+  .word 0x0, 0x0, 0x1000000, 0x1000000
+  .word 0x0, 0x0, 0xff00ff00, 0xff00ff00
+  .word 0x0, 0x0, 0x10080, 0x10080
+  .word 0x0, 0x0, 0x723b417, 0x723b417
+  .word 0x0, 0x0, 0x6c, 0x6c
+  .word 0x0, 0x0, 0x215b8, 0x215b8
+  .word 0x0, 0x0, 0xe69, 0xe69
+  .word 0x0, 0x0, 0x73698785, 0x73698785
+  .word 0x0, 0x0, 0x1, 0x1
+  .word 0x0, 0x0, 0x10, 0x10
+  .word 0x0, 0x0, 0xd28fd14, 0xd28fd14
+  .word 0x0, 0x2, 0x0, 0x4
+  .word 0x0, 0x2, 0x2, 0x6
+  .word 0x0, 0x2, 0x80, 0x84
+  .word 0x0, 0x2, 0x100, 0x104
+  .word 0x0, 0x2, 0x8000, 0x8004
+  .word 0x0, 0x2, 0x10000, 0x10004
+  .word 0x0, 0x2, 0x80000000, 0x80000004
+  .word 0x0, 0x2, 0xfffffffe, 0x2
+  .word 0x0, 0x2, 0x1000000, 0x1000004
+  .word 0x0, 0x2, 0xff00ff00, 0xff00ff04
+  .word 0x0, 0x2, 0x10080, 0x10084
+  .word 0x0, 0x2, 0x723b417, 0x723b41b
+  .word 0x0, 0x2, 0x6c, 0x70
+  .word 0x0, 0x2, 0x215b8, 0x215bc
+  .word 0x0, 0x2, 0xe69, 0xe6d
+  .word 0x0, 0x2, 0x73698785, 0x73698789
+  .word 0x0, 0x2, 0x1, 0x5
+  .word 0x0, 0x2, 0x10, 0x14
+  .word 0x0, 0x2, 0xd28fd14, 0xd28fd18
+  .word 0x0, 0x80, 0x0, 0x100
+  .word 0x0, 0x80, 0x2, 0x102
+  .word 0x0, 0x80, 0x80, 0x180
+  .word 0x0, 0x80, 0x100, 0x200
+  .word 0x0, 0x80, 0x8000, 0x8100
+  .word 0x0, 0x80, 0x10000, 0x10100
+  .word 0x0, 0x80, 0x80000000, 0x80000100
+  .word 0x0, 0x80, 0xfffffffe, 0xfe
+  .word 0x0, 0x80, 0x1000000, 0x1000100
+  .word 0x0, 0x80, 0xff00ff00, 0xff010000
+  .word 0x0, 0x80, 0x10080, 0x10180
+  .word 0x0, 0x80, 0x723b417, 0x723b517
+  .word 0x0, 0x80, 0x6c, 0x16c
+  .word 0x0, 0x80, 0x215b8, 0x216b8
+  .word 0x0, 0x80, 0xe69, 0xf69
+  .word 0x0, 0x80, 0x73698785, 0x73698885
+  .word 0x0, 0x80, 0x1, 0x101
+  .word 0x0, 0x80, 0x10, 0x110
+  .word 0x0, 0x80, 0xd28fd14, 0xd28fe14
+  .word 0x0, 0x100, 0x0, 0x200
+  .word 0x0, 0x100, 0x2, 0x202
+  .word 0x0, 0x100, 0x80, 0x280
+  .word 0x0, 0x100, 0x100, 0x300
+  .word 0x0, 0x100, 0x8000, 0x8200
+  .word 0x0, 0x100, 0x10000, 0x10200
+  .word 0x0, 0x100, 0x80000000, 0x80000200
+  .word 0x0, 0x100, 0xfffffffe, 0x1fe
+  .word 0x0, 0x100, 0x1000000, 0x1000200
+  .word 0x0, 0x100, 0xff00ff00, 0xff010100
+  .word 0x0, 0x100, 0x10080, 0x10280
+  .word 0x0, 0x100, 0x723b417, 0x723b617
+  .word 0x0, 0x100, 0x6c, 0x26c
+  .word 0x0, 0x100, 0x215b8, 0x217b8
+  .word 0x0, 0x100, 0xe69, 0x1069
+  .word 0x0, 0x100, 0x73698785, 0x73698985
+  .word 0x0, 0x100, 0x1, 0x201
+  .word 0x0, 0x100, 0x10, 0x210
+  .word 0x0, 0x100, 0xd28fd14, 0xd28ff14
+  .word 0x0, 0x8000, 0x0, 0x10000
+  .word 0x0, 0x8000, 0x2, 0x10002
+  .word 0x0, 0x8000, 0x80, 0x10080
+  .word 0x0, 0x8000, 0x100, 0x10100
+  .word 0x0, 0x8000, 0x8000, 0x18000
+  .word 0x0, 0x8000, 0x10000, 0x20000
+  .word 0x0, 0x8000, 0x80000000, 0x80010000
+  .word 0x0, 0x8000, 0xfffffffe, 0xfffe
+  .word 0x0, 0x8000, 0x1000000, 0x1010000
+  .word 0x0, 0x8000, 0xff00ff00, 0xff01ff00
+  .word 0x0, 0x8000, 0x10080, 0x20080
+  .word 0x0, 0x8000, 0x723b417, 0x724b417
+  .word 0x0, 0x8000, 0x6c, 0x1006c
+  .word 0x0, 0x8000, 0x215b8, 0x315b8
+  .word 0x0, 0x8000, 0xe69, 0x10e69
+  .word 0x0, 0x8000, 0x73698785, 0x736a8785
+  .word 0x0, 0x8000, 0x1, 0x10001
+  .word 0x0, 0x8000, 0x10, 0x10010
+  .word 0x0, 0x8000, 0xd28fd14, 0xd29fd14
+  .word 0x0, 0x10000, 0x0, 0x20000
+  .word 0x0, 0x10000, 0x2, 0x20002
+  .word 0x0, 0x10000, 0x80, 0x20080
+  .word 0x0, 0x10000, 0x100, 0x20100
+  .word 0x0, 0x10000, 0x8000, 0x28000
+  .word 0x0, 0x10000, 0x10000, 0x30000
+  .word 0x0, 0x10000, 0x80000000, 0x80020000
+  .word 0x0, 0x10000, 0xfffffffe, 0x1fffe
+  .word 0x0, 0x10000, 0x1000000, 0x1020000
+  .word 0x0, 0x10000, 0xff00ff00, 0xff02ff00
+  .word 0x0, 0x10000, 0x10080, 0x30080
+  .word 0x0, 0x10000, 0x723b417, 0x725b417
+  .word 0x0, 0x10000, 0x6c, 0x2006c
+  .word 0x0, 0x10000, 0x215b8, 0x415b8
+  .word 0x0, 0x10000, 0xe69, 0x20e69
+  .word 0x0, 0x10000, 0x73698785, 0x736b8785
+  .word 0x0, 0x10000, 0x1, 0x20001
+  .word 0x0, 0x10000, 0x10, 0x20010
+  .word 0x0, 0x10000, 0xd28fd14, 0xd2afd14
+  .word 0x0, 0x80000000, 0x0, 0x0
+  .word 0x0, 0x80000000, 0x2, 0x2
+  .word 0x0, 0x80000000, 0x80, 0x80
+  .word 0x0, 0x80000000, 0x100, 0x100
+  .word 0x0, 0x80000000, 0x8000, 0x8000
+  .word 0x0, 0x80000000, 0x10000, 0x10000
+  .word 0x0, 0x80000000, 0x80000000, 0x80000000
+  .word 0x0, 0x80000000, 0xfffffffe, 0xfffffffe
+  .word 0x0, 0x80000000, 0x1000000, 0x1000000
+  .word 0x0, 0x80000000, 0xff00ff00, 0xff00ff00
+  .word 0x0, 0x80000000, 0x10080, 0x10080
+  .word 0x0, 0x80000000, 0x723b417, 0x723b417
+  .word 0x0, 0x80000000, 0x6c, 0x6c
+  .word 0x0, 0x80000000, 0x215b8, 0x215b8
+  .word 0x0, 0x80000000, 0xe69, 0xe69
+  .word 0x0, 0x80000000, 0x73698785, 0x73698785
+  .word 0x0, 0x80000000, 0x1, 0x1
+  .word 0x0, 0x80000000, 0x10, 0x10
+  .word 0x0, 0x80000000, 0xd28fd14, 0xd28fd14
+  .word 0x0, 0xfffffffe, 0x0, 0xfffffffc
+  .word 0x0, 0xfffffffe, 0x2, 0xfffffffe
+  .word 0x0, 0xfffffffe, 0x80, 0x7c
+  .word 0x0, 0xfffffffe, 0x100, 0xfc
+  .word 0x0, 0xfffffffe, 0x8000, 0x7ffc
+  .word 0x0, 0xfffffffe, 0x10000, 0xfffc
+  .word 0x0, 0xfffffffe, 0x80000000, 0x7ffffffc
+  .word 0x0, 0xfffffffe, 0xfffffffe, 0xfffffffa
+  .word 0x0, 0xfffffffe, 0x1000000, 0xfffffc
+  .word 0x0, 0xfffffffe, 0xff00ff00, 0xff00fefc
+  .word 0x0, 0xfffffffe, 0x10080, 0x1007c
+  .word 0x0, 0xfffffffe, 0x723b417, 0x723b413
+  .word 0x0, 0xfffffffe, 0x6c, 0x68
+  .word 0x0, 0xfffffffe, 0x215b8, 0x215b4
+  .word 0x0, 0xfffffffe, 0xe69, 0xe65
+  .word 0x0, 0xfffffffe, 0x73698785, 0x73698781
+  .word 0x0, 0xfffffffe, 0x1, 0xfffffffd
+  .word 0x0, 0xfffffffe, 0x10, 0xc
+  .word 0x0, 0xfffffffe, 0xd28fd14, 0xd28fd10
+  .word 0x0, 0x1000000, 0x0, 0x2000000
+  .word 0x0, 0x1000000, 0x2, 0x2000002
+  .word 0x0, 0x1000000, 0x80, 0x2000080
+  .word 0x0, 0x1000000, 0x100, 0x2000100
+  .word 0x0, 0x1000000, 0x8000, 0x2008000
+  .word 0x0, 0x1000000, 0x10000, 0x2010000
+  .word 0x0, 0x1000000, 0x80000000, 0x82000000
+  .word 0x0, 0x1000000, 0xfffffffe, 0x1fffffe
+  .word 0x0, 0x1000000, 0x1000000, 0x3000000
+  .word 0x0, 0x1000000, 0xff00ff00, 0x100ff00
+  .word 0x0, 0x1000000, 0x10080, 0x2010080
+  .word 0x0, 0x1000000, 0x723b417, 0x923b417
+  .word 0x0, 0x1000000, 0x6c, 0x200006c
+  .word 0x0, 0x1000000, 0x215b8, 0x20215b8
+  .word 0x0, 0x1000000, 0xe69, 0x2000e69
+  .word 0x0, 0x1000000, 0x73698785, 0x75698785
+  .word 0x0, 0x1000000, 0x1, 0x2000001
+  .word 0x0, 0x1000000, 0x10, 0x2000010
+  .word 0x0, 0x1000000, 0xd28fd14, 0xf28fd14
+  .word 0x0, 0xff00ff00, 0x0, 0xfe01fe00
+  .word 0x0, 0xff00ff00, 0x2, 0xfe01fe02
+  .word 0x0, 0xff00ff00, 0x80, 0xfe01fe80
+  .word 0x0, 0xff00ff00, 0x100, 0xfe01ff00
+  .word 0x0, 0xff00ff00, 0x8000, 0xfe027e00
+  .word 0x0, 0xff00ff00, 0x10000, 0xfe02fe00
+  .word 0x0, 0xff00ff00, 0x80000000, 0x7e01fe00
+  .word 0x0, 0xff00ff00, 0xfffffffe, 0xfe01fdfe
+  .word 0x0, 0xff00ff00, 0x1000000, 0xff01fe00
+  .word 0x0, 0xff00ff00, 0xff00ff00, 0xfd02fd00
+  .word 0x0, 0xff00ff00, 0x10080, 0xfe02fe80
+  .word 0x0, 0xff00ff00, 0x723b417, 0x525b217
+  .word 0x0, 0xff00ff00, 0x6c, 0xfe01fe6c
+  .word 0x0, 0xff00ff00, 0x215b8, 0xfe0413b8
+  .word 0x0, 0xff00ff00, 0xe69, 0xfe020c69
+  .word 0x0, 0xff00ff00, 0x73698785, 0x716b8585
+  .word 0x0, 0xff00ff00, 0x1, 0xfe01fe01
+  .word 0x0, 0xff00ff00, 0x10, 0xfe01fe10
+  .word 0x0, 0xff00ff00, 0xd28fd14, 0xb2afb14
+  .word 0x0, 0x10080, 0x0, 0x20100
+  .word 0x0, 0x10080, 0x2, 0x20102
+  .word 0x0, 0x10080, 0x80, 0x20180
+  .word 0x0, 0x10080, 0x100, 0x20200
+  .word 0x0, 0x10080, 0x8000, 0x28100
+  .word 0x0, 0x10080, 0x10000, 0x30100
+  .word 0x0, 0x10080, 0x80000000, 0x80020100
+  .word 0x0, 0x10080, 0xfffffffe, 0x200fe
+  .word 0x0, 0x10080, 0x1000000, 0x1020100
+  .word 0x0, 0x10080, 0xff00ff00, 0xff030000
+  .word 0x0, 0x10080, 0x10080, 0x30180
+  .word 0x0, 0x10080, 0x723b417, 0x725b517
+  .word 0x0, 0x10080, 0x6c, 0x2016c
+  .word 0x0, 0x10080, 0x215b8, 0x416b8
+  .word 0x0, 0x10080, 0xe69, 0x20f69
+  .word 0x0, 0x10080, 0x73698785, 0x736b8885
+  .word 0x0, 0x10080, 0x1, 0x20101
+  .word 0x0, 0x10080, 0x10, 0x20110
+  .word 0x0, 0x10080, 0xd28fd14, 0xd2afe14
+  .word 0x0, 0x723b417, 0x0, 0xe47682e
+  .word 0x0, 0x723b417, 0x2, 0xe476830
+  .word 0x0, 0x723b417, 0x80, 0xe4768ae
+  .word 0x0, 0x723b417, 0x100, 0xe47692e
+  .word 0x0, 0x723b417, 0x8000, 0xe47e82e
+  .word 0x0, 0x723b417, 0x10000, 0xe48682e
+  .word 0x0, 0x723b417, 0x80000000, 0x8e47682e
+  .word 0x0, 0x723b417, 0xfffffffe, 0xe47682c
+  .word 0x0, 0x723b417, 0x1000000, 0xf47682e
+  .word 0x0, 0x723b417, 0xff00ff00, 0xd48672e
+  .word 0x0, 0x723b417, 0x10080, 0xe4868ae
+  .word 0x0, 0x723b417, 0x723b417, 0x156b1c45
+  .word 0x0, 0x723b417, 0x6c, 0xe47689a
+  .word 0x0, 0x723b417, 0x215b8, 0xe497de6
+  .word 0x0, 0x723b417, 0xe69, 0xe477697
+  .word 0x0, 0x723b417, 0x73698785, 0x81b0efb3
+  .word 0x0, 0x723b417, 0x1, 0xe47682f
+  .word 0x0, 0x723b417, 0x10, 0xe47683e
+  .word 0x0, 0x723b417, 0xd28fd14, 0x1b706542
+  .word 0x0, 0x6c, 0x0, 0xd8
+  .word 0x0, 0x6c, 0x2, 0xda
+  .word 0x0, 0x6c, 0x80, 0x158
+  .word 0x0, 0x6c, 0x100, 0x1d8
+  .word 0x0, 0x6c, 0x8000, 0x80d8
+  .word 0x0, 0x6c, 0x10000, 0x100d8
+  .word 0x0, 0x6c, 0x80000000, 0x800000d8
+  .word 0x0, 0x6c, 0xfffffffe, 0xd6
+  .word 0x0, 0x6c, 0x1000000, 0x10000d8
+  .word 0x0, 0x6c, 0xff00ff00, 0xff00ffd8
+  .word 0x0, 0x6c, 0x10080, 0x10158
+  .word 0x0, 0x6c, 0x723b417, 0x723b4ef
+  .word 0x0, 0x6c, 0x6c, 0x144
+  .word 0x0, 0x6c, 0x215b8, 0x21690
+  .word 0x0, 0x6c, 0xe69, 0xf41
+  .word 0x0, 0x6c, 0x73698785, 0x7369885d
+  .word 0x0, 0x6c, 0x1, 0xd9
+  .word 0x0, 0x6c, 0x10, 0xe8
+  .word 0x0, 0x6c, 0xd28fd14, 0xd28fdec
+  .word 0x0, 0x215b8, 0x0, 0x42b70
+  .word 0x0, 0x215b8, 0x2, 0x42b72
+  .word 0x0, 0x215b8, 0x80, 0x42bf0
+  .word 0x0, 0x215b8, 0x100, 0x42c70
+  .word 0x0, 0x215b8, 0x8000, 0x4ab70
+  .word 0x0, 0x215b8, 0x10000, 0x52b70
+  .word 0x0, 0x215b8, 0x80000000, 0x80042b70
+  .word 0x0, 0x215b8, 0xfffffffe, 0x42b6e
+  .word 0x0, 0x215b8, 0x1000000, 0x1042b70
+  .word 0x0, 0x215b8, 0xff00ff00, 0xff052a70
+  .word 0x0, 0x215b8, 0x10080, 0x52bf0
+  .word 0x0, 0x215b8, 0x723b417, 0x727df87
+  .word 0x0, 0x215b8, 0x6c, 0x42bdc
+  .word 0x0, 0x215b8, 0x215b8, 0x64128
+  .word 0x0, 0x215b8, 0xe69, 0x439d9
+  .word 0x0, 0x215b8, 0x73698785, 0x736db2f5
+  .word 0x0, 0x215b8, 0x1, 0x42b71
+  .word 0x0, 0x215b8, 0x10, 0x42b80
+  .word 0x0, 0x215b8, 0xd28fd14, 0xd2d2884
+  .word 0x0, 0xe69, 0x0, 0x1cd2
+  .word 0x0, 0xe69, 0x2, 0x1cd4
+  .word 0x0, 0xe69, 0x80, 0x1d52
+  .word 0x0, 0xe69, 0x100, 0x1dd2
+  .word 0x0, 0xe69, 0x8000, 0x9cd2
+  .word 0x0, 0xe69, 0x10000, 0x11cd2
+  .word 0x0, 0xe69, 0x80000000, 0x80001cd2
+  .word 0x0, 0xe69, 0xfffffffe, 0x1cd0
+  .word 0x0, 0xe69, 0x1000000, 0x1001cd2
+  .word 0x0, 0xe69, 0xff00ff00, 0xff011bd2
+  .word 0x0, 0xe69, 0x10080, 0x11d52
+  .word 0x0, 0xe69, 0x723b417, 0x723d0e9
+  .word 0x0, 0xe69, 0x6c, 0x1d3e
+  .word 0x0, 0xe69, 0x215b8, 0x2328a
+  .word 0x0, 0xe69, 0xe69, 0x2b3b
+  .word 0x0, 0xe69, 0x73698785, 0x7369a457
+  .word 0x0, 0xe69, 0x1, 0x1cd3
+  .word 0x0, 0xe69, 0x10, 0x1ce2
+  .word 0x0, 0xe69, 0xd28fd14, 0xd2919e6
+  .word 0x0, 0x73698785, 0x0, 0xe6d30f0a
+  .word 0x0, 0x73698785, 0x2, 0xe6d30f0c
+  .word 0x0, 0x73698785, 0x80, 0xe6d30f8a
+  .word 0x0, 0x73698785, 0x100, 0xe6d3100a
+  .word 0x0, 0x73698785, 0x8000, 0xe6d38f0a
+  .word 0x0, 0x73698785, 0x10000, 0xe6d40f0a
+  .word 0x0, 0x73698785, 0x80000000, 0x66d30f0a
+  .word 0x0, 0x73698785, 0xfffffffe, 0xe6d30f08
+  .word 0x0, 0x73698785, 0x1000000, 0xe7d30f0a
+  .word 0x0, 0x73698785, 0xff00ff00, 0xe5d40e0a
+  .word 0x0, 0x73698785, 0x10080, 0xe6d40f8a
+  .word 0x0, 0x73698785, 0x723b417, 0xedf6c321
+  .word 0x0, 0x73698785, 0x6c, 0xe6d30f76
+  .word 0x0, 0x73698785, 0x215b8, 0xe6d524c2
+  .word 0x0, 0x73698785, 0xe69, 0xe6d31d73
+  .word 0x0, 0x73698785, 0x73698785, 0x5a3c968f
+  .word 0x0, 0x73698785, 0x1, 0xe6d30f0b
+  .word 0x0, 0x73698785, 0x10, 0xe6d30f1a
+  .word 0x0, 0x73698785, 0xd28fd14, 0xf3fc0c1e
+  .word 0x0, 0x1, 0x0, 0x2
+  .word 0x0, 0x1, 0x2, 0x4
+  .word 0x0, 0x1, 0x80, 0x82
+  .word 0x0, 0x1, 0x100, 0x102
+  .word 0x0, 0x1, 0x8000, 0x8002
+  .word 0x0, 0x1, 0x10000, 0x10002
+  .word 0x0, 0x1, 0x80000000, 0x80000002
+  .word 0x0, 0x1, 0xfffffffe, 0x0
+  .word 0x0, 0x1, 0x1000000, 0x1000002
+  .word 0x0, 0x1, 0xff00ff00, 0xff00ff02
+  .word 0x0, 0x1, 0x10080, 0x10082
+  .word 0x0, 0x1, 0x723b417, 0x723b419
+  .word 0x0, 0x1, 0x6c, 0x6e
+  .word 0x0, 0x1, 0x215b8, 0x215ba
+  .word 0x0, 0x1, 0xe69, 0xe6b
+  .word 0x0, 0x1, 0x73698785, 0x73698787
+  .word 0x0, 0x1, 0x1, 0x3
+  .word 0x0, 0x1, 0x10, 0x12
+  .word 0x0, 0x1, 0xd28fd14, 0xd28fd16
+  .word 0x0, 0x10, 0x0, 0x20
+  .word 0x0, 0x10, 0x2, 0x22
+  .word 0x0, 0x10, 0x80, 0xa0
+  .word 0x0, 0x10, 0x100, 0x120
+  .word 0x0, 0x10, 0x8000, 0x8020
+  .word 0x0, 0x10, 0x10000, 0x10020
+  .word 0x0, 0x10, 0x80000000, 0x80000020
+  .word 0x0, 0x10, 0xfffffffe, 0x1e
+  .word 0x0, 0x10, 0x1000000, 0x1000020
+  .word 0x0, 0x10, 0xff00ff00, 0xff00ff20
+  .word 0x0, 0x10, 0x10080, 0x100a0
+  .word 0x0, 0x10, 0x723b417, 0x723b437
+  .word 0x0, 0x10, 0x6c, 0x8c
+  .word 0x0, 0x10, 0x215b8, 0x215d8
+  .word 0x0, 0x10, 0xe69, 0xe89
+  .word 0x0, 0x10, 0x73698785, 0x736987a5
+  .word 0x0, 0x10, 0x1, 0x21
+  .word 0x0, 0x10, 0x10, 0x30
+  .word 0x0, 0x10, 0xd28fd14, 0xd28fd34
+  .word 0x0, 0xd28fd14, 0x0, 0x1a51fa28
+  .word 0x0, 0xd28fd14, 0x2, 0x1a51fa2a
+  .word 0x0, 0xd28fd14, 0x80, 0x1a51faa8
+  .word 0x0, 0xd28fd14, 0x100, 0x1a51fb28
+  .word 0x0, 0xd28fd14, 0x8000, 0x1a527a28
+  .word 0x0, 0xd28fd14, 0x10000, 0x1a52fa28
+  .word 0x0, 0xd28fd14, 0x80000000, 0x9a51fa28
+  .word 0x0, 0xd28fd14, 0xfffffffe, 0x1a51fa26
+  .word 0x0, 0xd28fd14, 0x1000000, 0x1b51fa28
+  .word 0x0, 0xd28fd14, 0xff00ff00, 0x1952f928
+  .word 0x0, 0xd28fd14, 0x10080, 0x1a52faa8
+  .word 0x0, 0xd28fd14, 0x723b417, 0x2175ae3f
+  .word 0x0, 0xd28fd14, 0x6c, 0x1a51fa94
+  .word 0x0, 0xd28fd14, 0x215b8, 0x1a540fe0
+  .word 0x0, 0xd28fd14, 0xe69, 0x1a520891
+  .word 0x0, 0xd28fd14, 0x73698785, 0x8dbb81ad
+  .word 0x0, 0xd28fd14, 0x1, 0x1a51fa29
+  .word 0x0, 0xd28fd14, 0x10, 0x1a51fa38
+  .word 0x0, 0xd28fd14, 0xd28fd14, 0x277af73c
+  .word 0x10, 0x0, 0x0, 0x0
+  .word 0x20, 0x0, 0x0, 0x0
+  .word 0x30, 0x0, 0x0, 0x0
+  .word 0x10, 0x0, 0x10000, 0x10000
+  .word 0x20, 0x0, 0x10000, 0x10000
+  .word 0x30, 0x0, 0x10000, 0x30000
+  .word 0x10, 0x0, 0x10080, 0x10080
+  .word 0x20, 0x0, 0x10080, 0x10080
+  .word 0x30, 0x0, 0x10080, 0x30180
+  .word 0x10, 0x0, 0x73698785, 0x73698785
+  .word 0x20, 0x0, 0x73698785, 0x73698785
+  .word 0x30, 0x0, 0x73698785, 0x5a3c968f
+  .word 0x10, 0x2, 0x2, 0x6
+  .word 0x20, 0x2, 0x2, 0x6
+  .word 0x30, 0x2, 0x2, 0x6
+  .word 0x10, 0x2, 0x80000000, 0x80000004
+  .word 0x20, 0x2, 0x80000000, 0x80000004
+  .word 0x30, 0x2, 0x80000000, 0x80000000
+  .word 0x10, 0x2, 0x723b417, 0x723b41b
+  .word 0x20, 0x2, 0x723b417, 0x723b41b
+  .word 0x30, 0x2, 0x723b417, 0x156b1c45
+  .word 0x10, 0x2, 0x1, 0x5
+  .word 0x20, 0x2, 0x1, 0x5
+  .word 0x30, 0x2, 0x1, 0x3
+  .word 0x10, 0x80, 0x80, 0x180
+  .word 0x20, 0x80, 0x80, 0x180
+  .word 0x30, 0x80, 0x80, 0x180
+  .word 0x10, 0x80, 0xfffffffe, 0xfe
+  .word 0x20, 0x80, 0xfffffffe, 0xfe
+  .word 0x30, 0x80, 0xfffffffe, 0xfffffffa
+  .word 0x10, 0x80, 0x6c, 0x16c
+  .word 0x20, 0x80, 0x6c, 0x16c
+  .word 0x30, 0x80, 0x6c, 0x144
+  .word 0x10, 0x80, 0x10, 0x110
+  .word 0x20, 0x80, 0x10, 0x110
+  .word 0x30, 0x80, 0x10, 0x30
+  .word 0x10, 0x100, 0x100, 0x300
+  .word 0x20, 0x100, 0x100, 0x300
+  .word 0x30, 0x100, 0x100, 0x300
+  .word 0x10, 0x100, 0x1000000, 0x1000200
+  .word 0x20, 0x100, 0x1000000, 0x1000200
+  .word 0x30, 0x100, 0x1000000, 0x3000000
+  .word 0x10, 0x100, 0x215b8, 0x217b8
+  .word 0x20, 0x100, 0x215b8, 0x217b8
+  .word 0x30, 0x100, 0x215b8, 0x64128
+  .word 0x10, 0x100, 0xd28fd14, 0xd28ff14
+  .word 0x20, 0x100, 0xd28fd14, 0xd28ff14
+  .word 0x30, 0x100, 0xd28fd14, 0x277af73c
+  .word 0x10, 0x8000, 0x8000, 0x18000
+  .word 0x20, 0x8000, 0x8000, 0x18000
+  .word 0x30, 0x8000, 0x8000, 0x18000
+  .word 0x10, 0x8000, 0xff00ff00, 0xff01ff00
+  .word 0x20, 0x8000, 0xff00ff00, 0xff01ff00
+  .word 0x30, 0x8000, 0xff00ff00, 0xfd02fd00
+  .word 0x10, 0x8000, 0xe69, 0x10e69
+  .word 0x20, 0x8000, 0xe69, 0x10e69
+  .word 0x30, 0x8000, 0xe69, 0x2b3b
+  .word 0x10, 0x10000, 0x0, 0x20000
+  .word 0x20, 0x10000, 0x0, 0x20000
+  .word 0x30, 0x10000, 0x0, 0x0
+  .word 0x10, 0x10000, 0x10000, 0x30000
+  .word 0x20, 0x10000, 0x10000, 0x30000
+  .word 0x30, 0x10000, 0x10000, 0x30000
+  .word 0x10, 0x10000, 0x10080, 0x30080
+  .word 0x20, 0x10000, 0x10080, 0x30080
+  .word 0x30, 0x10000, 0x10080, 0x30180
+  .word 0x10, 0x10000, 0x73698785, 0x736b8785
+  .word 0x20, 0x10000, 0x73698785, 0x736b8785
+  .word 0x30, 0x10000, 0x73698785, 0x5a3c968f
+  .word 0x10, 0x80000000, 0x2, 0x2
+  .word 0x20, 0x80000000, 0x2, 0x2
+  .word 0x30, 0x80000000, 0x2, 0x6
+  .word 0x10, 0x80000000, 0x80000000, 0x80000000
+  .word 0x20, 0x80000000, 0x80000000, 0x80000000
+  .word 0x30, 0x80000000, 0x80000000, 0x80000000
+  .word 0x10, 0x80000000, 0x723b417, 0x723b417
+  .word 0x20, 0x80000000, 0x723b417, 0x723b417
+  .word 0x30, 0x80000000, 0x723b417, 0x156b1c45
+  .word 0x10, 0x80000000, 0x1, 0x1
+  .word 0x20, 0x80000000, 0x1, 0x1
+  .word 0x30, 0x80000000, 0x1, 0x3
+  .word 0x10, 0xfffffffe, 0x80, 0x7c
+  .word 0x20, 0xfffffffe, 0x80, 0x7c
+  .word 0x30, 0xfffffffe, 0x80, 0x180
+  .word 0x10, 0xfffffffe, 0xfffffffe, 0xfffffffa
+  .word 0x20, 0xfffffffe, 0xfffffffe, 0xfffffffa
+  .word 0x30, 0xfffffffe, 0xfffffffe, 0xfffffffa
+  .word 0x10, 0xfffffffe, 0x6c, 0x68
+  .word 0x20, 0xfffffffe, 0x6c, 0x68
+  .word 0x30, 0xfffffffe, 0x6c, 0x144
+  .word 0x10, 0xfffffffe, 0x10, 0xc
+  .word 0x20, 0xfffffffe, 0x10, 0xc
+  .word 0x30, 0xfffffffe, 0x10, 0x30
+  .word 0x10, 0x1000000, 0x100, 0x2000100
+  .word 0x20, 0x1000000, 0x100, 0x2000100
+  .word 0x30, 0x1000000, 0x100, 0x300
+  .word 0x10, 0x1000000, 0x1000000, 0x3000000
+  .word 0x20, 0x1000000, 0x1000000, 0x3000000
+  .word 0x30, 0x1000000, 0x1000000, 0x3000000
+  .word 0x10, 0x1000000, 0x215b8, 0x20215b8
+  .word 0x20, 0x1000000, 0x215b8, 0x20215b8
+  .word 0x30, 0x1000000, 0x215b8, 0x64128
+  .word 0x10, 0x1000000, 0xd28fd14, 0xf28fd14
+  .word 0x20, 0x1000000, 0xd28fd14, 0xf28fd14
+  .word 0x30, 0x1000000, 0xd28fd14, 0x277af73c
+  .word 0x10, 0xff00ff00, 0x8000, 0xfe027e00
+  .word 0x20, 0xff00ff00, 0x8000, 0xfe027e00
+  .word 0x30, 0xff00ff00, 0x8000, 0x18000
+  .word 0x10, 0xff00ff00, 0xff00ff00, 0xfd02fd00
+  .word 0x20, 0xff00ff00, 0xff00ff00, 0xfd02fd00
+  .word 0x30, 0xff00ff00, 0xff00ff00, 0xfd02fd00
+  .word 0x10, 0xff00ff00, 0xe69, 0xfe020c69
+  .word 0x20, 0xff00ff00, 0xe69, 0xfe020c69
+  .word 0x30, 0xff00ff00, 0xe69, 0x2b3b
+  .word 0x10, 0x10080, 0x0, 0x20100
+  .word 0x20, 0x10080, 0x0, 0x20100
+  .word 0x30, 0x10080, 0x0, 0x0
+  .word 0x10, 0x10080, 0x10000, 0x30100
+  .word 0x20, 0x10080, 0x10000, 0x30100
+  .word 0x30, 0x10080, 0x10000, 0x30000
+  .word 0x10, 0x10080, 0x10080, 0x30180
+  .word 0x20, 0x10080, 0x10080, 0x30180
+  .word 0x30, 0x10080, 0x10080, 0x30180
+  .word 0x10, 0x10080, 0x73698785, 0x736b8885
+  .word 0x20, 0x10080, 0x73698785, 0x736b8885
+  .word 0x30, 0x10080, 0x73698785, 0x5a3c968f
+  .word 0x10, 0x723b417, 0x2, 0xe476830
+  .word 0x20, 0x723b417, 0x2, 0xe476830
+  .word 0x30, 0x723b417, 0x2, 0x6
+  .word 0x10, 0x723b417, 0x80000000, 0x8e47682e
+  .word 0x20, 0x723b417, 0x80000000, 0x8e47682e
+  .word 0x30, 0x723b417, 0x80000000, 0x80000000
+  .word 0x10, 0x723b417, 0x723b417, 0x156b1c45
+  .word 0x20, 0x723b417, 0x723b417, 0x156b1c45
+  .word 0x30, 0x723b417, 0x723b417, 0x156b1c45
+  .word 0x10, 0x723b417, 0x1, 0xe47682f
+  .word 0x20, 0x723b417, 0x1, 0xe47682f
+  .word 0x30, 0x723b417, 0x1, 0x3
+  .word 0x10, 0x6c, 0x80, 0x158
+  .word 0x20, 0x6c, 0x80, 0x158
+  .word 0x30, 0x6c, 0x80, 0x180
+  .word 0x10, 0x6c, 0xfffffffe, 0xd6
+  .word 0x20, 0x6c, 0xfffffffe, 0xd6
+  .word 0x30, 0x6c, 0xfffffffe, 0xfffffffa
+  .word 0x10, 0x6c, 0x6c, 0x144
+  .word 0x20, 0x6c, 0x6c, 0x144
+  .word 0x30, 0x6c, 0x6c, 0x144
+  .word 0x10, 0x6c, 0x10, 0xe8
+  .word 0x20, 0x6c, 0x10, 0xe8
+  .word 0x30, 0x6c, 0x10, 0x30
+  .word 0x10, 0x215b8, 0x100, 0x42c70
+  .word 0x20, 0x215b8, 0x100, 0x42c70
+  .word 0x30, 0x215b8, 0x100, 0x300
+  .word 0x10, 0x215b8, 0x1000000, 0x1042b70
+  .word 0x20, 0x215b8, 0x1000000, 0x1042b70
+  .word 0x30, 0x215b8, 0x1000000, 0x3000000
+  .word 0x10, 0x215b8, 0x215b8, 0x64128
+  .word 0x20, 0x215b8, 0x215b8, 0x64128
+  .word 0x30, 0x215b8, 0x215b8, 0x64128
+  .word 0x10, 0x215b8, 0xd28fd14, 0xd2d2884
+  .word 0x20, 0x215b8, 0xd28fd14, 0xd2d2884
+  .word 0x30, 0x215b8, 0xd28fd14, 0x277af73c
+  .word 0x10, 0xe69, 0x8000, 0x9cd2
+  .word 0x20, 0xe69, 0x8000, 0x9cd2
+  .word 0x30, 0xe69, 0x8000, 0x18000
+  .word 0x10, 0xe69, 0xff00ff00, 0xff011bd2
+  .word 0x20, 0xe69, 0xff00ff00, 0xff011bd2
+  .word 0x30, 0xe69, 0xff00ff00, 0xfd02fd00
+  .word 0x10, 0xe69, 0xe69, 0x2b3b
+  .word 0x20, 0xe69, 0xe69, 0x2b3b
+  .word 0x30, 0xe69, 0xe69, 0x2b3b
+  .word 0x10, 0x73698785, 0x0, 0xe6d30f0a
+  .word 0x20, 0x73698785, 0x0, 0xe6d30f0a
+  .word 0x30, 0x73698785, 0x0, 0x0
+  .word 0x10, 0x73698785, 0x10000, 0xe6d40f0a
+  .word 0x20, 0x73698785, 0x10000, 0xe6d40f0a
+  .word 0x30, 0x73698785, 0x10000, 0x30000
+  .word 0x10, 0x73698785, 0x10080, 0xe6d40f8a
+  .word 0x20, 0x73698785, 0x10080, 0xe6d40f8a
+  .word 0x30, 0x73698785, 0x10080, 0x30180
+  .word 0x10, 0x73698785, 0x73698785, 0x5a3c968f
+  .word 0x20, 0x73698785, 0x73698785, 0x5a3c968f
+  .word 0x30, 0x73698785, 0x73698785, 0x5a3c968f
+  .word 0x10, 0x1, 0x2, 0x4
+  .word 0x20, 0x1, 0x2, 0x4
+  .word 0x30, 0x1, 0x2, 0x6
+  .word 0x10, 0x1, 0x80000000, 0x80000002
+  .word 0x20, 0x1, 0x80000000, 0x80000002
+  .word 0x30, 0x1, 0x80000000, 0x80000000
+  .word 0x10, 0x1, 0x723b417, 0x723b419
+  .word 0x20, 0x1, 0x723b417, 0x723b419
+  .word 0x30, 0x1, 0x723b417, 0x156b1c45
+  .word 0x10, 0x1, 0x1, 0x3
+  .word 0x20, 0x1, 0x1, 0x3
+  .word 0x30, 0x1, 0x1, 0x3
+  .word 0x10, 0x10, 0x80, 0xa0
+  .word 0x20, 0x10, 0x80, 0xa0
+  .word 0x30, 0x10, 0x80, 0x180
+  .word 0x10, 0x10, 0xfffffffe, 0x1e
+  .word 0x20, 0x10, 0xfffffffe, 0x1e
+  .word 0x30, 0x10, 0xfffffffe, 0xfffffffa
+  .word 0x10, 0x10, 0x6c, 0x8c
+  .word 0x20, 0x10, 0x6c, 0x8c
+  .word 0x30, 0x10, 0x6c, 0x144
+  .word 0x10, 0x10, 0x10, 0x30
+  .word 0x20, 0x10, 0x10, 0x30
+  .word 0x30, 0x10, 0x10, 0x30
+  .word 0x10, 0xd28fd14, 0x100, 0x1a51fb28
+  .word 0x20, 0xd28fd14, 0x100, 0x1a51fb28
+  .word 0x30, 0xd28fd14, 0x100, 0x300
+  .word 0x10, 0xd28fd14, 0x1000000, 0x1b51fa28
+  .word 0x20, 0xd28fd14, 0x1000000, 0x1b51fa28
+  .word 0x30, 0xd28fd14, 0x1000000, 0x3000000
+  .word 0x10, 0xd28fd14, 0x215b8, 0x1a540fe0
+  .word 0x20, 0xd28fd14, 0x215b8, 0x1a540fe0
+  .word 0x30, 0xd28fd14, 0x215b8, 0x64128
+  .word 0x10, 0xd28fd14, 0xd28fd14, 0x277af73c
+  .word 0x20, 0xd28fd14, 0xd28fd14, 0x277af73c
+  .word 0x30, 0xd28fd14, 0xd28fd14, 0x277af73c
+  .word 0x40, 0x0, 0x12345687, 0x12345687
+  .word 0x50, 0x87654321, 0x0, 0xeca8642
+  .word 0x60, 0x0, 0x0, 0x0
+  .word 0x60, 0x0, 0x2, 0x2
+  .word 0x60, 0x0, 0x80, 0x80
+  .word 0x60, 0x0, 0x100, 0x100
+  .word 0x60, 0x0, 0x8000, 0x8000
+  .word 0x60, 0x0, 0x10000, 0x10000
+  .word 0x60, 0x0, 0x80000000, 0x80000000
+  .word 0x60, 0x0, 0xfffffffe, 0xfffffffe
+  .word 0x60, 0x0, 0x1000000, 0x1000000
+  .word 0x60, 0x0, 0xff00ff00, 0xff00ff00
+  .word 0x60, 0x0, 0x10080, 0x10080
+  .word 0x60, 0x0, 0x723b417, 0x723b417
+  .word 0x60, 0x0, 0x6c, 0x6c
+  .word 0x60, 0x0, 0x215b8, 0x215b8
+  .word 0x60, 0x0, 0xe69, 0xe69
+  .word 0x60, 0x0, 0x73698785, 0x73698785
+  .word 0x60, 0x0, 0x1, 0x1
+  .word 0x60, 0x0, 0x10, 0x10
+  .word 0x60, 0x0, 0xd28fd14, 0xd28fd14
+  .word 0x60, 0x2, 0x0, 0x8
+  .word 0x60, 0x2, 0x2, 0xa
+  .word 0x60, 0x2, 0x80, 0x88
+  .word 0x60, 0x2, 0x100, 0x108
+  .word 0x60, 0x2, 0x8000, 0x8008
+  .word 0x60, 0x2, 0x10000, 0x10008
+  .word 0x60, 0x2, 0x80000000, 0x80000008
+  .word 0x60, 0x2, 0xfffffffe, 0x6
+  .word 0x60, 0x2, 0x1000000, 0x1000008
+  .word 0x60, 0x2, 0xff00ff00, 0xff00ff08
+  .word 0x60, 0x2, 0x10080, 0x10088
+  .word 0x60, 0x2, 0x723b417, 0x723b41f
+  .word 0x60, 0x2, 0x6c, 0x74
+  .word 0x60, 0x2, 0x215b8, 0x215c0
+  .word 0x60, 0x2, 0xe69, 0xe71
+  .word 0x60, 0x2, 0x73698785, 0x7369878d
+  .word 0x60, 0x2, 0x1, 0x9
+  .word 0x60, 0x2, 0x10, 0x18
+  .word 0x60, 0x2, 0xd28fd14, 0xd28fd1c
+  .word 0x60, 0x80, 0x0, 0x200
+  .word 0x60, 0x80, 0x2, 0x202
+  .word 0x60, 0x80, 0x80, 0x280
+  .word 0x60, 0x80, 0x100, 0x300
+  .word 0x60, 0x80, 0x8000, 0x8200
+  .word 0x60, 0x80, 0x10000, 0x10200
+  .word 0x60, 0x80, 0x80000000, 0x80000200
+  .word 0x60, 0x80, 0xfffffffe, 0x1fe
+  .word 0x60, 0x80, 0x1000000, 0x1000200
+  .word 0x60, 0x80, 0xff00ff00, 0xff010100
+  .word 0x60, 0x80, 0x10080, 0x10280
+  .word 0x60, 0x80, 0x723b417, 0x723b617
+  .word 0x60, 0x80, 0x6c, 0x26c
+  .word 0x60, 0x80, 0x215b8, 0x217b8
+  .word 0x60, 0x80, 0xe69, 0x1069
+  .word 0x60, 0x80, 0x73698785, 0x73698985
+  .word 0x60, 0x80, 0x1, 0x201
+  .word 0x60, 0x80, 0x10, 0x210
+  .word 0x60, 0x80, 0xd28fd14, 0xd28ff14
+  .word 0x60, 0x100, 0x0, 0x400
+  .word 0x60, 0x100, 0x2, 0x402
+  .word 0x60, 0x100, 0x80, 0x480
+  .word 0x60, 0x100, 0x100, 0x500
+  .word 0x60, 0x100, 0x8000, 0x8400
+  .word 0x60, 0x100, 0x10000, 0x10400
+  .word 0x60, 0x100, 0x80000000, 0x80000400
+  .word 0x60, 0x100, 0xfffffffe, 0x3fe
+  .word 0x60, 0x100, 0x1000000, 0x1000400
+  .word 0x60, 0x100, 0xff00ff00, 0xff010300
+  .word 0x60, 0x100, 0x10080, 0x10480
+  .word 0x60, 0x100, 0x723b417, 0x723b817
+  .word 0x60, 0x100, 0x6c, 0x46c
+  .word 0x60, 0x100, 0x215b8, 0x219b8
+  .word 0x60, 0x100, 0xe69, 0x1269
+  .word 0x60, 0x100, 0x73698785, 0x73698b85
+  .word 0x60, 0x100, 0x1, 0x401
+  .word 0x60, 0x100, 0x10, 0x410
+  .word 0x60, 0x100, 0xd28fd14, 0xd290114
+  .word 0x60, 0x8000, 0x0, 0x20000
+  .word 0x60, 0x8000, 0x2, 0x20002
+  .word 0x60, 0x8000, 0x80, 0x20080
+  .word 0x60, 0x8000, 0x100, 0x20100
+  .word 0x60, 0x8000, 0x8000, 0x28000
+  .word 0x60, 0x8000, 0x10000, 0x30000
+  .word 0x60, 0x8000, 0x80000000, 0x80020000
+  .word 0x60, 0x8000, 0xfffffffe, 0x1fffe
+  .word 0x60, 0x8000, 0x1000000, 0x1020000
+  .word 0x60, 0x8000, 0xff00ff00, 0xff02ff00
+  .word 0x60, 0x8000, 0x10080, 0x30080
+  .word 0x60, 0x8000, 0x723b417, 0x725b417
+  .word 0x60, 0x8000, 0x6c, 0x2006c
+  .word 0x60, 0x8000, 0x215b8, 0x415b8
+  .word 0x60, 0x8000, 0xe69, 0x20e69
+  .word 0x60, 0x8000, 0x73698785, 0x736b8785
+  .word 0x60, 0x8000, 0x1, 0x20001
+  .word 0x60, 0x8000, 0x10, 0x20010
+  .word 0x60, 0x8000, 0xd28fd14, 0xd2afd14
+  .word 0x60, 0x10000, 0x0, 0x40000
+  .word 0x60, 0x10000, 0x2, 0x40002
+  .word 0x60, 0x10000, 0x80, 0x40080
+  .word 0x60, 0x10000, 0x100, 0x40100
+  .word 0x60, 0x10000, 0x8000, 0x48000
+  .word 0x60, 0x10000, 0x10000, 0x50000
+  .word 0x60, 0x10000, 0x80000000, 0x80040000
+  .word 0x60, 0x10000, 0xfffffffe, 0x3fffe
+  .word 0x60, 0x10000, 0x1000000, 0x1040000
+  .word 0x60, 0x10000, 0xff00ff00, 0xff04ff00
+  .word 0x60, 0x10000, 0x10080, 0x50080
+  .word 0x60, 0x10000, 0x723b417, 0x727b417
+  .word 0x60, 0x10000, 0x6c, 0x4006c
+  .word 0x60, 0x10000, 0x215b8, 0x615b8
+  .word 0x60, 0x10000, 0xe69, 0x40e69
+  .word 0x60, 0x10000, 0x73698785, 0x736d8785
+  .word 0x60, 0x10000, 0x1, 0x40001
+  .word 0x60, 0x10000, 0x10, 0x40010
+  .word 0x60, 0x10000, 0xd28fd14, 0xd2cfd14
+  .word 0x60, 0x80000000, 0x0, 0x0
+  .word 0x60, 0x80000000, 0x2, 0x2
+  .word 0x60, 0x80000000, 0x80, 0x80
+  .word 0x60, 0x80000000, 0x100, 0x100
+  .word 0x60, 0x80000000, 0x8000, 0x8000
+  .word 0x60, 0x80000000, 0x10000, 0x10000
+  .word 0x60, 0x80000000, 0x80000000, 0x80000000
+  .word 0x60, 0x80000000, 0xfffffffe, 0xfffffffe
+  .word 0x60, 0x80000000, 0x1000000, 0x1000000
+  .word 0x60, 0x80000000, 0xff00ff00, 0xff00ff00
+  .word 0x60, 0x80000000, 0x10080, 0x10080
+  .word 0x60, 0x80000000, 0x723b417, 0x723b417
+  .word 0x60, 0x80000000, 0x6c, 0x6c
+  .word 0x60, 0x80000000, 0x215b8, 0x215b8
+  .word 0x60, 0x80000000, 0xe69, 0xe69
+  .word 0x60, 0x80000000, 0x73698785, 0x73698785
+  .word 0x60, 0x80000000, 0x1, 0x1
+  .word 0x60, 0x80000000, 0x10, 0x10
+  .word 0x60, 0x80000000, 0xd28fd14, 0xd28fd14
+  .word 0x60, 0xfffffffe, 0x0, 0xfffffff8
+  .word 0x60, 0xfffffffe, 0x2, 0xfffffffa
+  .word 0x60, 0xfffffffe, 0x80, 0x78
+  .word 0x60, 0xfffffffe, 0x100, 0xf8
+  .word 0x60, 0xfffffffe, 0x8000, 0x7ff8
+  .word 0x60, 0xfffffffe, 0x10000, 0xfff8
+  .word 0x60, 0xfffffffe, 0x80000000, 0x7ffffff8
+  .word 0x60, 0xfffffffe, 0xfffffffe, 0xfffffff6
+  .word 0x60, 0xfffffffe, 0x1000000, 0xfffff8
+  .word 0x60, 0xfffffffe, 0xff00ff00, 0xff00fef8
+  .word 0x60, 0xfffffffe, 0x10080, 0x10078
+  .word 0x60, 0xfffffffe, 0x723b417, 0x723b40f
+  .word 0x60, 0xfffffffe, 0x6c, 0x64
+  .word 0x60, 0xfffffffe, 0x215b8, 0x215b0
+  .word 0x60, 0xfffffffe, 0xe69, 0xe61
+  .word 0x60, 0xfffffffe, 0x73698785, 0x7369877d
+  .word 0x60, 0xfffffffe, 0x1, 0xfffffff9
+  .word 0x60, 0xfffffffe, 0x10, 0x8
+  .word 0x60, 0xfffffffe, 0xd28fd14, 0xd28fd0c
+  .word 0x60, 0x1000000, 0x0, 0x4000000
+  .word 0x60, 0x1000000, 0x2, 0x4000002
+  .word 0x60, 0x1000000, 0x80, 0x4000080
+  .word 0x60, 0x1000000, 0x100, 0x4000100
+  .word 0x60, 0x1000000, 0x8000, 0x4008000
+  .word 0x60, 0x1000000, 0x10000, 0x4010000
+  .word 0x60, 0x1000000, 0x80000000, 0x84000000
+  .word 0x60, 0x1000000, 0xfffffffe, 0x3fffffe
+  .word 0x60, 0x1000000, 0x1000000, 0x5000000
+  .word 0x60, 0x1000000, 0xff00ff00, 0x300ff00
+  .word 0x60, 0x1000000, 0x10080, 0x4010080
+  .word 0x60, 0x1000000, 0x723b417, 0xb23b417
+  .word 0x60, 0x1000000, 0x6c, 0x400006c
+  .word 0x60, 0x1000000, 0x215b8, 0x40215b8
+  .word 0x60, 0x1000000, 0xe69, 0x4000e69
+  .word 0x60, 0x1000000, 0x73698785, 0x77698785
+  .word 0x60, 0x1000000, 0x1, 0x4000001
+  .word 0x60, 0x1000000, 0x10, 0x4000010
+  .word 0x60, 0x1000000, 0xd28fd14, 0x1128fd14
+  .word 0x60, 0xff00ff00, 0x0, 0xfc03fc00
+  .word 0x60, 0xff00ff00, 0x2, 0xfc03fc02
+  .word 0x60, 0xff00ff00, 0x80, 0xfc03fc80
+  .word 0x60, 0xff00ff00, 0x100, 0xfc03fd00
+  .word 0x60, 0xff00ff00, 0x8000, 0xfc047c00
+  .word 0x60, 0xff00ff00, 0x10000, 0xfc04fc00
+  .word 0x60, 0xff00ff00, 0x80000000, 0x7c03fc00
+  .word 0x60, 0xff00ff00, 0xfffffffe, 0xfc03fbfe
+  .word 0x60, 0xff00ff00, 0x1000000, 0xfd03fc00
+  .word 0x60, 0xff00ff00, 0xff00ff00, 0xfb04fb00
+  .word 0x60, 0xff00ff00, 0x10080, 0xfc04fc80
+  .word 0x60, 0xff00ff00, 0x723b417, 0x327b017
+  .word 0x60, 0xff00ff00, 0x6c, 0xfc03fc6c
+  .word 0x60, 0xff00ff00, 0x215b8, 0xfc0611b8
+  .word 0x60, 0xff00ff00, 0xe69, 0xfc040a69
+  .word 0x60, 0xff00ff00, 0x73698785, 0x6f6d8385
+  .word 0x60, 0xff00ff00, 0x1, 0xfc03fc01
+  .word 0x60, 0xff00ff00, 0x10, 0xfc03fc10
+  .word 0x60, 0xff00ff00, 0xd28fd14, 0x92cf914
+  .word 0x60, 0x10080, 0x0, 0x40200
+  .word 0x60, 0x10080, 0x2, 0x40202
+  .word 0x60, 0x10080, 0x80, 0x40280
+  .word 0x60, 0x10080, 0x100, 0x40300
+  .word 0x60, 0x10080, 0x8000, 0x48200
+  .word 0x60, 0x10080, 0x10000, 0x50200
+  .word 0x60, 0x10080, 0x80000000, 0x80040200
+  .word 0x60, 0x10080, 0xfffffffe, 0x401fe
+  .word 0x60, 0x10080, 0x1000000, 0x1040200
+  .word 0x60, 0x10080, 0xff00ff00, 0xff050100
+  .word 0x60, 0x10080, 0x10080, 0x50280
+  .word 0x60, 0x10080, 0x723b417, 0x727b617
+  .word 0x60, 0x10080, 0x6c, 0x4026c
+  .word 0x60, 0x10080, 0x215b8, 0x617b8
+  .word 0x60, 0x10080, 0xe69, 0x41069
+  .word 0x60, 0x10080, 0x73698785, 0x736d8985
+  .word 0x60, 0x10080, 0x1, 0x40201
+  .word 0x60, 0x10080, 0x10, 0x40210
+  .word 0x60, 0x10080, 0xd28fd14, 0xd2cff14
+  .word 0x60, 0x723b417, 0x0, 0x1c8ed05c
+  .word 0x60, 0x723b417, 0x2, 0x1c8ed05e
+  .word 0x60, 0x723b417, 0x80, 0x1c8ed0dc
+  .word 0x60, 0x723b417, 0x100, 0x1c8ed15c
+  .word 0x60, 0x723b417, 0x8000, 0x1c8f505c
+  .word 0x60, 0x723b417, 0x10000, 0x1c8fd05c
+  .word 0x60, 0x723b417, 0x80000000, 0x9c8ed05c
+  .word 0x60, 0x723b417, 0xfffffffe, 0x1c8ed05a
+  .word 0x60, 0x723b417, 0x1000000, 0x1d8ed05c
+  .word 0x60, 0x723b417, 0xff00ff00, 0x1b8fcf5c
+  .word 0x60, 0x723b417, 0x10080, 0x1c8fd0dc
+  .word 0x60, 0x723b417, 0x723b417, 0x23b28473
+  .word 0x60, 0x723b417, 0x6c, 0x1c8ed0c8
+  .word 0x60, 0x723b417, 0x215b8, 0x1c90e614
+  .word 0x60, 0x723b417, 0xe69, 0x1c8edec5
+  .word 0x60, 0x723b417, 0x73698785, 0x8ff857e1
+  .word 0x60, 0x723b417, 0x1, 0x1c8ed05d
+  .word 0x60, 0x723b417, 0x10, 0x1c8ed06c
+  .word 0x60, 0x723b417, 0xd28fd14, 0x29b7cd70
+  .word 0x60, 0x6c, 0x0, 0x1b0
+  .word 0x60, 0x6c, 0x2, 0x1b2
+  .word 0x60, 0x6c, 0x80, 0x230
+  .word 0x60, 0x6c, 0x100, 0x2b0
+  .word 0x60, 0x6c, 0x8000, 0x81b0
+  .word 0x60, 0x6c, 0x10000, 0x101b0
+  .word 0x60, 0x6c, 0x80000000, 0x800001b0
+  .word 0x60, 0x6c, 0xfffffffe, 0x1ae
+  .word 0x60, 0x6c, 0x1000000, 0x10001b0
+  .word 0x60, 0x6c, 0xff00ff00, 0xff0100b0
+  .word 0x60, 0x6c, 0x10080, 0x10230
+  .word 0x60, 0x6c, 0x723b417, 0x723b5c7
+  .word 0x60, 0x6c, 0x6c, 0x21c
+  .word 0x60, 0x6c, 0x215b8, 0x21768
+  .word 0x60, 0x6c, 0xe69, 0x1019
+  .word 0x60, 0x6c, 0x73698785, 0x73698935
+  .word 0x60, 0x6c, 0x1, 0x1b1
+  .word 0x60, 0x6c, 0x10, 0x1c0
+  .word 0x60, 0x6c, 0xd28fd14, 0xd28fec4
+  .word 0x60, 0x215b8, 0x0, 0x856e0
+  .word 0x60, 0x215b8, 0x2, 0x856e2
+  .word 0x60, 0x215b8, 0x80, 0x85760
+  .word 0x60, 0x215b8, 0x100, 0x857e0
+  .word 0x60, 0x215b8, 0x8000, 0x8d6e0
+  .word 0x60, 0x215b8, 0x10000, 0x956e0
+  .word 0x60, 0x215b8, 0x80000000, 0x800856e0
+  .word 0x60, 0x215b8, 0xfffffffe, 0x856de
+  .word 0x60, 0x215b8, 0x1000000, 0x10856e0
+  .word 0x60, 0x215b8, 0xff00ff00, 0xff0955e0
+  .word 0x60, 0x215b8, 0x10080, 0x95760
+  .word 0x60, 0x215b8, 0x723b417, 0x72c0af7
+  .word 0x60, 0x215b8, 0x6c, 0x8574c
+  .word 0x60, 0x215b8, 0x215b8, 0xa6c98
+  .word 0x60, 0x215b8, 0xe69, 0x86549
+  .word 0x60, 0x215b8, 0x73698785, 0x7371de65
+  .word 0x60, 0x215b8, 0x1, 0x856e1
+  .word 0x60, 0x215b8, 0x10, 0x856f0
+  .word 0x60, 0x215b8, 0xd28fd14, 0xd3153f4
+  .word 0x60, 0xe69, 0x0, 0x39a4
+  .word 0x60, 0xe69, 0x2, 0x39a6
+  .word 0x60, 0xe69, 0x80, 0x3a24
+  .word 0x60, 0xe69, 0x100, 0x3aa4
+  .word 0x60, 0xe69, 0x8000, 0xb9a4
+  .word 0x60, 0xe69, 0x10000, 0x139a4
+  .word 0x60, 0xe69, 0x80000000, 0x800039a4
+  .word 0x60, 0xe69, 0xfffffffe, 0x39a2
+  .word 0x60, 0xe69, 0x1000000, 0x10039a4
+  .word 0x60, 0xe69, 0xff00ff00, 0xff0138a4
+  .word 0x60, 0xe69, 0x10080, 0x13a24
+  .word 0x60, 0xe69, 0x723b417, 0x723edbb
+  .word 0x60, 0xe69, 0x6c, 0x3a10
+  .word 0x60, 0xe69, 0x215b8, 0x24f5c
+  .word 0x60, 0xe69, 0xe69, 0x480d
+  .word 0x60, 0xe69, 0x73698785, 0x7369c129
+  .word 0x60, 0xe69, 0x1, 0x39a5
+  .word 0x60, 0xe69, 0x10, 0x39b4
+  .word 0x60, 0xe69, 0xd28fd14, 0xd2936b8
+  .word 0x60, 0x73698785, 0x0, 0xcda61e14
+  .word 0x60, 0x73698785, 0x2, 0xcda61e16
+  .word 0x60, 0x73698785, 0x80, 0xcda61e94
+  .word 0x60, 0x73698785, 0x100, 0xcda61f14
+  .word 0x60, 0x73698785, 0x8000, 0xcda69e14
+  .word 0x60, 0x73698785, 0x10000, 0xcda71e14
+  .word 0x60, 0x73698785, 0x80000000, 0x4da61e14
+  .word 0x60, 0x73698785, 0xfffffffe, 0xcda61e12
+  .word 0x60, 0x73698785, 0x1000000, 0xcea61e14
+  .word 0x60, 0x73698785, 0xff00ff00, 0xcca71d14
+  .word 0x60, 0x73698785, 0x10080, 0xcda71e94
+  .word 0x60, 0x73698785, 0x723b417, 0xd4c9d22b
+  .word 0x60, 0x73698785, 0x6c, 0xcda61e80
+  .word 0x60, 0x73698785, 0x215b8, 0xcda833cc
+  .word 0x60, 0x73698785, 0xe69, 0xcda62c7d
+  .word 0x60, 0x73698785, 0x73698785, 0x410fa599
+  .word 0x60, 0x73698785, 0x1, 0xcda61e15
+  .word 0x60, 0x73698785, 0x10, 0xcda61e24
+  .word 0x60, 0x73698785, 0xd28fd14, 0xdacf1b28
+  .word 0x60, 0x1, 0x0, 0x4
+  .word 0x60, 0x1, 0x2, 0x6
+  .word 0x60, 0x1, 0x80, 0x84
+  .word 0x60, 0x1, 0x100, 0x104
+  .word 0x60, 0x1, 0x8000, 0x8004
+  .word 0x60, 0x1, 0x10000, 0x10004
+  .word 0x60, 0x1, 0x80000000, 0x80000004
+  .word 0x60, 0x1, 0xfffffffe, 0x2
+  .word 0x60, 0x1, 0x1000000, 0x1000004
+  .word 0x60, 0x1, 0xff00ff00, 0xff00ff04
+  .word 0x60, 0x1, 0x10080, 0x10084
+  .word 0x60, 0x1, 0x723b417, 0x723b41b
+  .word 0x60, 0x1, 0x6c, 0x70
+  .word 0x60, 0x1, 0x215b8, 0x215bc
+  .word 0x60, 0x1, 0xe69, 0xe6d
+  .word 0x60, 0x1, 0x73698785, 0x73698789
+  .word 0x60, 0x1, 0x1, 0x5
+  .word 0x60, 0x1, 0x10, 0x14
+  .word 0x60, 0x1, 0xd28fd14, 0xd28fd18
+  .word 0x60, 0x10, 0x0, 0x40
+  .word 0x60, 0x10, 0x2, 0x42
+  .word 0x60, 0x10, 0x80, 0xc0
+  .word 0x60, 0x10, 0x100, 0x140
+  .word 0x60, 0x10, 0x8000, 0x8040
+  .word 0x60, 0x10, 0x10000, 0x10040
+  .word 0x60, 0x10, 0x80000000, 0x80000040
+  .word 0x60, 0x10, 0xfffffffe, 0x3e
+  .word 0x60, 0x10, 0x1000000, 0x1000040
+  .word 0x60, 0x10, 0xff00ff00, 0xff00ff40
+  .word 0x60, 0x10, 0x10080, 0x100c0
+  .word 0x60, 0x10, 0x723b417, 0x723b457
+  .word 0x60, 0x10, 0x6c, 0xac
+  .word 0x60, 0x10, 0x215b8, 0x215f8
+  .word 0x60, 0x10, 0xe69, 0xea9
+  .word 0x60, 0x10, 0x73698785, 0x736987c5
+  .word 0x60, 0x10, 0x1, 0x41
+  .word 0x60, 0x10, 0x10, 0x50
+  .word 0x60, 0x10, 0xd28fd14, 0xd28fd54
+  .word 0x60, 0xd28fd14, 0x0, 0x34a3f450
+  .word 0x60, 0xd28fd14, 0x2, 0x34a3f452
+  .word 0x60, 0xd28fd14, 0x80, 0x34a3f4d0
+  .word 0x60, 0xd28fd14, 0x100, 0x34a3f550
+  .word 0x60, 0xd28fd14, 0x8000, 0x34a47450
+  .word 0x60, 0xd28fd14, 0x10000, 0x34a4f450
+  .word 0x60, 0xd28fd14, 0x80000000, 0xb4a3f450
+  .word 0x60, 0xd28fd14, 0xfffffffe, 0x34a3f44e
+  .word 0x60, 0xd28fd14, 0x1000000, 0x35a3f450
+  .word 0x60, 0xd28fd14, 0xff00ff00, 0x33a4f350
+  .word 0x60, 0xd28fd14, 0x10080, 0x34a4f4d0
+  .word 0x60, 0xd28fd14, 0x723b417, 0x3bc7a867
+  .word 0x60, 0xd28fd14, 0x6c, 0x34a3f4bc
+  .word 0x60, 0xd28fd14, 0x215b8, 0x34a60a08
+  .word 0x60, 0xd28fd14, 0xe69, 0x34a402b9
+  .word 0x60, 0xd28fd14, 0x73698785, 0xa80d7bd5
+  .word 0x60, 0xd28fd14, 0x1, 0x34a3f451
+  .word 0x60, 0xd28fd14, 0x10, 0x34a3f460
+  .word 0x60, 0xd28fd14, 0xd28fd14, 0x41ccf164
+  .word 0x70, 0x0, 0x0, 0x0
+  .word 0x80, 0x0, 0x0, 0x0
+  .word 0x90, 0x0, 0x0, 0x0
+  .word 0x70, 0x0, 0x10000, 0x10000
+  .word 0x80, 0x0, 0x10000, 0x10000
+  .word 0x90, 0x0, 0x10000, 0x50000
+  .word 0x70, 0x0, 0x10080, 0x10080
+  .word 0x80, 0x0, 0x10080, 0x10080
+  .word 0x90, 0x0, 0x10080, 0x50280
+  .word 0x70, 0x0, 0x73698785, 0x73698785
+  .word 0x80, 0x0, 0x73698785, 0x73698785
+  .word 0x90, 0x0, 0x73698785, 0x410fa599
+  .word 0x70, 0x2, 0x2, 0xa
+  .word 0x80, 0x2, 0x2, 0xa
+  .word 0x90, 0x2, 0x2, 0xa
+  .word 0x70, 0x2, 0x80000000, 0x80000008
+  .word 0x80, 0x2, 0x80000000, 0x80000008
+  .word 0x90, 0x2, 0x80000000, 0x80000000
+  .word 0x70, 0x2, 0x723b417, 0x723b41f
+  .word 0x80, 0x2, 0x723b417, 0x723b41f
+  .word 0x90, 0x2, 0x723b417, 0x23b28473
+  .word 0x70, 0x2, 0x1, 0x9
+  .word 0x80, 0x2, 0x1, 0x9
+  .word 0x90, 0x2, 0x1, 0x5
+  .word 0x70, 0x80, 0x80, 0x280
+  .word 0x80, 0x80, 0x80, 0x280
+  .word 0x90, 0x80, 0x80, 0x280
+  .word 0x70, 0x80, 0xfffffffe, 0x1fe
+  .word 0x80, 0x80, 0xfffffffe, 0x1fe
+  .word 0x90, 0x80, 0xfffffffe, 0xfffffff6
+  .word 0x70, 0x80, 0x6c, 0x26c
+  .word 0x80, 0x80, 0x6c, 0x26c
+  .word 0x90, 0x80, 0x6c, 0x21c
+  .word 0x70, 0x80, 0x10, 0x210
+  .word 0x80, 0x80, 0x10, 0x210
+  .word 0x90, 0x80, 0x10, 0x50
+  .word 0x70, 0x100, 0x100, 0x500
+  .word 0x80, 0x100, 0x100, 0x500
+  .word 0x90, 0x100, 0x100, 0x500
+  .word 0x70, 0x100, 0x1000000, 0x1000400
+  .word 0x80, 0x100, 0x1000000, 0x1000400
+  .word 0x90, 0x100, 0x1000000, 0x5000000
+  .word 0x70, 0x100, 0x215b8, 0x219b8
+  .word 0x80, 0x100, 0x215b8, 0x219b8
+  .word 0x90, 0x100, 0x215b8, 0xa6c98
+  .word 0x70, 0x100, 0xd28fd14, 0xd290114
+  .word 0x80, 0x100, 0xd28fd14, 0xd290114
+  .word 0x90, 0x100, 0xd28fd14, 0x41ccf164
+  .word 0x70, 0x8000, 0x8000, 0x28000
+  .word 0x80, 0x8000, 0x8000, 0x28000
+  .word 0x90, 0x8000, 0x8000, 0x28000
+  .word 0x70, 0x8000, 0xff00ff00, 0xff02ff00
+  .word 0x80, 0x8000, 0xff00ff00, 0xff02ff00
+  .word 0x90, 0x8000, 0xff00ff00, 0xfb04fb00
+  .word 0x70, 0x8000, 0xe69, 0x20e69
+  .word 0x80, 0x8000, 0xe69, 0x20e69
+  .word 0x90, 0x8000, 0xe69, 0x480d
+  .word 0x70, 0x10000, 0x0, 0x40000
+  .word 0x80, 0x10000, 0x0, 0x40000
+  .word 0x90, 0x10000, 0x0, 0x0
+  .word 0x70, 0x10000, 0x10000, 0x50000
+  .word 0x80, 0x10000, 0x10000, 0x50000
+  .word 0x90, 0x10000, 0x10000, 0x50000
+  .word 0x70, 0x10000, 0x10080, 0x50080
+  .word 0x80, 0x10000, 0x10080, 0x50080
+  .word 0x90, 0x10000, 0x10080, 0x50280
+  .word 0x70, 0x10000, 0x73698785, 0x736d8785
+  .word 0x80, 0x10000, 0x73698785, 0x736d8785
+  .word 0x90, 0x10000, 0x73698785, 0x410fa599
+  .word 0x70, 0x80000000, 0x2, 0x2
+  .word 0x80, 0x80000000, 0x2, 0x2
+  .word 0x90, 0x80000000, 0x2, 0xa
+  .word 0x70, 0x80000000, 0x80000000, 0x80000000
+  .word 0x80, 0x80000000, 0x80000000, 0x80000000
+  .word 0x90, 0x80000000, 0x80000000, 0x80000000
+  .word 0x70, 0x80000000, 0x723b417, 0x723b417
+  .word 0x80, 0x80000000, 0x723b417, 0x723b417
+  .word 0x90, 0x80000000, 0x723b417, 0x23b28473
+  .word 0x70, 0x80000000, 0x1, 0x1
+  .word 0x80, 0x80000000, 0x1, 0x1
+  .word 0x90, 0x80000000, 0x1, 0x5
+  .word 0x70, 0xfffffffe, 0x80, 0x78
+  .word 0x80, 0xfffffffe, 0x80, 0x78
+  .word 0x90, 0xfffffffe, 0x80, 0x280
+  .word 0x70, 0xfffffffe, 0xfffffffe, 0xfffffff6
+  .word 0x80, 0xfffffffe, 0xfffffffe, 0xfffffff6
+  .word 0x90, 0xfffffffe, 0xfffffffe, 0xfffffff6
+  .word 0x70, 0xfffffffe, 0x6c, 0x64
+  .word 0x80, 0xfffffffe, 0x6c, 0x64
+  .word 0x90, 0xfffffffe, 0x6c, 0x21c
+  .word 0x70, 0xfffffffe, 0x10, 0x8
+  .word 0x80, 0xfffffffe, 0x10, 0x8
+  .word 0x90, 0xfffffffe, 0x10, 0x50
+  .word 0x70, 0x1000000, 0x100, 0x4000100
+  .word 0x80, 0x1000000, 0x100, 0x4000100
+  .word 0x90, 0x1000000, 0x100, 0x500
+  .word 0x70, 0x1000000, 0x1000000, 0x5000000
+  .word 0x80, 0x1000000, 0x1000000, 0x5000000
+  .word 0x90, 0x1000000, 0x1000000, 0x5000000
+  .word 0x70, 0x1000000, 0x215b8, 0x40215b8
+  .word 0x80, 0x1000000, 0x215b8, 0x40215b8
+  .word 0x90, 0x1000000, 0x215b8, 0xa6c98
+  .word 0x70, 0x1000000, 0xd28fd14, 0x1128fd14
+  .word 0x80, 0x1000000, 0xd28fd14, 0x1128fd14
+  .word 0x90, 0x1000000, 0xd28fd14, 0x41ccf164
+  .word 0x70, 0xff00ff00, 0x8000, 0xfc047c00
+  .word 0x80, 0xff00ff00, 0x8000, 0xfc047c00
+  .word 0x90, 0xff00ff00, 0x8000, 0x28000
+  .word 0x70, 0xff00ff00, 0xff00ff00, 0xfb04fb00
+  .word 0x80, 0xff00ff00, 0xff00ff00, 0xfb04fb00
+  .word 0x90, 0xff00ff00, 0xff00ff00, 0xfb04fb00
+  .word 0x70, 0xff00ff00, 0xe69, 0xfc040a69
+  .word 0x80, 0xff00ff00, 0xe69, 0xfc040a69
+  .word 0x90, 0xff00ff00, 0xe69, 0x480d
+  .word 0x70, 0x10080, 0x0, 0x40200
+  .word 0x80, 0x10080, 0x0, 0x40200
+  .word 0x90, 0x10080, 0x0, 0x0
+  .word 0x70, 0x10080, 0x10000, 0x50200
+  .word 0x80, 0x10080, 0x10000, 0x50200
+  .word 0x90, 0x10080, 0x10000, 0x50000
+  .word 0x70, 0x10080, 0x10080, 0x50280
+  .word 0x80, 0x10080, 0x10080, 0x50280
+  .word 0x90, 0x10080, 0x10080, 0x50280
+  .word 0x70, 0x10080, 0x73698785, 0x736d8985
+  .word 0x80, 0x10080, 0x73698785, 0x736d8985
+  .word 0x90, 0x10080, 0x73698785, 0x410fa599
+  .word 0x70, 0x723b417, 0x2, 0x1c8ed05e
+  .word 0x80, 0x723b417, 0x2, 0x1c8ed05e
+  .word 0x90, 0x723b417, 0x2, 0xa
+  .word 0x70, 0x723b417, 0x80000000, 0x9c8ed05c
+  .word 0x80, 0x723b417, 0x80000000, 0x9c8ed05c
+  .word 0x90, 0x723b417, 0x80000000, 0x80000000
+  .word 0x70, 0x723b417, 0x723b417, 0x23b28473
+  .word 0x80, 0x723b417, 0x723b417, 0x23b28473
+  .word 0x90, 0x723b417, 0x723b417, 0x23b28473
+  .word 0x70, 0x723b417, 0x1, 0x1c8ed05d
+  .word 0x80, 0x723b417, 0x1, 0x1c8ed05d
+  .word 0x90, 0x723b417, 0x1, 0x5
+  .word 0x70, 0x6c, 0x80, 0x230
+  .word 0x80, 0x6c, 0x80, 0x230
+  .word 0x90, 0x6c, 0x80, 0x280
+  .word 0x70, 0x6c, 0xfffffffe, 0x1ae
+  .word 0x80, 0x6c, 0xfffffffe, 0x1ae
+  .word 0x90, 0x6c, 0xfffffffe, 0xfffffff6
+  .word 0x70, 0x6c, 0x6c, 0x21c
+  .word 0x80, 0x6c, 0x6c, 0x21c
+  .word 0x90, 0x6c, 0x6c, 0x21c
+  .word 0x70, 0x6c, 0x10, 0x1c0
+  .word 0x80, 0x6c, 0x10, 0x1c0
+  .word 0x90, 0x6c, 0x10, 0x50
+  .word 0x70, 0x215b8, 0x100, 0x857e0
+  .word 0x80, 0x215b8, 0x100, 0x857e0
+  .word 0x90, 0x215b8, 0x100, 0x500
+  .word 0x70, 0x215b8, 0x1000000, 0x10856e0
+  .word 0x80, 0x215b8, 0x1000000, 0x10856e0
+  .word 0x90, 0x215b8, 0x1000000, 0x5000000
+  .word 0x70, 0x215b8, 0x215b8, 0xa6c98
+  .word 0x80, 0x215b8, 0x215b8, 0xa6c98
+  .word 0x90, 0x215b8, 0x215b8, 0xa6c98
+  .word 0x70, 0x215b8, 0xd28fd14, 0xd3153f4
+  .word 0x80, 0x215b8, 0xd28fd14, 0xd3153f4
+  .word 0x90, 0x215b8, 0xd28fd14, 0x41ccf164
+  .word 0x70, 0xe69, 0x8000, 0xb9a4
+  .word 0x80, 0xe69, 0x8000, 0xb9a4
+  .word 0x90, 0xe69, 0x8000, 0x28000
+  .word 0x70, 0xe69, 0xff00ff00, 0xff0138a4
+  .word 0x80, 0xe69, 0xff00ff00, 0xff0138a4
+  .word 0x90, 0xe69, 0xff00ff00, 0xfb04fb00
+  .word 0x70, 0xe69, 0xe69, 0x480d
+  .word 0x80, 0xe69, 0xe69, 0x480d
+  .word 0x90, 0xe69, 0xe69, 0x480d
+  .word 0x70, 0x73698785, 0x0, 0xcda61e14
+  .word 0x80, 0x73698785, 0x0, 0xcda61e14
+  .word 0x90, 0x73698785, 0x0, 0x0
+  .word 0x70, 0x73698785, 0x10000, 0xcda71e14
+  .word 0x80, 0x73698785, 0x10000, 0xcda71e14
+  .word 0x90, 0x73698785, 0x10000, 0x50000
+  .word 0x70, 0x73698785, 0x10080, 0xcda71e94
+  .word 0x80, 0x73698785, 0x10080, 0xcda71e94
+  .word 0x90, 0x73698785, 0x10080, 0x50280
+  .word 0x70, 0x73698785, 0x73698785, 0x410fa599
+  .word 0x80, 0x73698785, 0x73698785, 0x410fa599
+  .word 0x90, 0x73698785, 0x73698785, 0x410fa599
+  .word 0x70, 0x1, 0x2, 0x6
+  .word 0x80, 0x1, 0x2, 0x6
+  .word 0x90, 0x1, 0x2, 0xa
+  .word 0x70, 0x1, 0x80000000, 0x80000004
+  .word 0x80, 0x1, 0x80000000, 0x80000004
+  .word 0x90, 0x1, 0x80000000, 0x80000000
+  .word 0x70, 0x1, 0x723b417, 0x723b41b
+  .word 0x80, 0x1, 0x723b417, 0x723b41b
+  .word 0x90, 0x1, 0x723b417, 0x23b28473
+  .word 0x70, 0x1, 0x1, 0x5
+  .word 0x80, 0x1, 0x1, 0x5
+  .word 0x90, 0x1, 0x1, 0x5
+  .word 0x70, 0x10, 0x80, 0xc0
+  .word 0x80, 0x10, 0x80, 0xc0
+  .word 0x90, 0x10, 0x80, 0x280
+  .word 0x70, 0x10, 0xfffffffe, 0x3e
+  .word 0x80, 0x10, 0xfffffffe, 0x3e
+  .word 0x90, 0x10, 0xfffffffe, 0xfffffff6
+  .word 0x70, 0x10, 0x6c, 0xac
+  .word 0x80, 0x10, 0x6c, 0xac
+  .word 0x90, 0x10, 0x6c, 0x21c
+  .word 0x70, 0x10, 0x10, 0x50
+  .word 0x80, 0x10, 0x10, 0x50
+  .word 0x90, 0x10, 0x10, 0x50
+  .word 0x70, 0xd28fd14, 0x100, 0x34a3f550
+  .word 0x80, 0xd28fd14, 0x100, 0x34a3f550
+  .word 0x90, 0xd28fd14, 0x100, 0x500
+  .word 0x70, 0xd28fd14, 0x1000000, 0x35a3f450
+  .word 0x80, 0xd28fd14, 0x1000000, 0x35a3f450
+  .word 0x90, 0xd28fd14, 0x1000000, 0x5000000
+  .word 0x70, 0xd28fd14, 0x215b8, 0x34a60a08
+  .word 0x80, 0xd28fd14, 0x215b8, 0x34a60a08
+  .word 0x90, 0xd28fd14, 0x215b8, 0xa6c98
+  .word 0x70, 0xd28fd14, 0xd28fd14, 0x41ccf164
+  .word 0x80, 0xd28fd14, 0xd28fd14, 0x41ccf164
+  .word 0x90, 0xd28fd14, 0xd28fd14, 0x41ccf164
+  .word 0xa0, 0x0, 0x12345687, 0x12345687
+  .word 0xb0, 0x87654321, 0x0, 0x1d950c84
+  .word 0xc0, 0x0, 0x0, 0x0
+  .word 0xc0, 0x0, 0x2, 0x2
+  .word 0xc0, 0x0, 0x80, 0x80
+  .word 0xc0, 0x0, 0x100, 0x100
+  .word 0xc0, 0x0, 0x8000, 0x8000
+  .word 0xc0, 0x0, 0x10000, 0x10000
+  .word 0xc0, 0x0, 0x80000000, 0x80000000
+  .word 0xc0, 0x0, 0xfffffffe, 0xfffffffe
+  .word 0xc0, 0x0, 0x1000000, 0x1000000
+  .word 0xc0, 0x0, 0xff00ff00, 0xff00ff00
+  .word 0xc0, 0x0, 0x10080, 0x10080
+  .word 0xc0, 0x0, 0x723b417, 0x723b417
+  .word 0xc0, 0x0, 0x6c, 0x6c
+  .word 0xc0, 0x0, 0x215b8, 0x215b8
+  .word 0xc0, 0x0, 0xe69, 0xe69
+  .word 0xc0, 0x0, 0x73698785, 0x73698785
+  .word 0xc0, 0x0, 0x1, 0x1
+  .word 0xc0, 0x0, 0x10, 0x10
+  .word 0xc0, 0x0, 0xd28fd14, 0xd28fd14
+  .word 0xc0, 0x2, 0x0, 0x10
+  .word 0xc0, 0x2, 0x2, 0x12
+  .word 0xc0, 0x2, 0x80, 0x90
+  .word 0xc0, 0x2, 0x100, 0x110
+  .word 0xc0, 0x2, 0x8000, 0x8010
+  .word 0xc0, 0x2, 0x10000, 0x10010
+  .word 0xc0, 0x2, 0x80000000, 0x80000010
+  .word 0xc0, 0x2, 0xfffffffe, 0xe
+  .word 0xc0, 0x2, 0x1000000, 0x1000010
+  .word 0xc0, 0x2, 0xff00ff00, 0xff00ff10
+  .word 0xc0, 0x2, 0x10080, 0x10090
+  .word 0xc0, 0x2, 0x723b417, 0x723b427
+  .word 0xc0, 0x2, 0x6c, 0x7c
+  .word 0xc0, 0x2, 0x215b8, 0x215c8
+  .word 0xc0, 0x2, 0xe69, 0xe79
+  .word 0xc0, 0x2, 0x73698785, 0x73698795
+  .word 0xc0, 0x2, 0x1, 0x11
+  .word 0xc0, 0x2, 0x10, 0x20
+  .word 0xc0, 0x2, 0xd28fd14, 0xd28fd24
+  .word 0xc0, 0x80, 0x0, 0x400
+  .word 0xc0, 0x80, 0x2, 0x402
+  .word 0xc0, 0x80, 0x80, 0x480
+  .word 0xc0, 0x80, 0x100, 0x500
+  .word 0xc0, 0x80, 0x8000, 0x8400
+  .word 0xc0, 0x80, 0x10000, 0x10400
+  .word 0xc0, 0x80, 0x80000000, 0x80000400
+  .word 0xc0, 0x80, 0xfffffffe, 0x3fe
+  .word 0xc0, 0x80, 0x1000000, 0x1000400
+  .word 0xc0, 0x80, 0xff00ff00, 0xff010300
+  .word 0xc0, 0x80, 0x10080, 0x10480
+  .word 0xc0, 0x80, 0x723b417, 0x723b817
+  .word 0xc0, 0x80, 0x6c, 0x46c
+  .word 0xc0, 0x80, 0x215b8, 0x219b8
+  .word 0xc0, 0x80, 0xe69, 0x1269
+  .word 0xc0, 0x80, 0x73698785, 0x73698b85
+  .word 0xc0, 0x80, 0x1, 0x401
+  .word 0xc0, 0x80, 0x10, 0x410
+  .word 0xc0, 0x80, 0xd28fd14, 0xd290114
+  .word 0xc0, 0x100, 0x0, 0x800
+  .word 0xc0, 0x100, 0x2, 0x802
+  .word 0xc0, 0x100, 0x80, 0x880
+  .word 0xc0, 0x100, 0x100, 0x900
+  .word 0xc0, 0x100, 0x8000, 0x8800
+  .word 0xc0, 0x100, 0x10000, 0x10800
+  .word 0xc0, 0x100, 0x80000000, 0x80000800
+  .word 0xc0, 0x100, 0xfffffffe, 0x7fe
+  .word 0xc0, 0x100, 0x1000000, 0x1000800
+  .word 0xc0, 0x100, 0xff00ff00, 0xff010700
+  .word 0xc0, 0x100, 0x10080, 0x10880
+  .word 0xc0, 0x100, 0x723b417, 0x723bc17
+  .word 0xc0, 0x100, 0x6c, 0x86c
+  .word 0xc0, 0x100, 0x215b8, 0x21db8
+  .word 0xc0, 0x100, 0xe69, 0x1669
+  .word 0xc0, 0x100, 0x73698785, 0x73698f85
+  .word 0xc0, 0x100, 0x1, 0x801
+  .word 0xc0, 0x100, 0x10, 0x810
+  .word 0xc0, 0x100, 0xd28fd14, 0xd290514
+  .word 0xc0, 0x8000, 0x0, 0x40000
+  .word 0xc0, 0x8000, 0x2, 0x40002
+  .word 0xc0, 0x8000, 0x80, 0x40080
+  .word 0xc0, 0x8000, 0x100, 0x40100
+  .word 0xc0, 0x8000, 0x8000, 0x48000
+  .word 0xc0, 0x8000, 0x10000, 0x50000
+  .word 0xc0, 0x8000, 0x80000000, 0x80040000
+  .word 0xc0, 0x8000, 0xfffffffe, 0x3fffe
+  .word 0xc0, 0x8000, 0x1000000, 0x1040000
+  .word 0xc0, 0x8000, 0xff00ff00, 0xff04ff00
+  .word 0xc0, 0x8000, 0x10080, 0x50080
+  .word 0xc0, 0x8000, 0x723b417, 0x727b417
+  .word 0xc0, 0x8000, 0x6c, 0x4006c
+  .word 0xc0, 0x8000, 0x215b8, 0x615b8
+  .word 0xc0, 0x8000, 0xe69, 0x40e69
+  .word 0xc0, 0x8000, 0x73698785, 0x736d8785
+  .word 0xc0, 0x8000, 0x1, 0x40001
+  .word 0xc0, 0x8000, 0x10, 0x40010
+  .word 0xc0, 0x8000, 0xd28fd14, 0xd2cfd14
+  .word 0xc0, 0x10000, 0x0, 0x80000
+  .word 0xc0, 0x10000, 0x2, 0x80002
+  .word 0xc0, 0x10000, 0x80, 0x80080
+  .word 0xc0, 0x10000, 0x100, 0x80100
+  .word 0xc0, 0x10000, 0x8000, 0x88000
+  .word 0xc0, 0x10000, 0x10000, 0x90000
+  .word 0xc0, 0x10000, 0x80000000, 0x80080000
+  .word 0xc0, 0x10000, 0xfffffffe, 0x7fffe
+  .word 0xc0, 0x10000, 0x1000000, 0x1080000
+  .word 0xc0, 0x10000, 0xff00ff00, 0xff08ff00
+  .word 0xc0, 0x10000, 0x10080, 0x90080
+  .word 0xc0, 0x10000, 0x723b417, 0x72bb417
+  .word 0xc0, 0x10000, 0x6c, 0x8006c
+  .word 0xc0, 0x10000, 0x215b8, 0xa15b8
+  .word 0xc0, 0x10000, 0xe69, 0x80e69
+  .word 0xc0, 0x10000, 0x73698785, 0x73718785
+  .word 0xc0, 0x10000, 0x1, 0x80001
+  .word 0xc0, 0x10000, 0x10, 0x80010
+  .word 0xc0, 0x10000, 0xd28fd14, 0xd30fd14
+  .word 0xc0, 0x80000000, 0x0, 0x0
+  .word 0xc0, 0x80000000, 0x2, 0x2
+  .word 0xc0, 0x80000000, 0x80, 0x80
+  .word 0xc0, 0x80000000, 0x100, 0x100
+  .word 0xc0, 0x80000000, 0x8000, 0x8000
+  .word 0xc0, 0x80000000, 0x10000, 0x10000
+  .word 0xc0, 0x80000000, 0x80000000, 0x80000000
+  .word 0xc0, 0x80000000, 0xfffffffe, 0xfffffffe
+  .word 0xc0, 0x80000000, 0x1000000, 0x1000000
+  .word 0xc0, 0x80000000, 0xff00ff00, 0xff00ff00
+  .word 0xc0, 0x80000000, 0x10080, 0x10080
+  .word 0xc0, 0x80000000, 0x723b417, 0x723b417
+  .word 0xc0, 0x80000000, 0x6c, 0x6c
+  .word 0xc0, 0x80000000, 0x215b8, 0x215b8
+  .word 0xc0, 0x80000000, 0xe69, 0xe69
+  .word 0xc0, 0x80000000, 0x73698785, 0x73698785
+  .word 0xc0, 0x80000000, 0x1, 0x1
+  .word 0xc0, 0x80000000, 0x10, 0x10
+  .word 0xc0, 0x80000000, 0xd28fd14, 0xd28fd14
+  .word 0xc0, 0xfffffffe, 0x0, 0xfffffff0
+  .word 0xc0, 0xfffffffe, 0x2, 0xfffffff2
+  .word 0xc0, 0xfffffffe, 0x80, 0x70
+  .word 0xc0, 0xfffffffe, 0x100, 0xf0
+  .word 0xc0, 0xfffffffe, 0x8000, 0x7ff0
+  .word 0xc0, 0xfffffffe, 0x10000, 0xfff0
+  .word 0xc0, 0xfffffffe, 0x80000000, 0x7ffffff0
+  .word 0xc0, 0xfffffffe, 0xfffffffe, 0xffffffee
+  .word 0xc0, 0xfffffffe, 0x1000000, 0xfffff0
+  .word 0xc0, 0xfffffffe, 0xff00ff00, 0xff00fef0
+  .word 0xc0, 0xfffffffe, 0x10080, 0x10070
+  .word 0xc0, 0xfffffffe, 0x723b417, 0x723b407
+  .word 0xc0, 0xfffffffe, 0x6c, 0x5c
+  .word 0xc0, 0xfffffffe, 0x215b8, 0x215a8
+  .word 0xc0, 0xfffffffe, 0xe69, 0xe59
+  .word 0xc0, 0xfffffffe, 0x73698785, 0x73698775
+  .word 0xc0, 0xfffffffe, 0x1, 0xfffffff1
+  .word 0xc0, 0xfffffffe, 0x10, 0x0
+  .word 0xc0, 0xfffffffe, 0xd28fd14, 0xd28fd04
+  .word 0xc0, 0x1000000, 0x0, 0x8000000
+  .word 0xc0, 0x1000000, 0x2, 0x8000002
+  .word 0xc0, 0x1000000, 0x80, 0x8000080
+  .word 0xc0, 0x1000000, 0x100, 0x8000100
+  .word 0xc0, 0x1000000, 0x8000, 0x8008000
+  .word 0xc0, 0x1000000, 0x10000, 0x8010000
+  .word 0xc0, 0x1000000, 0x80000000, 0x88000000
+  .word 0xc0, 0x1000000, 0xfffffffe, 0x7fffffe
+  .word 0xc0, 0x1000000, 0x1000000, 0x9000000
+  .word 0xc0, 0x1000000, 0xff00ff00, 0x700ff00
+  .word 0xc0, 0x1000000, 0x10080, 0x8010080
+  .word 0xc0, 0x1000000, 0x723b417, 0xf23b417
+  .word 0xc0, 0x1000000, 0x6c, 0x800006c
+  .word 0xc0, 0x1000000, 0x215b8, 0x80215b8
+  .word 0xc0, 0x1000000, 0xe69, 0x8000e69
+  .word 0xc0, 0x1000000, 0x73698785, 0x7b698785
+  .word 0xc0, 0x1000000, 0x1, 0x8000001
+  .word 0xc0, 0x1000000, 0x10, 0x8000010
+  .word 0xc0, 0x1000000, 0xd28fd14, 0x1528fd14
+  .word 0xc0, 0xff00ff00, 0x0, 0xf807f800
+  .word 0xc0, 0xff00ff00, 0x2, 0xf807f802
+  .word 0xc0, 0xff00ff00, 0x80, 0xf807f880
+  .word 0xc0, 0xff00ff00, 0x100, 0xf807f900
+  .word 0xc0, 0xff00ff00, 0x8000, 0xf8087800
+  .word 0xc0, 0xff00ff00, 0x10000, 0xf808f800
+  .word 0xc0, 0xff00ff00, 0x80000000, 0x7807f800
+  .word 0xc0, 0xff00ff00, 0xfffffffe, 0xf807f7fe
+  .word 0xc0, 0xff00ff00, 0x1000000, 0xf907f800
+  .word 0xc0, 0xff00ff00, 0xff00ff00, 0xf708f700
+  .word 0xc0, 0xff00ff00, 0x10080, 0xf808f880
+  .word 0xc0, 0xff00ff00, 0x723b417, 0xff2bac17
+  .word 0xc0, 0xff00ff00, 0x6c, 0xf807f86c
+  .word 0xc0, 0xff00ff00, 0x215b8, 0xf80a0db8
+  .word 0xc0, 0xff00ff00, 0xe69, 0xf8080669
+  .word 0xc0, 0xff00ff00, 0x73698785, 0x6b717f85
+  .word 0xc0, 0xff00ff00, 0x1, 0xf807f801
+  .word 0xc0, 0xff00ff00, 0x10, 0xf807f810
+  .word 0xc0, 0xff00ff00, 0xd28fd14, 0x530f514
+  .word 0xc0, 0x10080, 0x0, 0x80400
+  .word 0xc0, 0x10080, 0x2, 0x80402
+  .word 0xc0, 0x10080, 0x80, 0x80480
+  .word 0xc0, 0x10080, 0x100, 0x80500
+  .word 0xc0, 0x10080, 0x8000, 0x88400
+  .word 0xc0, 0x10080, 0x10000, 0x90400
+  .word 0xc0, 0x10080, 0x80000000, 0x80080400
+  .word 0xc0, 0x10080, 0xfffffffe, 0x803fe
+  .word 0xc0, 0x10080, 0x1000000, 0x1080400
+  .word 0xc0, 0x10080, 0xff00ff00, 0xff090300
+  .word 0xc0, 0x10080, 0x10080, 0x90480
+  .word 0xc0, 0x10080, 0x723b417, 0x72bb817
+  .word 0xc0, 0x10080, 0x6c, 0x8046c
+  .word 0xc0, 0x10080, 0x215b8, 0xa19b8
+  .word 0xc0, 0x10080, 0xe69, 0x81269
+  .word 0xc0, 0x10080, 0x73698785, 0x73718b85
+  .word 0xc0, 0x10080, 0x1, 0x80401
+  .word 0xc0, 0x10080, 0x10, 0x80410
+  .word 0xc0, 0x10080, 0xd28fd14, 0xd310114
+  .word 0xc0, 0x723b417, 0x0, 0x391da0b8
+  .word 0xc0, 0x723b417, 0x2, 0x391da0ba
+  .word 0xc0, 0x723b417, 0x80, 0x391da138
+  .word 0xc0, 0x723b417, 0x100, 0x391da1b8
+  .word 0xc0, 0x723b417, 0x8000, 0x391e20b8
+  .word 0xc0, 0x723b417, 0x10000, 0x391ea0b8
+  .word 0xc0, 0x723b417, 0x80000000, 0xb91da0b8
+  .word 0xc0, 0x723b417, 0xfffffffe, 0x391da0b6
+  .word 0xc0, 0x723b417, 0x1000000, 0x3a1da0b8
+  .word 0xc0, 0x723b417, 0xff00ff00, 0x381e9fb8
+  .word 0xc0, 0x723b417, 0x10080, 0x391ea138
+  .word 0xc0, 0x723b417, 0x723b417, 0x404154cf
+  .word 0xc0, 0x723b417, 0x6c, 0x391da124
+  .word 0xc0, 0x723b417, 0x215b8, 0x391fb670
+  .word 0xc0, 0x723b417, 0xe69, 0x391daf21
+  .word 0xc0, 0x723b417, 0x73698785, 0xac87283d
+  .word 0xc0, 0x723b417, 0x1, 0x391da0b9
+  .word 0xc0, 0x723b417, 0x10, 0x391da0c8
+  .word 0xc0, 0x723b417, 0xd28fd14, 0x46469dcc
+  .word 0xc0, 0x6c, 0x0, 0x360
+  .word 0xc0, 0x6c, 0x2, 0x362
+  .word 0xc0, 0x6c, 0x80, 0x3e0
+  .word 0xc0, 0x6c, 0x100, 0x460
+  .word 0xc0, 0x6c, 0x8000, 0x8360
+  .word 0xc0, 0x6c, 0x10000, 0x10360
+  .word 0xc0, 0x6c, 0x80000000, 0x80000360
+  .word 0xc0, 0x6c, 0xfffffffe, 0x35e
+  .word 0xc0, 0x6c, 0x1000000, 0x1000360
+  .word 0xc0, 0x6c, 0xff00ff00, 0xff010260
+  .word 0xc0, 0x6c, 0x10080, 0x103e0
+  .word 0xc0, 0x6c, 0x723b417, 0x723b777
+  .word 0xc0, 0x6c, 0x6c, 0x3cc
+  .word 0xc0, 0x6c, 0x215b8, 0x21918
+  .word 0xc0, 0x6c, 0xe69, 0x11c9
+  .word 0xc0, 0x6c, 0x73698785, 0x73698ae5
+  .word 0xc0, 0x6c, 0x1, 0x361
+  .word 0xc0, 0x6c, 0x10, 0x370
+  .word 0xc0, 0x6c, 0xd28fd14, 0xd290074
+  .word 0xc0, 0x215b8, 0x0, 0x10adc0
+  .word 0xc0, 0x215b8, 0x2, 0x10adc2
+  .word 0xc0, 0x215b8, 0x80, 0x10ae40
+  .word 0xc0, 0x215b8, 0x100, 0x10aec0
+  .word 0xc0, 0x215b8, 0x8000, 0x112dc0
+  .word 0xc0, 0x215b8, 0x10000, 0x11adc0
+  .word 0xc0, 0x215b8, 0x80000000, 0x8010adc0
+  .word 0xc0, 0x215b8, 0xfffffffe, 0x10adbe
+  .word 0xc0, 0x215b8, 0x1000000, 0x110adc0
+  .word 0xc0, 0x215b8, 0xff00ff00, 0xff11acc0
+  .word 0xc0, 0x215b8, 0x10080, 0x11ae40
+  .word 0xc0, 0x215b8, 0x723b417, 0x73461d7
+  .word 0xc0, 0x215b8, 0x6c, 0x10ae2c
+  .word 0xc0, 0x215b8, 0x215b8, 0x12c378
+  .word 0xc0, 0x215b8, 0xe69, 0x10bc29
+  .word 0xc0, 0x215b8, 0x73698785, 0x737a3545
+  .word 0xc0, 0x215b8, 0x1, 0x10adc1
+  .word 0xc0, 0x215b8, 0x10, 0x10add0
+  .word 0xc0, 0x215b8, 0xd28fd14, 0xd39aad4
+  .word 0xc0, 0xe69, 0x0, 0x7348
+  .word 0xc0, 0xe69, 0x2, 0x734a
+  .word 0xc0, 0xe69, 0x80, 0x73c8
+  .word 0xc0, 0xe69, 0x100, 0x7448
+  .word 0xc0, 0xe69, 0x8000, 0xf348
+  .word 0xc0, 0xe69, 0x10000, 0x17348
+  .word 0xc0, 0xe69, 0x80000000, 0x80007348
+  .word 0xc0, 0xe69, 0xfffffffe, 0x7346
+  .word 0xc0, 0xe69, 0x1000000, 0x1007348
+  .word 0xc0, 0xe69, 0xff00ff00, 0xff017248
+  .word 0xc0, 0xe69, 0x10080, 0x173c8
+  .word 0xc0, 0xe69, 0x723b417, 0x724275f
+  .word 0xc0, 0xe69, 0x6c, 0x73b4
+  .word 0xc0, 0xe69, 0x215b8, 0x28900
+  .word 0xc0, 0xe69, 0xe69, 0x81b1
+  .word 0xc0, 0xe69, 0x73698785, 0x7369facd
+  .word 0xc0, 0xe69, 0x1, 0x7349
+  .word 0xc0, 0xe69, 0x10, 0x7358
+  .word 0xc0, 0xe69, 0xd28fd14, 0xd29705c
+  .word 0xc0, 0x73698785, 0x0, 0x9b4c3c28
+  .word 0xc0, 0x73698785, 0x2, 0x9b4c3c2a
+  .word 0xc0, 0x73698785, 0x80, 0x9b4c3ca8
+  .word 0xc0, 0x73698785, 0x100, 0x9b4c3d28
+  .word 0xc0, 0x73698785, 0x8000, 0x9b4cbc28
+  .word 0xc0, 0x73698785, 0x10000, 0x9b4d3c28
+  .word 0xc0, 0x73698785, 0x80000000, 0x1b4c3c28
+  .word 0xc0, 0x73698785, 0xfffffffe, 0x9b4c3c26
+  .word 0xc0, 0x73698785, 0x1000000, 0x9c4c3c28
+  .word 0xc0, 0x73698785, 0xff00ff00, 0x9a4d3b28
+  .word 0xc0, 0x73698785, 0x10080, 0x9b4d3ca8
+  .word 0xc0, 0x73698785, 0x723b417, 0xa26ff03f
+  .word 0xc0, 0x73698785, 0x6c, 0x9b4c3c94
+  .word 0xc0, 0x73698785, 0x215b8, 0x9b4e51e0
+  .word 0xc0, 0x73698785, 0xe69, 0x9b4c4a91
+  .word 0xc0, 0x73698785, 0x73698785, 0xeb5c3ad
+  .word 0xc0, 0x73698785, 0x1, 0x9b4c3c29
+  .word 0xc0, 0x73698785, 0x10, 0x9b4c3c38
+  .word 0xc0, 0x73698785, 0xd28fd14, 0xa875393c
+  .word 0xc0, 0x1, 0x0, 0x8
+  .word 0xc0, 0x1, 0x2, 0xa
+  .word 0xc0, 0x1, 0x80, 0x88
+  .word 0xc0, 0x1, 0x100, 0x108
+  .word 0xc0, 0x1, 0x8000, 0x8008
+  .word 0xc0, 0x1, 0x10000, 0x10008
+  .word 0xc0, 0x1, 0x80000000, 0x80000008
+  .word 0xc0, 0x1, 0xfffffffe, 0x6
+  .word 0xc0, 0x1, 0x1000000, 0x1000008
+  .word 0xc0, 0x1, 0xff00ff00, 0xff00ff08
+  .word 0xc0, 0x1, 0x10080, 0x10088
+  .word 0xc0, 0x1, 0x723b417, 0x723b41f
+  .word 0xc0, 0x1, 0x6c, 0x74
+  .word 0xc0, 0x1, 0x215b8, 0x215c0
+  .word 0xc0, 0x1, 0xe69, 0xe71
+  .word 0xc0, 0x1, 0x73698785, 0x7369878d
+  .word 0xc0, 0x1, 0x1, 0x9
+  .word 0xc0, 0x1, 0x10, 0x18
+  .word 0xc0, 0x1, 0xd28fd14, 0xd28fd1c
+  .word 0xc0, 0x10, 0x0, 0x80
+  .word 0xc0, 0x10, 0x2, 0x82
+  .word 0xc0, 0x10, 0x80, 0x100
+  .word 0xc0, 0x10, 0x100, 0x180
+  .word 0xc0, 0x10, 0x8000, 0x8080
+  .word 0xc0, 0x10, 0x10000, 0x10080
+  .word 0xc0, 0x10, 0x80000000, 0x80000080
+  .word 0xc0, 0x10, 0xfffffffe, 0x7e
+  .word 0xc0, 0x10, 0x1000000, 0x1000080
+  .word 0xc0, 0x10, 0xff00ff00, 0xff00ff80
+  .word 0xc0, 0x10, 0x10080, 0x10100
+  .word 0xc0, 0x10, 0x723b417, 0x723b497
+  .word 0xc0, 0x10, 0x6c, 0xec
+  .word 0xc0, 0x10, 0x215b8, 0x21638
+  .word 0xc0, 0x10, 0xe69, 0xee9
+  .word 0xc0, 0x10, 0x73698785, 0x73698805
+  .word 0xc0, 0x10, 0x1, 0x81
+  .word 0xc0, 0x10, 0x10, 0x90
+  .word 0xc0, 0x10, 0xd28fd14, 0xd28fd94
+  .word 0xc0, 0xd28fd14, 0x0, 0x6947e8a0
+  .word 0xc0, 0xd28fd14, 0x2, 0x6947e8a2
+  .word 0xc0, 0xd28fd14, 0x80, 0x6947e920
+  .word 0xc0, 0xd28fd14, 0x100, 0x6947e9a0
+  .word 0xc0, 0xd28fd14, 0x8000, 0x694868a0
+  .word 0xc0, 0xd28fd14, 0x10000, 0x6948e8a0
+  .word 0xc0, 0xd28fd14, 0x80000000, 0xe947e8a0
+  .word 0xc0, 0xd28fd14, 0xfffffffe, 0x6947e89e
+  .word 0xc0, 0xd28fd14, 0x1000000, 0x6a47e8a0
+  .word 0xc0, 0xd28fd14, 0xff00ff00, 0x6848e7a0
+  .word 0xc0, 0xd28fd14, 0x10080, 0x6948e920
+  .word 0xc0, 0xd28fd14, 0x723b417, 0x706b9cb7
+  .word 0xc0, 0xd28fd14, 0x6c, 0x6947e90c
+  .word 0xc0, 0xd28fd14, 0x215b8, 0x6949fe58
+  .word 0xc0, 0xd28fd14, 0xe69, 0x6947f709
+  .word 0xc0, 0xd28fd14, 0x73698785, 0xdcb17025
+  .word 0xc0, 0xd28fd14, 0x1, 0x6947e8a1
+  .word 0xc0, 0xd28fd14, 0x10, 0x6947e8b0
+  .word 0xc0, 0xd28fd14, 0xd28fd14, 0x7670e5b4
+  .word 0xd0, 0x0, 0x0, 0x0
+  .word 0xe0, 0x0, 0x0, 0x0
+  .word 0xf0, 0x0, 0x0, 0x0
+  .word 0xd0, 0x0, 0x10000, 0x10000
+  .word 0xe0, 0x0, 0x10000, 0x10000
+  .word 0xf0, 0x0, 0x10000, 0x90000
+  .word 0xd0, 0x0, 0x10080, 0x10080
+  .word 0xe0, 0x0, 0x10080, 0x10080
+  .word 0xf0, 0x0, 0x10080, 0x90480
+  .word 0xd0, 0x0, 0x73698785, 0x73698785
+  .word 0xe0, 0x0, 0x73698785, 0x73698785
+  .word 0xf0, 0x0, 0x73698785, 0xeb5c3ad
+  .word 0xd0, 0x2, 0x2, 0x12
+  .word 0xe0, 0x2, 0x2, 0x12
+  .word 0xf0, 0x2, 0x2, 0x12
+  .word 0xd0, 0x2, 0x80000000, 0x80000010
+  .word 0xe0, 0x2, 0x80000000, 0x80000010
+  .word 0xf0, 0x2, 0x80000000, 0x80000000
+  .word 0xd0, 0x2, 0x723b417, 0x723b427
+  .word 0xe0, 0x2, 0x723b417, 0x723b427
+  .word 0xf0, 0x2, 0x723b417, 0x404154cf
+  .word 0xd0, 0x2, 0x1, 0x11
+  .word 0xe0, 0x2, 0x1, 0x11
+  .word 0xf0, 0x2, 0x1, 0x9
+  .word 0xd0, 0x80, 0x80, 0x480
+  .word 0xe0, 0x80, 0x80, 0x480
+  .word 0xf0, 0x80, 0x80, 0x480
+  .word 0xd0, 0x80, 0xfffffffe, 0x3fe
+  .word 0xe0, 0x80, 0xfffffffe, 0x3fe
+  .word 0xf0, 0x80, 0xfffffffe, 0xffffffee
+  .word 0xd0, 0x80, 0x6c, 0x46c
+  .word 0xe0, 0x80, 0x6c, 0x46c
+  .word 0xf0, 0x80, 0x6c, 0x3cc
+  .word 0xd0, 0x80, 0x10, 0x410
+  .word 0xe0, 0x80, 0x10, 0x410
+  .word 0xf0, 0x80, 0x10, 0x90
+  .word 0xd0, 0x100, 0x100, 0x900
+  .word 0xe0, 0x100, 0x100, 0x900
+  .word 0xf0, 0x100, 0x100, 0x900
+  .word 0xd0, 0x100, 0x1000000, 0x1000800
+  .word 0xe0, 0x100, 0x1000000, 0x1000800
+  .word 0xf0, 0x100, 0x1000000, 0x9000000
+  .word 0xd0, 0x100, 0x215b8, 0x21db8
+  .word 0xe0, 0x100, 0x215b8, 0x21db8
+  .word 0xf0, 0x100, 0x215b8, 0x12c378
+  .word 0xd0, 0x100, 0xd28fd14, 0xd290514
+  .word 0xe0, 0x100, 0xd28fd14, 0xd290514
+  .word 0xf0, 0x100, 0xd28fd14, 0x7670e5b4
+  .word 0xd0, 0x8000, 0x8000, 0x48000
+  .word 0xe0, 0x8000, 0x8000, 0x48000
+  .word 0xf0, 0x8000, 0x8000, 0x48000
+  .word 0xd0, 0x8000, 0xff00ff00, 0xff04ff00
+  .word 0xe0, 0x8000, 0xff00ff00, 0xff04ff00
+  .word 0xf0, 0x8000, 0xff00ff00, 0xf708f700
+  .word 0xd0, 0x8000, 0xe69, 0x40e69
+  .word 0xe0, 0x8000, 0xe69, 0x40e69
+  .word 0xf0, 0x8000, 0xe69, 0x81b1
+  .word 0xd0, 0x10000, 0x0, 0x80000
+  .word 0xe0, 0x10000, 0x0, 0x80000
+  .word 0xf0, 0x10000, 0x0, 0x0
+  .word 0xd0, 0x10000, 0x10000, 0x90000
+  .word 0xe0, 0x10000, 0x10000, 0x90000
+  .word 0xf0, 0x10000, 0x10000, 0x90000
+  .word 0xd0, 0x10000, 0x10080, 0x90080
+  .word 0xe0, 0x10000, 0x10080, 0x90080
+  .word 0xf0, 0x10000, 0x10080, 0x90480
+  .word 0xd0, 0x10000, 0x73698785, 0x73718785
+  .word 0xe0, 0x10000, 0x73698785, 0x73718785
+  .word 0xf0, 0x10000, 0x73698785, 0xeb5c3ad
+  .word 0xd0, 0x80000000, 0x2, 0x2
+  .word 0xe0, 0x80000000, 0x2, 0x2
+  .word 0xf0, 0x80000000, 0x2, 0x12
+  .word 0xd0, 0x80000000, 0x80000000, 0x80000000
+  .word 0xe0, 0x80000000, 0x80000000, 0x80000000
+  .word 0xf0, 0x80000000, 0x80000000, 0x80000000
+  .word 0xd0, 0x80000000, 0x723b417, 0x723b417
+  .word 0xe0, 0x80000000, 0x723b417, 0x723b417
+  .word 0xf0, 0x80000000, 0x723b417, 0x404154cf
+  .word 0xd0, 0x80000000, 0x1, 0x1
+  .word 0xe0, 0x80000000, 0x1, 0x1
+  .word 0xf0, 0x80000000, 0x1, 0x9
+  .word 0xd0, 0xfffffffe, 0x80, 0x70
+  .word 0xe0, 0xfffffffe, 0x80, 0x70
+  .word 0xf0, 0xfffffffe, 0x80, 0x480
+  .word 0xd0, 0xfffffffe, 0xfffffffe, 0xffffffee
+  .word 0xe0, 0xfffffffe, 0xfffffffe, 0xffffffee
+  .word 0xf0, 0xfffffffe, 0xfffffffe, 0xffffffee
+  .word 0xd0, 0xfffffffe, 0x6c, 0x5c
+  .word 0xe0, 0xfffffffe, 0x6c, 0x5c
+  .word 0xf0, 0xfffffffe, 0x6c, 0x3cc
+  .word 0xd0, 0xfffffffe, 0x10, 0x0
+  .word 0xe0, 0xfffffffe, 0x10, 0x0
+  .word 0xf0, 0xfffffffe, 0x10, 0x90
+  .word 0xd0, 0x1000000, 0x100, 0x8000100
+  .word 0xe0, 0x1000000, 0x100, 0x8000100
+  .word 0xf0, 0x1000000, 0x100, 0x900
+  .word 0xd0, 0x1000000, 0x1000000, 0x9000000
+  .word 0xe0, 0x1000000, 0x1000000, 0x9000000
+  .word 0xf0, 0x1000000, 0x1000000, 0x9000000
+  .word 0xd0, 0x1000000, 0x215b8, 0x80215b8
+  .word 0xe0, 0x1000000, 0x215b8, 0x80215b8
+  .word 0xf0, 0x1000000, 0x215b8, 0x12c378
+  .word 0xd0, 0x1000000, 0xd28fd14, 0x1528fd14
+  .word 0xe0, 0x1000000, 0xd28fd14, 0x1528fd14
+  .word 0xf0, 0x1000000, 0xd28fd14, 0x7670e5b4
+  .word 0xd0, 0xff00ff00, 0x8000, 0xf8087800
+  .word 0xe0, 0xff00ff00, 0x8000, 0xf8087800
+  .word 0xf0, 0xff00ff00, 0x8000, 0x48000
+  .word 0xd0, 0xff00ff00, 0xff00ff00, 0xf708f700
+  .word 0xe0, 0xff00ff00, 0xff00ff00, 0xf708f700
+  .word 0xf0, 0xff00ff00, 0xff00ff00, 0xf708f700
+  .word 0xd0, 0xff00ff00, 0xe69, 0xf8080669
+  .word 0xe0, 0xff00ff00, 0xe69, 0xf8080669
+  .word 0xf0, 0xff00ff00, 0xe69, 0x81b1
+  .word 0xd0, 0x10080, 0x0, 0x80400
+  .word 0xe0, 0x10080, 0x0, 0x80400
+  .word 0xf0, 0x10080, 0x0, 0x0
+  .word 0xd0, 0x10080, 0x10000, 0x90400
+  .word 0xe0, 0x10080, 0x10000, 0x90400
+  .word 0xf0, 0x10080, 0x10000, 0x90000
+  .word 0xd0, 0x10080, 0x10080, 0x90480
+  .word 0xe0, 0x10080, 0x10080, 0x90480
+  .word 0xf0, 0x10080, 0x10080, 0x90480
+  .word 0xd0, 0x10080, 0x73698785, 0x73718b85
+  .word 0xe0, 0x10080, 0x73698785, 0x73718b85
+  .word 0xf0, 0x10080, 0x73698785, 0xeb5c3ad
+  .word 0xd0, 0x723b417, 0x2, 0x391da0ba
+  .word 0xe0, 0x723b417, 0x2, 0x391da0ba
+  .word 0xf0, 0x723b417, 0x2, 0x12
+  .word 0xd0, 0x723b417, 0x80000000, 0xb91da0b8
+  .word 0xe0, 0x723b417, 0x80000000, 0xb91da0b8
+  .word 0xf0, 0x723b417, 0x80000000, 0x80000000
+  .word 0xd0, 0x723b417, 0x723b417, 0x404154cf
+  .word 0xe0, 0x723b417, 0x723b417, 0x404154cf
+  .word 0xf0, 0x723b417, 0x723b417, 0x404154cf
+  .word 0xd0, 0x723b417, 0x1, 0x391da0b9
+  .word 0xe0, 0x723b417, 0x1, 0x391da0b9
+  .word 0xf0, 0x723b417, 0x1, 0x9
+  .word 0xd0, 0x6c, 0x80, 0x3e0
+  .word 0xe0, 0x6c, 0x80, 0x3e0
+  .word 0xf0, 0x6c, 0x80, 0x480
+  .word 0xd0, 0x6c, 0xfffffffe, 0x35e
+  .word 0xe0, 0x6c, 0xfffffffe, 0x35e
+  .word 0xf0, 0x6c, 0xfffffffe, 0xffffffee
+  .word 0xd0, 0x6c, 0x6c, 0x3cc
+  .word 0xe0, 0x6c, 0x6c, 0x3cc
+  .word 0xf0, 0x6c, 0x6c, 0x3cc
+  .word 0xd0, 0x6c, 0x10, 0x370
+  .word 0xe0, 0x6c, 0x10, 0x370
+  .word 0xf0, 0x6c, 0x10, 0x90
+  .word 0xd0, 0x215b8, 0x100, 0x10aec0
+  .word 0xe0, 0x215b8, 0x100, 0x10aec0
+  .word 0xf0, 0x215b8, 0x100, 0x900
+  .word 0xd0, 0x215b8, 0x1000000, 0x110adc0
+  .word 0xe0, 0x215b8, 0x1000000, 0x110adc0
+  .word 0xf0, 0x215b8, 0x1000000, 0x9000000
+  .word 0xd0, 0x215b8, 0x215b8, 0x12c378
+  .word 0xe0, 0x215b8, 0x215b8, 0x12c378
+  .word 0xf0, 0x215b8, 0x215b8, 0x12c378
+  .word 0xd0, 0x215b8, 0xd28fd14, 0xd39aad4
+  .word 0xe0, 0x215b8, 0xd28fd14, 0xd39aad4
+  .word 0xf0, 0x215b8, 0xd28fd14, 0x7670e5b4
+  .word 0xd0, 0xe69, 0x8000, 0xf348
+  .word 0xe0, 0xe69, 0x8000, 0xf348
+  .word 0xf0, 0xe69, 0x8000, 0x48000
+  .word 0xd0, 0xe69, 0xff00ff00, 0xff017248
+  .word 0xe0, 0xe69, 0xff00ff00, 0xff017248
+  .word 0xf0, 0xe69, 0xff00ff00, 0xf708f700
+  .word 0xd0, 0xe69, 0xe69, 0x81b1
+  .word 0xe0, 0xe69, 0xe69, 0x81b1
+  .word 0xf0, 0xe69, 0xe69, 0x81b1
+  .word 0xd0, 0x73698785, 0x0, 0x9b4c3c28
+  .word 0xe0, 0x73698785, 0x0, 0x9b4c3c28
+  .word 0xf0, 0x73698785, 0x0, 0x0
+  .word 0xd0, 0x73698785, 0x10000, 0x9b4d3c28
+  .word 0xe0, 0x73698785, 0x10000, 0x9b4d3c28
+  .word 0xf0, 0x73698785, 0x10000, 0x90000
+  .word 0xd0, 0x73698785, 0x10080, 0x9b4d3ca8
+  .word 0xe0, 0x73698785, 0x10080, 0x9b4d3ca8
+  .word 0xf0, 0x73698785, 0x10080, 0x90480
+  .word 0xd0, 0x73698785, 0x73698785, 0xeb5c3ad
+  .word 0xe0, 0x73698785, 0x73698785, 0xeb5c3ad
+  .word 0xf0, 0x73698785, 0x73698785, 0xeb5c3ad
+  .word 0xd0, 0x1, 0x2, 0xa
+  .word 0xe0, 0x1, 0x2, 0xa
+  .word 0xf0, 0x1, 0x2, 0x12
+  .word 0xd0, 0x1, 0x80000000, 0x80000008
+  .word 0xe0, 0x1, 0x80000000, 0x80000008
+  .word 0xf0, 0x1, 0x80000000, 0x80000000
+  .word 0xd0, 0x1, 0x723b417, 0x723b41f
+  .word 0xe0, 0x1, 0x723b417, 0x723b41f
+  .word 0xf0, 0x1, 0x723b417, 0x404154cf
+  .word 0xd0, 0x1, 0x1, 0x9
+  .word 0xe0, 0x1, 0x1, 0x9
+  .word 0xf0, 0x1, 0x1, 0x9
+  .word 0xd0, 0x10, 0x80, 0x100
+  .word 0xe0, 0x10, 0x80, 0x100
+  .word 0xf0, 0x10, 0x80, 0x480
+  .word 0xd0, 0x10, 0xfffffffe, 0x7e
+  .word 0xe0, 0x10, 0xfffffffe, 0x7e
+  .word 0xf0, 0x10, 0xfffffffe, 0xffffffee
+  .word 0xd0, 0x10, 0x6c, 0xec
+  .word 0xe0, 0x10, 0x6c, 0xec
+  .word 0xf0, 0x10, 0x6c, 0x3cc
+  .word 0xd0, 0x10, 0x10, 0x90
+  .word 0xe0, 0x10, 0x10, 0x90
+  .word 0xf0, 0x10, 0x10, 0x90
+  .word 0xd0, 0xd28fd14, 0x100, 0x6947e9a0
+  .word 0xe0, 0xd28fd14, 0x100, 0x6947e9a0
+  .word 0xf0, 0xd28fd14, 0x100, 0x900
+  .word 0xd0, 0xd28fd14, 0x1000000, 0x6a47e8a0
+  .word 0xe0, 0xd28fd14, 0x1000000, 0x6a47e8a0
+  .word 0xf0, 0xd28fd14, 0x1000000, 0x9000000
+  .word 0xd0, 0xd28fd14, 0x215b8, 0x6949fe58
+  .word 0xe0, 0xd28fd14, 0x215b8, 0x6949fe58
+  .word 0xf0, 0xd28fd14, 0x215b8, 0x12c378
+  .word 0xd0, 0xd28fd14, 0xd28fd14, 0x7670e5b4
+  .word 0xe0, 0xd28fd14, 0xd28fd14, 0x7670e5b4
+  .word 0xf0, 0xd28fd14, 0xd28fd14, 0x7670e5b4
+  .word 0x100, 0x0, 0x12345687, 0x12345687
+  .word 0x110, 0x87654321, 0x0, 0x3b2a1908
+  .word 0x120, 0x0, 0x0, 0x0
+  .word 0x120, 0x0, 0x2, 0x0
+  .word 0x120, 0x0, 0x80, 0x0
+  .word 0x120, 0x0, 0x100, 0x0
+  .word 0x120, 0x0, 0x8000, 0x0
+  .word 0x120, 0x0, 0x10000, 0x0
+  .word 0x120, 0x0, 0x80000000, 0x0
+  .word 0x120, 0x0, 0xfffffffe, 0x0
+  .word 0x120, 0x0, 0x1000000, 0x0
+  .word 0x120, 0x0, 0xff00ff00, 0x0
+  .word 0x120, 0x0, 0x10080, 0x0
+  .word 0x120, 0x0, 0x723b417, 0x0
+  .word 0x120, 0x0, 0x6c, 0x0
+  .word 0x120, 0x0, 0x215b8, 0x0
+  .word 0x120, 0x0, 0xe69, 0x0
+  .word 0x120, 0x0, 0x73698785, 0x0
+  .word 0x120, 0x0, 0x1, 0x0
+  .word 0x120, 0x0, 0x10, 0x0
+  .word 0x120, 0x0, 0xd28fd14, 0x0
+  .word 0x120, 0x2, 0x0, 0x2
+  .word 0x120, 0x2, 0x2, 0x0
+  .word 0x120, 0x2, 0x80, 0x2
+  .word 0x120, 0x2, 0x100, 0x2
+  .word 0x120, 0x2, 0x8000, 0x2
+  .word 0x120, 0x2, 0x10000, 0x2
+  .word 0x120, 0x2, 0x80000000, 0x2
+  .word 0x120, 0x2, 0xfffffffe, 0x0
+  .word 0x120, 0x2, 0x1000000, 0x2
+  .word 0x120, 0x2, 0xff00ff00, 0x2
+  .word 0x120, 0x2, 0x10080, 0x2
+  .word 0x120, 0x2, 0x723b417, 0x0
+  .word 0x120, 0x2, 0x6c, 0x2
+  .word 0x120, 0x2, 0x215b8, 0x2
+  .word 0x120, 0x2, 0xe69, 0x2
+  .word 0x120, 0x2, 0x73698785, 0x2
+  .word 0x120, 0x2, 0x1, 0x2
+  .word 0x120, 0x2, 0x10, 0x2
+  .word 0x120, 0x2, 0xd28fd14, 0x2
+  .word 0x120, 0x80, 0x0, 0x80
+  .word 0x120, 0x80, 0x2, 0x80
+  .word 0x120, 0x80, 0x80, 0x0
+  .word 0x120, 0x80, 0x100, 0x80
+  .word 0x120, 0x80, 0x8000, 0x80
+  .word 0x120, 0x80, 0x10000, 0x80
+  .word 0x120, 0x80, 0x80000000, 0x80
+  .word 0x120, 0x80, 0xfffffffe, 0x0
+  .word 0x120, 0x80, 0x1000000, 0x80
+  .word 0x120, 0x80, 0xff00ff00, 0x80
+  .word 0x120, 0x80, 0x10080, 0x0
+  .word 0x120, 0x80, 0x723b417, 0x80
+  .word 0x120, 0x80, 0x6c, 0x80
+  .word 0x120, 0x80, 0x215b8, 0x0
+  .word 0x120, 0x80, 0xe69, 0x80
+  .word 0x120, 0x80, 0x73698785, 0x0
+  .word 0x120, 0x80, 0x1, 0x80
+  .word 0x120, 0x80, 0x10, 0x80
+  .word 0x120, 0x80, 0xd28fd14, 0x80
+  .word 0x120, 0x100, 0x0, 0x100
+  .word 0x120, 0x100, 0x2, 0x100
+  .word 0x120, 0x100, 0x80, 0x100
+  .word 0x120, 0x100, 0x100, 0x0
+  .word 0x120, 0x100, 0x8000, 0x100
+  .word 0x120, 0x100, 0x10000, 0x100
+  .word 0x120, 0x100, 0x80000000, 0x100
+  .word 0x120, 0x100, 0xfffffffe, 0x0
+  .word 0x120, 0x100, 0x1000000, 0x100
+  .word 0x120, 0x100, 0xff00ff00, 0x0
+  .word 0x120, 0x100, 0x10080, 0x100
+  .word 0x120, 0x100, 0x723b417, 0x100
+  .word 0x120, 0x100, 0x6c, 0x100
+  .word 0x120, 0x100, 0x215b8, 0x0
+  .word 0x120, 0x100, 0xe69, 0x100
+  .word 0x120, 0x100, 0x73698785, 0x0
+  .word 0x120, 0x100, 0x1, 0x100
+  .word 0x120, 0x100, 0x10, 0x100
+  .word 0x120, 0x100, 0xd28fd14, 0x0
+  .word 0x120, 0x8000, 0x0, 0x8000
+  .word 0x120, 0x8000, 0x2, 0x8000
+  .word 0x120, 0x8000, 0x80, 0x8000
+  .word 0x120, 0x8000, 0x100, 0x8000
+  .word 0x120, 0x8000, 0x8000, 0x0
+  .word 0x120, 0x8000, 0x10000, 0x8000
+  .word 0x120, 0x8000, 0x80000000, 0x8000
+  .word 0x120, 0x8000, 0xfffffffe, 0x0
+  .word 0x120, 0x8000, 0x1000000, 0x8000
+  .word 0x120, 0x8000, 0xff00ff00, 0x0
+  .word 0x120, 0x8000, 0x10080, 0x8000
+  .word 0x120, 0x8000, 0x723b417, 0x0
+  .word 0x120, 0x8000, 0x6c, 0x8000
+  .word 0x120, 0x8000, 0x215b8, 0x8000
+  .word 0x120, 0x8000, 0xe69, 0x8000
+  .word 0x120, 0x8000, 0x73698785, 0x0
+  .word 0x120, 0x8000, 0x1, 0x8000
+  .word 0x120, 0x8000, 0x10, 0x8000
+  .word 0x120, 0x8000, 0xd28fd14, 0x0
+  .word 0x120, 0x10000, 0x0, 0x10000
+  .word 0x120, 0x10000, 0x2, 0x10000
+  .word 0x120, 0x10000, 0x80, 0x10000
+  .word 0x120, 0x10000, 0x100, 0x10000
+  .word 0x120, 0x10000, 0x8000, 0x10000
+  .word 0x120, 0x10000, 0x10000, 0x0
+  .word 0x120, 0x10000, 0x80000000, 0x10000
+  .word 0x120, 0x10000, 0xfffffffe, 0x0
+  .word 0x120, 0x10000, 0x1000000, 0x10000
+  .word 0x120, 0x10000, 0xff00ff00, 0x10000
+  .word 0x120, 0x10000, 0x10080, 0x0
+  .word 0x120, 0x10000, 0x723b417, 0x0
+  .word 0x120, 0x10000, 0x6c, 0x10000
+  .word 0x120, 0x10000, 0x215b8, 0x10000
+  .word 0x120, 0x10000, 0xe69, 0x10000
+  .word 0x120, 0x10000, 0x73698785, 0x0
+  .word 0x120, 0x10000, 0x1, 0x10000
+  .word 0x120, 0x10000, 0x10, 0x10000
+  .word 0x120, 0x10000, 0xd28fd14, 0x10000
+  .word 0x120, 0x80000000, 0x0, 0x80000000
+  .word 0x120, 0x80000000, 0x2, 0x80000000
+  .word 0x120, 0x80000000, 0x80, 0x80000000
+  .word 0x120, 0x80000000, 0x100, 0x80000000
+  .word 0x120, 0x80000000, 0x8000, 0x80000000
+  .word 0x120, 0x80000000, 0x10000, 0x80000000
+  .word 0x120, 0x80000000, 0x80000000, 0x0
+  .word 0x120, 0x80000000, 0xfffffffe, 0x0
+  .word 0x120, 0x80000000, 0x1000000, 0x80000000
+  .word 0x120, 0x80000000, 0xff00ff00, 0x0
+  .word 0x120, 0x80000000, 0x10080, 0x80000000
+  .word 0x120, 0x80000000, 0x723b417, 0x80000000
+  .word 0x120, 0x80000000, 0x6c, 0x80000000
+  .word 0x120, 0x80000000, 0x215b8, 0x80000000
+  .word 0x120, 0x80000000, 0xe69, 0x80000000
+  .word 0x120, 0x80000000, 0x73698785, 0x80000000
+  .word 0x120, 0x80000000, 0x1, 0x80000000
+  .word 0x120, 0x80000000, 0x10, 0x80000000
+  .word 0x120, 0x80000000, 0xd28fd14, 0x80000000
+  .word 0x120, 0xfffffffe, 0x0, 0xfffffffe
+  .word 0x120, 0xfffffffe, 0x2, 0xfffffffc
+  .word 0x120, 0xfffffffe, 0x80, 0xffffff7e
+  .word 0x120, 0xfffffffe, 0x100, 0xfffffefe
+  .word 0x120, 0xfffffffe, 0x8000, 0xffff7ffe
+  .word 0x120, 0xfffffffe, 0x10000, 0xfffefffe
+  .word 0x120, 0xfffffffe, 0x80000000, 0x7ffffffe
+  .word 0x120, 0xfffffffe, 0xfffffffe, 0x0
+  .word 0x120, 0xfffffffe, 0x1000000, 0xfefffffe
+  .word 0x120, 0xfffffffe, 0xff00ff00, 0xff00fe
+  .word 0x120, 0xfffffffe, 0x10080, 0xfffeff7e
+  .word 0x120, 0xfffffffe, 0x723b417, 0xf8dc4be8
+  .word 0x120, 0xfffffffe, 0x6c, 0xffffff92
+  .word 0x120, 0xfffffffe, 0x215b8, 0xfffdea46
+  .word 0x120, 0xfffffffe, 0xe69, 0xfffff196
+  .word 0x120, 0xfffffffe, 0x73698785, 0x8c96787a
+  .word 0x120, 0xfffffffe, 0x1, 0xfffffffe
+  .word 0x120, 0xfffffffe, 0x10, 0xffffffee
+  .word 0x120, 0xfffffffe, 0xd28fd14, 0xf2d702ea
+  .word 0x120, 0x1000000, 0x0, 0x1000000
+  .word 0x120, 0x1000000, 0x2, 0x1000000
+  .word 0x120, 0x1000000, 0x80, 0x1000000
+  .word 0x120, 0x1000000, 0x100, 0x1000000
+  .word 0x120, 0x1000000, 0x8000, 0x1000000
+  .word 0x120, 0x1000000, 0x10000, 0x1000000
+  .word 0x120, 0x1000000, 0x80000000, 0x1000000
+  .word 0x120, 0x1000000, 0xfffffffe, 0x0
+  .word 0x120, 0x1000000, 0x1000000, 0x0
+  .word 0x120, 0x1000000, 0xff00ff00, 0x0
+  .word 0x120, 0x1000000, 0x10080, 0x1000000
+  .word 0x120, 0x1000000, 0x723b417, 0x0
+  .word 0x120, 0x1000000, 0x6c, 0x1000000
+  .word 0x120, 0x1000000, 0x215b8, 0x1000000
+  .word 0x120, 0x1000000, 0xe69, 0x1000000
+  .word 0x120, 0x1000000, 0x73698785, 0x0
+  .word 0x120, 0x1000000, 0x1, 0x1000000
+  .word 0x120, 0x1000000, 0x10, 0x1000000
+  .word 0x120, 0x1000000, 0xd28fd14, 0x0
+  .word 0x120, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x120, 0xff00ff00, 0x2, 0xff00ff00
+  .word 0x120, 0xff00ff00, 0x80, 0xff00ff00
+  .word 0x120, 0xff00ff00, 0x100, 0xff00fe00
+  .word 0x120, 0xff00ff00, 0x8000, 0xff007f00
+  .word 0x120, 0xff00ff00, 0x10000, 0xff00ff00
+  .word 0x120, 0xff00ff00, 0x80000000, 0x7f00ff00
+  .word 0x120, 0xff00ff00, 0xfffffffe, 0x0
+  .word 0x120, 0xff00ff00, 0x1000000, 0xfe00ff00
+  .word 0x120, 0xff00ff00, 0xff00ff00, 0x0
+  .word 0x120, 0xff00ff00, 0x10080, 0xff00ff00
+  .word 0x120, 0xff00ff00, 0x723b417, 0xf8004b00
+  .word 0x120, 0xff00ff00, 0x6c, 0xff00ff00
+  .word 0x120, 0xff00ff00, 0x215b8, 0xff00ea00
+  .word 0x120, 0xff00ff00, 0xe69, 0xff00f100
+  .word 0x120, 0xff00ff00, 0x73698785, 0x8c007800
+  .word 0x120, 0xff00ff00, 0x1, 0xff00ff00
+  .word 0x120, 0xff00ff00, 0x10, 0xff00ff00
+  .word 0x120, 0xff00ff00, 0xd28fd14, 0xf2000200
+  .word 0x120, 0x10080, 0x0, 0x10080
+  .word 0x120, 0x10080, 0x2, 0x10080
+  .word 0x120, 0x10080, 0x80, 0x10000
+  .word 0x120, 0x10080, 0x100, 0x10080
+  .word 0x120, 0x10080, 0x8000, 0x10080
+  .word 0x120, 0x10080, 0x10000, 0x80
+  .word 0x120, 0x10080, 0x80000000, 0x10080
+  .word 0x120, 0x10080, 0xfffffffe, 0x0
+  .word 0x120, 0x10080, 0x1000000, 0x10080
+  .word 0x120, 0x10080, 0xff00ff00, 0x10080
+  .word 0x120, 0x10080, 0x10080, 0x0
+  .word 0x120, 0x10080, 0x723b417, 0x80
+  .word 0x120, 0x10080, 0x6c, 0x10080
+  .word 0x120, 0x10080, 0x215b8, 0x10000
+  .word 0x120, 0x10080, 0xe69, 0x10080
+  .word 0x120, 0x10080, 0x73698785, 0x0
+  .word 0x120, 0x10080, 0x1, 0x10080
+  .word 0x120, 0x10080, 0x10, 0x10080
+  .word 0x120, 0x10080, 0xd28fd14, 0x10080
+  .word 0x120, 0x723b417, 0x0, 0x723b417
+  .word 0x120, 0x723b417, 0x2, 0x723b415
+  .word 0x120, 0x723b417, 0x80, 0x723b417
+  .word 0x120, 0x723b417, 0x100, 0x723b417
+  .word 0x120, 0x723b417, 0x8000, 0x7233417
+  .word 0x120, 0x723b417, 0x10000, 0x722b417
+  .word 0x120, 0x723b417, 0x80000000, 0x723b417
+  .word 0x120, 0x723b417, 0xfffffffe, 0x1
+  .word 0x120, 0x723b417, 0x1000000, 0x623b417
+  .word 0x120, 0x723b417, 0xff00ff00, 0x230017
+  .word 0x120, 0x723b417, 0x10080, 0x722b417
+  .word 0x120, 0x723b417, 0x723b417, 0x0
+  .word 0x120, 0x723b417, 0x6c, 0x723b413
+  .word 0x120, 0x723b417, 0x215b8, 0x721a007
+  .word 0x120, 0x723b417, 0xe69, 0x723b016
+  .word 0x120, 0x723b417, 0x73698785, 0x4023012
+  .word 0x120, 0x723b417, 0x1, 0x723b416
+  .word 0x120, 0x723b417, 0x10, 0x723b407
+  .word 0x120, 0x723b417, 0xd28fd14, 0x2030003
+  .word 0x120, 0x6c, 0x0, 0x6c
+  .word 0x120, 0x6c, 0x2, 0x6c
+  .word 0x120, 0x6c, 0x80, 0x6c
+  .word 0x120, 0x6c, 0x100, 0x6c
+  .word 0x120, 0x6c, 0x8000, 0x6c
+  .word 0x120, 0x6c, 0x10000, 0x6c
+  .word 0x120, 0x6c, 0x80000000, 0x6c
+  .word 0x120, 0x6c, 0xfffffffe, 0x0
+  .word 0x120, 0x6c, 0x1000000, 0x6c
+  .word 0x120, 0x6c, 0xff00ff00, 0x6c
+  .word 0x120, 0x6c, 0x10080, 0x6c
+  .word 0x120, 0x6c, 0x723b417, 0x68
+  .word 0x120, 0x6c, 0x6c, 0x0
+  .word 0x120, 0x6c, 0x215b8, 0x44
+  .word 0x120, 0x6c, 0xe69, 0x4
+  .word 0x120, 0x6c, 0x73698785, 0x68
+  .word 0x120, 0x6c, 0x1, 0x6c
+  .word 0x120, 0x6c, 0x10, 0x6c
+  .word 0x120, 0x6c, 0xd28fd14, 0x68
+  .word 0x120, 0x215b8, 0x0, 0x215b8
+  .word 0x120, 0x215b8, 0x2, 0x215b8
+  .word 0x120, 0x215b8, 0x80, 0x21538
+  .word 0x120, 0x215b8, 0x100, 0x214b8
+  .word 0x120, 0x215b8, 0x8000, 0x215b8
+  .word 0x120, 0x215b8, 0x10000, 0x215b8
+  .word 0x120, 0x215b8, 0x80000000, 0x215b8
+  .word 0x120, 0x215b8, 0xfffffffe, 0x0
+  .word 0x120, 0x215b8, 0x1000000, 0x215b8
+  .word 0x120, 0x215b8, 0xff00ff00, 0x200b8
+  .word 0x120, 0x215b8, 0x10080, 0x21538
+  .word 0x120, 0x215b8, 0x723b417, 0x1a8
+  .word 0x120, 0x215b8, 0x6c, 0x21590
+  .word 0x120, 0x215b8, 0x215b8, 0x0
+  .word 0x120, 0x215b8, 0xe69, 0x21190
+  .word 0x120, 0x215b8, 0x73698785, 0x21038
+  .word 0x120, 0x215b8, 0x1, 0x215b8
+  .word 0x120, 0x215b8, 0x10, 0x215a8
+  .word 0x120, 0x215b8, 0xd28fd14, 0x200a8
+  .word 0x120, 0xe69, 0x0, 0xe69
+  .word 0x120, 0xe69, 0x2, 0xe69
+  .word 0x120, 0xe69, 0x80, 0xe69
+  .word 0x120, 0xe69, 0x100, 0xe69
+  .word 0x120, 0xe69, 0x8000, 0xe69
+  .word 0x120, 0xe69, 0x10000, 0xe69
+  .word 0x120, 0xe69, 0x80000000, 0xe69
+  .word 0x120, 0xe69, 0xfffffffe, 0x1
+  .word 0x120, 0xe69, 0x1000000, 0xe69
+  .word 0x120, 0xe69, 0xff00ff00, 0x69
+  .word 0x120, 0xe69, 0x10080, 0xe69
+  .word 0x120, 0xe69, 0x723b417, 0xa68
+  .word 0x120, 0xe69, 0x6c, 0xe01
+  .word 0x120, 0xe69, 0x215b8, 0xa41
+  .word 0x120, 0xe69, 0xe69, 0x0
+  .word 0x120, 0xe69, 0x73698785, 0x868
+  .word 0x120, 0xe69, 0x1, 0xe68
+  .word 0x120, 0xe69, 0x10, 0xe69
+  .word 0x120, 0xe69, 0xd28fd14, 0x269
+  .word 0x120, 0x73698785, 0x0, 0x73698785
+  .word 0x120, 0x73698785, 0x2, 0x73698785
+  .word 0x120, 0x73698785, 0x80, 0x73698705
+  .word 0x120, 0x73698785, 0x100, 0x73698685
+  .word 0x120, 0x73698785, 0x8000, 0x73690785
+  .word 0x120, 0x73698785, 0x10000, 0x73688785
+  .word 0x120, 0x73698785, 0x80000000, 0x73698785
+  .word 0x120, 0x73698785, 0xfffffffe, 0x1
+  .word 0x120, 0x73698785, 0x1000000, 0x72698785
+  .word 0x120, 0x73698785, 0xff00ff00, 0x690085
+  .word 0x120, 0x73698785, 0x10080, 0x73688705
+  .word 0x120, 0x73698785, 0x723b417, 0x70480380
+  .word 0x120, 0x73698785, 0x6c, 0x73698781
+  .word 0x120, 0x73698785, 0x215b8, 0x73698205
+  .word 0x120, 0x73698785, 0xe69, 0x73698184
+  .word 0x120, 0x73698785, 0x73698785, 0x0
+  .word 0x120, 0x73698785, 0x1, 0x73698784
+  .word 0x120, 0x73698785, 0x10, 0x73698785
+  .word 0x120, 0x73698785, 0xd28fd14, 0x72410281
+  .word 0x120, 0x1, 0x0, 0x1
+  .word 0x120, 0x1, 0x2, 0x1
+  .word 0x120, 0x1, 0x80, 0x1
+  .word 0x120, 0x1, 0x100, 0x1
+  .word 0x120, 0x1, 0x8000, 0x1
+  .word 0x120, 0x1, 0x10000, 0x1
+  .word 0x120, 0x1, 0x80000000, 0x1
+  .word 0x120, 0x1, 0xfffffffe, 0x1
+  .word 0x120, 0x1, 0x1000000, 0x1
+  .word 0x120, 0x1, 0xff00ff00, 0x1
+  .word 0x120, 0x1, 0x10080, 0x1
+  .word 0x120, 0x1, 0x723b417, 0x0
+  .word 0x120, 0x1, 0x6c, 0x1
+  .word 0x120, 0x1, 0x215b8, 0x1
+  .word 0x120, 0x1, 0xe69, 0x0
+  .word 0x120, 0x1, 0x73698785, 0x0
+  .word 0x120, 0x1, 0x1, 0x0
+  .word 0x120, 0x1, 0x10, 0x1
+  .word 0x120, 0x1, 0xd28fd14, 0x1
+  .word 0x120, 0x10, 0x0, 0x10
+  .word 0x120, 0x10, 0x2, 0x10
+  .word 0x120, 0x10, 0x80, 0x10
+  .word 0x120, 0x10, 0x100, 0x10
+  .word 0x120, 0x10, 0x8000, 0x10
+  .word 0x120, 0x10, 0x10000, 0x10
+  .word 0x120, 0x10, 0x80000000, 0x10
+  .word 0x120, 0x10, 0xfffffffe, 0x0
+  .word 0x120, 0x10, 0x1000000, 0x10
+  .word 0x120, 0x10, 0xff00ff00, 0x10
+  .word 0x120, 0x10, 0x10080, 0x10
+  .word 0x120, 0x10, 0x723b417, 0x0
+  .word 0x120, 0x10, 0x6c, 0x10
+  .word 0x120, 0x10, 0x215b8, 0x0
+  .word 0x120, 0x10, 0xe69, 0x10
+  .word 0x120, 0x10, 0x73698785, 0x10
+  .word 0x120, 0x10, 0x1, 0x10
+  .word 0x120, 0x10, 0x10, 0x0
+  .word 0x120, 0x10, 0xd28fd14, 0x0
+  .word 0x120, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x120, 0xd28fd14, 0x2, 0xd28fd14
+  .word 0x120, 0xd28fd14, 0x80, 0xd28fd14
+  .word 0x120, 0xd28fd14, 0x100, 0xd28fc14
+  .word 0x120, 0xd28fd14, 0x8000, 0xd287d14
+  .word 0x120, 0xd28fd14, 0x10000, 0xd28fd14
+  .word 0x120, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x120, 0xd28fd14, 0xfffffffe, 0x0
+  .word 0x120, 0xd28fd14, 0x1000000, 0xc28fd14
+  .word 0x120, 0xd28fd14, 0xff00ff00, 0x280014
+  .word 0x120, 0xd28fd14, 0x10080, 0xd28fd14
+  .word 0x120, 0xd28fd14, 0x723b417, 0x8084900
+  .word 0x120, 0xd28fd14, 0x6c, 0xd28fd10
+  .word 0x120, 0xd28fd14, 0x215b8, 0xd28e804
+  .word 0x120, 0xd28fd14, 0xe69, 0xd28f114
+  .word 0x120, 0xd28fd14, 0x73698785, 0xc007810
+  .word 0x120, 0xd28fd14, 0x1, 0xd28fd14
+  .word 0x120, 0xd28fd14, 0x10, 0xd28fd04
+  .word 0x120, 0xd28fd14, 0xd28fd14, 0x0
+  .word 0x130, 0x0, 0x0, 0x0
+  .word 0x140, 0x0, 0x0, 0x0
+  .word 0x150, 0x0, 0x0, 0x0
+  .word 0x130, 0x0, 0x10000, 0x0
+  .word 0x140, 0x0, 0x10000, 0x0
+  .word 0x150, 0x0, 0x10000, 0x0
+  .word 0x130, 0x0, 0x10080, 0x0
+  .word 0x140, 0x0, 0x10080, 0x0
+  .word 0x150, 0x0, 0x10080, 0x0
+  .word 0x130, 0x0, 0x73698785, 0x0
+  .word 0x140, 0x0, 0x73698785, 0x0
+  .word 0x150, 0x0, 0x73698785, 0x0
+  .word 0x130, 0x2, 0x2, 0x0
+  .word 0x140, 0x2, 0x2, 0x0
+  .word 0x150, 0x2, 0x2, 0x0
+  .word 0x130, 0x2, 0x80000000, 0x2
+  .word 0x140, 0x2, 0x80000000, 0x2
+  .word 0x150, 0x2, 0x80000000, 0x0
+  .word 0x130, 0x2, 0x723b417, 0x0
+  .word 0x140, 0x2, 0x723b417, 0x0
+  .word 0x150, 0x2, 0x723b417, 0x0
+  .word 0x130, 0x2, 0x1, 0x2
+  .word 0x140, 0x2, 0x1, 0x2
+  .word 0x150, 0x2, 0x1, 0x0
+  .word 0x130, 0x80, 0x80, 0x0
+  .word 0x140, 0x80, 0x80, 0x0
+  .word 0x150, 0x80, 0x80, 0x0
+  .word 0x130, 0x80, 0xfffffffe, 0x0
+  .word 0x140, 0x80, 0xfffffffe, 0x0
+  .word 0x150, 0x80, 0xfffffffe, 0x0
+  .word 0x130, 0x80, 0x6c, 0x80
+  .word 0x140, 0x80, 0x6c, 0x80
+  .word 0x150, 0x80, 0x6c, 0x0
+  .word 0x130, 0x80, 0x10, 0x80
+  .word 0x140, 0x80, 0x10, 0x80
+  .word 0x150, 0x80, 0x10, 0x0
+  .word 0x130, 0x100, 0x100, 0x0
+  .word 0x140, 0x100, 0x100, 0x0
+  .word 0x150, 0x100, 0x100, 0x0
+  .word 0x130, 0x100, 0x1000000, 0x100
+  .word 0x140, 0x100, 0x1000000, 0x100
+  .word 0x150, 0x100, 0x1000000, 0x0
+  .word 0x130, 0x100, 0x215b8, 0x0
+  .word 0x140, 0x100, 0x215b8, 0x0
+  .word 0x150, 0x100, 0x215b8, 0x0
+  .word 0x130, 0x100, 0xd28fd14, 0x0
+  .word 0x140, 0x100, 0xd28fd14, 0x0
+  .word 0x150, 0x100, 0xd28fd14, 0x0
+  .word 0x130, 0x8000, 0x8000, 0x0
+  .word 0x140, 0x8000, 0x8000, 0x0
+  .word 0x150, 0x8000, 0x8000, 0x0
+  .word 0x130, 0x8000, 0xff00ff00, 0x0
+  .word 0x140, 0x8000, 0xff00ff00, 0x0
+  .word 0x150, 0x8000, 0xff00ff00, 0x0
+  .word 0x130, 0x8000, 0xe69, 0x8000
+  .word 0x140, 0x8000, 0xe69, 0x8000
+  .word 0x150, 0x8000, 0xe69, 0x0
+  .word 0x130, 0x10000, 0x0, 0x10000
+  .word 0x140, 0x10000, 0x0, 0x10000
+  .word 0x150, 0x10000, 0x0, 0x0
+  .word 0x130, 0x10000, 0x10000, 0x0
+  .word 0x140, 0x10000, 0x10000, 0x0
+  .word 0x150, 0x10000, 0x10000, 0x0
+  .word 0x130, 0x10000, 0x10080, 0x0
+  .word 0x140, 0x10000, 0x10080, 0x0
+  .word 0x150, 0x10000, 0x10080, 0x0
+  .word 0x130, 0x10000, 0x73698785, 0x0
+  .word 0x140, 0x10000, 0x73698785, 0x0
+  .word 0x150, 0x10000, 0x73698785, 0x0
+  .word 0x130, 0x80000000, 0x2, 0x80000000
+  .word 0x140, 0x80000000, 0x2, 0x80000000
+  .word 0x150, 0x80000000, 0x2, 0x0
+  .word 0x130, 0x80000000, 0x80000000, 0x0
+  .word 0x140, 0x80000000, 0x80000000, 0x0
+  .word 0x150, 0x80000000, 0x80000000, 0x0
+  .word 0x130, 0x80000000, 0x723b417, 0x80000000
+  .word 0x140, 0x80000000, 0x723b417, 0x80000000
+  .word 0x150, 0x80000000, 0x723b417, 0x0
+  .word 0x130, 0x80000000, 0x1, 0x80000000
+  .word 0x140, 0x80000000, 0x1, 0x80000000
+  .word 0x150, 0x80000000, 0x1, 0x0
+  .word 0x130, 0xfffffffe, 0x80, 0xffffff7e
+  .word 0x140, 0xfffffffe, 0x80, 0xffffff7e
+  .word 0x150, 0xfffffffe, 0x80, 0x0
+  .word 0x130, 0xfffffffe, 0xfffffffe, 0x0
+  .word 0x140, 0xfffffffe, 0xfffffffe, 0x0
+  .word 0x150, 0xfffffffe, 0xfffffffe, 0x0
+  .word 0x130, 0xfffffffe, 0x6c, 0xffffff92
+  .word 0x140, 0xfffffffe, 0x6c, 0xffffff92
+  .word 0x150, 0xfffffffe, 0x6c, 0x0
+  .word 0x130, 0xfffffffe, 0x10, 0xffffffee
+  .word 0x140, 0xfffffffe, 0x10, 0xffffffee
+  .word 0x150, 0xfffffffe, 0x10, 0x0
+  .word 0x130, 0x1000000, 0x100, 0x1000000
+  .word 0x140, 0x1000000, 0x100, 0x1000000
+  .word 0x150, 0x1000000, 0x100, 0x0
+  .word 0x130, 0x1000000, 0x1000000, 0x0
+  .word 0x140, 0x1000000, 0x1000000, 0x0
+  .word 0x150, 0x1000000, 0x1000000, 0x0
+  .word 0x130, 0x1000000, 0x215b8, 0x1000000
+  .word 0x140, 0x1000000, 0x215b8, 0x1000000
+  .word 0x150, 0x1000000, 0x215b8, 0x0
+  .word 0x130, 0x1000000, 0xd28fd14, 0x0
+  .word 0x140, 0x1000000, 0xd28fd14, 0x0
+  .word 0x150, 0x1000000, 0xd28fd14, 0x0
+  .word 0x130, 0xff00ff00, 0x8000, 0xff007f00
+  .word 0x140, 0xff00ff00, 0x8000, 0xff007f00
+  .word 0x150, 0xff00ff00, 0x8000, 0x0
+  .word 0x130, 0xff00ff00, 0xff00ff00, 0x0
+  .word 0x140, 0xff00ff00, 0xff00ff00, 0x0
+  .word 0x150, 0xff00ff00, 0xff00ff00, 0x0
+  .word 0x130, 0xff00ff00, 0xe69, 0xff00f100
+  .word 0x140, 0xff00ff00, 0xe69, 0xff00f100
+  .word 0x150, 0xff00ff00, 0xe69, 0x0
+  .word 0x130, 0x10080, 0x0, 0x10080
+  .word 0x140, 0x10080, 0x0, 0x10080
+  .word 0x150, 0x10080, 0x0, 0x0
+  .word 0x130, 0x10080, 0x10000, 0x80
+  .word 0x140, 0x10080, 0x10000, 0x80
+  .word 0x150, 0x10080, 0x10000, 0x0
+  .word 0x130, 0x10080, 0x10080, 0x0
+  .word 0x140, 0x10080, 0x10080, 0x0
+  .word 0x150, 0x10080, 0x10080, 0x0
+  .word 0x130, 0x10080, 0x73698785, 0x0
+  .word 0x140, 0x10080, 0x73698785, 0x0
+  .word 0x150, 0x10080, 0x73698785, 0x0
+  .word 0x130, 0x723b417, 0x2, 0x723b415
+  .word 0x140, 0x723b417, 0x2, 0x723b415
+  .word 0x150, 0x723b417, 0x2, 0x0
+  .word 0x130, 0x723b417, 0x80000000, 0x723b417
+  .word 0x140, 0x723b417, 0x80000000, 0x723b417
+  .word 0x150, 0x723b417, 0x80000000, 0x0
+  .word 0x130, 0x723b417, 0x723b417, 0x0
+  .word 0x140, 0x723b417, 0x723b417, 0x0
+  .word 0x150, 0x723b417, 0x723b417, 0x0
+  .word 0x130, 0x723b417, 0x1, 0x723b416
+  .word 0x140, 0x723b417, 0x1, 0x723b416
+  .word 0x150, 0x723b417, 0x1, 0x0
+  .word 0x130, 0x6c, 0x80, 0x6c
+  .word 0x140, 0x6c, 0x80, 0x6c
+  .word 0x150, 0x6c, 0x80, 0x0
+  .word 0x130, 0x6c, 0xfffffffe, 0x0
+  .word 0x140, 0x6c, 0xfffffffe, 0x0
+  .word 0x150, 0x6c, 0xfffffffe, 0x0
+  .word 0x130, 0x6c, 0x6c, 0x0
+  .word 0x140, 0x6c, 0x6c, 0x0
+  .word 0x150, 0x6c, 0x6c, 0x0
+  .word 0x130, 0x6c, 0x10, 0x6c
+  .word 0x140, 0x6c, 0x10, 0x6c
+  .word 0x150, 0x6c, 0x10, 0x0
+  .word 0x130, 0x215b8, 0x100, 0x214b8
+  .word 0x140, 0x215b8, 0x100, 0x214b8
+  .word 0x150, 0x215b8, 0x100, 0x0
+  .word 0x130, 0x215b8, 0x1000000, 0x215b8
+  .word 0x140, 0x215b8, 0x1000000, 0x215b8
+  .word 0x150, 0x215b8, 0x1000000, 0x0
+  .word 0x130, 0x215b8, 0x215b8, 0x0
+  .word 0x140, 0x215b8, 0x215b8, 0x0
+  .word 0x150, 0x215b8, 0x215b8, 0x0
+  .word 0x130, 0x215b8, 0xd28fd14, 0x200a8
+  .word 0x140, 0x215b8, 0xd28fd14, 0x200a8
+  .word 0x150, 0x215b8, 0xd28fd14, 0x0
+  .word 0x130, 0xe69, 0x8000, 0xe69
+  .word 0x140, 0xe69, 0x8000, 0xe69
+  .word 0x150, 0xe69, 0x8000, 0x0
+  .word 0x130, 0xe69, 0xff00ff00, 0x69
+  .word 0x140, 0xe69, 0xff00ff00, 0x69
+  .word 0x150, 0xe69, 0xff00ff00, 0x0
+  .word 0x130, 0xe69, 0xe69, 0x0
+  .word 0x140, 0xe69, 0xe69, 0x0
+  .word 0x150, 0xe69, 0xe69, 0x0
+  .word 0x130, 0x73698785, 0x0, 0x73698785
+  .word 0x140, 0x73698785, 0x0, 0x73698785
+  .word 0x150, 0x73698785, 0x0, 0x0
+  .word 0x130, 0x73698785, 0x10000, 0x73688785
+  .word 0x140, 0x73698785, 0x10000, 0x73688785
+  .word 0x150, 0x73698785, 0x10000, 0x0
+  .word 0x130, 0x73698785, 0x10080, 0x73688705
+  .word 0x140, 0x73698785, 0x10080, 0x73688705
+  .word 0x150, 0x73698785, 0x10080, 0x0
+  .word 0x130, 0x73698785, 0x73698785, 0x0
+  .word 0x140, 0x73698785, 0x73698785, 0x0
+  .word 0x150, 0x73698785, 0x73698785, 0x0
+  .word 0x130, 0x1, 0x2, 0x1
+  .word 0x140, 0x1, 0x2, 0x1
+  .word 0x150, 0x1, 0x2, 0x0
+  .word 0x130, 0x1, 0x80000000, 0x1
+  .word 0x140, 0x1, 0x80000000, 0x1
+  .word 0x150, 0x1, 0x80000000, 0x0
+  .word 0x130, 0x1, 0x723b417, 0x0
+  .word 0x140, 0x1, 0x723b417, 0x0
+  .word 0x150, 0x1, 0x723b417, 0x0
+  .word 0x130, 0x1, 0x1, 0x0
+  .word 0x140, 0x1, 0x1, 0x0
+  .word 0x150, 0x1, 0x1, 0x0
+  .word 0x130, 0x10, 0x80, 0x10
+  .word 0x140, 0x10, 0x80, 0x10
+  .word 0x150, 0x10, 0x80, 0x0
+  .word 0x130, 0x10, 0xfffffffe, 0x0
+  .word 0x140, 0x10, 0xfffffffe, 0x0
+  .word 0x150, 0x10, 0xfffffffe, 0x0
+  .word 0x130, 0x10, 0x6c, 0x10
+  .word 0x140, 0x10, 0x6c, 0x10
+  .word 0x150, 0x10, 0x6c, 0x0
+  .word 0x130, 0x10, 0x10, 0x0
+  .word 0x140, 0x10, 0x10, 0x0
+  .word 0x150, 0x10, 0x10, 0x0
+  .word 0x130, 0xd28fd14, 0x100, 0xd28fc14
+  .word 0x140, 0xd28fd14, 0x100, 0xd28fc14
+  .word 0x150, 0xd28fd14, 0x100, 0x0
+  .word 0x130, 0xd28fd14, 0x1000000, 0xc28fd14
+  .word 0x140, 0xd28fd14, 0x1000000, 0xc28fd14
+  .word 0x150, 0xd28fd14, 0x1000000, 0x0
+  .word 0x130, 0xd28fd14, 0x215b8, 0xd28e804
+  .word 0x140, 0xd28fd14, 0x215b8, 0xd28e804
+  .word 0x150, 0xd28fd14, 0x215b8, 0x0
+  .word 0x130, 0xd28fd14, 0xd28fd14, 0x0
+  .word 0x140, 0xd28fd14, 0xd28fd14, 0x0
+  .word 0x150, 0xd28fd14, 0xd28fd14, 0x0
+  .word 0x160, 0x0, 0x12345687, 0x0
+  .word 0x170, 0x87654321, 0x0, 0x87654321
+  .word 0x180, 0x0, 0x0, 0xffffffff
+  .word 0x180, 0x0, 0x2, 0xfffffffd
+  .word 0x180, 0x0, 0x80, 0xffffff7f
+  .word 0x180, 0x0, 0x100, 0xfffffeff
+  .word 0x180, 0x0, 0x8000, 0xffff7fff
+  .word 0x180, 0x0, 0x10000, 0xfffeffff
+  .word 0x180, 0x0, 0x80000000, 0x7fffffff
+  .word 0x180, 0x0, 0xfffffffe, 0x1
+  .word 0x180, 0x0, 0x1000000, 0xfeffffff
+  .word 0x180, 0x0, 0xff00ff00, 0xff00ff
+  .word 0x180, 0x0, 0x10080, 0xfffeff7f
+  .word 0x180, 0x0, 0x723b417, 0xf8dc4be8
+  .word 0x180, 0x0, 0x6c, 0xffffff93
+  .word 0x180, 0x0, 0x215b8, 0xfffdea47
+  .word 0x180, 0x0, 0xe69, 0xfffff196
+  .word 0x180, 0x0, 0x73698785, 0x8c96787a
+  .word 0x180, 0x0, 0x1, 0xfffffffe
+  .word 0x180, 0x0, 0x10, 0xffffffef
+  .word 0x180, 0x0, 0xd28fd14, 0xf2d702eb
+  .word 0x180, 0x2, 0x0, 0xffffffff
+  .word 0x180, 0x2, 0x2, 0xffffffff
+  .word 0x180, 0x2, 0x80, 0xffffff7f
+  .word 0x180, 0x2, 0x100, 0xfffffeff
+  .word 0x180, 0x2, 0x8000, 0xffff7fff
+  .word 0x180, 0x2, 0x10000, 0xfffeffff
+  .word 0x180, 0x2, 0x80000000, 0x7fffffff
+  .word 0x180, 0x2, 0xfffffffe, 0x3
+  .word 0x180, 0x2, 0x1000000, 0xfeffffff
+  .word 0x180, 0x2, 0xff00ff00, 0xff00ff
+  .word 0x180, 0x2, 0x10080, 0xfffeff7f
+  .word 0x180, 0x2, 0x723b417, 0xf8dc4bea
+  .word 0x180, 0x2, 0x6c, 0xffffff93
+  .word 0x180, 0x2, 0x215b8, 0xfffdea47
+  .word 0x180, 0x2, 0xe69, 0xfffff196
+  .word 0x180, 0x2, 0x73698785, 0x8c96787a
+  .word 0x180, 0x2, 0x1, 0xfffffffe
+  .word 0x180, 0x2, 0x10, 0xffffffef
+  .word 0x180, 0x2, 0xd28fd14, 0xf2d702eb
+  .word 0x180, 0x80, 0x0, 0xffffffff
+  .word 0x180, 0x80, 0x2, 0xfffffffd
+  .word 0x180, 0x80, 0x80, 0xffffffff
+  .word 0x180, 0x80, 0x100, 0xfffffeff
+  .word 0x180, 0x80, 0x8000, 0xffff7fff
+  .word 0x180, 0x80, 0x10000, 0xfffeffff
+  .word 0x180, 0x80, 0x80000000, 0x7fffffff
+  .word 0x180, 0x80, 0xfffffffe, 0x81
+  .word 0x180, 0x80, 0x1000000, 0xfeffffff
+  .word 0x180, 0x80, 0xff00ff00, 0xff00ff
+  .word 0x180, 0x80, 0x10080, 0xfffeffff
+  .word 0x180, 0x80, 0x723b417, 0xf8dc4be8
+  .word 0x180, 0x80, 0x6c, 0xffffff93
+  .word 0x180, 0x80, 0x215b8, 0xfffdeac7
+  .word 0x180, 0x80, 0xe69, 0xfffff196
+  .word 0x180, 0x80, 0x73698785, 0x8c9678fa
+  .word 0x180, 0x80, 0x1, 0xfffffffe
+  .word 0x180, 0x80, 0x10, 0xffffffef
+  .word 0x180, 0x80, 0xd28fd14, 0xf2d702eb
+  .word 0x180, 0x100, 0x0, 0xffffffff
+  .word 0x180, 0x100, 0x2, 0xfffffffd
+  .word 0x180, 0x100, 0x80, 0xffffff7f
+  .word 0x180, 0x100, 0x100, 0xffffffff
+  .word 0x180, 0x100, 0x8000, 0xffff7fff
+  .word 0x180, 0x100, 0x10000, 0xfffeffff
+  .word 0x180, 0x100, 0x80000000, 0x7fffffff
+  .word 0x180, 0x100, 0xfffffffe, 0x101
+  .word 0x180, 0x100, 0x1000000, 0xfeffffff
+  .word 0x180, 0x100, 0xff00ff00, 0xff01ff
+  .word 0x180, 0x100, 0x10080, 0xfffeff7f
+  .word 0x180, 0x100, 0x723b417, 0xf8dc4be8
+  .word 0x180, 0x100, 0x6c, 0xffffff93
+  .word 0x180, 0x100, 0x215b8, 0xfffdeb47
+  .word 0x180, 0x100, 0xe69, 0xfffff196
+  .word 0x180, 0x100, 0x73698785, 0x8c96797a
+  .word 0x180, 0x100, 0x1, 0xfffffffe
+  .word 0x180, 0x100, 0x10, 0xffffffef
+  .word 0x180, 0x100, 0xd28fd14, 0xf2d703eb
+  .word 0x180, 0x8000, 0x0, 0xffffffff
+  .word 0x180, 0x8000, 0x2, 0xfffffffd
+  .word 0x180, 0x8000, 0x80, 0xffffff7f
+  .word 0x180, 0x8000, 0x100, 0xfffffeff
+  .word 0x180, 0x8000, 0x8000, 0xffffffff
+  .word 0x180, 0x8000, 0x10000, 0xfffeffff
+  .word 0x180, 0x8000, 0x80000000, 0x7fffffff
+  .word 0x180, 0x8000, 0xfffffffe, 0x8001
+  .word 0x180, 0x8000, 0x1000000, 0xfeffffff
+  .word 0x180, 0x8000, 0xff00ff00, 0xff80ff
+  .word 0x180, 0x8000, 0x10080, 0xfffeff7f
+  .word 0x180, 0x8000, 0x723b417, 0xf8dccbe8
+  .word 0x180, 0x8000, 0x6c, 0xffffff93
+  .word 0x180, 0x8000, 0x215b8, 0xfffdea47
+  .word 0x180, 0x8000, 0xe69, 0xfffff196
+  .word 0x180, 0x8000, 0x73698785, 0x8c96f87a
+  .word 0x180, 0x8000, 0x1, 0xfffffffe
+  .word 0x180, 0x8000, 0x10, 0xffffffef
+  .word 0x180, 0x8000, 0xd28fd14, 0xf2d782eb
+  .word 0x180, 0x10000, 0x0, 0xffffffff
+  .word 0x180, 0x10000, 0x2, 0xfffffffd
+  .word 0x180, 0x10000, 0x80, 0xffffff7f
+  .word 0x180, 0x10000, 0x100, 0xfffffeff
+  .word 0x180, 0x10000, 0x8000, 0xffff7fff
+  .word 0x180, 0x10000, 0x10000, 0xffffffff
+  .word 0x180, 0x10000, 0x80000000, 0x7fffffff
+  .word 0x180, 0x10000, 0xfffffffe, 0x10001
+  .word 0x180, 0x10000, 0x1000000, 0xfeffffff
+  .word 0x180, 0x10000, 0xff00ff00, 0xff00ff
+  .word 0x180, 0x10000, 0x10080, 0xffffff7f
+  .word 0x180, 0x10000, 0x723b417, 0xf8dd4be8
+  .word 0x180, 0x10000, 0x6c, 0xffffff93
+  .word 0x180, 0x10000, 0x215b8, 0xfffdea47
+  .word 0x180, 0x10000, 0xe69, 0xfffff196
+  .word 0x180, 0x10000, 0x73698785, 0x8c97787a
+  .word 0x180, 0x10000, 0x1, 0xfffffffe
+  .word 0x180, 0x10000, 0x10, 0xffffffef
+  .word 0x180, 0x10000, 0xd28fd14, 0xf2d702eb
+  .word 0x180, 0x80000000, 0x0, 0xffffffff
+  .word 0x180, 0x80000000, 0x2, 0xfffffffd
+  .word 0x180, 0x80000000, 0x80, 0xffffff7f
+  .word 0x180, 0x80000000, 0x100, 0xfffffeff
+  .word 0x180, 0x80000000, 0x8000, 0xffff7fff
+  .word 0x180, 0x80000000, 0x10000, 0xfffeffff
+  .word 0x180, 0x80000000, 0x80000000, 0xffffffff
+  .word 0x180, 0x80000000, 0xfffffffe, 0x80000001
+  .word 0x180, 0x80000000, 0x1000000, 0xfeffffff
+  .word 0x180, 0x80000000, 0xff00ff00, 0x80ff00ff
+  .word 0x180, 0x80000000, 0x10080, 0xfffeff7f
+  .word 0x180, 0x80000000, 0x723b417, 0xf8dc4be8
+  .word 0x180, 0x80000000, 0x6c, 0xffffff93
+  .word 0x180, 0x80000000, 0x215b8, 0xfffdea47
+  .word 0x180, 0x80000000, 0xe69, 0xfffff196
+  .word 0x180, 0x80000000, 0x73698785, 0x8c96787a
+  .word 0x180, 0x80000000, 0x1, 0xfffffffe
+  .word 0x180, 0x80000000, 0x10, 0xffffffef
+  .word 0x180, 0x80000000, 0xd28fd14, 0xf2d702eb
+  .word 0x180, 0xfffffffe, 0x0, 0xffffffff
+  .word 0x180, 0xfffffffe, 0x2, 0xffffffff
+  .word 0x180, 0xfffffffe, 0x80, 0xffffffff
+  .word 0x180, 0xfffffffe, 0x100, 0xffffffff
+  .word 0x180, 0xfffffffe, 0x8000, 0xffffffff
+  .word 0x180, 0xfffffffe, 0x10000, 0xffffffff
+  .word 0x180, 0xfffffffe, 0x80000000, 0xffffffff
+  .word 0x180, 0xfffffffe, 0xfffffffe, 0xffffffff
+  .word 0x180, 0xfffffffe, 0x1000000, 0xffffffff
+  .word 0x180, 0xfffffffe, 0xff00ff00, 0xffffffff
+  .word 0x180, 0xfffffffe, 0x10080, 0xffffffff
+  .word 0x180, 0xfffffffe, 0x723b417, 0xfffffffe
+  .word 0x180, 0xfffffffe, 0x6c, 0xffffffff
+  .word 0x180, 0xfffffffe, 0x215b8, 0xffffffff
+  .word 0x180, 0xfffffffe, 0xe69, 0xfffffffe
+  .word 0x180, 0xfffffffe, 0x73698785, 0xfffffffe
+  .word 0x180, 0xfffffffe, 0x1, 0xfffffffe
+  .word 0x180, 0xfffffffe, 0x10, 0xffffffff
+  .word 0x180, 0xfffffffe, 0xd28fd14, 0xffffffff
+  .word 0x180, 0x1000000, 0x0, 0xffffffff
+  .word 0x180, 0x1000000, 0x2, 0xfffffffd
+  .word 0x180, 0x1000000, 0x80, 0xffffff7f
+  .word 0x180, 0x1000000, 0x100, 0xfffffeff
+  .word 0x180, 0x1000000, 0x8000, 0xffff7fff
+  .word 0x180, 0x1000000, 0x10000, 0xfffeffff
+  .word 0x180, 0x1000000, 0x80000000, 0x7fffffff
+  .word 0x180, 0x1000000, 0xfffffffe, 0x1000001
+  .word 0x180, 0x1000000, 0x1000000, 0xffffffff
+  .word 0x180, 0x1000000, 0xff00ff00, 0x1ff00ff
+  .word 0x180, 0x1000000, 0x10080, 0xfffeff7f
+  .word 0x180, 0x1000000, 0x723b417, 0xf9dc4be8
+  .word 0x180, 0x1000000, 0x6c, 0xffffff93
+  .word 0x180, 0x1000000, 0x215b8, 0xfffdea47
+  .word 0x180, 0x1000000, 0xe69, 0xfffff196
+  .word 0x180, 0x1000000, 0x73698785, 0x8d96787a
+  .word 0x180, 0x1000000, 0x1, 0xfffffffe
+  .word 0x180, 0x1000000, 0x10, 0xffffffef
+  .word 0x180, 0x1000000, 0xd28fd14, 0xf3d702eb
+  .word 0x180, 0xff00ff00, 0x0, 0xffffffff
+  .word 0x180, 0xff00ff00, 0x2, 0xfffffffd
+  .word 0x180, 0xff00ff00, 0x80, 0xffffff7f
+  .word 0x180, 0xff00ff00, 0x100, 0xffffffff
+  .word 0x180, 0xff00ff00, 0x8000, 0xffffffff
+  .word 0x180, 0xff00ff00, 0x10000, 0xfffeffff
+  .word 0x180, 0xff00ff00, 0x80000000, 0xffffffff
+  .word 0x180, 0xff00ff00, 0xfffffffe, 0xff00ff01
+  .word 0x180, 0xff00ff00, 0x1000000, 0xffffffff
+  .word 0x180, 0xff00ff00, 0xff00ff00, 0xffffffff
+  .word 0x180, 0xff00ff00, 0x10080, 0xfffeff7f
+  .word 0x180, 0xff00ff00, 0x723b417, 0xffdcffe8
+  .word 0x180, 0xff00ff00, 0x6c, 0xffffff93
+  .word 0x180, 0xff00ff00, 0x215b8, 0xfffdff47
+  .word 0x180, 0xff00ff00, 0xe69, 0xffffff96
+  .word 0x180, 0xff00ff00, 0x73698785, 0xff96ff7a
+  .word 0x180, 0xff00ff00, 0x1, 0xfffffffe
+  .word 0x180, 0xff00ff00, 0x10, 0xffffffef
+  .word 0x180, 0xff00ff00, 0xd28fd14, 0xffd7ffeb
+  .word 0x180, 0x10080, 0x0, 0xffffffff
+  .word 0x180, 0x10080, 0x2, 0xfffffffd
+  .word 0x180, 0x10080, 0x80, 0xffffffff
+  .word 0x180, 0x10080, 0x100, 0xfffffeff
+  .word 0x180, 0x10080, 0x8000, 0xffff7fff
+  .word 0x180, 0x10080, 0x10000, 0xffffffff
+  .word 0x180, 0x10080, 0x80000000, 0x7fffffff
+  .word 0x180, 0x10080, 0xfffffffe, 0x10081
+  .word 0x180, 0x10080, 0x1000000, 0xfeffffff
+  .word 0x180, 0x10080, 0xff00ff00, 0xff00ff
+  .word 0x180, 0x10080, 0x10080, 0xffffffff
+  .word 0x180, 0x10080, 0x723b417, 0xf8dd4be8
+  .word 0x180, 0x10080, 0x6c, 0xffffff93
+  .word 0x180, 0x10080, 0x215b8, 0xfffdeac7
+  .word 0x180, 0x10080, 0xe69, 0xfffff196
+  .word 0x180, 0x10080, 0x73698785, 0x8c9778fa
+  .word 0x180, 0x10080, 0x1, 0xfffffffe
+  .word 0x180, 0x10080, 0x10, 0xffffffef
+  .word 0x180, 0x10080, 0xd28fd14, 0xf2d702eb
+  .word 0x180, 0x723b417, 0x0, 0xffffffff
+  .word 0x180, 0x723b417, 0x2, 0xffffffff
+  .word 0x180, 0x723b417, 0x80, 0xffffff7f
+  .word 0x180, 0x723b417, 0x100, 0xfffffeff
+  .word 0x180, 0x723b417, 0x8000, 0xffffffff
+  .word 0x180, 0x723b417, 0x10000, 0xffffffff
+  .word 0x180, 0x723b417, 0x80000000, 0x7fffffff
+  .word 0x180, 0x723b417, 0xfffffffe, 0x723b417
+  .word 0x180, 0x723b417, 0x1000000, 0xffffffff
+  .word 0x180, 0x723b417, 0xff00ff00, 0x7ffb4ff
+  .word 0x180, 0x723b417, 0x10080, 0xffffff7f
+  .word 0x180, 0x723b417, 0x723b417, 0xffffffff
+  .word 0x180, 0x723b417, 0x6c, 0xffffff97
+  .word 0x180, 0x723b417, 0x215b8, 0xfffffe57
+  .word 0x180, 0x723b417, 0xe69, 0xfffff597
+  .word 0x180, 0x723b417, 0x73698785, 0x8fb7fc7f
+  .word 0x180, 0x723b417, 0x1, 0xffffffff
+  .word 0x180, 0x723b417, 0x10, 0xffffffff
+  .word 0x180, 0x723b417, 0xd28fd14, 0xf7f7b6ff
+  .word 0x180, 0x6c, 0x0, 0xffffffff
+  .word 0x180, 0x6c, 0x2, 0xfffffffd
+  .word 0x180, 0x6c, 0x80, 0xffffff7f
+  .word 0x180, 0x6c, 0x100, 0xfffffeff
+  .word 0x180, 0x6c, 0x8000, 0xffff7fff
+  .word 0x180, 0x6c, 0x10000, 0xfffeffff
+  .word 0x180, 0x6c, 0x80000000, 0x7fffffff
+  .word 0x180, 0x6c, 0xfffffffe, 0x6d
+  .word 0x180, 0x6c, 0x1000000, 0xfeffffff
+  .word 0x180, 0x6c, 0xff00ff00, 0xff00ff
+  .word 0x180, 0x6c, 0x10080, 0xfffeff7f
+  .word 0x180, 0x6c, 0x723b417, 0xf8dc4bec
+  .word 0x180, 0x6c, 0x6c, 0xffffffff
+  .word 0x180, 0x6c, 0x215b8, 0xfffdea6f
+  .word 0x180, 0x6c, 0xe69, 0xfffff1fe
+  .word 0x180, 0x6c, 0x73698785, 0x8c96787e
+  .word 0x180, 0x6c, 0x1, 0xfffffffe
+  .word 0x180, 0x6c, 0x10, 0xffffffef
+  .word 0x180, 0x6c, 0xd28fd14, 0xf2d702ef
+  .word 0x180, 0x215b8, 0x0, 0xffffffff
+  .word 0x180, 0x215b8, 0x2, 0xfffffffd
+  .word 0x180, 0x215b8, 0x80, 0xffffffff
+  .word 0x180, 0x215b8, 0x100, 0xffffffff
+  .word 0x180, 0x215b8, 0x8000, 0xffff7fff
+  .word 0x180, 0x215b8, 0x10000, 0xfffeffff
+  .word 0x180, 0x215b8, 0x80000000, 0x7fffffff
+  .word 0x180, 0x215b8, 0xfffffffe, 0x215b9
+  .word 0x180, 0x215b8, 0x1000000, 0xfeffffff
+  .word 0x180, 0x215b8, 0xff00ff00, 0xff15ff
+  .word 0x180, 0x215b8, 0x10080, 0xfffeffff
+  .word 0x180, 0x215b8, 0x723b417, 0xf8de5ff8
+  .word 0x180, 0x215b8, 0x6c, 0xffffffbb
+  .word 0x180, 0x215b8, 0x215b8, 0xffffffff
+  .word 0x180, 0x215b8, 0xe69, 0xfffff5be
+  .word 0x180, 0x215b8, 0x73698785, 0x8c967dfa
+  .word 0x180, 0x215b8, 0x1, 0xfffffffe
+  .word 0x180, 0x215b8, 0x10, 0xffffffff
+  .word 0x180, 0x215b8, 0xd28fd14, 0xf2d717fb
+  .word 0x180, 0xe69, 0x0, 0xffffffff
+  .word 0x180, 0xe69, 0x2, 0xfffffffd
+  .word 0x180, 0xe69, 0x80, 0xffffff7f
+  .word 0x180, 0xe69, 0x100, 0xfffffeff
+  .word 0x180, 0xe69, 0x8000, 0xffff7fff
+  .word 0x180, 0xe69, 0x10000, 0xfffeffff
+  .word 0x180, 0xe69, 0x80000000, 0x7fffffff
+  .word 0x180, 0xe69, 0xfffffffe, 0xe69
+  .word 0x180, 0xe69, 0x1000000, 0xfeffffff
+  .word 0x180, 0xe69, 0xff00ff00, 0xff0eff
+  .word 0x180, 0xe69, 0x10080, 0xfffeff7f
+  .word 0x180, 0xe69, 0x723b417, 0xf8dc4fe9
+  .word 0x180, 0xe69, 0x6c, 0xfffffffb
+  .word 0x180, 0xe69, 0x215b8, 0xfffdee6f
+  .word 0x180, 0xe69, 0xe69, 0xffffffff
+  .word 0x180, 0xe69, 0x73698785, 0x8c967e7b
+  .word 0x180, 0xe69, 0x1, 0xffffffff
+  .word 0x180, 0xe69, 0x10, 0xffffffef
+  .word 0x180, 0xe69, 0xd28fd14, 0xf2d70eeb
+  .word 0x180, 0x73698785, 0x0, 0xffffffff
+  .word 0x180, 0x73698785, 0x2, 0xfffffffd
+  .word 0x180, 0x73698785, 0x80, 0xffffffff
+  .word 0x180, 0x73698785, 0x100, 0xffffffff
+  .word 0x180, 0x73698785, 0x8000, 0xffffffff
+  .word 0x180, 0x73698785, 0x10000, 0xffffffff
+  .word 0x180, 0x73698785, 0x80000000, 0x7fffffff
+  .word 0x180, 0x73698785, 0xfffffffe, 0x73698785
+  .word 0x180, 0x73698785, 0x1000000, 0xffffffff
+  .word 0x180, 0x73698785, 0xff00ff00, 0x73ff87ff
+  .word 0x180, 0x73698785, 0x10080, 0xffffffff
+  .word 0x180, 0x73698785, 0x723b417, 0xfbfdcfed
+  .word 0x180, 0x73698785, 0x6c, 0xffffff97
+  .word 0x180, 0x73698785, 0x215b8, 0xfffdefc7
+  .word 0x180, 0x73698785, 0xe69, 0xfffff797
+  .word 0x180, 0x73698785, 0x73698785, 0xffffffff
+  .word 0x180, 0x73698785, 0x1, 0xffffffff
+  .word 0x180, 0x73698785, 0x10, 0xffffffef
+  .word 0x180, 0x73698785, 0xd28fd14, 0xf3ff87ef
+  .word 0x180, 0x1, 0x0, 0xffffffff
+  .word 0x180, 0x1, 0x2, 0xfffffffd
+  .word 0x180, 0x1, 0x80, 0xffffff7f
+  .word 0x180, 0x1, 0x100, 0xfffffeff
+  .word 0x180, 0x1, 0x8000, 0xffff7fff
+  .word 0x180, 0x1, 0x10000, 0xfffeffff
+  .word 0x180, 0x1, 0x80000000, 0x7fffffff
+  .word 0x180, 0x1, 0xfffffffe, 0x1
+  .word 0x180, 0x1, 0x1000000, 0xfeffffff
+  .word 0x180, 0x1, 0xff00ff00, 0xff00ff
+  .word 0x180, 0x1, 0x10080, 0xfffeff7f
+  .word 0x180, 0x1, 0x723b417, 0xf8dc4be9
+  .word 0x180, 0x1, 0x6c, 0xffffff93
+  .word 0x180, 0x1, 0x215b8, 0xfffdea47
+  .word 0x180, 0x1, 0xe69, 0xfffff197
+  .word 0x180, 0x1, 0x73698785, 0x8c96787b
+  .word 0x180, 0x1, 0x1, 0xffffffff
+  .word 0x180, 0x1, 0x10, 0xffffffef
+  .word 0x180, 0x1, 0xd28fd14, 0xf2d702eb
+  .word 0x180, 0x10, 0x0, 0xffffffff
+  .word 0x180, 0x10, 0x2, 0xfffffffd
+  .word 0x180, 0x10, 0x80, 0xffffff7f
+  .word 0x180, 0x10, 0x100, 0xfffffeff
+  .word 0x180, 0x10, 0x8000, 0xffff7fff
+  .word 0x180, 0x10, 0x10000, 0xfffeffff
+  .word 0x180, 0x10, 0x80000000, 0x7fffffff
+  .word 0x180, 0x10, 0xfffffffe, 0x11
+  .word 0x180, 0x10, 0x1000000, 0xfeffffff
+  .word 0x180, 0x10, 0xff00ff00, 0xff00ff
+  .word 0x180, 0x10, 0x10080, 0xfffeff7f
+  .word 0x180, 0x10, 0x723b417, 0xf8dc4bf8
+  .word 0x180, 0x10, 0x6c, 0xffffff93
+  .word 0x180, 0x10, 0x215b8, 0xfffdea57
+  .word 0x180, 0x10, 0xe69, 0xfffff196
+  .word 0x180, 0x10, 0x73698785, 0x8c96787a
+  .word 0x180, 0x10, 0x1, 0xfffffffe
+  .word 0x180, 0x10, 0x10, 0xffffffff
+  .word 0x180, 0x10, 0xd28fd14, 0xf2d702fb
+  .word 0x180, 0xd28fd14, 0x0, 0xffffffff
+  .word 0x180, 0xd28fd14, 0x2, 0xfffffffd
+  .word 0x180, 0xd28fd14, 0x80, 0xffffff7f
+  .word 0x180, 0xd28fd14, 0x100, 0xffffffff
+  .word 0x180, 0xd28fd14, 0x8000, 0xffffffff
+  .word 0x180, 0xd28fd14, 0x10000, 0xfffeffff
+  .word 0x180, 0xd28fd14, 0x80000000, 0x7fffffff
+  .word 0x180, 0xd28fd14, 0xfffffffe, 0xd28fd15
+  .word 0x180, 0xd28fd14, 0x1000000, 0xffffffff
+  .word 0x180, 0xd28fd14, 0xff00ff00, 0xdfffdff
+  .word 0x180, 0xd28fd14, 0x10080, 0xfffeff7f
+  .word 0x180, 0xd28fd14, 0x723b417, 0xfdfcfffc
+  .word 0x180, 0xd28fd14, 0x6c, 0xffffff97
+  .word 0x180, 0xd28fd14, 0x215b8, 0xfffdff57
+  .word 0x180, 0xd28fd14, 0xe69, 0xfffffd96
+  .word 0x180, 0xd28fd14, 0x73698785, 0x8dbefd7e
+  .word 0x180, 0xd28fd14, 0x1, 0xfffffffe
+  .word 0x180, 0xd28fd14, 0x10, 0xffffffff
+  .word 0x180, 0xd28fd14, 0xd28fd14, 0xffffffff
+  .word 0x190, 0x0, 0x0, 0xffffffff
+  .word 0x1a0, 0x0, 0x0, 0xffffffff
+  .word 0x1b0, 0x0, 0x0, 0xffffffff
+  .word 0x190, 0x0, 0x10000, 0xfffeffff
+  .word 0x1a0, 0x0, 0x10000, 0xfffeffff
+  .word 0x1b0, 0x0, 0x10000, 0xffffffff
+  .word 0x190, 0x0, 0x10080, 0xfffeff7f
+  .word 0x1a0, 0x0, 0x10080, 0xfffeff7f
+  .word 0x1b0, 0x0, 0x10080, 0xffffffff
+  .word 0x190, 0x0, 0x73698785, 0x8c96787a
+  .word 0x1a0, 0x0, 0x73698785, 0x8c96787a
+  .word 0x1b0, 0x0, 0x73698785, 0xffffffff
+  .word 0x190, 0x2, 0x2, 0xffffffff
+  .word 0x1a0, 0x2, 0x2, 0xffffffff
+  .word 0x1b0, 0x2, 0x2, 0xffffffff
+  .word 0x190, 0x2, 0x80000000, 0x7fffffff
+  .word 0x1a0, 0x2, 0x80000000, 0x7fffffff
+  .word 0x1b0, 0x2, 0x80000000, 0xffffffff
+  .word 0x190, 0x2, 0x723b417, 0xf8dc4bea
+  .word 0x1a0, 0x2, 0x723b417, 0xf8dc4bea
+  .word 0x1b0, 0x2, 0x723b417, 0xffffffff
+  .word 0x190, 0x2, 0x1, 0xfffffffe
+  .word 0x1a0, 0x2, 0x1, 0xfffffffe
+  .word 0x1b0, 0x2, 0x1, 0xffffffff
+  .word 0x190, 0x80, 0x80, 0xffffffff
+  .word 0x1a0, 0x80, 0x80, 0xffffffff
+  .word 0x1b0, 0x80, 0x80, 0xffffffff
+  .word 0x190, 0x80, 0xfffffffe, 0x81
+  .word 0x1a0, 0x80, 0xfffffffe, 0x81
+  .word 0x1b0, 0x80, 0xfffffffe, 0xffffffff
+  .word 0x190, 0x80, 0x6c, 0xffffff93
+  .word 0x1a0, 0x80, 0x6c, 0xffffff93
+  .word 0x1b0, 0x80, 0x6c, 0xffffffff
+  .word 0x190, 0x80, 0x10, 0xffffffef
+  .word 0x1a0, 0x80, 0x10, 0xffffffef
+  .word 0x1b0, 0x80, 0x10, 0xffffffff
+  .word 0x190, 0x100, 0x100, 0xffffffff
+  .word 0x1a0, 0x100, 0x100, 0xffffffff
+  .word 0x1b0, 0x100, 0x100, 0xffffffff
+  .word 0x190, 0x100, 0x1000000, 0xfeffffff
+  .word 0x1a0, 0x100, 0x1000000, 0xfeffffff
+  .word 0x1b0, 0x100, 0x1000000, 0xffffffff
+  .word 0x190, 0x100, 0x215b8, 0xfffdeb47
+  .word 0x1a0, 0x100, 0x215b8, 0xfffdeb47
+  .word 0x1b0, 0x100, 0x215b8, 0xffffffff
+  .word 0x190, 0x100, 0xd28fd14, 0xf2d703eb
+  .word 0x1a0, 0x100, 0xd28fd14, 0xf2d703eb
+  .word 0x1b0, 0x100, 0xd28fd14, 0xffffffff
+  .word 0x190, 0x8000, 0x8000, 0xffffffff
+  .word 0x1a0, 0x8000, 0x8000, 0xffffffff
+  .word 0x1b0, 0x8000, 0x8000, 0xffffffff
+  .word 0x190, 0x8000, 0xff00ff00, 0xff80ff
+  .word 0x1a0, 0x8000, 0xff00ff00, 0xff80ff
+  .word 0x1b0, 0x8000, 0xff00ff00, 0xffffffff
+  .word 0x190, 0x8000, 0xe69, 0xfffff196
+  .word 0x1a0, 0x8000, 0xe69, 0xfffff196
+  .word 0x1b0, 0x8000, 0xe69, 0xffffffff
+  .word 0x190, 0x10000, 0x0, 0xffffffff
+  .word 0x1a0, 0x10000, 0x0, 0xffffffff
+  .word 0x1b0, 0x10000, 0x0, 0xffffffff
+  .word 0x190, 0x10000, 0x10000, 0xffffffff
+  .word 0x1a0, 0x10000, 0x10000, 0xffffffff
+  .word 0x1b0, 0x10000, 0x10000, 0xffffffff
+  .word 0x190, 0x10000, 0x10080, 0xffffff7f
+  .word 0x1a0, 0x10000, 0x10080, 0xffffff7f
+  .word 0x1b0, 0x10000, 0x10080, 0xffffffff
+  .word 0x190, 0x10000, 0x73698785, 0x8c97787a
+  .word 0x1a0, 0x10000, 0x73698785, 0x8c97787a
+  .word 0x1b0, 0x10000, 0x73698785, 0xffffffff
+  .word 0x190, 0x80000000, 0x2, 0xfffffffd
+  .word 0x1a0, 0x80000000, 0x2, 0xfffffffd
+  .word 0x1b0, 0x80000000, 0x2, 0xffffffff
+  .word 0x190, 0x80000000, 0x80000000, 0xffffffff
+  .word 0x1a0, 0x80000000, 0x80000000, 0xffffffff
+  .word 0x1b0, 0x80000000, 0x80000000, 0xffffffff
+  .word 0x190, 0x80000000, 0x723b417, 0xf8dc4be8
+  .word 0x1a0, 0x80000000, 0x723b417, 0xf8dc4be8
+  .word 0x1b0, 0x80000000, 0x723b417, 0xffffffff
+  .word 0x190, 0x80000000, 0x1, 0xfffffffe
+  .word 0x1a0, 0x80000000, 0x1, 0xfffffffe
+  .word 0x1b0, 0x80000000, 0x1, 0xffffffff
+  .word 0x190, 0xfffffffe, 0x80, 0xffffffff
+  .word 0x1a0, 0xfffffffe, 0x80, 0xffffffff
+  .word 0x1b0, 0xfffffffe, 0x80, 0xffffffff
+  .word 0x190, 0xfffffffe, 0xfffffffe, 0xffffffff
+  .word 0x1a0, 0xfffffffe, 0xfffffffe, 0xffffffff
+  .word 0x1b0, 0xfffffffe, 0xfffffffe, 0xffffffff
+  .word 0x190, 0xfffffffe, 0x6c, 0xffffffff
+  .word 0x1a0, 0xfffffffe, 0x6c, 0xffffffff
+  .word 0x1b0, 0xfffffffe, 0x6c, 0xffffffff
+  .word 0x190, 0xfffffffe, 0x10, 0xffffffff
+  .word 0x1a0, 0xfffffffe, 0x10, 0xffffffff
+  .word 0x1b0, 0xfffffffe, 0x10, 0xffffffff
+  .word 0x190, 0x1000000, 0x100, 0xfffffeff
+  .word 0x1a0, 0x1000000, 0x100, 0xfffffeff
+  .word 0x1b0, 0x1000000, 0x100, 0xffffffff
+  .word 0x190, 0x1000000, 0x1000000, 0xffffffff
+  .word 0x1a0, 0x1000000, 0x1000000, 0xffffffff
+  .word 0x1b0, 0x1000000, 0x1000000, 0xffffffff
+  .word 0x190, 0x1000000, 0x215b8, 0xfffdea47
+  .word 0x1a0, 0x1000000, 0x215b8, 0xfffdea47
+  .word 0x1b0, 0x1000000, 0x215b8, 0xffffffff
+  .word 0x190, 0x1000000, 0xd28fd14, 0xf3d702eb
+  .word 0x1a0, 0x1000000, 0xd28fd14, 0xf3d702eb
+  .word 0x1b0, 0x1000000, 0xd28fd14, 0xffffffff
+  .word 0x190, 0xff00ff00, 0x8000, 0xffffffff
+  .word 0x1a0, 0xff00ff00, 0x8000, 0xffffffff
+  .word 0x1b0, 0xff00ff00, 0x8000, 0xffffffff
+  .word 0x190, 0xff00ff00, 0xff00ff00, 0xffffffff
+  .word 0x1a0, 0xff00ff00, 0xff00ff00, 0xffffffff
+  .word 0x1b0, 0xff00ff00, 0xff00ff00, 0xffffffff
+  .word 0x190, 0xff00ff00, 0xe69, 0xffffff96
+  .word 0x1a0, 0xff00ff00, 0xe69, 0xffffff96
+  .word 0x1b0, 0xff00ff00, 0xe69, 0xffffffff
+  .word 0x190, 0x10080, 0x0, 0xffffffff
+  .word 0x1a0, 0x10080, 0x0, 0xffffffff
+  .word 0x1b0, 0x10080, 0x0, 0xffffffff
+  .word 0x190, 0x10080, 0x10000, 0xffffffff
+  .word 0x1a0, 0x10080, 0x10000, 0xffffffff
+  .word 0x1b0, 0x10080, 0x10000, 0xffffffff
+  .word 0x190, 0x10080, 0x10080, 0xffffffff
+  .word 0x1a0, 0x10080, 0x10080, 0xffffffff
+  .word 0x1b0, 0x10080, 0x10080, 0xffffffff
+  .word 0x190, 0x10080, 0x73698785, 0x8c9778fa
+  .word 0x1a0, 0x10080, 0x73698785, 0x8c9778fa
+  .word 0x1b0, 0x10080, 0x73698785, 0xffffffff
+  .word 0x190, 0x723b417, 0x2, 0xffffffff
+  .word 0x1a0, 0x723b417, 0x2, 0xffffffff
+  .word 0x1b0, 0x723b417, 0x2, 0xffffffff
+  .word 0x190, 0x723b417, 0x80000000, 0x7fffffff
+  .word 0x1a0, 0x723b417, 0x80000000, 0x7fffffff
+  .word 0x1b0, 0x723b417, 0x80000000, 0xffffffff
+  .word 0x190, 0x723b417, 0x723b417, 0xffffffff
+  .word 0x1a0, 0x723b417, 0x723b417, 0xffffffff
+  .word 0x1b0, 0x723b417, 0x723b417, 0xffffffff
+  .word 0x190, 0x723b417, 0x1, 0xffffffff
+  .word 0x1a0, 0x723b417, 0x1, 0xffffffff
+  .word 0x1b0, 0x723b417, 0x1, 0xffffffff
+  .word 0x190, 0x6c, 0x80, 0xffffff7f
+  .word 0x1a0, 0x6c, 0x80, 0xffffff7f
+  .word 0x1b0, 0x6c, 0x80, 0xffffffff
+  .word 0x190, 0x6c, 0xfffffffe, 0x6d
+  .word 0x1a0, 0x6c, 0xfffffffe, 0x6d
+  .word 0x1b0, 0x6c, 0xfffffffe, 0xffffffff
+  .word 0x190, 0x6c, 0x6c, 0xffffffff
+  .word 0x1a0, 0x6c, 0x6c, 0xffffffff
+  .word 0x1b0, 0x6c, 0x6c, 0xffffffff
+  .word 0x190, 0x6c, 0x10, 0xffffffef
+  .word 0x1a0, 0x6c, 0x10, 0xffffffef
+  .word 0x1b0, 0x6c, 0x10, 0xffffffff
+  .word 0x190, 0x215b8, 0x100, 0xffffffff
+  .word 0x1a0, 0x215b8, 0x100, 0xffffffff
+  .word 0x1b0, 0x215b8, 0x100, 0xffffffff
+  .word 0x190, 0x215b8, 0x1000000, 0xfeffffff
+  .word 0x1a0, 0x215b8, 0x1000000, 0xfeffffff
+  .word 0x1b0, 0x215b8, 0x1000000, 0xffffffff
+  .word 0x190, 0x215b8, 0x215b8, 0xffffffff
+  .word 0x1a0, 0x215b8, 0x215b8, 0xffffffff
+  .word 0x1b0, 0x215b8, 0x215b8, 0xffffffff
+  .word 0x190, 0x215b8, 0xd28fd14, 0xf2d717fb
+  .word 0x1a0, 0x215b8, 0xd28fd14, 0xf2d717fb
+  .word 0x1b0, 0x215b8, 0xd28fd14, 0xffffffff
+  .word 0x190, 0xe69, 0x8000, 0xffff7fff
+  .word 0x1a0, 0xe69, 0x8000, 0xffff7fff
+  .word 0x1b0, 0xe69, 0x8000, 0xffffffff
+  .word 0x190, 0xe69, 0xff00ff00, 0xff0eff
+  .word 0x1a0, 0xe69, 0xff00ff00, 0xff0eff
+  .word 0x1b0, 0xe69, 0xff00ff00, 0xffffffff
+  .word 0x190, 0xe69, 0xe69, 0xffffffff
+  .word 0x1a0, 0xe69, 0xe69, 0xffffffff
+  .word 0x1b0, 0xe69, 0xe69, 0xffffffff
+  .word 0x190, 0x73698785, 0x0, 0xffffffff
+  .word 0x1a0, 0x73698785, 0x0, 0xffffffff
+  .word 0x1b0, 0x73698785, 0x0, 0xffffffff
+  .word 0x190, 0x73698785, 0x10000, 0xffffffff
+  .word 0x1a0, 0x73698785, 0x10000, 0xffffffff
+  .word 0x1b0, 0x73698785, 0x10000, 0xffffffff
+  .word 0x190, 0x73698785, 0x10080, 0xffffffff
+  .word 0x1a0, 0x73698785, 0x10080, 0xffffffff
+  .word 0x1b0, 0x73698785, 0x10080, 0xffffffff
+  .word 0x190, 0x73698785, 0x73698785, 0xffffffff
+  .word 0x1a0, 0x73698785, 0x73698785, 0xffffffff
+  .word 0x1b0, 0x73698785, 0x73698785, 0xffffffff
+  .word 0x190, 0x1, 0x2, 0xfffffffd
+  .word 0x1a0, 0x1, 0x2, 0xfffffffd
+  .word 0x1b0, 0x1, 0x2, 0xffffffff
+  .word 0x190, 0x1, 0x80000000, 0x7fffffff
+  .word 0x1a0, 0x1, 0x80000000, 0x7fffffff
+  .word 0x1b0, 0x1, 0x80000000, 0xffffffff
+  .word 0x190, 0x1, 0x723b417, 0xf8dc4be9
+  .word 0x1a0, 0x1, 0x723b417, 0xf8dc4be9
+  .word 0x1b0, 0x1, 0x723b417, 0xffffffff
+  .word 0x190, 0x1, 0x1, 0xffffffff
+  .word 0x1a0, 0x1, 0x1, 0xffffffff
+  .word 0x1b0, 0x1, 0x1, 0xffffffff
+  .word 0x190, 0x10, 0x80, 0xffffff7f
+  .word 0x1a0, 0x10, 0x80, 0xffffff7f
+  .word 0x1b0, 0x10, 0x80, 0xffffffff
+  .word 0x190, 0x10, 0xfffffffe, 0x11
+  .word 0x1a0, 0x10, 0xfffffffe, 0x11
+  .word 0x1b0, 0x10, 0xfffffffe, 0xffffffff
+  .word 0x190, 0x10, 0x6c, 0xffffff93
+  .word 0x1a0, 0x10, 0x6c, 0xffffff93
+  .word 0x1b0, 0x10, 0x6c, 0xffffffff
+  .word 0x190, 0x10, 0x10, 0xffffffff
+  .word 0x1a0, 0x10, 0x10, 0xffffffff
+  .word 0x1b0, 0x10, 0x10, 0xffffffff
+  .word 0x190, 0xd28fd14, 0x100, 0xffffffff
+  .word 0x1a0, 0xd28fd14, 0x100, 0xffffffff
+  .word 0x1b0, 0xd28fd14, 0x100, 0xffffffff
+  .word 0x190, 0xd28fd14, 0x1000000, 0xffffffff
+  .word 0x1a0, 0xd28fd14, 0x1000000, 0xffffffff
+  .word 0x1b0, 0xd28fd14, 0x1000000, 0xffffffff
+  .word 0x190, 0xd28fd14, 0x215b8, 0xfffdff57
+  .word 0x1a0, 0xd28fd14, 0x215b8, 0xfffdff57
+  .word 0x1b0, 0xd28fd14, 0x215b8, 0xffffffff
+  .word 0x190, 0xd28fd14, 0xd28fd14, 0xffffffff
+  .word 0x1a0, 0xd28fd14, 0xd28fd14, 0xffffffff
+  .word 0x1b0, 0xd28fd14, 0xd28fd14, 0xffffffff
+  .word 0x1c0, 0x0, 0x12345687, 0xedcba978
+  .word 0x1d0, 0x87654321, 0x0, 0xffffffff
+  .word 0x1e0, 0x0, 0x0, 0xffffffff
+  .word 0x1e0, 0x0, 0x2, 0xfffffffd
+  .word 0x1e0, 0x0, 0x80, 0xffffff7f
+  .word 0x1e0, 0x0, 0x100, 0xfffffeff
+  .word 0x1e0, 0x0, 0x8000, 0xffff7fff
+  .word 0x1e0, 0x0, 0x10000, 0xfffeffff
+  .word 0x1e0, 0x0, 0x80000000, 0x7fffffff
+  .word 0x1e0, 0x0, 0xfffffffe, 0x1
+  .word 0x1e0, 0x0, 0x1000000, 0xfeffffff
+  .word 0x1e0, 0x0, 0xff00ff00, 0xff00ff
+  .word 0x1e0, 0x0, 0x10080, 0xfffeff7f
+  .word 0x1e0, 0x0, 0x723b417, 0xf8dc4be8
+  .word 0x1e0, 0x0, 0x6c, 0xffffff93
+  .word 0x1e0, 0x0, 0x215b8, 0xfffdea47
+  .word 0x1e0, 0x0, 0xe69, 0xfffff196
+  .word 0x1e0, 0x0, 0x73698785, 0x8c96787a
+  .word 0x1e0, 0x0, 0x1, 0xfffffffe
+  .word 0x1e0, 0x0, 0x10, 0xffffffef
+  .word 0x1e0, 0x0, 0xd28fd14, 0xf2d702eb
+  .word 0x1e0, 0x2, 0x0, 0xfffffffd
+  .word 0x1e0, 0x2, 0x2, 0xffffffff
+  .word 0x1e0, 0x2, 0x80, 0xffffff7d
+  .word 0x1e0, 0x2, 0x100, 0xfffffefd
+  .word 0x1e0, 0x2, 0x8000, 0xffff7ffd
+  .word 0x1e0, 0x2, 0x10000, 0xfffefffd
+  .word 0x1e0, 0x2, 0x80000000, 0x7ffffffd
+  .word 0x1e0, 0x2, 0xfffffffe, 0x3
+  .word 0x1e0, 0x2, 0x1000000, 0xfefffffd
+  .word 0x1e0, 0x2, 0xff00ff00, 0xff00fd
+  .word 0x1e0, 0x2, 0x10080, 0xfffeff7d
+  .word 0x1e0, 0x2, 0x723b417, 0xf8dc4bea
+  .word 0x1e0, 0x2, 0x6c, 0xffffff91
+  .word 0x1e0, 0x2, 0x215b8, 0xfffdea45
+  .word 0x1e0, 0x2, 0xe69, 0xfffff194
+  .word 0x1e0, 0x2, 0x73698785, 0x8c967878
+  .word 0x1e0, 0x2, 0x1, 0xfffffffc
+  .word 0x1e0, 0x2, 0x10, 0xffffffed
+  .word 0x1e0, 0x2, 0xd28fd14, 0xf2d702e9
+  .word 0x1e0, 0x80, 0x0, 0xffffff7f
+  .word 0x1e0, 0x80, 0x2, 0xffffff7d
+  .word 0x1e0, 0x80, 0x80, 0xffffffff
+  .word 0x1e0, 0x80, 0x100, 0xfffffe7f
+  .word 0x1e0, 0x80, 0x8000, 0xffff7f7f
+  .word 0x1e0, 0x80, 0x10000, 0xfffeff7f
+  .word 0x1e0, 0x80, 0x80000000, 0x7fffff7f
+  .word 0x1e0, 0x80, 0xfffffffe, 0x81
+  .word 0x1e0, 0x80, 0x1000000, 0xfeffff7f
+  .word 0x1e0, 0x80, 0xff00ff00, 0xff007f
+  .word 0x1e0, 0x80, 0x10080, 0xfffeffff
+  .word 0x1e0, 0x80, 0x723b417, 0xf8dc4b68
+  .word 0x1e0, 0x80, 0x6c, 0xffffff13
+  .word 0x1e0, 0x80, 0x215b8, 0xfffdeac7
+  .word 0x1e0, 0x80, 0xe69, 0xfffff116
+  .word 0x1e0, 0x80, 0x73698785, 0x8c9678fa
+  .word 0x1e0, 0x80, 0x1, 0xffffff7e
+  .word 0x1e0, 0x80, 0x10, 0xffffff6f
+  .word 0x1e0, 0x80, 0xd28fd14, 0xf2d7026b
+  .word 0x1e0, 0x100, 0x0, 0xfffffeff
+  .word 0x1e0, 0x100, 0x2, 0xfffffefd
+  .word 0x1e0, 0x100, 0x80, 0xfffffe7f
+  .word 0x1e0, 0x100, 0x100, 0xffffffff
+  .word 0x1e0, 0x100, 0x8000, 0xffff7eff
+  .word 0x1e0, 0x100, 0x10000, 0xfffefeff
+  .word 0x1e0, 0x100, 0x80000000, 0x7ffffeff
+  .word 0x1e0, 0x100, 0xfffffffe, 0x101
+  .word 0x1e0, 0x100, 0x1000000, 0xfefffeff
+  .word 0x1e0, 0x100, 0xff00ff00, 0xff01ff
+  .word 0x1e0, 0x100, 0x10080, 0xfffefe7f
+  .word 0x1e0, 0x100, 0x723b417, 0xf8dc4ae8
+  .word 0x1e0, 0x100, 0x6c, 0xfffffe93
+  .word 0x1e0, 0x100, 0x215b8, 0xfffdeb47
+  .word 0x1e0, 0x100, 0xe69, 0xfffff096
+  .word 0x1e0, 0x100, 0x73698785, 0x8c96797a
+  .word 0x1e0, 0x100, 0x1, 0xfffffefe
+  .word 0x1e0, 0x100, 0x10, 0xfffffeef
+  .word 0x1e0, 0x100, 0xd28fd14, 0xf2d703eb
+  .word 0x1e0, 0x8000, 0x0, 0xffff7fff
+  .word 0x1e0, 0x8000, 0x2, 0xffff7ffd
+  .word 0x1e0, 0x8000, 0x80, 0xffff7f7f
+  .word 0x1e0, 0x8000, 0x100, 0xffff7eff
+  .word 0x1e0, 0x8000, 0x8000, 0xffffffff
+  .word 0x1e0, 0x8000, 0x10000, 0xfffe7fff
+  .word 0x1e0, 0x8000, 0x80000000, 0x7fff7fff
+  .word 0x1e0, 0x8000, 0xfffffffe, 0x8001
+  .word 0x1e0, 0x8000, 0x1000000, 0xfeff7fff
+  .word 0x1e0, 0x8000, 0xff00ff00, 0xff80ff
+  .word 0x1e0, 0x8000, 0x10080, 0xfffe7f7f
+  .word 0x1e0, 0x8000, 0x723b417, 0xf8dccbe8
+  .word 0x1e0, 0x8000, 0x6c, 0xffff7f93
+  .word 0x1e0, 0x8000, 0x215b8, 0xfffd6a47
+  .word 0x1e0, 0x8000, 0xe69, 0xffff7196
+  .word 0x1e0, 0x8000, 0x73698785, 0x8c96f87a
+  .word 0x1e0, 0x8000, 0x1, 0xffff7ffe
+  .word 0x1e0, 0x8000, 0x10, 0xffff7fef
+  .word 0x1e0, 0x8000, 0xd28fd14, 0xf2d782eb
+  .word 0x1e0, 0x10000, 0x0, 0xfffeffff
+  .word 0x1e0, 0x10000, 0x2, 0xfffefffd
+  .word 0x1e0, 0x10000, 0x80, 0xfffeff7f
+  .word 0x1e0, 0x10000, 0x100, 0xfffefeff
+  .word 0x1e0, 0x10000, 0x8000, 0xfffe7fff
+  .word 0x1e0, 0x10000, 0x10000, 0xffffffff
+  .word 0x1e0, 0x10000, 0x80000000, 0x7ffeffff
+  .word 0x1e0, 0x10000, 0xfffffffe, 0x10001
+  .word 0x1e0, 0x10000, 0x1000000, 0xfefeffff
+  .word 0x1e0, 0x10000, 0xff00ff00, 0xfe00ff
+  .word 0x1e0, 0x10000, 0x10080, 0xffffff7f
+  .word 0x1e0, 0x10000, 0x723b417, 0xf8dd4be8
+  .word 0x1e0, 0x10000, 0x6c, 0xfffeff93
+  .word 0x1e0, 0x10000, 0x215b8, 0xfffcea47
+  .word 0x1e0, 0x10000, 0xe69, 0xfffef196
+  .word 0x1e0, 0x10000, 0x73698785, 0x8c97787a
+  .word 0x1e0, 0x10000, 0x1, 0xfffefffe
+  .word 0x1e0, 0x10000, 0x10, 0xfffeffef
+  .word 0x1e0, 0x10000, 0xd28fd14, 0xf2d602eb
+  .word 0x1e0, 0x80000000, 0x0, 0x7fffffff
+  .word 0x1e0, 0x80000000, 0x2, 0x7ffffffd
+  .word 0x1e0, 0x80000000, 0x80, 0x7fffff7f
+  .word 0x1e0, 0x80000000, 0x100, 0x7ffffeff
+  .word 0x1e0, 0x80000000, 0x8000, 0x7fff7fff
+  .word 0x1e0, 0x80000000, 0x10000, 0x7ffeffff
+  .word 0x1e0, 0x80000000, 0x80000000, 0xffffffff
+  .word 0x1e0, 0x80000000, 0xfffffffe, 0x80000001
+  .word 0x1e0, 0x80000000, 0x1000000, 0x7effffff
+  .word 0x1e0, 0x80000000, 0xff00ff00, 0x80ff00ff
+  .word 0x1e0, 0x80000000, 0x10080, 0x7ffeff7f
+  .word 0x1e0, 0x80000000, 0x723b417, 0x78dc4be8
+  .word 0x1e0, 0x80000000, 0x6c, 0x7fffff93
+  .word 0x1e0, 0x80000000, 0x215b8, 0x7ffdea47
+  .word 0x1e0, 0x80000000, 0xe69, 0x7ffff196
+  .word 0x1e0, 0x80000000, 0x73698785, 0xc96787a
+  .word 0x1e0, 0x80000000, 0x1, 0x7ffffffe
+  .word 0x1e0, 0x80000000, 0x10, 0x7fffffef
+  .word 0x1e0, 0x80000000, 0xd28fd14, 0x72d702eb
+  .word 0x1e0, 0xfffffffe, 0x0, 0x1
+  .word 0x1e0, 0xfffffffe, 0x2, 0x3
+  .word 0x1e0, 0xfffffffe, 0x80, 0x81
+  .word 0x1e0, 0xfffffffe, 0x100, 0x101
+  .word 0x1e0, 0xfffffffe, 0x8000, 0x8001
+  .word 0x1e0, 0xfffffffe, 0x10000, 0x10001
+  .word 0x1e0, 0xfffffffe, 0x80000000, 0x80000001
+  .word 0x1e0, 0xfffffffe, 0xfffffffe, 0xffffffff
+  .word 0x1e0, 0xfffffffe, 0x1000000, 0x1000001
+  .word 0x1e0, 0xfffffffe, 0xff00ff00, 0xff00ff01
+  .word 0x1e0, 0xfffffffe, 0x10080, 0x10081
+  .word 0x1e0, 0xfffffffe, 0x723b417, 0x723b416
+  .word 0x1e0, 0xfffffffe, 0x6c, 0x6d
+  .word 0x1e0, 0xfffffffe, 0x215b8, 0x215b9
+  .word 0x1e0, 0xfffffffe, 0xe69, 0xe68
+  .word 0x1e0, 0xfffffffe, 0x73698785, 0x73698784
+  .word 0x1e0, 0xfffffffe, 0x1, 0x0
+  .word 0x1e0, 0xfffffffe, 0x10, 0x11
+  .word 0x1e0, 0xfffffffe, 0xd28fd14, 0xd28fd15
+  .word 0x1e0, 0x1000000, 0x0, 0xfeffffff
+  .word 0x1e0, 0x1000000, 0x2, 0xfefffffd
+  .word 0x1e0, 0x1000000, 0x80, 0xfeffff7f
+  .word 0x1e0, 0x1000000, 0x100, 0xfefffeff
+  .word 0x1e0, 0x1000000, 0x8000, 0xfeff7fff
+  .word 0x1e0, 0x1000000, 0x10000, 0xfefeffff
+  .word 0x1e0, 0x1000000, 0x80000000, 0x7effffff
+  .word 0x1e0, 0x1000000, 0xfffffffe, 0x1000001
+  .word 0x1e0, 0x1000000, 0x1000000, 0xffffffff
+  .word 0x1e0, 0x1000000, 0xff00ff00, 0x1ff00ff
+  .word 0x1e0, 0x1000000, 0x10080, 0xfefeff7f
+  .word 0x1e0, 0x1000000, 0x723b417, 0xf9dc4be8
+  .word 0x1e0, 0x1000000, 0x6c, 0xfeffff93
+  .word 0x1e0, 0x1000000, 0x215b8, 0xfefdea47
+  .word 0x1e0, 0x1000000, 0xe69, 0xfefff196
+  .word 0x1e0, 0x1000000, 0x73698785, 0x8d96787a
+  .word 0x1e0, 0x1000000, 0x1, 0xfefffffe
+  .word 0x1e0, 0x1000000, 0x10, 0xfeffffef
+  .word 0x1e0, 0x1000000, 0xd28fd14, 0xf3d702eb
+  .word 0x1e0, 0xff00ff00, 0x0, 0xff00ff
+  .word 0x1e0, 0xff00ff00, 0x2, 0xff00fd
+  .word 0x1e0, 0xff00ff00, 0x80, 0xff007f
+  .word 0x1e0, 0xff00ff00, 0x100, 0xff01ff
+  .word 0x1e0, 0xff00ff00, 0x8000, 0xff80ff
+  .word 0x1e0, 0xff00ff00, 0x10000, 0xfe00ff
+  .word 0x1e0, 0xff00ff00, 0x80000000, 0x80ff00ff
+  .word 0x1e0, 0xff00ff00, 0xfffffffe, 0xff00ff01
+  .word 0x1e0, 0xff00ff00, 0x1000000, 0x1ff00ff
+  .word 0x1e0, 0xff00ff00, 0xff00ff00, 0xffffffff
+  .word 0x1e0, 0xff00ff00, 0x10080, 0xfe007f
+  .word 0x1e0, 0xff00ff00, 0x723b417, 0x7dcb4e8
+  .word 0x1e0, 0xff00ff00, 0x6c, 0xff0093
+  .word 0x1e0, 0xff00ff00, 0x215b8, 0xfd1547
+  .word 0x1e0, 0xff00ff00, 0xe69, 0xff0e96
+  .word 0x1e0, 0xff00ff00, 0x73698785, 0x7396877a
+  .word 0x1e0, 0xff00ff00, 0x1, 0xff00fe
+  .word 0x1e0, 0xff00ff00, 0x10, 0xff00ef
+  .word 0x1e0, 0xff00ff00, 0xd28fd14, 0xdd7fdeb
+  .word 0x1e0, 0x10080, 0x0, 0xfffeff7f
+  .word 0x1e0, 0x10080, 0x2, 0xfffeff7d
+  .word 0x1e0, 0x10080, 0x80, 0xfffeffff
+  .word 0x1e0, 0x10080, 0x100, 0xfffefe7f
+  .word 0x1e0, 0x10080, 0x8000, 0xfffe7f7f
+  .word 0x1e0, 0x10080, 0x10000, 0xffffff7f
+  .word 0x1e0, 0x10080, 0x80000000, 0x7ffeff7f
+  .word 0x1e0, 0x10080, 0xfffffffe, 0x10081
+  .word 0x1e0, 0x10080, 0x1000000, 0xfefeff7f
+  .word 0x1e0, 0x10080, 0xff00ff00, 0xfe007f
+  .word 0x1e0, 0x10080, 0x10080, 0xffffffff
+  .word 0x1e0, 0x10080, 0x723b417, 0xf8dd4b68
+  .word 0x1e0, 0x10080, 0x6c, 0xfffeff13
+  .word 0x1e0, 0x10080, 0x215b8, 0xfffceac7
+  .word 0x1e0, 0x10080, 0xe69, 0xfffef116
+  .word 0x1e0, 0x10080, 0x73698785, 0x8c9778fa
+  .word 0x1e0, 0x10080, 0x1, 0xfffeff7e
+  .word 0x1e0, 0x10080, 0x10, 0xfffeff6f
+  .word 0x1e0, 0x10080, 0xd28fd14, 0xf2d6026b
+  .word 0x1e0, 0x723b417, 0x0, 0xf8dc4be8
+  .word 0x1e0, 0x723b417, 0x2, 0xf8dc4bea
+  .word 0x1e0, 0x723b417, 0x80, 0xf8dc4b68
+  .word 0x1e0, 0x723b417, 0x100, 0xf8dc4ae8
+  .word 0x1e0, 0x723b417, 0x8000, 0xf8dccbe8
+  .word 0x1e0, 0x723b417, 0x10000, 0xf8dd4be8
+  .word 0x1e0, 0x723b417, 0x80000000, 0x78dc4be8
+  .word 0x1e0, 0x723b417, 0xfffffffe, 0x723b416
+  .word 0x1e0, 0x723b417, 0x1000000, 0xf9dc4be8
+  .word 0x1e0, 0x723b417, 0xff00ff00, 0x7dcb4e8
+  .word 0x1e0, 0x723b417, 0x10080, 0xf8dd4b68
+  .word 0x1e0, 0x723b417, 0x723b417, 0xffffffff
+  .word 0x1e0, 0x723b417, 0x6c, 0xf8dc4b84
+  .word 0x1e0, 0x723b417, 0x215b8, 0xf8de5e50
+  .word 0x1e0, 0x723b417, 0xe69, 0xf8dc4581
+  .word 0x1e0, 0x723b417, 0x73698785, 0x8bb5cc6d
+  .word 0x1e0, 0x723b417, 0x1, 0xf8dc4be9
+  .word 0x1e0, 0x723b417, 0x10, 0xf8dc4bf8
+  .word 0x1e0, 0x723b417, 0xd28fd14, 0xf5f4b6fc
+  .word 0x1e0, 0x6c, 0x0, 0xffffff93
+  .word 0x1e0, 0x6c, 0x2, 0xffffff91
+  .word 0x1e0, 0x6c, 0x80, 0xffffff13
+  .word 0x1e0, 0x6c, 0x100, 0xfffffe93
+  .word 0x1e0, 0x6c, 0x8000, 0xffff7f93
+  .word 0x1e0, 0x6c, 0x10000, 0xfffeff93
+  .word 0x1e0, 0x6c, 0x80000000, 0x7fffff93
+  .word 0x1e0, 0x6c, 0xfffffffe, 0x6d
+  .word 0x1e0, 0x6c, 0x1000000, 0xfeffff93
+  .word 0x1e0, 0x6c, 0xff00ff00, 0xff0093
+  .word 0x1e0, 0x6c, 0x10080, 0xfffeff13
+  .word 0x1e0, 0x6c, 0x723b417, 0xf8dc4b84
+  .word 0x1e0, 0x6c, 0x6c, 0xffffffff
+  .word 0x1e0, 0x6c, 0x215b8, 0xfffdea2b
+  .word 0x1e0, 0x6c, 0xe69, 0xfffff1fa
+  .word 0x1e0, 0x6c, 0x73698785, 0x8c967816
+  .word 0x1e0, 0x6c, 0x1, 0xffffff92
+  .word 0x1e0, 0x6c, 0x10, 0xffffff83
+  .word 0x1e0, 0x6c, 0xd28fd14, 0xf2d70287
+  .word 0x1e0, 0x215b8, 0x0, 0xfffdea47
+  .word 0x1e0, 0x215b8, 0x2, 0xfffdea45
+  .word 0x1e0, 0x215b8, 0x80, 0xfffdeac7
+  .word 0x1e0, 0x215b8, 0x100, 0xfffdeb47
+  .word 0x1e0, 0x215b8, 0x8000, 0xfffd6a47
+  .word 0x1e0, 0x215b8, 0x10000, 0xfffcea47
+  .word 0x1e0, 0x215b8, 0x80000000, 0x7ffdea47
+  .word 0x1e0, 0x215b8, 0xfffffffe, 0x215b9
+  .word 0x1e0, 0x215b8, 0x1000000, 0xfefdea47
+  .word 0x1e0, 0x215b8, 0xff00ff00, 0xfd1547
+  .word 0x1e0, 0x215b8, 0x10080, 0xfffceac7
+  .word 0x1e0, 0x215b8, 0x723b417, 0xf8de5e50
+  .word 0x1e0, 0x215b8, 0x6c, 0xfffdea2b
+  .word 0x1e0, 0x215b8, 0x215b8, 0xffffffff
+  .word 0x1e0, 0x215b8, 0xe69, 0xfffde42e
+  .word 0x1e0, 0x215b8, 0x73698785, 0x8c946dc2
+  .word 0x1e0, 0x215b8, 0x1, 0xfffdea46
+  .word 0x1e0, 0x215b8, 0x10, 0xfffdea57
+  .word 0x1e0, 0x215b8, 0xd28fd14, 0xf2d51753
+  .word 0x1e0, 0xe69, 0x0, 0xfffff196
+  .word 0x1e0, 0xe69, 0x2, 0xfffff194
+  .word 0x1e0, 0xe69, 0x80, 0xfffff116
+  .word 0x1e0, 0xe69, 0x100, 0xfffff096
+  .word 0x1e0, 0xe69, 0x8000, 0xffff7196
+  .word 0x1e0, 0xe69, 0x10000, 0xfffef196
+  .word 0x1e0, 0xe69, 0x80000000, 0x7ffff196
+  .word 0x1e0, 0xe69, 0xfffffffe, 0xe68
+  .word 0x1e0, 0xe69, 0x1000000, 0xfefff196
+  .word 0x1e0, 0xe69, 0xff00ff00, 0xff0e96
+  .word 0x1e0, 0xe69, 0x10080, 0xfffef116
+  .word 0x1e0, 0xe69, 0x723b417, 0xf8dc4581
+  .word 0x1e0, 0xe69, 0x6c, 0xfffff1fa
+  .word 0x1e0, 0xe69, 0x215b8, 0xfffde42e
+  .word 0x1e0, 0xe69, 0xe69, 0xffffffff
+  .word 0x1e0, 0xe69, 0x73698785, 0x8c967613
+  .word 0x1e0, 0xe69, 0x1, 0xfffff197
+  .word 0x1e0, 0xe69, 0x10, 0xfffff186
+  .word 0x1e0, 0xe69, 0xd28fd14, 0xf2d70c82
+  .word 0x1e0, 0x73698785, 0x0, 0x8c96787a
+  .word 0x1e0, 0x73698785, 0x2, 0x8c967878
+  .word 0x1e0, 0x73698785, 0x80, 0x8c9678fa
+  .word 0x1e0, 0x73698785, 0x100, 0x8c96797a
+  .word 0x1e0, 0x73698785, 0x8000, 0x8c96f87a
+  .word 0x1e0, 0x73698785, 0x10000, 0x8c97787a
+  .word 0x1e0, 0x73698785, 0x80000000, 0xc96787a
+  .word 0x1e0, 0x73698785, 0xfffffffe, 0x73698784
+  .word 0x1e0, 0x73698785, 0x1000000, 0x8d96787a
+  .word 0x1e0, 0x73698785, 0xff00ff00, 0x7396877a
+  .word 0x1e0, 0x73698785, 0x10080, 0x8c9778fa
+  .word 0x1e0, 0x73698785, 0x723b417, 0x8bb5cc6d
+  .word 0x1e0, 0x73698785, 0x6c, 0x8c967816
+  .word 0x1e0, 0x73698785, 0x215b8, 0x8c946dc2
+  .word 0x1e0, 0x73698785, 0xe69, 0x8c967613
+  .word 0x1e0, 0x73698785, 0x73698785, 0xffffffff
+  .word 0x1e0, 0x73698785, 0x1, 0x8c96787b
+  .word 0x1e0, 0x73698785, 0x10, 0x8c96786a
+  .word 0x1e0, 0x73698785, 0xd28fd14, 0x81be856e
+  .word 0x1e0, 0x1, 0x0, 0xfffffffe
+  .word 0x1e0, 0x1, 0x2, 0xfffffffc
+  .word 0x1e0, 0x1, 0x80, 0xffffff7e
+  .word 0x1e0, 0x1, 0x100, 0xfffffefe
+  .word 0x1e0, 0x1, 0x8000, 0xffff7ffe
+  .word 0x1e0, 0x1, 0x10000, 0xfffefffe
+  .word 0x1e0, 0x1, 0x80000000, 0x7ffffffe
+  .word 0x1e0, 0x1, 0xfffffffe, 0x0
+  .word 0x1e0, 0x1, 0x1000000, 0xfefffffe
+  .word 0x1e0, 0x1, 0xff00ff00, 0xff00fe
+  .word 0x1e0, 0x1, 0x10080, 0xfffeff7e
+  .word 0x1e0, 0x1, 0x723b417, 0xf8dc4be9
+  .word 0x1e0, 0x1, 0x6c, 0xffffff92
+  .word 0x1e0, 0x1, 0x215b8, 0xfffdea46
+  .word 0x1e0, 0x1, 0xe69, 0xfffff197
+  .word 0x1e0, 0x1, 0x73698785, 0x8c96787b
+  .word 0x1e0, 0x1, 0x1, 0xffffffff
+  .word 0x1e0, 0x1, 0x10, 0xffffffee
+  .word 0x1e0, 0x1, 0xd28fd14, 0xf2d702ea
+  .word 0x1e0, 0x10, 0x0, 0xffffffef
+  .word 0x1e0, 0x10, 0x2, 0xffffffed
+  .word 0x1e0, 0x10, 0x80, 0xffffff6f
+  .word 0x1e0, 0x10, 0x100, 0xfffffeef
+  .word 0x1e0, 0x10, 0x8000, 0xffff7fef
+  .word 0x1e0, 0x10, 0x10000, 0xfffeffef
+  .word 0x1e0, 0x10, 0x80000000, 0x7fffffef
+  .word 0x1e0, 0x10, 0xfffffffe, 0x11
+  .word 0x1e0, 0x10, 0x1000000, 0xfeffffef
+  .word 0x1e0, 0x10, 0xff00ff00, 0xff00ef
+  .word 0x1e0, 0x10, 0x10080, 0xfffeff6f
+  .word 0x1e0, 0x10, 0x723b417, 0xf8dc4bf8
+  .word 0x1e0, 0x10, 0x6c, 0xffffff83
+  .word 0x1e0, 0x10, 0x215b8, 0xfffdea57
+  .word 0x1e0, 0x10, 0xe69, 0xfffff186
+  .word 0x1e0, 0x10, 0x73698785, 0x8c96786a
+  .word 0x1e0, 0x10, 0x1, 0xffffffee
+  .word 0x1e0, 0x10, 0x10, 0xffffffff
+  .word 0x1e0, 0x10, 0xd28fd14, 0xf2d702fb
+  .word 0x1e0, 0xd28fd14, 0x0, 0xf2d702eb
+  .word 0x1e0, 0xd28fd14, 0x2, 0xf2d702e9
+  .word 0x1e0, 0xd28fd14, 0x80, 0xf2d7026b
+  .word 0x1e0, 0xd28fd14, 0x100, 0xf2d703eb
+  .word 0x1e0, 0xd28fd14, 0x8000, 0xf2d782eb
+  .word 0x1e0, 0xd28fd14, 0x10000, 0xf2d602eb
+  .word 0x1e0, 0xd28fd14, 0x80000000, 0x72d702eb
+  .word 0x1e0, 0xd28fd14, 0xfffffffe, 0xd28fd15
+  .word 0x1e0, 0xd28fd14, 0x1000000, 0xf3d702eb
+  .word 0x1e0, 0xd28fd14, 0xff00ff00, 0xdd7fdeb
+  .word 0x1e0, 0xd28fd14, 0x10080, 0xf2d6026b
+  .word 0x1e0, 0xd28fd14, 0x723b417, 0xf5f4b6fc
+  .word 0x1e0, 0xd28fd14, 0x6c, 0xf2d70287
+  .word 0x1e0, 0xd28fd14, 0x215b8, 0xf2d51753
+  .word 0x1e0, 0xd28fd14, 0xe69, 0xf2d70c82
+  .word 0x1e0, 0xd28fd14, 0x73698785, 0x81be856e
+  .word 0x1e0, 0xd28fd14, 0x1, 0xf2d702ea
+  .word 0x1e0, 0xd28fd14, 0x10, 0xf2d702fb
+  .word 0x1e0, 0xd28fd14, 0xd28fd14, 0xffffffff
+  .word 0x1f0, 0x0, 0x0, 0xffffffff
+  .word 0x200, 0x0, 0x0, 0xffffffff
+  .word 0x210, 0x0, 0x0, 0xffffffff
+  .word 0x1f0, 0x0, 0x10000, 0xfffeffff
+  .word 0x200, 0x0, 0x10000, 0xfffeffff
+  .word 0x210, 0x0, 0x10000, 0xffffffff
+  .word 0x1f0, 0x0, 0x10080, 0xfffeff7f
+  .word 0x200, 0x0, 0x10080, 0xfffeff7f
+  .word 0x210, 0x0, 0x10080, 0xffffffff
+  .word 0x1f0, 0x0, 0x73698785, 0x8c96787a
+  .word 0x200, 0x0, 0x73698785, 0x8c96787a
+  .word 0x210, 0x0, 0x73698785, 0xffffffff
+  .word 0x1f0, 0x2, 0x2, 0xffffffff
+  .word 0x200, 0x2, 0x2, 0xffffffff
+  .word 0x210, 0x2, 0x2, 0xffffffff
+  .word 0x1f0, 0x2, 0x80000000, 0x7ffffffd
+  .word 0x200, 0x2, 0x80000000, 0x7ffffffd
+  .word 0x210, 0x2, 0x80000000, 0xffffffff
+  .word 0x1f0, 0x2, 0x723b417, 0xf8dc4bea
+  .word 0x200, 0x2, 0x723b417, 0xf8dc4bea
+  .word 0x210, 0x2, 0x723b417, 0xffffffff
+  .word 0x1f0, 0x2, 0x1, 0xfffffffc
+  .word 0x200, 0x2, 0x1, 0xfffffffc
+  .word 0x210, 0x2, 0x1, 0xffffffff
+  .word 0x1f0, 0x80, 0x80, 0xffffffff
+  .word 0x200, 0x80, 0x80, 0xffffffff
+  .word 0x210, 0x80, 0x80, 0xffffffff
+  .word 0x1f0, 0x80, 0xfffffffe, 0x81
+  .word 0x200, 0x80, 0xfffffffe, 0x81
+  .word 0x210, 0x80, 0xfffffffe, 0xffffffff
+  .word 0x1f0, 0x80, 0x6c, 0xffffff13
+  .word 0x200, 0x80, 0x6c, 0xffffff13
+  .word 0x210, 0x80, 0x6c, 0xffffffff
+  .word 0x1f0, 0x80, 0x10, 0xffffff6f
+  .word 0x200, 0x80, 0x10, 0xffffff6f
+  .word 0x210, 0x80, 0x10, 0xffffffff
+  .word 0x1f0, 0x100, 0x100, 0xffffffff
+  .word 0x200, 0x100, 0x100, 0xffffffff
+  .word 0x210, 0x100, 0x100, 0xffffffff
+  .word 0x1f0, 0x100, 0x1000000, 0xfefffeff
+  .word 0x200, 0x100, 0x1000000, 0xfefffeff
+  .word 0x210, 0x100, 0x1000000, 0xffffffff
+  .word 0x1f0, 0x100, 0x215b8, 0xfffdeb47
+  .word 0x200, 0x100, 0x215b8, 0xfffdeb47
+  .word 0x210, 0x100, 0x215b8, 0xffffffff
+  .word 0x1f0, 0x100, 0xd28fd14, 0xf2d703eb
+  .word 0x200, 0x100, 0xd28fd14, 0xf2d703eb
+  .word 0x210, 0x100, 0xd28fd14, 0xffffffff
+  .word 0x1f0, 0x8000, 0x8000, 0xffffffff
+  .word 0x200, 0x8000, 0x8000, 0xffffffff
+  .word 0x210, 0x8000, 0x8000, 0xffffffff
+  .word 0x1f0, 0x8000, 0xff00ff00, 0xff80ff
+  .word 0x200, 0x8000, 0xff00ff00, 0xff80ff
+  .word 0x210, 0x8000, 0xff00ff00, 0xffffffff
+  .word 0x1f0, 0x8000, 0xe69, 0xffff7196
+  .word 0x200, 0x8000, 0xe69, 0xffff7196
+  .word 0x210, 0x8000, 0xe69, 0xffffffff
+  .word 0x1f0, 0x10000, 0x0, 0xfffeffff
+  .word 0x200, 0x10000, 0x0, 0xfffeffff
+  .word 0x210, 0x10000, 0x0, 0xffffffff
+  .word 0x1f0, 0x10000, 0x10000, 0xffffffff
+  .word 0x200, 0x10000, 0x10000, 0xffffffff
+  .word 0x210, 0x10000, 0x10000, 0xffffffff
+  .word 0x1f0, 0x10000, 0x10080, 0xffffff7f
+  .word 0x200, 0x10000, 0x10080, 0xffffff7f
+  .word 0x210, 0x10000, 0x10080, 0xffffffff
+  .word 0x1f0, 0x10000, 0x73698785, 0x8c97787a
+  .word 0x200, 0x10000, 0x73698785, 0x8c97787a
+  .word 0x210, 0x10000, 0x73698785, 0xffffffff
+  .word 0x1f0, 0x80000000, 0x2, 0x7ffffffd
+  .word 0x200, 0x80000000, 0x2, 0x7ffffffd
+  .word 0x210, 0x80000000, 0x2, 0xffffffff
+  .word 0x1f0, 0x80000000, 0x80000000, 0xffffffff
+  .word 0x200, 0x80000000, 0x80000000, 0xffffffff
+  .word 0x210, 0x80000000, 0x80000000, 0xffffffff
+  .word 0x1f0, 0x80000000, 0x723b417, 0x78dc4be8
+  .word 0x200, 0x80000000, 0x723b417, 0x78dc4be8
+  .word 0x210, 0x80000000, 0x723b417, 0xffffffff
+  .word 0x1f0, 0x80000000, 0x1, 0x7ffffffe
+  .word 0x200, 0x80000000, 0x1, 0x7ffffffe
+  .word 0x210, 0x80000000, 0x1, 0xffffffff
+  .word 0x1f0, 0xfffffffe, 0x80, 0x81
+  .word 0x200, 0xfffffffe, 0x80, 0x81
+  .word 0x210, 0xfffffffe, 0x80, 0xffffffff
+  .word 0x1f0, 0xfffffffe, 0xfffffffe, 0xffffffff
+  .word 0x200, 0xfffffffe, 0xfffffffe, 0xffffffff
+  .word 0x210, 0xfffffffe, 0xfffffffe, 0xffffffff
+  .word 0x1f0, 0xfffffffe, 0x6c, 0x6d
+  .word 0x200, 0xfffffffe, 0x6c, 0x6d
+  .word 0x210, 0xfffffffe, 0x6c, 0xffffffff
+  .word 0x1f0, 0xfffffffe, 0x10, 0x11
+  .word 0x200, 0xfffffffe, 0x10, 0x11
+  .word 0x210, 0xfffffffe, 0x10, 0xffffffff
+  .word 0x1f0, 0x1000000, 0x100, 0xfefffeff
+  .word 0x200, 0x1000000, 0x100, 0xfefffeff
+  .word 0x210, 0x1000000, 0x100, 0xffffffff
+  .word 0x1f0, 0x1000000, 0x1000000, 0xffffffff
+  .word 0x200, 0x1000000, 0x1000000, 0xffffffff
+  .word 0x210, 0x1000000, 0x1000000, 0xffffffff
+  .word 0x1f0, 0x1000000, 0x215b8, 0xfefdea47
+  .word 0x200, 0x1000000, 0x215b8, 0xfefdea47
+  .word 0x210, 0x1000000, 0x215b8, 0xffffffff
+  .word 0x1f0, 0x1000000, 0xd28fd14, 0xf3d702eb
+  .word 0x200, 0x1000000, 0xd28fd14, 0xf3d702eb
+  .word 0x210, 0x1000000, 0xd28fd14, 0xffffffff
+  .word 0x1f0, 0xff00ff00, 0x8000, 0xff80ff
+  .word 0x200, 0xff00ff00, 0x8000, 0xff80ff
+  .word 0x210, 0xff00ff00, 0x8000, 0xffffffff
+  .word 0x1f0, 0xff00ff00, 0xff00ff00, 0xffffffff
+  .word 0x200, 0xff00ff00, 0xff00ff00, 0xffffffff
+  .word 0x210, 0xff00ff00, 0xff00ff00, 0xffffffff
+  .word 0x1f0, 0xff00ff00, 0xe69, 0xff0e96
+  .word 0x200, 0xff00ff00, 0xe69, 0xff0e96
+  .word 0x210, 0xff00ff00, 0xe69, 0xffffffff
+  .word 0x1f0, 0x10080, 0x0, 0xfffeff7f
+  .word 0x200, 0x10080, 0x0, 0xfffeff7f
+  .word 0x210, 0x10080, 0x0, 0xffffffff
+  .word 0x1f0, 0x10080, 0x10000, 0xffffff7f
+  .word 0x200, 0x10080, 0x10000, 0xffffff7f
+  .word 0x210, 0x10080, 0x10000, 0xffffffff
+  .word 0x1f0, 0x10080, 0x10080, 0xffffffff
+  .word 0x200, 0x10080, 0x10080, 0xffffffff
+  .word 0x210, 0x10080, 0x10080, 0xffffffff
+  .word 0x1f0, 0x10080, 0x73698785, 0x8c9778fa
+  .word 0x200, 0x10080, 0x73698785, 0x8c9778fa
+  .word 0x210, 0x10080, 0x73698785, 0xffffffff
+  .word 0x1f0, 0x723b417, 0x2, 0xf8dc4bea
+  .word 0x200, 0x723b417, 0x2, 0xf8dc4bea
+  .word 0x210, 0x723b417, 0x2, 0xffffffff
+  .word 0x1f0, 0x723b417, 0x80000000, 0x78dc4be8
+  .word 0x200, 0x723b417, 0x80000000, 0x78dc4be8
+  .word 0x210, 0x723b417, 0x80000000, 0xffffffff
+  .word 0x1f0, 0x723b417, 0x723b417, 0xffffffff
+  .word 0x200, 0x723b417, 0x723b417, 0xffffffff
+  .word 0x210, 0x723b417, 0x723b417, 0xffffffff
+  .word 0x1f0, 0x723b417, 0x1, 0xf8dc4be9
+  .word 0x200, 0x723b417, 0x1, 0xf8dc4be9
+  .word 0x210, 0x723b417, 0x1, 0xffffffff
+  .word 0x1f0, 0x6c, 0x80, 0xffffff13
+  .word 0x200, 0x6c, 0x80, 0xffffff13
+  .word 0x210, 0x6c, 0x80, 0xffffffff
+  .word 0x1f0, 0x6c, 0xfffffffe, 0x6d
+  .word 0x200, 0x6c, 0xfffffffe, 0x6d
+  .word 0x210, 0x6c, 0xfffffffe, 0xffffffff
+  .word 0x1f0, 0x6c, 0x6c, 0xffffffff
+  .word 0x200, 0x6c, 0x6c, 0xffffffff
+  .word 0x210, 0x6c, 0x6c, 0xffffffff
+  .word 0x1f0, 0x6c, 0x10, 0xffffff83
+  .word 0x200, 0x6c, 0x10, 0xffffff83
+  .word 0x210, 0x6c, 0x10, 0xffffffff
+  .word 0x1f0, 0x215b8, 0x100, 0xfffdeb47
+  .word 0x200, 0x215b8, 0x100, 0xfffdeb47
+  .word 0x210, 0x215b8, 0x100, 0xffffffff
+  .word 0x1f0, 0x215b8, 0x1000000, 0xfefdea47
+  .word 0x200, 0x215b8, 0x1000000, 0xfefdea47
+  .word 0x210, 0x215b8, 0x1000000, 0xffffffff
+  .word 0x1f0, 0x215b8, 0x215b8, 0xffffffff
+  .word 0x200, 0x215b8, 0x215b8, 0xffffffff
+  .word 0x210, 0x215b8, 0x215b8, 0xffffffff
+  .word 0x1f0, 0x215b8, 0xd28fd14, 0xf2d51753
+  .word 0x200, 0x215b8, 0xd28fd14, 0xf2d51753
+  .word 0x210, 0x215b8, 0xd28fd14, 0xffffffff
+  .word 0x1f0, 0xe69, 0x8000, 0xffff7196
+  .word 0x200, 0xe69, 0x8000, 0xffff7196
+  .word 0x210, 0xe69, 0x8000, 0xffffffff
+  .word 0x1f0, 0xe69, 0xff00ff00, 0xff0e96
+  .word 0x200, 0xe69, 0xff00ff00, 0xff0e96
+  .word 0x210, 0xe69, 0xff00ff00, 0xffffffff
+  .word 0x1f0, 0xe69, 0xe69, 0xffffffff
+  .word 0x200, 0xe69, 0xe69, 0xffffffff
+  .word 0x210, 0xe69, 0xe69, 0xffffffff
+  .word 0x1f0, 0x73698785, 0x0, 0x8c96787a
+  .word 0x200, 0x73698785, 0x0, 0x8c96787a
+  .word 0x210, 0x73698785, 0x0, 0xffffffff
+  .word 0x1f0, 0x73698785, 0x10000, 0x8c97787a
+  .word 0x200, 0x73698785, 0x10000, 0x8c97787a
+  .word 0x210, 0x73698785, 0x10000, 0xffffffff
+  .word 0x1f0, 0x73698785, 0x10080, 0x8c9778fa
+  .word 0x200, 0x73698785, 0x10080, 0x8c9778fa
+  .word 0x210, 0x73698785, 0x10080, 0xffffffff
+  .word 0x1f0, 0x73698785, 0x73698785, 0xffffffff
+  .word 0x200, 0x73698785, 0x73698785, 0xffffffff
+  .word 0x210, 0x73698785, 0x73698785, 0xffffffff
+  .word 0x1f0, 0x1, 0x2, 0xfffffffc
+  .word 0x200, 0x1, 0x2, 0xfffffffc
+  .word 0x210, 0x1, 0x2, 0xffffffff
+  .word 0x1f0, 0x1, 0x80000000, 0x7ffffffe
+  .word 0x200, 0x1, 0x80000000, 0x7ffffffe
+  .word 0x210, 0x1, 0x80000000, 0xffffffff
+  .word 0x1f0, 0x1, 0x723b417, 0xf8dc4be9
+  .word 0x200, 0x1, 0x723b417, 0xf8dc4be9
+  .word 0x210, 0x1, 0x723b417, 0xffffffff
+  .word 0x1f0, 0x1, 0x1, 0xffffffff
+  .word 0x200, 0x1, 0x1, 0xffffffff
+  .word 0x210, 0x1, 0x1, 0xffffffff
+  .word 0x1f0, 0x10, 0x80, 0xffffff6f
+  .word 0x200, 0x10, 0x80, 0xffffff6f
+  .word 0x210, 0x10, 0x80, 0xffffffff
+  .word 0x1f0, 0x10, 0xfffffffe, 0x11
+  .word 0x200, 0x10, 0xfffffffe, 0x11
+  .word 0x210, 0x10, 0xfffffffe, 0xffffffff
+  .word 0x1f0, 0x10, 0x6c, 0xffffff83
+  .word 0x200, 0x10, 0x6c, 0xffffff83
+  .word 0x210, 0x10, 0x6c, 0xffffffff
+  .word 0x1f0, 0x10, 0x10, 0xffffffff
+  .word 0x200, 0x10, 0x10, 0xffffffff
+  .word 0x210, 0x10, 0x10, 0xffffffff
+  .word 0x1f0, 0xd28fd14, 0x100, 0xf2d703eb
+  .word 0x200, 0xd28fd14, 0x100, 0xf2d703eb
+  .word 0x210, 0xd28fd14, 0x100, 0xffffffff
+  .word 0x1f0, 0xd28fd14, 0x1000000, 0xf3d702eb
+  .word 0x200, 0xd28fd14, 0x1000000, 0xf3d702eb
+  .word 0x210, 0xd28fd14, 0x1000000, 0xffffffff
+  .word 0x1f0, 0xd28fd14, 0x215b8, 0xf2d51753
+  .word 0x200, 0xd28fd14, 0x215b8, 0xf2d51753
+  .word 0x210, 0xd28fd14, 0x215b8, 0xffffffff
+  .word 0x1f0, 0xd28fd14, 0xd28fd14, 0xffffffff
+  .word 0x200, 0xd28fd14, 0xd28fd14, 0xffffffff
+  .word 0x210, 0xd28fd14, 0xd28fd14, 0xffffffff
+  .word 0x220, 0x0, 0x12345687, 0xedcba978
+  .word 0x230, 0x87654321, 0x0, 0x789abcde
+  .word 0x240, 0x0, 0x0, 0x0
+  .word 0x240, 0x0, 0x2, 0x0
+  .word 0x240, 0x0, 0x80, 0x0
+  .word 0x240, 0x0, 0x100, 0x0
+  .word 0x240, 0x0, 0x8000, 0x0
+  .word 0x240, 0x0, 0x10000, 0x0
+  .word 0x240, 0x0, 0x80000000, 0x80000000
+  .word 0x240, 0x0, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x0, 0x1000000, 0x0
+  .word 0x240, 0x0, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x0, 0x10080, 0x0
+  .word 0x240, 0x0, 0x723b417, 0x0
+  .word 0x240, 0x0, 0x6c, 0x0
+  .word 0x240, 0x0, 0x215b8, 0x0
+  .word 0x240, 0x0, 0xe69, 0x0
+  .word 0x240, 0x0, 0x73698785, 0x0
+  .word 0x240, 0x0, 0x1, 0x0
+  .word 0x240, 0x0, 0x10, 0x0
+  .word 0x240, 0x0, 0xd28fd14, 0x0
+  .word 0x240, 0x2, 0x0, 0x0
+  .word 0x240, 0x2, 0x2, 0x2
+  .word 0x240, 0x2, 0x80, 0x2
+  .word 0x240, 0x2, 0x100, 0x2
+  .word 0x240, 0x2, 0x8000, 0x2
+  .word 0x240, 0x2, 0x10000, 0x2
+  .word 0x240, 0x2, 0x80000000, 0x80000000
+  .word 0x240, 0x2, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x2, 0x1000000, 0x2
+  .word 0x240, 0x2, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x2, 0x10080, 0x2
+  .word 0x240, 0x2, 0x723b417, 0x2
+  .word 0x240, 0x2, 0x6c, 0x2
+  .word 0x240, 0x2, 0x215b8, 0x2
+  .word 0x240, 0x2, 0xe69, 0x2
+  .word 0x240, 0x2, 0x73698785, 0x2
+  .word 0x240, 0x2, 0x1, 0x1
+  .word 0x240, 0x2, 0x10, 0x2
+  .word 0x240, 0x2, 0xd28fd14, 0x2
+  .word 0x240, 0x80, 0x0, 0x0
+  .word 0x240, 0x80, 0x2, 0x2
+  .word 0x240, 0x80, 0x80, 0x80
+  .word 0x240, 0x80, 0x100, 0x80
+  .word 0x240, 0x80, 0x8000, 0x80
+  .word 0x240, 0x80, 0x10000, 0x80
+  .word 0x240, 0x80, 0x80000000, 0x80000000
+  .word 0x240, 0x80, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x80, 0x1000000, 0x80
+  .word 0x240, 0x80, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x80, 0x10080, 0x80
+  .word 0x240, 0x80, 0x723b417, 0x80
+  .word 0x240, 0x80, 0x6c, 0x6c
+  .word 0x240, 0x80, 0x215b8, 0x80
+  .word 0x240, 0x80, 0xe69, 0x80
+  .word 0x240, 0x80, 0x73698785, 0x80
+  .word 0x240, 0x80, 0x1, 0x1
+  .word 0x240, 0x80, 0x10, 0x10
+  .word 0x240, 0x80, 0xd28fd14, 0x80
+  .word 0x240, 0x100, 0x0, 0x0
+  .word 0x240, 0x100, 0x2, 0x2
+  .word 0x240, 0x100, 0x80, 0x80
+  .word 0x240, 0x100, 0x100, 0x100
+  .word 0x240, 0x100, 0x8000, 0x100
+  .word 0x240, 0x100, 0x10000, 0x100
+  .word 0x240, 0x100, 0x80000000, 0x80000000
+  .word 0x240, 0x100, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x100, 0x1000000, 0x100
+  .word 0x240, 0x100, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x100, 0x10080, 0x100
+  .word 0x240, 0x100, 0x723b417, 0x100
+  .word 0x240, 0x100, 0x6c, 0x6c
+  .word 0x240, 0x100, 0x215b8, 0x100
+  .word 0x240, 0x100, 0xe69, 0x100
+  .word 0x240, 0x100, 0x73698785, 0x100
+  .word 0x240, 0x100, 0x1, 0x1
+  .word 0x240, 0x100, 0x10, 0x10
+  .word 0x240, 0x100, 0xd28fd14, 0x100
+  .word 0x240, 0x8000, 0x0, 0x0
+  .word 0x240, 0x8000, 0x2, 0x2
+  .word 0x240, 0x8000, 0x80, 0x80
+  .word 0x240, 0x8000, 0x100, 0x100
+  .word 0x240, 0x8000, 0x8000, 0x8000
+  .word 0x240, 0x8000, 0x10000, 0x8000
+  .word 0x240, 0x8000, 0x80000000, 0x80000000
+  .word 0x240, 0x8000, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x8000, 0x1000000, 0x8000
+  .word 0x240, 0x8000, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x8000, 0x10080, 0x8000
+  .word 0x240, 0x8000, 0x723b417, 0x8000
+  .word 0x240, 0x8000, 0x6c, 0x6c
+  .word 0x240, 0x8000, 0x215b8, 0x8000
+  .word 0x240, 0x8000, 0xe69, 0xe69
+  .word 0x240, 0x8000, 0x73698785, 0x8000
+  .word 0x240, 0x8000, 0x1, 0x1
+  .word 0x240, 0x8000, 0x10, 0x10
+  .word 0x240, 0x8000, 0xd28fd14, 0x8000
+  .word 0x240, 0x10000, 0x0, 0x0
+  .word 0x240, 0x10000, 0x2, 0x2
+  .word 0x240, 0x10000, 0x80, 0x80
+  .word 0x240, 0x10000, 0x100, 0x100
+  .word 0x240, 0x10000, 0x8000, 0x8000
+  .word 0x240, 0x10000, 0x10000, 0x10000
+  .word 0x240, 0x10000, 0x80000000, 0x80000000
+  .word 0x240, 0x10000, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x10000, 0x1000000, 0x10000
+  .word 0x240, 0x10000, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x10000, 0x10080, 0x10000
+  .word 0x240, 0x10000, 0x723b417, 0x10000
+  .word 0x240, 0x10000, 0x6c, 0x6c
+  .word 0x240, 0x10000, 0x215b8, 0x10000
+  .word 0x240, 0x10000, 0xe69, 0xe69
+  .word 0x240, 0x10000, 0x73698785, 0x10000
+  .word 0x240, 0x10000, 0x1, 0x1
+  .word 0x240, 0x10000, 0x10, 0x10
+  .word 0x240, 0x10000, 0xd28fd14, 0x10000
+  .word 0x240, 0x80000000, 0x0, 0x80000000
+  .word 0x240, 0x80000000, 0x2, 0x80000000
+  .word 0x240, 0x80000000, 0x80, 0x80000000
+  .word 0x240, 0x80000000, 0x100, 0x80000000
+  .word 0x240, 0x80000000, 0x8000, 0x80000000
+  .word 0x240, 0x80000000, 0x10000, 0x80000000
+  .word 0x240, 0x80000000, 0x80000000, 0x80000000
+  .word 0x240, 0x80000000, 0xfffffffe, 0x80000000
+  .word 0x240, 0x80000000, 0x1000000, 0x80000000
+  .word 0x240, 0x80000000, 0xff00ff00, 0x80000000
+  .word 0x240, 0x80000000, 0x10080, 0x80000000
+  .word 0x240, 0x80000000, 0x723b417, 0x80000000
+  .word 0x240, 0x80000000, 0x6c, 0x80000000
+  .word 0x240, 0x80000000, 0x215b8, 0x80000000
+  .word 0x240, 0x80000000, 0xe69, 0x80000000
+  .word 0x240, 0x80000000, 0x73698785, 0x80000000
+  .word 0x240, 0x80000000, 0x1, 0x80000000
+  .word 0x240, 0x80000000, 0x10, 0x80000000
+  .word 0x240, 0x80000000, 0xd28fd14, 0x80000000
+  .word 0x240, 0xfffffffe, 0x0, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x2, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x80, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x100, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x8000, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x10000, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x80000000, 0x80000000
+  .word 0x240, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x1000000, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0xfffffffe, 0x10080, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x723b417, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x6c, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x215b8, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0xe69, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x73698785, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x1, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0x10, 0xfffffffe
+  .word 0x240, 0xfffffffe, 0xd28fd14, 0xfffffffe
+  .word 0x240, 0x1000000, 0x0, 0x0
+  .word 0x240, 0x1000000, 0x2, 0x2
+  .word 0x240, 0x1000000, 0x80, 0x80
+  .word 0x240, 0x1000000, 0x100, 0x100
+  .word 0x240, 0x1000000, 0x8000, 0x8000
+  .word 0x240, 0x1000000, 0x10000, 0x10000
+  .word 0x240, 0x1000000, 0x80000000, 0x80000000
+  .word 0x240, 0x1000000, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x1000000, 0x1000000, 0x1000000
+  .word 0x240, 0x1000000, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x1000000, 0x10080, 0x10080
+  .word 0x240, 0x1000000, 0x723b417, 0x1000000
+  .word 0x240, 0x1000000, 0x6c, 0x6c
+  .word 0x240, 0x1000000, 0x215b8, 0x215b8
+  .word 0x240, 0x1000000, 0xe69, 0xe69
+  .word 0x240, 0x1000000, 0x73698785, 0x1000000
+  .word 0x240, 0x1000000, 0x1, 0x1
+  .word 0x240, 0x1000000, 0x10, 0x10
+  .word 0x240, 0x1000000, 0xd28fd14, 0x1000000
+  .word 0x240, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x2, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x80, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x100, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x8000, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x10000, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x80000000, 0x80000000
+  .word 0x240, 0xff00ff00, 0xfffffffe, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x1000000, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x10080, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x723b417, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x6c, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x215b8, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0xe69, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x73698785, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x1, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0x10, 0xff00ff00
+  .word 0x240, 0xff00ff00, 0xd28fd14, 0xff00ff00
+  .word 0x240, 0x10080, 0x0, 0x0
+  .word 0x240, 0x10080, 0x2, 0x2
+  .word 0x240, 0x10080, 0x80, 0x80
+  .word 0x240, 0x10080, 0x100, 0x100
+  .word 0x240, 0x10080, 0x8000, 0x8000
+  .word 0x240, 0x10080, 0x10000, 0x10000
+  .word 0x240, 0x10080, 0x80000000, 0x80000000
+  .word 0x240, 0x10080, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x10080, 0x1000000, 0x10080
+  .word 0x240, 0x10080, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x10080, 0x10080, 0x10080
+  .word 0x240, 0x10080, 0x723b417, 0x10080
+  .word 0x240, 0x10080, 0x6c, 0x6c
+  .word 0x240, 0x10080, 0x215b8, 0x10080
+  .word 0x240, 0x10080, 0xe69, 0xe69
+  .word 0x240, 0x10080, 0x73698785, 0x10080
+  .word 0x240, 0x10080, 0x1, 0x1
+  .word 0x240, 0x10080, 0x10, 0x10
+  .word 0x240, 0x10080, 0xd28fd14, 0x10080
+  .word 0x240, 0x723b417, 0x0, 0x0
+  .word 0x240, 0x723b417, 0x2, 0x2
+  .word 0x240, 0x723b417, 0x80, 0x80
+  .word 0x240, 0x723b417, 0x100, 0x100
+  .word 0x240, 0x723b417, 0x8000, 0x8000
+  .word 0x240, 0x723b417, 0x10000, 0x10000
+  .word 0x240, 0x723b417, 0x80000000, 0x80000000
+  .word 0x240, 0x723b417, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x723b417, 0x1000000, 0x1000000
+  .word 0x240, 0x723b417, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x723b417, 0x10080, 0x10080
+  .word 0x240, 0x723b417, 0x723b417, 0x723b417
+  .word 0x240, 0x723b417, 0x6c, 0x6c
+  .word 0x240, 0x723b417, 0x215b8, 0x215b8
+  .word 0x240, 0x723b417, 0xe69, 0xe69
+  .word 0x240, 0x723b417, 0x73698785, 0x723b417
+  .word 0x240, 0x723b417, 0x1, 0x1
+  .word 0x240, 0x723b417, 0x10, 0x10
+  .word 0x240, 0x723b417, 0xd28fd14, 0x723b417
+  .word 0x240, 0x6c, 0x0, 0x0
+  .word 0x240, 0x6c, 0x2, 0x2
+  .word 0x240, 0x6c, 0x80, 0x6c
+  .word 0x240, 0x6c, 0x100, 0x6c
+  .word 0x240, 0x6c, 0x8000, 0x6c
+  .word 0x240, 0x6c, 0x10000, 0x6c
+  .word 0x240, 0x6c, 0x80000000, 0x80000000
+  .word 0x240, 0x6c, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x6c, 0x1000000, 0x6c
+  .word 0x240, 0x6c, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x6c, 0x10080, 0x6c
+  .word 0x240, 0x6c, 0x723b417, 0x6c
+  .word 0x240, 0x6c, 0x6c, 0x6c
+  .word 0x240, 0x6c, 0x215b8, 0x6c
+  .word 0x240, 0x6c, 0xe69, 0x6c
+  .word 0x240, 0x6c, 0x73698785, 0x6c
+  .word 0x240, 0x6c, 0x1, 0x1
+  .word 0x240, 0x6c, 0x10, 0x10
+  .word 0x240, 0x6c, 0xd28fd14, 0x6c
+  .word 0x240, 0x215b8, 0x0, 0x0
+  .word 0x240, 0x215b8, 0x2, 0x2
+  .word 0x240, 0x215b8, 0x80, 0x80
+  .word 0x240, 0x215b8, 0x100, 0x100
+  .word 0x240, 0x215b8, 0x8000, 0x8000
+  .word 0x240, 0x215b8, 0x10000, 0x10000
+  .word 0x240, 0x215b8, 0x80000000, 0x80000000
+  .word 0x240, 0x215b8, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x215b8, 0x1000000, 0x215b8
+  .word 0x240, 0x215b8, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x215b8, 0x10080, 0x10080
+  .word 0x240, 0x215b8, 0x723b417, 0x215b8
+  .word 0x240, 0x215b8, 0x6c, 0x6c
+  .word 0x240, 0x215b8, 0x215b8, 0x215b8
+  .word 0x240, 0x215b8, 0xe69, 0xe69
+  .word 0x240, 0x215b8, 0x73698785, 0x215b8
+  .word 0x240, 0x215b8, 0x1, 0x1
+  .word 0x240, 0x215b8, 0x10, 0x10
+  .word 0x240, 0x215b8, 0xd28fd14, 0x215b8
+  .word 0x240, 0xe69, 0x0, 0x0
+  .word 0x240, 0xe69, 0x2, 0x2
+  .word 0x240, 0xe69, 0x80, 0x80
+  .word 0x240, 0xe69, 0x100, 0x100
+  .word 0x240, 0xe69, 0x8000, 0xe69
+  .word 0x240, 0xe69, 0x10000, 0xe69
+  .word 0x240, 0xe69, 0x80000000, 0x80000000
+  .word 0x240, 0xe69, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0xe69, 0x1000000, 0xe69
+  .word 0x240, 0xe69, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0xe69, 0x10080, 0xe69
+  .word 0x240, 0xe69, 0x723b417, 0xe69
+  .word 0x240, 0xe69, 0x6c, 0x6c
+  .word 0x240, 0xe69, 0x215b8, 0xe69
+  .word 0x240, 0xe69, 0xe69, 0xe69
+  .word 0x240, 0xe69, 0x73698785, 0xe69
+  .word 0x240, 0xe69, 0x1, 0x1
+  .word 0x240, 0xe69, 0x10, 0x10
+  .word 0x240, 0xe69, 0xd28fd14, 0xe69
+  .word 0x240, 0x73698785, 0x0, 0x0
+  .word 0x240, 0x73698785, 0x2, 0x2
+  .word 0x240, 0x73698785, 0x80, 0x80
+  .word 0x240, 0x73698785, 0x100, 0x100
+  .word 0x240, 0x73698785, 0x8000, 0x8000
+  .word 0x240, 0x73698785, 0x10000, 0x10000
+  .word 0x240, 0x73698785, 0x80000000, 0x80000000
+  .word 0x240, 0x73698785, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x73698785, 0x1000000, 0x1000000
+  .word 0x240, 0x73698785, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x73698785, 0x10080, 0x10080
+  .word 0x240, 0x73698785, 0x723b417, 0x723b417
+  .word 0x240, 0x73698785, 0x6c, 0x6c
+  .word 0x240, 0x73698785, 0x215b8, 0x215b8
+  .word 0x240, 0x73698785, 0xe69, 0xe69
+  .word 0x240, 0x73698785, 0x73698785, 0x73698785
+  .word 0x240, 0x73698785, 0x1, 0x1
+  .word 0x240, 0x73698785, 0x10, 0x10
+  .word 0x240, 0x73698785, 0xd28fd14, 0xd28fd14
+  .word 0x240, 0x1, 0x0, 0x0
+  .word 0x240, 0x1, 0x2, 0x1
+  .word 0x240, 0x1, 0x80, 0x1
+  .word 0x240, 0x1, 0x100, 0x1
+  .word 0x240, 0x1, 0x8000, 0x1
+  .word 0x240, 0x1, 0x10000, 0x1
+  .word 0x240, 0x1, 0x80000000, 0x80000000
+  .word 0x240, 0x1, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x1, 0x1000000, 0x1
+  .word 0x240, 0x1, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x1, 0x10080, 0x1
+  .word 0x240, 0x1, 0x723b417, 0x1
+  .word 0x240, 0x1, 0x6c, 0x1
+  .word 0x240, 0x1, 0x215b8, 0x1
+  .word 0x240, 0x1, 0xe69, 0x1
+  .word 0x240, 0x1, 0x73698785, 0x1
+  .word 0x240, 0x1, 0x1, 0x1
+  .word 0x240, 0x1, 0x10, 0x1
+  .word 0x240, 0x1, 0xd28fd14, 0x1
+  .word 0x240, 0x10, 0x0, 0x0
+  .word 0x240, 0x10, 0x2, 0x2
+  .word 0x240, 0x10, 0x80, 0x10
+  .word 0x240, 0x10, 0x100, 0x10
+  .word 0x240, 0x10, 0x8000, 0x10
+  .word 0x240, 0x10, 0x10000, 0x10
+  .word 0x240, 0x10, 0x80000000, 0x80000000
+  .word 0x240, 0x10, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0x10, 0x1000000, 0x10
+  .word 0x240, 0x10, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0x10, 0x10080, 0x10
+  .word 0x240, 0x10, 0x723b417, 0x10
+  .word 0x240, 0x10, 0x6c, 0x10
+  .word 0x240, 0x10, 0x215b8, 0x10
+  .word 0x240, 0x10, 0xe69, 0x10
+  .word 0x240, 0x10, 0x73698785, 0x10
+  .word 0x240, 0x10, 0x1, 0x1
+  .word 0x240, 0x10, 0x10, 0x10
+  .word 0x240, 0x10, 0xd28fd14, 0x10
+  .word 0x240, 0xd28fd14, 0x0, 0x0
+  .word 0x240, 0xd28fd14, 0x2, 0x2
+  .word 0x240, 0xd28fd14, 0x80, 0x80
+  .word 0x240, 0xd28fd14, 0x100, 0x100
+  .word 0x240, 0xd28fd14, 0x8000, 0x8000
+  .word 0x240, 0xd28fd14, 0x10000, 0x10000
+  .word 0x240, 0xd28fd14, 0x80000000, 0x80000000
+  .word 0x240, 0xd28fd14, 0xfffffffe, 0xfffffffe
+  .word 0x240, 0xd28fd14, 0x1000000, 0x1000000
+  .word 0x240, 0xd28fd14, 0xff00ff00, 0xff00ff00
+  .word 0x240, 0xd28fd14, 0x10080, 0x10080
+  .word 0x240, 0xd28fd14, 0x723b417, 0x723b417
+  .word 0x240, 0xd28fd14, 0x6c, 0x6c
+  .word 0x240, 0xd28fd14, 0x215b8, 0x215b8
+  .word 0x240, 0xd28fd14, 0xe69, 0xe69
+  .word 0x240, 0xd28fd14, 0x73698785, 0xd28fd14
+  .word 0x240, 0xd28fd14, 0x1, 0x1
+  .word 0x240, 0xd28fd14, 0x10, 0x10
+  .word 0x240, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x250, 0x0, 0x0, 0x0
+  .word 0x260, 0x0, 0x0, 0x0
+  .word 0x270, 0x0, 0x0, 0x0
+  .word 0x250, 0x0, 0x10000, 0x0
+  .word 0x260, 0x0, 0x10000, 0x0
+  .word 0x270, 0x0, 0x10000, 0x10000
+  .word 0x250, 0x0, 0x10080, 0x0
+  .word 0x260, 0x0, 0x10080, 0x0
+  .word 0x270, 0x0, 0x10080, 0x10080
+  .word 0x250, 0x0, 0x73698785, 0x0
+  .word 0x260, 0x0, 0x73698785, 0x0
+  .word 0x270, 0x0, 0x73698785, 0x73698785
+  .word 0x250, 0x2, 0x2, 0x2
+  .word 0x260, 0x2, 0x2, 0x2
+  .word 0x270, 0x2, 0x2, 0x2
+  .word 0x250, 0x2, 0x80000000, 0x80000000
+  .word 0x260, 0x2, 0x80000000, 0x80000000
+  .word 0x270, 0x2, 0x80000000, 0x80000000
+  .word 0x250, 0x2, 0x723b417, 0x2
+  .word 0x260, 0x2, 0x723b417, 0x2
+  .word 0x270, 0x2, 0x723b417, 0x723b417
+  .word 0x250, 0x2, 0x1, 0x1
+  .word 0x260, 0x2, 0x1, 0x1
+  .word 0x270, 0x2, 0x1, 0x1
+  .word 0x250, 0x80, 0x80, 0x80
+  .word 0x260, 0x80, 0x80, 0x80
+  .word 0x270, 0x80, 0x80, 0x80
+  .word 0x250, 0x80, 0xfffffffe, 0xfffffffe
+  .word 0x260, 0x80, 0xfffffffe, 0xfffffffe
+  .word 0x270, 0x80, 0xfffffffe, 0xfffffffe
+  .word 0x250, 0x80, 0x6c, 0x6c
+  .word 0x260, 0x80, 0x6c, 0x6c
+  .word 0x270, 0x80, 0x6c, 0x6c
+  .word 0x250, 0x80, 0x10, 0x10
+  .word 0x260, 0x80, 0x10, 0x10
+  .word 0x270, 0x80, 0x10, 0x10
+  .word 0x250, 0x100, 0x100, 0x100
+  .word 0x260, 0x100, 0x100, 0x100
+  .word 0x270, 0x100, 0x100, 0x100
+  .word 0x250, 0x100, 0x1000000, 0x100
+  .word 0x260, 0x100, 0x1000000, 0x100
+  .word 0x270, 0x100, 0x1000000, 0x1000000
+  .word 0x250, 0x100, 0x215b8, 0x100
+  .word 0x260, 0x100, 0x215b8, 0x100
+  .word 0x270, 0x100, 0x215b8, 0x215b8
+  .word 0x250, 0x100, 0xd28fd14, 0x100
+  .word 0x260, 0x100, 0xd28fd14, 0x100
+  .word 0x270, 0x100, 0xd28fd14, 0xd28fd14
+  .word 0x250, 0x8000, 0x8000, 0x8000
+  .word 0x260, 0x8000, 0x8000, 0x8000
+  .word 0x270, 0x8000, 0x8000, 0x8000
+  .word 0x250, 0x8000, 0xff00ff00, 0xff00ff00
+  .word 0x260, 0x8000, 0xff00ff00, 0xff00ff00
+  .word 0x270, 0x8000, 0xff00ff00, 0xff00ff00
+  .word 0x250, 0x8000, 0xe69, 0xe69
+  .word 0x260, 0x8000, 0xe69, 0xe69
+  .word 0x270, 0x8000, 0xe69, 0xe69
+  .word 0x250, 0x10000, 0x0, 0x0
+  .word 0x260, 0x10000, 0x0, 0x0
+  .word 0x270, 0x10000, 0x0, 0x0
+  .word 0x250, 0x10000, 0x10000, 0x10000
+  .word 0x260, 0x10000, 0x10000, 0x10000
+  .word 0x270, 0x10000, 0x10000, 0x10000
+  .word 0x250, 0x10000, 0x10080, 0x10000
+  .word 0x260, 0x10000, 0x10080, 0x10000
+  .word 0x270, 0x10000, 0x10080, 0x10080
+  .word 0x250, 0x10000, 0x73698785, 0x10000
+  .word 0x260, 0x10000, 0x73698785, 0x10000
+  .word 0x270, 0x10000, 0x73698785, 0x73698785
+  .word 0x250, 0x80000000, 0x2, 0x80000000
+  .word 0x260, 0x80000000, 0x2, 0x80000000
+  .word 0x270, 0x80000000, 0x2, 0x2
+  .word 0x250, 0x80000000, 0x80000000, 0x80000000
+  .word 0x260, 0x80000000, 0x80000000, 0x80000000
+  .word 0x270, 0x80000000, 0x80000000, 0x80000000
+  .word 0x250, 0x80000000, 0x723b417, 0x80000000
+  .word 0x260, 0x80000000, 0x723b417, 0x80000000
+  .word 0x270, 0x80000000, 0x723b417, 0x723b417
+  .word 0x250, 0x80000000, 0x1, 0x80000000
+  .word 0x260, 0x80000000, 0x1, 0x80000000
+  .word 0x270, 0x80000000, 0x1, 0x1
+  .word 0x250, 0xfffffffe, 0x80, 0xfffffffe
+  .word 0x260, 0xfffffffe, 0x80, 0xfffffffe
+  .word 0x270, 0xfffffffe, 0x80, 0x80
+  .word 0x250, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x260, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x270, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x250, 0xfffffffe, 0x6c, 0xfffffffe
+  .word 0x260, 0xfffffffe, 0x6c, 0xfffffffe
+  .word 0x270, 0xfffffffe, 0x6c, 0x6c
+  .word 0x250, 0xfffffffe, 0x10, 0xfffffffe
+  .word 0x260, 0xfffffffe, 0x10, 0xfffffffe
+  .word 0x270, 0xfffffffe, 0x10, 0x10
+  .word 0x250, 0x1000000, 0x100, 0x100
+  .word 0x260, 0x1000000, 0x100, 0x100
+  .word 0x270, 0x1000000, 0x100, 0x100
+  .word 0x250, 0x1000000, 0x1000000, 0x1000000
+  .word 0x260, 0x1000000, 0x1000000, 0x1000000
+  .word 0x270, 0x1000000, 0x1000000, 0x1000000
+  .word 0x250, 0x1000000, 0x215b8, 0x215b8
+  .word 0x260, 0x1000000, 0x215b8, 0x215b8
+  .word 0x270, 0x1000000, 0x215b8, 0x215b8
+  .word 0x250, 0x1000000, 0xd28fd14, 0x1000000
+  .word 0x260, 0x1000000, 0xd28fd14, 0x1000000
+  .word 0x270, 0x1000000, 0xd28fd14, 0xd28fd14
+  .word 0x250, 0xff00ff00, 0x8000, 0xff00ff00
+  .word 0x260, 0xff00ff00, 0x8000, 0xff00ff00
+  .word 0x270, 0xff00ff00, 0x8000, 0x8000
+  .word 0x250, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x260, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x270, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x250, 0xff00ff00, 0xe69, 0xff00ff00
+  .word 0x260, 0xff00ff00, 0xe69, 0xff00ff00
+  .word 0x270, 0xff00ff00, 0xe69, 0xe69
+  .word 0x250, 0x10080, 0x0, 0x0
+  .word 0x260, 0x10080, 0x0, 0x0
+  .word 0x270, 0x10080, 0x0, 0x0
+  .word 0x250, 0x10080, 0x10000, 0x10000
+  .word 0x260, 0x10080, 0x10000, 0x10000
+  .word 0x270, 0x10080, 0x10000, 0x10000
+  .word 0x250, 0x10080, 0x10080, 0x10080
+  .word 0x260, 0x10080, 0x10080, 0x10080
+  .word 0x270, 0x10080, 0x10080, 0x10080
+  .word 0x250, 0x10080, 0x73698785, 0x10080
+  .word 0x260, 0x10080, 0x73698785, 0x10080
+  .word 0x270, 0x10080, 0x73698785, 0x73698785
+  .word 0x250, 0x723b417, 0x2, 0x2
+  .word 0x260, 0x723b417, 0x2, 0x2
+  .word 0x270, 0x723b417, 0x2, 0x2
+  .word 0x250, 0x723b417, 0x80000000, 0x80000000
+  .word 0x260, 0x723b417, 0x80000000, 0x80000000
+  .word 0x270, 0x723b417, 0x80000000, 0x80000000
+  .word 0x250, 0x723b417, 0x723b417, 0x723b417
+  .word 0x260, 0x723b417, 0x723b417, 0x723b417
+  .word 0x270, 0x723b417, 0x723b417, 0x723b417
+  .word 0x250, 0x723b417, 0x1, 0x1
+  .word 0x260, 0x723b417, 0x1, 0x1
+  .word 0x270, 0x723b417, 0x1, 0x1
+  .word 0x250, 0x6c, 0x80, 0x6c
+  .word 0x260, 0x6c, 0x80, 0x6c
+  .word 0x270, 0x6c, 0x80, 0x80
+  .word 0x250, 0x6c, 0xfffffffe, 0xfffffffe
+  .word 0x260, 0x6c, 0xfffffffe, 0xfffffffe
+  .word 0x270, 0x6c, 0xfffffffe, 0xfffffffe
+  .word 0x250, 0x6c, 0x6c, 0x6c
+  .word 0x260, 0x6c, 0x6c, 0x6c
+  .word 0x270, 0x6c, 0x6c, 0x6c
+  .word 0x250, 0x6c, 0x10, 0x10
+  .word 0x260, 0x6c, 0x10, 0x10
+  .word 0x270, 0x6c, 0x10, 0x10
+  .word 0x250, 0x215b8, 0x100, 0x100
+  .word 0x260, 0x215b8, 0x100, 0x100
+  .word 0x270, 0x215b8, 0x100, 0x100
+  .word 0x250, 0x215b8, 0x1000000, 0x215b8
+  .word 0x260, 0x215b8, 0x1000000, 0x215b8
+  .word 0x270, 0x215b8, 0x1000000, 0x1000000
+  .word 0x250, 0x215b8, 0x215b8, 0x215b8
+  .word 0x260, 0x215b8, 0x215b8, 0x215b8
+  .word 0x270, 0x215b8, 0x215b8, 0x215b8
+  .word 0x250, 0x215b8, 0xd28fd14, 0x215b8
+  .word 0x260, 0x215b8, 0xd28fd14, 0x215b8
+  .word 0x270, 0x215b8, 0xd28fd14, 0xd28fd14
+  .word 0x250, 0xe69, 0x8000, 0xe69
+  .word 0x260, 0xe69, 0x8000, 0xe69
+  .word 0x270, 0xe69, 0x8000, 0x8000
+  .word 0x250, 0xe69, 0xff00ff00, 0xff00ff00
+  .word 0x260, 0xe69, 0xff00ff00, 0xff00ff00
+  .word 0x270, 0xe69, 0xff00ff00, 0xff00ff00
+  .word 0x250, 0xe69, 0xe69, 0xe69
+  .word 0x260, 0xe69, 0xe69, 0xe69
+  .word 0x270, 0xe69, 0xe69, 0xe69
+  .word 0x250, 0x73698785, 0x0, 0x0
+  .word 0x260, 0x73698785, 0x0, 0x0
+  .word 0x270, 0x73698785, 0x0, 0x0
+  .word 0x250, 0x73698785, 0x10000, 0x10000
+  .word 0x260, 0x73698785, 0x10000, 0x10000
+  .word 0x270, 0x73698785, 0x10000, 0x10000
+  .word 0x250, 0x73698785, 0x10080, 0x10080
+  .word 0x260, 0x73698785, 0x10080, 0x10080
+  .word 0x270, 0x73698785, 0x10080, 0x10080
+  .word 0x250, 0x73698785, 0x73698785, 0x73698785
+  .word 0x260, 0x73698785, 0x73698785, 0x73698785
+  .word 0x270, 0x73698785, 0x73698785, 0x73698785
+  .word 0x250, 0x1, 0x2, 0x1
+  .word 0x260, 0x1, 0x2, 0x1
+  .word 0x270, 0x1, 0x2, 0x2
+  .word 0x250, 0x1, 0x80000000, 0x80000000
+  .word 0x260, 0x1, 0x80000000, 0x80000000
+  .word 0x270, 0x1, 0x80000000, 0x80000000
+  .word 0x250, 0x1, 0x723b417, 0x1
+  .word 0x260, 0x1, 0x723b417, 0x1
+  .word 0x270, 0x1, 0x723b417, 0x723b417
+  .word 0x250, 0x1, 0x1, 0x1
+  .word 0x260, 0x1, 0x1, 0x1
+  .word 0x270, 0x1, 0x1, 0x1
+  .word 0x250, 0x10, 0x80, 0x10
+  .word 0x260, 0x10, 0x80, 0x10
+  .word 0x270, 0x10, 0x80, 0x80
+  .word 0x250, 0x10, 0xfffffffe, 0xfffffffe
+  .word 0x260, 0x10, 0xfffffffe, 0xfffffffe
+  .word 0x270, 0x10, 0xfffffffe, 0xfffffffe
+  .word 0x250, 0x10, 0x6c, 0x10
+  .word 0x260, 0x10, 0x6c, 0x10
+  .word 0x270, 0x10, 0x6c, 0x6c
+  .word 0x250, 0x10, 0x10, 0x10
+  .word 0x260, 0x10, 0x10, 0x10
+  .word 0x270, 0x10, 0x10, 0x10
+  .word 0x250, 0xd28fd14, 0x100, 0x100
+  .word 0x260, 0xd28fd14, 0x100, 0x100
+  .word 0x270, 0xd28fd14, 0x100, 0x100
+  .word 0x250, 0xd28fd14, 0x1000000, 0x1000000
+  .word 0x260, 0xd28fd14, 0x1000000, 0x1000000
+  .word 0x270, 0xd28fd14, 0x1000000, 0x1000000
+  .word 0x250, 0xd28fd14, 0x215b8, 0x215b8
+  .word 0x260, 0xd28fd14, 0x215b8, 0x215b8
+  .word 0x270, 0xd28fd14, 0x215b8, 0x215b8
+  .word 0x250, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x260, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x270, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x280, 0x0, 0x12345687, 0x0
+  .word 0x290, 0x87654321, 0x0, 0x87654321
+  .word 0x2a0, 0x0, 0x0, 0x0
+  .word 0x2a0, 0x0, 0x2, 0x2
+  .word 0x2a0, 0x0, 0x80, 0x80
+  .word 0x2a0, 0x0, 0x100, 0x100
+  .word 0x2a0, 0x0, 0x8000, 0x8000
+  .word 0x2a0, 0x0, 0x10000, 0x10000
+  .word 0x2a0, 0x0, 0x80000000, 0x0
+  .word 0x2a0, 0x0, 0xfffffffe, 0x0
+  .word 0x2a0, 0x0, 0x1000000, 0x1000000
+  .word 0x2a0, 0x0, 0xff00ff00, 0x0
+  .word 0x2a0, 0x0, 0x10080, 0x10080
+  .word 0x2a0, 0x0, 0x723b417, 0x723b417
+  .word 0x2a0, 0x0, 0x6c, 0x6c
+  .word 0x2a0, 0x0, 0x215b8, 0x215b8
+  .word 0x2a0, 0x0, 0xe69, 0xe69
+  .word 0x2a0, 0x0, 0x73698785, 0x73698785
+  .word 0x2a0, 0x0, 0x1, 0x1
+  .word 0x2a0, 0x0, 0x10, 0x10
+  .word 0x2a0, 0x0, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x2, 0x0, 0x2
+  .word 0x2a0, 0x2, 0x2, 0x2
+  .word 0x2a0, 0x2, 0x80, 0x80
+  .word 0x2a0, 0x2, 0x100, 0x100
+  .word 0x2a0, 0x2, 0x8000, 0x8000
+  .word 0x2a0, 0x2, 0x10000, 0x10000
+  .word 0x2a0, 0x2, 0x80000000, 0x2
+  .word 0x2a0, 0x2, 0xfffffffe, 0x2
+  .word 0x2a0, 0x2, 0x1000000, 0x1000000
+  .word 0x2a0, 0x2, 0xff00ff00, 0x2
+  .word 0x2a0, 0x2, 0x10080, 0x10080
+  .word 0x2a0, 0x2, 0x723b417, 0x723b417
+  .word 0x2a0, 0x2, 0x6c, 0x6c
+  .word 0x2a0, 0x2, 0x215b8, 0x215b8
+  .word 0x2a0, 0x2, 0xe69, 0xe69
+  .word 0x2a0, 0x2, 0x73698785, 0x73698785
+  .word 0x2a0, 0x2, 0x1, 0x2
+  .word 0x2a0, 0x2, 0x10, 0x10
+  .word 0x2a0, 0x2, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x80, 0x0, 0x80
+  .word 0x2a0, 0x80, 0x2, 0x80
+  .word 0x2a0, 0x80, 0x80, 0x80
+  .word 0x2a0, 0x80, 0x100, 0x100
+  .word 0x2a0, 0x80, 0x8000, 0x8000
+  .word 0x2a0, 0x80, 0x10000, 0x10000
+  .word 0x2a0, 0x80, 0x80000000, 0x80
+  .word 0x2a0, 0x80, 0xfffffffe, 0x80
+  .word 0x2a0, 0x80, 0x1000000, 0x1000000
+  .word 0x2a0, 0x80, 0xff00ff00, 0x80
+  .word 0x2a0, 0x80, 0x10080, 0x10080
+  .word 0x2a0, 0x80, 0x723b417, 0x723b417
+  .word 0x2a0, 0x80, 0x6c, 0x80
+  .word 0x2a0, 0x80, 0x215b8, 0x215b8
+  .word 0x2a0, 0x80, 0xe69, 0xe69
+  .word 0x2a0, 0x80, 0x73698785, 0x73698785
+  .word 0x2a0, 0x80, 0x1, 0x80
+  .word 0x2a0, 0x80, 0x10, 0x80
+  .word 0x2a0, 0x80, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x100, 0x0, 0x100
+  .word 0x2a0, 0x100, 0x2, 0x100
+  .word 0x2a0, 0x100, 0x80, 0x100
+  .word 0x2a0, 0x100, 0x100, 0x100
+  .word 0x2a0, 0x100, 0x8000, 0x8000
+  .word 0x2a0, 0x100, 0x10000, 0x10000
+  .word 0x2a0, 0x100, 0x80000000, 0x100
+  .word 0x2a0, 0x100, 0xfffffffe, 0x100
+  .word 0x2a0, 0x100, 0x1000000, 0x1000000
+  .word 0x2a0, 0x100, 0xff00ff00, 0x100
+  .word 0x2a0, 0x100, 0x10080, 0x10080
+  .word 0x2a0, 0x100, 0x723b417, 0x723b417
+  .word 0x2a0, 0x100, 0x6c, 0x100
+  .word 0x2a0, 0x100, 0x215b8, 0x215b8
+  .word 0x2a0, 0x100, 0xe69, 0xe69
+  .word 0x2a0, 0x100, 0x73698785, 0x73698785
+  .word 0x2a0, 0x100, 0x1, 0x100
+  .word 0x2a0, 0x100, 0x10, 0x100
+  .word 0x2a0, 0x100, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x8000, 0x0, 0x8000
+  .word 0x2a0, 0x8000, 0x2, 0x8000
+  .word 0x2a0, 0x8000, 0x80, 0x8000
+  .word 0x2a0, 0x8000, 0x100, 0x8000
+  .word 0x2a0, 0x8000, 0x8000, 0x8000
+  .word 0x2a0, 0x8000, 0x10000, 0x10000
+  .word 0x2a0, 0x8000, 0x80000000, 0x8000
+  .word 0x2a0, 0x8000, 0xfffffffe, 0x8000
+  .word 0x2a0, 0x8000, 0x1000000, 0x1000000
+  .word 0x2a0, 0x8000, 0xff00ff00, 0x8000
+  .word 0x2a0, 0x8000, 0x10080, 0x10080
+  .word 0x2a0, 0x8000, 0x723b417, 0x723b417
+  .word 0x2a0, 0x8000, 0x6c, 0x8000
+  .word 0x2a0, 0x8000, 0x215b8, 0x215b8
+  .word 0x2a0, 0x8000, 0xe69, 0x8000
+  .word 0x2a0, 0x8000, 0x73698785, 0x73698785
+  .word 0x2a0, 0x8000, 0x1, 0x8000
+  .word 0x2a0, 0x8000, 0x10, 0x8000
+  .word 0x2a0, 0x8000, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x10000, 0x0, 0x10000
+  .word 0x2a0, 0x10000, 0x2, 0x10000
+  .word 0x2a0, 0x10000, 0x80, 0x10000
+  .word 0x2a0, 0x10000, 0x100, 0x10000
+  .word 0x2a0, 0x10000, 0x8000, 0x10000
+  .word 0x2a0, 0x10000, 0x10000, 0x10000
+  .word 0x2a0, 0x10000, 0x80000000, 0x10000
+  .word 0x2a0, 0x10000, 0xfffffffe, 0x10000
+  .word 0x2a0, 0x10000, 0x1000000, 0x1000000
+  .word 0x2a0, 0x10000, 0xff00ff00, 0x10000
+  .word 0x2a0, 0x10000, 0x10080, 0x10080
+  .word 0x2a0, 0x10000, 0x723b417, 0x723b417
+  .word 0x2a0, 0x10000, 0x6c, 0x10000
+  .word 0x2a0, 0x10000, 0x215b8, 0x215b8
+  .word 0x2a0, 0x10000, 0xe69, 0x10000
+  .word 0x2a0, 0x10000, 0x73698785, 0x73698785
+  .word 0x2a0, 0x10000, 0x1, 0x10000
+  .word 0x2a0, 0x10000, 0x10, 0x10000
+  .word 0x2a0, 0x10000, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x80000000, 0x0, 0x0
+  .word 0x2a0, 0x80000000, 0x2, 0x2
+  .word 0x2a0, 0x80000000, 0x80, 0x80
+  .word 0x2a0, 0x80000000, 0x100, 0x100
+  .word 0x2a0, 0x80000000, 0x8000, 0x8000
+  .word 0x2a0, 0x80000000, 0x10000, 0x10000
+  .word 0x2a0, 0x80000000, 0x80000000, 0x80000000
+  .word 0x2a0, 0x80000000, 0xfffffffe, 0xfffffffe
+  .word 0x2a0, 0x80000000, 0x1000000, 0x1000000
+  .word 0x2a0, 0x80000000, 0xff00ff00, 0xff00ff00
+  .word 0x2a0, 0x80000000, 0x10080, 0x10080
+  .word 0x2a0, 0x80000000, 0x723b417, 0x723b417
+  .word 0x2a0, 0x80000000, 0x6c, 0x6c
+  .word 0x2a0, 0x80000000, 0x215b8, 0x215b8
+  .word 0x2a0, 0x80000000, 0xe69, 0xe69
+  .word 0x2a0, 0x80000000, 0x73698785, 0x73698785
+  .word 0x2a0, 0x80000000, 0x1, 0x1
+  .word 0x2a0, 0x80000000, 0x10, 0x10
+  .word 0x2a0, 0x80000000, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0xfffffffe, 0x0, 0x0
+  .word 0x2a0, 0xfffffffe, 0x2, 0x2
+  .word 0x2a0, 0xfffffffe, 0x80, 0x80
+  .word 0x2a0, 0xfffffffe, 0x100, 0x100
+  .word 0x2a0, 0xfffffffe, 0x8000, 0x8000
+  .word 0x2a0, 0xfffffffe, 0x10000, 0x10000
+  .word 0x2a0, 0xfffffffe, 0x80000000, 0xfffffffe
+  .word 0x2a0, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x2a0, 0xfffffffe, 0x1000000, 0x1000000
+  .word 0x2a0, 0xfffffffe, 0xff00ff00, 0xfffffffe
+  .word 0x2a0, 0xfffffffe, 0x10080, 0x10080
+  .word 0x2a0, 0xfffffffe, 0x723b417, 0x723b417
+  .word 0x2a0, 0xfffffffe, 0x6c, 0x6c
+  .word 0x2a0, 0xfffffffe, 0x215b8, 0x215b8
+  .word 0x2a0, 0xfffffffe, 0xe69, 0xe69
+  .word 0x2a0, 0xfffffffe, 0x73698785, 0x73698785
+  .word 0x2a0, 0xfffffffe, 0x1, 0x1
+  .word 0x2a0, 0xfffffffe, 0x10, 0x10
+  .word 0x2a0, 0xfffffffe, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x1000000, 0x0, 0x1000000
+  .word 0x2a0, 0x1000000, 0x2, 0x1000000
+  .word 0x2a0, 0x1000000, 0x80, 0x1000000
+  .word 0x2a0, 0x1000000, 0x100, 0x1000000
+  .word 0x2a0, 0x1000000, 0x8000, 0x1000000
+  .word 0x2a0, 0x1000000, 0x10000, 0x1000000
+  .word 0x2a0, 0x1000000, 0x80000000, 0x1000000
+  .word 0x2a0, 0x1000000, 0xfffffffe, 0x1000000
+  .word 0x2a0, 0x1000000, 0x1000000, 0x1000000
+  .word 0x2a0, 0x1000000, 0xff00ff00, 0x1000000
+  .word 0x2a0, 0x1000000, 0x10080, 0x1000000
+  .word 0x2a0, 0x1000000, 0x723b417, 0x723b417
+  .word 0x2a0, 0x1000000, 0x6c, 0x1000000
+  .word 0x2a0, 0x1000000, 0x215b8, 0x1000000
+  .word 0x2a0, 0x1000000, 0xe69, 0x1000000
+  .word 0x2a0, 0x1000000, 0x73698785, 0x73698785
+  .word 0x2a0, 0x1000000, 0x1, 0x1000000
+  .word 0x2a0, 0x1000000, 0x10, 0x1000000
+  .word 0x2a0, 0x1000000, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0xff00ff00, 0x0, 0x0
+  .word 0x2a0, 0xff00ff00, 0x2, 0x2
+  .word 0x2a0, 0xff00ff00, 0x80, 0x80
+  .word 0x2a0, 0xff00ff00, 0x100, 0x100
+  .word 0x2a0, 0xff00ff00, 0x8000, 0x8000
+  .word 0x2a0, 0xff00ff00, 0x10000, 0x10000
+  .word 0x2a0, 0xff00ff00, 0x80000000, 0xff00ff00
+  .word 0x2a0, 0xff00ff00, 0xfffffffe, 0xfffffffe
+  .word 0x2a0, 0xff00ff00, 0x1000000, 0x1000000
+  .word 0x2a0, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x2a0, 0xff00ff00, 0x10080, 0x10080
+  .word 0x2a0, 0xff00ff00, 0x723b417, 0x723b417
+  .word 0x2a0, 0xff00ff00, 0x6c, 0x6c
+  .word 0x2a0, 0xff00ff00, 0x215b8, 0x215b8
+  .word 0x2a0, 0xff00ff00, 0xe69, 0xe69
+  .word 0x2a0, 0xff00ff00, 0x73698785, 0x73698785
+  .word 0x2a0, 0xff00ff00, 0x1, 0x1
+  .word 0x2a0, 0xff00ff00, 0x10, 0x10
+  .word 0x2a0, 0xff00ff00, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x10080, 0x0, 0x10080
+  .word 0x2a0, 0x10080, 0x2, 0x10080
+  .word 0x2a0, 0x10080, 0x80, 0x10080
+  .word 0x2a0, 0x10080, 0x100, 0x10080
+  .word 0x2a0, 0x10080, 0x8000, 0x10080
+  .word 0x2a0, 0x10080, 0x10000, 0x10080
+  .word 0x2a0, 0x10080, 0x80000000, 0x10080
+  .word 0x2a0, 0x10080, 0xfffffffe, 0x10080
+  .word 0x2a0, 0x10080, 0x1000000, 0x1000000
+  .word 0x2a0, 0x10080, 0xff00ff00, 0x10080
+  .word 0x2a0, 0x10080, 0x10080, 0x10080
+  .word 0x2a0, 0x10080, 0x723b417, 0x723b417
+  .word 0x2a0, 0x10080, 0x6c, 0x10080
+  .word 0x2a0, 0x10080, 0x215b8, 0x215b8
+  .word 0x2a0, 0x10080, 0xe69, 0x10080
+  .word 0x2a0, 0x10080, 0x73698785, 0x73698785
+  .word 0x2a0, 0x10080, 0x1, 0x10080
+  .word 0x2a0, 0x10080, 0x10, 0x10080
+  .word 0x2a0, 0x10080, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x723b417, 0x0, 0x723b417
+  .word 0x2a0, 0x723b417, 0x2, 0x723b417
+  .word 0x2a0, 0x723b417, 0x80, 0x723b417
+  .word 0x2a0, 0x723b417, 0x100, 0x723b417
+  .word 0x2a0, 0x723b417, 0x8000, 0x723b417
+  .word 0x2a0, 0x723b417, 0x10000, 0x723b417
+  .word 0x2a0, 0x723b417, 0x80000000, 0x723b417
+  .word 0x2a0, 0x723b417, 0xfffffffe, 0x723b417
+  .word 0x2a0, 0x723b417, 0x1000000, 0x723b417
+  .word 0x2a0, 0x723b417, 0xff00ff00, 0x723b417
+  .word 0x2a0, 0x723b417, 0x10080, 0x723b417
+  .word 0x2a0, 0x723b417, 0x723b417, 0x723b417
+  .word 0x2a0, 0x723b417, 0x6c, 0x723b417
+  .word 0x2a0, 0x723b417, 0x215b8, 0x723b417
+  .word 0x2a0, 0x723b417, 0xe69, 0x723b417
+  .word 0x2a0, 0x723b417, 0x73698785, 0x73698785
+  .word 0x2a0, 0x723b417, 0x1, 0x723b417
+  .word 0x2a0, 0x723b417, 0x10, 0x723b417
+  .word 0x2a0, 0x723b417, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x6c, 0x0, 0x6c
+  .word 0x2a0, 0x6c, 0x2, 0x6c
+  .word 0x2a0, 0x6c, 0x80, 0x80
+  .word 0x2a0, 0x6c, 0x100, 0x100
+  .word 0x2a0, 0x6c, 0x8000, 0x8000
+  .word 0x2a0, 0x6c, 0x10000, 0x10000
+  .word 0x2a0, 0x6c, 0x80000000, 0x6c
+  .word 0x2a0, 0x6c, 0xfffffffe, 0x6c
+  .word 0x2a0, 0x6c, 0x1000000, 0x1000000
+  .word 0x2a0, 0x6c, 0xff00ff00, 0x6c
+  .word 0x2a0, 0x6c, 0x10080, 0x10080
+  .word 0x2a0, 0x6c, 0x723b417, 0x723b417
+  .word 0x2a0, 0x6c, 0x6c, 0x6c
+  .word 0x2a0, 0x6c, 0x215b8, 0x215b8
+  .word 0x2a0, 0x6c, 0xe69, 0xe69
+  .word 0x2a0, 0x6c, 0x73698785, 0x73698785
+  .word 0x2a0, 0x6c, 0x1, 0x6c
+  .word 0x2a0, 0x6c, 0x10, 0x6c
+  .word 0x2a0, 0x6c, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x215b8, 0x0, 0x215b8
+  .word 0x2a0, 0x215b8, 0x2, 0x215b8
+  .word 0x2a0, 0x215b8, 0x80, 0x215b8
+  .word 0x2a0, 0x215b8, 0x100, 0x215b8
+  .word 0x2a0, 0x215b8, 0x8000, 0x215b8
+  .word 0x2a0, 0x215b8, 0x10000, 0x215b8
+  .word 0x2a0, 0x215b8, 0x80000000, 0x215b8
+  .word 0x2a0, 0x215b8, 0xfffffffe, 0x215b8
+  .word 0x2a0, 0x215b8, 0x1000000, 0x1000000
+  .word 0x2a0, 0x215b8, 0xff00ff00, 0x215b8
+  .word 0x2a0, 0x215b8, 0x10080, 0x215b8
+  .word 0x2a0, 0x215b8, 0x723b417, 0x723b417
+  .word 0x2a0, 0x215b8, 0x6c, 0x215b8
+  .word 0x2a0, 0x215b8, 0x215b8, 0x215b8
+  .word 0x2a0, 0x215b8, 0xe69, 0x215b8
+  .word 0x2a0, 0x215b8, 0x73698785, 0x73698785
+  .word 0x2a0, 0x215b8, 0x1, 0x215b8
+  .word 0x2a0, 0x215b8, 0x10, 0x215b8
+  .word 0x2a0, 0x215b8, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0xe69, 0x0, 0xe69
+  .word 0x2a0, 0xe69, 0x2, 0xe69
+  .word 0x2a0, 0xe69, 0x80, 0xe69
+  .word 0x2a0, 0xe69, 0x100, 0xe69
+  .word 0x2a0, 0xe69, 0x8000, 0x8000
+  .word 0x2a0, 0xe69, 0x10000, 0x10000
+  .word 0x2a0, 0xe69, 0x80000000, 0xe69
+  .word 0x2a0, 0xe69, 0xfffffffe, 0xe69
+  .word 0x2a0, 0xe69, 0x1000000, 0x1000000
+  .word 0x2a0, 0xe69, 0xff00ff00, 0xe69
+  .word 0x2a0, 0xe69, 0x10080, 0x10080
+  .word 0x2a0, 0xe69, 0x723b417, 0x723b417
+  .word 0x2a0, 0xe69, 0x6c, 0xe69
+  .word 0x2a0, 0xe69, 0x215b8, 0x215b8
+  .word 0x2a0, 0xe69, 0xe69, 0xe69
+  .word 0x2a0, 0xe69, 0x73698785, 0x73698785
+  .word 0x2a0, 0xe69, 0x1, 0xe69
+  .word 0x2a0, 0xe69, 0x10, 0xe69
+  .word 0x2a0, 0xe69, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x73698785, 0x0, 0x73698785
+  .word 0x2a0, 0x73698785, 0x2, 0x73698785
+  .word 0x2a0, 0x73698785, 0x80, 0x73698785
+  .word 0x2a0, 0x73698785, 0x100, 0x73698785
+  .word 0x2a0, 0x73698785, 0x8000, 0x73698785
+  .word 0x2a0, 0x73698785, 0x10000, 0x73698785
+  .word 0x2a0, 0x73698785, 0x80000000, 0x73698785
+  .word 0x2a0, 0x73698785, 0xfffffffe, 0x73698785
+  .word 0x2a0, 0x73698785, 0x1000000, 0x73698785
+  .word 0x2a0, 0x73698785, 0xff00ff00, 0x73698785
+  .word 0x2a0, 0x73698785, 0x10080, 0x73698785
+  .word 0x2a0, 0x73698785, 0x723b417, 0x73698785
+  .word 0x2a0, 0x73698785, 0x6c, 0x73698785
+  .word 0x2a0, 0x73698785, 0x215b8, 0x73698785
+  .word 0x2a0, 0x73698785, 0xe69, 0x73698785
+  .word 0x2a0, 0x73698785, 0x73698785, 0x73698785
+  .word 0x2a0, 0x73698785, 0x1, 0x73698785
+  .word 0x2a0, 0x73698785, 0x10, 0x73698785
+  .word 0x2a0, 0x73698785, 0xd28fd14, 0x73698785
+  .word 0x2a0, 0x1, 0x0, 0x1
+  .word 0x2a0, 0x1, 0x2, 0x2
+  .word 0x2a0, 0x1, 0x80, 0x80
+  .word 0x2a0, 0x1, 0x100, 0x100
+  .word 0x2a0, 0x1, 0x8000, 0x8000
+  .word 0x2a0, 0x1, 0x10000, 0x10000
+  .word 0x2a0, 0x1, 0x80000000, 0x1
+  .word 0x2a0, 0x1, 0xfffffffe, 0x1
+  .word 0x2a0, 0x1, 0x1000000, 0x1000000
+  .word 0x2a0, 0x1, 0xff00ff00, 0x1
+  .word 0x2a0, 0x1, 0x10080, 0x10080
+  .word 0x2a0, 0x1, 0x723b417, 0x723b417
+  .word 0x2a0, 0x1, 0x6c, 0x6c
+  .word 0x2a0, 0x1, 0x215b8, 0x215b8
+  .word 0x2a0, 0x1, 0xe69, 0xe69
+  .word 0x2a0, 0x1, 0x73698785, 0x73698785
+  .word 0x2a0, 0x1, 0x1, 0x1
+  .word 0x2a0, 0x1, 0x10, 0x10
+  .word 0x2a0, 0x1, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0x10, 0x0, 0x10
+  .word 0x2a0, 0x10, 0x2, 0x10
+  .word 0x2a0, 0x10, 0x80, 0x80
+  .word 0x2a0, 0x10, 0x100, 0x100
+  .word 0x2a0, 0x10, 0x8000, 0x8000
+  .word 0x2a0, 0x10, 0x10000, 0x10000
+  .word 0x2a0, 0x10, 0x80000000, 0x10
+  .word 0x2a0, 0x10, 0xfffffffe, 0x10
+  .word 0x2a0, 0x10, 0x1000000, 0x1000000
+  .word 0x2a0, 0x10, 0xff00ff00, 0x10
+  .word 0x2a0, 0x10, 0x10080, 0x10080
+  .word 0x2a0, 0x10, 0x723b417, 0x723b417
+  .word 0x2a0, 0x10, 0x6c, 0x6c
+  .word 0x2a0, 0x10, 0x215b8, 0x215b8
+  .word 0x2a0, 0x10, 0xe69, 0xe69
+  .word 0x2a0, 0x10, 0x73698785, 0x73698785
+  .word 0x2a0, 0x10, 0x1, 0x10
+  .word 0x2a0, 0x10, 0x10, 0x10
+  .word 0x2a0, 0x10, 0xd28fd14, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x2, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x80, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x100, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x8000, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x10000, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0xfffffffe, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x1000000, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0xff00ff00, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x10080, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x723b417, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x6c, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x215b8, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0xe69, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x73698785, 0x73698785
+  .word 0x2a0, 0xd28fd14, 0x1, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0x10, 0xd28fd14
+  .word 0x2a0, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x2b0, 0x0, 0x0, 0x0
+  .word 0x2c0, 0x0, 0x0, 0x0
+  .word 0x2d0, 0x0, 0x0, 0x0
+  .word 0x2b0, 0x0, 0x10000, 0x10000
+  .word 0x2c0, 0x0, 0x10000, 0x10000
+  .word 0x2d0, 0x0, 0x10000, 0x10000
+  .word 0x2b0, 0x0, 0x10080, 0x10080
+  .word 0x2c0, 0x0, 0x10080, 0x10080
+  .word 0x2d0, 0x0, 0x10080, 0x10080
+  .word 0x2b0, 0x0, 0x73698785, 0x73698785
+  .word 0x2c0, 0x0, 0x73698785, 0x73698785
+  .word 0x2d0, 0x0, 0x73698785, 0x73698785
+  .word 0x2b0, 0x2, 0x2, 0x2
+  .word 0x2c0, 0x2, 0x2, 0x2
+  .word 0x2d0, 0x2, 0x2, 0x2
+  .word 0x2b0, 0x2, 0x80000000, 0x2
+  .word 0x2c0, 0x2, 0x80000000, 0x2
+  .word 0x2d0, 0x2, 0x80000000, 0x80000000
+  .word 0x2b0, 0x2, 0x723b417, 0x723b417
+  .word 0x2c0, 0x2, 0x723b417, 0x723b417
+  .word 0x2d0, 0x2, 0x723b417, 0x723b417
+  .word 0x2b0, 0x2, 0x1, 0x2
+  .word 0x2c0, 0x2, 0x1, 0x2
+  .word 0x2d0, 0x2, 0x1, 0x1
+  .word 0x2b0, 0x80, 0x80, 0x80
+  .word 0x2c0, 0x80, 0x80, 0x80
+  .word 0x2d0, 0x80, 0x80, 0x80
+  .word 0x2b0, 0x80, 0xfffffffe, 0x80
+  .word 0x2c0, 0x80, 0xfffffffe, 0x80
+  .word 0x2d0, 0x80, 0xfffffffe, 0xfffffffe
+  .word 0x2b0, 0x80, 0x6c, 0x80
+  .word 0x2c0, 0x80, 0x6c, 0x80
+  .word 0x2d0, 0x80, 0x6c, 0x6c
+  .word 0x2b0, 0x80, 0x10, 0x80
+  .word 0x2c0, 0x80, 0x10, 0x80
+  .word 0x2d0, 0x80, 0x10, 0x10
+  .word 0x2b0, 0x100, 0x100, 0x100
+  .word 0x2c0, 0x100, 0x100, 0x100
+  .word 0x2d0, 0x100, 0x100, 0x100
+  .word 0x2b0, 0x100, 0x1000000, 0x1000000
+  .word 0x2c0, 0x100, 0x1000000, 0x1000000
+  .word 0x2d0, 0x100, 0x1000000, 0x1000000
+  .word 0x2b0, 0x100, 0x215b8, 0x215b8
+  .word 0x2c0, 0x100, 0x215b8, 0x215b8
+  .word 0x2d0, 0x100, 0x215b8, 0x215b8
+  .word 0x2b0, 0x100, 0xd28fd14, 0xd28fd14
+  .word 0x2c0, 0x100, 0xd28fd14, 0xd28fd14
+  .word 0x2d0, 0x100, 0xd28fd14, 0xd28fd14
+  .word 0x2b0, 0x8000, 0x8000, 0x8000
+  .word 0x2c0, 0x8000, 0x8000, 0x8000
+  .word 0x2d0, 0x8000, 0x8000, 0x8000
+  .word 0x2b0, 0x8000, 0xff00ff00, 0x8000
+  .word 0x2c0, 0x8000, 0xff00ff00, 0x8000
+  .word 0x2d0, 0x8000, 0xff00ff00, 0xff00ff00
+  .word 0x2b0, 0x8000, 0xe69, 0x8000
+  .word 0x2c0, 0x8000, 0xe69, 0x8000
+  .word 0x2d0, 0x8000, 0xe69, 0xe69
+  .word 0x2b0, 0x10000, 0x0, 0x10000
+  .word 0x2c0, 0x10000, 0x0, 0x10000
+  .word 0x2d0, 0x10000, 0x0, 0x0
+  .word 0x2b0, 0x10000, 0x10000, 0x10000
+  .word 0x2c0, 0x10000, 0x10000, 0x10000
+  .word 0x2d0, 0x10000, 0x10000, 0x10000
+  .word 0x2b0, 0x10000, 0x10080, 0x10080
+  .word 0x2c0, 0x10000, 0x10080, 0x10080
+  .word 0x2d0, 0x10000, 0x10080, 0x10080
+  .word 0x2b0, 0x10000, 0x73698785, 0x73698785
+  .word 0x2c0, 0x10000, 0x73698785, 0x73698785
+  .word 0x2d0, 0x10000, 0x73698785, 0x73698785
+  .word 0x2b0, 0x80000000, 0x2, 0x2
+  .word 0x2c0, 0x80000000, 0x2, 0x2
+  .word 0x2d0, 0x80000000, 0x2, 0x2
+  .word 0x2b0, 0x80000000, 0x80000000, 0x80000000
+  .word 0x2c0, 0x80000000, 0x80000000, 0x80000000
+  .word 0x2d0, 0x80000000, 0x80000000, 0x80000000
+  .word 0x2b0, 0x80000000, 0x723b417, 0x723b417
+  .word 0x2c0, 0x80000000, 0x723b417, 0x723b417
+  .word 0x2d0, 0x80000000, 0x723b417, 0x723b417
+  .word 0x2b0, 0x80000000, 0x1, 0x1
+  .word 0x2c0, 0x80000000, 0x1, 0x1
+  .word 0x2d0, 0x80000000, 0x1, 0x1
+  .word 0x2b0, 0xfffffffe, 0x80, 0x80
+  .word 0x2c0, 0xfffffffe, 0x80, 0x80
+  .word 0x2d0, 0xfffffffe, 0x80, 0x80
+  .word 0x2b0, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x2c0, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x2d0, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x2b0, 0xfffffffe, 0x6c, 0x6c
+  .word 0x2c0, 0xfffffffe, 0x6c, 0x6c
+  .word 0x2d0, 0xfffffffe, 0x6c, 0x6c
+  .word 0x2b0, 0xfffffffe, 0x10, 0x10
+  .word 0x2c0, 0xfffffffe, 0x10, 0x10
+  .word 0x2d0, 0xfffffffe, 0x10, 0x10
+  .word 0x2b0, 0x1000000, 0x100, 0x1000000
+  .word 0x2c0, 0x1000000, 0x100, 0x1000000
+  .word 0x2d0, 0x1000000, 0x100, 0x100
+  .word 0x2b0, 0x1000000, 0x1000000, 0x1000000
+  .word 0x2c0, 0x1000000, 0x1000000, 0x1000000
+  .word 0x2d0, 0x1000000, 0x1000000, 0x1000000
+  .word 0x2b0, 0x1000000, 0x215b8, 0x1000000
+  .word 0x2c0, 0x1000000, 0x215b8, 0x1000000
+  .word 0x2d0, 0x1000000, 0x215b8, 0x215b8
+  .word 0x2b0, 0x1000000, 0xd28fd14, 0xd28fd14
+  .word 0x2c0, 0x1000000, 0xd28fd14, 0xd28fd14
+  .word 0x2d0, 0x1000000, 0xd28fd14, 0xd28fd14
+  .word 0x2b0, 0xff00ff00, 0x8000, 0x8000
+  .word 0x2c0, 0xff00ff00, 0x8000, 0x8000
+  .word 0x2d0, 0xff00ff00, 0x8000, 0x8000
+  .word 0x2b0, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x2c0, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x2d0, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x2b0, 0xff00ff00, 0xe69, 0xe69
+  .word 0x2c0, 0xff00ff00, 0xe69, 0xe69
+  .word 0x2d0, 0xff00ff00, 0xe69, 0xe69
+  .word 0x2b0, 0x10080, 0x0, 0x10080
+  .word 0x2c0, 0x10080, 0x0, 0x10080
+  .word 0x2d0, 0x10080, 0x0, 0x0
+  .word 0x2b0, 0x10080, 0x10000, 0x10080
+  .word 0x2c0, 0x10080, 0x10000, 0x10080
+  .word 0x2d0, 0x10080, 0x10000, 0x10000
+  .word 0x2b0, 0x10080, 0x10080, 0x10080
+  .word 0x2c0, 0x10080, 0x10080, 0x10080
+  .word 0x2d0, 0x10080, 0x10080, 0x10080
+  .word 0x2b0, 0x10080, 0x73698785, 0x73698785
+  .word 0x2c0, 0x10080, 0x73698785, 0x73698785
+  .word 0x2d0, 0x10080, 0x73698785, 0x73698785
+  .word 0x2b0, 0x723b417, 0x2, 0x723b417
+  .word 0x2c0, 0x723b417, 0x2, 0x723b417
+  .word 0x2d0, 0x723b417, 0x2, 0x2
+  .word 0x2b0, 0x723b417, 0x80000000, 0x723b417
+  .word 0x2c0, 0x723b417, 0x80000000, 0x723b417
+  .word 0x2d0, 0x723b417, 0x80000000, 0x80000000
+  .word 0x2b0, 0x723b417, 0x723b417, 0x723b417
+  .word 0x2c0, 0x723b417, 0x723b417, 0x723b417
+  .word 0x2d0, 0x723b417, 0x723b417, 0x723b417
+  .word 0x2b0, 0x723b417, 0x1, 0x723b417
+  .word 0x2c0, 0x723b417, 0x1, 0x723b417
+  .word 0x2d0, 0x723b417, 0x1, 0x1
+  .word 0x2b0, 0x6c, 0x80, 0x80
+  .word 0x2c0, 0x6c, 0x80, 0x80
+  .word 0x2d0, 0x6c, 0x80, 0x80
+  .word 0x2b0, 0x6c, 0xfffffffe, 0x6c
+  .word 0x2c0, 0x6c, 0xfffffffe, 0x6c
+  .word 0x2d0, 0x6c, 0xfffffffe, 0xfffffffe
+  .word 0x2b0, 0x6c, 0x6c, 0x6c
+  .word 0x2c0, 0x6c, 0x6c, 0x6c
+  .word 0x2d0, 0x6c, 0x6c, 0x6c
+  .word 0x2b0, 0x6c, 0x10, 0x6c
+  .word 0x2c0, 0x6c, 0x10, 0x6c
+  .word 0x2d0, 0x6c, 0x10, 0x10
+  .word 0x2b0, 0x215b8, 0x100, 0x215b8
+  .word 0x2c0, 0x215b8, 0x100, 0x215b8
+  .word 0x2d0, 0x215b8, 0x100, 0x100
+  .word 0x2b0, 0x215b8, 0x1000000, 0x1000000
+  .word 0x2c0, 0x215b8, 0x1000000, 0x1000000
+  .word 0x2d0, 0x215b8, 0x1000000, 0x1000000
+  .word 0x2b0, 0x215b8, 0x215b8, 0x215b8
+  .word 0x2c0, 0x215b8, 0x215b8, 0x215b8
+  .word 0x2d0, 0x215b8, 0x215b8, 0x215b8
+  .word 0x2b0, 0x215b8, 0xd28fd14, 0xd28fd14
+  .word 0x2c0, 0x215b8, 0xd28fd14, 0xd28fd14
+  .word 0x2d0, 0x215b8, 0xd28fd14, 0xd28fd14
+  .word 0x2b0, 0xe69, 0x8000, 0x8000
+  .word 0x2c0, 0xe69, 0x8000, 0x8000
+  .word 0x2d0, 0xe69, 0x8000, 0x8000
+  .word 0x2b0, 0xe69, 0xff00ff00, 0xe69
+  .word 0x2c0, 0xe69, 0xff00ff00, 0xe69
+  .word 0x2d0, 0xe69, 0xff00ff00, 0xff00ff00
+  .word 0x2b0, 0xe69, 0xe69, 0xe69
+  .word 0x2c0, 0xe69, 0xe69, 0xe69
+  .word 0x2d0, 0xe69, 0xe69, 0xe69
+  .word 0x2b0, 0x73698785, 0x0, 0x73698785
+  .word 0x2c0, 0x73698785, 0x0, 0x73698785
+  .word 0x2d0, 0x73698785, 0x0, 0x0
+  .word 0x2b0, 0x73698785, 0x10000, 0x73698785
+  .word 0x2c0, 0x73698785, 0x10000, 0x73698785
+  .word 0x2d0, 0x73698785, 0x10000, 0x10000
+  .word 0x2b0, 0x73698785, 0x10080, 0x73698785
+  .word 0x2c0, 0x73698785, 0x10080, 0x73698785
+  .word 0x2d0, 0x73698785, 0x10080, 0x10080
+  .word 0x2b0, 0x73698785, 0x73698785, 0x73698785
+  .word 0x2c0, 0x73698785, 0x73698785, 0x73698785
+  .word 0x2d0, 0x73698785, 0x73698785, 0x73698785
+  .word 0x2b0, 0x1, 0x2, 0x2
+  .word 0x2c0, 0x1, 0x2, 0x2
+  .word 0x2d0, 0x1, 0x2, 0x2
+  .word 0x2b0, 0x1, 0x80000000, 0x1
+  .word 0x2c0, 0x1, 0x80000000, 0x1
+  .word 0x2d0, 0x1, 0x80000000, 0x80000000
+  .word 0x2b0, 0x1, 0x723b417, 0x723b417
+  .word 0x2c0, 0x1, 0x723b417, 0x723b417
+  .word 0x2d0, 0x1, 0x723b417, 0x723b417
+  .word 0x2b0, 0x1, 0x1, 0x1
+  .word 0x2c0, 0x1, 0x1, 0x1
+  .word 0x2d0, 0x1, 0x1, 0x1
+  .word 0x2b0, 0x10, 0x80, 0x80
+  .word 0x2c0, 0x10, 0x80, 0x80
+  .word 0x2d0, 0x10, 0x80, 0x80
+  .word 0x2b0, 0x10, 0xfffffffe, 0x10
+  .word 0x2c0, 0x10, 0xfffffffe, 0x10
+  .word 0x2d0, 0x10, 0xfffffffe, 0xfffffffe
+  .word 0x2b0, 0x10, 0x6c, 0x6c
+  .word 0x2c0, 0x10, 0x6c, 0x6c
+  .word 0x2d0, 0x10, 0x6c, 0x6c
+  .word 0x2b0, 0x10, 0x10, 0x10
+  .word 0x2c0, 0x10, 0x10, 0x10
+  .word 0x2d0, 0x10, 0x10, 0x10
+  .word 0x2b0, 0xd28fd14, 0x100, 0xd28fd14
+  .word 0x2c0, 0xd28fd14, 0x100, 0xd28fd14
+  .word 0x2d0, 0xd28fd14, 0x100, 0x100
+  .word 0x2b0, 0xd28fd14, 0x1000000, 0xd28fd14
+  .word 0x2c0, 0xd28fd14, 0x1000000, 0xd28fd14
+  .word 0x2d0, 0xd28fd14, 0x1000000, 0x1000000
+  .word 0x2b0, 0xd28fd14, 0x215b8, 0xd28fd14
+  .word 0x2c0, 0xd28fd14, 0x215b8, 0xd28fd14
+  .word 0x2d0, 0xd28fd14, 0x215b8, 0x215b8
+  .word 0x2b0, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x2c0, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x2d0, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x2e0, 0x0, 0x12345687, 0x12345687
+  .word 0x2f0, 0x87654321, 0x0, 0x0
+  .word 0x300, 0x0, 0x0, 0x0
+  .word 0x300, 0x0, 0x2, 0x0
+  .word 0x300, 0x0, 0x80, 0x0
+  .word 0x300, 0x0, 0x100, 0x0
+  .word 0x300, 0x0, 0x8000, 0x0
+  .word 0x300, 0x0, 0x10000, 0x0
+  .word 0x300, 0x0, 0x80000000, 0x0
+  .word 0x300, 0x0, 0xfffffffe, 0x0
+  .word 0x300, 0x0, 0x1000000, 0x0
+  .word 0x300, 0x0, 0xff00ff00, 0x0
+  .word 0x300, 0x0, 0x10080, 0x0
+  .word 0x300, 0x0, 0x723b417, 0x0
+  .word 0x300, 0x0, 0x6c, 0x0
+  .word 0x300, 0x0, 0x215b8, 0x0
+  .word 0x300, 0x0, 0xe69, 0x0
+  .word 0x300, 0x0, 0x73698785, 0x0
+  .word 0x300, 0x0, 0x1, 0x0
+  .word 0x300, 0x0, 0x10, 0x0
+  .word 0x300, 0x0, 0xd28fd14, 0x0
+  .word 0x300, 0x2, 0x0, 0x0
+  .word 0x300, 0x2, 0x2, 0x2
+  .word 0x300, 0x2, 0x80, 0x2
+  .word 0x300, 0x2, 0x100, 0x2
+  .word 0x300, 0x2, 0x8000, 0x2
+  .word 0x300, 0x2, 0x10000, 0x2
+  .word 0x300, 0x2, 0x80000000, 0x2
+  .word 0x300, 0x2, 0xfffffffe, 0x2
+  .word 0x300, 0x2, 0x1000000, 0x2
+  .word 0x300, 0x2, 0xff00ff00, 0x2
+  .word 0x300, 0x2, 0x10080, 0x2
+  .word 0x300, 0x2, 0x723b417, 0x2
+  .word 0x300, 0x2, 0x6c, 0x2
+  .word 0x300, 0x2, 0x215b8, 0x2
+  .word 0x300, 0x2, 0xe69, 0x2
+  .word 0x300, 0x2, 0x73698785, 0x2
+  .word 0x300, 0x2, 0x1, 0x1
+  .word 0x300, 0x2, 0x10, 0x2
+  .word 0x300, 0x2, 0xd28fd14, 0x2
+  .word 0x300, 0x80, 0x0, 0x0
+  .word 0x300, 0x80, 0x2, 0x2
+  .word 0x300, 0x80, 0x80, 0x80
+  .word 0x300, 0x80, 0x100, 0x80
+  .word 0x300, 0x80, 0x8000, 0x80
+  .word 0x300, 0x80, 0x10000, 0x80
+  .word 0x300, 0x80, 0x80000000, 0x80
+  .word 0x300, 0x80, 0xfffffffe, 0x80
+  .word 0x300, 0x80, 0x1000000, 0x80
+  .word 0x300, 0x80, 0xff00ff00, 0x80
+  .word 0x300, 0x80, 0x10080, 0x80
+  .word 0x300, 0x80, 0x723b417, 0x80
+  .word 0x300, 0x80, 0x6c, 0x6c
+  .word 0x300, 0x80, 0x215b8, 0x80
+  .word 0x300, 0x80, 0xe69, 0x80
+  .word 0x300, 0x80, 0x73698785, 0x80
+  .word 0x300, 0x80, 0x1, 0x1
+  .word 0x300, 0x80, 0x10, 0x10
+  .word 0x300, 0x80, 0xd28fd14, 0x80
+  .word 0x300, 0x100, 0x0, 0x0
+  .word 0x300, 0x100, 0x2, 0x2
+  .word 0x300, 0x100, 0x80, 0x80
+  .word 0x300, 0x100, 0x100, 0x100
+  .word 0x300, 0x100, 0x8000, 0x100
+  .word 0x300, 0x100, 0x10000, 0x100
+  .word 0x300, 0x100, 0x80000000, 0x100
+  .word 0x300, 0x100, 0xfffffffe, 0x100
+  .word 0x300, 0x100, 0x1000000, 0x100
+  .word 0x300, 0x100, 0xff00ff00, 0x100
+  .word 0x300, 0x100, 0x10080, 0x100
+  .word 0x300, 0x100, 0x723b417, 0x100
+  .word 0x300, 0x100, 0x6c, 0x6c
+  .word 0x300, 0x100, 0x215b8, 0x100
+  .word 0x300, 0x100, 0xe69, 0x100
+  .word 0x300, 0x100, 0x73698785, 0x100
+  .word 0x300, 0x100, 0x1, 0x1
+  .word 0x300, 0x100, 0x10, 0x10
+  .word 0x300, 0x100, 0xd28fd14, 0x100
+  .word 0x300, 0x8000, 0x0, 0x0
+  .word 0x300, 0x8000, 0x2, 0x2
+  .word 0x300, 0x8000, 0x80, 0x80
+  .word 0x300, 0x8000, 0x100, 0x100
+  .word 0x300, 0x8000, 0x8000, 0x8000
+  .word 0x300, 0x8000, 0x10000, 0x8000
+  .word 0x300, 0x8000, 0x80000000, 0x8000
+  .word 0x300, 0x8000, 0xfffffffe, 0x8000
+  .word 0x300, 0x8000, 0x1000000, 0x8000
+  .word 0x300, 0x8000, 0xff00ff00, 0x8000
+  .word 0x300, 0x8000, 0x10080, 0x8000
+  .word 0x300, 0x8000, 0x723b417, 0x8000
+  .word 0x300, 0x8000, 0x6c, 0x6c
+  .word 0x300, 0x8000, 0x215b8, 0x8000
+  .word 0x300, 0x8000, 0xe69, 0xe69
+  .word 0x300, 0x8000, 0x73698785, 0x8000
+  .word 0x300, 0x8000, 0x1, 0x1
+  .word 0x300, 0x8000, 0x10, 0x10
+  .word 0x300, 0x8000, 0xd28fd14, 0x8000
+  .word 0x300, 0x10000, 0x0, 0x0
+  .word 0x300, 0x10000, 0x2, 0x2
+  .word 0x300, 0x10000, 0x80, 0x80
+  .word 0x300, 0x10000, 0x100, 0x100
+  .word 0x300, 0x10000, 0x8000, 0x8000
+  .word 0x300, 0x10000, 0x10000, 0x10000
+  .word 0x300, 0x10000, 0x80000000, 0x10000
+  .word 0x300, 0x10000, 0xfffffffe, 0x10000
+  .word 0x300, 0x10000, 0x1000000, 0x10000
+  .word 0x300, 0x10000, 0xff00ff00, 0x10000
+  .word 0x300, 0x10000, 0x10080, 0x10000
+  .word 0x300, 0x10000, 0x723b417, 0x10000
+  .word 0x300, 0x10000, 0x6c, 0x6c
+  .word 0x300, 0x10000, 0x215b8, 0x10000
+  .word 0x300, 0x10000, 0xe69, 0xe69
+  .word 0x300, 0x10000, 0x73698785, 0x10000
+  .word 0x300, 0x10000, 0x1, 0x1
+  .word 0x300, 0x10000, 0x10, 0x10
+  .word 0x300, 0x10000, 0xd28fd14, 0x10000
+  .word 0x300, 0x80000000, 0x0, 0x0
+  .word 0x300, 0x80000000, 0x2, 0x2
+  .word 0x300, 0x80000000, 0x80, 0x80
+  .word 0x300, 0x80000000, 0x100, 0x100
+  .word 0x300, 0x80000000, 0x8000, 0x8000
+  .word 0x300, 0x80000000, 0x10000, 0x10000
+  .word 0x300, 0x80000000, 0x80000000, 0x80000000
+  .word 0x300, 0x80000000, 0xfffffffe, 0x80000000
+  .word 0x300, 0x80000000, 0x1000000, 0x1000000
+  .word 0x300, 0x80000000, 0xff00ff00, 0x80000000
+  .word 0x300, 0x80000000, 0x10080, 0x10080
+  .word 0x300, 0x80000000, 0x723b417, 0x723b417
+  .word 0x300, 0x80000000, 0x6c, 0x6c
+  .word 0x300, 0x80000000, 0x215b8, 0x215b8
+  .word 0x300, 0x80000000, 0xe69, 0xe69
+  .word 0x300, 0x80000000, 0x73698785, 0x73698785
+  .word 0x300, 0x80000000, 0x1, 0x1
+  .word 0x300, 0x80000000, 0x10, 0x10
+  .word 0x300, 0x80000000, 0xd28fd14, 0xd28fd14
+  .word 0x300, 0xfffffffe, 0x0, 0x0
+  .word 0x300, 0xfffffffe, 0x2, 0x2
+  .word 0x300, 0xfffffffe, 0x80, 0x80
+  .word 0x300, 0xfffffffe, 0x100, 0x100
+  .word 0x300, 0xfffffffe, 0x8000, 0x8000
+  .word 0x300, 0xfffffffe, 0x10000, 0x10000
+  .word 0x300, 0xfffffffe, 0x80000000, 0x80000000
+  .word 0x300, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x300, 0xfffffffe, 0x1000000, 0x1000000
+  .word 0x300, 0xfffffffe, 0xff00ff00, 0xff00ff00
+  .word 0x300, 0xfffffffe, 0x10080, 0x10080
+  .word 0x300, 0xfffffffe, 0x723b417, 0x723b417
+  .word 0x300, 0xfffffffe, 0x6c, 0x6c
+  .word 0x300, 0xfffffffe, 0x215b8, 0x215b8
+  .word 0x300, 0xfffffffe, 0xe69, 0xe69
+  .word 0x300, 0xfffffffe, 0x73698785, 0x73698785
+  .word 0x300, 0xfffffffe, 0x1, 0x1
+  .word 0x300, 0xfffffffe, 0x10, 0x10
+  .word 0x300, 0xfffffffe, 0xd28fd14, 0xd28fd14
+  .word 0x300, 0x1000000, 0x0, 0x0
+  .word 0x300, 0x1000000, 0x2, 0x2
+  .word 0x300, 0x1000000, 0x80, 0x80
+  .word 0x300, 0x1000000, 0x100, 0x100
+  .word 0x300, 0x1000000, 0x8000, 0x8000
+  .word 0x300, 0x1000000, 0x10000, 0x10000
+  .word 0x300, 0x1000000, 0x80000000, 0x1000000
+  .word 0x300, 0x1000000, 0xfffffffe, 0x1000000
+  .word 0x300, 0x1000000, 0x1000000, 0x1000000
+  .word 0x300, 0x1000000, 0xff00ff00, 0x1000000
+  .word 0x300, 0x1000000, 0x10080, 0x10080
+  .word 0x300, 0x1000000, 0x723b417, 0x1000000
+  .word 0x300, 0x1000000, 0x6c, 0x6c
+  .word 0x300, 0x1000000, 0x215b8, 0x215b8
+  .word 0x300, 0x1000000, 0xe69, 0xe69
+  .word 0x300, 0x1000000, 0x73698785, 0x1000000
+  .word 0x300, 0x1000000, 0x1, 0x1
+  .word 0x300, 0x1000000, 0x10, 0x10
+  .word 0x300, 0x1000000, 0xd28fd14, 0x1000000
+  .word 0x300, 0xff00ff00, 0x0, 0x0
+  .word 0x300, 0xff00ff00, 0x2, 0x2
+  .word 0x300, 0xff00ff00, 0x80, 0x80
+  .word 0x300, 0xff00ff00, 0x100, 0x100
+  .word 0x300, 0xff00ff00, 0x8000, 0x8000
+  .word 0x300, 0xff00ff00, 0x10000, 0x10000
+  .word 0x300, 0xff00ff00, 0x80000000, 0x80000000
+  .word 0x300, 0xff00ff00, 0xfffffffe, 0xff00ff00
+  .word 0x300, 0xff00ff00, 0x1000000, 0x1000000
+  .word 0x300, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x300, 0xff00ff00, 0x10080, 0x10080
+  .word 0x300, 0xff00ff00, 0x723b417, 0x723b417
+  .word 0x300, 0xff00ff00, 0x6c, 0x6c
+  .word 0x300, 0xff00ff00, 0x215b8, 0x215b8
+  .word 0x300, 0xff00ff00, 0xe69, 0xe69
+  .word 0x300, 0xff00ff00, 0x73698785, 0x73698785
+  .word 0x300, 0xff00ff00, 0x1, 0x1
+  .word 0x300, 0xff00ff00, 0x10, 0x10
+  .word 0x300, 0xff00ff00, 0xd28fd14, 0xd28fd14
+  .word 0x300, 0x10080, 0x0, 0x0
+  .word 0x300, 0x10080, 0x2, 0x2
+  .word 0x300, 0x10080, 0x80, 0x80
+  .word 0x300, 0x10080, 0x100, 0x100
+  .word 0x300, 0x10080, 0x8000, 0x8000
+  .word 0x300, 0x10080, 0x10000, 0x10000
+  .word 0x300, 0x10080, 0x80000000, 0x10080
+  .word 0x300, 0x10080, 0xfffffffe, 0x10080
+  .word 0x300, 0x10080, 0x1000000, 0x10080
+  .word 0x300, 0x10080, 0xff00ff00, 0x10080
+  .word 0x300, 0x10080, 0x10080, 0x10080
+  .word 0x300, 0x10080, 0x723b417, 0x10080
+  .word 0x300, 0x10080, 0x6c, 0x6c
+  .word 0x300, 0x10080, 0x215b8, 0x10080
+  .word 0x300, 0x10080, 0xe69, 0xe69
+  .word 0x300, 0x10080, 0x73698785, 0x10080
+  .word 0x300, 0x10080, 0x1, 0x1
+  .word 0x300, 0x10080, 0x10, 0x10
+  .word 0x300, 0x10080, 0xd28fd14, 0x10080
+  .word 0x300, 0x723b417, 0x0, 0x0
+  .word 0x300, 0x723b417, 0x2, 0x2
+  .word 0x300, 0x723b417, 0x80, 0x80
+  .word 0x300, 0x723b417, 0x100, 0x100
+  .word 0x300, 0x723b417, 0x8000, 0x8000
+  .word 0x300, 0x723b417, 0x10000, 0x10000
+  .word 0x300, 0x723b417, 0x80000000, 0x723b417
+  .word 0x300, 0x723b417, 0xfffffffe, 0x723b417
+  .word 0x300, 0x723b417, 0x1000000, 0x1000000
+  .word 0x300, 0x723b417, 0xff00ff00, 0x723b417
+  .word 0x300, 0x723b417, 0x10080, 0x10080
+  .word 0x300, 0x723b417, 0x723b417, 0x723b417
+  .word 0x300, 0x723b417, 0x6c, 0x6c
+  .word 0x300, 0x723b417, 0x215b8, 0x215b8
+  .word 0x300, 0x723b417, 0xe69, 0xe69
+  .word 0x300, 0x723b417, 0x73698785, 0x723b417
+  .word 0x300, 0x723b417, 0x1, 0x1
+  .word 0x300, 0x723b417, 0x10, 0x10
+  .word 0x300, 0x723b417, 0xd28fd14, 0x723b417
+  .word 0x300, 0x6c, 0x0, 0x0
+  .word 0x300, 0x6c, 0x2, 0x2
+  .word 0x300, 0x6c, 0x80, 0x6c
+  .word 0x300, 0x6c, 0x100, 0x6c
+  .word 0x300, 0x6c, 0x8000, 0x6c
+  .word 0x300, 0x6c, 0x10000, 0x6c
+  .word 0x300, 0x6c, 0x80000000, 0x6c
+  .word 0x300, 0x6c, 0xfffffffe, 0x6c
+  .word 0x300, 0x6c, 0x1000000, 0x6c
+  .word 0x300, 0x6c, 0xff00ff00, 0x6c
+  .word 0x300, 0x6c, 0x10080, 0x6c
+  .word 0x300, 0x6c, 0x723b417, 0x6c
+  .word 0x300, 0x6c, 0x6c, 0x6c
+  .word 0x300, 0x6c, 0x215b8, 0x6c
+  .word 0x300, 0x6c, 0xe69, 0x6c
+  .word 0x300, 0x6c, 0x73698785, 0x6c
+  .word 0x300, 0x6c, 0x1, 0x1
+  .word 0x300, 0x6c, 0x10, 0x10
+  .word 0x300, 0x6c, 0xd28fd14, 0x6c
+  .word 0x300, 0x215b8, 0x0, 0x0
+  .word 0x300, 0x215b8, 0x2, 0x2
+  .word 0x300, 0x215b8, 0x80, 0x80
+  .word 0x300, 0x215b8, 0x100, 0x100
+  .word 0x300, 0x215b8, 0x8000, 0x8000
+  .word 0x300, 0x215b8, 0x10000, 0x10000
+  .word 0x300, 0x215b8, 0x80000000, 0x215b8
+  .word 0x300, 0x215b8, 0xfffffffe, 0x215b8
+  .word 0x300, 0x215b8, 0x1000000, 0x215b8
+  .word 0x300, 0x215b8, 0xff00ff00, 0x215b8
+  .word 0x300, 0x215b8, 0x10080, 0x10080
+  .word 0x300, 0x215b8, 0x723b417, 0x215b8
+  .word 0x300, 0x215b8, 0x6c, 0x6c
+  .word 0x300, 0x215b8, 0x215b8, 0x215b8
+  .word 0x300, 0x215b8, 0xe69, 0xe69
+  .word 0x300, 0x215b8, 0x73698785, 0x215b8
+  .word 0x300, 0x215b8, 0x1, 0x1
+  .word 0x300, 0x215b8, 0x10, 0x10
+  .word 0x300, 0x215b8, 0xd28fd14, 0x215b8
+  .word 0x300, 0xe69, 0x0, 0x0
+  .word 0x300, 0xe69, 0x2, 0x2
+  .word 0x300, 0xe69, 0x80, 0x80
+  .word 0x300, 0xe69, 0x100, 0x100
+  .word 0x300, 0xe69, 0x8000, 0xe69
+  .word 0x300, 0xe69, 0x10000, 0xe69
+  .word 0x300, 0xe69, 0x80000000, 0xe69
+  .word 0x300, 0xe69, 0xfffffffe, 0xe69
+  .word 0x300, 0xe69, 0x1000000, 0xe69
+  .word 0x300, 0xe69, 0xff00ff00, 0xe69
+  .word 0x300, 0xe69, 0x10080, 0xe69
+  .word 0x300, 0xe69, 0x723b417, 0xe69
+  .word 0x300, 0xe69, 0x6c, 0x6c
+  .word 0x300, 0xe69, 0x215b8, 0xe69
+  .word 0x300, 0xe69, 0xe69, 0xe69
+  .word 0x300, 0xe69, 0x73698785, 0xe69
+  .word 0x300, 0xe69, 0x1, 0x1
+  .word 0x300, 0xe69, 0x10, 0x10
+  .word 0x300, 0xe69, 0xd28fd14, 0xe69
+  .word 0x300, 0x73698785, 0x0, 0x0
+  .word 0x300, 0x73698785, 0x2, 0x2
+  .word 0x300, 0x73698785, 0x80, 0x80
+  .word 0x300, 0x73698785, 0x100, 0x100
+  .word 0x300, 0x73698785, 0x8000, 0x8000
+  .word 0x300, 0x73698785, 0x10000, 0x10000
+  .word 0x300, 0x73698785, 0x80000000, 0x73698785
+  .word 0x300, 0x73698785, 0xfffffffe, 0x73698785
+  .word 0x300, 0x73698785, 0x1000000, 0x1000000
+  .word 0x300, 0x73698785, 0xff00ff00, 0x73698785
+  .word 0x300, 0x73698785, 0x10080, 0x10080
+  .word 0x300, 0x73698785, 0x723b417, 0x723b417
+  .word 0x300, 0x73698785, 0x6c, 0x6c
+  .word 0x300, 0x73698785, 0x215b8, 0x215b8
+  .word 0x300, 0x73698785, 0xe69, 0xe69
+  .word 0x300, 0x73698785, 0x73698785, 0x73698785
+  .word 0x300, 0x73698785, 0x1, 0x1
+  .word 0x300, 0x73698785, 0x10, 0x10
+  .word 0x300, 0x73698785, 0xd28fd14, 0xd28fd14
+  .word 0x300, 0x1, 0x0, 0x0
+  .word 0x300, 0x1, 0x2, 0x1
+  .word 0x300, 0x1, 0x80, 0x1
+  .word 0x300, 0x1, 0x100, 0x1
+  .word 0x300, 0x1, 0x8000, 0x1
+  .word 0x300, 0x1, 0x10000, 0x1
+  .word 0x300, 0x1, 0x80000000, 0x1
+  .word 0x300, 0x1, 0xfffffffe, 0x1
+  .word 0x300, 0x1, 0x1000000, 0x1
+  .word 0x300, 0x1, 0xff00ff00, 0x1
+  .word 0x300, 0x1, 0x10080, 0x1
+  .word 0x300, 0x1, 0x723b417, 0x1
+  .word 0x300, 0x1, 0x6c, 0x1
+  .word 0x300, 0x1, 0x215b8, 0x1
+  .word 0x300, 0x1, 0xe69, 0x1
+  .word 0x300, 0x1, 0x73698785, 0x1
+  .word 0x300, 0x1, 0x1, 0x1
+  .word 0x300, 0x1, 0x10, 0x1
+  .word 0x300, 0x1, 0xd28fd14, 0x1
+  .word 0x300, 0x10, 0x0, 0x0
+  .word 0x300, 0x10, 0x2, 0x2
+  .word 0x300, 0x10, 0x80, 0x10
+  .word 0x300, 0x10, 0x100, 0x10
+  .word 0x300, 0x10, 0x8000, 0x10
+  .word 0x300, 0x10, 0x10000, 0x10
+  .word 0x300, 0x10, 0x80000000, 0x10
+  .word 0x300, 0x10, 0xfffffffe, 0x10
+  .word 0x300, 0x10, 0x1000000, 0x10
+  .word 0x300, 0x10, 0xff00ff00, 0x10
+  .word 0x300, 0x10, 0x10080, 0x10
+  .word 0x300, 0x10, 0x723b417, 0x10
+  .word 0x300, 0x10, 0x6c, 0x10
+  .word 0x300, 0x10, 0x215b8, 0x10
+  .word 0x300, 0x10, 0xe69, 0x10
+  .word 0x300, 0x10, 0x73698785, 0x10
+  .word 0x300, 0x10, 0x1, 0x1
+  .word 0x300, 0x10, 0x10, 0x10
+  .word 0x300, 0x10, 0xd28fd14, 0x10
+  .word 0x300, 0xd28fd14, 0x0, 0x0
+  .word 0x300, 0xd28fd14, 0x2, 0x2
+  .word 0x300, 0xd28fd14, 0x80, 0x80
+  .word 0x300, 0xd28fd14, 0x100, 0x100
+  .word 0x300, 0xd28fd14, 0x8000, 0x8000
+  .word 0x300, 0xd28fd14, 0x10000, 0x10000
+  .word 0x300, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x300, 0xd28fd14, 0xfffffffe, 0xd28fd14
+  .word 0x300, 0xd28fd14, 0x1000000, 0x1000000
+  .word 0x300, 0xd28fd14, 0xff00ff00, 0xd28fd14
+  .word 0x300, 0xd28fd14, 0x10080, 0x10080
+  .word 0x300, 0xd28fd14, 0x723b417, 0x723b417
+  .word 0x300, 0xd28fd14, 0x6c, 0x6c
+  .word 0x300, 0xd28fd14, 0x215b8, 0x215b8
+  .word 0x300, 0xd28fd14, 0xe69, 0xe69
+  .word 0x300, 0xd28fd14, 0x73698785, 0xd28fd14
+  .word 0x300, 0xd28fd14, 0x1, 0x1
+  .word 0x300, 0xd28fd14, 0x10, 0x10
+  .word 0x300, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x310, 0x0, 0x0, 0x0
+  .word 0x320, 0x0, 0x0, 0x0
+  .word 0x330, 0x0, 0x0, 0x0
+  .word 0x310, 0x0, 0x10000, 0x0
+  .word 0x320, 0x0, 0x10000, 0x0
+  .word 0x330, 0x0, 0x10000, 0x10000
+  .word 0x310, 0x0, 0x10080, 0x0
+  .word 0x320, 0x0, 0x10080, 0x0
+  .word 0x330, 0x0, 0x10080, 0x10080
+  .word 0x310, 0x0, 0x73698785, 0x0
+  .word 0x320, 0x0, 0x73698785, 0x0
+  .word 0x330, 0x0, 0x73698785, 0x73698785
+  .word 0x310, 0x2, 0x2, 0x2
+  .word 0x320, 0x2, 0x2, 0x2
+  .word 0x330, 0x2, 0x2, 0x2
+  .word 0x310, 0x2, 0x80000000, 0x2
+  .word 0x320, 0x2, 0x80000000, 0x2
+  .word 0x330, 0x2, 0x80000000, 0x80000000
+  .word 0x310, 0x2, 0x723b417, 0x2
+  .word 0x320, 0x2, 0x723b417, 0x2
+  .word 0x330, 0x2, 0x723b417, 0x723b417
+  .word 0x310, 0x2, 0x1, 0x1
+  .word 0x320, 0x2, 0x1, 0x1
+  .word 0x330, 0x2, 0x1, 0x1
+  .word 0x310, 0x80, 0x80, 0x80
+  .word 0x320, 0x80, 0x80, 0x80
+  .word 0x330, 0x80, 0x80, 0x80
+  .word 0x310, 0x80, 0xfffffffe, 0x80
+  .word 0x320, 0x80, 0xfffffffe, 0x80
+  .word 0x330, 0x80, 0xfffffffe, 0xfffffffe
+  .word 0x310, 0x80, 0x6c, 0x6c
+  .word 0x320, 0x80, 0x6c, 0x6c
+  .word 0x330, 0x80, 0x6c, 0x6c
+  .word 0x310, 0x80, 0x10, 0x10
+  .word 0x320, 0x80, 0x10, 0x10
+  .word 0x330, 0x80, 0x10, 0x10
+  .word 0x310, 0x100, 0x100, 0x100
+  .word 0x320, 0x100, 0x100, 0x100
+  .word 0x330, 0x100, 0x100, 0x100
+  .word 0x310, 0x100, 0x1000000, 0x100
+  .word 0x320, 0x100, 0x1000000, 0x100
+  .word 0x330, 0x100, 0x1000000, 0x1000000
+  .word 0x310, 0x100, 0x215b8, 0x100
+  .word 0x320, 0x100, 0x215b8, 0x100
+  .word 0x330, 0x100, 0x215b8, 0x215b8
+  .word 0x310, 0x100, 0xd28fd14, 0x100
+  .word 0x320, 0x100, 0xd28fd14, 0x100
+  .word 0x330, 0x100, 0xd28fd14, 0xd28fd14
+  .word 0x310, 0x8000, 0x8000, 0x8000
+  .word 0x320, 0x8000, 0x8000, 0x8000
+  .word 0x330, 0x8000, 0x8000, 0x8000
+  .word 0x310, 0x8000, 0xff00ff00, 0x8000
+  .word 0x320, 0x8000, 0xff00ff00, 0x8000
+  .word 0x330, 0x8000, 0xff00ff00, 0xff00ff00
+  .word 0x310, 0x8000, 0xe69, 0xe69
+  .word 0x320, 0x8000, 0xe69, 0xe69
+  .word 0x330, 0x8000, 0xe69, 0xe69
+  .word 0x310, 0x10000, 0x0, 0x0
+  .word 0x320, 0x10000, 0x0, 0x0
+  .word 0x330, 0x10000, 0x0, 0x0
+  .word 0x310, 0x10000, 0x10000, 0x10000
+  .word 0x320, 0x10000, 0x10000, 0x10000
+  .word 0x330, 0x10000, 0x10000, 0x10000
+  .word 0x310, 0x10000, 0x10080, 0x10000
+  .word 0x320, 0x10000, 0x10080, 0x10000
+  .word 0x330, 0x10000, 0x10080, 0x10080
+  .word 0x310, 0x10000, 0x73698785, 0x10000
+  .word 0x320, 0x10000, 0x73698785, 0x10000
+  .word 0x330, 0x10000, 0x73698785, 0x73698785
+  .word 0x310, 0x80000000, 0x2, 0x2
+  .word 0x320, 0x80000000, 0x2, 0x2
+  .word 0x330, 0x80000000, 0x2, 0x2
+  .word 0x310, 0x80000000, 0x80000000, 0x80000000
+  .word 0x320, 0x80000000, 0x80000000, 0x80000000
+  .word 0x330, 0x80000000, 0x80000000, 0x80000000
+  .word 0x310, 0x80000000, 0x723b417, 0x723b417
+  .word 0x320, 0x80000000, 0x723b417, 0x723b417
+  .word 0x330, 0x80000000, 0x723b417, 0x723b417
+  .word 0x310, 0x80000000, 0x1, 0x1
+  .word 0x320, 0x80000000, 0x1, 0x1
+  .word 0x330, 0x80000000, 0x1, 0x1
+  .word 0x310, 0xfffffffe, 0x80, 0x80
+  .word 0x320, 0xfffffffe, 0x80, 0x80
+  .word 0x330, 0xfffffffe, 0x80, 0x80
+  .word 0x310, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x320, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x330, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x310, 0xfffffffe, 0x6c, 0x6c
+  .word 0x320, 0xfffffffe, 0x6c, 0x6c
+  .word 0x330, 0xfffffffe, 0x6c, 0x6c
+  .word 0x310, 0xfffffffe, 0x10, 0x10
+  .word 0x320, 0xfffffffe, 0x10, 0x10
+  .word 0x330, 0xfffffffe, 0x10, 0x10
+  .word 0x310, 0x1000000, 0x100, 0x100
+  .word 0x320, 0x1000000, 0x100, 0x100
+  .word 0x330, 0x1000000, 0x100, 0x100
+  .word 0x310, 0x1000000, 0x1000000, 0x1000000
+  .word 0x320, 0x1000000, 0x1000000, 0x1000000
+  .word 0x330, 0x1000000, 0x1000000, 0x1000000
+  .word 0x310, 0x1000000, 0x215b8, 0x215b8
+  .word 0x320, 0x1000000, 0x215b8, 0x215b8
+  .word 0x330, 0x1000000, 0x215b8, 0x215b8
+  .word 0x310, 0x1000000, 0xd28fd14, 0x1000000
+  .word 0x320, 0x1000000, 0xd28fd14, 0x1000000
+  .word 0x330, 0x1000000, 0xd28fd14, 0xd28fd14
+  .word 0x310, 0xff00ff00, 0x8000, 0x8000
+  .word 0x320, 0xff00ff00, 0x8000, 0x8000
+  .word 0x330, 0xff00ff00, 0x8000, 0x8000
+  .word 0x310, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x320, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x330, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x310, 0xff00ff00, 0xe69, 0xe69
+  .word 0x320, 0xff00ff00, 0xe69, 0xe69
+  .word 0x330, 0xff00ff00, 0xe69, 0xe69
+  .word 0x310, 0x10080, 0x0, 0x0
+  .word 0x320, 0x10080, 0x0, 0x0
+  .word 0x330, 0x10080, 0x0, 0x0
+  .word 0x310, 0x10080, 0x10000, 0x10000
+  .word 0x320, 0x10080, 0x10000, 0x10000
+  .word 0x330, 0x10080, 0x10000, 0x10000
+  .word 0x310, 0x10080, 0x10080, 0x10080
+  .word 0x320, 0x10080, 0x10080, 0x10080
+  .word 0x330, 0x10080, 0x10080, 0x10080
+  .word 0x310, 0x10080, 0x73698785, 0x10080
+  .word 0x320, 0x10080, 0x73698785, 0x10080
+  .word 0x330, 0x10080, 0x73698785, 0x73698785
+  .word 0x310, 0x723b417, 0x2, 0x2
+  .word 0x320, 0x723b417, 0x2, 0x2
+  .word 0x330, 0x723b417, 0x2, 0x2
+  .word 0x310, 0x723b417, 0x80000000, 0x723b417
+  .word 0x320, 0x723b417, 0x80000000, 0x723b417
+  .word 0x330, 0x723b417, 0x80000000, 0x80000000
+  .word 0x310, 0x723b417, 0x723b417, 0x723b417
+  .word 0x320, 0x723b417, 0x723b417, 0x723b417
+  .word 0x330, 0x723b417, 0x723b417, 0x723b417
+  .word 0x310, 0x723b417, 0x1, 0x1
+  .word 0x320, 0x723b417, 0x1, 0x1
+  .word 0x330, 0x723b417, 0x1, 0x1
+  .word 0x310, 0x6c, 0x80, 0x6c
+  .word 0x320, 0x6c, 0x80, 0x6c
+  .word 0x330, 0x6c, 0x80, 0x80
+  .word 0x310, 0x6c, 0xfffffffe, 0x6c
+  .word 0x320, 0x6c, 0xfffffffe, 0x6c
+  .word 0x330, 0x6c, 0xfffffffe, 0xfffffffe
+  .word 0x310, 0x6c, 0x6c, 0x6c
+  .word 0x320, 0x6c, 0x6c, 0x6c
+  .word 0x330, 0x6c, 0x6c, 0x6c
+  .word 0x310, 0x6c, 0x10, 0x10
+  .word 0x320, 0x6c, 0x10, 0x10
+  .word 0x330, 0x6c, 0x10, 0x10
+  .word 0x310, 0x215b8, 0x100, 0x100
+  .word 0x320, 0x215b8, 0x100, 0x100
+  .word 0x330, 0x215b8, 0x100, 0x100
+  .word 0x310, 0x215b8, 0x1000000, 0x215b8
+  .word 0x320, 0x215b8, 0x1000000, 0x215b8
+  .word 0x330, 0x215b8, 0x1000000, 0x1000000
+  .word 0x310, 0x215b8, 0x215b8, 0x215b8
+  .word 0x320, 0x215b8, 0x215b8, 0x215b8
+  .word 0x330, 0x215b8, 0x215b8, 0x215b8
+  .word 0x310, 0x215b8, 0xd28fd14, 0x215b8
+  .word 0x320, 0x215b8, 0xd28fd14, 0x215b8
+  .word 0x330, 0x215b8, 0xd28fd14, 0xd28fd14
+  .word 0x310, 0xe69, 0x8000, 0xe69
+  .word 0x320, 0xe69, 0x8000, 0xe69
+  .word 0x330, 0xe69, 0x8000, 0x8000
+  .word 0x310, 0xe69, 0xff00ff00, 0xe69
+  .word 0x320, 0xe69, 0xff00ff00, 0xe69
+  .word 0x330, 0xe69, 0xff00ff00, 0xff00ff00
+  .word 0x310, 0xe69, 0xe69, 0xe69
+  .word 0x320, 0xe69, 0xe69, 0xe69
+  .word 0x330, 0xe69, 0xe69, 0xe69
+  .word 0x310, 0x73698785, 0x0, 0x0
+  .word 0x320, 0x73698785, 0x0, 0x0
+  .word 0x330, 0x73698785, 0x0, 0x0
+  .word 0x310, 0x73698785, 0x10000, 0x10000
+  .word 0x320, 0x73698785, 0x10000, 0x10000
+  .word 0x330, 0x73698785, 0x10000, 0x10000
+  .word 0x310, 0x73698785, 0x10080, 0x10080
+  .word 0x320, 0x73698785, 0x10080, 0x10080
+  .word 0x330, 0x73698785, 0x10080, 0x10080
+  .word 0x310, 0x73698785, 0x73698785, 0x73698785
+  .word 0x320, 0x73698785, 0x73698785, 0x73698785
+  .word 0x330, 0x73698785, 0x73698785, 0x73698785
+  .word 0x310, 0x1, 0x2, 0x1
+  .word 0x320, 0x1, 0x2, 0x1
+  .word 0x330, 0x1, 0x2, 0x2
+  .word 0x310, 0x1, 0x80000000, 0x1
+  .word 0x320, 0x1, 0x80000000, 0x1
+  .word 0x330, 0x1, 0x80000000, 0x80000000
+  .word 0x310, 0x1, 0x723b417, 0x1
+  .word 0x320, 0x1, 0x723b417, 0x1
+  .word 0x330, 0x1, 0x723b417, 0x723b417
+  .word 0x310, 0x1, 0x1, 0x1
+  .word 0x320, 0x1, 0x1, 0x1
+  .word 0x330, 0x1, 0x1, 0x1
+  .word 0x310, 0x10, 0x80, 0x10
+  .word 0x320, 0x10, 0x80, 0x10
+  .word 0x330, 0x10, 0x80, 0x80
+  .word 0x310, 0x10, 0xfffffffe, 0x10
+  .word 0x320, 0x10, 0xfffffffe, 0x10
+  .word 0x330, 0x10, 0xfffffffe, 0xfffffffe
+  .word 0x310, 0x10, 0x6c, 0x10
+  .word 0x320, 0x10, 0x6c, 0x10
+  .word 0x330, 0x10, 0x6c, 0x6c
+  .word 0x310, 0x10, 0x10, 0x10
+  .word 0x320, 0x10, 0x10, 0x10
+  .word 0x330, 0x10, 0x10, 0x10
+  .word 0x310, 0xd28fd14, 0x100, 0x100
+  .word 0x320, 0xd28fd14, 0x100, 0x100
+  .word 0x330, 0xd28fd14, 0x100, 0x100
+  .word 0x310, 0xd28fd14, 0x1000000, 0x1000000
+  .word 0x320, 0xd28fd14, 0x1000000, 0x1000000
+  .word 0x330, 0xd28fd14, 0x1000000, 0x1000000
+  .word 0x310, 0xd28fd14, 0x215b8, 0x215b8
+  .word 0x320, 0xd28fd14, 0x215b8, 0x215b8
+  .word 0x330, 0xd28fd14, 0x215b8, 0x215b8
+  .word 0x310, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x320, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x330, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x340, 0x0, 0x12345687, 0x0
+  .word 0x350, 0x87654321, 0x0, 0x0
+  .word 0x360, 0x0, 0x0, 0x0
+  .word 0x360, 0x0, 0x2, 0x2
+  .word 0x360, 0x0, 0x80, 0x80
+  .word 0x360, 0x0, 0x100, 0x100
+  .word 0x360, 0x0, 0x8000, 0x8000
+  .word 0x360, 0x0, 0x10000, 0x10000
+  .word 0x360, 0x0, 0x80000000, 0x80000000
+  .word 0x360, 0x0, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x0, 0x1000000, 0x1000000
+  .word 0x360, 0x0, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x0, 0x10080, 0x10080
+  .word 0x360, 0x0, 0x723b417, 0x723b417
+  .word 0x360, 0x0, 0x6c, 0x6c
+  .word 0x360, 0x0, 0x215b8, 0x215b8
+  .word 0x360, 0x0, 0xe69, 0xe69
+  .word 0x360, 0x0, 0x73698785, 0x73698785
+  .word 0x360, 0x0, 0x1, 0x1
+  .word 0x360, 0x0, 0x10, 0x10
+  .word 0x360, 0x0, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0x2, 0x0, 0x2
+  .word 0x360, 0x2, 0x2, 0x2
+  .word 0x360, 0x2, 0x80, 0x80
+  .word 0x360, 0x2, 0x100, 0x100
+  .word 0x360, 0x2, 0x8000, 0x8000
+  .word 0x360, 0x2, 0x10000, 0x10000
+  .word 0x360, 0x2, 0x80000000, 0x80000000
+  .word 0x360, 0x2, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x2, 0x1000000, 0x1000000
+  .word 0x360, 0x2, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x2, 0x10080, 0x10080
+  .word 0x360, 0x2, 0x723b417, 0x723b417
+  .word 0x360, 0x2, 0x6c, 0x6c
+  .word 0x360, 0x2, 0x215b8, 0x215b8
+  .word 0x360, 0x2, 0xe69, 0xe69
+  .word 0x360, 0x2, 0x73698785, 0x73698785
+  .word 0x360, 0x2, 0x1, 0x2
+  .word 0x360, 0x2, 0x10, 0x10
+  .word 0x360, 0x2, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0x80, 0x0, 0x80
+  .word 0x360, 0x80, 0x2, 0x80
+  .word 0x360, 0x80, 0x80, 0x80
+  .word 0x360, 0x80, 0x100, 0x100
+  .word 0x360, 0x80, 0x8000, 0x8000
+  .word 0x360, 0x80, 0x10000, 0x10000
+  .word 0x360, 0x80, 0x80000000, 0x80000000
+  .word 0x360, 0x80, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x80, 0x1000000, 0x1000000
+  .word 0x360, 0x80, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x80, 0x10080, 0x10080
+  .word 0x360, 0x80, 0x723b417, 0x723b417
+  .word 0x360, 0x80, 0x6c, 0x80
+  .word 0x360, 0x80, 0x215b8, 0x215b8
+  .word 0x360, 0x80, 0xe69, 0xe69
+  .word 0x360, 0x80, 0x73698785, 0x73698785
+  .word 0x360, 0x80, 0x1, 0x80
+  .word 0x360, 0x80, 0x10, 0x80
+  .word 0x360, 0x80, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0x100, 0x0, 0x100
+  .word 0x360, 0x100, 0x2, 0x100
+  .word 0x360, 0x100, 0x80, 0x100
+  .word 0x360, 0x100, 0x100, 0x100
+  .word 0x360, 0x100, 0x8000, 0x8000
+  .word 0x360, 0x100, 0x10000, 0x10000
+  .word 0x360, 0x100, 0x80000000, 0x80000000
+  .word 0x360, 0x100, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x100, 0x1000000, 0x1000000
+  .word 0x360, 0x100, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x100, 0x10080, 0x10080
+  .word 0x360, 0x100, 0x723b417, 0x723b417
+  .word 0x360, 0x100, 0x6c, 0x100
+  .word 0x360, 0x100, 0x215b8, 0x215b8
+  .word 0x360, 0x100, 0xe69, 0xe69
+  .word 0x360, 0x100, 0x73698785, 0x73698785
+  .word 0x360, 0x100, 0x1, 0x100
+  .word 0x360, 0x100, 0x10, 0x100
+  .word 0x360, 0x100, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0x8000, 0x0, 0x8000
+  .word 0x360, 0x8000, 0x2, 0x8000
+  .word 0x360, 0x8000, 0x80, 0x8000
+  .word 0x360, 0x8000, 0x100, 0x8000
+  .word 0x360, 0x8000, 0x8000, 0x8000
+  .word 0x360, 0x8000, 0x10000, 0x10000
+  .word 0x360, 0x8000, 0x80000000, 0x80000000
+  .word 0x360, 0x8000, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x8000, 0x1000000, 0x1000000
+  .word 0x360, 0x8000, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x8000, 0x10080, 0x10080
+  .word 0x360, 0x8000, 0x723b417, 0x723b417
+  .word 0x360, 0x8000, 0x6c, 0x8000
+  .word 0x360, 0x8000, 0x215b8, 0x215b8
+  .word 0x360, 0x8000, 0xe69, 0x8000
+  .word 0x360, 0x8000, 0x73698785, 0x73698785
+  .word 0x360, 0x8000, 0x1, 0x8000
+  .word 0x360, 0x8000, 0x10, 0x8000
+  .word 0x360, 0x8000, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0x10000, 0x0, 0x10000
+  .word 0x360, 0x10000, 0x2, 0x10000
+  .word 0x360, 0x10000, 0x80, 0x10000
+  .word 0x360, 0x10000, 0x100, 0x10000
+  .word 0x360, 0x10000, 0x8000, 0x10000
+  .word 0x360, 0x10000, 0x10000, 0x10000
+  .word 0x360, 0x10000, 0x80000000, 0x80000000
+  .word 0x360, 0x10000, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x10000, 0x1000000, 0x1000000
+  .word 0x360, 0x10000, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x10000, 0x10080, 0x10080
+  .word 0x360, 0x10000, 0x723b417, 0x723b417
+  .word 0x360, 0x10000, 0x6c, 0x10000
+  .word 0x360, 0x10000, 0x215b8, 0x215b8
+  .word 0x360, 0x10000, 0xe69, 0x10000
+  .word 0x360, 0x10000, 0x73698785, 0x73698785
+  .word 0x360, 0x10000, 0x1, 0x10000
+  .word 0x360, 0x10000, 0x10, 0x10000
+  .word 0x360, 0x10000, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0x80000000, 0x0, 0x80000000
+  .word 0x360, 0x80000000, 0x2, 0x80000000
+  .word 0x360, 0x80000000, 0x80, 0x80000000
+  .word 0x360, 0x80000000, 0x100, 0x80000000
+  .word 0x360, 0x80000000, 0x8000, 0x80000000
+  .word 0x360, 0x80000000, 0x10000, 0x80000000
+  .word 0x360, 0x80000000, 0x80000000, 0x80000000
+  .word 0x360, 0x80000000, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x80000000, 0x1000000, 0x80000000
+  .word 0x360, 0x80000000, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x80000000, 0x10080, 0x80000000
+  .word 0x360, 0x80000000, 0x723b417, 0x80000000
+  .word 0x360, 0x80000000, 0x6c, 0x80000000
+  .word 0x360, 0x80000000, 0x215b8, 0x80000000
+  .word 0x360, 0x80000000, 0xe69, 0x80000000
+  .word 0x360, 0x80000000, 0x73698785, 0x80000000
+  .word 0x360, 0x80000000, 0x1, 0x80000000
+  .word 0x360, 0x80000000, 0x10, 0x80000000
+  .word 0x360, 0x80000000, 0xd28fd14, 0x80000000
+  .word 0x360, 0xfffffffe, 0x0, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x2, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x80, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x100, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x8000, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x10000, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x80000000, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x1000000, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0xff00ff00, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x10080, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x723b417, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x6c, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x215b8, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0xe69, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x73698785, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x1, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0x10, 0xfffffffe
+  .word 0x360, 0xfffffffe, 0xd28fd14, 0xfffffffe
+  .word 0x360, 0x1000000, 0x0, 0x1000000
+  .word 0x360, 0x1000000, 0x2, 0x1000000
+  .word 0x360, 0x1000000, 0x80, 0x1000000
+  .word 0x360, 0x1000000, 0x100, 0x1000000
+  .word 0x360, 0x1000000, 0x8000, 0x1000000
+  .word 0x360, 0x1000000, 0x10000, 0x1000000
+  .word 0x360, 0x1000000, 0x80000000, 0x80000000
+  .word 0x360, 0x1000000, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x1000000, 0x1000000, 0x1000000
+  .word 0x360, 0x1000000, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x1000000, 0x10080, 0x1000000
+  .word 0x360, 0x1000000, 0x723b417, 0x723b417
+  .word 0x360, 0x1000000, 0x6c, 0x1000000
+  .word 0x360, 0x1000000, 0x215b8, 0x1000000
+  .word 0x360, 0x1000000, 0xe69, 0x1000000
+  .word 0x360, 0x1000000, 0x73698785, 0x73698785
+  .word 0x360, 0x1000000, 0x1, 0x1000000
+  .word 0x360, 0x1000000, 0x10, 0x1000000
+  .word 0x360, 0x1000000, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x2, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x80, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x100, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x8000, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x10000, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x80000000, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0xff00ff00, 0x1000000, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x10080, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x723b417, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x6c, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x215b8, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0xe69, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x73698785, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x1, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0x10, 0xff00ff00
+  .word 0x360, 0xff00ff00, 0xd28fd14, 0xff00ff00
+  .word 0x360, 0x10080, 0x0, 0x10080
+  .word 0x360, 0x10080, 0x2, 0x10080
+  .word 0x360, 0x10080, 0x80, 0x10080
+  .word 0x360, 0x10080, 0x100, 0x10080
+  .word 0x360, 0x10080, 0x8000, 0x10080
+  .word 0x360, 0x10080, 0x10000, 0x10080
+  .word 0x360, 0x10080, 0x80000000, 0x80000000
+  .word 0x360, 0x10080, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x10080, 0x1000000, 0x1000000
+  .word 0x360, 0x10080, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x10080, 0x10080, 0x10080
+  .word 0x360, 0x10080, 0x723b417, 0x723b417
+  .word 0x360, 0x10080, 0x6c, 0x10080
+  .word 0x360, 0x10080, 0x215b8, 0x215b8
+  .word 0x360, 0x10080, 0xe69, 0x10080
+  .word 0x360, 0x10080, 0x73698785, 0x73698785
+  .word 0x360, 0x10080, 0x1, 0x10080
+  .word 0x360, 0x10080, 0x10, 0x10080
+  .word 0x360, 0x10080, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0x723b417, 0x0, 0x723b417
+  .word 0x360, 0x723b417, 0x2, 0x723b417
+  .word 0x360, 0x723b417, 0x80, 0x723b417
+  .word 0x360, 0x723b417, 0x100, 0x723b417
+  .word 0x360, 0x723b417, 0x8000, 0x723b417
+  .word 0x360, 0x723b417, 0x10000, 0x723b417
+  .word 0x360, 0x723b417, 0x80000000, 0x80000000
+  .word 0x360, 0x723b417, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x723b417, 0x1000000, 0x723b417
+  .word 0x360, 0x723b417, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x723b417, 0x10080, 0x723b417
+  .word 0x360, 0x723b417, 0x723b417, 0x723b417
+  .word 0x360, 0x723b417, 0x6c, 0x723b417
+  .word 0x360, 0x723b417, 0x215b8, 0x723b417
+  .word 0x360, 0x723b417, 0xe69, 0x723b417
+  .word 0x360, 0x723b417, 0x73698785, 0x73698785
+  .word 0x360, 0x723b417, 0x1, 0x723b417
+  .word 0x360, 0x723b417, 0x10, 0x723b417
+  .word 0x360, 0x723b417, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0x6c, 0x0, 0x6c
+  .word 0x360, 0x6c, 0x2, 0x6c
+  .word 0x360, 0x6c, 0x80, 0x80
+  .word 0x360, 0x6c, 0x100, 0x100
+  .word 0x360, 0x6c, 0x8000, 0x8000
+  .word 0x360, 0x6c, 0x10000, 0x10000
+  .word 0x360, 0x6c, 0x80000000, 0x80000000
+  .word 0x360, 0x6c, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x6c, 0x1000000, 0x1000000
+  .word 0x360, 0x6c, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x6c, 0x10080, 0x10080
+  .word 0x360, 0x6c, 0x723b417, 0x723b417
+  .word 0x360, 0x6c, 0x6c, 0x6c
+  .word 0x360, 0x6c, 0x215b8, 0x215b8
+  .word 0x360, 0x6c, 0xe69, 0xe69
+  .word 0x360, 0x6c, 0x73698785, 0x73698785
+  .word 0x360, 0x6c, 0x1, 0x6c
+  .word 0x360, 0x6c, 0x10, 0x6c
+  .word 0x360, 0x6c, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0x215b8, 0x0, 0x215b8
+  .word 0x360, 0x215b8, 0x2, 0x215b8
+  .word 0x360, 0x215b8, 0x80, 0x215b8
+  .word 0x360, 0x215b8, 0x100, 0x215b8
+  .word 0x360, 0x215b8, 0x8000, 0x215b8
+  .word 0x360, 0x215b8, 0x10000, 0x215b8
+  .word 0x360, 0x215b8, 0x80000000, 0x80000000
+  .word 0x360, 0x215b8, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x215b8, 0x1000000, 0x1000000
+  .word 0x360, 0x215b8, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x215b8, 0x10080, 0x215b8
+  .word 0x360, 0x215b8, 0x723b417, 0x723b417
+  .word 0x360, 0x215b8, 0x6c, 0x215b8
+  .word 0x360, 0x215b8, 0x215b8, 0x215b8
+  .word 0x360, 0x215b8, 0xe69, 0x215b8
+  .word 0x360, 0x215b8, 0x73698785, 0x73698785
+  .word 0x360, 0x215b8, 0x1, 0x215b8
+  .word 0x360, 0x215b8, 0x10, 0x215b8
+  .word 0x360, 0x215b8, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0xe69, 0x0, 0xe69
+  .word 0x360, 0xe69, 0x2, 0xe69
+  .word 0x360, 0xe69, 0x80, 0xe69
+  .word 0x360, 0xe69, 0x100, 0xe69
+  .word 0x360, 0xe69, 0x8000, 0x8000
+  .word 0x360, 0xe69, 0x10000, 0x10000
+  .word 0x360, 0xe69, 0x80000000, 0x80000000
+  .word 0x360, 0xe69, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0xe69, 0x1000000, 0x1000000
+  .word 0x360, 0xe69, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0xe69, 0x10080, 0x10080
+  .word 0x360, 0xe69, 0x723b417, 0x723b417
+  .word 0x360, 0xe69, 0x6c, 0xe69
+  .word 0x360, 0xe69, 0x215b8, 0x215b8
+  .word 0x360, 0xe69, 0xe69, 0xe69
+  .word 0x360, 0xe69, 0x73698785, 0x73698785
+  .word 0x360, 0xe69, 0x1, 0xe69
+  .word 0x360, 0xe69, 0x10, 0xe69
+  .word 0x360, 0xe69, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0x73698785, 0x0, 0x73698785
+  .word 0x360, 0x73698785, 0x2, 0x73698785
+  .word 0x360, 0x73698785, 0x80, 0x73698785
+  .word 0x360, 0x73698785, 0x100, 0x73698785
+  .word 0x360, 0x73698785, 0x8000, 0x73698785
+  .word 0x360, 0x73698785, 0x10000, 0x73698785
+  .word 0x360, 0x73698785, 0x80000000, 0x80000000
+  .word 0x360, 0x73698785, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x73698785, 0x1000000, 0x73698785
+  .word 0x360, 0x73698785, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x73698785, 0x10080, 0x73698785
+  .word 0x360, 0x73698785, 0x723b417, 0x73698785
+  .word 0x360, 0x73698785, 0x6c, 0x73698785
+  .word 0x360, 0x73698785, 0x215b8, 0x73698785
+  .word 0x360, 0x73698785, 0xe69, 0x73698785
+  .word 0x360, 0x73698785, 0x73698785, 0x73698785
+  .word 0x360, 0x73698785, 0x1, 0x73698785
+  .word 0x360, 0x73698785, 0x10, 0x73698785
+  .word 0x360, 0x73698785, 0xd28fd14, 0x73698785
+  .word 0x360, 0x1, 0x0, 0x1
+  .word 0x360, 0x1, 0x2, 0x2
+  .word 0x360, 0x1, 0x80, 0x80
+  .word 0x360, 0x1, 0x100, 0x100
+  .word 0x360, 0x1, 0x8000, 0x8000
+  .word 0x360, 0x1, 0x10000, 0x10000
+  .word 0x360, 0x1, 0x80000000, 0x80000000
+  .word 0x360, 0x1, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x1, 0x1000000, 0x1000000
+  .word 0x360, 0x1, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x1, 0x10080, 0x10080
+  .word 0x360, 0x1, 0x723b417, 0x723b417
+  .word 0x360, 0x1, 0x6c, 0x6c
+  .word 0x360, 0x1, 0x215b8, 0x215b8
+  .word 0x360, 0x1, 0xe69, 0xe69
+  .word 0x360, 0x1, 0x73698785, 0x73698785
+  .word 0x360, 0x1, 0x1, 0x1
+  .word 0x360, 0x1, 0x10, 0x10
+  .word 0x360, 0x1, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0x10, 0x0, 0x10
+  .word 0x360, 0x10, 0x2, 0x10
+  .word 0x360, 0x10, 0x80, 0x80
+  .word 0x360, 0x10, 0x100, 0x100
+  .word 0x360, 0x10, 0x8000, 0x8000
+  .word 0x360, 0x10, 0x10000, 0x10000
+  .word 0x360, 0x10, 0x80000000, 0x80000000
+  .word 0x360, 0x10, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0x10, 0x1000000, 0x1000000
+  .word 0x360, 0x10, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0x10, 0x10080, 0x10080
+  .word 0x360, 0x10, 0x723b417, 0x723b417
+  .word 0x360, 0x10, 0x6c, 0x6c
+  .word 0x360, 0x10, 0x215b8, 0x215b8
+  .word 0x360, 0x10, 0xe69, 0xe69
+  .word 0x360, 0x10, 0x73698785, 0x73698785
+  .word 0x360, 0x10, 0x1, 0x10
+  .word 0x360, 0x10, 0x10, 0x10
+  .word 0x360, 0x10, 0xd28fd14, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x2, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x80, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x100, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x8000, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x10000, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x80000000, 0x80000000
+  .word 0x360, 0xd28fd14, 0xfffffffe, 0xfffffffe
+  .word 0x360, 0xd28fd14, 0x1000000, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0xff00ff00, 0xff00ff00
+  .word 0x360, 0xd28fd14, 0x10080, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x723b417, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x6c, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x215b8, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0xe69, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x73698785, 0x73698785
+  .word 0x360, 0xd28fd14, 0x1, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0x10, 0xd28fd14
+  .word 0x360, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x370, 0x0, 0x0, 0x0
+  .word 0x380, 0x0, 0x0, 0x0
+  .word 0x390, 0x0, 0x0, 0x0
+  .word 0x370, 0x0, 0x10000, 0x10000
+  .word 0x380, 0x0, 0x10000, 0x10000
+  .word 0x390, 0x0, 0x10000, 0x10000
+  .word 0x370, 0x0, 0x10080, 0x10080
+  .word 0x380, 0x0, 0x10080, 0x10080
+  .word 0x390, 0x0, 0x10080, 0x10080
+  .word 0x370, 0x0, 0x73698785, 0x73698785
+  .word 0x380, 0x0, 0x73698785, 0x73698785
+  .word 0x390, 0x0, 0x73698785, 0x73698785
+  .word 0x370, 0x2, 0x2, 0x2
+  .word 0x380, 0x2, 0x2, 0x2
+  .word 0x390, 0x2, 0x2, 0x2
+  .word 0x370, 0x2, 0x80000000, 0x80000000
+  .word 0x380, 0x2, 0x80000000, 0x80000000
+  .word 0x390, 0x2, 0x80000000, 0x80000000
+  .word 0x370, 0x2, 0x723b417, 0x723b417
+  .word 0x380, 0x2, 0x723b417, 0x723b417
+  .word 0x390, 0x2, 0x723b417, 0x723b417
+  .word 0x370, 0x2, 0x1, 0x2
+  .word 0x380, 0x2, 0x1, 0x2
+  .word 0x390, 0x2, 0x1, 0x1
+  .word 0x370, 0x80, 0x80, 0x80
+  .word 0x380, 0x80, 0x80, 0x80
+  .word 0x390, 0x80, 0x80, 0x80
+  .word 0x370, 0x80, 0xfffffffe, 0xfffffffe
+  .word 0x380, 0x80, 0xfffffffe, 0xfffffffe
+  .word 0x390, 0x80, 0xfffffffe, 0xfffffffe
+  .word 0x370, 0x80, 0x6c, 0x80
+  .word 0x380, 0x80, 0x6c, 0x80
+  .word 0x390, 0x80, 0x6c, 0x6c
+  .word 0x370, 0x80, 0x10, 0x80
+  .word 0x380, 0x80, 0x10, 0x80
+  .word 0x390, 0x80, 0x10, 0x10
+  .word 0x370, 0x100, 0x100, 0x100
+  .word 0x380, 0x100, 0x100, 0x100
+  .word 0x390, 0x100, 0x100, 0x100
+  .word 0x370, 0x100, 0x1000000, 0x1000000
+  .word 0x380, 0x100, 0x1000000, 0x1000000
+  .word 0x390, 0x100, 0x1000000, 0x1000000
+  .word 0x370, 0x100, 0x215b8, 0x215b8
+  .word 0x380, 0x100, 0x215b8, 0x215b8
+  .word 0x390, 0x100, 0x215b8, 0x215b8
+  .word 0x370, 0x100, 0xd28fd14, 0xd28fd14
+  .word 0x380, 0x100, 0xd28fd14, 0xd28fd14
+  .word 0x390, 0x100, 0xd28fd14, 0xd28fd14
+  .word 0x370, 0x8000, 0x8000, 0x8000
+  .word 0x380, 0x8000, 0x8000, 0x8000
+  .word 0x390, 0x8000, 0x8000, 0x8000
+  .word 0x370, 0x8000, 0xff00ff00, 0xff00ff00
+  .word 0x380, 0x8000, 0xff00ff00, 0xff00ff00
+  .word 0x390, 0x8000, 0xff00ff00, 0xff00ff00
+  .word 0x370, 0x8000, 0xe69, 0x8000
+  .word 0x380, 0x8000, 0xe69, 0x8000
+  .word 0x390, 0x8000, 0xe69, 0xe69
+  .word 0x370, 0x10000, 0x0, 0x10000
+  .word 0x380, 0x10000, 0x0, 0x10000
+  .word 0x390, 0x10000, 0x0, 0x0
+  .word 0x370, 0x10000, 0x10000, 0x10000
+  .word 0x380, 0x10000, 0x10000, 0x10000
+  .word 0x390, 0x10000, 0x10000, 0x10000
+  .word 0x370, 0x10000, 0x10080, 0x10080
+  .word 0x380, 0x10000, 0x10080, 0x10080
+  .word 0x390, 0x10000, 0x10080, 0x10080
+  .word 0x370, 0x10000, 0x73698785, 0x73698785
+  .word 0x380, 0x10000, 0x73698785, 0x73698785
+  .word 0x390, 0x10000, 0x73698785, 0x73698785
+  .word 0x370, 0x80000000, 0x2, 0x80000000
+  .word 0x380, 0x80000000, 0x2, 0x80000000
+  .word 0x390, 0x80000000, 0x2, 0x2
+  .word 0x370, 0x80000000, 0x80000000, 0x80000000
+  .word 0x380, 0x80000000, 0x80000000, 0x80000000
+  .word 0x390, 0x80000000, 0x80000000, 0x80000000
+  .word 0x370, 0x80000000, 0x723b417, 0x80000000
+  .word 0x380, 0x80000000, 0x723b417, 0x80000000
+  .word 0x390, 0x80000000, 0x723b417, 0x723b417
+  .word 0x370, 0x80000000, 0x1, 0x80000000
+  .word 0x380, 0x80000000, 0x1, 0x80000000
+  .word 0x390, 0x80000000, 0x1, 0x1
+  .word 0x370, 0xfffffffe, 0x80, 0xfffffffe
+  .word 0x380, 0xfffffffe, 0x80, 0xfffffffe
+  .word 0x390, 0xfffffffe, 0x80, 0x80
+  .word 0x370, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x380, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x390, 0xfffffffe, 0xfffffffe, 0xfffffffe
+  .word 0x370, 0xfffffffe, 0x6c, 0xfffffffe
+  .word 0x380, 0xfffffffe, 0x6c, 0xfffffffe
+  .word 0x390, 0xfffffffe, 0x6c, 0x6c
+  .word 0x370, 0xfffffffe, 0x10, 0xfffffffe
+  .word 0x380, 0xfffffffe, 0x10, 0xfffffffe
+  .word 0x390, 0xfffffffe, 0x10, 0x10
+  .word 0x370, 0x1000000, 0x100, 0x1000000
+  .word 0x380, 0x1000000, 0x100, 0x1000000
+  .word 0x390, 0x1000000, 0x100, 0x100
+  .word 0x370, 0x1000000, 0x1000000, 0x1000000
+  .word 0x380, 0x1000000, 0x1000000, 0x1000000
+  .word 0x390, 0x1000000, 0x1000000, 0x1000000
+  .word 0x370, 0x1000000, 0x215b8, 0x1000000
+  .word 0x380, 0x1000000, 0x215b8, 0x1000000
+  .word 0x390, 0x1000000, 0x215b8, 0x215b8
+  .word 0x370, 0x1000000, 0xd28fd14, 0xd28fd14
+  .word 0x380, 0x1000000, 0xd28fd14, 0xd28fd14
+  .word 0x390, 0x1000000, 0xd28fd14, 0xd28fd14
+  .word 0x370, 0xff00ff00, 0x8000, 0xff00ff00
+  .word 0x380, 0xff00ff00, 0x8000, 0xff00ff00
+  .word 0x390, 0xff00ff00, 0x8000, 0x8000
+  .word 0x370, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x380, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x390, 0xff00ff00, 0xff00ff00, 0xff00ff00
+  .word 0x370, 0xff00ff00, 0xe69, 0xff00ff00
+  .word 0x380, 0xff00ff00, 0xe69, 0xff00ff00
+  .word 0x390, 0xff00ff00, 0xe69, 0xe69
+  .word 0x370, 0x10080, 0x0, 0x10080
+  .word 0x380, 0x10080, 0x0, 0x10080
+  .word 0x390, 0x10080, 0x0, 0x0
+  .word 0x370, 0x10080, 0x10000, 0x10080
+  .word 0x380, 0x10080, 0x10000, 0x10080
+  .word 0x390, 0x10080, 0x10000, 0x10000
+  .word 0x370, 0x10080, 0x10080, 0x10080
+  .word 0x380, 0x10080, 0x10080, 0x10080
+  .word 0x390, 0x10080, 0x10080, 0x10080
+  .word 0x370, 0x10080, 0x73698785, 0x73698785
+  .word 0x380, 0x10080, 0x73698785, 0x73698785
+  .word 0x390, 0x10080, 0x73698785, 0x73698785
+  .word 0x370, 0x723b417, 0x2, 0x723b417
+  .word 0x380, 0x723b417, 0x2, 0x723b417
+  .word 0x390, 0x723b417, 0x2, 0x2
+  .word 0x370, 0x723b417, 0x80000000, 0x80000000
+  .word 0x380, 0x723b417, 0x80000000, 0x80000000
+  .word 0x390, 0x723b417, 0x80000000, 0x80000000
+  .word 0x370, 0x723b417, 0x723b417, 0x723b417
+  .word 0x380, 0x723b417, 0x723b417, 0x723b417
+  .word 0x390, 0x723b417, 0x723b417, 0x723b417
+  .word 0x370, 0x723b417, 0x1, 0x723b417
+  .word 0x380, 0x723b417, 0x1, 0x723b417
+  .word 0x390, 0x723b417, 0x1, 0x1
+  .word 0x370, 0x6c, 0x80, 0x80
+  .word 0x380, 0x6c, 0x80, 0x80
+  .word 0x390, 0x6c, 0x80, 0x80
+  .word 0x370, 0x6c, 0xfffffffe, 0xfffffffe
+  .word 0x380, 0x6c, 0xfffffffe, 0xfffffffe
+  .word 0x390, 0x6c, 0xfffffffe, 0xfffffffe
+  .word 0x370, 0x6c, 0x6c, 0x6c
+  .word 0x380, 0x6c, 0x6c, 0x6c
+  .word 0x390, 0x6c, 0x6c, 0x6c
+  .word 0x370, 0x6c, 0x10, 0x6c
+  .word 0x380, 0x6c, 0x10, 0x6c
+  .word 0x390, 0x6c, 0x10, 0x10
+  .word 0x370, 0x215b8, 0x100, 0x215b8
+  .word 0x380, 0x215b8, 0x100, 0x215b8
+  .word 0x390, 0x215b8, 0x100, 0x100
+  .word 0x370, 0x215b8, 0x1000000, 0x1000000
+  .word 0x380, 0x215b8, 0x1000000, 0x1000000
+  .word 0x390, 0x215b8, 0x1000000, 0x1000000
+  .word 0x370, 0x215b8, 0x215b8, 0x215b8
+  .word 0x380, 0x215b8, 0x215b8, 0x215b8
+  .word 0x390, 0x215b8, 0x215b8, 0x215b8
+  .word 0x370, 0x215b8, 0xd28fd14, 0xd28fd14
+  .word 0x380, 0x215b8, 0xd28fd14, 0xd28fd14
+  .word 0x390, 0x215b8, 0xd28fd14, 0xd28fd14
+  .word 0x370, 0xe69, 0x8000, 0x8000
+  .word 0x380, 0xe69, 0x8000, 0x8000
+  .word 0x390, 0xe69, 0x8000, 0x8000
+  .word 0x370, 0xe69, 0xff00ff00, 0xff00ff00
+  .word 0x380, 0xe69, 0xff00ff00, 0xff00ff00
+  .word 0x390, 0xe69, 0xff00ff00, 0xff00ff00
+  .word 0x370, 0xe69, 0xe69, 0xe69
+  .word 0x380, 0xe69, 0xe69, 0xe69
+  .word 0x390, 0xe69, 0xe69, 0xe69
+  .word 0x370, 0x73698785, 0x0, 0x73698785
+  .word 0x380, 0x73698785, 0x0, 0x73698785
+  .word 0x390, 0x73698785, 0x0, 0x0
+  .word 0x370, 0x73698785, 0x10000, 0x73698785
+  .word 0x380, 0x73698785, 0x10000, 0x73698785
+  .word 0x390, 0x73698785, 0x10000, 0x10000
+  .word 0x370, 0x73698785, 0x10080, 0x73698785
+  .word 0x380, 0x73698785, 0x10080, 0x73698785
+  .word 0x390, 0x73698785, 0x10080, 0x10080
+  .word 0x370, 0x73698785, 0x73698785, 0x73698785
+  .word 0x380, 0x73698785, 0x73698785, 0x73698785
+  .word 0x390, 0x73698785, 0x73698785, 0x73698785
+  .word 0x370, 0x1, 0x2, 0x2
+  .word 0x380, 0x1, 0x2, 0x2
+  .word 0x390, 0x1, 0x2, 0x2
+  .word 0x370, 0x1, 0x80000000, 0x80000000
+  .word 0x380, 0x1, 0x80000000, 0x80000000
+  .word 0x390, 0x1, 0x80000000, 0x80000000
+  .word 0x370, 0x1, 0x723b417, 0x723b417
+  .word 0x380, 0x1, 0x723b417, 0x723b417
+  .word 0x390, 0x1, 0x723b417, 0x723b417
+  .word 0x370, 0x1, 0x1, 0x1
+  .word 0x380, 0x1, 0x1, 0x1
+  .word 0x390, 0x1, 0x1, 0x1
+  .word 0x370, 0x10, 0x80, 0x80
+  .word 0x380, 0x10, 0x80, 0x80
+  .word 0x390, 0x10, 0x80, 0x80
+  .word 0x370, 0x10, 0xfffffffe, 0xfffffffe
+  .word 0x380, 0x10, 0xfffffffe, 0xfffffffe
+  .word 0x390, 0x10, 0xfffffffe, 0xfffffffe
+  .word 0x370, 0x10, 0x6c, 0x6c
+  .word 0x380, 0x10, 0x6c, 0x6c
+  .word 0x390, 0x10, 0x6c, 0x6c
+  .word 0x370, 0x10, 0x10, 0x10
+  .word 0x380, 0x10, 0x10, 0x10
+  .word 0x390, 0x10, 0x10, 0x10
+  .word 0x370, 0xd28fd14, 0x100, 0xd28fd14
+  .word 0x380, 0xd28fd14, 0x100, 0xd28fd14
+  .word 0x390, 0xd28fd14, 0x100, 0x100
+  .word 0x370, 0xd28fd14, 0x1000000, 0xd28fd14
+  .word 0x380, 0xd28fd14, 0x1000000, 0xd28fd14
+  .word 0x390, 0xd28fd14, 0x1000000, 0x1000000
+  .word 0x370, 0xd28fd14, 0x215b8, 0xd28fd14
+  .word 0x380, 0xd28fd14, 0x215b8, 0xd28fd14
+  .word 0x390, 0xd28fd14, 0x215b8, 0x215b8
+  .word 0x370, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x380, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x390, 0xd28fd14, 0xd28fd14, 0xd28fd14
+  .word 0x3a0, 0x0, 0x12345687, 0x12345687
+  .word 0x3b0, 0x87654321, 0x0, 0x87654321
+  .word 0x3c0, 0x0, 0x0, 0x0
+  .word 0x3c0, 0x0, 0x1, 0x0
+  .word 0x3c0, 0x0, 0x7, 0x0
+  .word 0x3c0, 0x0, 0x1f, 0x0
+  .word 0x3c0, 0x0, 0x20, 0x0
+  .word 0x3c0, 0x0, 0x21, 0x0
+  .word 0x3c0, 0x0, 0x3f, 0x0
+  .word 0x3c0, 0x0, 0x40, 0x0
+  .word 0x3c0, 0x0, 0x80000000, 0x0
+  .word 0x3c0, 0x0, 0xffffffe1, 0x0
+  .word 0x3c0, 0x0, 0xffffffff, 0x0
+  .word 0x3c0, 0x7f, 0x0, 0x7f
+  .word 0x3c0, 0x7f, 0x1, 0xfe
+  .word 0x3c0, 0x7f, 0x7, 0x3f80
+  .word 0x3c0, 0x7f, 0x1f, 0x8000003f
+  .word 0x3c0, 0x7f, 0x20, 0x7f
+  .word 0x3c0, 0x7f, 0x21, 0xfe
+  .word 0x3c0, 0x7f, 0x3f, 0x8000003f
+  .word 0x3c0, 0x7f, 0x40, 0x7f
+  .word 0x3c0, 0x7f, 0x80000000, 0x7f
+  .word 0x3c0, 0x7f, 0xffffffe1, 0xfe
+  .word 0x3c0, 0x7f, 0xffffffff, 0x8000003f
+  .word 0x3c0, 0x100, 0x0, 0x100
+  .word 0x3c0, 0x100, 0x1, 0x200
+  .word 0x3c0, 0x100, 0x7, 0x8000
+  .word 0x3c0, 0x100, 0x1f, 0x80
+  .word 0x3c0, 0x100, 0x20, 0x100
+  .word 0x3c0, 0x100, 0x21, 0x200
+  .word 0x3c0, 0x100, 0x3f, 0x80
+  .word 0x3c0, 0x100, 0x40, 0x100
+  .word 0x3c0, 0x100, 0x80000000, 0x100
+  .word 0x3c0, 0x100, 0xffffffe1, 0x200
+  .word 0x3c0, 0x100, 0xffffffff, 0x80
+  .word 0x3c0, 0xffff, 0x0, 0xffff
+  .word 0x3c0, 0xffff, 0x1, 0x1fffe
+  .word 0x3c0, 0xffff, 0x7, 0x7fff80
+  .word 0x3c0, 0xffff, 0x1f, 0x80007fff
+  .word 0x3c0, 0xffff, 0x20, 0xffff
+  .word 0x3c0, 0xffff, 0x21, 0x1fffe
+  .word 0x3c0, 0xffff, 0x3f, 0x80007fff
+  .word 0x3c0, 0xffff, 0x40, 0xffff
+  .word 0x3c0, 0xffff, 0x80000000, 0xffff
+  .word 0x3c0, 0xffff, 0xffffffe1, 0x1fffe
+  .word 0x3c0, 0xffff, 0xffffffff, 0x80007fff
+  .word 0x3c0, 0x80000000, 0x0, 0x80000000
+  .word 0x3c0, 0x80000000, 0x1, 0x1
+  .word 0x3c0, 0x80000000, 0x7, 0x40
+  .word 0x3c0, 0x80000000, 0x1f, 0x40000000
+  .word 0x3c0, 0x80000000, 0x20, 0x80000000
+  .word 0x3c0, 0x80000000, 0x21, 0x1
+  .word 0x3c0, 0x80000000, 0x3f, 0x40000000
+  .word 0x3c0, 0x80000000, 0x40, 0x80000000
+  .word 0x3c0, 0x80000000, 0x80000000, 0x80000000
+  .word 0x3c0, 0x80000000, 0xffffffe1, 0x1
+  .word 0x3c0, 0x80000000, 0xffffffff, 0x40000000
+  .word 0x3c0, 0xffffffff, 0x0, 0xffffffff
+  .word 0x3c0, 0xffffffff, 0x1, 0xffffffff
+  .word 0x3c0, 0xffffffff, 0x7, 0xffffffff
+  .word 0x3c0, 0xffffffff, 0x1f, 0xffffffff
+  .word 0x3c0, 0xffffffff, 0x20, 0xffffffff
+  .word 0x3c0, 0xffffffff, 0x21, 0xffffffff
+  .word 0x3c0, 0xffffffff, 0x3f, 0xffffffff
+  .word 0x3c0, 0xffffffff, 0x40, 0xffffffff
+  .word 0x3c0, 0xffffffff, 0x80000000, 0xffffffff
+  .word 0x3c0, 0xffffffff, 0xffffffe1, 0xffffffff
+  .word 0x3c0, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x3c0, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x3c0, 0xff00ff00, 0x1, 0xfe01fe01
+  .word 0x3c0, 0xff00ff00, 0x7, 0x807f807f
+  .word 0x3c0, 0xff00ff00, 0x1f, 0x7f807f80
+  .word 0x3c0, 0xff00ff00, 0x20, 0xff00ff00
+  .word 0x3c0, 0xff00ff00, 0x21, 0xfe01fe01
+  .word 0x3c0, 0xff00ff00, 0x3f, 0x7f807f80
+  .word 0x3c0, 0xff00ff00, 0x40, 0xff00ff00
+  .word 0x3c0, 0xff00ff00, 0x80000000, 0xff00ff00
+  .word 0x3c0, 0xff00ff00, 0xffffffe1, 0xfe01fe01
+  .word 0x3c0, 0xff00ff00, 0xffffffff, 0x7f807f80
+  .word 0x3c0, 0x3b30, 0x0, 0x3b30
+  .word 0x3c0, 0x3b30, 0x1, 0x7660
+  .word 0x3c0, 0x3b30, 0x7, 0x1d9800
+  .word 0x3c0, 0x3b30, 0x1f, 0x1d98
+  .word 0x3c0, 0x3b30, 0x20, 0x3b30
+  .word 0x3c0, 0x3b30, 0x21, 0x7660
+  .word 0x3c0, 0x3b30, 0x3f, 0x1d98
+  .word 0x3c0, 0x3b30, 0x40, 0x3b30
+  .word 0x3c0, 0x3b30, 0x80000000, 0x3b30
+  .word 0x3c0, 0x3b30, 0xffffffe1, 0x7660
+  .word 0x3c0, 0x3b30, 0xffffffff, 0x1d98
+  .word 0x3c0, 0x6c, 0x0, 0x6c
+  .word 0x3c0, 0x6c, 0x1, 0xd8
+  .word 0x3c0, 0x6c, 0x7, 0x3600
+  .word 0x3c0, 0x6c, 0x1f, 0x36
+  .word 0x3c0, 0x6c, 0x20, 0x6c
+  .word 0x3c0, 0x6c, 0x21, 0xd8
+  .word 0x3c0, 0x6c, 0x3f, 0x36
+  .word 0x3c0, 0x6c, 0x40, 0x6c
+  .word 0x3c0, 0x6c, 0x80000000, 0x6c
+  .word 0x3c0, 0x6c, 0xffffffe1, 0xd8
+  .word 0x3c0, 0x6c, 0xffffffff, 0x36
+  .word 0x3c0, 0x4, 0x0, 0x4
+  .word 0x3c0, 0x4, 0x1, 0x8
+  .word 0x3c0, 0x4, 0x7, 0x200
+  .word 0x3c0, 0x4, 0x1f, 0x2
+  .word 0x3c0, 0x4, 0x20, 0x4
+  .word 0x3c0, 0x4, 0x21, 0x8
+  .word 0x3c0, 0x4, 0x3f, 0x2
+  .word 0x3c0, 0x4, 0x40, 0x4
+  .word 0x3c0, 0x4, 0x80000000, 0x4
+  .word 0x3c0, 0x4, 0xffffffe1, 0x8
+  .word 0x3c0, 0x4, 0xffffffff, 0x2
+  .word 0x3c0, 0x73698785, 0x0, 0x73698785
+  .word 0x3c0, 0x73698785, 0x1, 0xe6d30f0a
+  .word 0x3c0, 0x73698785, 0x7, 0xb4c3c2b9
+  .word 0x3c0, 0x73698785, 0x1f, 0xb9b4c3c2
+  .word 0x3c0, 0x73698785, 0x20, 0x73698785
+  .word 0x3c0, 0x73698785, 0x21, 0xe6d30f0a
+  .word 0x3c0, 0x73698785, 0x3f, 0xb9b4c3c2
+  .word 0x3c0, 0x73698785, 0x40, 0x73698785
+  .word 0x3c0, 0x73698785, 0x80000000, 0x73698785
+  .word 0x3c0, 0x73698785, 0xffffffe1, 0xe6d30f0a
+  .word 0x3c0, 0x73698785, 0xffffffff, 0xb9b4c3c2
+  .word 0x3c0, 0x35eb776b, 0x0, 0x35eb776b
+  .word 0x3c0, 0x35eb776b, 0x1, 0x6bd6eed6
+  .word 0x3c0, 0x35eb776b, 0x7, 0xf5bbb59a
+  .word 0x3c0, 0x35eb776b, 0x1f, 0x9af5bbb5
+  .word 0x3c0, 0x35eb776b, 0x20, 0x35eb776b
+  .word 0x3c0, 0x35eb776b, 0x21, 0x6bd6eed6
+  .word 0x3c0, 0x35eb776b, 0x3f, 0x9af5bbb5
+  .word 0x3c0, 0x35eb776b, 0x40, 0x35eb776b
+  .word 0x3c0, 0x35eb776b, 0x80000000, 0x35eb776b
+  .word 0x3c0, 0x35eb776b, 0xffffffe1, 0x6bd6eed6
+  .word 0x3c0, 0x35eb776b, 0xffffffff, 0x9af5bbb5
+  .word 0x3c0, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x3c0, 0xd28fd14, 0x1, 0x1a51fa28
+  .word 0x3c0, 0xd28fd14, 0x7, 0x947e8a06
+  .word 0x3c0, 0xd28fd14, 0x1f, 0x6947e8a
+  .word 0x3c0, 0xd28fd14, 0x20, 0xd28fd14
+  .word 0x3c0, 0xd28fd14, 0x21, 0x1a51fa28
+  .word 0x3c0, 0xd28fd14, 0x3f, 0x6947e8a
+  .word 0x3c0, 0xd28fd14, 0x40, 0xd28fd14
+  .word 0x3c0, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x3c0, 0xd28fd14, 0xffffffe1, 0x1a51fa28
+  .word 0x3c0, 0xd28fd14, 0xffffffff, 0x6947e8a
+  .word 0x3c0, 0x8b, 0xa86cf7b4, 0x8b00000
+  .word 0x3c0, 0x7fffffff, 0x9ef94bda, 0xfdffffff
+  .word 0x3c0, 0x80000001, 0xf8821a96, 0x600000
+  .word 0x3c0, 0x8b, 0x90c68e93, 0x4580000
+  .word 0x3c0, 0x8b, 0xf7f3a683, 0x458
+  .word 0x3c0, 0xd28fd14, 0x4801920e, 0x3f45034a
+  .word 0x3c0, 0x10080, 0x92af2f03, 0x80400
+  .word 0x3c0, 0xff, 0xd0745cc1, 0x1fe
+  .word 0x3c0, 0x73698785, 0x2d794610, 0x87857369
+  .word 0x3c0, 0x73698785, 0x97323268, 0x69878573
+  .word 0x3c0, 0xe69, 0xacfc4403, 0x7348
+  .word 0x3c0, 0x10000, 0x2e99777f, 0x8000
+  .word 0x3c0, 0x7fffffff, 0x8899230b, 0xfffffbff
+  .word 0x3c0, 0x10080, 0xac61e3a6, 0x402000
+  .word 0x3c0, 0x35eb776b, 0x32135b34, 0x76b35eb7
+  .word 0x3c0, 0x7fff, 0x15136429, 0xfffe00
+  .word 0x3d0, 0x0, 0x0, 0x0
+  .word 0x3e0, 0x0, 0x0, 0x0
+  .word 0x3f0, 0x0, 0x0, 0x0
+  .word 0x3d0, 0x0, 0x21, 0x0
+  .word 0x3e0, 0x0, 0x21, 0x0
+  .word 0x3f0, 0x0, 0x21, 0x42
+  .word 0x3d0, 0x0, 0xffffffff, 0x0
+  .word 0x3e0, 0x0, 0xffffffff, 0x0
+  .word 0x3f0, 0x0, 0xffffffff, 0xffffffff
+  .word 0x3d0, 0x7f, 0x20, 0x7f
+  .word 0x3e0, 0x7f, 0x20, 0x7f
+  .word 0x3f0, 0x7f, 0x20, 0x20
+  .word 0x3d0, 0x7f, 0xffffffe1, 0xfe
+  .word 0x3e0, 0x7f, 0xffffffe1, 0xfe
+  .word 0x3f0, 0x7f, 0xffffffe1, 0xffffffc3
+  .word 0x3d0, 0x100, 0x1f, 0x80
+  .word 0x3e0, 0x100, 0x1f, 0x80
+  .word 0x3f0, 0x100, 0x1f, 0x8000000f
+  .word 0x3d0, 0x100, 0x80000000, 0x100
+  .word 0x3e0, 0x100, 0x80000000, 0x100
+  .word 0x3f0, 0x100, 0x80000000, 0x80000000
+  .word 0x3d0, 0xffff, 0x7, 0x7fff80
+  .word 0x3e0, 0xffff, 0x7, 0x7fff80
+  .word 0x3f0, 0xffff, 0x7, 0x380
+  .word 0x3d0, 0xffff, 0x40, 0xffff
+  .word 0x3e0, 0xffff, 0x40, 0xffff
+  .word 0x3f0, 0xffff, 0x40, 0x40
+  .word 0x3d0, 0x80000000, 0x1, 0x1
+  .word 0x3e0, 0x80000000, 0x1, 0x1
+  .word 0x3f0, 0x80000000, 0x1, 0x2
+  .word 0x3d0, 0x80000000, 0x3f, 0x40000000
+  .word 0x3e0, 0x80000000, 0x3f, 0x40000000
+  .word 0x3f0, 0x80000000, 0x3f, 0x8000001f
+  .word 0x3d0, 0xffffffff, 0x0, 0xffffffff
+  .word 0x3e0, 0xffffffff, 0x0, 0xffffffff
+  .word 0x3f0, 0xffffffff, 0x0, 0x0
+  .word 0x3d0, 0xffffffff, 0x21, 0xffffffff
+  .word 0x3e0, 0xffffffff, 0x21, 0xffffffff
+  .word 0x3f0, 0xffffffff, 0x21, 0x42
+  .word 0x3d0, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x3e0, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x3f0, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x3d0, 0xff00ff00, 0x20, 0xff00ff00
+  .word 0x3e0, 0xff00ff00, 0x20, 0xff00ff00
+  .word 0x3f0, 0xff00ff00, 0x20, 0x20
+  .word 0x3d0, 0xff00ff00, 0xffffffe1, 0xfe01fe01
+  .word 0x3e0, 0xff00ff00, 0xffffffe1, 0xfe01fe01
+  .word 0x3f0, 0xff00ff00, 0xffffffe1, 0xffffffc3
+  .word 0x3d0, 0x3b30, 0x1f, 0x1d98
+  .word 0x3e0, 0x3b30, 0x1f, 0x1d98
+  .word 0x3f0, 0x3b30, 0x1f, 0x8000000f
+  .word 0x3d0, 0x3b30, 0x80000000, 0x3b30
+  .word 0x3e0, 0x3b30, 0x80000000, 0x3b30
+  .word 0x3f0, 0x3b30, 0x80000000, 0x80000000
+  .word 0x3d0, 0x6c, 0x7, 0x3600
+  .word 0x3e0, 0x6c, 0x7, 0x3600
+  .word 0x3f0, 0x6c, 0x7, 0x380
+  .word 0x3d0, 0x6c, 0x40, 0x6c
+  .word 0x3e0, 0x6c, 0x40, 0x6c
+  .word 0x3f0, 0x6c, 0x40, 0x40
+  .word 0x3d0, 0x4, 0x1, 0x8
+  .word 0x3e0, 0x4, 0x1, 0x8
+  .word 0x3f0, 0x4, 0x1, 0x2
+  .word 0x3d0, 0x4, 0x3f, 0x2
+  .word 0x3e0, 0x4, 0x3f, 0x2
+  .word 0x3f0, 0x4, 0x3f, 0x8000001f
+  .word 0x3d0, 0x73698785, 0x0, 0x73698785
+  .word 0x3e0, 0x73698785, 0x0, 0x73698785
+  .word 0x3f0, 0x73698785, 0x0, 0x0
+  .word 0x3d0, 0x73698785, 0x21, 0xe6d30f0a
+  .word 0x3e0, 0x73698785, 0x21, 0xe6d30f0a
+  .word 0x3f0, 0x73698785, 0x21, 0x42
+  .word 0x3d0, 0x73698785, 0xffffffff, 0xb9b4c3c2
+  .word 0x3e0, 0x73698785, 0xffffffff, 0xb9b4c3c2
+  .word 0x3f0, 0x73698785, 0xffffffff, 0xffffffff
+  .word 0x3d0, 0x35eb776b, 0x20, 0x35eb776b
+  .word 0x3e0, 0x35eb776b, 0x20, 0x35eb776b
+  .word 0x3f0, 0x35eb776b, 0x20, 0x20
+  .word 0x3d0, 0x35eb776b, 0xffffffe1, 0x6bd6eed6
+  .word 0x3e0, 0x35eb776b, 0xffffffe1, 0x6bd6eed6
+  .word 0x3f0, 0x35eb776b, 0xffffffe1, 0xffffffc3
+  .word 0x3d0, 0xd28fd14, 0x1f, 0x6947e8a
+  .word 0x3e0, 0xd28fd14, 0x1f, 0x6947e8a
+  .word 0x3f0, 0xd28fd14, 0x1f, 0x8000000f
+  .word 0x3d0, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x3e0, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x3f0, 0xd28fd14, 0x80000000, 0x80000000
+  .word 0x3d0, 0x80000001, 0xf8821a96, 0x600000
+  .word 0x3e0, 0x80000001, 0xf8821a96, 0x600000
+  .word 0x3f0, 0x80000001, 0xf8821a96, 0xa5be2086
+  .word 0x3d0, 0xff, 0xd0745cc1, 0x1fe
+  .word 0x3e0, 0xff, 0xd0745cc1, 0x1fe
+  .word 0x3f0, 0xff, 0xd0745cc1, 0xa0e8b983
+  .word 0x3d0, 0x7fffffff, 0x8899230b, 0xfffffbff
+  .word 0x3e0, 0x7fffffff, 0x8899230b, 0xfffffbff
+  .word 0x3f0, 0x7fffffff, 0x8899230b, 0xc9185c44
+  .word 0x400, 0x0, 0x12345687, 0x0
+  .word 0x410, 0x87654321, 0x0, 0x87654321
+  .word 0x420, 0x0, 0x0, 0x0
+  .word 0x420, 0x0, 0x1, 0x0
+  .word 0x420, 0x0, 0x7, 0x0
+  .word 0x420, 0x0, 0x1f, 0x0
+  .word 0x420, 0x0, 0x20, 0x0
+  .word 0x420, 0x0, 0x21, 0x0
+  .word 0x420, 0x0, 0x3f, 0x0
+  .word 0x420, 0x0, 0x40, 0x0
+  .word 0x420, 0x0, 0x80000000, 0x0
+  .word 0x420, 0x0, 0xffffffe1, 0x0
+  .word 0x420, 0x0, 0xffffffff, 0x0
+  .word 0x420, 0x7f, 0x0, 0x7f
+  .word 0x420, 0x7f, 0x1, 0x8000003f
+  .word 0x420, 0x7f, 0x7, 0xfe000000
+  .word 0x420, 0x7f, 0x1f, 0xfe
+  .word 0x420, 0x7f, 0x20, 0x7f
+  .word 0x420, 0x7f, 0x21, 0x8000003f
+  .word 0x420, 0x7f, 0x3f, 0xfe
+  .word 0x420, 0x7f, 0x40, 0x7f
+  .word 0x420, 0x7f, 0x80000000, 0x7f
+  .word 0x420, 0x7f, 0xffffffe1, 0x8000003f
+  .word 0x420, 0x7f, 0xffffffff, 0xfe
+  .word 0x420, 0x100, 0x0, 0x100
+  .word 0x420, 0x100, 0x1, 0x80
+  .word 0x420, 0x100, 0x7, 0x2
+  .word 0x420, 0x100, 0x1f, 0x200
+  .word 0x420, 0x100, 0x20, 0x100
+  .word 0x420, 0x100, 0x21, 0x80
+  .word 0x420, 0x100, 0x3f, 0x200
+  .word 0x420, 0x100, 0x40, 0x100
+  .word 0x420, 0x100, 0x80000000, 0x100
+  .word 0x420, 0x100, 0xffffffe1, 0x80
+  .word 0x420, 0x100, 0xffffffff, 0x200
+  .word 0x420, 0xffff, 0x0, 0xffff
+  .word 0x420, 0xffff, 0x1, 0x80007fff
+  .word 0x420, 0xffff, 0x7, 0xfe0001ff
+  .word 0x420, 0xffff, 0x1f, 0x1fffe
+  .word 0x420, 0xffff, 0x20, 0xffff
+  .word 0x420, 0xffff, 0x21, 0x80007fff
+  .word 0x420, 0xffff, 0x3f, 0x1fffe
+  .word 0x420, 0xffff, 0x40, 0xffff
+  .word 0x420, 0xffff, 0x80000000, 0xffff
+  .word 0x420, 0xffff, 0xffffffe1, 0x80007fff
+  .word 0x420, 0xffff, 0xffffffff, 0x1fffe
+  .word 0x420, 0x80000000, 0x0, 0x80000000
+  .word 0x420, 0x80000000, 0x1, 0x40000000
+  .word 0x420, 0x80000000, 0x7, 0x1000000
+  .word 0x420, 0x80000000, 0x1f, 0x1
+  .word 0x420, 0x80000000, 0x20, 0x80000000
+  .word 0x420, 0x80000000, 0x21, 0x40000000
+  .word 0x420, 0x80000000, 0x3f, 0x1
+  .word 0x420, 0x80000000, 0x40, 0x80000000
+  .word 0x420, 0x80000000, 0x80000000, 0x80000000
+  .word 0x420, 0x80000000, 0xffffffe1, 0x40000000
+  .word 0x420, 0x80000000, 0xffffffff, 0x1
+  .word 0x420, 0xffffffff, 0x0, 0xffffffff
+  .word 0x420, 0xffffffff, 0x1, 0xffffffff
+  .word 0x420, 0xffffffff, 0x7, 0xffffffff
+  .word 0x420, 0xffffffff, 0x1f, 0xffffffff
+  .word 0x420, 0xffffffff, 0x20, 0xffffffff
+  .word 0x420, 0xffffffff, 0x21, 0xffffffff
+  .word 0x420, 0xffffffff, 0x3f, 0xffffffff
+  .word 0x420, 0xffffffff, 0x40, 0xffffffff
+  .word 0x420, 0xffffffff, 0x80000000, 0xffffffff
+  .word 0x420, 0xffffffff, 0xffffffe1, 0xffffffff
+  .word 0x420, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x420, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x420, 0xff00ff00, 0x1, 0x7f807f80
+  .word 0x420, 0xff00ff00, 0x7, 0x1fe01fe
+  .word 0x420, 0xff00ff00, 0x1f, 0xfe01fe01
+  .word 0x420, 0xff00ff00, 0x20, 0xff00ff00
+  .word 0x420, 0xff00ff00, 0x21, 0x7f807f80
+  .word 0x420, 0xff00ff00, 0x3f, 0xfe01fe01
+  .word 0x420, 0xff00ff00, 0x40, 0xff00ff00
+  .word 0x420, 0xff00ff00, 0x80000000, 0xff00ff00
+  .word 0x420, 0xff00ff00, 0xffffffe1, 0x7f807f80
+  .word 0x420, 0xff00ff00, 0xffffffff, 0xfe01fe01
+  .word 0x420, 0x3b30, 0x0, 0x3b30
+  .word 0x420, 0x3b30, 0x1, 0x1d98
+  .word 0x420, 0x3b30, 0x7, 0x60000076
+  .word 0x420, 0x3b30, 0x1f, 0x7660
+  .word 0x420, 0x3b30, 0x20, 0x3b30
+  .word 0x420, 0x3b30, 0x21, 0x1d98
+  .word 0x420, 0x3b30, 0x3f, 0x7660
+  .word 0x420, 0x3b30, 0x40, 0x3b30
+  .word 0x420, 0x3b30, 0x80000000, 0x3b30
+  .word 0x420, 0x3b30, 0xffffffe1, 0x1d98
+  .word 0x420, 0x3b30, 0xffffffff, 0x7660
+  .word 0x420, 0x6c, 0x0, 0x6c
+  .word 0x420, 0x6c, 0x1, 0x36
+  .word 0x420, 0x6c, 0x7, 0xd8000000
+  .word 0x420, 0x6c, 0x1f, 0xd8
+  .word 0x420, 0x6c, 0x20, 0x6c
+  .word 0x420, 0x6c, 0x21, 0x36
+  .word 0x420, 0x6c, 0x3f, 0xd8
+  .word 0x420, 0x6c, 0x40, 0x6c
+  .word 0x420, 0x6c, 0x80000000, 0x6c
+  .word 0x420, 0x6c, 0xffffffe1, 0x36
+  .word 0x420, 0x6c, 0xffffffff, 0xd8
+  .word 0x420, 0x4, 0x0, 0x4
+  .word 0x420, 0x4, 0x1, 0x2
+  .word 0x420, 0x4, 0x7, 0x8000000
+  .word 0x420, 0x4, 0x1f, 0x8
+  .word 0x420, 0x4, 0x20, 0x4
+  .word 0x420, 0x4, 0x21, 0x2
+  .word 0x420, 0x4, 0x3f, 0x8
+  .word 0x420, 0x4, 0x40, 0x4
+  .word 0x420, 0x4, 0x80000000, 0x4
+  .word 0x420, 0x4, 0xffffffe1, 0x2
+  .word 0x420, 0x4, 0xffffffff, 0x8
+  .word 0x420, 0x73698785, 0x0, 0x73698785
+  .word 0x420, 0x73698785, 0x1, 0xb9b4c3c2
+  .word 0x420, 0x73698785, 0x7, 0xae6d30f
+  .word 0x420, 0x73698785, 0x1f, 0xe6d30f0a
+  .word 0x420, 0x73698785, 0x20, 0x73698785
+  .word 0x420, 0x73698785, 0x21, 0xb9b4c3c2
+  .word 0x420, 0x73698785, 0x3f, 0xe6d30f0a
+  .word 0x420, 0x73698785, 0x40, 0x73698785
+  .word 0x420, 0x73698785, 0x80000000, 0x73698785
+  .word 0x420, 0x73698785, 0xffffffe1, 0xb9b4c3c2
+  .word 0x420, 0x73698785, 0xffffffff, 0xe6d30f0a
+  .word 0x420, 0x35eb776b, 0x0, 0x35eb776b
+  .word 0x420, 0x35eb776b, 0x1, 0x9af5bbb5
+  .word 0x420, 0x35eb776b, 0x7, 0xd66bd6ee
+  .word 0x420, 0x35eb776b, 0x1f, 0x6bd6eed6
+  .word 0x420, 0x35eb776b, 0x20, 0x35eb776b
+  .word 0x420, 0x35eb776b, 0x21, 0x9af5bbb5
+  .word 0x420, 0x35eb776b, 0x3f, 0x6bd6eed6
+  .word 0x420, 0x35eb776b, 0x40, 0x35eb776b
+  .word 0x420, 0x35eb776b, 0x80000000, 0x35eb776b
+  .word 0x420, 0x35eb776b, 0xffffffe1, 0x9af5bbb5
+  .word 0x420, 0x35eb776b, 0xffffffff, 0x6bd6eed6
+  .word 0x420, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x420, 0xd28fd14, 0x1, 0x6947e8a
+  .word 0x420, 0xd28fd14, 0x7, 0x281a51fa
+  .word 0x420, 0xd28fd14, 0x1f, 0x1a51fa28
+  .word 0x420, 0xd28fd14, 0x20, 0xd28fd14
+  .word 0x420, 0xd28fd14, 0x21, 0x6947e8a
+  .word 0x420, 0xd28fd14, 0x3f, 0x1a51fa28
+  .word 0x420, 0xd28fd14, 0x40, 0xd28fd14
+  .word 0x420, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x420, 0xd28fd14, 0xffffffe1, 0x6947e8a
+  .word 0x420, 0xd28fd14, 0xffffffff, 0x1a51fa28
+  .word 0x420, 0x100, 0x6d17abfb, 0x2000
+  .word 0x420, 0x2, 0x91691c4d, 0x100000
+  .word 0x420, 0xff00ff, 0xf0a9fed6, 0xfc03fc03
+  .word 0x420, 0xd28fd14, 0x47d42701, 0x6947e8a
+  .word 0x420, 0x3b30, 0x1bea6f23, 0x766
+  .word 0x420, 0x8b, 0xe66e9991, 0x458000
+  .word 0x420, 0xff00ff00, 0x8acac024, 0xff00ff0
+  .word 0x420, 0x12345678, 0xe50086cd, 0xb3c091a2
+  .word 0x420, 0x4, 0x8c8ad616, 0x1000
+  .word 0x420, 0x80000001, 0x4227b76e, 0x60000
+  .word 0x420, 0xffff, 0x1b6cb0b3, 0x1fffe000
+  .word 0x420, 0x7fff, 0xb5075a79, 0x3fff80
+  .word 0x420, 0xd8e1f9, 0x3cef4c40, 0xd8e1f9
+  .word 0x420, 0x3b30, 0x8ba48374, 0x3b30000
+  .word 0x420, 0xffff, 0xeb32c0a6, 0xfc0003ff
+  .word 0x420, 0x100, 0xf20a16ce, 0x4000000
+  .word 0x430, 0x0, 0x0, 0x0
+  .word 0x440, 0x0, 0x0, 0x0
+  .word 0x450, 0x0, 0x0, 0x0
+  .word 0x430, 0x0, 0x21, 0x0
+  .word 0x440, 0x0, 0x21, 0x0
+  .word 0x450, 0x0, 0x21, 0x80000010
+  .word 0x430, 0x0, 0xffffffff, 0x0
+  .word 0x440, 0x0, 0xffffffff, 0x0
+  .word 0x450, 0x0, 0xffffffff, 0xffffffff
+  .word 0x430, 0x7f, 0x20, 0x7f
+  .word 0x440, 0x7f, 0x20, 0x7f
+  .word 0x450, 0x7f, 0x20, 0x20
+  .word 0x430, 0x7f, 0xffffffe1, 0x8000003f
+  .word 0x440, 0x7f, 0xffffffe1, 0x8000003f
+  .word 0x450, 0x7f, 0xffffffe1, 0xfffffff0
+  .word 0x430, 0x100, 0x1f, 0x200
+  .word 0x440, 0x100, 0x1f, 0x200
+  .word 0x450, 0x100, 0x1f, 0x3e
+  .word 0x430, 0x100, 0x80000000, 0x100
+  .word 0x440, 0x100, 0x80000000, 0x100
+  .word 0x450, 0x100, 0x80000000, 0x80000000
+  .word 0x430, 0xffff, 0x7, 0xfe0001ff
+  .word 0x440, 0xffff, 0x7, 0xfe0001ff
+  .word 0x450, 0xffff, 0x7, 0xe000000
+  .word 0x430, 0xffff, 0x40, 0xffff
+  .word 0x440, 0xffff, 0x40, 0xffff
+  .word 0x450, 0xffff, 0x40, 0x40
+  .word 0x430, 0x80000000, 0x1, 0x40000000
+  .word 0x440, 0x80000000, 0x1, 0x40000000
+  .word 0x450, 0x80000000, 0x1, 0x80000000
+  .word 0x430, 0x80000000, 0x3f, 0x1
+  .word 0x440, 0x80000000, 0x3f, 0x1
+  .word 0x450, 0x80000000, 0x3f, 0x7e
+  .word 0x430, 0xffffffff, 0x0, 0xffffffff
+  .word 0x440, 0xffffffff, 0x0, 0xffffffff
+  .word 0x450, 0xffffffff, 0x0, 0x0
+  .word 0x430, 0xffffffff, 0x21, 0xffffffff
+  .word 0x440, 0xffffffff, 0x21, 0xffffffff
+  .word 0x450, 0xffffffff, 0x21, 0x80000010
+  .word 0x430, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x440, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x450, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x430, 0xff00ff00, 0x20, 0xff00ff00
+  .word 0x440, 0xff00ff00, 0x20, 0xff00ff00
+  .word 0x450, 0xff00ff00, 0x20, 0x20
+  .word 0x430, 0xff00ff00, 0xffffffe1, 0x7f807f80
+  .word 0x440, 0xff00ff00, 0xffffffe1, 0x7f807f80
+  .word 0x450, 0xff00ff00, 0xffffffe1, 0xfffffff0
+  .word 0x430, 0x3b30, 0x1f, 0x7660
+  .word 0x440, 0x3b30, 0x1f, 0x7660
+  .word 0x450, 0x3b30, 0x1f, 0x3e
+  .word 0x430, 0x3b30, 0x80000000, 0x3b30
+  .word 0x440, 0x3b30, 0x80000000, 0x3b30
+  .word 0x450, 0x3b30, 0x80000000, 0x80000000
+  .word 0x430, 0x6c, 0x7, 0xd8000000
+  .word 0x440, 0x6c, 0x7, 0xd8000000
+  .word 0x450, 0x6c, 0x7, 0xe000000
+  .word 0x430, 0x6c, 0x40, 0x6c
+  .word 0x440, 0x6c, 0x40, 0x6c
+  .word 0x450, 0x6c, 0x40, 0x40
+  .word 0x430, 0x4, 0x1, 0x2
+  .word 0x440, 0x4, 0x1, 0x2
+  .word 0x450, 0x4, 0x1, 0x80000000
+  .word 0x430, 0x4, 0x3f, 0x8
+  .word 0x440, 0x4, 0x3f, 0x8
+  .word 0x450, 0x4, 0x3f, 0x7e
+  .word 0x430, 0x73698785, 0x0, 0x73698785
+  .word 0x440, 0x73698785, 0x0, 0x73698785
+  .word 0x450, 0x73698785, 0x0, 0x0
+  .word 0x430, 0x73698785, 0x21, 0xb9b4c3c2
+  .word 0x440, 0x73698785, 0x21, 0xb9b4c3c2
+  .word 0x450, 0x73698785, 0x21, 0x80000010
+  .word 0x430, 0x73698785, 0xffffffff, 0xe6d30f0a
+  .word 0x440, 0x73698785, 0xffffffff, 0xe6d30f0a
+  .word 0x450, 0x73698785, 0xffffffff, 0xffffffff
+  .word 0x430, 0x35eb776b, 0x20, 0x35eb776b
+  .word 0x440, 0x35eb776b, 0x20, 0x35eb776b
+  .word 0x450, 0x35eb776b, 0x20, 0x20
+  .word 0x430, 0x35eb776b, 0xffffffe1, 0x9af5bbb5
+  .word 0x440, 0x35eb776b, 0xffffffe1, 0x9af5bbb5
+  .word 0x450, 0x35eb776b, 0xffffffe1, 0xfffffff0
+  .word 0x430, 0xd28fd14, 0x1f, 0x1a51fa28
+  .word 0x440, 0xd28fd14, 0x1f, 0x1a51fa28
+  .word 0x450, 0xd28fd14, 0x1f, 0x3e
+  .word 0x430, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x440, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x450, 0xd28fd14, 0x80000000, 0x80000000
+  .word 0x430, 0xff00ff, 0xf0a9fed6, 0xfc03fc03
+  .word 0x440, 0xff00ff, 0xf0a9fed6, 0xfc03fc03
+  .word 0x450, 0xff00ff, 0xf0a9fed6, 0xa7fb5bc2
+  .word 0x430, 0x12345678, 0xe50086cd, 0xb3c091a2
+  .word 0x440, 0x12345678, 0xe50086cd, 0xb3c091a2
+  .word 0x450, 0x12345678, 0xe50086cd, 0x366f2804
+  .word 0x430, 0xd8e1f9, 0x3cef4c40, 0xd8e1f9
+  .word 0x440, 0xd8e1f9, 0x3cef4c40, 0xd8e1f9
+  .word 0x450, 0xd8e1f9, 0x3cef4c40, 0x3cef4c40
+  .word 0x460, 0x0, 0x12345687, 0x0
+  .word 0x470, 0x87654321, 0x0, 0x87654321
+  .word 0x480, 0x0, 0x0, 0x0
+  .word 0x480, 0x0, 0x1, 0x0
+  .word 0x480, 0x0, 0x7, 0x0
+  .word 0x480, 0x0, 0x1f, 0x0
+  .word 0x480, 0x0, 0x20, 0x0
+  .word 0x480, 0x0, 0x21, 0x0
+  .word 0x480, 0x0, 0x3f, 0x0
+  .word 0x480, 0x0, 0x40, 0x0
+  .word 0x480, 0x0, 0x80000000, 0x0
+  .word 0x480, 0x0, 0xffffffe1, 0x0
+  .word 0x480, 0x0, 0xffffffff, 0x0
+  .word 0x480, 0x7f, 0x0, 0x7e
+  .word 0x480, 0x7f, 0x1, 0x7d
+  .word 0x480, 0x7f, 0x7, 0x7f
+  .word 0x480, 0x7f, 0x1f, 0x7f
+  .word 0x480, 0x7f, 0x20, 0x7e
+  .word 0x480, 0x7f, 0x21, 0x7d
+  .word 0x480, 0x7f, 0x3f, 0x7f
+  .word 0x480, 0x7f, 0x40, 0x7e
+  .word 0x480, 0x7f, 0x80000000, 0x7e
+  .word 0x480, 0x7f, 0xffffffe1, 0x7d
+  .word 0x480, 0x7f, 0xffffffff, 0x7f
+  .word 0x480, 0x100, 0x0, 0x100
+  .word 0x480, 0x100, 0x1, 0x100
+  .word 0x480, 0x100, 0x7, 0x100
+  .word 0x480, 0x100, 0x1f, 0x100
+  .word 0x480, 0x100, 0x20, 0x100
+  .word 0x480, 0x100, 0x21, 0x100
+  .word 0x480, 0x100, 0x3f, 0x100
+  .word 0x480, 0x100, 0x40, 0x100
+  .word 0x480, 0x100, 0x80000000, 0x100
+  .word 0x480, 0x100, 0xffffffe1, 0x100
+  .word 0x480, 0x100, 0xffffffff, 0x100
+  .word 0x480, 0xffff, 0x0, 0xfffe
+  .word 0x480, 0xffff, 0x1, 0xfffd
+  .word 0x480, 0xffff, 0x7, 0xff7f
+  .word 0x480, 0xffff, 0x1f, 0xffff
+  .word 0x480, 0xffff, 0x20, 0xfffe
+  .word 0x480, 0xffff, 0x21, 0xfffd
+  .word 0x480, 0xffff, 0x3f, 0xffff
+  .word 0x480, 0xffff, 0x40, 0xfffe
+  .word 0x480, 0xffff, 0x80000000, 0xfffe
+  .word 0x480, 0xffff, 0xffffffe1, 0xfffd
+  .word 0x480, 0xffff, 0xffffffff, 0xffff
+  .word 0x480, 0x80000000, 0x0, 0x80000000
+  .word 0x480, 0x80000000, 0x1, 0x80000000
+  .word 0x480, 0x80000000, 0x7, 0x80000000
+  .word 0x480, 0x80000000, 0x1f, 0x0
+  .word 0x480, 0x80000000, 0x20, 0x80000000
+  .word 0x480, 0x80000000, 0x21, 0x80000000
+  .word 0x480, 0x80000000, 0x3f, 0x0
+  .word 0x480, 0x80000000, 0x40, 0x80000000
+  .word 0x480, 0x80000000, 0x80000000, 0x80000000
+  .word 0x480, 0x80000000, 0xffffffe1, 0x80000000
+  .word 0x480, 0x80000000, 0xffffffff, 0x0
+  .word 0x480, 0xffffffff, 0x0, 0xfffffffe
+  .word 0x480, 0xffffffff, 0x1, 0xfffffffd
+  .word 0x480, 0xffffffff, 0x7, 0xffffff7f
+  .word 0x480, 0xffffffff, 0x1f, 0x7fffffff
+  .word 0x480, 0xffffffff, 0x20, 0xfffffffe
+  .word 0x480, 0xffffffff, 0x21, 0xfffffffd
+  .word 0x480, 0xffffffff, 0x3f, 0x7fffffff
+  .word 0x480, 0xffffffff, 0x40, 0xfffffffe
+  .word 0x480, 0xffffffff, 0x80000000, 0xfffffffe
+  .word 0x480, 0xffffffff, 0xffffffe1, 0xfffffffd
+  .word 0x480, 0xffffffff, 0xffffffff, 0x7fffffff
+  .word 0x480, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x480, 0xff00ff00, 0x1, 0xff00ff00
+  .word 0x480, 0xff00ff00, 0x7, 0xff00ff00
+  .word 0x480, 0xff00ff00, 0x1f, 0x7f00ff00
+  .word 0x480, 0xff00ff00, 0x20, 0xff00ff00
+  .word 0x480, 0xff00ff00, 0x21, 0xff00ff00
+  .word 0x480, 0xff00ff00, 0x3f, 0x7f00ff00
+  .word 0x480, 0xff00ff00, 0x40, 0xff00ff00
+  .word 0x480, 0xff00ff00, 0x80000000, 0xff00ff00
+  .word 0x480, 0xff00ff00, 0xffffffe1, 0xff00ff00
+  .word 0x480, 0xff00ff00, 0xffffffff, 0x7f00ff00
+  .word 0x480, 0x3b30, 0x0, 0x3b30
+  .word 0x480, 0x3b30, 0x1, 0x3b30
+  .word 0x480, 0x3b30, 0x7, 0x3b30
+  .word 0x480, 0x3b30, 0x1f, 0x3b30
+  .word 0x480, 0x3b30, 0x20, 0x3b30
+  .word 0x480, 0x3b30, 0x21, 0x3b30
+  .word 0x480, 0x3b30, 0x3f, 0x3b30
+  .word 0x480, 0x3b30, 0x40, 0x3b30
+  .word 0x480, 0x3b30, 0x80000000, 0x3b30
+  .word 0x480, 0x3b30, 0xffffffe1, 0x3b30
+  .word 0x480, 0x3b30, 0xffffffff, 0x3b30
+  .word 0x480, 0x6c, 0x0, 0x6c
+  .word 0x480, 0x6c, 0x1, 0x6c
+  .word 0x480, 0x6c, 0x7, 0x6c
+  .word 0x480, 0x6c, 0x1f, 0x6c
+  .word 0x480, 0x6c, 0x20, 0x6c
+  .word 0x480, 0x6c, 0x21, 0x6c
+  .word 0x480, 0x6c, 0x3f, 0x6c
+  .word 0x480, 0x6c, 0x40, 0x6c
+  .word 0x480, 0x6c, 0x80000000, 0x6c
+  .word 0x480, 0x6c, 0xffffffe1, 0x6c
+  .word 0x480, 0x6c, 0xffffffff, 0x6c
+  .word 0x480, 0x4, 0x0, 0x4
+  .word 0x480, 0x4, 0x1, 0x4
+  .word 0x480, 0x4, 0x7, 0x4
+  .word 0x480, 0x4, 0x1f, 0x4
+  .word 0x480, 0x4, 0x20, 0x4
+  .word 0x480, 0x4, 0x21, 0x4
+  .word 0x480, 0x4, 0x3f, 0x4
+  .word 0x480, 0x4, 0x40, 0x4
+  .word 0x480, 0x4, 0x80000000, 0x4
+  .word 0x480, 0x4, 0xffffffe1, 0x4
+  .word 0x480, 0x4, 0xffffffff, 0x4
+  .word 0x480, 0x73698785, 0x0, 0x73698784
+  .word 0x480, 0x73698785, 0x1, 0x73698785
+  .word 0x480, 0x73698785, 0x7, 0x73698705
+  .word 0x480, 0x73698785, 0x1f, 0x73698785
+  .word 0x480, 0x73698785, 0x20, 0x73698784
+  .word 0x480, 0x73698785, 0x21, 0x73698785
+  .word 0x480, 0x73698785, 0x3f, 0x73698785
+  .word 0x480, 0x73698785, 0x40, 0x73698784
+  .word 0x480, 0x73698785, 0x80000000, 0x73698784
+  .word 0x480, 0x73698785, 0xffffffe1, 0x73698785
+  .word 0x480, 0x73698785, 0xffffffff, 0x73698785
+  .word 0x480, 0x35eb776b, 0x0, 0x35eb776a
+  .word 0x480, 0x35eb776b, 0x1, 0x35eb7769
+  .word 0x480, 0x35eb776b, 0x7, 0x35eb776b
+  .word 0x480, 0x35eb776b, 0x1f, 0x35eb776b
+  .word 0x480, 0x35eb776b, 0x20, 0x35eb776a
+  .word 0x480, 0x35eb776b, 0x21, 0x35eb7769
+  .word 0x480, 0x35eb776b, 0x3f, 0x35eb776b
+  .word 0x480, 0x35eb776b, 0x40, 0x35eb776a
+  .word 0x480, 0x35eb776b, 0x80000000, 0x35eb776a
+  .word 0x480, 0x35eb776b, 0xffffffe1, 0x35eb7769
+  .word 0x480, 0x35eb776b, 0xffffffff, 0x35eb776b
+  .word 0x480, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x480, 0xd28fd14, 0x1, 0xd28fd14
+  .word 0x480, 0xd28fd14, 0x7, 0xd28fd14
+  .word 0x480, 0xd28fd14, 0x1f, 0xd28fd14
+  .word 0x480, 0xd28fd14, 0x20, 0xd28fd14
+  .word 0x480, 0xd28fd14, 0x21, 0xd28fd14
+  .word 0x480, 0xd28fd14, 0x3f, 0xd28fd14
+  .word 0x480, 0xd28fd14, 0x40, 0xd28fd14
+  .word 0x480, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x480, 0xd28fd14, 0xffffffe1, 0xd28fd14
+  .word 0x480, 0xd28fd14, 0xffffffff, 0xd28fd14
+  .word 0x480, 0x6c, 0x2ad18910, 0x6c
+  .word 0x480, 0xe69, 0xf99a0630, 0xe69
+  .word 0x480, 0x2, 0xe50c2a6, 0x2
+  .word 0x480, 0x215b8, 0x64b4aca8, 0x214b8
+  .word 0x480, 0x1, 0x299e2a64, 0x1
+  .word 0x480, 0xfffffffe, 0xafecb0c5, 0xffffffde
+  .word 0x480, 0x0, 0xf946bd51, 0x0
+  .word 0x480, 0xfffffffe, 0xce121a66, 0xffffffbe
+  .word 0x480, 0x7f, 0x89e16f70, 0x7f
+  .word 0x480, 0xe69, 0xbfbf67df, 0xe69
+  .word 0x480, 0xff, 0x589ccc63, 0xf7
+  .word 0x480, 0x1, 0xf971b2c9, 0x1
+  .word 0x480, 0x6c, 0x7d97c649, 0x6c
+  .word 0x480, 0x80000000, 0x97866f3, 0x80000000
+  .word 0x480, 0x80, 0x43aa4480, 0x80
+  .word 0x480, 0x4, 0x8c5bb389, 0x4
+  .word 0x490, 0x0, 0x0, 0x0
+  .word 0x4a0, 0x0, 0x0, 0x0
+  .word 0x4b0, 0x0, 0x0, 0x0
+  .word 0x490, 0x0, 0x21, 0x0
+  .word 0x4a0, 0x0, 0x21, 0x0
+  .word 0x4b0, 0x0, 0x21, 0x21
+  .word 0x490, 0x0, 0xffffffff, 0x0
+  .word 0x4a0, 0x0, 0xffffffff, 0x0
+  .word 0x4b0, 0x0, 0xffffffff, 0x7fffffff
+  .word 0x490, 0x7f, 0x20, 0x7e
+  .word 0x4a0, 0x7f, 0x20, 0x7e
+  .word 0x4b0, 0x7f, 0x20, 0x20
+  .word 0x490, 0x7f, 0xffffffe1, 0x7d
+  .word 0x4a0, 0x7f, 0xffffffe1, 0x7d
+  .word 0x4b0, 0x7f, 0xffffffe1, 0xffffffe1
+  .word 0x490, 0x100, 0x1f, 0x100
+  .word 0x4a0, 0x100, 0x1f, 0x100
+  .word 0x4b0, 0x100, 0x1f, 0x1f
+  .word 0x490, 0x100, 0x80000000, 0x100
+  .word 0x4a0, 0x100, 0x80000000, 0x100
+  .word 0x4b0, 0x100, 0x80000000, 0x80000000
+  .word 0x490, 0xffff, 0x7, 0xff7f
+  .word 0x4a0, 0xffff, 0x7, 0xff7f
+  .word 0x4b0, 0xffff, 0x7, 0x7
+  .word 0x490, 0xffff, 0x40, 0xfffe
+  .word 0x4a0, 0xffff, 0x40, 0xfffe
+  .word 0x4b0, 0xffff, 0x40, 0x40
+  .word 0x490, 0x80000000, 0x1, 0x80000000
+  .word 0x4a0, 0x80000000, 0x1, 0x80000000
+  .word 0x4b0, 0x80000000, 0x1, 0x1
+  .word 0x490, 0x80000000, 0x3f, 0x0
+  .word 0x4a0, 0x80000000, 0x3f, 0x0
+  .word 0x4b0, 0x80000000, 0x3f, 0x3f
+  .word 0x490, 0xffffffff, 0x0, 0xfffffffe
+  .word 0x4a0, 0xffffffff, 0x0, 0xfffffffe
+  .word 0x4b0, 0xffffffff, 0x0, 0x0
+  .word 0x490, 0xffffffff, 0x21, 0xfffffffd
+  .word 0x4a0, 0xffffffff, 0x21, 0xfffffffd
+  .word 0x4b0, 0xffffffff, 0x21, 0x21
+  .word 0x490, 0xffffffff, 0xffffffff, 0x7fffffff
+  .word 0x4a0, 0xffffffff, 0xffffffff, 0x7fffffff
+  .word 0x4b0, 0xffffffff, 0xffffffff, 0x7fffffff
+  .word 0x490, 0xff00ff00, 0x20, 0xff00ff00
+  .word 0x4a0, 0xff00ff00, 0x20, 0xff00ff00
+  .word 0x4b0, 0xff00ff00, 0x20, 0x20
+  .word 0x490, 0xff00ff00, 0xffffffe1, 0xff00ff00
+  .word 0x4a0, 0xff00ff00, 0xffffffe1, 0xff00ff00
+  .word 0x4b0, 0xff00ff00, 0xffffffe1, 0xffffffe1
+  .word 0x490, 0x3b30, 0x1f, 0x3b30
+  .word 0x4a0, 0x3b30, 0x1f, 0x3b30
+  .word 0x4b0, 0x3b30, 0x1f, 0x1f
+  .word 0x490, 0x3b30, 0x80000000, 0x3b30
+  .word 0x4a0, 0x3b30, 0x80000000, 0x3b30
+  .word 0x4b0, 0x3b30, 0x80000000, 0x80000000
+  .word 0x490, 0x6c, 0x7, 0x6c
+  .word 0x4a0, 0x6c, 0x7, 0x6c
+  .word 0x4b0, 0x6c, 0x7, 0x7
+  .word 0x490, 0x6c, 0x40, 0x6c
+  .word 0x4a0, 0x6c, 0x40, 0x6c
+  .word 0x4b0, 0x6c, 0x40, 0x40
+  .word 0x490, 0x4, 0x1, 0x4
+  .word 0x4a0, 0x4, 0x1, 0x4
+  .word 0x4b0, 0x4, 0x1, 0x1
+  .word 0x490, 0x4, 0x3f, 0x4
+  .word 0x4a0, 0x4, 0x3f, 0x4
+  .word 0x4b0, 0x4, 0x3f, 0x3f
+  .word 0x490, 0x73698785, 0x0, 0x73698784
+  .word 0x4a0, 0x73698785, 0x0, 0x73698784
+  .word 0x4b0, 0x73698785, 0x0, 0x0
+  .word 0x490, 0x73698785, 0x21, 0x73698785
+  .word 0x4a0, 0x73698785, 0x21, 0x73698785
+  .word 0x4b0, 0x73698785, 0x21, 0x21
+  .word 0x490, 0x73698785, 0xffffffff, 0x73698785
+  .word 0x4a0, 0x73698785, 0xffffffff, 0x73698785
+  .word 0x4b0, 0x73698785, 0xffffffff, 0x7fffffff
+  .word 0x490, 0x35eb776b, 0x20, 0x35eb776a
+  .word 0x4a0, 0x35eb776b, 0x20, 0x35eb776a
+  .word 0x4b0, 0x35eb776b, 0x20, 0x20
+  .word 0x490, 0x35eb776b, 0xffffffe1, 0x35eb7769
+  .word 0x4a0, 0x35eb776b, 0xffffffe1, 0x35eb7769
+  .word 0x4b0, 0x35eb776b, 0xffffffe1, 0xffffffe1
+  .word 0x490, 0xd28fd14, 0x1f, 0xd28fd14
+  .word 0x4a0, 0xd28fd14, 0x1f, 0xd28fd14
+  .word 0x4b0, 0xd28fd14, 0x1f, 0x1f
+  .word 0x490, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x4a0, 0xd28fd14, 0x80000000, 0xd28fd14
+  .word 0x4b0, 0xd28fd14, 0x80000000, 0x80000000
+  .word 0x490, 0x2, 0xe50c2a6, 0x2
+  .word 0x4a0, 0x2, 0xe50c2a6, 0x2
+  .word 0x4b0, 0x2, 0xe50c2a6, 0xe50c2a6
+  .word 0x490, 0xfffffffe, 0xce121a66, 0xffffffbe
+  .word 0x4a0, 0xfffffffe, 0xce121a66, 0xffffffbe
+  .word 0x4b0, 0xfffffffe, 0xce121a66, 0xce121a26
+  .word 0x490, 0x6c, 0x7d97c649, 0x6c
+  .word 0x4a0, 0x6c, 0x7d97c649, 0x6c
+  .word 0x4b0, 0x6c, 0x7d97c649, 0x7d97c449
+  .word 0x4c0, 0x0, 0x12345687, 0x0
+  .word 0x4d0, 0x87654321, 0x0, 0x87654320
+  .word 0x4e0, 0x0, 0x0, 0x1
+  .word 0x4e0, 0x0, 0x1, 0x2
+  .word 0x4e0, 0x0, 0x7, 0x80
+  .word 0x4e0, 0x0, 0x1f, 0x80000000
+  .word 0x4e0, 0x0, 0x20, 0x1
+  .word 0x4e0, 0x0, 0x21, 0x2
+  .word 0x4e0, 0x0, 0x3f, 0x80000000
+  .word 0x4e0, 0x0, 0x40, 0x1
+  .word 0x4e0, 0x0, 0x80000000, 0x1
+  .word 0x4e0, 0x0, 0xffffffe1, 0x2
+  .word 0x4e0, 0x0, 0xffffffff, 0x80000000
+  .word 0x4e0, 0x7f, 0x0, 0x7f
+  .word 0x4e0, 0x7f, 0x1, 0x7f
+  .word 0x4e0, 0x7f, 0x7, 0xff
+  .word 0x4e0, 0x7f, 0x1f, 0x8000007f
+  .word 0x4e0, 0x7f, 0x20, 0x7f
+  .word 0x4e0, 0x7f, 0x21, 0x7f
+  .word 0x4e0, 0x7f, 0x3f, 0x8000007f
+  .word 0x4e0, 0x7f, 0x40, 0x7f
+  .word 0x4e0, 0x7f, 0x80000000, 0x7f
+  .word 0x4e0, 0x7f, 0xffffffe1, 0x7f
+  .word 0x4e0, 0x7f, 0xffffffff, 0x8000007f
+  .word 0x4e0, 0x100, 0x0, 0x101
+  .word 0x4e0, 0x100, 0x1, 0x102
+  .word 0x4e0, 0x100, 0x7, 0x180
+  .word 0x4e0, 0x100, 0x1f, 0x80000100
+  .word 0x4e0, 0x100, 0x20, 0x101
+  .word 0x4e0, 0x100, 0x21, 0x102
+  .word 0x4e0, 0x100, 0x3f, 0x80000100
+  .word 0x4e0, 0x100, 0x40, 0x101
+  .word 0x4e0, 0x100, 0x80000000, 0x101
+  .word 0x4e0, 0x100, 0xffffffe1, 0x102
+  .word 0x4e0, 0x100, 0xffffffff, 0x80000100
+  .word 0x4e0, 0xffff, 0x0, 0xffff
+  .word 0x4e0, 0xffff, 0x1, 0xffff
+  .word 0x4e0, 0xffff, 0x7, 0xffff
+  .word 0x4e0, 0xffff, 0x1f, 0x8000ffff
+  .word 0x4e0, 0xffff, 0x20, 0xffff
+  .word 0x4e0, 0xffff, 0x21, 0xffff
+  .word 0x4e0, 0xffff, 0x3f, 0x8000ffff
+  .word 0x4e0, 0xffff, 0x40, 0xffff
+  .word 0x4e0, 0xffff, 0x80000000, 0xffff
+  .word 0x4e0, 0xffff, 0xffffffe1, 0xffff
+  .word 0x4e0, 0xffff, 0xffffffff, 0x8000ffff
+  .word 0x4e0, 0x80000000, 0x0, 0x80000001
+  .word 0x4e0, 0x80000000, 0x1, 0x80000002
+  .word 0x4e0, 0x80000000, 0x7, 0x80000080
+  .word 0x4e0, 0x80000000, 0x1f, 0x80000000
+  .word 0x4e0, 0x80000000, 0x20, 0x80000001
+  .word 0x4e0, 0x80000000, 0x21, 0x80000002
+  .word 0x4e0, 0x80000000, 0x3f, 0x80000000
+  .word 0x4e0, 0x80000000, 0x40, 0x80000001
+  .word 0x4e0, 0x80000000, 0x80000000, 0x80000001
+  .word 0x4e0, 0x80000000, 0xffffffe1, 0x80000002
+  .word 0x4e0, 0x80000000, 0xffffffff, 0x80000000
+  .word 0x4e0, 0xffffffff, 0x0, 0xffffffff
+  .word 0x4e0, 0xffffffff, 0x1, 0xffffffff
+  .word 0x4e0, 0xffffffff, 0x7, 0xffffffff
+  .word 0x4e0, 0xffffffff, 0x1f, 0xffffffff
+  .word 0x4e0, 0xffffffff, 0x20, 0xffffffff
+  .word 0x4e0, 0xffffffff, 0x21, 0xffffffff
+  .word 0x4e0, 0xffffffff, 0x3f, 0xffffffff
+  .word 0x4e0, 0xffffffff, 0x40, 0xffffffff
+  .word 0x4e0, 0xffffffff, 0x80000000, 0xffffffff
+  .word 0x4e0, 0xffffffff, 0xffffffe1, 0xffffffff
+  .word 0x4e0, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x4e0, 0xff00ff00, 0x0, 0xff00ff01
+  .word 0x4e0, 0xff00ff00, 0x1, 0xff00ff02
+  .word 0x4e0, 0xff00ff00, 0x7, 0xff00ff80
+  .word 0x4e0, 0xff00ff00, 0x1f, 0xff00ff00
+  .word 0x4e0, 0xff00ff00, 0x20, 0xff00ff01
+  .word 0x4e0, 0xff00ff00, 0x21, 0xff00ff02
+  .word 0x4e0, 0xff00ff00, 0x3f, 0xff00ff00
+  .word 0x4e0, 0xff00ff00, 0x40, 0xff00ff01
+  .word 0x4e0, 0xff00ff00, 0x80000000, 0xff00ff01
+  .word 0x4e0, 0xff00ff00, 0xffffffe1, 0xff00ff02
+  .word 0x4e0, 0xff00ff00, 0xffffffff, 0xff00ff00
+  .word 0x4e0, 0x3b30, 0x0, 0x3b31
+  .word 0x4e0, 0x3b30, 0x1, 0x3b32
+  .word 0x4e0, 0x3b30, 0x7, 0x3bb0
+  .word 0x4e0, 0x3b30, 0x1f, 0x80003b30
+  .word 0x4e0, 0x3b30, 0x20, 0x3b31
+  .word 0x4e0, 0x3b30, 0x21, 0x3b32
+  .word 0x4e0, 0x3b30, 0x3f, 0x80003b30
+  .word 0x4e0, 0x3b30, 0x40, 0x3b31
+  .word 0x4e0, 0x3b30, 0x80000000, 0x3b31
+  .word 0x4e0, 0x3b30, 0xffffffe1, 0x3b32
+  .word 0x4e0, 0x3b30, 0xffffffff, 0x80003b30
+  .word 0x4e0, 0x6c, 0x0, 0x6d
+  .word 0x4e0, 0x6c, 0x1, 0x6e
+  .word 0x4e0, 0x6c, 0x7, 0xec
+  .word 0x4e0, 0x6c, 0x1f, 0x8000006c
+  .word 0x4e0, 0x6c, 0x20, 0x6d
+  .word 0x4e0, 0x6c, 0x21, 0x6e
+  .word 0x4e0, 0x6c, 0x3f, 0x8000006c
+  .word 0x4e0, 0x6c, 0x40, 0x6d
+  .word 0x4e0, 0x6c, 0x80000000, 0x6d
+  .word 0x4e0, 0x6c, 0xffffffe1, 0x6e
+  .word 0x4e0, 0x6c, 0xffffffff, 0x8000006c
+  .word 0x4e0, 0x4, 0x0, 0x5
+  .word 0x4e0, 0x4, 0x1, 0x6
+  .word 0x4e0, 0x4, 0x7, 0x84
+  .word 0x4e0, 0x4, 0x1f, 0x80000004
+  .word 0x4e0, 0x4, 0x20, 0x5
+  .word 0x4e0, 0x4, 0x21, 0x6
+  .word 0x4e0, 0x4, 0x3f, 0x80000004
+  .word 0x4e0, 0x4, 0x40, 0x5
+  .word 0x4e0, 0x4, 0x80000000, 0x5
+  .word 0x4e0, 0x4, 0xffffffe1, 0x6
+  .word 0x4e0, 0x4, 0xffffffff, 0x80000004
+  .word 0x4e0, 0x73698785, 0x0, 0x73698785
+  .word 0x4e0, 0x73698785, 0x1, 0x73698787
+  .word 0x4e0, 0x73698785, 0x7, 0x73698785
+  .word 0x4e0, 0x73698785, 0x1f, 0xf3698785
+  .word 0x4e0, 0x73698785, 0x20, 0x73698785
+  .word 0x4e0, 0x73698785, 0x21, 0x73698787
+  .word 0x4e0, 0x73698785, 0x3f, 0xf3698785
+  .word 0x4e0, 0x73698785, 0x40, 0x73698785
+  .word 0x4e0, 0x73698785, 0x80000000, 0x73698785
+  .word 0x4e0, 0x73698785, 0xffffffe1, 0x73698787
+  .word 0x4e0, 0x73698785, 0xffffffff, 0xf3698785
+  .word 0x4e0, 0x35eb776b, 0x0, 0x35eb776b
+  .word 0x4e0, 0x35eb776b, 0x1, 0x35eb776b
+  .word 0x4e0, 0x35eb776b, 0x7, 0x35eb77eb
+  .word 0x4e0, 0x35eb776b, 0x1f, 0xb5eb776b
+  .word 0x4e0, 0x35eb776b, 0x20, 0x35eb776b
+  .word 0x4e0, 0x35eb776b, 0x21, 0x35eb776b
+  .word 0x4e0, 0x35eb776b, 0x3f, 0xb5eb776b
+  .word 0x4e0, 0x35eb776b, 0x40, 0x35eb776b
+  .word 0x4e0, 0x35eb776b, 0x80000000, 0x35eb776b
+  .word 0x4e0, 0x35eb776b, 0xffffffe1, 0x35eb776b
+  .word 0x4e0, 0x35eb776b, 0xffffffff, 0xb5eb776b
+  .word 0x4e0, 0xd28fd14, 0x0, 0xd28fd15
+  .word 0x4e0, 0xd28fd14, 0x1, 0xd28fd16
+  .word 0x4e0, 0xd28fd14, 0x7, 0xd28fd94
+  .word 0x4e0, 0xd28fd14, 0x1f, 0x8d28fd14
+  .word 0x4e0, 0xd28fd14, 0x20, 0xd28fd15
+  .word 0x4e0, 0xd28fd14, 0x21, 0xd28fd16
+  .word 0x4e0, 0xd28fd14, 0x3f, 0x8d28fd14
+  .word 0x4e0, 0xd28fd14, 0x40, 0xd28fd15
+  .word 0x4e0, 0xd28fd14, 0x80000000, 0xd28fd15
+  .word 0x4e0, 0xd28fd14, 0xffffffe1, 0xd28fd16
+  .word 0x4e0, 0xd28fd14, 0xffffffff, 0x8d28fd14
+  .word 0x4e0, 0x80000000, 0xc1445bf3, 0x80080000
+  .word 0x4e0, 0x4, 0xf350eed8, 0x1000004
+  .word 0x4e0, 0xff00ff00, 0x37489279, 0xff00ff00
+  .word 0x4e0, 0xff, 0x1a7f33c1, 0xff
+  .word 0x4e0, 0xb7ce5ed, 0x876a93a7, 0xb7ce5ed
+  .word 0x4e0, 0x10000, 0xb0cbc92a, 0x10400
+  .word 0x4e0, 0x10, 0x8ed86099, 0x2000010
+  .word 0x4e0, 0xffffffff, 0x40c8b1dc, 0xffffffff
+  .word 0x4e0, 0x100, 0x6bf7e9d7, 0x800100
+  .word 0x4e0, 0x10000, 0xe69f6ada, 0x4010000
+  .word 0x4e0, 0x0, 0x71d75e96, 0x400000
+  .word 0x4e0, 0x3b30, 0xa816718c, 0x3b30
+  .word 0x4e0, 0x215b8, 0xd0524f5e, 0x400215b8
+  .word 0x4e0, 0x10000, 0xe52aa01a, 0x4010000
+  .word 0x4e0, 0x215b8, 0x11cfad0d, 0x235b8
+  .word 0x4e0, 0xffffffff, 0x8bb9709d, 0xffffffff
+  .word 0x4f0, 0x0, 0x0, 0x1
+  .word 0x500, 0x0, 0x0, 0x1
+  .word 0x510, 0x0, 0x0, 0x1
+  .word 0x4f0, 0x0, 0x21, 0x2
+  .word 0x500, 0x0, 0x21, 0x2
+  .word 0x510, 0x0, 0x21, 0x23
+  .word 0x4f0, 0x0, 0xffffffff, 0x80000000
+  .word 0x500, 0x0, 0xffffffff, 0x80000000
+  .word 0x510, 0x0, 0xffffffff, 0xffffffff
+  .word 0x4f0, 0x7f, 0x20, 0x7f
+  .word 0x500, 0x7f, 0x20, 0x7f
+  .word 0x510, 0x7f, 0x20, 0x21
+  .word 0x4f0, 0x7f, 0xffffffe1, 0x7f
+  .word 0x500, 0x7f, 0xffffffe1, 0x7f
+  .word 0x510, 0x7f, 0xffffffe1, 0xffffffe3
+  .word 0x4f0, 0x100, 0x1f, 0x80000100
+  .word 0x500, 0x100, 0x1f, 0x80000100
+  .word 0x510, 0x100, 0x1f, 0x8000001f
+  .word 0x4f0, 0x100, 0x80000000, 0x101
+  .word 0x500, 0x100, 0x80000000, 0x101
+  .word 0x510, 0x100, 0x80000000, 0x80000001
+  .word 0x4f0, 0xffff, 0x7, 0xffff
+  .word 0x500, 0xffff, 0x7, 0xffff
+  .word 0x510, 0xffff, 0x7, 0x87
+  .word 0x4f0, 0xffff, 0x40, 0xffff
+  .word 0x500, 0xffff, 0x40, 0xffff
+  .word 0x510, 0xffff, 0x40, 0x41
+  .word 0x4f0, 0x80000000, 0x1, 0x80000002
+  .word 0x500, 0x80000000, 0x1, 0x80000002
+  .word 0x510, 0x80000000, 0x1, 0x3
+  .word 0x4f0, 0x80000000, 0x3f, 0x80000000
+  .word 0x500, 0x80000000, 0x3f, 0x80000000
+  .word 0x510, 0x80000000, 0x3f, 0x8000003f
+  .word 0x4f0, 0xffffffff, 0x0, 0xffffffff
+  .word 0x500, 0xffffffff, 0x0, 0xffffffff
+  .word 0x510, 0xffffffff, 0x0, 0x1
+  .word 0x4f0, 0xffffffff, 0x21, 0xffffffff
+  .word 0x500, 0xffffffff, 0x21, 0xffffffff
+  .word 0x510, 0xffffffff, 0x21, 0x23
+  .word 0x4f0, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x500, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x510, 0xffffffff, 0xffffffff, 0xffffffff
+  .word 0x4f0, 0xff00ff00, 0x20, 0xff00ff01
+  .word 0x500, 0xff00ff00, 0x20, 0xff00ff01
+  .word 0x510, 0xff00ff00, 0x20, 0x21
+  .word 0x4f0, 0xff00ff00, 0xffffffe1, 0xff00ff02
+  .word 0x500, 0xff00ff00, 0xffffffe1, 0xff00ff02
+  .word 0x510, 0xff00ff00, 0xffffffe1, 0xffffffe3
+  .word 0x4f0, 0x3b30, 0x1f, 0x80003b30
+  .word 0x500, 0x3b30, 0x1f, 0x80003b30
+  .word 0x510, 0x3b30, 0x1f, 0x8000001f
+  .word 0x4f0, 0x3b30, 0x80000000, 0x3b31
+  .word 0x500, 0x3b30, 0x80000000, 0x3b31
+  .word 0x510, 0x3b30, 0x80000000, 0x80000001
+  .word 0x4f0, 0x6c, 0x7, 0xec
+  .word 0x500, 0x6c, 0x7, 0xec
+  .word 0x510, 0x6c, 0x7, 0x87
+  .word 0x4f0, 0x6c, 0x40, 0x6d
+  .word 0x500, 0x6c, 0x40, 0x6d
+  .word 0x510, 0x6c, 0x40, 0x41
+  .word 0x4f0, 0x4, 0x1, 0x6
+  .word 0x500, 0x4, 0x1, 0x6
+  .word 0x510, 0x4, 0x1, 0x3
+  .word 0x4f0, 0x4, 0x3f, 0x80000004
+  .word 0x500, 0x4, 0x3f, 0x80000004
+  .word 0x510, 0x4, 0x3f, 0x8000003f
+  .word 0x4f0, 0x73698785, 0x0, 0x73698785
+  .word 0x500, 0x73698785, 0x0, 0x73698785
+  .word 0x510, 0x73698785, 0x0, 0x1
+  .word 0x4f0, 0x73698785, 0x21, 0x73698787
+  .word 0x500, 0x73698785, 0x21, 0x73698787
+  .word 0x510, 0x73698785, 0x21, 0x23
+  .word 0x4f0, 0x73698785, 0xffffffff, 0xf3698785
+  .word 0x500, 0x73698785, 0xffffffff, 0xf3698785
+  .word 0x510, 0x73698785, 0xffffffff, 0xffffffff
+  .word 0x4f0, 0x35eb776b, 0x20, 0x35eb776b
+  .word 0x500, 0x35eb776b, 0x20, 0x35eb776b
+  .word 0x510, 0x35eb776b, 0x20, 0x21
+  .word 0x4f0, 0x35eb776b, 0xffffffe1, 0x35eb776b
+  .word 0x500, 0x35eb776b, 0xffffffe1, 0x35eb776b
+  .word 0x510, 0x35eb776b, 0xffffffe1, 0xffffffe3
+  .word 0x4f0, 0xd28fd14, 0x1f, 0x8d28fd14
+  .word 0x500, 0xd28fd14, 0x1f, 0x8d28fd14
+  .word 0x510, 0xd28fd14, 0x1f, 0x8000001f
+  .word 0x4f0, 0xd28fd14, 0x80000000, 0xd28fd15
+  .word 0x500, 0xd28fd14, 0x80000000, 0xd28fd15
+  .word 0x510, 0xd28fd14, 0x80000000, 0x80000001
+  .word 0x4f0, 0xff00ff00, 0x37489279, 0xff00ff00
+  .word 0x500, 0xff00ff00, 0x37489279, 0xff00ff00
+  .word 0x510, 0xff00ff00, 0x37489279, 0x37489279
+  .word 0x4f0, 0xffffffff, 0x40c8b1dc, 0xffffffff
+  .word 0x500, 0xffffffff, 0x40c8b1dc, 0xffffffff
+  .word 0x510, 0xffffffff, 0x40c8b1dc, 0x50c8b1dc
+  .word 0x4f0, 0x215b8, 0xd0524f5e, 0x400215b8
+  .word 0x500, 0x215b8, 0xd0524f5e, 0x400215b8
+  .word 0x510, 0x215b8, 0xd0524f5e, 0xd0524f5e
+  .word 0x520, 0x0, 0x12345687, 0x80
+  .word 0x530, 0x87654321, 0x0, 0x87654321
+  .word 0x540, 0x0, 0x0, 0x1
+  .word 0x540, 0x0, 0x1, 0x2
+  .word 0x540, 0x0, 0x7, 0x80
+  .word 0x540, 0x0, 0x1f, 0x80000000
+  .word 0x540, 0x0, 0x20, 0x1
+  .word 0x540, 0x0, 0x21, 0x2
+  .word 0x540, 0x0, 0x3f, 0x80000000
+  .word 0x540, 0x0, 0x40, 0x1
+  .word 0x540, 0x0, 0x80000000, 0x1
+  .word 0x540, 0x0, 0xffffffe1, 0x2
+  .word 0x540, 0x0, 0xffffffff, 0x80000000
+  .word 0x540, 0x7f, 0x0, 0x7e
+  .word 0x540, 0x7f, 0x1, 0x7d
+  .word 0x540, 0x7f, 0x7, 0xff
+  .word 0x540, 0x7f, 0x1f, 0x8000007f
+  .word 0x540, 0x7f, 0x20, 0x7e
+  .word 0x540, 0x7f, 0x21, 0x7d
+  .word 0x540, 0x7f, 0x3f, 0x8000007f
+  .word 0x540, 0x7f, 0x40, 0x7e
+  .word 0x540, 0x7f, 0x80000000, 0x7e
+  .word 0x540, 0x7f, 0xffffffe1, 0x7d
+  .word 0x540, 0x7f, 0xffffffff, 0x8000007f
+  .word 0x540, 0x100, 0x0, 0x101
+  .word 0x540, 0x100, 0x1, 0x102
+  .word 0x540, 0x100, 0x7, 0x180
+  .word 0x540, 0x100, 0x1f, 0x80000100
+  .word 0x540, 0x100, 0x20, 0x101
+  .word 0x540, 0x100, 0x21, 0x102
+  .word 0x540, 0x100, 0x3f, 0x80000100
+  .word 0x540, 0x100, 0x40, 0x101
+  .word 0x540, 0x100, 0x80000000, 0x101
+  .word 0x540, 0x100, 0xffffffe1, 0x102
+  .word 0x540, 0x100, 0xffffffff, 0x80000100
+  .word 0x540, 0xffff, 0x0, 0xfffe
+  .word 0x540, 0xffff, 0x1, 0xfffd
+  .word 0x540, 0xffff, 0x7, 0xff7f
+  .word 0x540, 0xffff, 0x1f, 0x8000ffff
+  .word 0x540, 0xffff, 0x20, 0xfffe
+  .word 0x540, 0xffff, 0x21, 0xfffd
+  .word 0x540, 0xffff, 0x3f, 0x8000ffff
+  .word 0x540, 0xffff, 0x40, 0xfffe
+  .word 0x540, 0xffff, 0x80000000, 0xfffe
+  .word 0x540, 0xffff, 0xffffffe1, 0xfffd
+  .word 0x540, 0xffff, 0xffffffff, 0x8000ffff
+  .word 0x540, 0x80000000, 0x0, 0x80000001
+  .word 0x540, 0x80000000, 0x1, 0x80000002
+  .word 0x540, 0x80000000, 0x7, 0x80000080
+  .word 0x540, 0x80000000, 0x1f, 0x0
+  .word 0x540, 0x80000000, 0x20, 0x80000001
+  .word 0x540, 0x80000000, 0x21, 0x80000002
+  .word 0x540, 0x80000000, 0x3f, 0x0
+  .word 0x540, 0x80000000, 0x40, 0x80000001
+  .word 0x540, 0x80000000, 0x80000000, 0x80000001
+  .word 0x540, 0x80000000, 0xffffffe1, 0x80000002
+  .word 0x540, 0x80000000, 0xffffffff, 0x0
+  .word 0x540, 0xffffffff, 0x0, 0xfffffffe
+  .word 0x540, 0xffffffff, 0x1, 0xfffffffd
+  .word 0x540, 0xffffffff, 0x7, 0xffffff7f
+  .word 0x540, 0xffffffff, 0x1f, 0x7fffffff
+  .word 0x540, 0xffffffff, 0x20, 0xfffffffe
+  .word 0x540, 0xffffffff, 0x21, 0xfffffffd
+  .word 0x540, 0xffffffff, 0x3f, 0x7fffffff
+  .word 0x540, 0xffffffff, 0x40, 0xfffffffe
+  .word 0x540, 0xffffffff, 0x80000000, 0xfffffffe
+  .word 0x540, 0xffffffff, 0xffffffe1, 0xfffffffd
+  .word 0x540, 0xffffffff, 0xffffffff, 0x7fffffff
+  .word 0x540, 0xff00ff00, 0x0, 0xff00ff01
+  .word 0x540, 0xff00ff00, 0x1, 0xff00ff02
+  .word 0x540, 0xff00ff00, 0x7, 0xff00ff80
+  .word 0x540, 0xff00ff00, 0x1f, 0x7f00ff00
+  .word 0x540, 0xff00ff00, 0x20, 0xff00ff01
+  .word 0x540, 0xff00ff00, 0x21, 0xff00ff02
+  .word 0x540, 0xff00ff00, 0x3f, 0x7f00ff00
+  .word 0x540, 0xff00ff00, 0x40, 0xff00ff01
+  .word 0x540, 0xff00ff00, 0x80000000, 0xff00ff01
+  .word 0x540, 0xff00ff00, 0xffffffe1, 0xff00ff02
+  .word 0x540, 0xff00ff00, 0xffffffff, 0x7f00ff00
+  .word 0x540, 0x3b30, 0x0, 0x3b31
+  .word 0x540, 0x3b30, 0x1, 0x3b32
+  .word 0x540, 0x3b30, 0x7, 0x3bb0
+  .word 0x540, 0x3b30, 0x1f, 0x80003b30
+  .word 0x540, 0x3b30, 0x20, 0x3b31
+  .word 0x540, 0x3b30, 0x21, 0x3b32
+  .word 0x540, 0x3b30, 0x3f, 0x80003b30
+  .word 0x540, 0x3b30, 0x40, 0x3b31
+  .word 0x540, 0x3b30, 0x80000000, 0x3b31
+  .word 0x540, 0x3b30, 0xffffffe1, 0x3b32
+  .word 0x540, 0x3b30, 0xffffffff, 0x80003b30
+  .word 0x540, 0x6c, 0x0, 0x6d
+  .word 0x540, 0x6c, 0x1, 0x6e
+  .word 0x540, 0x6c, 0x7, 0xec
+  .word 0x540, 0x6c, 0x1f, 0x8000006c
+  .word 0x540, 0x6c, 0x20, 0x6d
+  .word 0x540, 0x6c, 0x21, 0x6e
+  .word 0x540, 0x6c, 0x3f, 0x8000006c
+  .word 0x540, 0x6c, 0x40, 0x6d
+  .word 0x540, 0x6c, 0x80000000, 0x6d
+  .word 0x540, 0x6c, 0xffffffe1, 0x6e
+  .word 0x540, 0x6c, 0xffffffff, 0x8000006c
+  .word 0x540, 0x4, 0x0, 0x5
+  .word 0x540, 0x4, 0x1, 0x6
+  .word 0x540, 0x4, 0x7, 0x84
+  .word 0x540, 0x4, 0x1f, 0x80000004
+  .word 0x540, 0x4, 0x20, 0x5
+  .word 0x540, 0x4, 0x21, 0x6
+  .word 0x540, 0x4, 0x3f, 0x80000004
+  .word 0x540, 0x4, 0x40, 0x5
+  .word 0x540, 0x4, 0x80000000, 0x5
+  .word 0x540, 0x4, 0xffffffe1, 0x6
+  .word 0x540, 0x4, 0xffffffff, 0x80000004
+  .word 0x540, 0x73698785, 0x0, 0x73698784
+  .word 0x540, 0x73698785, 0x1, 0x73698787
+  .word 0x540, 0x73698785, 0x7, 0x73698705
+  .word 0x540, 0x73698785, 0x1f, 0xf3698785
+  .word 0x540, 0x73698785, 0x20, 0x73698784
+  .word 0x540, 0x73698785, 0x21, 0x73698787
+  .word 0x540, 0x73698785, 0x3f, 0xf3698785
+  .word 0x540, 0x73698785, 0x40, 0x73698784
+  .word 0x540, 0x73698785, 0x80000000, 0x73698784
+  .word 0x540, 0x73698785, 0xffffffe1, 0x73698787
+  .word 0x540, 0x73698785, 0xffffffff, 0xf3698785
+  .word 0x540, 0x35eb776b, 0x0, 0x35eb776a
+  .word 0x540, 0x35eb776b, 0x1, 0x35eb7769
+  .word 0x540, 0x35eb776b, 0x7, 0x35eb77eb
+  .word 0x540, 0x35eb776b, 0x1f, 0xb5eb776b
+  .word 0x540, 0x35eb776b, 0x20, 0x35eb776a
+  .word 0x540, 0x35eb776b, 0x21, 0x35eb7769
+  .word 0x540, 0x35eb776b, 0x3f, 0xb5eb776b
+  .word 0x540, 0x35eb776b, 0x40, 0x35eb776a
+  .word 0x540, 0x35eb776b, 0x80000000, 0x35eb776a
+  .word 0x540, 0x35eb776b, 0xffffffe1, 0x35eb7769
+  .word 0x540, 0x35eb776b, 0xffffffff, 0xb5eb776b
+  .word 0x540, 0xd28fd14, 0x0, 0xd28fd15
+  .word 0x540, 0xd28fd14, 0x1, 0xd28fd16
+  .word 0x540, 0xd28fd14, 0x7, 0xd28fd94
+  .word 0x540, 0xd28fd14, 0x1f, 0x8d28fd14
+  .word 0x540, 0xd28fd14, 0x20, 0xd28fd15
+  .word 0x540, 0xd28fd14, 0x21, 0xd28fd16
+  .word 0x540, 0xd28fd14, 0x3f, 0x8d28fd14
+  .word 0x540, 0xd28fd14, 0x40, 0xd28fd15
+  .word 0x540, 0xd28fd14, 0x80000000, 0xd28fd15
+  .word 0x540, 0xd28fd14, 0xffffffe1, 0xd28fd16
+  .word 0x540, 0xd28fd14, 0xffffffff, 0x8d28fd14
+  .word 0x540, 0xff00ff00, 0x6cd3e5a3, 0xff00ff08
+  .word 0x540, 0x215b8, 0x4c81c41f, 0x800215b8
+  .word 0x540, 0xb7ce5ed, 0x9c1bc99a, 0xf7ce5ed
+  .word 0x540, 0xb7ce5ed, 0xd3027db, 0x37ce5ed
+  .word 0x540, 0xff00ff00, 0x1bc3228c, 0xff00ef00
+  .word 0x540, 0x1, 0xa198d97b, 0x8000001
+  .word 0x540, 0x8000, 0x551edef1, 0x28000
+  .word 0x540, 0xb7ce5ed, 0xba8ed728, 0xb7ce4ed
+  .word 0x540, 0x4, 0x3f9402e0, 0x5
+  .word 0x540, 0x10000, 0xf396af90, 0x0
+  .word 0x540, 0xff, 0x567f4887, 0x7f
+  .word 0x540, 0xb7ce5ed, 0xb04455af, 0xb7c65ed
+  .word 0x540, 0x10, 0x1d176280, 0x11
+  .word 0x540, 0xffffffff, 0xe30d8db8, 0xfeffffff
+  .word 0x540, 0xb7ce5ed, 0xf5268475, 0xb5ce5ed
+  .word 0x540, 0x73698785, 0xccae55c8, 0x73698685
+  .word 0x550, 0x0, 0x0, 0x1
+  .word 0x560, 0x0, 0x0, 0x1
+  .word 0x570, 0x0, 0x0, 0x1
+  .word 0x550, 0x0, 0x21, 0x2
+  .word 0x560, 0x0, 0x21, 0x2
+  .word 0x570, 0x0, 0x21, 0x23
+  .word 0x550, 0x0, 0xffffffff, 0x80000000
+  .word 0x560, 0x0, 0xffffffff, 0x80000000
+  .word 0x570, 0x0, 0xffffffff, 0x7fffffff
+  .word 0x550, 0x7f, 0x20, 0x7e
+  .word 0x560, 0x7f, 0x20, 0x7e
+  .word 0x570, 0x7f, 0x20, 0x21
+  .word 0x550, 0x7f, 0xffffffe1, 0x7d
+  .word 0x560, 0x7f, 0xffffffe1, 0x7d
+  .word 0x570, 0x7f, 0xffffffe1, 0xffffffe3
+  .word 0x550, 0x100, 0x1f, 0x80000100
+  .word 0x560, 0x100, 0x1f, 0x80000100
+  .word 0x570, 0x100, 0x1f, 0x8000001f
+  .word 0x550, 0x100, 0x80000000, 0x101
+  .word 0x560, 0x100, 0x80000000, 0x101
+  .word 0x570, 0x100, 0x80000000, 0x80000001
+  .word 0x550, 0xffff, 0x7, 0xff7f
+  .word 0x560, 0xffff, 0x7, 0xff7f
+  .word 0x570, 0xffff, 0x7, 0x87
+  .word 0x550, 0xffff, 0x40, 0xfffe
+  .word 0x560, 0xffff, 0x40, 0xfffe
+  .word 0x570, 0xffff, 0x40, 0x41
+  .word 0x550, 0x80000000, 0x1, 0x80000002
+  .word 0x560, 0x80000000, 0x1, 0x80000002
+  .word 0x570, 0x80000000, 0x1, 0x3
+  .word 0x550, 0x80000000, 0x3f, 0x0
+  .word 0x560, 0x80000000, 0x3f, 0x0
+  .word 0x570, 0x80000000, 0x3f, 0x8000003f
+  .word 0x550, 0xffffffff, 0x0, 0xfffffffe
+  .word 0x560, 0xffffffff, 0x0, 0xfffffffe
+  .word 0x570, 0xffffffff, 0x0, 0x1
+  .word 0x550, 0xffffffff, 0x21, 0xfffffffd
+  .word 0x560, 0xffffffff, 0x21, 0xfffffffd
+  .word 0x570, 0xffffffff, 0x21, 0x23
+  .word 0x550, 0xffffffff, 0xffffffff, 0x7fffffff
+  .word 0x560, 0xffffffff, 0xffffffff, 0x7fffffff
+  .word 0x570, 0xffffffff, 0xffffffff, 0x7fffffff
+  .word 0x550, 0xff00ff00, 0x20, 0xff00ff01
+  .word 0x560, 0xff00ff00, 0x20, 0xff00ff01
+  .word 0x570, 0xff00ff00, 0x20, 0x21
+  .word 0x550, 0xff00ff00, 0xffffffe1, 0xff00ff02
+  .word 0x560, 0xff00ff00, 0xffffffe1, 0xff00ff02
+  .word 0x570, 0xff00ff00, 0xffffffe1, 0xffffffe3
+  .word 0x550, 0x3b30, 0x1f, 0x80003b30
+  .word 0x560, 0x3b30, 0x1f, 0x80003b30
+  .word 0x570, 0x3b30, 0x1f, 0x8000001f
+  .word 0x550, 0x3b30, 0x80000000, 0x3b31
+  .word 0x560, 0x3b30, 0x80000000, 0x3b31
+  .word 0x570, 0x3b30, 0x80000000, 0x80000001
+  .word 0x550, 0x6c, 0x7, 0xec
+  .word 0x560, 0x6c, 0x7, 0xec
+  .word 0x570, 0x6c, 0x7, 0x87
+  .word 0x550, 0x6c, 0x40, 0x6d
+  .word 0x560, 0x6c, 0x40, 0x6d
+  .word 0x570, 0x6c, 0x40, 0x41
+  .word 0x550, 0x4, 0x1, 0x6
+  .word 0x560, 0x4, 0x1, 0x6
+  .word 0x570, 0x4, 0x1, 0x3
+  .word 0x550, 0x4, 0x3f, 0x80000004
+  .word 0x560, 0x4, 0x3f, 0x80000004
+  .word 0x570, 0x4, 0x3f, 0x8000003f
+  .word 0x550, 0x73698785, 0x0, 0x73698784
+  .word 0x560, 0x73698785, 0x0, 0x73698784
+  .word 0x570, 0x73698785, 0x0, 0x1
+  .word 0x550, 0x73698785, 0x21, 0x73698787
+  .word 0x560, 0x73698785, 0x21, 0x73698787
+  .word 0x570, 0x73698785, 0x21, 0x23
+  .word 0x550, 0x73698785, 0xffffffff, 0xf3698785
+  .word 0x560, 0x73698785, 0xffffffff, 0xf3698785
+  .word 0x570, 0x73698785, 0xffffffff, 0x7fffffff
+  .word 0x550, 0x35eb776b, 0x20, 0x35eb776a
+  .word 0x560, 0x35eb776b, 0x20, 0x35eb776a
+  .word 0x570, 0x35eb776b, 0x20, 0x21
+  .word 0x550, 0x35eb776b, 0xffffffe1, 0x35eb7769
+  .word 0x560, 0x35eb776b, 0xffffffe1, 0x35eb7769
+  .word 0x570, 0x35eb776b, 0xffffffe1, 0xffffffe3
+  .word 0x550, 0xd28fd14, 0x1f, 0x8d28fd14
+  .word 0x560, 0xd28fd14, 0x1f, 0x8d28fd14
+  .word 0x570, 0xd28fd14, 0x1f, 0x8000001f
+  .word 0x550, 0xd28fd14, 0x80000000, 0xd28fd15
+  .word 0x560, 0xd28fd14, 0x80000000, 0xd28fd15
+  .word 0x570, 0xd28fd14, 0x80000000, 0x80000001
+  .word 0x550, 0xb7ce5ed, 0x9c1bc99a, 0xf7ce5ed
+  .word 0x560, 0xb7ce5ed, 0x9c1bc99a, 0xf7ce5ed
+  .word 0x570, 0xb7ce5ed, 0x9c1bc99a, 0x981bc99a
+  .word 0x550, 0xb7ce5ed, 0xba8ed728, 0xb7ce4ed
+  .word 0x560, 0xb7ce5ed, 0xba8ed728, 0xb7ce4ed
+  .word 0x570, 0xb7ce5ed, 0xba8ed728, 0xba8ed628
+  .word 0x550, 0x10, 0x1d176280, 0x11
+  .word 0x560, 0x10, 0x1d176280, 0x11
+  .word 0x570, 0x10, 0x1d176280, 0x1d176281
+  .word 0x580, 0x0, 0x12345687, 0x80
+  .word 0x590, 0x87654321, 0x0, 0x87654320
+  .word 0x5a0, 0x0, 0x0, 0x0
+  .word 0x5a0, 0x0, 0x1, 0x0
+  .word 0x5a0, 0x0, 0x7, 0x0
+  .word 0x5a0, 0x0, 0x1f, 0x0
+  .word 0x5a0, 0x0, 0x20, 0x0
+  .word 0x5a0, 0x0, 0x21, 0x0
+  .word 0x5a0, 0x0, 0x3f, 0x0
+  .word 0x5a0, 0x0, 0x40, 0x0
+  .word 0x5a0, 0x0, 0x80000000, 0x0
+  .word 0x5a0, 0x0, 0xffffffe1, 0x0
+  .word 0x5a0, 0x0, 0xffffffff, 0x0
+  .word 0x5a0, 0x7f, 0x0, 0x1
+  .word 0x5a0, 0x7f, 0x1, 0x1
+  .word 0x5a0, 0x7f, 0x7, 0x0
+  .word 0x5a0, 0x7f, 0x1f, 0x0
+  .word 0x5a0, 0x7f, 0x20, 0x1
+  .word 0x5a0, 0x7f, 0x21, 0x1
+  .word 0x5a0, 0x7f, 0x3f, 0x0
+  .word 0x5a0, 0x7f, 0x40, 0x1
+  .word 0x5a0, 0x7f, 0x80000000, 0x1
+  .word 0x5a0, 0x7f, 0xffffffe1, 0x1
+  .word 0x5a0, 0x7f, 0xffffffff, 0x0
+  .word 0x5a0, 0x100, 0x0, 0x0
+  .word 0x5a0, 0x100, 0x1, 0x0
+  .word 0x5a0, 0x100, 0x7, 0x0
+  .word 0x5a0, 0x100, 0x1f, 0x0
+  .word 0x5a0, 0x100, 0x20, 0x0
+  .word 0x5a0, 0x100, 0x21, 0x0
+  .word 0x5a0, 0x100, 0x3f, 0x0
+  .word 0x5a0, 0x100, 0x40, 0x0
+  .word 0x5a0, 0x100, 0x80000000, 0x0
+  .word 0x5a0, 0x100, 0xffffffe1, 0x0
+  .word 0x5a0, 0x100, 0xffffffff, 0x0
+  .word 0x5a0, 0xffff, 0x0, 0x1
+  .word 0x5a0, 0xffff, 0x1, 0x1
+  .word 0x5a0, 0xffff, 0x7, 0x1
+  .word 0x5a0, 0xffff, 0x1f, 0x0
+  .word 0x5a0, 0xffff, 0x20, 0x1
+  .word 0x5a0, 0xffff, 0x21, 0x1
+  .word 0x5a0, 0xffff, 0x3f, 0x0
+  .word 0x5a0, 0xffff, 0x40, 0x1
+  .word 0x5a0, 0xffff, 0x80000000, 0x1
+  .word 0x5a0, 0xffff, 0xffffffe1, 0x1
+  .word 0x5a0, 0xffff, 0xffffffff, 0x0
+  .word 0x5a0, 0x80000000, 0x0, 0x0
+  .word 0x5a0, 0x80000000, 0x1, 0x0
+  .word 0x5a0, 0x80000000, 0x7, 0x0
+  .word 0x5a0, 0x80000000, 0x1f, 0x1
+  .word 0x5a0, 0x80000000, 0x20, 0x0
+  .word 0x5a0, 0x80000000, 0x21, 0x0
+  .word 0x5a0, 0x80000000, 0x3f, 0x1
+  .word 0x5a0, 0x80000000, 0x40, 0x0
+  .word 0x5a0, 0x80000000, 0x80000000, 0x0
+  .word 0x5a0, 0x80000000, 0xffffffe1, 0x0
+  .word 0x5a0, 0x80000000, 0xffffffff, 0x1
+  .word 0x5a0, 0xffffffff, 0x0, 0x1
+  .word 0x5a0, 0xffffffff, 0x1, 0x1
+  .word 0x5a0, 0xffffffff, 0x7, 0x1
+  .word 0x5a0, 0xffffffff, 0x1f, 0x1
+  .word 0x5a0, 0xffffffff, 0x20, 0x1
+  .word 0x5a0, 0xffffffff, 0x21, 0x1
+  .word 0x5a0, 0xffffffff, 0x3f, 0x1
+  .word 0x5a0, 0xffffffff, 0x40, 0x1
+  .word 0x5a0, 0xffffffff, 0x80000000, 0x1
+  .word 0x5a0, 0xffffffff, 0xffffffe1, 0x1
+  .word 0x5a0, 0xffffffff, 0xffffffff, 0x1
+  .word 0x5a0, 0xff00ff00, 0x0, 0x0
+  .word 0x5a0, 0xff00ff00, 0x1, 0x0
+  .word 0x5a0, 0xff00ff00, 0x7, 0x0
+  .word 0x5a0, 0xff00ff00, 0x1f, 0x1
+  .word 0x5a0, 0xff00ff00, 0x20, 0x0
+  .word 0x5a0, 0xff00ff00, 0x21, 0x0
+  .word 0x5a0, 0xff00ff00, 0x3f, 0x1
+  .word 0x5a0, 0xff00ff00, 0x40, 0x0
+  .word 0x5a0, 0xff00ff00, 0x80000000, 0x0
+  .word 0x5a0, 0xff00ff00, 0xffffffe1, 0x0
+  .word 0x5a0, 0xff00ff00, 0xffffffff, 0x1
+  .word 0x5a0, 0x3b30, 0x0, 0x0
+  .word 0x5a0, 0x3b30, 0x1, 0x0
+  .word 0x5a0, 0x3b30, 0x7, 0x0
+  .word 0x5a0, 0x3b30, 0x1f, 0x0
+  .word 0x5a0, 0x3b30, 0x20, 0x0
+  .word 0x5a0, 0x3b30, 0x21, 0x0
+  .word 0x5a0, 0x3b30, 0x3f, 0x0
+  .word 0x5a0, 0x3b30, 0x40, 0x0
+  .word 0x5a0, 0x3b30, 0x80000000, 0x0
+  .word 0x5a0, 0x3b30, 0xffffffe1, 0x0
+  .word 0x5a0, 0x3b30, 0xffffffff, 0x0
+  .word 0x5a0, 0x6c, 0x0, 0x0
+  .word 0x5a0, 0x6c, 0x1, 0x0
+  .word 0x5a0, 0x6c, 0x7, 0x0
+  .word 0x5a0, 0x6c, 0x1f, 0x0
+  .word 0x5a0, 0x6c, 0x20, 0x0
+  .word 0x5a0, 0x6c, 0x21, 0x0
+  .word 0x5a0, 0x6c, 0x3f, 0x0
+  .word 0x5a0, 0x6c, 0x40, 0x0
+  .word 0x5a0, 0x6c, 0x80000000, 0x0
+  .word 0x5a0, 0x6c, 0xffffffe1, 0x0
+  .word 0x5a0, 0x6c, 0xffffffff, 0x0
+  .word 0x5a0, 0x4, 0x0, 0x0
+  .word 0x5a0, 0x4, 0x1, 0x0
+  .word 0x5a0, 0x4, 0x7, 0x0
+  .word 0x5a0, 0x4, 0x1f, 0x0
+  .word 0x5a0, 0x4, 0x20, 0x0
+  .word 0x5a0, 0x4, 0x21, 0x0
+  .word 0x5a0, 0x4, 0x3f, 0x0
+  .word 0x5a0, 0x4, 0x40, 0x0
+  .word 0x5a0, 0x4, 0x80000000, 0x0
+  .word 0x5a0, 0x4, 0xffffffe1, 0x0
+  .word 0x5a0, 0x4, 0xffffffff, 0x0
+  .word 0x5a0, 0x73698785, 0x0, 0x1
+  .word 0x5a0, 0x73698785, 0x1, 0x0
+  .word 0x5a0, 0x73698785, 0x7, 0x1
+  .word 0x5a0, 0x73698785, 0x1f, 0x0
+  .word 0x5a0, 0x73698785, 0x20, 0x1
+  .word 0x5a0, 0x73698785, 0x21, 0x0
+  .word 0x5a0, 0x73698785, 0x3f, 0x0
+  .word 0x5a0, 0x73698785, 0x40, 0x1
+  .word 0x5a0, 0x73698785, 0x80000000, 0x1
+  .word 0x5a0, 0x73698785, 0xffffffe1, 0x0
+  .word 0x5a0, 0x73698785, 0xffffffff, 0x0
+  .word 0x5a0, 0x35eb776b, 0x0, 0x1
+  .word 0x5a0, 0x35eb776b, 0x1, 0x1
+  .word 0x5a0, 0x35eb776b, 0x7, 0x0
+  .word 0x5a0, 0x35eb776b, 0x1f, 0x0
+  .word 0x5a0, 0x35eb776b, 0x20, 0x1
+  .word 0x5a0, 0x35eb776b, 0x21, 0x1
+  .word 0x5a0, 0x35eb776b, 0x3f, 0x0
+  .word 0x5a0, 0x35eb776b, 0x40, 0x1
+  .word 0x5a0, 0x35eb776b, 0x80000000, 0x1
+  .word 0x5a0, 0x35eb776b, 0xffffffe1, 0x1
+  .word 0x5a0, 0x35eb776b, 0xffffffff, 0x0
+  .word 0x5a0, 0xd28fd14, 0x0, 0x0
+  .word 0x5a0, 0xd28fd14, 0x1, 0x0
+  .word 0x5a0, 0xd28fd14, 0x7, 0x0
+  .word 0x5a0, 0xd28fd14, 0x1f, 0x0
+  .word 0x5a0, 0xd28fd14, 0x20, 0x0
+  .word 0x5a0, 0xd28fd14, 0x21, 0x0
+  .word 0x5a0, 0xd28fd14, 0x3f, 0x0
+  .word 0x5a0, 0xd28fd14, 0x40, 0x0
+  .word 0x5a0, 0xd28fd14, 0x80000000, 0x0
+  .word 0x5a0, 0xd28fd14, 0xffffffe1, 0x0
+  .word 0x5a0, 0xd28fd14, 0xffffffff, 0x0
+  .word 0x5a0, 0xe69, 0xfd0225b4, 0x0
+  .word 0x5a0, 0xff00ff, 0x1025789, 0x0
+  .word 0x5a0, 0x3b30, 0x608ea96e, 0x0
+  .word 0x5a0, 0x1, 0xc91d24d0, 0x0
+  .word 0x5a0, 0xffff, 0xbfca2a1e, 0x0
+  .word 0x5a0, 0x21e, 0x341e8364, 0x1
+  .word 0x5a0, 0x1, 0x2c5491c4, 0x0
+  .word 0x5a0, 0xe69, 0xbeef3f05, 0x1
+  .word 0x5a0, 0x4, 0xf466ae1d, 0x0
+  .word 0x5a0, 0xff, 0x6b8313bc, 0x0
+  .word 0x5a0, 0xff00ff, 0x7aecbe9a, 0x0
+  .word 0x5a0, 0x10, 0xb86f1f19, 0x0
+  .word 0x5a0, 0xb7ce5ed, 0x2d7a4400, 0x1
+  .word 0x5a0, 0x35eb776b, 0x884d9973, 0x1
+  .word 0x5a0, 0x12345678, 0x43f2f773, 0x0
+  .word 0x5a0, 0xff, 0x39fbb821, 0x1
+  .word 0x5b0, 0x0, 0x0, 0x0
+  .word 0x5c0, 0x0, 0x0, 0x0
+  .word 0x5d0, 0x0, 0x0, 0x0
+  .word 0x5b0, 0x0, 0x21, 0x0
+  .word 0x5c0, 0x0, 0x21, 0x0
+  .word 0x5d0, 0x0, 0x21, 0x0
+  .word 0x5b0, 0x0, 0xffffffff, 0x0
+  .word 0x5c0, 0x0, 0xffffffff, 0x0
+  .word 0x5d0, 0x0, 0xffffffff, 0x1
+  .word 0x5b0, 0x7f, 0x20, 0x1
+  .word 0x5c0, 0x7f, 0x20, 0x1
+  .word 0x5d0, 0x7f, 0x20, 0x0
+  .word 0x5b0, 0x7f, 0xffffffe1, 0x1
+  .word 0x5c0, 0x7f, 0xffffffe1, 0x1
+  .word 0x5d0, 0x7f, 0xffffffe1, 0x0
+  .word 0x5b0, 0x100, 0x1f, 0x0
+  .word 0x5c0, 0x100, 0x1f, 0x0
+  .word 0x5d0, 0x100, 0x1f, 0x0
+  .word 0x5b0, 0x100, 0x80000000, 0x0
+  .word 0x5c0, 0x100, 0x80000000, 0x0
+  .word 0x5d0, 0x100, 0x80000000, 0x0
+  .word 0x5b0, 0xffff, 0x7, 0x1
+  .word 0x5c0, 0xffff, 0x7, 0x1
+  .word 0x5d0, 0xffff, 0x7, 0x0
+  .word 0x5b0, 0xffff, 0x40, 0x1
+  .word 0x5c0, 0xffff, 0x40, 0x1
+  .word 0x5d0, 0xffff, 0x40, 0x0
+  .word 0x5b0, 0x80000000, 0x1, 0x0
+  .word 0x5c0, 0x80000000, 0x1, 0x0
+  .word 0x5d0, 0x80000000, 0x1, 0x0
+  .word 0x5b0, 0x80000000, 0x3f, 0x1
+  .word 0x5c0, 0x80000000, 0x3f, 0x1
+  .word 0x5d0, 0x80000000, 0x3f, 0x0
+  .word 0x5b0, 0xffffffff, 0x0, 0x1
+  .word 0x5c0, 0xffffffff, 0x0, 0x1
+  .word 0x5d0, 0xffffffff, 0x0, 0x0
+  .word 0x5b0, 0xffffffff, 0x21, 0x1
+  .word 0x5c0, 0xffffffff, 0x21, 0x1
+  .word 0x5d0, 0xffffffff, 0x21, 0x0
+  .word 0x5b0, 0xffffffff, 0xffffffff, 0x1
+  .word 0x5c0, 0xffffffff, 0xffffffff, 0x1
+  .word 0x5d0, 0xffffffff, 0xffffffff, 0x1
+  .word 0x5b0, 0xff00ff00, 0x20, 0x0
+  .word 0x5c0, 0xff00ff00, 0x20, 0x0
+  .word 0x5d0, 0xff00ff00, 0x20, 0x0
+  .word 0x5b0, 0xff00ff00, 0xffffffe1, 0x0
+  .word 0x5c0, 0xff00ff00, 0xffffffe1, 0x0
+  .word 0x5d0, 0xff00ff00, 0xffffffe1, 0x0
+  .word 0x5b0, 0x3b30, 0x1f, 0x0
+  .word 0x5c0, 0x3b30, 0x1f, 0x0
+  .word 0x5d0, 0x3b30, 0x1f, 0x0
+  .word 0x5b0, 0x3b30, 0x80000000, 0x0
+  .word 0x5c0, 0x3b30, 0x80000000, 0x0
+  .word 0x5d0, 0x3b30, 0x80000000, 0x0
+  .word 0x5b0, 0x6c, 0x7, 0x0
+  .word 0x5c0, 0x6c, 0x7, 0x0
+  .word 0x5d0, 0x6c, 0x7, 0x0
+  .word 0x5b0, 0x6c, 0x40, 0x0
+  .word 0x5c0, 0x6c, 0x40, 0x0
+  .word 0x5d0, 0x6c, 0x40, 0x0
+  .word 0x5b0, 0x4, 0x1, 0x0
+  .word 0x5c0, 0x4, 0x1, 0x0
+  .word 0x5d0, 0x4, 0x1, 0x0
+  .word 0x5b0, 0x4, 0x3f, 0x0
+  .word 0x5c0, 0x4, 0x3f, 0x0
+  .word 0x5d0, 0x4, 0x3f, 0x0
+  .word 0x5b0, 0x73698785, 0x0, 0x1
+  .word 0x5c0, 0x73698785, 0x0, 0x1
+  .word 0x5d0, 0x73698785, 0x0, 0x0
+  .word 0x5b0, 0x73698785, 0x21, 0x0
+  .word 0x5c0, 0x73698785, 0x21, 0x0
+  .word 0x5d0, 0x73698785, 0x21, 0x0
+  .word 0x5b0, 0x73698785, 0xffffffff, 0x0
+  .word 0x5c0, 0x73698785, 0xffffffff, 0x0
+  .word 0x5d0, 0x73698785, 0xffffffff, 0x1
+  .word 0x5b0, 0x35eb776b, 0x20, 0x1
+  .word 0x5c0, 0x35eb776b, 0x20, 0x1
+  .word 0x5d0, 0x35eb776b, 0x20, 0x0
+  .word 0x5b0, 0x35eb776b, 0xffffffe1, 0x1
+  .word 0x5c0, 0x35eb776b, 0xffffffe1, 0x1
+  .word 0x5d0, 0x35eb776b, 0xffffffe1, 0x0
+  .word 0x5b0, 0xd28fd14, 0x1f, 0x0
+  .word 0x5c0, 0xd28fd14, 0x1f, 0x0
+  .word 0x5d0, 0xd28fd14, 0x1f, 0x0
+  .word 0x5b0, 0xd28fd14, 0x80000000, 0x0
+  .word 0x5c0, 0xd28fd14, 0x80000000, 0x0
+  .word 0x5d0, 0xd28fd14, 0x80000000, 0x0
+  .word 0x5b0, 0x3b30, 0x608ea96e, 0x0
+  .word 0x5c0, 0x3b30, 0x608ea96e, 0x0
+  .word 0x5d0, 0x3b30, 0x608ea96e, 0x0
+  .word 0x5b0, 0xe69, 0xbeef3f05, 0x1
+  .word 0x5c0, 0xe69, 0xbeef3f05, 0x1
+  .word 0x5d0, 0xe69, 0xbeef3f05, 0x0
+  .word 0x5b0, 0xb7ce5ed, 0x2d7a4400, 0x1
+  .word 0x5c0, 0xb7ce5ed, 0x2d7a4400, 0x1
+  .word 0x5d0, 0xb7ce5ed, 0x2d7a4400, 0x0
+  .word 0x5e0, 0x0, 0x12345687, 0x0
+  .word 0x5f0, 0x87654321, 0x0, 0x1
+  .word 0x600, 0x0, 0x0, 0x20
+  .word 0x600, 0x1, 0x0, 0x1f
+  .word 0x600, 0x2, 0x0, 0x1e
+  .word 0x600, 0x7f, 0x0, 0x19
+  .word 0x600, 0x80, 0x0, 0x18
+  .word 0x600, 0xff, 0x0, 0x18
+  .word 0x600, 0x100, 0x0, 0x17
+  .word 0x600, 0x7fff, 0x0, 0x11
+  .word 0x600, 0x8000, 0x0, 0x10
+  .word 0x600, 0xffff, 0x0, 0x10
+  .word 0x600, 0x10000, 0x0, 0xf
+  .word 0x600, 0x7fffffff, 0x0, 0x1
+  .word 0x600, 0x80000000, 0x0, 0x0
+  .word 0x600, 0x80000001, 0x0, 0x0
+  .word 0x600, 0xfffffffe, 0x0, 0x0
+  .word 0x600, 0xffffffff, 0x0, 0x0
+  .word 0x600, 0x1000000, 0x0, 0x7
+  .word 0x600, 0xff00ff, 0x0, 0x8
+  .word 0x600, 0xff00ff00, 0x0, 0x0
+  .word 0x600, 0x12345678, 0x0, 0x3
+  .word 0x600, 0x10080, 0x0, 0xf
+  .word 0x600, 0x3b30, 0x0, 0x12
+  .word 0x600, 0x723b417, 0x0, 0x5
+  .word 0x600, 0x8b, 0x0, 0x18
+  .word 0x600, 0x6c, 0x0, 0x19
+  .word 0x600, 0x21e, 0x0, 0x16
+  .word 0x600, 0x215b8, 0x0, 0xe
+  .word 0x600, 0x4, 0x0, 0x1d
+  .word 0x600, 0xe69, 0x0, 0x14
+  .word 0x600, 0x4, 0x0, 0x1d
+  .word 0x600, 0x73698785, 0x0, 0x1
+  .word 0x600, 0xd8e1f9, 0x0, 0x8
+  .word 0x600, 0x1, 0x0, 0x1f
+  .word 0x600, 0x35eb776b, 0x0, 0x2
+  .word 0x600, 0x10, 0x0, 0x1b
+  .word 0x600, 0xb7ce5ed, 0x0, 0x4
+  .word 0x600, 0xd28fd14, 0x0, 0x4
+  .word 0x600, 0x1, 0x0, 0x1f
+  .word 0x600, 0x2, 0x0, 0x1e
+  .word 0x600, 0x4, 0x0, 0x1d
+  .word 0x600, 0x8, 0x0, 0x1c
+  .word 0x600, 0x10, 0x0, 0x1b
+  .word 0x600, 0x20, 0x0, 0x1a
+  .word 0x600, 0x40, 0x0, 0x19
+  .word 0x600, 0x80, 0x0, 0x18
+  .word 0x600, 0x100, 0x0, 0x17
+  .word 0x600, 0x200, 0x0, 0x16
+  .word 0x600, 0x400, 0x0, 0x15
+  .word 0x600, 0x800, 0x0, 0x14
+  .word 0x600, 0x1000, 0x0, 0x13
+  .word 0x600, 0x2000, 0x0, 0x12
+  .word 0x600, 0x4000, 0x0, 0x11
+  .word 0x600, 0x8000, 0x0, 0x10
+  .word 0x600, 0x10000, 0x0, 0xf
+  .word 0x600, 0x20000, 0x0, 0xe
+  .word 0x600, 0x40000, 0x0, 0xd
+  .word 0x600, 0x80000, 0x0, 0xc
+  .word 0x600, 0x100000, 0x0, 0xb
+  .word 0x600, 0x200000, 0x0, 0xa
+  .word 0x600, 0x400000, 0x0, 0x9
+  .word 0x600, 0x800000, 0x0, 0x8
+  .word 0x600, 0x1000000, 0x0, 0x7
+  .word 0x600, 0x2000000, 0x0, 0x6
+  .word 0x600, 0x4000000, 0x0, 0x5
+  .word 0x600, 0x8000000, 0x0, 0x4
+  .word 0x600, 0x10000000, 0x0, 0x3
+  .word 0x600, 0x20000000, 0x0, 0x2
+  .word 0x600, 0x40000000, 0x0, 0x1
+  .word 0x600, 0x80000000, 0x0, 0x0
+  .word 0x600, 0xffffffff, 0x0, 0x0
+  .word 0x600, 0x7fffffff, 0x0, 0x1
+  .word 0x600, 0x3fffffff, 0x0, 0x2
+  .word 0x600, 0x1fffffff, 0x0, 0x3
+  .word 0x600, 0xfffffff, 0x0, 0x4
+  .word 0x600, 0x7ffffff, 0x0, 0x5
+  .word 0x600, 0x3ffffff, 0x0, 0x6
+  .word 0x600, 0x1ffffff, 0x0, 0x7
+  .word 0x600, 0xffffff, 0x0, 0x8
+  .word 0x600, 0x7fffff, 0x0, 0x9
+  .word 0x600, 0x3fffff, 0x0, 0xa
+  .word 0x600, 0x1fffff, 0x0, 0xb
+  .word 0x600, 0xfffff, 0x0, 0xc
+  .word 0x600, 0x7ffff, 0x0, 0xd
+  .word 0x600, 0x3ffff, 0x0, 0xe
+  .word 0x600, 0x1ffff, 0x0, 0xf
+  .word 0x600, 0xffff, 0x0, 0x10
+  .word 0x600, 0x7fff, 0x0, 0x11
+  .word 0x600, 0x3fff, 0x0, 0x12
+  .word 0x600, 0x1fff, 0x0, 0x13
+  .word 0x600, 0xfff, 0x0, 0x14
+  .word 0x600, 0x7ff, 0x0, 0x15
+  .word 0x600, 0x3ff, 0x0, 0x16
+  .word 0x600, 0x1ff, 0x0, 0x17
+  .word 0x600, 0xff, 0x0, 0x18
+  .word 0x600, 0x7f, 0x0, 0x19
+  .word 0x600, 0x3f, 0x0, 0x1a
+  .word 0x600, 0x1f, 0x0, 0x1b
+  .word 0x600, 0xf, 0x0, 0x1c
+  .word 0x600, 0x7, 0x0, 0x1d
+  .word 0x600, 0x3, 0x0, 0x1e
+  .word 0x600, 0x1, 0x0, 0x1f
+  .word 0x610, 0x0, 0x0, 0x20
+  .word 0x610, 0x80, 0x0, 0x18
+  .word 0x610, 0x8000, 0x0, 0x10
+  .word 0x610, 0x80000000, 0x0, 0x0
+  .word 0x610, 0x1000000, 0x0, 0x7
+  .word 0x610, 0x10080, 0x0, 0xf
+  .word 0x610, 0x6c, 0x0, 0x19
+  .word 0x610, 0xe69, 0x0, 0x14
+  .word 0x610, 0x1, 0x0, 0x1f
+  .word 0x610, 0xd28fd14, 0x0, 0x4
+  .word 0x620, 0x12345678, 0x0, 0x20
+  .word 0x630, 0x0, 0x0, 0x20
+  .word 0x630, 0x1, 0x0, 0x0
+  .word 0x630, 0x2, 0x0, 0x1
+  .word 0x630, 0x7f, 0x0, 0x0
+  .word 0x630, 0x80, 0x0, 0x7
+  .word 0x630, 0xff, 0x0, 0x0
+  .word 0x630, 0x100, 0x0, 0x8
+  .word 0x630, 0x7fff, 0x0, 0x0
+  .word 0x630, 0x8000, 0x0, 0xf
+  .word 0x630, 0xffff, 0x0, 0x0
+  .word 0x630, 0x10000, 0x0, 0x10
+  .word 0x630, 0x7fffffff, 0x0, 0x0
+  .word 0x630, 0x80000000, 0x0, 0x1f
+  .word 0x630, 0x80000001, 0x0, 0x0
+  .word 0x630, 0xfffffffe, 0x0, 0x1
+  .word 0x630, 0xffffffff, 0x0, 0x0
+  .word 0x630, 0x1000000, 0x0, 0x18
+  .word 0x630, 0xff00ff, 0x0, 0x0
+  .word 0x630, 0xff00ff00, 0x0, 0x8
+  .word 0x630, 0x12345678, 0x0, 0x3
+  .word 0x630, 0x10080, 0x0, 0x7
+  .word 0x630, 0x3b30, 0x0, 0x4
+  .word 0x630, 0x723b417, 0x0, 0x0
+  .word 0x630, 0x8b, 0x0, 0x0
+  .word 0x630, 0x6c, 0x0, 0x2
+  .word 0x630, 0x21e, 0x0, 0x1
+  .word 0x630, 0x215b8, 0x0, 0x3
+  .word 0x630, 0x4, 0x0, 0x2
+  .word 0x630, 0xe69, 0x0, 0x0
+  .word 0x630, 0x4, 0x0, 0x2
+  .word 0x630, 0x73698785, 0x0, 0x0
+  .word 0x630, 0xd8e1f9, 0x0, 0x0
+  .word 0x630, 0x1, 0x0, 0x0
+  .word 0x630, 0x35eb776b, 0x0, 0x0
+  .word 0x630, 0x10, 0x0, 0x4
+  .word 0x630, 0xb7ce5ed, 0x0, 0x0
+  .word 0x630, 0xd28fd14, 0x0, 0x2
+  .word 0x630, 0x1, 0x0, 0x0
+  .word 0x630, 0x2, 0x0, 0x1
+  .word 0x630, 0x4, 0x0, 0x2
+  .word 0x630, 0x8, 0x0, 0x3
+  .word 0x630, 0x10, 0x0, 0x4
+  .word 0x630, 0x20, 0x0, 0x5
+  .word 0x630, 0x40, 0x0, 0x6
+  .word 0x630, 0x80, 0x0, 0x7
+  .word 0x630, 0x100, 0x0, 0x8
+  .word 0x630, 0x200, 0x0, 0x9
+  .word 0x630, 0x400, 0x0, 0xa
+  .word 0x630, 0x800, 0x0, 0xb
+  .word 0x630, 0x1000, 0x0, 0xc
+  .word 0x630, 0x2000, 0x0, 0xd
+  .word 0x630, 0x4000, 0x0, 0xe
+  .word 0x630, 0x8000, 0x0, 0xf
+  .word 0x630, 0x10000, 0x0, 0x10
+  .word 0x630, 0x20000, 0x0, 0x11
+  .word 0x630, 0x40000, 0x0, 0x12
+  .word 0x630, 0x80000, 0x0, 0x13
+  .word 0x630, 0x100000, 0x0, 0x14
+  .word 0x630, 0x200000, 0x0, 0x15
+  .word 0x630, 0x400000, 0x0, 0x16
+  .word 0x630, 0x800000, 0x0, 0x17
+  .word 0x630, 0x1000000, 0x0, 0x18
+  .word 0x630, 0x2000000, 0x0, 0x19
+  .word 0x630, 0x4000000, 0x0, 0x1a
+  .word 0x630, 0x8000000, 0x0, 0x1b
+  .word 0x630, 0x10000000, 0x0, 0x1c
+  .word 0x630, 0x20000000, 0x0, 0x1d
+  .word 0x630, 0x40000000, 0x0, 0x1e
+  .word 0x630, 0x80000000, 0x0, 0x1f
+  .word 0x630, 0xffffffff, 0x0, 0x0
+  .word 0x630, 0x7fffffff, 0x0, 0x0
+  .word 0x630, 0x3fffffff, 0x0, 0x0
+  .word 0x630, 0x1fffffff, 0x0, 0x0
+  .word 0x630, 0xfffffff, 0x0, 0x0
+  .word 0x630, 0x7ffffff, 0x0, 0x0
+  .word 0x630, 0x3ffffff, 0x0, 0x0
+  .word 0x630, 0x1ffffff, 0x0, 0x0
+  .word 0x630, 0xffffff, 0x0, 0x0
+  .word 0x630, 0x7fffff, 0x0, 0x0
+  .word 0x630, 0x3fffff, 0x0, 0x0
+  .word 0x630, 0x1fffff, 0x0, 0x0
+  .word 0x630, 0xfffff, 0x0, 0x0
+  .word 0x630, 0x7ffff, 0x0, 0x0
+  .word 0x630, 0x3ffff, 0x0, 0x0
+  .word 0x630, 0x1ffff, 0x0, 0x0
+  .word 0x630, 0xffff, 0x0, 0x0
+  .word 0x630, 0x7fff, 0x0, 0x0
+  .word 0x630, 0x3fff, 0x0, 0x0
+  .word 0x630, 0x1fff, 0x0, 0x0
+  .word 0x630, 0xfff, 0x0, 0x0
+  .word 0x630, 0x7ff, 0x0, 0x0
+  .word 0x630, 0x3ff, 0x0, 0x0
+  .word 0x630, 0x1ff, 0x0, 0x0
+  .word 0x630, 0xff, 0x0, 0x0
+  .word 0x630, 0x7f, 0x0, 0x0
+  .word 0x630, 0x3f, 0x0, 0x0
+  .word 0x630, 0x1f, 0x0, 0x0
+  .word 0x630, 0xf, 0x0, 0x0
+  .word 0x630, 0x7, 0x0, 0x0
+  .word 0x630, 0x3, 0x0, 0x0
+  .word 0x630, 0x1, 0x0, 0x0
+  .word 0x640, 0x0, 0x0, 0x20
+  .word 0x640, 0x80, 0x0, 0x7
+  .word 0x640, 0x8000, 0x0, 0xf
+  .word 0x640, 0x80000000, 0x0, 0x1f
+  .word 0x640, 0x1000000, 0x0, 0x18
+  .word 0x640, 0x10080, 0x0, 0x7
+  .word 0x640, 0x6c, 0x0, 0x2
+  .word 0x640, 0xe69, 0x0, 0x0
+  .word 0x640, 0x1, 0x0, 0x0
+  .word 0x640, 0xd28fd14, 0x0, 0x2
+  .word 0x650, 0x12345678, 0x0, 0x20
+  .word 0x660, 0x0, 0x0, 0x0
+  .word 0x660, 0x1, 0x0, 0x1
+  .word 0x660, 0x2, 0x0, 0x1
+  .word 0x660, 0x7f, 0x0, 0x7
+  .word 0x660, 0x80, 0x0, 0x1
+  .word 0x660, 0xff, 0x0, 0x8
+  .word 0x660, 0x100, 0x0, 0x1
+  .word 0x660, 0x7fff, 0x0, 0xf
+  .word 0x660, 0x8000, 0x0, 0x1
+  .word 0x660, 0xffff, 0x0, 0x10
+  .word 0x660, 0x10000, 0x0, 0x1
+  .word 0x660, 0x7fffffff, 0x0, 0x1f
+  .word 0x660, 0x80000000, 0x0, 0x1
+  .word 0x660, 0x80000001, 0x0, 0x2
+  .word 0x660, 0xfffffffe, 0x0, 0x1f
+  .word 0x660, 0xffffffff, 0x0, 0x20
+  .word 0x660, 0x1000000, 0x0, 0x1
+  .word 0x660, 0xff00ff, 0x0, 0x10
+  .word 0x660, 0xff00ff00, 0x0, 0x10
+  .word 0x660, 0x12345678, 0x0, 0xd
+  .word 0x660, 0x10080, 0x0, 0x2
+  .word 0x660, 0x3b30, 0x0, 0x7
+  .word 0x660, 0x723b417, 0x0, 0xe
+  .word 0x660, 0x8b, 0x0, 0x4
+  .word 0x660, 0x6c, 0x0, 0x4
+  .word 0x660, 0x21e, 0x0, 0x5
+  .word 0x660, 0x215b8, 0x0, 0x8
+  .word 0x660, 0x4, 0x0, 0x1
+  .word 0x660, 0xe69, 0x0, 0x7
+  .word 0x660, 0x4, 0x0, 0x1
+  .word 0x660, 0x73698785, 0x0, 0x10
+  .word 0x660, 0xd8e1f9, 0x0, 0xe
+  .word 0x660, 0x1, 0x0, 0x1
+  .word 0x660, 0x35eb776b, 0x0, 0x15
+  .word 0x660, 0x10, 0x0, 0x1
+  .word 0x660, 0xb7ce5ed, 0x0, 0x13
+  .word 0x660, 0xd28fd14, 0x0, 0xe
+  .word 0x660, 0x1, 0x0, 0x1
+  .word 0x660, 0x2, 0x0, 0x1
+  .word 0x660, 0x4, 0x0, 0x1
+  .word 0x660, 0x8, 0x0, 0x1
+  .word 0x660, 0x10, 0x0, 0x1
+  .word 0x660, 0x20, 0x0, 0x1
+  .word 0x660, 0x40, 0x0, 0x1
+  .word 0x660, 0x80, 0x0, 0x1
+  .word 0x660, 0x100, 0x0, 0x1
+  .word 0x660, 0x200, 0x0, 0x1
+  .word 0x660, 0x400, 0x0, 0x1
+  .word 0x660, 0x800, 0x0, 0x1
+  .word 0x660, 0x1000, 0x0, 0x1
+  .word 0x660, 0x2000, 0x0, 0x1
+  .word 0x660, 0x4000, 0x0, 0x1
+  .word 0x660, 0x8000, 0x0, 0x1
+  .word 0x660, 0x10000, 0x0, 0x1
+  .word 0x660, 0x20000, 0x0, 0x1
+  .word 0x660, 0x40000, 0x0, 0x1
+  .word 0x660, 0x80000, 0x0, 0x1
+  .word 0x660, 0x100000, 0x0, 0x1
+  .word 0x660, 0x200000, 0x0, 0x1
+  .word 0x660, 0x400000, 0x0, 0x1
+  .word 0x660, 0x800000, 0x0, 0x1
+  .word 0x660, 0x1000000, 0x0, 0x1
+  .word 0x660, 0x2000000, 0x0, 0x1
+  .word 0x660, 0x4000000, 0x0, 0x1
+  .word 0x660, 0x8000000, 0x0, 0x1
+  .word 0x660, 0x10000000, 0x0, 0x1
+  .word 0x660, 0x20000000, 0x0, 0x1
+  .word 0x660, 0x40000000, 0x0, 0x1
+  .word 0x660, 0x80000000, 0x0, 0x1
+  .word 0x660, 0xffffffff, 0x0, 0x20
+  .word 0x660, 0x7fffffff, 0x0, 0x1f
+  .word 0x660, 0x3fffffff, 0x0, 0x1e
+  .word 0x660, 0x1fffffff, 0x0, 0x1d
+  .word 0x660, 0xfffffff, 0x0, 0x1c
+  .word 0x660, 0x7ffffff, 0x0, 0x1b
+  .word 0x660, 0x3ffffff, 0x0, 0x1a
+  .word 0x660, 0x1ffffff, 0x0, 0x19
+  .word 0x660, 0xffffff, 0x0, 0x18
+  .word 0x660, 0x7fffff, 0x0, 0x17
+  .word 0x660, 0x3fffff, 0x0, 0x16
+  .word 0x660, 0x1fffff, 0x0, 0x15
+  .word 0x660, 0xfffff, 0x0, 0x14
+  .word 0x660, 0x7ffff, 0x0, 0x13
+  .word 0x660, 0x3ffff, 0x0, 0x12
+  .word 0x660, 0x1ffff, 0x0, 0x11
+  .word 0x660, 0xffff, 0x0, 0x10
+  .word 0x660, 0x7fff, 0x0, 0xf
+  .word 0x660, 0x3fff, 0x0, 0xe
+  .word 0x660, 0x1fff, 0x0, 0xd
+  .word 0x660, 0xfff, 0x0, 0xc
+  .word 0x660, 0x7ff, 0x0, 0xb
+  .word 0x660, 0x3ff, 0x0, 0xa
+  .word 0x660, 0x1ff, 0x0, 0x9
+  .word 0x660, 0xff, 0x0, 0x8
+  .word 0x660, 0x7f, 0x0, 0x7
+  .word 0x660, 0x3f, 0x0, 0x6
+  .word 0x660, 0x1f, 0x0, 0x5
+  .word 0x660, 0xf, 0x0, 0x4
+  .word 0x660, 0x7, 0x0, 0x3
+  .word 0x660, 0x3, 0x0, 0x2
+  .word 0x660, 0x1, 0x0, 0x1
+  .word 0x670, 0x0, 0x0, 0x0
+  .word 0x670, 0x80, 0x0, 0x1
+  .word 0x670, 0x8000, 0x0, 0x1
+  .word 0x670, 0x80000000, 0x0, 0x1
+  .word 0x670, 0x1000000, 0x0, 0x1
+  .word 0x670, 0x10080, 0x0, 0x2
+  .word 0x670, 0x6c, 0x0, 0x4
+  .word 0x670, 0xe69, 0x0, 0x7
+  .word 0x670, 0x1, 0x0, 0x1
+  .word 0x670, 0xd28fd14, 0x0, 0xe
+  .word 0x680, 0x12345678, 0x0, 0x0
+  .word 0x690, 0x0, 0x0, 0x0
+  .word 0x690, 0x1, 0x0, 0x1
+  .word 0x690, 0x2, 0x0, 0x2
+  .word 0x690, 0x7f, 0x0, 0x7f
+  .word 0x690, 0x80, 0x0, 0xffffff80
+  .word 0x690, 0xff, 0x0, 0xffffffff
+  .word 0x690, 0x100, 0x0, 0x0
+  .word 0x690, 0x7fff, 0x0, 0xffffffff
+  .word 0x690, 0x8000, 0x0, 0x0
+  .word 0x690, 0xffff, 0x0, 0xffffffff
+  .word 0x690, 0x10000, 0x0, 0x0
+  .word 0x690, 0x7fffffff, 0x0, 0xffffffff
+  .word 0x690, 0x80000000, 0x0, 0x0
+  .word 0x690, 0x80000001, 0x0, 0x1
+  .word 0x690, 0xfffffffe, 0x0, 0xfffffffe
+  .word 0x690, 0xffffffff, 0x0, 0xffffffff
+  .word 0x690, 0x1000000, 0x0, 0x0
+  .word 0x690, 0xff00ff, 0x0, 0xffffffff
+  .word 0x690, 0xff00ff00, 0x0, 0x0
+  .word 0x690, 0x12345678, 0x0, 0x78
+  .word 0x690, 0x10080, 0x0, 0xffffff80
+  .word 0x690, 0x3b30, 0x0, 0x30
+  .word 0x690, 0x723b417, 0x0, 0x17
+  .word 0x690, 0x8b, 0x0, 0xffffff8b
+  .word 0x690, 0x6c, 0x0, 0x6c
+  .word 0x690, 0x21e, 0x0, 0x1e
+  .word 0x690, 0x215b8, 0x0, 0xffffffb8
+  .word 0x690, 0x4, 0x0, 0x4
+  .word 0x690, 0xe69, 0x0, 0x69
+  .word 0x690, 0x4, 0x0, 0x4
+  .word 0x690, 0x73698785, 0x0, 0xffffff85
+  .word 0x690, 0xd8e1f9, 0x0, 0xfffffff9
+  .word 0x690, 0x1, 0x0, 0x1
+  .word 0x690, 0x35eb776b, 0x0, 0x6b
+  .word 0x690, 0x10, 0x0, 0x10
+  .word 0x690, 0xb7ce5ed, 0x0, 0xffffffed
+  .word 0x690, 0xd28fd14, 0x0, 0x14
+  .word 0x690, 0x1, 0x0, 0x1
+  .word 0x690, 0x2, 0x0, 0x2
+  .word 0x690, 0x4, 0x0, 0x4
+  .word 0x690, 0x8, 0x0, 0x8
+  .word 0x690, 0x10, 0x0, 0x10
+  .word 0x690, 0x20, 0x0, 0x20
+  .word 0x690, 0x40, 0x0, 0x40
+  .word 0x690, 0x80, 0x0, 0xffffff80
+  .word 0x690, 0x100, 0x0, 0x0
+  .word 0x690, 0x200, 0x0, 0x0
+  .word 0x690, 0x400, 0x0, 0x0
+  .word 0x690, 0x800, 0x0, 0x0
+  .word 0x690, 0x1000, 0x0, 0x0
+  .word 0x690, 0x2000, 0x0, 0x0
+  .word 0x690, 0x4000, 0x0, 0x0
+  .word 0x690, 0x8000, 0x0, 0x0
+  .word 0x690, 0x10000, 0x0, 0x0
+  .word 0x690, 0x20000, 0x0, 0x0
+  .word 0x690, 0x40000, 0x0, 0x0
+  .word 0x690, 0x80000, 0x0, 0x0
+  .word 0x690, 0x100000, 0x0, 0x0
+  .word 0x690, 0x200000, 0x0, 0x0
+  .word 0x690, 0x400000, 0x0, 0x0
+  .word 0x690, 0x800000, 0x0, 0x0
+  .word 0x690, 0x1000000, 0x0, 0x0
+  .word 0x690, 0x2000000, 0x0, 0x0
+  .word 0x690, 0x4000000, 0x0, 0x0
+  .word 0x690, 0x8000000, 0x0, 0x0
+  .word 0x690, 0x10000000, 0x0, 0x0
+  .word 0x690, 0x20000000, 0x0, 0x0
+  .word 0x690, 0x40000000, 0x0, 0x0
+  .word 0x690, 0x80000000, 0x0, 0x0
+  .word 0x690, 0xffffffff, 0x0, 0xffffffff
+  .word 0x690, 0x7fffffff, 0x0, 0xffffffff
+  .word 0x690, 0x3fffffff, 0x0, 0xffffffff
+  .word 0x690, 0x1fffffff, 0x0, 0xffffffff
+  .word 0x690, 0xfffffff, 0x0, 0xffffffff
+  .word 0x690, 0x7ffffff, 0x0, 0xffffffff
+  .word 0x690, 0x3ffffff, 0x0, 0xffffffff
+  .word 0x690, 0x1ffffff, 0x0, 0xffffffff
+  .word 0x690, 0xffffff, 0x0, 0xffffffff
+  .word 0x690, 0x7fffff, 0x0, 0xffffffff
+  .word 0x690, 0x3fffff, 0x0, 0xffffffff
+  .word 0x690, 0x1fffff, 0x0, 0xffffffff
+  .word 0x690, 0xfffff, 0x0, 0xffffffff
+  .word 0x690, 0x7ffff, 0x0, 0xffffffff
+  .word 0x690, 0x3ffff, 0x0, 0xffffffff
+  .word 0x690, 0x1ffff, 0x0, 0xffffffff
+  .word 0x690, 0xffff, 0x0, 0xffffffff
+  .word 0x690, 0x7fff, 0x0, 0xffffffff
+  .word 0x690, 0x3fff, 0x0, 0xffffffff
+  .word 0x690, 0x1fff, 0x0, 0xffffffff
+  .word 0x690, 0xfff, 0x0, 0xffffffff
+  .word 0x690, 0x7ff, 0x0, 0xffffffff
+  .word 0x690, 0x3ff, 0x0, 0xffffffff
+  .word 0x690, 0x1ff, 0x0, 0xffffffff
+  .word 0x690, 0xff, 0x0, 0xffffffff
+  .word 0x690, 0x7f, 0x0, 0x7f
+  .word 0x690, 0x3f, 0x0, 0x3f
+  .word 0x690, 0x1f, 0x0, 0x1f
+  .word 0x690, 0xf, 0x0, 0xf
+  .word 0x690, 0x7, 0x0, 0x7
+  .word 0x690, 0x3, 0x0, 0x3
+  .word 0x690, 0x1, 0x0, 0x1
+  .word 0x6a0, 0x0, 0x0, 0x0
+  .word 0x6a0, 0x80, 0x0, 0xffffff80
+  .word 0x6a0, 0x8000, 0x0, 0x0
+  .word 0x6a0, 0x80000000, 0x0, 0x0
+  .word 0x6a0, 0x1000000, 0x0, 0x0
+  .word 0x6a0, 0x10080, 0x0, 0xffffff80
+  .word 0x6a0, 0x6c, 0x0, 0x6c
+  .word 0x6a0, 0xe69, 0x0, 0x69
+  .word 0x6a0, 0x1, 0x0, 0x1
+  .word 0x6a0, 0xd28fd14, 0x0, 0x14
+  .word 0x6b0, 0x12345678, 0x0, 0x0
+  .word 0x6c0, 0x0, 0x0, 0x0
+  .word 0x6c0, 0x1, 0x0, 0x1
+  .word 0x6c0, 0x2, 0x0, 0x2
+  .word 0x6c0, 0x7f, 0x0, 0x7f
+  .word 0x6c0, 0x80, 0x0, 0x80
+  .word 0x6c0, 0xff, 0x0, 0xff
+  .word 0x6c0, 0x100, 0x0, 0x100
+  .word 0x6c0, 0x7fff, 0x0, 0x7fff
+  .word 0x6c0, 0x8000, 0x0, 0xffff8000
+  .word 0x6c0, 0xffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x10000, 0x0, 0x0
+  .word 0x6c0, 0x7fffffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x80000000, 0x0, 0x0
+  .word 0x6c0, 0x80000001, 0x0, 0x1
+  .word 0x6c0, 0xfffffffe, 0x0, 0xfffffffe
+  .word 0x6c0, 0xffffffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x1000000, 0x0, 0x0
+  .word 0x6c0, 0xff00ff, 0x0, 0xff
+  .word 0x6c0, 0xff00ff00, 0x0, 0xffffff00
+  .word 0x6c0, 0x12345678, 0x0, 0x5678
+  .word 0x6c0, 0x10080, 0x0, 0x80
+  .word 0x6c0, 0x3b30, 0x0, 0x3b30
+  .word 0x6c0, 0x723b417, 0x0, 0xffffb417
+  .word 0x6c0, 0x8b, 0x0, 0x8b
+  .word 0x6c0, 0x6c, 0x0, 0x6c
+  .word 0x6c0, 0x21e, 0x0, 0x21e
+  .word 0x6c0, 0x215b8, 0x0, 0x15b8
+  .word 0x6c0, 0x4, 0x0, 0x4
+  .word 0x6c0, 0xe69, 0x0, 0xe69
+  .word 0x6c0, 0x4, 0x0, 0x4
+  .word 0x6c0, 0x73698785, 0x0, 0xffff8785
+  .word 0x6c0, 0xd8e1f9, 0x0, 0xffffe1f9
+  .word 0x6c0, 0x1, 0x0, 0x1
+  .word 0x6c0, 0x35eb776b, 0x0, 0x776b
+  .word 0x6c0, 0x10, 0x0, 0x10
+  .word 0x6c0, 0xb7ce5ed, 0x0, 0xffffe5ed
+  .word 0x6c0, 0xd28fd14, 0x0, 0xfffffd14
+  .word 0x6c0, 0x1, 0x0, 0x1
+  .word 0x6c0, 0x2, 0x0, 0x2
+  .word 0x6c0, 0x4, 0x0, 0x4
+  .word 0x6c0, 0x8, 0x0, 0x8
+  .word 0x6c0, 0x10, 0x0, 0x10
+  .word 0x6c0, 0x20, 0x0, 0x20
+  .word 0x6c0, 0x40, 0x0, 0x40
+  .word 0x6c0, 0x80, 0x0, 0x80
+  .word 0x6c0, 0x100, 0x0, 0x100
+  .word 0x6c0, 0x200, 0x0, 0x200
+  .word 0x6c0, 0x400, 0x0, 0x400
+  .word 0x6c0, 0x800, 0x0, 0x800
+  .word 0x6c0, 0x1000, 0x0, 0x1000
+  .word 0x6c0, 0x2000, 0x0, 0x2000
+  .word 0x6c0, 0x4000, 0x0, 0x4000
+  .word 0x6c0, 0x8000, 0x0, 0xffff8000
+  .word 0x6c0, 0x10000, 0x0, 0x0
+  .word 0x6c0, 0x20000, 0x0, 0x0
+  .word 0x6c0, 0x40000, 0x0, 0x0
+  .word 0x6c0, 0x80000, 0x0, 0x0
+  .word 0x6c0, 0x100000, 0x0, 0x0
+  .word 0x6c0, 0x200000, 0x0, 0x0
+  .word 0x6c0, 0x400000, 0x0, 0x0
+  .word 0x6c0, 0x800000, 0x0, 0x0
+  .word 0x6c0, 0x1000000, 0x0, 0x0
+  .word 0x6c0, 0x2000000, 0x0, 0x0
+  .word 0x6c0, 0x4000000, 0x0, 0x0
+  .word 0x6c0, 0x8000000, 0x0, 0x0
+  .word 0x6c0, 0x10000000, 0x0, 0x0
+  .word 0x6c0, 0x20000000, 0x0, 0x0
+  .word 0x6c0, 0x40000000, 0x0, 0x0
+  .word 0x6c0, 0x80000000, 0x0, 0x0
+  .word 0x6c0, 0xffffffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x7fffffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x3fffffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x1fffffff, 0x0, 0xffffffff
+  .word 0x6c0, 0xfffffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x7ffffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x3ffffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x1ffffff, 0x0, 0xffffffff
+  .word 0x6c0, 0xffffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x7fffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x3fffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x1fffff, 0x0, 0xffffffff
+  .word 0x6c0, 0xfffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x7ffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x3ffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x1ffff, 0x0, 0xffffffff
+  .word 0x6c0, 0xffff, 0x0, 0xffffffff
+  .word 0x6c0, 0x7fff, 0x0, 0x7fff
+  .word 0x6c0, 0x3fff, 0x0, 0x3fff
+  .word 0x6c0, 0x1fff, 0x0, 0x1fff
+  .word 0x6c0, 0xfff, 0x0, 0xfff
+  .word 0x6c0, 0x7ff, 0x0, 0x7ff
+  .word 0x6c0, 0x3ff, 0x0, 0x3ff
+  .word 0x6c0, 0x1ff, 0x0, 0x1ff
+  .word 0x6c0, 0xff, 0x0, 0xff
+  .word 0x6c0, 0x7f, 0x0, 0x7f
+  .word 0x6c0, 0x3f, 0x0, 0x3f
+  .word 0x6c0, 0x1f, 0x0, 0x1f
+  .word 0x6c0, 0xf, 0x0, 0xf
+  .word 0x6c0, 0x7, 0x0, 0x7
+  .word 0x6c0, 0x3, 0x0, 0x3
+  .word 0x6c0, 0x1, 0x0, 0x1
+  .word 0x6d0, 0x0, 0x0, 0x0
+  .word 0x6d0, 0x80, 0x0, 0x80
+  .word 0x6d0, 0x8000, 0x0, 0xffff8000
+  .word 0x6d0, 0x80000000, 0x0, 0x0
+  .word 0x6d0, 0x1000000, 0x0, 0x0
+  .word 0x6d0, 0x10080, 0x0, 0x80
+  .word 0x6d0, 0x6c, 0x0, 0x6c
+  .word 0x6d0, 0xe69, 0x0, 0xe69
+  .word 0x6d0, 0x1, 0x0, 0x1
+  .word 0x6d0, 0xd28fd14, 0x0, 0xfffffd14
+  .word 0x6e0, 0x12345678, 0x0, 0x0
+  .word 0x6f0, 0x0, 0x0, 0x0
+  .word 0x6f0, 0x1, 0x0, 0x1
+  .word 0x6f0, 0x2, 0x0, 0x2
+  .word 0x6f0, 0x7f, 0x0, 0x7f
+  .word 0x6f0, 0x80, 0x0, 0x80
+  .word 0x6f0, 0xff, 0x0, 0xff
+  .word 0x6f0, 0x100, 0x0, 0x100
+  .word 0x6f0, 0x7fff, 0x0, 0x7fff
+  .word 0x6f0, 0x8000, 0x0, 0x8000
+  .word 0x6f0, 0xffff, 0x0, 0xffff
+  .word 0x6f0, 0x10000, 0x0, 0x0
+  .word 0x6f0, 0x7fffffff, 0x0, 0xffff
+  .word 0x6f0, 0x80000000, 0x0, 0x0
+  .word 0x6f0, 0x80000001, 0x0, 0x1
+  .word 0x6f0, 0xfffffffe, 0x0, 0xfffe
+  .word 0x6f0, 0xffffffff, 0x0, 0xffff
+  .word 0x6f0, 0x1000000, 0x0, 0x0
+  .word 0x6f0, 0xff00ff, 0x0, 0xff
+  .word 0x6f0, 0xff00ff00, 0x0, 0xff00
+  .word 0x6f0, 0x12345678, 0x0, 0x5678
+  .word 0x6f0, 0x10080, 0x0, 0x80
+  .word 0x6f0, 0x3b30, 0x0, 0x3b30
+  .word 0x6f0, 0x723b417, 0x0, 0xb417
+  .word 0x6f0, 0x8b, 0x0, 0x8b
+  .word 0x6f0, 0x6c, 0x0, 0x6c
+  .word 0x6f0, 0x21e, 0x0, 0x21e
+  .word 0x6f0, 0x215b8, 0x0, 0x15b8
+  .word 0x6f0, 0x4, 0x0, 0x4
+  .word 0x6f0, 0xe69, 0x0, 0xe69
+  .word 0x6f0, 0x4, 0x0, 0x4
+  .word 0x6f0, 0x73698785, 0x0, 0x8785
+  .word 0x6f0, 0xd8e1f9, 0x0, 0xe1f9
+  .word 0x6f0, 0x1, 0x0, 0x1
+  .word 0x6f0, 0x35eb776b, 0x0, 0x776b
+  .word 0x6f0, 0x10, 0x0, 0x10
+  .word 0x6f0, 0xb7ce5ed, 0x0, 0xe5ed
+  .word 0x6f0, 0xd28fd14, 0x0, 0xfd14
+  .word 0x6f0, 0x1, 0x0, 0x1
+  .word 0x6f0, 0x2, 0x0, 0x2
+  .word 0x6f0, 0x4, 0x0, 0x4
+  .word 0x6f0, 0x8, 0x0, 0x8
+  .word 0x6f0, 0x10, 0x0, 0x10
+  .word 0x6f0, 0x20, 0x0, 0x20
+  .word 0x6f0, 0x40, 0x0, 0x40
+  .word 0x6f0, 0x80, 0x0, 0x80
+  .word 0x6f0, 0x100, 0x0, 0x100
+  .word 0x6f0, 0x200, 0x0, 0x200
+  .word 0x6f0, 0x400, 0x0, 0x400
+  .word 0x6f0, 0x800, 0x0, 0x800
+  .word 0x6f0, 0x1000, 0x0, 0x1000
+  .word 0x6f0, 0x2000, 0x0, 0x2000
+  .word 0x6f0, 0x4000, 0x0, 0x4000
+  .word 0x6f0, 0x8000, 0x0, 0x8000
+  .word 0x6f0, 0x10000, 0x0, 0x0
+  .word 0x6f0, 0x20000, 0x0, 0x0
+  .word 0x6f0, 0x40000, 0x0, 0x0
+  .word 0x6f0, 0x80000, 0x0, 0x0
+  .word 0x6f0, 0x100000, 0x0, 0x0
+  .word 0x6f0, 0x200000, 0x0, 0x0
+  .word 0x6f0, 0x400000, 0x0, 0x0
+  .word 0x6f0, 0x800000, 0x0, 0x0
+  .word 0x6f0, 0x1000000, 0x0, 0x0
+  .word 0x6f0, 0x2000000, 0x0, 0x0
+  .word 0x6f0, 0x4000000, 0x0, 0x0
+  .word 0x6f0, 0x8000000, 0x0, 0x0
+  .word 0x6f0, 0x10000000, 0x0, 0x0
+  .word 0x6f0, 0x20000000, 0x0, 0x0
+  .word 0x6f0, 0x40000000, 0x0, 0x0
+  .word 0x6f0, 0x80000000, 0x0, 0x0
+  .word 0x6f0, 0xffffffff, 0x0, 0xffff
+  .word 0x6f0, 0x7fffffff, 0x0, 0xffff
+  .word 0x6f0, 0x3fffffff, 0x0, 0xffff
+  .word 0x6f0, 0x1fffffff, 0x0, 0xffff
+  .word 0x6f0, 0xfffffff, 0x0, 0xffff
+  .word 0x6f0, 0x7ffffff, 0x0, 0xffff
+  .word 0x6f0, 0x3ffffff, 0x0, 0xffff
+  .word 0x6f0, 0x1ffffff, 0x0, 0xffff
+  .word 0x6f0, 0xffffff, 0x0, 0xffff
+  .word 0x6f0, 0x7fffff, 0x0, 0xffff
+  .word 0x6f0, 0x3fffff, 0x0, 0xffff
+  .word 0x6f0, 0x1fffff, 0x0, 0xffff
+  .word 0x6f0, 0xfffff, 0x0, 0xffff
+  .word 0x6f0, 0x7ffff, 0x0, 0xffff
+  .word 0x6f0, 0x3ffff, 0x0, 0xffff
+  .word 0x6f0, 0x1ffff, 0x0, 0xffff
+  .word 0x6f0, 0xffff, 0x0, 0xffff
+  .word 0x6f0, 0x7fff, 0x0, 0x7fff
+  .word 0x6f0, 0x3fff, 0x0, 0x3fff
+  .word 0x6f0, 0x1fff, 0x0, 0x1fff
+  .word 0x6f0, 0xfff, 0x0, 0xfff
+  .word 0x6f0, 0x7ff, 0x0, 0x7ff
+  .word 0x6f0, 0x3ff, 0x0, 0x3ff
+  .word 0x6f0, 0x1ff, 0x0, 0x1ff
+  .word 0x6f0, 0xff, 0x0, 0xff
+  .word 0x6f0, 0x7f, 0x0, 0x7f
+  .word 0x6f0, 0x3f, 0x0, 0x3f
+  .word 0x6f0, 0x1f, 0x0, 0x1f
+  .word 0x6f0, 0xf, 0x0, 0xf
+  .word 0x6f0, 0x7, 0x0, 0x7
+  .word 0x6f0, 0x3, 0x0, 0x3
+  .word 0x6f0, 0x1, 0x0, 0x1
+  .word 0x700, 0x0, 0x0, 0x0
+  .word 0x700, 0x80, 0x0, 0x80
+  .word 0x700, 0x8000, 0x0, 0x8000
+  .word 0x700, 0x80000000, 0x0, 0x0
+  .word 0x700, 0x1000000, 0x0, 0x0
+  .word 0x700, 0x10080, 0x0, 0x80
+  .word 0x700, 0x6c, 0x0, 0x6c
+  .word 0x700, 0xe69, 0x0, 0xe69
+  .word 0x700, 0x1, 0x0, 0x1
+  .word 0x700, 0xd28fd14, 0x0, 0xfd14
+  .word 0x710, 0x12345678, 0x0, 0x0
+  .word 0x720, 0x0, 0x0, 0x0
+  .word 0x720, 0x1, 0x0, 0xff
+  .word 0x720, 0x2, 0x0, 0xff
+  .word 0x720, 0x7f, 0x0, 0xff
+  .word 0x720, 0x80, 0x0, 0xff
+  .word 0x720, 0xff, 0x0, 0xff
+  .word 0x720, 0x100, 0x0, 0xff00
+  .word 0x720, 0x7fff, 0x0, 0xffff
+  .word 0x720, 0x8000, 0x0, 0xff00
+  .word 0x720, 0xffff, 0x0, 0xffff
+  .word 0x720, 0x10000, 0x0, 0xff0000
+  .word 0x720, 0x7fffffff, 0x0, 0xffffffff
+  .word 0x720, 0x80000000, 0x0, 0xff000000
+  .word 0x720, 0x80000001, 0x0, 0xff0000ff
+  .word 0x720, 0xfffffffe, 0x0, 0xffffffff
+  .word 0x720, 0xffffffff, 0x0, 0xffffffff
+  .word 0x720, 0x1000000, 0x0, 0xff000000
+  .word 0x720, 0xff00ff, 0x0, 0xff00ff
+  .word 0x720, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x720, 0x12345678, 0x0, 0xffffffff
+  .word 0x720, 0x10080, 0x0, 0xff00ff
+  .word 0x720, 0x3b30, 0x0, 0xffff
+  .word 0x720, 0x723b417, 0x0, 0xffffffff
+  .word 0x720, 0x8b, 0x0, 0xff
+  .word 0x720, 0x6c, 0x0, 0xff
+  .word 0x720, 0x21e, 0x0, 0xffff
+  .word 0x720, 0x215b8, 0x0, 0xffffff
+  .word 0x720, 0x4, 0x0, 0xff
+  .word 0x720, 0xe69, 0x0, 0xffff
+  .word 0x720, 0x4, 0x0, 0xff
+  .word 0x720, 0x73698785, 0x0, 0xffffffff
+  .word 0x720, 0xd8e1f9, 0x0, 0xffffff
+  .word 0x720, 0x1, 0x0, 0xff
+  .word 0x720, 0x35eb776b, 0x0, 0xffffffff
+  .word 0x720, 0x10, 0x0, 0xff
+  .word 0x720, 0xb7ce5ed, 0x0, 0xffffffff
+  .word 0x720, 0xd28fd14, 0x0, 0xffffffff
+  .word 0x720, 0x1, 0x0, 0xff
+  .word 0x720, 0x2, 0x0, 0xff
+  .word 0x720, 0x4, 0x0, 0xff
+  .word 0x720, 0x8, 0x0, 0xff
+  .word 0x720, 0x10, 0x0, 0xff
+  .word 0x720, 0x20, 0x0, 0xff
+  .word 0x720, 0x40, 0x0, 0xff
+  .word 0x720, 0x80, 0x0, 0xff
+  .word 0x720, 0x100, 0x0, 0xff00
+  .word 0x720, 0x200, 0x0, 0xff00
+  .word 0x720, 0x400, 0x0, 0xff00
+  .word 0x720, 0x800, 0x0, 0xff00
+  .word 0x720, 0x1000, 0x0, 0xff00
+  .word 0x720, 0x2000, 0x0, 0xff00
+  .word 0x720, 0x4000, 0x0, 0xff00
+  .word 0x720, 0x8000, 0x0, 0xff00
+  .word 0x720, 0x10000, 0x0, 0xff0000
+  .word 0x720, 0x20000, 0x0, 0xff0000
+  .word 0x720, 0x40000, 0x0, 0xff0000
+  .word 0x720, 0x80000, 0x0, 0xff0000
+  .word 0x720, 0x100000, 0x0, 0xff0000
+  .word 0x720, 0x200000, 0x0, 0xff0000
+  .word 0x720, 0x400000, 0x0, 0xff0000
+  .word 0x720, 0x800000, 0x0, 0xff0000
+  .word 0x720, 0x1000000, 0x0, 0xff000000
+  .word 0x720, 0x2000000, 0x0, 0xff000000
+  .word 0x720, 0x4000000, 0x0, 0xff000000
+  .word 0x720, 0x8000000, 0x0, 0xff000000
+  .word 0x720, 0x10000000, 0x0, 0xff000000
+  .word 0x720, 0x20000000, 0x0, 0xff000000
+  .word 0x720, 0x40000000, 0x0, 0xff000000
+  .word 0x720, 0x80000000, 0x0, 0xff000000
+  .word 0x720, 0xffffffff, 0x0, 0xffffffff
+  .word 0x720, 0x7fffffff, 0x0, 0xffffffff
+  .word 0x720, 0x3fffffff, 0x0, 0xffffffff
+  .word 0x720, 0x1fffffff, 0x0, 0xffffffff
+  .word 0x720, 0xfffffff, 0x0, 0xffffffff
+  .word 0x720, 0x7ffffff, 0x0, 0xffffffff
+  .word 0x720, 0x3ffffff, 0x0, 0xffffffff
+  .word 0x720, 0x1ffffff, 0x0, 0xffffffff
+  .word 0x720, 0xffffff, 0x0, 0xffffff
+  .word 0x720, 0x7fffff, 0x0, 0xffffff
+  .word 0x720, 0x3fffff, 0x0, 0xffffff
+  .word 0x720, 0x1fffff, 0x0, 0xffffff
+  .word 0x720, 0xfffff, 0x0, 0xffffff
+  .word 0x720, 0x7ffff, 0x0, 0xffffff
+  .word 0x720, 0x3ffff, 0x0, 0xffffff
+  .word 0x720, 0x1ffff, 0x0, 0xffffff
+  .word 0x720, 0xffff, 0x0, 0xffff
+  .word 0x720, 0x7fff, 0x0, 0xffff
+  .word 0x720, 0x3fff, 0x0, 0xffff
+  .word 0x720, 0x1fff, 0x0, 0xffff
+  .word 0x720, 0xfff, 0x0, 0xffff
+  .word 0x720, 0x7ff, 0x0, 0xffff
+  .word 0x720, 0x3ff, 0x0, 0xffff
+  .word 0x720, 0x1ff, 0x0, 0xffff
+  .word 0x720, 0xff, 0x0, 0xff
+  .word 0x720, 0x7f, 0x0, 0xff
+  .word 0x720, 0x3f, 0x0, 0xff
+  .word 0x720, 0x1f, 0x0, 0xff
+  .word 0x720, 0xf, 0x0, 0xff
+  .word 0x720, 0x7, 0x0, 0xff
+  .word 0x720, 0x3, 0x0, 0xff
+  .word 0x720, 0x1, 0x0, 0xff
+  .word 0x730, 0x0, 0x0, 0x0
+  .word 0x730, 0x80, 0x0, 0xff
+  .word 0x730, 0x8000, 0x0, 0xff00
+  .word 0x730, 0x80000000, 0x0, 0xff000000
+  .word 0x730, 0x1000000, 0x0, 0xff000000
+  .word 0x730, 0x10080, 0x0, 0xff00ff
+  .word 0x730, 0x6c, 0x0, 0xff
+  .word 0x730, 0xe69, 0x0, 0xffff
+  .word 0x730, 0x1, 0x0, 0xff
+  .word 0x730, 0xd28fd14, 0x0, 0xffffffff
+  .word 0x740, 0x12345678, 0x0, 0x0
+  .word 0x750, 0x0, 0x0, 0x0
+  .word 0x750, 0x1, 0x0, 0x1000000
+  .word 0x750, 0x2, 0x0, 0x2000000
+  .word 0x750, 0x7f, 0x0, 0x7f000000
+  .word 0x750, 0x80, 0x0, 0x80000000
+  .word 0x750, 0xff, 0x0, 0xff000000
+  .word 0x750, 0x100, 0x0, 0x10000
+  .word 0x750, 0x7fff, 0x0, 0xff7f0000
+  .word 0x750, 0x8000, 0x0, 0x800000
+  .word 0x750, 0xffff, 0x0, 0xffff0000
+  .word 0x750, 0x10000, 0x0, 0x100
+  .word 0x750, 0x7fffffff, 0x0, 0xffffff7f
+  .word 0x750, 0x80000000, 0x0, 0x80
+  .word 0x750, 0x80000001, 0x0, 0x1000080
+  .word 0x750, 0xfffffffe, 0x0, 0xfeffffff
+  .word 0x750, 0xffffffff, 0x0, 0xffffffff
+  .word 0x750, 0x1000000, 0x0, 0x1
+  .word 0x750, 0xff00ff, 0x0, 0xff00ff00
+  .word 0x750, 0xff00ff00, 0x0, 0xff00ff
+  .word 0x750, 0x12345678, 0x0, 0x78563412
+  .word 0x750, 0x10080, 0x0, 0x80000100
+  .word 0x750, 0x3b30, 0x0, 0x303b0000
+  .word 0x750, 0x723b417, 0x0, 0x17b42307
+  .word 0x750, 0x8b, 0x0, 0x8b000000
+  .word 0x750, 0x6c, 0x0, 0x6c000000
+  .word 0x750, 0x21e, 0x0, 0x1e020000
+  .word 0x750, 0x215b8, 0x0, 0xb8150200
+  .word 0x750, 0x4, 0x0, 0x4000000
+  .word 0x750, 0xe69, 0x0, 0x690e0000
+  .word 0x750, 0x4, 0x0, 0x4000000
+  .word 0x750, 0x73698785, 0x0, 0x85876973
+  .word 0x750, 0xd8e1f9, 0x0, 0xf9e1d800
+  .word 0x750, 0x1, 0x0, 0x1000000
+  .word 0x750, 0x35eb776b, 0x0, 0x6b77eb35
+  .word 0x750, 0x10, 0x0, 0x10000000
+  .word 0x750, 0xb7ce5ed, 0x0, 0xede57c0b
+  .word 0x750, 0xd28fd14, 0x0, 0x14fd280d
+  .word 0x750, 0x1, 0x0, 0x1000000
+  .word 0x750, 0x2, 0x0, 0x2000000
+  .word 0x750, 0x4, 0x0, 0x4000000
+  .word 0x750, 0x8, 0x0, 0x8000000
+  .word 0x750, 0x10, 0x0, 0x10000000
+  .word 0x750, 0x20, 0x0, 0x20000000
+  .word 0x750, 0x40, 0x0, 0x40000000
+  .word 0x750, 0x80, 0x0, 0x80000000
+  .word 0x750, 0x100, 0x0, 0x10000
+  .word 0x750, 0x200, 0x0, 0x20000
+  .word 0x750, 0x400, 0x0, 0x40000
+  .word 0x750, 0x800, 0x0, 0x80000
+  .word 0x750, 0x1000, 0x0, 0x100000
+  .word 0x750, 0x2000, 0x0, 0x200000
+  .word 0x750, 0x4000, 0x0, 0x400000
+  .word 0x750, 0x8000, 0x0, 0x800000
+  .word 0x750, 0x10000, 0x0, 0x100
+  .word 0x750, 0x20000, 0x0, 0x200
+  .word 0x750, 0x40000, 0x0, 0x400
+  .word 0x750, 0x80000, 0x0, 0x800
+  .word 0x750, 0x100000, 0x0, 0x1000
+  .word 0x750, 0x200000, 0x0, 0x2000
+  .word 0x750, 0x400000, 0x0, 0x4000
+  .word 0x750, 0x800000, 0x0, 0x8000
+  .word 0x750, 0x1000000, 0x0, 0x1
+  .word 0x750, 0x2000000, 0x0, 0x2
+  .word 0x750, 0x4000000, 0x0, 0x4
+  .word 0x750, 0x8000000, 0x0, 0x8
+  .word 0x750, 0x10000000, 0x0, 0x10
+  .word 0x750, 0x20000000, 0x0, 0x20
+  .word 0x750, 0x40000000, 0x0, 0x40
+  .word 0x750, 0x80000000, 0x0, 0x80
+  .word 0x750, 0xffffffff, 0x0, 0xffffffff
+  .word 0x750, 0x7fffffff, 0x0, 0xffffff7f
+  .word 0x750, 0x3fffffff, 0x0, 0xffffff3f
+  .word 0x750, 0x1fffffff, 0x0, 0xffffff1f
+  .word 0x750, 0xfffffff, 0x0, 0xffffff0f
+  .word 0x750, 0x7ffffff, 0x0, 0xffffff07
+  .word 0x750, 0x3ffffff, 0x0, 0xffffff03
+  .word 0x750, 0x1ffffff, 0x0, 0xffffff01
+  .word 0x750, 0xffffff, 0x0, 0xffffff00
+  .word 0x750, 0x7fffff, 0x0, 0xffff7f00
+  .word 0x750, 0x3fffff, 0x0, 0xffff3f00
+  .word 0x750, 0x1fffff, 0x0, 0xffff1f00
+  .word 0x750, 0xfffff, 0x0, 0xffff0f00
+  .word 0x750, 0x7ffff, 0x0, 0xffff0700
+  .word 0x750, 0x3ffff, 0x0, 0xffff0300
+  .word 0x750, 0x1ffff, 0x0, 0xffff0100
+  .word 0x750, 0xffff, 0x0, 0xffff0000
+  .word 0x750, 0x7fff, 0x0, 0xff7f0000
+  .word 0x750, 0x3fff, 0x0, 0xff3f0000
+  .word 0x750, 0x1fff, 0x0, 0xff1f0000
+  .word 0x750, 0xfff, 0x0, 0xff0f0000
+  .word 0x750, 0x7ff, 0x0, 0xff070000
+  .word 0x750, 0x3ff, 0x0, 0xff030000
+  .word 0x750, 0x1ff, 0x0, 0xff010000
+  .word 0x750, 0xff, 0x0, 0xff000000
+  .word 0x750, 0x7f, 0x0, 0x7f000000
+  .word 0x750, 0x3f, 0x0, 0x3f000000
+  .word 0x750, 0x1f, 0x0, 0x1f000000
+  .word 0x750, 0xf, 0x0, 0xf000000
+  .word 0x750, 0x7, 0x0, 0x7000000
+  .word 0x750, 0x3, 0x0, 0x3000000
+  .word 0x750, 0x1, 0x0, 0x1000000
+  .word 0x760, 0x0, 0x0, 0x0
+  .word 0x760, 0x80, 0x0, 0x80000000
+  .word 0x760, 0x8000, 0x0, 0x800000
+  .word 0x760, 0x80000000, 0x0, 0x80
+  .word 0x760, 0x1000000, 0x0, 0x1
+  .word 0x760, 0x10080, 0x0, 0x80000100
+  .word 0x760, 0x6c, 0x0, 0x6c000000
+  .word 0x760, 0xe69, 0x0, 0x690e0000
+  .word 0x760, 0x1, 0x0, 0x1000000
+  .word 0x760, 0xd28fd14, 0x0, 0x14fd280d
+  .word 0x770, 0x12345678, 0x0, 0x0
+  .word 0x780, 0x0, 0x0, 0x0
+  .word 0x780, 0x7f, 0x0, 0x7f
+  .word 0x780, 0x100, 0x0, 0x100
+  .word 0x780, 0xffff, 0x0, 0xffff
+  .word 0x780, 0x80000000, 0x0, 0x80000000
+  .word 0x780, 0xffffffff, 0x0, 0xffffffff
+  .word 0x780, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x780, 0x3b30, 0x0, 0x3b30
+  .word 0x780, 0x6c, 0x0, 0x6c
+  .word 0x780, 0x4, 0x0, 0x4
+  .word 0x780, 0x73698785, 0x0, 0x73698785
+  .word 0x780, 0x35eb776b, 0x0, 0x35eb776b
+  .word 0x780, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x790, 0x0, 0x0, 0x0
+  .word 0x790, 0x7f, 0x0, 0x8000003f
+  .word 0x790, 0x100, 0x0, 0x80
+  .word 0x790, 0xffff, 0x0, 0x80007fff
+  .word 0x790, 0x80000000, 0x0, 0x40000000
+  .word 0x790, 0xffffffff, 0x0, 0xffffffff
+  .word 0x790, 0xff00ff00, 0x0, 0x7f807f80
+  .word 0x790, 0x3b30, 0x0, 0x1d98
+  .word 0x790, 0x6c, 0x0, 0x36
+  .word 0x790, 0x4, 0x0, 0x2
+  .word 0x790, 0x73698785, 0x0, 0xb9b4c3c2
+  .word 0x790, 0x35eb776b, 0x0, 0x9af5bbb5
+  .word 0x790, 0xd28fd14, 0x0, 0x6947e8a
+  .word 0x7a0, 0x0, 0x0, 0x0
+  .word 0x7a0, 0x7f, 0x0, 0x7f000000
+  .word 0x7a0, 0x100, 0x0, 0x1
+  .word 0x7a0, 0xffff, 0x0, 0xff0000ff
+  .word 0x7a0, 0x80000000, 0x0, 0x800000
+  .word 0x7a0, 0xffffffff, 0x0, 0xffffffff
+  .word 0x7a0, 0xff00ff00, 0x0, 0xff00ff
+  .word 0x7a0, 0x3b30, 0x0, 0x3000003b
+  .word 0x7a0, 0x6c, 0x0, 0x6c000000
+  .word 0x7a0, 0x4, 0x0, 0x4000000
+  .word 0x7a0, 0x73698785, 0x0, 0x85736987
+  .word 0x7a0, 0x35eb776b, 0x0, 0x6b35eb77
+  .word 0x7a0, 0xd28fd14, 0x0, 0x140d28fd
+  .word 0x7b0, 0x0, 0x0, 0x0
+  .word 0x7b0, 0x7f, 0x0, 0xfe0000
+  .word 0x7b0, 0x100, 0x0, 0x2000000
+  .word 0x7b0, 0xffff, 0x0, 0xfffe0001
+  .word 0x7b0, 0x80000000, 0x0, 0x10000
+  .word 0x7b0, 0xffffffff, 0x0, 0xffffffff
+  .word 0x7b0, 0xff00ff00, 0x0, 0xfe01fe01
+  .word 0x7b0, 0x3b30, 0x0, 0x76600000
+  .word 0x7b0, 0x6c, 0x0, 0xd80000
+  .word 0x7b0, 0x4, 0x0, 0x80000
+  .word 0x7b0, 0x73698785, 0x0, 0xf0ae6d3
+  .word 0x7b0, 0x35eb776b, 0x0, 0xeed66bd6
+  .word 0x7b0, 0xd28fd14, 0x0, 0xfa281a51
+  .word 0x7c0, 0x0, 0x0, 0x0
+  .word 0x7c0, 0x7f, 0x0, 0x7f0000
+  .word 0x7c0, 0x100, 0x0, 0x1000000
+  .word 0x7c0, 0xffff, 0x0, 0xffff0000
+  .word 0x7c0, 0x80000000, 0x0, 0x8000
+  .word 0x7c0, 0xffffffff, 0x0, 0xffffffff
+  .word 0x7c0, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x7c0, 0x3b30, 0x0, 0x3b300000
+  .word 0x7c0, 0x6c, 0x0, 0x6c0000
+  .word 0x7c0, 0x4, 0x0, 0x40000
+  .word 0x7c0, 0x73698785, 0x0, 0x87857369
+  .word 0x7c0, 0x35eb776b, 0x0, 0x776b35eb
+  .word 0x7c0, 0xd28fd14, 0x0, 0xfd140d28
+  .word 0x7d0, 0x0, 0x0, 0x0
+  .word 0x7d0, 0x7f, 0x0, 0xfe
+  .word 0x7d0, 0x100, 0x0, 0x200
+  .word 0x7d0, 0xffff, 0x0, 0x1fffe
+  .word 0x7d0, 0x80000000, 0x0, 0x1
+  .word 0x7d0, 0xffffffff, 0x0, 0xffffffff
+  .word 0x7d0, 0xff00ff00, 0x0, 0xfe01fe01
+  .word 0x7d0, 0x3b30, 0x0, 0x7660
+  .word 0x7d0, 0x6c, 0x0, 0xd8
+  .word 0x7d0, 0x4, 0x0, 0x8
+  .word 0x7d0, 0x73698785, 0x0, 0xe6d30f0a
+  .word 0x7d0, 0x35eb776b, 0x0, 0x6bd6eed6
+  .word 0x7d0, 0xd28fd14, 0x0, 0x1a51fa28
+  .word 0x7e0, 0x0, 0x0, 0x0
+  .word 0x7e0, 0x7f, 0x0, 0x7e
+  .word 0x7e0, 0x100, 0x0, 0x100
+  .word 0x7e0, 0xffff, 0x0, 0xfffe
+  .word 0x7e0, 0x80000000, 0x0, 0x80000000
+  .word 0x7e0, 0xffffffff, 0x0, 0xfffffffe
+  .word 0x7e0, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x7e0, 0x3b30, 0x0, 0x3b30
+  .word 0x7e0, 0x6c, 0x0, 0x6c
+  .word 0x7e0, 0x4, 0x0, 0x4
+  .word 0x7e0, 0x73698785, 0x0, 0x73698784
+  .word 0x7e0, 0x35eb776b, 0x0, 0x35eb776a
+  .word 0x7e0, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x7f0, 0x0, 0x0, 0x0
+  .word 0x7f0, 0x7f, 0x0, 0x7d
+  .word 0x7f0, 0x100, 0x0, 0x100
+  .word 0x7f0, 0xffff, 0x0, 0xfffd
+  .word 0x7f0, 0x80000000, 0x0, 0x80000000
+  .word 0x7f0, 0xffffffff, 0x0, 0xfffffffd
+  .word 0x7f0, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x7f0, 0x3b30, 0x0, 0x3b30
+  .word 0x7f0, 0x6c, 0x0, 0x6c
+  .word 0x7f0, 0x4, 0x0, 0x4
+  .word 0x7f0, 0x73698785, 0x0, 0x73698785
+  .word 0x7f0, 0x35eb776b, 0x0, 0x35eb7769
+  .word 0x7f0, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x800, 0x0, 0x0, 0x0
+  .word 0x800, 0x7f, 0x0, 0x7f
+  .word 0x800, 0x100, 0x0, 0x0
+  .word 0x800, 0xffff, 0x0, 0xfeff
+  .word 0x800, 0x80000000, 0x0, 0x80000000
+  .word 0x800, 0xffffffff, 0x0, 0xfffffeff
+  .word 0x800, 0xff00ff00, 0x0, 0xff00fe00
+  .word 0x800, 0x3b30, 0x0, 0x3a30
+  .word 0x800, 0x6c, 0x0, 0x6c
+  .word 0x800, 0x4, 0x0, 0x4
+  .word 0x800, 0x73698785, 0x0, 0x73698685
+  .word 0x800, 0x35eb776b, 0x0, 0x35eb766b
+  .word 0x800, 0xd28fd14, 0x0, 0xd28fc14
+  .word 0x810, 0x0, 0x0, 0x0
+  .word 0x810, 0x7f, 0x0, 0x7f
+  .word 0x810, 0x100, 0x0, 0x100
+  .word 0x810, 0xffff, 0x0, 0x7fff
+  .word 0x810, 0x80000000, 0x0, 0x80000000
+  .word 0x810, 0xffffffff, 0x0, 0xffff7fff
+  .word 0x810, 0xff00ff00, 0x0, 0xff007f00
+  .word 0x810, 0x3b30, 0x0, 0x3b30
+  .word 0x810, 0x6c, 0x0, 0x6c
+  .word 0x810, 0x4, 0x0, 0x4
+  .word 0x810, 0x73698785, 0x0, 0x73690785
+  .word 0x810, 0x35eb776b, 0x0, 0x35eb776b
+  .word 0x810, 0xd28fd14, 0x0, 0xd287d14
+  .word 0x820, 0x0, 0x0, 0x0
+  .word 0x820, 0x7f, 0x0, 0x7f
+  .word 0x820, 0x100, 0x0, 0x100
+  .word 0x820, 0xffff, 0x0, 0xffff
+  .word 0x820, 0x80000000, 0x0, 0x80000000
+  .word 0x820, 0xffffffff, 0x0, 0xfffeffff
+  .word 0x820, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x820, 0x3b30, 0x0, 0x3b30
+  .word 0x820, 0x6c, 0x0, 0x6c
+  .word 0x820, 0x4, 0x0, 0x4
+  .word 0x820, 0x73698785, 0x0, 0x73688785
+  .word 0x820, 0x35eb776b, 0x0, 0x35ea776b
+  .word 0x820, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x830, 0x0, 0x0, 0x0
+  .word 0x830, 0x7f, 0x0, 0x7f
+  .word 0x830, 0x100, 0x0, 0x100
+  .word 0x830, 0xffff, 0x0, 0xffff
+  .word 0x830, 0x80000000, 0x0, 0x0
+  .word 0x830, 0xffffffff, 0x0, 0x7fffffff
+  .word 0x830, 0xff00ff00, 0x0, 0x7f00ff00
+  .word 0x830, 0x3b30, 0x0, 0x3b30
+  .word 0x830, 0x6c, 0x0, 0x6c
+  .word 0x830, 0x4, 0x0, 0x4
+  .word 0x830, 0x73698785, 0x0, 0x73698785
+  .word 0x830, 0x35eb776b, 0x0, 0x35eb776b
+  .word 0x830, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x840, 0x0, 0x0, 0x1
+  .word 0x840, 0x7f, 0x0, 0x7f
+  .word 0x840, 0x100, 0x0, 0x101
+  .word 0x840, 0xffff, 0x0, 0xffff
+  .word 0x840, 0x80000000, 0x0, 0x80000001
+  .word 0x840, 0xffffffff, 0x0, 0xffffffff
+  .word 0x840, 0xff00ff00, 0x0, 0xff00ff01
+  .word 0x840, 0x3b30, 0x0, 0x3b31
+  .word 0x840, 0x6c, 0x0, 0x6d
+  .word 0x840, 0x4, 0x0, 0x5
+  .word 0x840, 0x73698785, 0x0, 0x73698785
+  .word 0x840, 0x35eb776b, 0x0, 0x35eb776b
+  .word 0x840, 0xd28fd14, 0x0, 0xd28fd15
+  .word 0x850, 0x0, 0x0, 0x2
+  .word 0x850, 0x7f, 0x0, 0x7f
+  .word 0x850, 0x100, 0x0, 0x102
+  .word 0x850, 0xffff, 0x0, 0xffff
+  .word 0x850, 0x80000000, 0x0, 0x80000002
+  .word 0x850, 0xffffffff, 0x0, 0xffffffff
+  .word 0x850, 0xff00ff00, 0x0, 0xff00ff02
+  .word 0x850, 0x3b30, 0x0, 0x3b32
+  .word 0x850, 0x6c, 0x0, 0x6e
+  .word 0x850, 0x4, 0x0, 0x6
+  .word 0x850, 0x73698785, 0x0, 0x73698787
+  .word 0x850, 0x35eb776b, 0x0, 0x35eb776b
+  .word 0x850, 0xd28fd14, 0x0, 0xd28fd16
+  .word 0x860, 0x0, 0x0, 0x100
+  .word 0x860, 0x7f, 0x0, 0x17f
+  .word 0x860, 0x100, 0x0, 0x100
+  .word 0x860, 0xffff, 0x0, 0xffff
+  .word 0x860, 0x80000000, 0x0, 0x80000100
+  .word 0x860, 0xffffffff, 0x0, 0xffffffff
+  .word 0x860, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x860, 0x3b30, 0x0, 0x3b30
+  .word 0x860, 0x6c, 0x0, 0x16c
+  .word 0x860, 0x4, 0x0, 0x104
+  .word 0x860, 0x73698785, 0x0, 0x73698785
+  .word 0x860, 0x35eb776b, 0x0, 0x35eb776b
+  .word 0x860, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x870, 0x0, 0x0, 0x8000
+  .word 0x870, 0x7f, 0x0, 0x807f
+  .word 0x870, 0x100, 0x0, 0x8100
+  .word 0x870, 0xffff, 0x0, 0xffff
+  .word 0x870, 0x80000000, 0x0, 0x80008000
+  .word 0x870, 0xffffffff, 0x0, 0xffffffff
+  .word 0x870, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x870, 0x3b30, 0x0, 0xbb30
+  .word 0x870, 0x6c, 0x0, 0x806c
+  .word 0x870, 0x4, 0x0, 0x8004
+  .word 0x870, 0x73698785, 0x0, 0x73698785
+  .word 0x870, 0x35eb776b, 0x0, 0x35ebf76b
+  .word 0x870, 0xd28fd14, 0x0, 0xd28fd14
+  .word 0x880, 0x0, 0x0, 0x10000
+  .word 0x880, 0x7f, 0x0, 0x1007f
+  .word 0x880, 0x100, 0x0, 0x10100
+  .word 0x880, 0xffff, 0x0, 0x1ffff
+  .word 0x880, 0x80000000, 0x0, 0x80010000
+  .word 0x880, 0xffffffff, 0x0, 0xffffffff
+  .word 0x880, 0xff00ff00, 0x0, 0xff01ff00
+  .word 0x880, 0x3b30, 0x0, 0x13b30
+  .word 0x880, 0x6c, 0x0, 0x1006c
+  .word 0x880, 0x4, 0x0, 0x10004
+  .word 0x880, 0x73698785, 0x0, 0x73698785
+  .word 0x880, 0x35eb776b, 0x0, 0x35eb776b
+  .word 0x880, 0xd28fd14, 0x0, 0xd29fd14
+  .word 0x890, 0x0, 0x0, 0x80000000
+  .word 0x890, 0x7f, 0x0, 0x8000007f
+  .word 0x890, 0x100, 0x0, 0x80000100
+  .word 0x890, 0xffff, 0x0, 0x8000ffff
+  .word 0x890, 0x80000000, 0x0, 0x80000000
+  .word 0x890, 0xffffffff, 0x0, 0xffffffff
+  .word 0x890, 0xff00ff00, 0x0, 0xff00ff00
+  .word 0x890, 0x3b30, 0x0, 0x80003b30
+  .word 0x890, 0x6c, 0x0, 0x8000006c
+  .word 0x890, 0x4, 0x0, 0x80000004
+  .word 0x890, 0x73698785, 0x0, 0xf3698785
+  .word 0x890, 0x35eb776b, 0x0, 0xb5eb776b
+  .word 0x890, 0xd28fd14, 0x0, 0x8d28fd14
+  .word 0x8a0, 0x0, 0x0, 0x1
+  .word 0x8a0, 0x7f, 0x0, 0x7e
+  .word 0x8a0, 0x100, 0x0, 0x101
+  .word 0x8a0, 0xffff, 0x0, 0xfffe
+  .word 0x8a0, 0x80000000, 0x0, 0x80000001
+  .word 0x8a0, 0xffffffff, 0x0, 0xfffffffe
+  .word 0x8a0, 0xff00ff00, 0x0, 0xff00ff01
+  .word 0x8a0, 0x3b30, 0x0, 0x3b31
+  .word 0x8a0, 0x6c, 0x0, 0x6d
+  .word 0x8a0, 0x4, 0x0, 0x5
+  .word 0x8a0, 0x73698785, 0x0, 0x73698784
+  .word 0x8a0, 0x35eb776b, 0x0, 0x35eb776a
+  .word 0x8a0, 0xd28fd14, 0x0, 0xd28fd15
+  .word 0x8b0, 0x0, 0x0, 0x2
+  .word 0x8b0, 0x7f, 0x0, 0x7d
+  .word 0x8b0, 0x100, 0x0, 0x102
+  .word 0x8b0, 0xffff, 0x0, 0xfffd
+  .word 0x8b0, 0x80000000, 0x0, 0x80000002
+  .word 0x8b0, 0xffffffff, 0x0, 0xfffffffd
+  .word 0x8b0, 0xff00ff00, 0x0, 0xff00ff02
+  .word 0x8b0, 0x3b30, 0x0, 0x3b32
+  .word 0x8b0, 0x6c, 0x0, 0x6e
+  .word 0x8b0, 0x4, 0x0, 0x6
+  .word 0x8b0, 0x73698785, 0x0, 0x73698787
+  .word 0x8b0, 0x35eb776b, 0x0, 0x35eb7769
+  .word 0x8b0, 0xd28fd14, 0x0, 0xd28fd16
+  .word 0x8c0, 0x0, 0x0, 0x100
+  .word 0x8c0, 0x7f, 0x0, 0x17f
+  .word 0x8c0, 0x100, 0x0, 0x0
+  .word 0x8c0, 0xffff, 0x0, 0xfeff
+  .word 0x8c0, 0x80000000, 0x0, 0x80000100
+  .word 0x8c0, 0xffffffff, 0x0, 0xfffffeff
+  .word 0x8c0, 0xff00ff00, 0x0, 0xff00fe00
+  .word 0x8c0, 0x3b30, 0x0, 0x3a30
+  .word 0x8c0, 0x6c, 0x0, 0x16c
+  .word 0x8c0, 0x4, 0x0, 0x104
+  .word 0x8c0, 0x73698785, 0x0, 0x73698685
+  .word 0x8c0, 0x35eb776b, 0x0, 0x35eb766b
+  .word 0x8c0, 0xd28fd14, 0x0, 0xd28fc14
+  .word 0x8d0, 0x0, 0x0, 0x8000
+  .word 0x8d0, 0x7f, 0x0, 0x807f
+  .word 0x8d0, 0x100, 0x0, 0x8100
+  .word 0x8d0, 0xffff, 0x0, 0x7fff
+  .word 0x8d0, 0x80000000, 0x0, 0x80008000
+  .word 0x8d0, 0xffffffff, 0x0, 0xffff7fff
+  .word 0x8d0, 0xff00ff00, 0x0, 0xff007f00
+  .word 0x8d0, 0x3b30, 0x0, 0xbb30
+  .word 0x8d0, 0x6c, 0x0, 0x806c
+  .word 0x8d0, 0x4, 0x0, 0x8004
+  .word 0x8d0, 0x73698785, 0x0, 0x73690785
+  .word 0x8d0, 0x35eb776b, 0x0, 0x35ebf76b
+  .word 0x8d0, 0xd28fd14, 0x0, 0xd287d14
+  .word 0x8e0, 0x0, 0x0, 0x10000
+  .word 0x8e0, 0x7f, 0x0, 0x1007f
+  .word 0x8e0, 0x100, 0x0, 0x10100
+  .word 0x8e0, 0xffff, 0x0, 0x1ffff
+  .word 0x8e0, 0x80000000, 0x0, 0x80010000
+  .word 0x8e0, 0xffffffff, 0x0, 0xfffeffff
+  .word 0x8e0, 0xff00ff00, 0x0, 0xff01ff00
+  .word 0x8e0, 0x3b30, 0x0, 0x13b30
+  .word 0x8e0, 0x6c, 0x0, 0x1006c
+  .word 0x8e0, 0x4, 0x0, 0x10004
+  .word 0x8e0, 0x73698785, 0x0, 0x73688785
+  .word 0x8e0, 0x35eb776b, 0x0, 0x35ea776b
+  .word 0x8e0, 0xd28fd14, 0x0, 0xd29fd14
+  .word 0x8f0, 0x0, 0x0, 0x80000000
+  .word 0x8f0, 0x7f, 0x0, 0x8000007f
+  .word 0x8f0, 0x100, 0x0, 0x80000100
+  .word 0x8f0, 0xffff, 0x0, 0x8000ffff
+  .word 0x8f0, 0x80000000, 0x0, 0x0
+  .word 0x8f0, 0xffffffff, 0x0, 0x7fffffff
+  .word 0x8f0, 0xff00ff00, 0x0, 0x7f00ff00
+  .word 0x8f0, 0x3b30, 0x0, 0x80003b30
+  .word 0x8f0, 0x6c, 0x0, 0x8000006c
+  .word 0x8f0, 0x4, 0x0, 0x80000004
+  .word 0x8f0, 0x73698785, 0x0, 0xf3698785
+  .word 0x8f0, 0x35eb776b, 0x0, 0xb5eb776b
+  .word 0x8f0, 0xd28fd14, 0x0, 0x8d28fd14
+  .word 0x900, 0x0, 0x0, 0x0
+  .word 0x900, 0x7f, 0x0, 0x1
+  .word 0x900, 0x100, 0x0, 0x0
+  .word 0x900, 0xffff, 0x0, 0x1
+  .word 0x900, 0x80000000, 0x0, 0x0
+  .word 0x900, 0xffffffff, 0x0, 0x1
+  .word 0x900, 0xff00ff00, 0x0, 0x0
+  .word 0x900, 0x3b30, 0x0, 0x0
+  .word 0x900, 0x6c, 0x0, 0x0
+  .word 0x900, 0x4, 0x0, 0x0
+  .word 0x900, 0x73698785, 0x0, 0x1
+  .word 0x900, 0x35eb776b, 0x0, 0x1
+  .word 0x900, 0xd28fd14, 0x0, 0x0
+  .word 0x910, 0x0, 0x0, 0x0
+  .word 0x910, 0x7f, 0x0, 0x1
+  .word 0x910, 0x100, 0x0, 0x0
+  .word 0x910, 0xffff, 0x0, 0x1
+  .word 0x910, 0x80000000, 0x0, 0x0
+  .word 0x910, 0xffffffff, 0x0, 0x1
+  .word 0x910, 0xff00ff00, 0x0, 0x0
+  .word 0x910, 0x3b30, 0x0, 0x0
+  .word 0x910, 0x6c, 0x0, 0x0
+  .word 0x910, 0x4, 0x0, 0x0
+  .word 0x910, 0x73698785, 0x0, 0x0
+  .word 0x910, 0x35eb776b, 0x0, 0x1
+  .word 0x910, 0xd28fd14, 0x0, 0x0
+  .word 0x920, 0x0, 0x0, 0x0
+  .word 0x920, 0x7f, 0x0, 0x0
+  .word 0x920, 0x100, 0x0, 0x1
+  .word 0x920, 0xffff, 0x0, 0x1
+  .word 0x920, 0x80000000, 0x0, 0x0
+  .word 0x920, 0xffffffff, 0x0, 0x1
+  .word 0x920, 0xff00ff00, 0x0, 0x1
+  .word 0x920, 0x3b30, 0x0, 0x1
+  .word 0x920, 0x6c, 0x0, 0x0
+  .word 0x920, 0x4, 0x0, 0x0
+  .word 0x920, 0x73698785, 0x0, 0x1
+  .word 0x920, 0x35eb776b, 0x0, 0x1
+  .word 0x920, 0xd28fd14, 0x0, 0x1
+  .word 0x930, 0x0, 0x0, 0x0
+  .word 0x930, 0x7f, 0x0, 0x0
+  .word 0x930, 0x100, 0x0, 0x0
+  .word 0x930, 0xffff, 0x0, 0x1
+  .word 0x930, 0x80000000, 0x0, 0x0
+  .word 0x930, 0xffffffff, 0x0, 0x1
+  .word 0x930, 0xff00ff00, 0x0, 0x1
+  .word 0x930, 0x3b30, 0x0, 0x0
+  .word 0x930, 0x6c, 0x0, 0x0
+  .word 0x930, 0x4, 0x0, 0x0
+  .word 0x930, 0x73698785, 0x0, 0x1
+  .word 0x930, 0x35eb776b, 0x0, 0x0
+  .word 0x930, 0xd28fd14, 0x0, 0x1
+  .word 0x940, 0x0, 0x0, 0x0
+  .word 0x940, 0x7f, 0x0, 0x0
+  .word 0x940, 0x100, 0x0, 0x0
+  .word 0x940, 0xffff, 0x0, 0x0
+  .word 0x940, 0x80000000, 0x0, 0x0
+  .word 0x940, 0xffffffff, 0x0, 0x1
+  .word 0x940, 0xff00ff00, 0x0, 0x0
+  .word 0x940, 0x3b30, 0x0, 0x0
+  .word 0x940, 0x6c, 0x0, 0x0
+  .word 0x940, 0x4, 0x0, 0x0
+  .word 0x940, 0x73698785, 0x0, 0x1
+  .word 0x940, 0x35eb776b, 0x0, 0x1
+  .word 0x940, 0xd28fd14, 0x0, 0x0
+  .word 0x950, 0x0, 0x0, 0x0
+  .word 0x950, 0x7f, 0x0, 0x0
+  .word 0x950, 0x100, 0x0, 0x0
+  .word 0x950, 0xffff, 0x0, 0x0
+  .word 0x950, 0x80000000, 0x0, 0x1
+  .word 0x950, 0xffffffff, 0x0, 0x1
+  .word 0x950, 0xff00ff00, 0x0, 0x1
+  .word 0x950, 0x3b30, 0x0, 0x0
+  .word 0x950, 0x6c, 0x0, 0x0
+  .word 0x950, 0x4, 0x0, 0x0
+  .word 0x950, 0x73698785, 0x0, 0x0
+  .word 0x950, 0x35eb776b, 0x0, 0x0
+  .word 0x950, 0xd28fd14, 0x0, 0x0
+cases_end:
+
+msg_ok:    .asciz "zb: ok\n"
+msg_fail:  .asciz "zb: FAIL "
+msg_of:    .asciz " of "
+msg_case:  .asciz "case "
+msg_colon: .asciz ": "
+msg_nl:    .asciz "\n"
@@ -0,0 +1,335 @@
+#!/usr/bin/env python3
+# zb_gen.py
+#
+#   Generates the bit manipulation guest test.  It is a table of cases whose
+#   expected result is worked out here, and a runner which loads the two
+#   operands of each case, calls a stub holding its instruction and checks
+#   the result that comes back.
+#
+#   Usage:
+#     python3 zb_gen.py > zb.s
+
+import random
+import sys
+
+MASK = 0xffffffff
+
+
+def sext(x, bits):
+    x &= (1 << bits) - 1
+    return x - (1 << bits) if x >> (bits - 1) else x
+
+
+def s32(x):
+    return sext(x, 32)
+
+
+def clz(a):
+    return 32 - a.bit_length()
+
+
+def ctz(a):
+    return 32 if a == 0 else (a & -a).bit_length() - 1
+
+
+def rol(a, n):
+    n &= 31
+    return ((a << n) | (a >> (32 - n))) & MASK
+
+
+def ror(a, n):
+    return rol(a, 32 - (n & 31))
+
+
+def orcb(a):
+    return sum(0xff << i for i in range(0, 32, 8) if (a >> i) & 0xff)
+
+
+def rev8(a):
+    return int.from_bytes(a.to_bytes(4, 'little'), 'big')
+
+
+# register forms of each instruction and what they compute from a and b.
+# the zbs shifts and rotates only use the low five bits of b.
+BINARY = {
+    'sh1add': lambda a, b: (b + (a << 1)) & MASK,
+    'sh2add': lambda a, b: (b + (a << 2)) & MASK,
+    'sh3add': lambda a, b: (b + (a << 3)) & MASK,
+    'andn':   lambda a, b: a & ~b & MASK,
+    'orn':    lambda a, b: (a | ~b) & MASK,
+    'xnor':   lambda a, b: ~(a ^ b) & MASK,
+    'min':    lambda a, b: a if s32(a) < s32(b) else b,
+    'max':    lambda a, b: a if s32(a) > s32(b) else b,
+    'minu':   lambda a, b: min(a, b),
+    'maxu':   lambda a, b: max(a, b),
+    'rol':    rol,
+    'ror':    ror,
+    'bclr':   lambda a, b: a & ~(1 << (b & 31)) & MASK,
+    'bset':   lambda a, b: a | (1 << (b & 31)),
+    'binv':   lambda a, b: a ^ (1 << (b & 31)),
+    'bext':   lambda a, b: (a >> (b & 31)) & 1,
+}
+
+UNARY = {
+    'clz':    clz,
+    'ctz':    ctz,
+    'cpop':   lambda a: bin(a).count('1'),
+    'sext.b': lambda a: sext(a, 8) & MASK,
+    'sext.h': lambda a: sext(a, 16) & MASK,
+    'zext.h': lambda a: a & 0xffff,
+    'orc.b':  orcb,
+    'rev8':   rev8,
+}
+
+IMMEDIATE = {
+    'rori':  ror,
+    'bclri': BINARY['bclr'],
+    'bseti': BINARY['bset'],
+    'binvi': BINARY['binv'],
+    'bexti': BINARY['bext'],
+}
+
+
+class Case:
+    def __init__(self, inst, a, b, expect):
+        self.inst = inst
+        self.a = a
+        self.b = b
+        self.expect = expect
+
+
+def values(rng):
+    """edge values, whole bytes, and random ones"""
+    vals = [0, 1, 2, 0x7f, 0x80, 0xff, 0x100, 0x7fff, 0x8000, 0xffff, 0x10000,
+            0x7fffffff, 0x80000000, 0x80000001, 0xfffffffe, MASK,
+            0x01000000, 0x00ff00ff, 0xff00ff00, 0x12345678, 0x00010080]
+    vals += [rng.getrandbits(32) >> rng.randint(0, 31) for _ in range(16)]
+    return vals
+
+
+def cases():
+    rng = random.Random(23)
+    vals = values(rng)
+    # shift amounts past 31, which use their low bits only
+    shifts = [0, 1, 7, 31, 32, 33, 63, 64, 0x80000000, 0xffffffe1, MASK]
+    out = []
+    for name, fn in BINARY.items():
+        if name.startswith('b') or name.startswith('ro'):
+            pairs = [(a, b) for a in vals[::3] for b in shifts]
+            pairs += [(rng.choice(vals), rng.getrandbits(32)) for _ in range(16)]
+        else:
+            pairs = [(a, b) for a in vals[::2] for b in vals[::2]]
+        for a, b in pairs:
+            out.append(Case(f'{name} a2, a0, a1', a, b, fn(a, b)))
+        # the result written over either source, and both sources the same
+        for a, b in pairs[::5]:
+            out.append(Case(f'{name} a0, a0, a1\n  mv a2, a0', a, b, fn(a, b)))
+            out.append(Case(f'{name} a1, a0, a1\n  mv a2, a1', a, b, fn(a, b)))
+            out.append(Case(f'{name} a2, a1, a1', a, b, fn(b, b)))
+        # the zero register as either source
+        out.append(Case(f'{name} a2, zero, a1', 0, 0x12345687, fn(0, 0x12345687)))
+        out.append(Case(f'{name} a2, a0, zero', 0x87654321, 0, fn(0x87654321, 0)))
+    for name, fn in UNARY.items():
+        for a in vals + [1 << i for i in range(32)] + [MASK >> i for i in range(32)]:
+            out.append(Case(f'{name} a2, a0', a, 0, fn(a)))
+        for a in vals[::4]:
+            out.append(Case(f'{name} a0, a0\n  mv a2, a0', a, 0, fn(a)))
+        out.append(Case(f'{name} a2, zero', 0x12345678, 0, fn(0)))
+    for name, fn in IMMEDIATE.items():
+        for imm in (0, 1, 8, 15, 16, 31):
+            for a in vals[::3]:
+                out.append(Case(f'{name} a2, a0, {imm}', a, 0, fn(a, imm)))
+    return out
+
+
+RUNNER = '''\
+  .equ CASE_SIZE,        16
+  .equ MAX_REPORT,       16
+  .equ NUM_END,          0x20200
+
+  .equ SYS_write,        64
+  .equ SYS_exit,         93
+
+  .text
+  .globl _start
+_start:
+  la s0, cases
+  la s1, cases_end
+  la s2, ops
+  li s3, 0                  # case number
+  li s4, 0                  # failures
+next:
+  bgeu s0, s1, done
+  lw a0, 4(s0)
+  lw a1, 8(s0)
+  # results which are not written show up as this
+  li a2, 0x5a5a5a5a
+  lw t0, 0(s0)
+  add t0, s2, t0
+  jalr ra, t0
+  lw t0, 12(s0)
+  beq a2, t0, 1f
+  jal ra, report
+1:
+  addi s0, s0, CASE_SIZE
+  addi s3, s3, 1
+  j next
+done:
+  bnez s4, fail
+  la a0, msg_ok
+  jal ra, print_str
+  li a0, 0
+  li a7, SYS_exit
+  ecall
+fail:
+  la a0, msg_fail
+  jal ra, print_str
+  mv a0, s4
+  jal ra, print_uint
+  la a0, msg_of
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_nl
+  jal ra, print_str
+  li a0, 1
+  li a7, SYS_exit
+  ecall
+
+# count a failure and write the first few as "case <n>: <result>"
+report:
+  addi s4, s4, 1
+  li t0, MAX_REPORT
+  bgtu s4, t0, 1f
+  mv s5, ra
+  mv s6, a2
+  la a0, msg_case
+  jal ra, print_str
+  mv a0, s3
+  jal ra, print_uint
+  la a0, msg_colon
+  jal ra, print_str
+  mv a0, s6
+  jal ra, print_hex
+  la a0, msg_nl
+  jal ra, print_str
+  mv ra, s5
+1:
+  ret
+
+# write the string at a0 to stdout
+print_str:
+  mv a1, a0
+  mv a2, a0
+1:
+  lbu t0, 0(a2)
+  beqz t0, 2f
+  addi a2, a2, 1
+  j 1b
+2:
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout in decimal
+print_uint:
+  li a1, NUM_END
+  li t1, 10
+1:
+  remu t0, a0, t1
+  divu a0, a0, t1
+  addi t0, t0, '0'
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  bnez a0, 1b
+  li a2, NUM_END
+  sub a2, a2, a1
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+
+# write a0 to stdout as eight hex digits
+print_hex:
+  li a1, NUM_END
+  li t1, 8
+1:
+  andi t0, a0, 15
+  srli a0, a0, 4
+  addi t0, t0, '0'
+  li t2, '9'
+  bleu t0, t2, 2f
+  addi t0, t0, 'a' - '9' - 1
+2:
+  addi a1, a1, -1
+  sb t0, 0(a1)
+  addi t1, t1, -1
+  bnez t1, 1b
+  li a2, 8
+  li a0, 1
+  li a7, SYS_write
+  ecall
+  ret
+'''
+
+
+def emit(cases):
+    out = []
+    w = out.append
+    w('# zb.s')
+    w('#')
+    w('#   Generated by zb_gen.py, do not edit.')
+    w('#')
+    w('#   Zba, Zbb and Zbs instructions on edge values, with shift amounts')
+    w('#   past 31, the result written over a source and the zero register as a')
+    w('#   source.  Run with --no-host-ext to check the paths taken on hosts')
+    w('#   without lzcnt, tzcnt or popcnt.')
+    w('#')
+    w('#   Build:')
+    w('#     python3 zb_gen.py > zb.s')
+    w('#     llvm-mc -triple=riscv32 -mattr=+m,+zba,+zbb,+zbs,-relax -filetype=obj \\')
+    w('#       zb.s -o zb.o')
+    w('#     ld.lld -Ttext=0x10000 zb.o -o zb.elf')
+    w('')
+    w(RUNNER)
+    # one stub per distinct instruction sequence, each sixteen bytes
+    stubs = {}
+    for case in cases:
+        stubs.setdefault(case.inst, len(stubs) * 16)
+    w('  .option push')
+    w('  .option norvc')
+    w('  .p2align 4')
+    w('ops:')
+    for inst in stubs:
+        w('  .p2align 4')
+        w(f'  {inst}')
+        w('  ret')
+    w('  .option pop')
+    w('')
+    w('  .data')
+    w('  .p2align 2')
+    w('# stub offset, two operands, expected result')
+    w('cases:')
+    for case in cases:
+        w(f'  .word 0x{stubs[case.inst]:x}, 0x{case.a:x}, 0x{case.b:x}, 0x{case.expect:x}')
+    w('cases_end:')
+    w('')
+    w('msg_ok:    .asciz "zb: ok\\n"')
+    w('msg_fail:  .asciz "zb: FAIL "')
+    w('msg_of:    .asciz " of "')
+    w('msg_case:  .asciz "case "')
+    w('msg_colon: .asciz ": "')
+    w('msg_nl:    .asciz "\\n"')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    if len(sys.argv) != 1:
+        sys.exit('usage: zb_gen.py')
+    sys.stdout.write(emit(cases()))
+
+
+if __name__ == '__main__':
+    main()
@@ -43,7 +43,10 @@ const char *cg_r8_str(cg_r32_t reg) {
 }
 
 static void cg_emit_data(struct cg_state_t *cg, const void *data, size_t size) {
-  assert((cg->head + size) < cg->end);
+  if (cg->overflow || (cg->head + size) >= cg->end) {
+    cg->overflow = true;
+    return;
+  }
   memcpy(cg->head, data, size);
   cg->head += size;
 }
@@ -64,6 +67,13 @@ static void cg_rex(struct cg_state_t *cg, int w, int r, int x, int b) {
   cg_emit_data(cg, &rex, 1);
 }
 
+// emit a rex prefix only if extended registers are used
+static void cg_rex_ext(struct cg_state_t *cg, int r, int b) {
+  if (r >= cg_r8 || b >= cg_r8) {
+    cg_rex(cg, 0, r >= cg_r8, 0, b >= cg_r8);
+  }
+}
+
 uint32_t cg_size(struct cg_state_t *cg) {
   return (uint32_t)(cg->head - cg->start);
 }
@@ -75,14 +85,20 @@ void cg_mov_r64_r64(struct cg_state_t *cg, cg_r64_t r1, cg_r64_t r2) {
 }
 
 void cg_mov_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
-  assert(r1 == (r1 & 0x7));
-  assert(r2 == (r2 & 0x7));
+  cg_rex_ext(cg, r2, r1);
   cg_emit_data(cg, "\x89", 1);
   cg_modrm(cg, 3, r2, r1);
 }
 
 void cg_mov_r32_i32(struct cg_state_t *cg, cg_r32_t r1, uint32_t imm) {
-  assert(r1 == (r1 & 0x7));
+  cg_rex_ext(cg, 0, r1);
+  const uint8_t inst = 0xb8 | (r1 & 0x7);
+  cg_emit_data(cg, &inst, 1);
+  cg_emit_data(cg, &imm, sizeof(imm));
+}
+
+void cg_mov_r64_i64(struct cg_state_t *cg, cg_r64_t r1, uint64_t imm) {
+  cg_rex(cg, 1, 0, 0, r1 >= cg_r8);
   const uint8_t inst = 0xb8 | (r1 & 0x7);
   cg_emit_data(cg, &inst, 1);
   cg_emit_data(cg, &imm, sizeof(imm));
@@ -144,7 +160,8 @@ void cg_ret(struct cg_state_t *cg) {
 }
 
 void cg_mov_r32_r64disp(struct cg_state_t *cg, cg_r32_t r1, cg_r64_t base, int32_t disp) {
-  assert(r1   == (r1   & 0x7));
+  assert(base == (base & 0x7));
+  cg_rex_ext(cg, r1, 0);
   if (disp >= -128 && disp <= 127) {
     cg_emit_data(cg, "\x8b", 1);
     cg_modrm(cg, 1, r1, base);
@@ -159,7 +176,8 @@ void cg_mov_r32_r64disp(struct cg_state_t *cg, cg_r32_t r1, cg_r64_t base, int32
 }
 
 void cg_mov_r64disp_r32(struct cg_state_t *cg, cg_r64_t base, int32_t disp, cg_r32_t r1) {
-  assert(r1   == (r1   & 0x7));
+  assert(base == (base & 0x7));
+  cg_rex_ext(cg, r1, 0);
   if (disp >= -128 && disp <= 127) {
     cg_emit_data(cg, "\x89", 1);
     cg_modrm(cg, 1, r1, base);
@@ -250,6 +268,12 @@ void cg_add_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
   cg_modrm(cg, 3, r2, r1);
 }
 
+void cg_add_r64_r64(struct cg_state_t *cg, cg_r64_t r1, cg_r64_t r2) {
+  cg_rex(cg, 1, r2 >= cg_r8, 0, r1 >= cg_r8);
+  cg_emit_data(cg, "\x01", 1);
+  cg_modrm(cg, 3, r2, r1);
+}
+
 void cg_and_r8_i8(struct cg_state_t *cg, cg_r8_t r1, uint8_t imm) {
   if (imm == 0xff) {
     return;
@@ -278,7 +302,13 @@ void cg_and_r32_i32(struct cg_state_t *cg, cg_r32_t r1, uint32_t imm) {
   cg_emit_data(cg, &imm, sizeof(imm));
 }
 
+void cg_and_r8_r8(struct cg_state_t *cg, cg_r8_t r1, cg_r8_t r2) {
+  cg_emit_data(cg, "\x20", 1);
+  cg_modrm(cg, 3, r2, r1);
+}
+
 void cg_and_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_rex_ext(cg, r2, r1);
   cg_emit_data(cg, "\x21", 1);
   cg_modrm(cg, 3, r2, r1);
 }
@@ -319,6 +349,12 @@ void cg_sub_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
   cg_modrm(cg, 3, r2, r1);
 }
 
+void cg_sub_r64_r64(struct cg_state_t *cg, cg_r64_t r1, cg_r64_t r2) {
+  cg_rex(cg, 1, r2 >= cg_r8, 0, r1 >= cg_r8);
+  cg_emit_data(cg, "\x29", 1);
+  cg_modrm(cg, 3, r2, r1);
+}
+
 void cg_shl_r32_i8(struct cg_state_t *cg, cg_r32_t r1, uint8_t imm) {
   if (imm == 0) {
     return;
@@ -397,10 +433,21 @@ void cg_xor_r32_i32(struct cg_state_t *cg, cg_r32_t r1, uint32_t imm) {
 }
 
 void cg_xor_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_rex_ext(cg, r2, r1);
   cg_emit_data(cg, "\x31", 1);
   cg_modrm(cg, 3, r2, r1);
 }
 
+void cg_shr_r64_i8(struct cg_state_t *cg, cg_r64_t r1, uint8_t imm) {
+  if (imm == 0) {
+    return;
+  }
+  cg_rex(cg, 1, 0, 0, r1 >= cg_r8);
+  cg_emit_data(cg, "\xc1", 1);
+  cg_modrm(cg, 3, 5, r1);
+  cg_emit_data(cg, &imm, sizeof(imm));
+}
+
 void cg_xor_r64_r64(struct cg_state_t *cg, cg_r64_t r1, cg_r64_t r2) {
   cg_rex(cg, 1, r2 >= cg_r8, 0, r1 >= cg_r8);
   cg_emit_data(cg, "\x31", 1);
@@ -422,6 +469,7 @@ void cg_or_r32_i32(struct cg_state_t *cg, cg_r32_t r1, uint32_t imm) {
 }
 
 void cg_or_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_rex_ext(cg, r2, r1);
   cg_emit_data(cg, "\x09", 1);
   cg_modrm(cg, 3, r2, r1);
 }
@@ -433,6 +481,7 @@ void cg_cmp_r64_r64(struct cg_state_t *cg, cg_r64_t r1, cg_r64_t r2) {
 }
 
 void cg_cmp_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_rex_ext(cg, r2, r1);
   cg_emit_data(cg, "\x39", 1);
   cg_modrm(cg, 3, r2, r1);
 }
@@ -465,16 +514,161 @@ void cg_call_r64disp(struct cg_state_t *cg, cg_r64_t base, int32_t disp) {
   }
 }
 
+void cg_jmp_r64(struct cg_state_t *cg, cg_r64_t r1) {
+  cg_rex_ext(cg, 0, r1);
+  cg_emit_data(cg, "\xff", 1);
+  cg_modrm(cg, 3, 4, r1);
+}
+
+void cg_jmp_r64disp(struct cg_state_t *cg, cg_r64_t base, int32_t disp) {
+  assert(base == (base & 0x7));
+  cg_emit_data(cg, "\xff", 1);
+  if (disp >= -128 && disp <= 127) {
+    cg_modrm(cg, 1, 4, base);
+    const int8_t disp8 = disp;
+    cg_emit_data(cg, &disp8, 1);
+  }
+  else {
+    cg_modrm(cg, 2, 4, base);
+    cg_emit_data(cg, &disp, sizeof(disp));
+  }
+}
+
 void cg_mul_r32(struct cg_state_t *cg, cg_r32_t r1) {
+  cg_rex_ext(cg, 0, r1);
   cg_emit_data(cg, "\xF7", 1);
   cg_modrm(cg, 3, 4, r1);
 }
 
 void cg_imul_r32(struct cg_state_t *cg, cg_r32_t r1) {
+  cg_rex_ext(cg, 0, r1);
   cg_emit_data(cg, "\xF7", 1);
   cg_modrm(cg, 3, 5, r1);
 }
 
+void cg_mul_r64(struct cg_state_t *cg, cg_r64_t r1) {
+  cg_rex(cg, 1, 0, 0, r1 >= cg_r8);
+  cg_emit_data(cg, "\xF7", 1);
+  cg_modrm(cg, 3, 4, r1);
+}
+
+void cg_imul_r64_r64(struct cg_state_t *cg, cg_r64_t r1, cg_r64_t r2) {
+  cg_rex(cg, 1, r1 >= cg_r8, 0, r2 >= cg_r8);
+  cg_emit_data(cg, "\x0F\xAF", 2);
+  cg_modrm(cg, 3, r1, r2);
+}
+
+void cg_imul_r32_r32_i32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2, int32_t imm) {
+  cg_rex_ext(cg, r1, r2);
+  cg_emit_data(cg, "\x69", 1);
+  cg_modrm(cg, 3, r1, r2);
+  cg_emit_data(cg, &imm, sizeof(imm));
+}
+
+void cg_div_r32(struct cg_state_t *cg, cg_r32_t r1) {
+  cg_rex_ext(cg, 0, r1);
+  cg_emit_data(cg, "\xF7", 1);
+  cg_modrm(cg, 3, 6, r1);
+}
+
+void cg_idiv_r32(struct cg_state_t *cg, cg_r32_t r1) {
+  cg_rex_ext(cg, 0, r1);
+  cg_emit_data(cg, "\xF7", 1);
+  cg_modrm(cg, 3, 7, r1);
+}
+
+void cg_cdq(struct cg_state_t *cg) {
+  cg_emit_data(cg, "\x99", 1);
+}
+
+void cg_neg_r32(struct cg_state_t *cg, cg_r32_t r1) {
+  cg_rex_ext(cg, 0, r1);
+  cg_emit_data(cg, "\xF7", 1);
+  cg_modrm(cg, 3, 3, r1);
+}
+
+void cg_not_r32(struct cg_state_t *cg, cg_r32_t r1) {
+  cg_rex_ext(cg, 0, r1);
+  cg_emit_data(cg, "\xF7", 1);
+  cg_modrm(cg, 3, 2, r1);
+}
+
+void cg_rol_r32_cl(struct cg_state_t *cg, cg_r32_t r1) {
+  cg_rex_ext(cg, 0, r1);
+  cg_emit_data(cg, "\xd3", 1);
+  cg_modrm(cg, 3, 0, r1);
+}
+
+void cg_ror_r32_cl(struct cg_state_t *cg, cg_r32_t r1) {
+  cg_rex_ext(cg, 0, r1);
+  cg_emit_data(cg, "\xd3", 1);
+  cg_modrm(cg, 3, 1, r1);
+}
+
+void cg_ror_r32_i8(struct cg_state_t *cg, cg_r32_t r1, uint8_t imm) {
+  if (imm == 0) {
+    return;
+  }
+  cg_rex_ext(cg, 0, r1);
+  cg_emit_data(cg, "\xc1", 1);
+  cg_modrm(cg, 3, 1, r1);
+  cg_emit_data(cg, &imm, sizeof(imm));
+}
+
+void cg_bswap_r32(struct cg_state_t *cg, cg_r32_t r1) {
+  cg_rex_ext(cg, 0, r1);
+  const uint8_t op[] = { 0x0f, (uint8_t)(0xc8 | (r1 & 0x7)) };
+  cg_emit_data(cg, op, sizeof(op));
+}
+
+void cg_btr_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_rex_ext(cg, r2, r1);
+  cg_emit_data(cg, "\x0f\xb3", 2);
+  cg_modrm(cg, 3, r2, r1);
+}
+
+void cg_bts_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_rex_ext(cg, r2, r1);
+  cg_emit_data(cg, "\x0f\xab", 2);
+  cg_modrm(cg, 3, r2, r1);
+}
+
+void cg_btc_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_rex_ext(cg, r2, r1);
+  cg_emit_data(cg, "\x0f\xbb", 2);
+  cg_modrm(cg, 3, r2, r1);
+}
+
+void cg_bsr_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_rex_ext(cg, r1, r2);
+  cg_emit_data(cg, "\x0f\xbd", 2);
+  cg_modrm(cg, 3, r1, r2);
+}
+
+void cg_bsf_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_rex_ext(cg, r1, r2);
+  cg_emit_data(cg, "\x0f\xbc", 2);
+  cg_modrm(cg, 3, r1, r2);
+}
+
+// note: the f3 prefix must come before any rex prefix
+void cg_lzcnt_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_emit_data(cg, "\xf3", 1);
+  cg_bsr_r32_r32(cg, r1, r2);
+}
+
+void cg_tzcnt_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_emit_data(cg, "\xf3", 1);
+  cg_bsf_r32_r32(cg, r1, r2);
+}
+
+void cg_popcnt_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_emit_data(cg, "\xf3", 1);
+  cg_rex_ext(cg, r1, r2);
+  cg_emit_data(cg, "\x0f\xb8", 2);
+  cg_modrm(cg, 3, r1, r2);
+}
+
 void cg_push_r64(struct cg_state_t *cg, cg_r64_t r1) {
   assert(r1 == (r1 & 0x7));
   const uint8_t inst = 0x50 | (r1 & 0x7);
@@ -491,6 +685,45 @@ void cg_nop(struct cg_state_t *cg) {
   cg_emit_data(cg, "\x90", 1);
 }
 
+void cg_mfence(struct cg_state_t *cg) {
+  cg_emit_data(cg, "\x0f\xae\xf0", 3);
+}
+
+// emit the modrm byte and displacement for [base + disp]
+static void cg_modrm_disp(struct cg_state_t *cg, uint32_t reg, cg_r64_t base, int32_t disp) {
+  assert(base == (base & 0x7));
+  if (disp >= -128 && disp <= 127) {
+    cg_modrm(cg, 1, reg, base);
+    const int8_t disp8 = disp;
+    cg_emit_data(cg, &disp8, 1);
+  }
+  else {
+    cg_modrm(cg, 2, reg, base);
+    cg_emit_data(cg, &disp, sizeof(disp));
+  }
+}
+
+void cg_xchg_r64disp_r32(struct cg_state_t *cg, cg_r64_t base, int32_t disp, cg_r32_t r1) {
+  // note: xchg with memory is always locked
+  cg_rex_ext(cg, r1, 0);
+  cg_emit_data(cg, "\x87", 1);
+  cg_modrm_disp(cg, r1, base, disp);
+}
+
+void cg_lock_xadd_r64disp_r32(struct cg_state_t *cg, cg_r64_t base, int32_t disp, cg_r32_t r1) {
+  cg_emit_data(cg, "\xf0", 1);
+  cg_rex_ext(cg, r1, 0);
+  cg_emit_data(cg, "\x0f\xc1", 2);
+  cg_modrm_disp(cg, r1, base, disp);
+}
+
+void cg_lock_cmpxchg_r64disp_r32(struct cg_state_t *cg, cg_r64_t base, int32_t disp, cg_r32_t r1) {
+  cg_emit_data(cg, "\xf0", 1);
+  cg_rex_ext(cg, r1, 0);
+  cg_emit_data(cg, "\x0f\xb1", 2);
+  cg_modrm_disp(cg, r1, base, disp);
+}
+
 void cg_setcc_r8(struct cg_state_t *cg, cg_cc_t cc, cg_r8_t r1) {
   cg_emit_data(cg, "\x0f", 1);
   const uint8_t op = 0x90 | (cc & 0xf);
@@ -499,6 +732,7 @@ void cg_setcc_r8(struct cg_state_t *cg, cg_cc_t cc, cg_r8_t r1) {
 }
 
 void cg_cmov_r32_r32(struct cg_state_t *cg, cg_cc_t cc, cg_r32_t r1, cg_r32_t r2) {
+  cg_rex_ext(cg, r1, r2);
   cg_emit_data(cg, "\x0f", 1);
   const uint8_t op = 0x40 | (cc & 0xf);
   cg_emit_data(cg, &op, 1);
@@ -507,13 +741,19 @@ void cg_cmov_r32_r32(struct cg_state_t *cg, cg_cc_t cc, cg_r32_t r1, cg_r32_t r2
 
 void cg_reset(struct cg_state_t *cg) {
   cg->head = cg->start;
+  cg->overflow = false;
+}
+
+bool cg_overflow(struct cg_state_t *cg) {
+  return cg->overflow;
 }
 
+// note: the buffer is not cleared as it may be very large
 void cg_init(struct cg_state_t *cg, uint8_t *start, uint8_t *end) {
   cg->start = start;
   cg->head = start;
   cg->end = end;
-  memset(start, 0xcc, end - start);
+  cg->overflow = false;
 }
 
 void cg_movss_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset) {
@@ -570,6 +810,216 @@ void cg_cvtsi2ss_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base,
   cg_emit_data(cg, &offset, sizeof(offset));
 }
 
+void cg_cvttss2si_r64_r64disp(struct cg_state_t *cg, cg_r64_t dst, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\xf3", 1);
+  cg_rex(cg, 1, 0, 0, 0);
+  cg_emit_data(cg, "\x0f\x2C", 2);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_cvttss2si_r64_xmm(struct cg_state_t *cg, cg_r64_t dst, cg_xmm_t src) {
+  cg_emit_data(cg, "\xf3", 1);
+  cg_rex(cg, 1, 0, 0, 0);
+  cg_emit_data(cg, "\x0f\x2C", 2);
+  cg_modrm(cg, 3, dst, src);
+}
+
+void cg_cvtsi2ss_xmm_r32(struct cg_state_t *cg, cg_xmm_t dst, cg_r32_t src) {
+  cg_emit_data(cg, "\xf3\x0f\x2A", 3);
+  cg_modrm(cg, 3, dst, src);
+}
+
+void cg_cvtsi2ss_xmm_r64(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t src) {
+  cg_emit_data(cg, "\xf3", 1);
+  cg_rex(cg, 1, 0, 0, 0);
+  cg_emit_data(cg, "\x0f\x2A", 2);
+  cg_modrm(cg, 3, dst, src);
+}
+
+void cg_minss_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\xf3\x0f\x5D", 3);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_maxss_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\xf3\x0f\x5F", 3);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_ucomiss_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\x0f\x2E", 2);
+  cg_modrm(cg, 2, src, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_comiss_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\x0f\x2F", 2);
+  cg_modrm(cg, 2, src, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_ucomiss_xmm_xmm(struct cg_state_t *cg, cg_xmm_t r1, cg_xmm_t r2) {
+  cg_emit_data(cg, "\x0f\x2E", 2);
+  cg_modrm(cg, 3, r1, r2);
+}
+
+void cg_movsd_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\xf2\x0f\x10", 3);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_movsd_r64disp_xmm(struct cg_state_t *cg, cg_r64_t base, int32_t offset, cg_xmm_t dst) {
+  cg_emit_data(cg, "\xf2\x0f\x11", 3);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_addsd_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\xf2\x0f\x58", 3);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_subsd_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\xf2\x0f\x5C", 3);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_mulsd_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\xf2\x0f\x59", 3);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_divsd_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\xf2\x0f\x5E", 3);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_sqrtsd_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\xf2\x0f\x51", 3);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_cvtss2sd_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\xf3\x0f\x5A", 3);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_cvtsd2ss_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\xf2\x0f\x5A", 3);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_ucomisd_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\x66\x0f\x2E", 3);
+  cg_modrm(cg, 2, src, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_comisd_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\x66\x0f\x2F", 3);
+  cg_modrm(cg, 2, src, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_ucomisd_xmm_xmm(struct cg_state_t *cg, cg_xmm_t r1, cg_xmm_t r2) {
+  cg_emit_data(cg, "\x66\x0f\x2E", 3);
+  cg_modrm(cg, 3, r1, r2);
+}
+
+void cg_cvtsi2sd_xmm_r32(struct cg_state_t *cg, cg_xmm_t dst, cg_r32_t src) {
+  cg_emit_data(cg, "\xf2\x0f\x2A", 3);
+  cg_modrm(cg, 3, dst, src);
+}
+
+void cg_cvtsi2sd_xmm_r64(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t src) {
+  cg_emit_data(cg, "\xf2", 1);
+  cg_rex(cg, 1, 0, 0, 0);
+  cg_emit_data(cg, "\x0f\x2A", 2);
+  cg_modrm(cg, 3, dst, src);
+}
+
+void cg_ldmxcsr_r64disp(struct cg_state_t *cg, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\x0f\xAE", 2);
+  cg_modrm(cg, 2, 2, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_stmxcsr_r64disp(struct cg_state_t *cg, cg_r64_t base, int32_t offset) {
+  cg_emit_data(cg, "\x0f\xAE", 2);
+  cg_modrm(cg, 2, 3, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_roundss_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t base, int32_t offset, uint8_t mode) {
+  cg_emit_data(cg, "\x66\x0f\x3A\x0A", 4);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+  cg_emit_data(cg, &mode, sizeof(mode));
+}
+
+// three byte vex prefix for the 0F38 map with a 66 prefix, as used by fma3,
+// where w selects the double precision forms
+static void cg_vex_66_0f38(struct cg_state_t *cg, bool w, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base) {
+  const uint8_t vex[3] = {
+    0xc4,
+    // inverted r, x and b then the 0F38 map
+    (uint8_t)(((dst < 8) << 7) | (1 << 6) | ((base < 8) << 5) | 0x02),
+    // w, inverted vvvv, l0 and the 66 prefix
+    (uint8_t)((w << 7) | ((~src & 0xf) << 3) | 0x01),
+  };
+  cg_emit_data(cg, vex, sizeof(vex));
+}
+
+static void cg_fma_generic(struct cg_state_t *cg, bool w, uint8_t op, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_vex_66_0f38(cg, w, dst, src, base);
+  cg_emit_data(cg, &op, 1);
+  cg_modrm(cg, 2, dst, base);
+  cg_emit_data(cg, &offset, sizeof(offset));
+}
+
+void cg_vfmadd213ss_xmm_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_fma_generic(cg, false, 0xa9, dst, src, base, offset);
+}
+
+void cg_vfmsub213ss_xmm_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_fma_generic(cg, false, 0xab, dst, src, base, offset);
+}
+
+void cg_vfnmadd213ss_xmm_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_fma_generic(cg, false, 0xad, dst, src, base, offset);
+}
+
+void cg_vfnmsub213ss_xmm_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_fma_generic(cg, false, 0xaf, dst, src, base, offset);
+}
+
+void cg_vfmadd213sd_xmm_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_fma_generic(cg, true, 0xa9, dst, src, base, offset);
+}
+
+void cg_vfmsub213sd_xmm_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_fma_generic(cg, true, 0xab, dst, src, base, offset);
+}
+
+void cg_vfnmadd213sd_xmm_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_fma_generic(cg, true, 0xad, dst, src, base, offset);
+}
+
+void cg_vfnmsub213sd_xmm_xmm_r64disp(struct cg_state_t *cg, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset) {
+  cg_fma_generic(cg, true, 0xaf, dst, src, base, offset);
+}
+
 void cg_mov_r32_xmm(struct cg_state_t *cg, cg_r32_t dst, cg_xmm_t src) {
   cg_emit_data(cg, "\x66\x0F\x7E", 3);
   cg_modrm(cg, 3, src, dst);
@@ -580,6 +1030,20 @@ void cg_mov_xmm_r32(struct cg_state_t *cg, cg_xmm_t dst, cg_r32_t src) {
   cg_modrm(cg, 3, dst, src);
 }
 
+void cg_mov_r64_xmm(struct cg_state_t *cg, cg_r64_t dst, cg_xmm_t src) {
+  cg_emit_data(cg, "\x66", 1);
+  cg_rex(cg, 1, 0, 0, 0);
+  cg_emit_data(cg, "\x0F\x7E", 2);
+  cg_modrm(cg, 3, src, dst);
+}
+
+void cg_mov_xmm_r64(struct cg_state_t *cg, cg_xmm_t dst, cg_r64_t src) {
+  cg_emit_data(cg, "\x66", 1);
+  cg_rex(cg, 1, 0, 0, 0);
+  cg_emit_data(cg, "\x0F\x6E", 2);
+  cg_modrm(cg, 3, dst, src);
+}
+
 static void cg_sub_r64disp_i32_generic(struct cg_state_t *cg, uint8_t op, cg_r64_t base, int32_t offset, int32_t imm) {
   assert(base == (base & 7));
   if (imm >= -128 && imm <= 127) {
@@ -813,3 +1277,197 @@ void cg_and_r64disp_r32(struct cg_state_t *cg, cg_r64_t base, int32_t offset, cg
   }
 }
 
+
+void cg_test_r32_r32(struct cg_state_t *cg, cg_r32_t r1, cg_r32_t r2) {
+  cg_rex_ext(cg, r2, r1);
+  cg_emit_data(cg, "\x85", 1);
+  cg_modrm(cg, 3, r2, r1);
+}
+
+void cg_test_r64_r64(struct cg_state_t *cg, cg_r64_t r1, cg_r64_t r2) {
+  cg_rex(cg, 1, r2 >= cg_r8, 0, r1 >= cg_r8);
+  cg_emit_data(cg, "\x85", 1);
+  cg_modrm(cg, 3, r2, r1);
+}
+
+void cg_test_r8_i8(struct cg_state_t *cg, cg_r8_t r1, uint8_t imm) {
+  if (r1 == cg_al) {
+    cg_emit_data(cg, "\xa8", 1);
+  }
+  else {
+    cg_emit_data(cg, "\xf6", 1);
+    cg_modrm(cg, 3, 0, r1);
+  }
+  cg_emit_data(cg, &imm, 1);
+}
+
+// emit a rex prefix for a sib operand only if one is required
+static void cg_rex_sib(struct cg_state_t *cg, int w, cg_r64_t reg, cg_r64_t base, cg_r64_t index) {
+  if (w || reg >= cg_r8 || base >= cg_r8 || index >= cg_r8) {
+    cg_rex(cg, w, reg >= cg_r8, index >= cg_r8, base >= cg_r8);
+  }
+}
+
+// emit the modrm and sib bytes for [base + index * scale]
+static void cg_modrm_sib(struct cg_state_t *cg, uint32_t reg, cg_r64_t base, cg_r64_t index, uint32_t scale) {
+  assert((index & 7) != cg_rsp);
+  const uint8_t ss = (scale == 8) ? 3 : (scale == 4) ? 2 : (scale == 2) ? 1 : 0;
+  // note: rbp and r13 as a base can only be encoded with a displacement
+  const uint8_t mod = ((base & 7) == cg_rbp) ? 1 : 0;
+  const uint8_t data[] = {
+    (uint8_t)((mod << 6) | ((reg & 7) << 3) | 4),
+    (uint8_t)((ss << 6) | ((index & 7) << 3) | (base & 7)),
+    0,
+  };
+  cg_emit_data(cg, data, mod ? 3 : 2);
+}
+
+void cg_mov_r64_r64sib(struct cg_state_t *cg, cg_r64_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale) {
+  cg_rex_sib(cg, 1, dst, base, index);
+  cg_emit_data(cg, "\x8b", 1);
+  cg_modrm_sib(cg, dst, base, index, scale);
+}
+
+void cg_mov_r32_r64sib(struct cg_state_t *cg, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale) {
+  cg_rex_sib(cg, 0, dst, base, index);
+  cg_emit_data(cg, "\x8b", 1);
+  cg_modrm_sib(cg, dst, base, index, scale);
+}
+
+void cg_movzx_r32_r64sib8(struct cg_state_t *cg, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale) {
+  cg_rex_sib(cg, 0, dst, base, index);
+  cg_emit_data(cg, "\x0f\xb6", 2);
+  cg_modrm_sib(cg, dst, base, index, scale);
+}
+
+void cg_movzx_r32_r64sib16(struct cg_state_t *cg, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale) {
+  cg_rex_sib(cg, 0, dst, base, index);
+  cg_emit_data(cg, "\x0f\xb7", 2);
+  cg_modrm_sib(cg, dst, base, index, scale);
+}
+
+void cg_movsx_r32_r64sib8(struct cg_state_t *cg, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale) {
+  cg_rex_sib(cg, 0, dst, base, index);
+  cg_emit_data(cg, "\x0f\xbe", 2);
+  cg_modrm_sib(cg, dst, base, index, scale);
+}
+
+void cg_movsx_r32_r64sib16(struct cg_state_t *cg, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale) {
+  cg_rex_sib(cg, 0, dst, base, index);
+  cg_emit_data(cg, "\x0f\xbf", 2);
+  cg_modrm_sib(cg, dst, base, index, scale);
+}
+
+void cg_mov_r64sib_r32(struct cg_state_t *cg, cg_r64_t base, cg_r64_t index, uint32_t scale, cg_r32_t src) {
+  cg_rex_sib(cg, 0, src, base, index);
+  cg_emit_data(cg, "\x89", 1);
+  cg_modrm_sib(cg, src, base, index, scale);
+}
+
+void cg_mov_r64sib_r64(struct cg_state_t *cg, cg_r64_t base, cg_r64_t index, uint32_t scale, cg_r64_t src) {
+  cg_rex_sib(cg, 1, src, base, index);
+  cg_emit_data(cg, "\x89", 1);
+  cg_modrm_sib(cg, src, base, index, scale);
+}
+
+void cg_mov_r64sib_r16(struct cg_state_t *cg, cg_r64_t base, cg_r64_t index, uint32_t scale, cg_r16_t src) {
+  cg_emit_data(cg, "\x66", 1);
+  cg_rex_sib(cg, 0, src, base, index);
+  cg_emit_data(cg, "\x89", 1);
+  cg_modrm_sib(cg, src, base, index, scale);
+}
+
+void cg_mov_r64sib_r8(struct cg_state_t *cg, cg_r64_t base, cg_r64_t index, uint32_t scale, cg_r8_t src) {
+  // note: without a rex prefix src encodes al, cl, dl, bl, ah, ch, dh, bh
+  cg_rex_sib(cg, 0, src, base, index);
+  cg_emit_data(cg, "\x88", 1);
+  cg_modrm_sib(cg, src, base, index, scale);
+}
+
+void cg_lea_r32_r64sib(struct cg_state_t *cg, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale) {
+  cg_rex_sib(cg, 0, dst, base, index);
+  cg_emit_data(cg, "\x8d", 1);
+  cg_modrm_sib(cg, dst, base, index, scale);
+}
+
+// returned in place of a displacement which overflowed the buffer
+static uint8_t cg_disp_sink[4];
+
+uint8_t *cg_jmp_rel32(struct cg_state_t *cg, const uint8_t *target) {
+  cg_emit_data(cg, "\xe9", 1);
+  uint8_t *disp = cg->head;
+  const int32_t zero = 0;
+  cg_emit_data(cg, &zero, sizeof(zero));
+  // dont let patching a displacement which didnt fit write past the end
+  if (cg->overflow) {
+    disp = cg_disp_sink;
+  }
+  if (target) {
+    cg_patch_rel32(disp, target);
+  }
+  return disp;
+}
+
+uint8_t *cg_jcc_rel32(struct cg_state_t *cg, cg_cc_t cc, const uint8_t *target) {
+  const uint8_t op[] = { 0x0f, (uint8_t)(0x80 | (cc & 0xf)) };
+  cg_emit_data(cg, op, sizeof(op));
+  uint8_t *disp = cg->head;
+  const int32_t zero = 0;
+  cg_emit_data(cg, &zero, sizeof(zero));
+  // dont let patching a displacement which didnt fit write past the end
+  if (cg->overflow) {
+    disp = cg_disp_sink;
+  }
+  if (target) {
+    cg_patch_rel32(disp, target);
+  }
+  return disp;
+}
+
+void cg_patch_rel32(uint8_t *disp, const uint8_t *target) {
+  // displacement is relative to the end of the instruction
+  const int32_t rel = (int32_t)(target - (disp + 4));
+  memcpy(disp, &rel, sizeof(rel));
+}
+
+void cg_sub_r64_r64disp(struct cg_state_t *cg, cg_r64_t r1, cg_r64_t base, int32_t offset) {
+  cg_rex(cg, 1, r1 >= cg_r8, 0, base >= cg_r8);
+  cg_emit_data(cg, "\x2b", 1);
+  if (offset >= -128 && offset <= 127) {
+    cg_modrm(cg, 1, r1, base);
+    const int8_t offset8 = offset;
+    cg_emit_data(cg, &offset8, sizeof(offset8));
+  }
+  else {
+    cg_modrm(cg, 2, r1, base);
+    cg_emit_data(cg, &offset, sizeof(offset));
+  }
+}
+
+void cg_lea_r64_r64disp(struct cg_state_t *cg, cg_r64_t r1, cg_r64_t base, int32_t offset) {
+  cg_rex(cg, 1, r1 >= cg_r8, 0, base >= cg_r8);
+  cg_emit_data(cg, "\x8d", 1);
+  if (offset >= -128 && offset <= 127) {
+    cg_modrm(cg, 1, r1, base);
+    const int8_t offset8 = offset;
+    cg_emit_data(cg, &offset8, sizeof(offset8));
+  }
+  else {
+    cg_modrm(cg, 2, r1, base);
+    cg_emit_data(cg, &offset, sizeof(offset));
+  }
+}
+
+void cg_cmp_r64_r64disp(struct cg_state_t *cg, cg_r64_t r1, cg_r64_t base, int32_t offset) {
+  cg_rex(cg, 1, r1 >= cg_r8, 0, base >= cg_r8);
+  cg_emit_data(cg, "\x3b", 1);
+  if (offset >= -128 && offset <= 127) {
+    cg_modrm(cg, 1, r1, base);
+    const int8_t offset8 = offset;
+    cg_emit_data(cg, &offset8, sizeof(offset8));
+  }
+  else {
+    cg_modrm(cg, 2, r1, base);
+    cg_emit_data(cg, &offset, sizeof(offset));
+  }
+}
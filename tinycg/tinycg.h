@@ -10,6 +10,7 @@
 
 #pragma once
 #include <stdint.h>
+#include <stdbool.h>
 
 
 typedef int cg_r8_t;
@@ -50,6 +51,15 @@ enum {
   cg_ebp,
   cg_esi,
   cg_edi,
+  // extended registers
+  cg_r8d,
+  cg_r9d,
+  cg_r10d,
+  cg_r11d,
+  cg_r12d,
+  cg_r13d,
+  cg_r14d,
+  cg_r15d,
 };
 
 enum {
@@ -109,6 +119,8 @@ struct cg_state_t {
   const uint8_t *end;
   // the next writing location in the buffer
   uint8_t *head;
+  // set if an emit did not fit in the buffer
+  bool overflow;
 };
 
 // initalize the code generator
@@ -120,8 +132,12 @@ uint32_t cg_size(struct cg_state_t *);
 // clear all bytes written to the code buffer
 void cg_reset(struct cg_state_t *);
 
+// return true if the code buffer ran out of space
+bool cg_overflow(struct cg_state_t *);
+
 void cg_mov_r64_r64(struct cg_state_t *, cg_r64_t r1, cg_r64_t r2);
 void cg_mov_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+void cg_mov_r64_i64(struct cg_state_t *, cg_r64_t r1, uint64_t imm);
 void cg_mov_r64_i32(struct cg_state_t *, cg_r64_t r1, int32_t imm);
 void cg_mov_r32_i32(struct cg_state_t *, cg_r32_t r1, uint32_t imm);
 
@@ -144,10 +160,12 @@ void cg_movzx_r32_r16(struct cg_state_t *, cg_r32_t r1, cg_r16_t r2);
 void cg_add_r64_i32(struct cg_state_t *, cg_r64_t t1, int32_t imm);
 void cg_add_r32_i32(struct cg_state_t *, cg_r32_t r1, int32_t imm);
 void cg_add_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+void cg_add_r64_r64(struct cg_state_t *, cg_r64_t r1, cg_r64_t r2);
 void cg_add_r64disp_i32(struct cg_state_t *, cg_r64_t base, int32_t offset, int32_t imm);
 void cg_add_r64disp_r32(struct cg_state_t *, cg_r64_t base, int32_t offset, cg_r32_t src);
 
 void cg_and_r8_i8(struct cg_state_t *, cg_r8_t r1, uint8_t imm);
+void cg_and_r8_r8(struct cg_state_t *, cg_r8_t r1, cg_r8_t r2);
 void cg_and_r32_i32(struct cg_state_t *, cg_r32_t r1, uint32_t imm);
 void cg_and_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
 void cg_and_r64disp_i32(struct cg_state_t *, cg_r64_t base, int32_t offset, int32_t imm);
@@ -156,6 +174,8 @@ void cg_and_r64disp_r32(struct cg_state_t *, cg_r64_t base, int32_t offset, cg_r
 void cg_sub_r64_i32(struct cg_state_t *, cg_r64_t r1, int32_t imm);
 void cg_sub_r32_i32(struct cg_state_t *, cg_r32_t r1, int32_t imm);
 void cg_sub_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+void cg_sub_r64_r64(struct cg_state_t *, cg_r64_t r1, cg_r64_t r2);
+void cg_sub_r64_r64disp(struct cg_state_t *, cg_r64_t r1, cg_r64_t base, int32_t offset);
 void cg_sub_r64disp_i32(struct cg_state_t *, cg_r64_t base, int32_t offset, int32_t imm);
 void cg_sub_r64disp_r32(struct cg_state_t *, cg_r64_t base, int32_t offset, cg_r32_t src);
 
@@ -170,6 +190,7 @@ void cg_sar_r64disp_i8(struct cg_state_t *, cg_r64_t base, int32_t offset, uint8
 void cg_shr_r32_i8(struct cg_state_t *, cg_r32_t r1, uint8_t imm);
 void cg_shr_r32_cl(struct cg_state_t *, cg_r32_t r1);
 void cg_shr_r64disp_i8(struct cg_state_t *, cg_r64_t base, int32_t offset, uint8_t imm);
+void cg_shr_r64_i8(struct cg_state_t *, cg_r64_t r1, uint8_t imm);
 
 void cg_xor_r64_r64(struct cg_state_t *, cg_r64_t r1, cg_r64_t r2);
 void cg_xor_r32_i32(struct cg_state_t *, cg_r32_t r1, uint32_t imm);
@@ -185,6 +206,7 @@ void cg_or_r64disp_r32(struct cg_state_t *, cg_r64_t base, int32_t offset, cg_r3
 void cg_setcc_r8(struct cg_state_t *, cg_cc_t cc, cg_r8_t r1);
 
 void cg_cmp_r64_r64(struct cg_state_t *, cg_r64_t r1, cg_r64_t r2);
+void cg_cmp_r64_r64disp(struct cg_state_t *, cg_r64_t r1, cg_r64_t base, int32_t offset);
 void cg_cmp_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
 void cg_cmp_r32_i32(struct cg_state_t *, cg_r32_t r1, uint32_t imm);
 void cg_cmp_r32_r64disp(struct cg_state_t *, cg_r32_t r1, cg_r64_t base, int32_t offset);
@@ -192,16 +214,54 @@ void cg_cmp_r64disp_r32(struct cg_state_t *, cg_r64_t base, int32_t offset, cg_r
 void cg_cmp_r64disp_i32(struct cg_state_t *cg, cg_r64_t base, int32_t offset, int32_t imm);
 
 void cg_call_r64disp(struct cg_state_t *, cg_r64_t base, int32_t disp32);
+void cg_jmp_r64(struct cg_state_t *, cg_r64_t r1);
+void cg_jmp_r64disp(struct cg_state_t *, cg_r64_t base, int32_t disp);
 
 void cg_mul_r32(struct cg_state_t *, cg_r32_t r1);
 void cg_mul_r64disp(struct cg_state_t *, cg_r64_t base, int32_t offset);
 void cg_imul_r32(struct cg_state_t *, cg_r32_t r1);
 void cg_imul_r64disp(struct cg_state_t *, cg_r64_t base, int32_t offset);
+void cg_mul_r64(struct cg_state_t *, cg_r64_t r1);
+void cg_imul_r64_r64(struct cg_state_t *, cg_r64_t r1, cg_r64_t r2);
+void cg_imul_r32_r32_i32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2, int32_t imm);
+void cg_div_r32(struct cg_state_t *, cg_r32_t r1);
+void cg_idiv_r32(struct cg_state_t *, cg_r32_t r1);
+void cg_cdq(struct cg_state_t *);
+
+void cg_neg_r32(struct cg_state_t *, cg_r32_t r1);
+void cg_not_r32(struct cg_state_t *, cg_r32_t r1);
+
+void cg_rol_r32_cl(struct cg_state_t *, cg_r32_t r1);
+void cg_ror_r32_cl(struct cg_state_t *, cg_r32_t r1);
+void cg_ror_r32_i8(struct cg_state_t *, cg_r32_t r1, uint8_t imm);
+void cg_bswap_r32(struct cg_state_t *, cg_r32_t r1);
+
+// bit r2 (modulo 32) of r1 is reset, set or complemented
+void cg_btr_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+void cg_bts_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+void cg_btc_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+
+// bsr and bsf set zf and leave r1 undefined when r2 is zero
+void cg_bsr_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+void cg_bsf_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+
+// requires lzcnt (abm), bmi1 and popcnt respectively
+void cg_lzcnt_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+void cg_tzcnt_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+void cg_popcnt_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+
+// lea leaves the flags untouched
+void cg_lea_r64_r64disp(struct cg_state_t *, cg_r64_t r1, cg_r64_t base, int32_t offset);
 
 void cg_push_r64(struct cg_state_t *, cg_r64_t r1);
 void cg_pop_r64(struct cg_state_t *, cg_r64_t r1);
 
 void cg_nop(struct cg_state_t *);
+void cg_mfence(struct cg_state_t *);
+
+void cg_xchg_r64disp_r32(struct cg_state_t *, cg_r64_t base, int32_t disp, cg_r32_t r1);
+void cg_lock_xadd_r64disp_r32(struct cg_state_t *, cg_r64_t base, int32_t disp, cg_r32_t r1);
+void cg_lock_cmpxchg_r64disp_r32(struct cg_state_t *, cg_r64_t base, int32_t disp, cg_r32_t r1);
 
 void cg_cmov_r32_r32(struct cg_state_t *, cg_cc_t cc, cg_r32_t r1, cg_r32_t r2);
 
@@ -222,6 +282,80 @@ void cg_sqrtss_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int
 
 void cg_cvttss2si_r32_r64disp(struct cg_state_t *, cg_r32_t dst, cg_r64_t base, int32_t offset);
 void cg_cvtsi2ss_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset);
+void cg_cvttss2si_r64_r64disp(struct cg_state_t *, cg_r64_t dst, cg_r64_t base, int32_t offset);
+void cg_cvttss2si_r64_xmm(struct cg_state_t *, cg_r64_t dst, cg_xmm_t src);
+void cg_cvtsi2ss_xmm_r32(struct cg_state_t *, cg_xmm_t dst, cg_r32_t src);
+void cg_cvtsi2ss_xmm_r64(struct cg_state_t *, cg_xmm_t dst, cg_r64_t src);
+
+void cg_minss_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset);
+void cg_maxss_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset);
+
+void cg_movsd_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset);
+void cg_movsd_r64disp_xmm(struct cg_state_t *, cg_r64_t base, int32_t offset, cg_xmm_t dst);
+
+void cg_addsd_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset);
+void cg_subsd_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset);
+void cg_mulsd_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset);
+void cg_divsd_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset);
+
+void cg_sqrtsd_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset);
+
+void cg_cvtss2sd_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset);
+void cg_cvtsd2ss_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset);
+void cg_cvtsi2sd_xmm_r32(struct cg_state_t *, cg_xmm_t dst, cg_r32_t src);
+void cg_cvtsi2sd_xmm_r64(struct cg_state_t *, cg_xmm_t dst, cg_r64_t src);
+
+// ucomiss only raises invalid for signaling nans, comiss for any nan
+void cg_ucomiss_xmm_r64disp(struct cg_state_t *, cg_xmm_t src, cg_r64_t base, int32_t offset);
+void cg_comiss_xmm_r64disp(struct cg_state_t *, cg_xmm_t src, cg_r64_t base, int32_t offset);
+void cg_ucomiss_xmm_xmm(struct cg_state_t *, cg_xmm_t r1, cg_xmm_t r2);
+void cg_ucomisd_xmm_r64disp(struct cg_state_t *, cg_xmm_t src, cg_r64_t base, int32_t offset);
+void cg_comisd_xmm_r64disp(struct cg_state_t *, cg_xmm_t src, cg_r64_t base, int32_t offset);
+void cg_ucomisd_xmm_xmm(struct cg_state_t *, cg_xmm_t r1, cg_xmm_t r2);
+
+// load or store the sse control and status register
+void cg_ldmxcsr_r64disp(struct cg_state_t *, cg_r64_t base, int32_t offset);
+void cg_stmxcsr_r64disp(struct cg_state_t *, cg_r64_t base, int32_t offset);
+
+// requires sse4.1, mode is the roundss immediate
+void cg_roundss_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_r64_t base, int32_t offset, uint8_t mode);
+
+// requires fma3, dst = src * dst +/- [base + offset]
+void cg_vfmadd213ss_xmm_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset);
+void cg_vfmsub213ss_xmm_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset);
+void cg_vfnmadd213ss_xmm_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset);
+void cg_vfnmsub213ss_xmm_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset);
+void cg_vfmadd213sd_xmm_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset);
+void cg_vfmsub213sd_xmm_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset);
+void cg_vfnmadd213sd_xmm_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset);
+void cg_vfnmsub213sd_xmm_xmm_r64disp(struct cg_state_t *, cg_xmm_t dst, cg_xmm_t src, cg_r64_t base, int32_t offset);
 
 void cg_mov_r32_xmm(struct cg_state_t *, cg_r32_t dst, cg_xmm_t src);
 void cg_mov_xmm_r32(struct cg_state_t *, cg_xmm_t dst, cg_r32_t src);
+void cg_mov_r64_xmm(struct cg_state_t *, cg_r64_t dst, cg_xmm_t src);
+void cg_mov_xmm_r64(struct cg_state_t *, cg_xmm_t dst, cg_r64_t src);
+
+void cg_test_r32_r32(struct cg_state_t *, cg_r32_t r1, cg_r32_t r2);
+void cg_test_r64_r64(struct cg_state_t *, cg_r64_t r1, cg_r64_t r2);
+void cg_test_r8_i8(struct cg_state_t *, cg_r8_t r1, uint8_t imm);
+
+// memory operands of the form [base + index * scale]
+void cg_mov_r64_r64sib(struct cg_state_t *, cg_r64_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale);
+void cg_mov_r32_r64sib(struct cg_state_t *, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale);
+void cg_movzx_r32_r64sib8(struct cg_state_t *, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale);
+void cg_movzx_r32_r64sib16(struct cg_state_t *, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale);
+void cg_movsx_r32_r64sib8(struct cg_state_t *, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale);
+void cg_movsx_r32_r64sib16(struct cg_state_t *, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale);
+void cg_mov_r64sib_r32(struct cg_state_t *, cg_r64_t base, cg_r64_t index, uint32_t scale, cg_r32_t src);
+void cg_mov_r64sib_r64(struct cg_state_t *, cg_r64_t base, cg_r64_t index, uint32_t scale, cg_r64_t src);
+void cg_mov_r64sib_r16(struct cg_state_t *, cg_r64_t base, cg_r64_t index, uint32_t scale, cg_r16_t src);
+void cg_mov_r64sib_r8(struct cg_state_t *, cg_r64_t base, cg_r64_t index, uint32_t scale, cg_r8_t src);
+void cg_lea_r32_r64sib(struct cg_state_t *, cg_r32_t dst, cg_r64_t base, cg_r64_t index, uint32_t scale);
+
+// emit a jump with a 32bit displacement to target (which may be NULL).
+// returns the address of the displacement so it can be patched later.
+uint8_t *cg_jmp_rel32(struct cg_state_t *, const uint8_t *target);
+uint8_t *cg_jcc_rel32(struct cg_state_t *, cg_cc_t cc, const uint8_t *target);
+
+// patch a displacement returned by cg_jmp_rel32 or cg_jcc_rel32
+void cg_patch_rel32(uint8_t *disp, const uint8_t *target);
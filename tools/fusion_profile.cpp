@@ -0,0 +1,195 @@
+// profile how often pairs of instructions appear together in the basic blocks of
+// RISC-V ELF files and emit the table of pairs the interpreter fuses into
+// superinstructions (riscv_core/fusion.h).
+//
+// usage: fusion_profile [-o fusion.h] [-m min_pairs] file.elf ...
+//
+// note: counts are static, taken from every executable section, so they
+//       approximate rather than measure how often a pair is run.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "../riscv_vm/elf.h"
+#include "../riscv_vm/file.h"
+
+extern "C" {
+#include "../riscv_core/riscv_private.h"
+#include "../riscv_core/interp.h"
+}
+
+// number of dependent pairs listed in the report
+static const size_t report_pairs = 24;
+
+struct profile_t {
+  // adjacent pairs within a basic block
+  uint64_t pairs = 0;
+  // pairs where the second instruction reads the result of the first
+  std::map<std::pair<uint32_t, uint32_t>, uint64_t> dependent;
+  // pairs matching a fusion rule, keyed by first, second and superinstruction
+  std::map<std::tuple<uint32_t, uint32_t, uint32_t>, uint64_t> fusable;
+};
+
+static const char *fused_name(uint32_t fused) {
+  switch (fused) {
+  case rv_fuse_li:           return "rv_fuse_li";
+  case rv_fuse_la:           return "rv_fuse_la";
+  case rv_fuse_call:         return "rv_fuse_call";
+  case rv_fuse_index:        return "rv_fuse_index";
+  case rv_fuse_slt_branch:   return "rv_fuse_slt_branch";
+  case rv_fuse_sltu_branch:  return "rv_fuse_sltu_branch";
+  case rv_fuse_slti_branch:  return "rv_fuse_slti_branch";
+  case rv_fuse_sltiu_branch: return "rv_fuse_sltiu_branch";
+  default:                   return "unknown";
+  }
+}
+
+// count the instruction pairs in the executable sections of an ELF file
+static bool profile_elf(const char *path, profile_t &prof) {
+  file_t file;
+  if (!file.load(path)) {
+    fprintf(stderr, "Unable to load '%s'\n", path);
+    return false;
+  }
+  const uint8_t *data = file.data();
+  const ELF::Elf32_Ehdr *hdr = (const ELF::Elf32_Ehdr *)data;
+  if (file.size() < sizeof(*hdr) || memcmp(hdr->e_ident, "\x7f" "ELF", 4) ||
+      hdr->e_ident[ELF::EI_CLASS] != ELF::ELFCLASS32 || hdr->e_machine != ELF::EM_RISCV) {
+    fprintf(stderr, "'%s' is not a RV32 ELF file\n", path);
+    return false;
+  }
+  for (uint32_t s = 0; s < hdr->e_shnum; ++s) {
+    const ELF::Elf32_Shdr *shdr =
+      (const ELF::Elf32_Shdr *)(data + hdr->e_shoff + s * hdr->e_shentsize);
+    if (shdr->sh_type != ELF::SHT_PROGBITS || !(shdr->sh_flags & ELF::SHF_EXECINSTR)) {
+      continue;
+    }
+    if (shdr->sh_offset + shdr->sh_size > file.size()) {
+      continue;
+    }
+    // walk the section as the block decoder would
+    bool have_prev = false;
+    struct rv_inst_t prev, cur;
+    for (uint32_t i = 0; i + 2 <= shdr->sh_size;) {
+      uint32_t inst = 0;
+      memcpy(&inst, data + shdr->sh_offset + i, (i + 4 <= shdr->sh_size) ? 4 : 2);
+      inst = inst_expand(inst);
+      uint32_t pc = shdr->sh_addr + i;
+      i += inst_length(inst);
+      // skip data the decoder doesnt know
+      if (!decode(inst, &cur, &pc)) {
+        have_prev = false;
+        continue;
+      }
+      // blocks end at a branch so it cant be fused with what follows
+      if (have_prev && !inst_is_branch(&prev)) {
+        ++prof.pairs;
+        uint32_t use_a, def_a, use_b, def_b;
+        inst_regs(&prev, &use_a, &def_a);
+        inst_regs(&cur, &use_b, &def_b);
+        if (def_a & use_b) {
+          ++prof.dependent[{ prev.opcode, cur.opcode }];
+        }
+        if (const uint32_t fused = fuse_rule(&prev, &cur)) {
+          ++prof.fusable[{ prev.opcode, cur.opcode, fused }];
+        }
+      }
+      prev = cur;
+      have_prev = true;
+    }
+  }
+  return true;
+}
+
+static double percent(uint64_t x, uint64_t total) {
+  return total ? (100.0 * double(x) / double(total)) : 0.0;
+}
+
+int main(int argc, char **args) {
+  const char *out_path = nullptr;
+  uint64_t min_pairs = 1;
+  profile_t prof;
+  uint32_t num_files = 0;
+  for (int i = 1; i < argc; ++i) {
+    if (0 == strcmp(args[i], "-o") && i + 1 < argc) {
+      out_path = args[++i];
+      continue;
+    }
+    if (0 == strcmp(args[i], "-m") && i + 1 < argc) {
+      min_pairs = strtoull(args[++i], nullptr, 10);
+      continue;
+    }
+    if (!profile_elf(args[i], prof)) {
+      return 1;
+    }
+    ++num_files;
+  }
+  if (num_files == 0) {
+    fprintf(stderr, "usage: %s [-o fusion.h] [-m min_pairs] file.elf ...\n", args[0]);
+    return 1;
+  }
+
+  // report the most frequent dependent pairs
+  std::vector<std::pair<uint64_t, std::pair<uint32_t, uint32_t>>> dependent;
+  for (const auto &d : prof.dependent) {
+    dependent.push_back({ d.second, d.first });
+  }
+  std::sort(dependent.rbegin(), dependent.rend());
+  fprintf(stdout, "%llu instruction pairs in %u files\n",
+    (unsigned long long)prof.pairs, num_files);
+  fprintf(stdout, "\nMost frequent dependent pairs:\n");
+  for (size_t i = 0; i < dependent.size() && i < report_pairs; ++i) {
+    const auto &d = dependent[i];
+    fprintf(stdout, "  %-8s %-8s %8llu  %5.2f%%\n",
+      inst_name(d.second.first), inst_name(d.second.second),
+      (unsigned long long)d.first, percent(d.first, prof.pairs));
+  }
+
+  // report and emit the pairs matching a fusion rule
+  std::vector<std::pair<uint64_t, std::tuple<uint32_t, uint32_t, uint32_t>>> fusable;
+  for (const auto &f : prof.fusable) {
+    fusable.push_back({ f.second, f.first });
+  }
+  std::sort(fusable.rbegin(), fusable.rend());
+  fprintf(stdout, "\nFusable pairs:\n");
+  for (const auto &f : fusable) {
+    fprintf(stdout, "  %-8s %-8s %8llu  %5.2f%%  %s\n",
+      inst_name(std::get<0>(f.second)), inst_name(std::get<1>(f.second)),
+      (unsigned long long)f.first, percent(f.first, prof.pairs),
+      fused_name(std::get<2>(f.second)));
+  }
+
+  if (out_path) {
+    FILE *fd = fopen(out_path, "w");
+    if (!fd) {
+      fprintf(stderr, "Unable to write '%s'\n", out_path);
+      return 1;
+    }
+    fprintf(fd,
+      "// pairs of instructions fused into superinstructions when decoding a\n"
+      "// block, most frequent first.\n"
+      "// note: generated by tools/fusion_profile from the static pair counts of\n"
+      "//       tests/*.elf, the operand rules are fuse_rule in interp.h.\n"
+      "//\n"
+      "//   first            second           superinstruction          pairs\n");
+    for (const auto &f : fusable) {
+      if (f.first < min_pairs) {
+        continue;
+      }
+      char first[32], second[32], fused[32];
+      snprintf(first, sizeof(first), "rv_inst_%s,", inst_name(std::get<0>(f.second)));
+      snprintf(second, sizeof(second), "rv_inst_%s,", inst_name(std::get<1>(f.second)));
+      snprintf(fused, sizeof(fused), "%s", fused_name(std::get<2>(f.second)));
+      fprintf(fd, "  { %-16s %-16s %-21s },  // %llu\n",
+        first, second, fused, (unsigned long long)f.first);
+    }
+    fclose(fd);
+  }
+  return 0;
+}